@@ -0,0 +1,6 @@
+#ifndef FEATURE_H
+#define FEATURE_H
+
+#define FEAT_BST 1
+
+#endif /* FEATURE_H */
@@ -38,6 +38,8 @@
  * @param[in]   method      Method ID (from original request) that needs 
  *                          to be encoded in JSON.
  * @param[in]   pData       Data structure holding the required parameters.
+ * @param[in]   pStats      Trigger counters of the asic.
+ * @param[in]   pCollection Periodic collection counters of the asic.
  * @param[out]  pJsonBuffer Filled-in JSON buffer
  *                           
  * @retval   BVIEW_STATUS_SUCCESS  Data is encoded into JSON successfully
@@ -51,6 +53,8 @@
 BVIEW_STATUS bstjson_encode_get_bst_feature( int asicId,
                                             int method,
                                             const BSTJSON_CONFIGURE_BST_FEATURE_t *pData,
+                                            const BSTJSON_TRIGGER_STATS_t *pStats,
+                                            const BSTJSON_COLLECTION_STATS_t *pCollection,
                                             uint8_t **pJsonBuffer
                                             )
 {
@@ -62,19 +66,49 @@ BVIEW_STATUS bstjson_encode_get_bst_feature( int asicId,
 \"bst-enable\": %d,\
 \"send-async-reports\": %d,\
 \"collection-interval\": %d,\
-\"stat-units-in-cells\": %d\
+\"collection-interval-ms\": %d,\
+\"collection-align\": %d,\
+\"collection-align-offset-ms\": %d,\
+\"collection-interval-adaptive\": %d,\
+\"history-size-mb\": %d,\
+\"rollup-size-mb\": %d,\
+\"rollup-tiers\": [ %s ],\
+\"statistics-size-mb\": %d,\
+\"statistics-slice-sec\": %d,\
+\"journal-size-mb\": %d,\
+\"journal-file\": \"%s\",\
+\"stat-units-in-cells\": %d,\
+\"trigger-coalesce-interval\": %d,\
+\"trigger-rate-limit\": %d,\
+\"trigger-burst\": %d,\
+\"num-triggers\": %" PRIu64 ",\
+\"num-trigger-reports\": %" PRIu64 ",\
+\"num-triggers-coalesced\": %" PRIu64 ",\
+\"num-triggers-dropped\": %" PRIu64 ",\
+\"num-collection-cycles\": %" PRIu64 ",\
+\"num-collection-overruns\": %" PRIu64 ",\
+\"num-collection-ticks-skipped\": %" PRIu64 ",\
+\"num-reports-dropped\": %" PRIu64 ",\
+\"last-collection-us\": %" PRIu64 ",\
+\"last-report-us\": %" PRIu64 ",\
+\"max-collection-cycle-us\": %" PRIu64 ",\
+\"effective-collection-interval-ms\": %d\
 },\
 \"id\": %d\
 }";
 
     char *jsonBuf;
     char asicIdStr[JSON_MAX_NODE_LENGTH] = { 0 };
+    char tiersStr[BSTJSON_MAX_ROLLUP_TIERS * JSON_MAX_NODE_LENGTH] = { 0 };
+    int tiersLength = 0, tier = 0;
     BVIEW_STATUS status;
 
     _JSONENCODE_LOG(_JSONENCODE_DEBUG_TRACE, "BST-JSON-Encoder : Request for Get-Bst-Feature \n");
 
     /* Validate Input Parameters */
     _JSONENCODE_ASSERT (pData != NULL);
+    _JSONENCODE_ASSERT (pStats != NULL);
+    _JSONENCODE_ASSERT (pCollection != NULL);
 
     /* allocate memory for JSON */
     status = bstjson_memory_allocate(BSTJSON_MEMSIZE_RESPONSE, (uint8_t **) & jsonBuf);
@@ -86,11 +120,33 @@ BVIEW_STATUS bstjson_encode_get_bst_feature( int asicId,
     /* convert asicId to external  notation */
     JSON_ASIC_ID_MAP_TO_NOTATION(asicId, &asicIdStr[0]);
 
+    /* rollup tiers as [ interval-sec, retention ] pairs */
+    for (tier = 0; (tier < pData->numRollupTiers) && (tier < BSTJSON_MAX_ROLLUP_TIERS); tier++)
+    {
+        tiersLength += snprintf(&tiersStr[tiersLength], sizeof (tiersStr) - tiersLength,
+                                "%s[ %d, %d ]", (tier == 0) ? "" : " , ",
+                                pData->rollupIntervalSec[tier], pData->rollupRetention[tier]);
+    }
+
     /* encode the JSON */
     snprintf(jsonBuf, BSTJSON_MEMSIZE_RESPONSE, getBstFeatureTemplate,
              &asicIdStr[0], pData->bstEnable,
              pData->sendAsyncReports, pData->collectionInterval,
-             pData->statUnitsInCells, method);
+             pData->collectionIntervalMs,
+             pData->collectionAlign, pData->collectionAlignOffsetMs,
+             pData->collectionAdaptive, pData->historySizeMb,
+             pData->rollupSizeMb, &tiersStr[0],
+             pData->statisticsSizeMb, pData->statisticsSliceSec,
+             pData->journalSizeMb, &pData->journalFile[0],
+             pData->statUnitsInCells, pData->triggerCoalesceInterval,
+             pData->triggerRateLimit, pData->triggerBurst,
+             pStats->numTriggers, pStats->numReports,
+             pStats->numCoalesced, pStats->numDropped,
+             pCollection->numCycles, pCollection->numOverruns,
+             pCollection->numTicksSkipped, pCollection->numReportsDropped,
+             pCollection->lastCollectUs,
+             pCollection->lastReportUs, pCollection->maxCycleUs,
+             pCollection->effectiveIntervalMs, method);
 
     /* setup the return value */
     *pJsonBuffer = (uint8_t *) jsonBuf;
@@ -102,6 +158,99 @@ BVIEW_STATUS bstjson_encode_get_bst_feature( int asicId,
     return BVIEW_STATUS_SUCCESS;
 }
 
+/******************************************************************
+ * @brief  Creates a JSON buffer using the supplied data for the 
+ *         "configure-bst-thresholds-bulk" REST API.
+ *
+ * @param[in]   asicId      ASIC for which this data is being encoded.
+ * @param[in]   method      Method ID (from original request) that needs 
+ *                          to be encoded in JSON.
+ * @param[in]   status      Status of every threshold of the request.
+ * @param[in]   numThresholds Number of thresholds in the request.
+ * @param[out]  pJsonBuffer Filled-in JSON buffer
+ *                           
+ * @retval   BVIEW_STATUS_SUCCESS  Data is encoded into JSON successfully
+ * @retval   BVIEW_STATUS_INVALID_PARAMETER  Invalid input parameter
+ * @retval   BVIEW_STATUS_OUTOFMEMORY  No available memory to create JSON buffer
+ *
+ * @note     The status array is in the order of the thresholds of the 
+ *           request, 0 being a threshold applied to the asic.
+ *           The returned json-encoded-buffer should be freed using the  
+ *           bstjson_memory_free(). Failing to do so leads to memory leaks
+ *********************************************************************/
+BVIEW_STATUS bstjson_encode_configure_bst_thresholds_bulk( int asicId,
+                                            int method,
+                                            const BVIEW_STATUS *status,
+                                            unsigned int numThresholds,
+                                            uint8_t **pJsonBuffer
+                                            )
+{
+    char *bulkStartTemplate = " {\
+\"jsonrpc\": \"2.0\",\
+\"method\": \"configure-bst-thresholds-bulk\",\
+\"asic-id\": \"%s\",\
+\"result\": {\
+\"num-thresholds\": %u,\
+\"num-failed\": %u,\
+\"status\": [";
+
+    char *jsonBuf, *start;
+    char asicIdStr[JSON_MAX_NODE_LENGTH] = { 0 };
+    int bufLen = BSTJSON_MEMSIZE_REPORT - 1;
+    int actualLength = 0, tempLength = 0;
+    unsigned int index = 0, numFailed = 0;
+    BVIEW_STATUS rv;
+
+    _JSONENCODE_LOG(_JSONENCODE_DEBUG_TRACE, "BST-JSON-Encoder : Request for Configure-Bst-Thresholds-Bulk \n");
+
+    /* Validate Input Parameters */
+    _JSONENCODE_ASSERT (status != NULL);
+    _JSONENCODE_ASSERT (pJsonBuffer != NULL);
+
+    for (index = 0; index < numThresholds; index++)
+    {
+        if (status[index] != BVIEW_STATUS_SUCCESS)
+        {
+            numFailed++;
+        }
+    }
+
+    /* allocate memory for JSON, the status list does not fit a response slice */
+    rv = bstjson_memory_allocate(BSTJSON_MEMSIZE_REPORT, (uint8_t **) & jsonBuf);
+    _JSONENCODE_ASSERT (rv == BVIEW_STATUS_SUCCESS);
+
+    start = jsonBuf;
+
+    /* clear the buffer */
+    memset(jsonBuf, 0, BSTJSON_MEMSIZE_REPORT);
+
+    /* convert asicId to external  notation */
+    JSON_ASIC_ID_MAP_TO_NOTATION(asicId, &asicIdStr[0]);
+
+    /* encode the JSON */
+    _JSONENCODE_COPY_FORMATTED_STRING_AND_ADVANCE(tempLength, jsonBuf, bufLen, &actualLength,
+                                                  bulkStartTemplate, &asicIdStr[0],
+                                                  numThresholds, numFailed);
+
+    for (index = 0; index < numThresholds; index++)
+    {
+        _JSONENCODE_COPY_FORMATTED_STRING_AND_ADVANCE(tempLength, jsonBuf, bufLen, &actualLength,
+                                                      (index == 0) ? "%d" : ",%d", (int)status[index]);
+    }
+
+    _JSONENCODE_COPY_FORMATTED_STRING_AND_ADVANCE(tempLength, jsonBuf, bufLen, &actualLength,
+                                                  "]},\"id\": %d}", method);
+
+    /* setup the return value */
+    *pJsonBuffer = (uint8_t *) start;
+
+    _JSONENCODE_LOG(_JSONENCODE_DEBUG_TRACE, "BST-JSON-Encoder : Encoding complete [%d bytes] \n", actualLength);
+
+    _JSONENCODE_LOG(_JSONENCODE_DEBUG_DUMPJSON, "BST-JSON-Encoder : %s \n", start);
+
+    return BVIEW_STATUS_SUCCESS;
+}
+
 /******************************************************************
  * @brief  Creates a JSON buffer using the supplied data for the 
  *         "get-bst-tracking" REST API.
@@ -199,8 +348,8 @@ BVIEW_STATUS bstjson_encode_get_bst_tracking( int asicId,
  *********************************************************************/
 
 static BVIEW_STATUS _jsonencode_report_device ( char *jsonBuf,
-                                               const BVIEW_BST_ASIC_SNAPSHOT_DATA_t *previous,
-                                               const BVIEW_BST_ASIC_SNAPSHOT_DATA_t *current,
+                                               const BVIEW_BST_SNAPSHOT_DATA_t *previous,
+                                               const BVIEW_BST_SNAPSHOT_DATA_t *current,
                                                const BSTJSON_REPORT_OPTIONS_t *options,
                                                const BVIEW_ASIC_CAPABILITIES_t *asic,
                                                int bufLen,
@@ -226,14 +375,14 @@ static BVIEW_STATUS _jsonencode_report_device ( char *jsonBuf,
     }
 
     /* if there is no change in stats since we reported last time, ignore it*/
-    if  ((previous != NULL) && (current->device.bufferCount == previous->device.bufferCount))
+    if  ((previous != NULL) && (BVIEW_BST_SS_CNT(current, BVIEW_BST_CNT_DEVICE, 0) == BVIEW_BST_SS_CNT(previous, BVIEW_BST_CNT_DEVICE, 0)))
     {
         _JSONENCODE_LOG(_JSONENCODE_DEBUG_TRACE, "BST-JSON-Encoder : (Report) Device data %" PRIu64 " has not changed since last reading \n",
-                        current->device.bufferCount);
+                        BVIEW_BST_SS_CNT(current, BVIEW_BST_CNT_DEVICE, 0));
         return BVIEW_STATUS_SUCCESS;
     }
     /* data to be sent to collector */
-    data = current->device.bufferCount;
+    data = BVIEW_BST_SS_CNT(current, BVIEW_BST_CNT_DEVICE, 0);
 
     /* check if we need to convert the data to cells */
     if ((true == options->statUnitsInCells) &&
@@ -259,6 +408,232 @@ static BVIEW_STATUS _jsonencode_report_device ( char *jsonBuf,
     return BVIEW_STATUS_SUCCESS;
 }
 
+/******************************************************************
+ * @brief  Name of a realm, as used in the reports
+ *
+ * @param[in]   realm       Realm
+ *                           
+ * @retval   Name of the realm, empty string for an unknown realm
+ *
+ * @note     
+ *********************************************************************/
+static const char *_jsonencode_realm_name (BVIEW_BST_REALM_t realm)
+{
+    switch (realm)
+    {
+        case BVIEW_BST_REALM_DEVICE:
+            return "device";
+        case BVIEW_BST_REALM_INGRESS_PORT_PG:
+            return "ingress-port-priority-group";
+        case BVIEW_BST_REALM_INGRESS_PORT_SP:
+            return "ingress-port-service-pool";
+        case BVIEW_BST_REALM_INGRESS_SP:
+            return "ingress-service-pool";
+        case BVIEW_BST_REALM_EGRESS_PORT_SP:
+            return "egress-port-service-pool";
+        case BVIEW_BST_REALM_EGRESS_SP:
+            return "egress-service-pool";
+        case BVIEW_BST_REALM_EGRESS_UC_QUEUE:
+            return "egress-uc-queue";
+        case BVIEW_BST_REALM_EGRESS_UC_QUEUEGROUPS:
+            return "egress-uc-queue-group";
+        case BVIEW_BST_REALM_EGRESS_MC_QUEUE:
+            return "egress-mc-queue";
+        case BVIEW_BST_REALM_EGRESS_CPU_QUEUE:
+            return "egress-cpu-queue";
+        case BVIEW_BST_REALM_EGRESS_RQE_QUEUE:
+            return "egress-rqe-queue";
+        default:
+            return "";
+    }
+}
+
+/* names of the counters of a realm entry, in the order of the
+   values of a match */
+static const struct
+{
+    BVIEW_BST_REALM_t realm;
+    const char *name;
+} _jsonencode_counters[BVIEW_BST_NUM_COUNTERS] = {
+    {BVIEW_BST_REALM_DEVICE, "buffer-count"},
+    {BVIEW_BST_REALM_INGRESS_PORT_PG, "um-share-buffer-count"},
+    {BVIEW_BST_REALM_INGRESS_PORT_PG, "um-headroom-buffer-count"},
+    {BVIEW_BST_REALM_INGRESS_PORT_SP, "um-share-buffer-count"},
+    {BVIEW_BST_REALM_INGRESS_SP, "um-share-buffer-count"},
+    {BVIEW_BST_REALM_EGRESS_PORT_SP, "uc-share-buffer-count"},
+    {BVIEW_BST_REALM_EGRESS_PORT_SP, "um-share-buffer-count"},
+    {BVIEW_BST_REALM_EGRESS_PORT_SP, "mc-share-buffer-count"},
+    {BVIEW_BST_REALM_EGRESS_PORT_SP, "mc-share-queue-entries"},
+    {BVIEW_BST_REALM_EGRESS_SP, "um-share-buffer-count"},
+    {BVIEW_BST_REALM_EGRESS_SP, "mc-share-buffer-count"},
+    {BVIEW_BST_REALM_EGRESS_SP, "mc-share-queue-entries"},
+    {BVIEW_BST_REALM_EGRESS_UC_QUEUE, "uc-buffer-count"},
+    {BVIEW_BST_REALM_EGRESS_UC_QUEUEGROUPS, "uc-buffer-count"},
+    {BVIEW_BST_REALM_EGRESS_MC_QUEUE, "mc-buffer-count"},
+    {BVIEW_BST_REALM_EGRESS_MC_QUEUE, "mc-queue-entries"},
+    {BVIEW_BST_REALM_EGRESS_CPU_QUEUE, "cpu-buffer-count"},
+    {BVIEW_BST_REALM_EGRESS_CPU_QUEUE, "cpu-queue-entries"},
+    {BVIEW_BST_REALM_EGRESS_RQE_QUEUE, "rqe-buffer-count"},
+    {BVIEW_BST_REALM_EGRESS_RQE_QUEUE, "rqe-queue-entries"}
+};
+
+/******************************************************************
+ * @brief  Creates a JSON buffer using the supplied data for the 
+ *         "get-bst-report" REST API - sampling time of the realms.
+ *
+ *********************************************************************/
+
+static BVIEW_STATUS _jsonencode_report_realm_time ( char *jsonBuf,
+                                                   const BVIEW_BST_REALM_TIME_t *realmTime,
+                                                   int bufLen,
+                                                   int *length)
+{
+    char *getBstRealmTimeTemplate = "%s{\
+\"realm\": \"%s\",\
+\"start-monotonic-ns\": %" PRIu64 ",\
+\"end-monotonic-ns\": %" PRIu64 ",\
+\"start-realtime-ns\": %" PRIu64 ",\
+\"end-realtime-ns\": %" PRIu64 "\
+}";
+    BVIEW_BST_REALM_t realm;
+    const BVIEW_BST_REALM_TIME_t *window;
+    int tempLength = 0;
+    bool first = true;
+
+    *length = 0;
+
+    BVIEW_BST_REALM_ITER(realm)
+    {
+        window = &realmTime[BVIEW_BST_REALM_INDEX(realm)];
+        /* realms which are not read in this snapshot are not reported */
+        if (window->end.monotonic == 0)
+        {
+            continue;
+        }
+
+        tempLength = snprintf(jsonBuf, bufLen, getBstRealmTimeTemplate,
+                              (first == true) ? "\"realm-time\": [ " : ",",
+                              _jsonencode_realm_name(realm),
+                              window->start.monotonic, window->end.monotonic,
+                              window->start.realtime, window->end.realtime);
+        jsonBuf += tempLength;
+        bufLen -= tempLength;
+        *length += tempLength;
+        first = false;
+    }
+
+    if (first == false)
+    {
+        tempLength = snprintf(jsonBuf, bufLen, " ],");
+        *length += tempLength;
+    }
+
+    return BVIEW_STATUS_SUCCESS;
+}
+
+/******************************************************************
+ * @brief  Encodes the "report" array of a report, with the realms
+ *         selected by the options.
+ *
+ * @param[in]   jsonBuf     Buffer to encode into, cleared
+ * @param[in]   asicId      ASIC for which this data is being encoded.
+ * @param[in]   previous    Record the bitmaps of current were computed
+ *                          against, NULL for a complete report
+ * @param[in]   current     Record to be reported
+ * @param[in]   options     Realms to be reported
+ * @param[in]   asic        Capabilities of the ASIC
+ * @param[in]   bufLen      Length of the buffer
+ * @param[out]  length      Number of bytes encoded
+ *
+ * @retval   BVIEW_STATUS_SUCCESS  Data is encoded into JSON successfully
+ * @retval   BVIEW_STATUS_OUTOFMEMORY  The buffer is exhausted
+ *
+ * @note     The array is closed, the caller adds what follows it.
+ *********************************************************************/
+static BVIEW_STATUS _jsonencode_report_body ( char *jsonBuf,
+                                             int asicId,
+                                             const BVIEW_BST_SNAPSHOT_DATA_t *previous,
+                                             const BVIEW_BST_SNAPSHOT_DATA_t *current,
+                                             const BSTJSON_REPORT_OPTIONS_t *options,
+                                             const BVIEW_ASIC_CAPABILITIES_t *asic,
+                                             int bufLen,
+                                             int *length)
+{
+    char *start = jsonBuf;
+    int bufferLength = bufLen;
+    int tempLength = 0;
+    BVIEW_STATUS status;
+
+    tempLength = snprintf(jsonBuf, bufferLength, "\"report\": [ ");
+    jsonBuf += tempLength;
+    bufferLength -= tempLength;
+
+    /* get the device report */
+    status = _jsonencode_report_device(jsonBuf, previous, current, options, asic, bufferLength, &tempLength);
+    _JSONENCODE_ASSERT_ERROR((status == BVIEW_STATUS_SUCCESS), status);
+
+    if (tempLength)
+    {
+        bufferLength -= tempLength;
+        jsonBuf += tempLength;
+
+        tempLength = snprintf(jsonBuf, bufferLength, " ,");
+
+        bufferLength -= tempLength;
+        jsonBuf += tempLength;
+    }
+
+    /* if any of the ingress encodings are required, add them to report */
+    if (options->includeIngressPortPriorityGroup ||
+        options->includeIngressPortServicePool ||
+        options->includeIngressServicePool)
+    {
+        status = _jsonencode_report_ingress(jsonBuf, asicId, previous, current, options, asic, bufferLength, &tempLength);
+        _JSONENCODE_ASSERT_ERROR((status == BVIEW_STATUS_SUCCESS), status);
+
+        /* adjust the buffer */
+        bufferLength -= (tempLength);
+        jsonBuf += (tempLength);
+
+    }
+
+    /* if any of the egress encodings are required, add them to report */
+    if (options->includeEgressCpuQueue ||
+        options->includeEgressMcQueue ||
+        options->includeEgressPortServicePool ||
+        options->includeEgressRqeQueue ||
+        options->includeEgressServicePool ||
+        options->includeEgressUcQueue ||
+        options->includeEgressUcQueueGroup )
+    {
+        status = _jsonencode_report_egress(jsonBuf, asicId, previous, current, options, asic, bufferLength, &tempLength);
+        _JSONENCODE_ASSERT_ERROR((status == BVIEW_STATUS_SUCCESS), status);
+
+        /* adjust the buffer */
+        bufferLength -= (tempLength);
+        jsonBuf += (tempLength);
+
+    }
+
+    /* finalizing the realms */
+
+    bufferLength -= 1;
+    jsonBuf -= 1;
+
+    if (jsonBuf[0] == 0)
+    {
+        bufferLength -= 1;
+        jsonBuf--;
+    }
+
+    tempLength = snprintf(jsonBuf, bufferLength, " ]");
+    jsonBuf += tempLength;
+
+    *length = (int) (jsonBuf - start);
+
+    return BVIEW_STATUS_SUCCESS;
+}
+
 /******************************************************************
  * @brief  Creates a JSON buffer using the supplied data for the 
  *         "get-bst-report" REST API.
@@ -267,6 +642,7 @@ static BVIEW_STATUS _jsonencode_report_device ( char *jsonBuf,
  * @param[in]   method      Method ID (from original request) that needs 
  *                          to be encoded in JSON.
  * @param[in]   pData       Data structure holding the required parameters.
+ * @param[in]   realmTime   Sampling window of every realm, can be NULL
  * @param[out]  pJsonBuffer Filled-in JSON buffer
  *                           
  * @retval   BVIEW_STATUS_SUCCESS  Data is encoded into JSON successfully
@@ -274,17 +650,23 @@ static BVIEW_STATUS _jsonencode_report_device ( char *jsonBuf,
  * @retval   BVIEW_STATUS_INVALID_PARAMETER  Invalid input parameter
  * @retval   BVIEW_STATUS_OUTOFMEMORY  No available memory to create JSON buffer
  *
- * @note     The returned json-encoded-buffer should be freed using the  
+ * @note     Trigger reports carry the realm, port and index of the
+ *           counter which raised the trigger.
+ *           Only the entries set in the bitmaps of the current record
+ *           are visited, previous must be the record they were computed
+ *           against.
+ *           The returned json-encoded-buffer should be freed using the  
  *           bstjson_memory_free(). Failing to do so leads to memory leaks
  *********************************************************************/
 
 BVIEW_STATUS bstjson_encode_get_bst_report ( int asicId,
                                             int method,
-                                            const BVIEW_BST_ASIC_SNAPSHOT_DATA_t *previous,
-                                            const BVIEW_BST_ASIC_SNAPSHOT_DATA_t *current,
+                                            const BVIEW_BST_SNAPSHOT_DATA_t *previous,
+                                            const BVIEW_BST_SNAPSHOT_DATA_t *current,
                                             const BSTJSON_REPORT_OPTIONS_t *options,
                                             const BVIEW_ASIC_CAPABILITIES_t *asic,
                                             const BVIEW_TIME_t *time,
+                                            const BVIEW_BST_REALM_TIME_t *realmTime,
                                             uint8_t **pJsonBuffer
                                             )
 {
@@ -297,6 +679,8 @@ BVIEW_STATUS bstjson_encode_get_bst_report ( int asicId,
     struct tm *timeinfo;
     char timeString[64];
     char asicIdStr[JSON_MAX_NODE_LENGTH] = { 0 };
+    char triggerPortStr[JSON_MAX_NODE_LENGTH] = { 0 };
+    bool triggerContext = false;
 
 
 
@@ -305,7 +689,14 @@ BVIEW_STATUS bstjson_encode_get_bst_report ( int asicId,
 \"method\": \"%s\",\
 \"asic-id\": \"%s\",\
 \"time-stamp\": \"%s\",\
-\"report\": [ \
+";
+
+    char *getBstTriggerReportStart = " { \
+\"jsonrpc\": \"2.0\",\
+\"method\": \"%s\",\
+\"asic-id\": \"%s\",\
+\"time-stamp\": \"%s\",\
+\"trigger\": { \"realm\": \"%s\", \"port\": \"%s\", \"index\": %d },\
 ";
 
     _JSONENCODE_LOG(_JSONENCODE_DEBUG_TRACE, "BST-JSON-Encoder : Request for Get-Bst-Report \n");
@@ -322,6 +713,16 @@ BVIEW_STATUS bstjson_encode_get_bst_report ( int asicId,
     timeinfo = localtime(&report_time);
     strftime(timeString, 64, "%Y-%m-%d - %H:%M:%S ", timeinfo);
 
+    /* context of the trigger, port is empty for realms which are not per port */
+    if ((options->reportTrigger == true) && (options->triggerInfo.realm != 0))
+    {
+        triggerContext = true;
+        if (options->triggerInfo.port != 0)
+        {
+            JSON_PORT_MAP_TO_NOTATION(options->triggerInfo.port, asicId, &triggerPortStr[0]);
+        }
+    }
+
     /* allocate memory for JSON */
     status = bstjson_memory_allocate(BSTJSON_MEMSIZE_REPORT, (uint8_t **) & jsonBuf);
     _JSONENCODE_ASSERT (status == BVIEW_STATUS_SUCCESS);
@@ -336,72 +737,50 @@ BVIEW_STATUS bstjson_encode_get_bst_report ( int asicId,
 
     /* fill the header */
     /* encode the JSON */
-    tempLength = snprintf(jsonBuf, bufferLength, getBstReportStart,
-                          (options->reportThreshold == true) ? "get-bst-thresholds" :((options->reportTrigger == true)? "trigger-report":"get-bst-report"),
-                          &asicIdStr[0], timeString);
+    if (triggerContext == true)
+    {
+        tempLength = snprintf(jsonBuf, bufferLength, getBstTriggerReportStart,
+                              "trigger-report", &asicIdStr[0], timeString,
+                              _jsonencode_realm_name(options->triggerInfo.realm),
+                              &triggerPortStr[0], options->triggerInfo.index);
+    }
+    else
+    {
+        tempLength = snprintf(jsonBuf, bufferLength, getBstReportStart,
+                              (options->reportThreshold == true) ? "get-bst-thresholds" :((options->reportTrigger == true)? "trigger-report":"get-bst-report"),
+                              &asicIdStr[0], timeString);
+    }
 
     jsonBuf += tempLength;
     bufferLength -= tempLength;
 
-    /* get the device report */
-    status = _jsonencode_report_device(jsonBuf, previous, current, options, asic, bufferLength, &tempLength);
-    _JSONENCODE_ASSERT_ERROR((status == BVIEW_STATUS_SUCCESS), status);
-
-    if (tempLength)
+    /* how far the aligned collection was from its wall clock boundary */
+    if (options->reportAlignment == true)
     {
-        bufferLength -= tempLength;
+        tempLength = snprintf(jsonBuf, bufferLength, "\"alignment-error-ns\": %" PRId64 ",",
+                              options->alignErrorNs);
         jsonBuf += tempLength;
-
-        tempLength = snprintf(jsonBuf, bufferLength, " ,");
-
         bufferLength -= tempLength;
-        jsonBuf += tempLength;
     }
 
-    /* if any of the ingress encodings are required, add them to report */
-    if (options->includeIngressPortPriorityGroup ||
-        options->includeIngressPortServicePool ||
-        options->includeIngressServicePool)
-    {
-        status = _jsonencode_report_ingress(jsonBuf, asicId, previous, current, options, asic, bufferLength, &tempLength);
-        _JSONENCODE_ASSERT_ERROR((status == BVIEW_STATUS_SUCCESS), status);
-
-        /* adjust the buffer */
-        bufferLength -= (tempLength);
-        jsonBuf += (tempLength);
-
-    }
-
-    /* if any of the egress encodings are required, add them to report */
-    if (options->includeEgressCpuQueue ||
-        options->includeEgressMcQueue ||
-        options->includeEgressPortServicePool ||
-        options->includeEgressRqeQueue ||
-        options->includeEgressServicePool ||
-        options->includeEgressUcQueue ||
-        options->includeEgressUcQueueGroup )
+    /* when each of the realms was sampled */
+    if (realmTime != NULL)
     {
-        status = _jsonencode_report_egress(jsonBuf, asicId, previous, current, options, asic, bufferLength, &tempLength);
+        status = _jsonencode_report_realm_time(jsonBuf, realmTime, bufferLength, &tempLength);
         _JSONENCODE_ASSERT_ERROR((status == BVIEW_STATUS_SUCCESS), status);
 
-        /* adjust the buffer */
-        bufferLength -= (tempLength);
-        jsonBuf += (tempLength);
-
+        jsonBuf += tempLength;
+        bufferLength -= tempLength;
     }
 
-    /* finalizing the report */
-
-    bufferLength -= 1;
-    jsonBuf -= 1;
+    /* the realms of the report */
+    status = _jsonencode_report_body(jsonBuf, asicId, previous, current, options, asic, bufferLength, &tempLength);
+    _JSONENCODE_ASSERT_ERROR((status == BVIEW_STATUS_SUCCESS), status);
 
-    if (jsonBuf[0] == 0)
-    {
-        bufferLength -= 1;
-        jsonBuf--;
-    }
+    jsonBuf += tempLength;
+    bufferLength -= tempLength;
 
-    tempLength = snprintf(jsonBuf, bufferLength, " ] } ");
+    tempLength = snprintf(jsonBuf, bufferLength, " } ");
 
     *pJsonBuffer = (uint8_t *) start;
 
@@ -413,3 +792,787 @@ BVIEW_STATUS bstjson_encode_get_bst_report ( int asicId,
     return BVIEW_STATUS_SUCCESS;
 }
 
+
+/******************************************************************
+ * @brief  Whether a realm is selected by the options of a report
+ *
+ * @param[in]   options     Realms to be reported
+ * @param[in]   realm       Realm
+ *                           
+ * @retval   true if the realm is part of the report
+ *
+ * @note     
+ *********************************************************************/
+static bool _jsonencode_realm_included (const BSTJSON_REPORT_OPTIONS_t *options,
+                                        BVIEW_BST_REALM_t realm)
+{
+    switch (realm)
+    {
+        case BVIEW_BST_REALM_DEVICE:
+            return options->includeDevice;
+        case BVIEW_BST_REALM_INGRESS_PORT_PG:
+            return options->includeIngressPortPriorityGroup;
+        case BVIEW_BST_REALM_INGRESS_PORT_SP:
+            return options->includeIngressPortServicePool;
+        case BVIEW_BST_REALM_INGRESS_SP:
+            return options->includeIngressServicePool;
+        case BVIEW_BST_REALM_EGRESS_PORT_SP:
+            return options->includeEgressPortServicePool;
+        case BVIEW_BST_REALM_EGRESS_SP:
+            return options->includeEgressServicePool;
+        case BVIEW_BST_REALM_EGRESS_UC_QUEUE:
+            return options->includeEgressUcQueue;
+        case BVIEW_BST_REALM_EGRESS_UC_QUEUEGROUPS:
+            return options->includeEgressUcQueueGroup;
+        case BVIEW_BST_REALM_EGRESS_MC_QUEUE:
+            return options->includeEgressMcQueue;
+        case BVIEW_BST_REALM_EGRESS_CPU_QUEUE:
+            return options->includeEgressCpuQueue;
+        case BVIEW_BST_REALM_EGRESS_RQE_QUEUE:
+            return options->includeEgressRqeQueue;
+        default:
+            return false;
+    }
+}
+
+/******************************************************************
+ * @brief  Upper bound of the length of the "report" array of a record
+ *
+ * @param[in]   options     Realms to be reported
+ * @param[in]   previous    Record the bitmaps of current were computed
+ *                          against, NULL for a complete report
+ * @param[in]   current     Record to be reported
+ *                           
+ * @retval   Length in bytes
+ *
+ * @note     Counts the entries set in the bitmaps of the selected realms,
+ *           each of them at the length of the longest entry along
+ *           with the header of its port.
+ *********************************************************************/
+static int _jsonencode_report_size_estimate (const BSTJSON_REPORT_OPTIONS_t *options,
+                                             const BVIEW_BST_SNAPSHOT_DATA_t *previous,
+                                             const BVIEW_BST_SNAPSHOT_DATA_t *current)
+{
+    BVIEW_BST_REALM_t realm;
+    unsigned int word;
+    int numEntries = 0;
+
+    BVIEW_BST_REALM_ITER(realm)
+    {
+        if (false == _jsonencode_realm_included(options, realm))
+        {
+            continue;
+        }
+
+        for (word = 0; word < BVIEW_BST_SS_REPORT_WORDS(current, realm, (previous != NULL)); word++)
+        {
+            numEntries += __builtin_popcountll(BVIEW_BST_SS_REPORT_BITS(current, BVIEW_BST_REALM_INDEX(realm),
+                                                                        (previous != NULL), word));
+        }
+    }
+
+    return BSTJSON_REPORT_REALMS_LENGTH + (numEntries * BSTJSON_REPORT_ENTRY_LENGTH);
+}
+
+/******************************************************************
+ * @brief  Creates a JSON buffer using the supplied data for the 
+ *         "get-bst-history" REST API.
+ *
+ * @param[in]   asicId      ASIC for which this data is being encoded.
+ * @param[in]   method      Method ID (from original request) that needs 
+ *                          to be encoded in JSON.
+ * @param[in]   options     Realms to be reported
+ * @param[in]   asic        Capabilities of the ASIC
+ * @param[in]   info        Sequence numbers and usage of the history
+ * @param[in]   maxEntries  Entries of the response, 0 is unlimited
+ * @param[in]   next        Returns the entries of the request in order
+ * @param[in]   cookie      Passed to next
+ * @param[out]  pJsonBuffer Filled-in JSON buffer
+ *                           
+ * @retval   BVIEW_STATUS_SUCCESS  Data is encoded into JSON successfully
+ * @retval   BVIEW_STATUS_RESOURCE_NOT_AVAILABLE  Internal Error
+ * @retval   BVIEW_STATUS_INVALID_PARAMETER  Invalid input parameter
+ * @retval   BVIEW_STATUS_OUTOFMEMORY  No available memory to create JSON buffer
+ *
+ * @note     The first entry is reported in full, the others with the
+ *           counters which changed since the entry before them.
+ *           Entries which do not fit in the buffer are left to the
+ *           next request, from "resume-sequence-number".
+ *           The returned json-encoded-buffer should be freed using the  
+ *           bstjson_memory_free(). Failing to do so leads to memory leaks
+ *********************************************************************/
+
+BVIEW_STATUS bstjson_encode_get_bst_history ( int asicId,
+                                             int method,
+                                             const BSTJSON_REPORT_OPTIONS_t *options,
+                                             const BVIEW_ASIC_CAPABILITIES_t *asic,
+                                             const BSTJSON_HISTORY_INFO_t *info,
+                                             unsigned int maxEntries,
+                                             BSTJSON_HISTORY_NEXT_t next,
+                                             void *cookie,
+                                             uint8_t **pJsonBuffer
+                                             )
+{
+    char *jsonBuf, *start;
+    BVIEW_STATUS status;
+    int bufferLength = BSTJSON_MEMSIZE_REPORT;
+    int tempLength = 0;
+    unsigned int numEntries = 0;
+    bool more = false;
+    BSTJSON_HISTORY_ENTRY_t entry;
+
+    time_t report_time;
+    struct tm *timeinfo;
+    char timeString[64];
+    char asicIdStr[JSON_MAX_NODE_LENGTH] = { 0 };
+
+    char *getBstHistoryStart = " { \
+\"jsonrpc\": \"2.0\",\
+\"method\": \"get-bst-history\",\
+\"asic-id\": \"%s\",\
+\"first-sequence-number\": %" PRIu64 ",\
+\"next-sequence-number\": %" PRIu64 ",\
+\"history-bytes-used\": %" PRIu64 ",\
+\"history-size\": %" PRIu64 ",\
+\"entries\": [ ";
+
+    char *getBstHistoryEntryStart = "%s{ \
+\"sequence-number\": %" PRIu64 ",\
+\"time-stamp\": \"%s\",\
+\"realtime-ns\": %" PRIu64 ",\
+";
+
+    _JSONENCODE_LOG(_JSONENCODE_DEBUG_TRACE, "BST-JSON-Encoder : Request for Get-Bst-History \n");
+
+    /* Validate Input Parameters */
+    _JSONENCODE_ASSERT (options != NULL);
+    _JSONENCODE_ASSERT (asic != NULL);
+    _JSONENCODE_ASSERT (info != NULL);
+    _JSONENCODE_ASSERT (next != NULL);
+
+    /* allocate memory for JSON */
+    status = bstjson_memory_allocate(BSTJSON_MEMSIZE_REPORT, (uint8_t **) & jsonBuf);
+    _JSONENCODE_ASSERT (status == BVIEW_STATUS_SUCCESS);
+
+    start = jsonBuf;
+
+    /* clear the buffer */
+    memset(jsonBuf, 0, BSTJSON_MEMSIZE_REPORT);
+
+    /* convert asicId to external  notation */
+    JSON_ASIC_ID_MAP_TO_NOTATION(asicId, &asicIdStr[0]);
+
+    /* fill the header */
+    tempLength = snprintf(jsonBuf, bufferLength, getBstHistoryStart, &asicIdStr[0],
+                          info->firstSequenceNumber, info->nextSequenceNumber,
+                          info->bytesUsed, info->size);
+    jsonBuf += tempLength;
+    bufferLength -= tempLength;
+
+    while (true == next(cookie, &entry))
+    {
+        /* an entry is always reported, the others if they fit */
+        if (((maxEntries != 0) && (numEntries >= maxEntries)) ||
+            ((numEntries != 0) &&
+             ((bufferLength - BSTJSON_HISTORY_END_LENGTH) <
+              (BSTJSON_HISTORY_ENTRY_LENGTH + _jsonencode_report_size_estimate(options, entry.previous, entry.current)))))
+        {
+            more = true;
+            break;
+        }
+
+        /* obtain the time */
+        memset(&timeString, 0, sizeof (timeString));
+        report_time = entry.time;
+        timeinfo = localtime(&report_time);
+        strftime(timeString, 64, "%Y-%m-%d - %H:%M:%S ", timeinfo);
+
+        tempLength = snprintf(jsonBuf, bufferLength, getBstHistoryEntryStart,
+                              (numEntries == 0) ? "" : " ,",
+                              entry.sequenceNumber, timeString, entry.realtimeNs);
+        jsonBuf += tempLength;
+        bufferLength -= tempLength;
+
+        status = _jsonencode_report_body(jsonBuf, asicId, entry.previous, entry.current,
+                                         options, asic, bufferLength, &tempLength);
+        if (status != BVIEW_STATUS_SUCCESS)
+        {
+            bstjson_memory_free((uint8_t *) start);
+            return status;
+        }
+        jsonBuf += tempLength;
+        bufferLength -= tempLength;
+
+        tempLength = snprintf(jsonBuf, bufferLength, " }");
+        jsonBuf += tempLength;
+        bufferLength -= tempLength;
+
+        numEntries++;
+    }
+
+    if (more == true)
+    {
+        tempLength = snprintf(jsonBuf, bufferLength, " ],\"more-entries\": 1,\"resume-sequence-number\": %" PRIu64 " } ",
+                              entry.sequenceNumber);
+    }
+    else
+    {
+        tempLength = snprintf(jsonBuf, bufferLength, " ],\"more-entries\": 0 } ");
+    }
+
+    *pJsonBuffer = (uint8_t *) start;
+
+    _JSONENCODE_LOG(_JSONENCODE_DEBUG_TRACE, "BST-JSON-Encoder : Request for Get-Bst-History Complete [%d] bytes, %u entries \n",
+                    (int)strlen(start), numEntries);
+
+    _JSONENCODE_LOG(_JSONENCODE_DEBUG_DUMPJSON, "BST-JSON-Encoder : %s \n", start);
+
+    return BVIEW_STATUS_SUCCESS;
+}
+
+/******************************************************************
+ * @brief  Creates a JSON buffer using the supplied data for the 
+ *         "query-bst-history" REST API - matches of a sample.
+ *
+ * @note     Matches are encoded as long as they fit in the buffer,
+ *           the others are left out.
+ *
+ *********************************************************************/
+
+static BVIEW_STATUS _jsonencode_query_data ( char *jsonBuf,
+                                            int asicId,
+                                            const BSTJSON_QUERY_SAMPLE_t *sample,
+                                            int bufLen,
+                                            int *length,
+                                            bool *truncated)
+{
+    int tempLength = 0;
+    unsigned int index = 0, value = 0;
+    const BSTJSON_QUERY_MATCH_t *match;
+    char portStr[JSON_MAX_NODE_LENGTH] = { 0 };
+
+    *length = 0;
+    *truncated = false;
+
+    tempLength = snprintf(jsonBuf, bufLen, "\"data\": [ ");
+    jsonBuf += tempLength;
+    bufLen -= tempLength;
+    *length += tempLength;
+
+    for (index = 0; index < sample->numMatches; index++)
+    {
+        if (bufLen < BSTJSON_QUERY_MATCH_LENGTH)
+        {
+            *truncated = true;
+            break;
+        }
+        match = &sample->matches[index];
+
+        /* the realms not kept per port have no port */
+        portStr[0] = 0;
+        if (match->port != 0)
+        {
+            JSON_PORT_MAP_TO_NOTATION(match->port, asicId, &portStr[0]);
+        }
+
+        tempLength = snprintf(jsonBuf, bufLen, "%s[ \"%s\", \"%s\", %u",
+                              (index == 0) ? "" : " , ",
+                              _jsonencode_realm_name(match->realm), &portStr[0], match->index);
+        jsonBuf += tempLength;
+        bufLen -= tempLength;
+        *length += tempLength;
+
+        for (value = 0; value < match->numValues; value++)
+        {
+            tempLength = snprintf(jsonBuf, bufLen, ", %" PRIu64, match->values[value]);
+            jsonBuf += tempLength;
+            bufLen -= tempLength;
+            *length += tempLength;
+        }
+
+        tempLength = snprintf(jsonBuf, bufLen, " ]");
+        jsonBuf += tempLength;
+        bufLen -= tempLength;
+        *length += tempLength;
+    }
+
+    tempLength = snprintf(jsonBuf, bufLen, " ]");
+    *length += tempLength;
+
+    return BVIEW_STATUS_SUCCESS;
+}
+
+/******************************************************************
+ * @brief  Creates a JSON buffer using the supplied data for the 
+ *         "query-bst-history" REST API.
+ *
+ * @param[in]   asicId      ASIC for which this data is being encoded.
+ * @param[in]   method      Method ID (from original request) that needs 
+ *                          to be encoded in JSON.
+ * @param[in]   info        Sequence numbers and usage of the history,
+ *                          or bucket numbers of the rollup
+ * @param[in]   aggregate   Aggregate of the samples, or none
+ * @param[in]   maxEntries  Samples of the response, 0 is unlimited
+ * @param[in]   next        Returns the samples of the query in order,
+ *                          or its aggregate
+ * @param[in]   cookie      Passed to next
+ * @param[in]   stats       Blocks of the history, or buckets of the
+ *                          rollup, visited by next
+ * @param[out]  pJsonBuffer Filled-in JSON buffer
+ *                           
+ * @retval   BVIEW_STATUS_SUCCESS  Data is encoded into JSON successfully
+ * @retval   BVIEW_STATUS_RESOURCE_NOT_AVAILABLE  Internal Error
+ * @retval   BVIEW_STATUS_INVALID_PARAMETER  Invalid input parameter
+ * @retval   BVIEW_STATUS_OUTOFMEMORY  No available memory to create JSON buffer
+ *
+ * @note     Samples which do not fit in the buffer are left to the
+ *           next request, from "resume-sequence-number". Matches of
+ *           the first sample or of the aggregate which do not fit
+ *           are left out, and "truncated" is set. A bucket of a
+ *           rollup is numbered by its start time over its interval.
+ *           The returned json-encoded-buffer should be freed using the  
+ *           bstjson_memory_free(). Failing to do so leads to memory leaks
+ *********************************************************************/
+
+BVIEW_STATUS bstjson_encode_query_bst_history ( int asicId,
+                                               int method,
+                                               const BSTJSON_HISTORY_INFO_t *info,
+                                               BSTJSON_QUERY_AGGREGATE_t aggregate,
+                                               unsigned int maxEntries,
+                                               BSTJSON_QUERY_NEXT_t next,
+                                               void *cookie,
+                                               const BSTJSON_QUERY_STATS_t *stats,
+                                               uint8_t **pJsonBuffer
+                                               )
+{
+    char *jsonBuf, *start, *sampleStart;
+    BVIEW_STATUS status;
+    int bufferLength = BSTJSON_MEMSIZE_REPORT;
+    int tempLength = 0, sampleLength = 0;
+    unsigned int numEntries = 0;
+    bool more = false, truncated = false;
+    BSTJSON_QUERY_SAMPLE_t sample;
+
+    time_t report_time;
+    struct tm *timeinfo;
+    char timeString[64];
+    char asicIdStr[JSON_MAX_NODE_LENGTH] = { 0 };
+    const char *aggregateNames[] = { "none", "max", "avg", "last" };
+
+    char *queryBstHistoryStart = " { \
+\"jsonrpc\": \"2.0\",\
+\"method\": \"query-bst-history\",\
+\"asic-id\": \"%s\",\
+\"first-sequence-number\": %" PRIu64 ",\
+\"next-sequence-number\": %" PRIu64 ",\
+\"aggregate\": \"%s\",\
+\"resolution-sec\": %u,\
+%s";
+
+    char *querySampleStart = "%s\
+\"sequence-number\": %" PRIu64 ",\
+\"time-stamp\": \"%s\",\
+\"realtime-ns\": %" PRIu64 ",\
+";
+
+    _JSONENCODE_LOG(_JSONENCODE_DEBUG_TRACE, "BST-JSON-Encoder : Request for Query-Bst-History \n");
+
+    /* Validate Input Parameters */
+    _JSONENCODE_ASSERT (info != NULL);
+    _JSONENCODE_ASSERT (next != NULL);
+    _JSONENCODE_ASSERT (stats != NULL);
+    _JSONENCODE_ASSERT (aggregate <= BSTJSON_QUERY_AGGREGATE_LAST);
+
+    /* allocate memory for JSON */
+    status = bstjson_memory_allocate(BSTJSON_MEMSIZE_REPORT, (uint8_t **) & jsonBuf);
+    _JSONENCODE_ASSERT (status == BVIEW_STATUS_SUCCESS);
+
+    start = jsonBuf;
+
+    /* clear the buffer */
+    memset(jsonBuf, 0, BSTJSON_MEMSIZE_REPORT);
+
+    /* convert asicId to external  notation */
+    JSON_ASIC_ID_MAP_TO_NOTATION(asicId, &asicIdStr[0]);
+
+    /* fill the header, the buckets of a rollup have four values per counter */
+    tempLength = snprintf(jsonBuf, bufferLength, queryBstHistoryStart, &asicIdStr[0],
+                          info->firstSequenceNumber, info->nextSequenceNumber,
+                          aggregateNames[aggregate], stats->resolutionSec,
+                          (stats->resolutionSec == 0) ? "" :
+                          "\"values\": [ \"max\", \"min\", \"mean\", \"last\" ],");
+    jsonBuf += tempLength;
+    bufferLength -= tempLength;
+
+    if (aggregate == BSTJSON_QUERY_AGGREGATE_NONE)
+    {
+        tempLength = snprintf(jsonBuf, bufferLength, "\"samples\": [ ");
+        jsonBuf += tempLength;
+        bufferLength -= tempLength;
+    }
+
+    while (true == next(cookie, &sample))
+    {
+        if ((aggregate == BSTJSON_QUERY_AGGREGATE_NONE) &&
+            (((maxEntries != 0) && (numEntries >= maxEntries)) ||
+             ((bufferLength - BSTJSON_HISTORY_END_LENGTH) < BSTJSON_QUERY_SAMPLE_LENGTH)))
+        {
+            more = true;
+            break;
+        }
+        sampleStart = jsonBuf;
+        sampleLength = bufferLength;
+
+        /* obtain the time */
+        memset(&timeString, 0, sizeof (timeString));
+        report_time = sample.time;
+        timeinfo = localtime(&report_time);
+        strftime(timeString, 64, "%Y-%m-%d - %H:%M:%S ", timeinfo);
+
+        /* the aggregate is reported in the response itself */
+        tempLength = snprintf(jsonBuf, bufferLength, querySampleStart,
+                              (aggregate != BSTJSON_QUERY_AGGREGATE_NONE) ? "" :
+                              ((numEntries == 0) ? "{ " : " ,{ "),
+                              sample.sequenceNumber, timeString, sample.realtimeNs);
+        jsonBuf += tempLength;
+        bufferLength -= tempLength;
+
+        if ((aggregate != BSTJSON_QUERY_AGGREGATE_NONE) || (stats->resolutionSec != 0))
+        {
+            tempLength = snprintf(jsonBuf, bufferLength, "\"num-samples\": %" PRIu64 ",",
+                                  sample.numSamples);
+            jsonBuf += tempLength;
+            bufferLength -= tempLength;
+        }
+
+        status = _jsonencode_query_data(jsonBuf, asicId, &sample,
+                                        bufferLength - BSTJSON_HISTORY_END_LENGTH,
+                                        &tempLength, &truncated);
+        if (status != BVIEW_STATUS_SUCCESS)
+        {
+            bstjson_memory_free((uint8_t *) start);
+            return status;
+        }
+        jsonBuf += tempLength;
+        bufferLength -= tempLength;
+
+        /* a sample is always reported, the others if all their matches fit */
+        if ((aggregate == BSTJSON_QUERY_AGGREGATE_NONE) &&
+            (truncated == true) && (numEntries != 0))
+        {
+            jsonBuf = sampleStart;
+            bufferLength = sampleLength;
+            memset(jsonBuf, 0, bufferLength);
+            truncated = false;
+            more = true;
+            break;
+        }
+
+        tempLength = snprintf(jsonBuf, bufferLength, ",\"truncated\": %d%s", (truncated == true) ? 1 : 0,
+                              (aggregate != BSTJSON_QUERY_AGGREGATE_NONE) ? "" : " }");
+        jsonBuf += tempLength;
+        bufferLength -= tempLength;
+
+        numEntries++;
+
+        /* the aggregate is the only sample */
+        if ((aggregate != BSTJSON_QUERY_AGGREGATE_NONE) || (truncated == true))
+        {
+            break;
+        }
+    }
+
+    if (aggregate == BSTJSON_QUERY_AGGREGATE_NONE)
+    {
+        /* a truncated sample is not reported again */
+        if ((more == true) || (truncated == true))
+        {
+            tempLength = snprintf(jsonBuf, bufferLength, " ],\"more-entries\": 1,\"resume-sequence-number\": %" PRIu64 ",",
+                                  (truncated == true) ? sample.sequenceNumber + 1 : sample.sequenceNumber);
+        }
+        else
+        {
+            tempLength = snprintf(jsonBuf, bufferLength, " ],\"more-entries\": 0,");
+        }
+        jsonBuf += tempLength;
+        bufferLength -= tempLength;
+    }
+    else if (numEntries == 0)
+    {
+        tempLength = snprintf(jsonBuf, bufferLength, "\"num-samples\": 0, \"data\": [ ], \"truncated\": 0 ,");
+        jsonBuf += tempLength;
+        bufferLength -= tempLength;
+    }
+    else
+    {
+        tempLength = snprintf(jsonBuf, bufferLength, ",");
+        jsonBuf += tempLength;
+        bufferLength -= tempLength;
+    }
+
+    tempLength = snprintf(jsonBuf, bufferLength, "\"blocks-decoded\": %u,\"blocks-skipped\": %u } ",
+                          stats->blocksDecoded, stats->blocksSkipped);
+
+    *pJsonBuffer = (uint8_t *) start;
+
+    _JSONENCODE_LOG(_JSONENCODE_DEBUG_TRACE, "BST-JSON-Encoder : Request for Query-Bst-History Complete [%d] bytes, %u samples \n",
+                    (int)strlen(start), numEntries);
+
+    _JSONENCODE_LOG(_JSONENCODE_DEBUG_DUMPJSON, "BST-JSON-Encoder : %s \n", start);
+
+    return BVIEW_STATUS_SUCCESS;
+}
+
+/******************************************************************
+ * @brief  Creates a JSON buffer using the supplied data for the 
+ *         "get-bst-statistics" REST API.
+ *
+ * @param[in]   asicId      ASIC for which this data is being encoded.
+ * @param[in]   method      Method ID (from original request) that needs 
+ *                          to be encoded in JSON.
+ * @param[in]   stats       Percentiles of the matches over the window
+ * @param[out]  pJsonBuffer Filled-in JSON buffer
+ *                           
+ * @retval   BVIEW_STATUS_SUCCESS  Data is encoded into JSON successfully
+ * @retval   BVIEW_STATUS_INVALID_PARAMETER  Invalid input parameter
+ * @retval   BVIEW_STATUS_OUTOFMEMORY  No available memory to create JSON buffer
+ *
+ * @note     The values of every counter of a match are its percentiles,
+ *           in the order of the request, followed by its max. They
+ *           are named per realm, counter by counter. The matches
+ *           past the size of the buffer are not reported.
+ *           The returned json-encoded-buffer should be freed using the  
+ *           bstjson_memory_free(). Failing to do so leads to memory leaks
+ *********************************************************************/
+BVIEW_STATUS bstjson_encode_get_bst_statistics ( int asicId,
+                                                 int method,
+                                                 const BSTJSON_STATISTICS_t *stats,
+                                                 uint8_t **pJsonBuffer
+                                                 )
+{
+    char *jsonBuf, *start;
+    BVIEW_STATUS status;
+    int bufferLength = BSTJSON_MEMSIZE_REPORT;
+    int tempLength = 0;
+    unsigned int index = 0, counter = 0;
+    bool truncated = false, firstRealm = true, first = true;
+    BVIEW_BST_REALM_t realm;
+    BVIEW_BST_REALM_MASK_t realmMask = 0;
+    BSTJSON_QUERY_SAMPLE_t sample;
+    char asicIdStr[JSON_MAX_NODE_LENGTH] = { 0 };
+
+    char *getBstStatisticsStart = " { \
+\"jsonrpc\": \"2.0\",\
+\"method\": \"get-bst-statistics\",\
+\"asic-id\": \"%s\",\
+\"window-sec\": %u,\
+\"slice-sec\": %u,\
+\"num-slices\": %u,\
+\"start-time-ns\": %" PRIu64 ",\
+\"end-time-ns\": %" PRIu64 ",\
+\"num-samples\": %" PRIu64 ",\
+\"values\": [ ";
+
+    _JSONENCODE_LOG(_JSONENCODE_DEBUG_TRACE, "BST-JSON-Encoder : Request for Get-Bst-Statistics \n");
+
+    /* Validate Input Parameters */
+    _JSONENCODE_ASSERT (stats != NULL);
+    _JSONENCODE_ASSERT ((stats->numMatches == 0) || (stats->matches != NULL));
+
+    /* allocate memory for JSON */
+    status = bstjson_memory_allocate(BSTJSON_MEMSIZE_REPORT, (uint8_t **) & jsonBuf);
+    _JSONENCODE_ASSERT (status == BVIEW_STATUS_SUCCESS);
+
+    start = jsonBuf;
+
+    /* clear the buffer */
+    memset(jsonBuf, 0, BSTJSON_MEMSIZE_REPORT);
+
+    /* convert asicId to external  notation */
+    JSON_ASIC_ID_MAP_TO_NOTATION(asicId, &asicIdStr[0]);
+
+    /* fill the header */
+    tempLength = snprintf(jsonBuf, bufferLength, getBstStatisticsStart, &asicIdStr[0],
+                          stats->windowSec, stats->sliceSec, stats->numSlices,
+                          stats->startNs, stats->endNs, stats->numSamples);
+    jsonBuf += tempLength;
+    bufferLength -= tempLength;
+
+    /* names of the values of the realms matched, the percentiles and
+       the max of every counter of an entry */
+    for (index = 0; index < stats->numMatches; index++)
+    {
+        realmMask |= stats->matches[index].realm;
+    }
+    BVIEW_BST_REALM_ITER (realm)
+    {
+        if ((realmMask & realm) == 0)
+        {
+            continue;
+        }
+        tempLength = snprintf(jsonBuf, bufferLength, "%s{ \"realm\": \"%s\", \"columns\": [ ",
+                              (firstRealm == true) ? "" : ", ", _jsonencode_realm_name(realm));
+        jsonBuf += tempLength;
+        bufferLength -= tempLength;
+        firstRealm = false;
+        first = true;
+        for (counter = 0; counter < BVIEW_BST_NUM_COUNTERS; counter++)
+        {
+            if (_jsonencode_counters[counter].realm != realm)
+            {
+                continue;
+            }
+            for (index = 0; index < stats->numPercentiles; index++)
+            {
+                tempLength = snprintf(jsonBuf, bufferLength, "%s\"%s:p%g\"",
+                                      (first == true) ? "" : ", ",
+                                      _jsonencode_counters[counter].name,
+                                      stats->percentiles[index]);
+                jsonBuf += tempLength;
+                bufferLength -= tempLength;
+                first = false;
+            }
+            tempLength = snprintf(jsonBuf, bufferLength, "%s\"%s:max\"",
+                                  (first == true) ? "" : ", ",
+                                  _jsonencode_counters[counter].name);
+            jsonBuf += tempLength;
+            bufferLength -= tempLength;
+            first = false;
+        }
+        tempLength = snprintf(jsonBuf, bufferLength, " ] }");
+        jsonBuf += tempLength;
+        bufferLength -= tempLength;
+    }
+    tempLength = snprintf(jsonBuf, bufferLength, " ],");
+    jsonBuf += tempLength;
+    bufferLength -= tempLength;
+
+    /* the matches are encoded as those of a sample of a query */
+    memset(&sample, 0, sizeof (sample));
+    sample.numMatches = stats->numMatches;
+    sample.matches = stats->matches;
+    status = _jsonencode_query_data(jsonBuf, asicId, &sample,
+                                    bufferLength - BSTJSON_HISTORY_END_LENGTH,
+                                    &tempLength, &truncated);
+    if (status != BVIEW_STATUS_SUCCESS)
+    {
+        bstjson_memory_free((uint8_t *) start);
+        return status;
+    }
+    jsonBuf += tempLength;
+    bufferLength -= tempLength;
+
+    snprintf(jsonBuf, bufferLength, ",\"truncated\": %d,\"id\": %d } ",
+             (truncated == true) ? 1 : 0, method);
+
+    *pJsonBuffer = (uint8_t *) start;
+
+    _JSONENCODE_LOG(_JSONENCODE_DEBUG_TRACE, "BST-JSON-Encoder : Request for Get-Bst-Statistics Complete [%d] bytes, %u matches \n",
+                    (int)strlen(start), stats->numMatches);
+
+    _JSONENCODE_LOG(_JSONENCODE_DEBUG_DUMPJSON, "BST-JSON-Encoder : %s \n", start);
+
+    return BVIEW_STATUS_SUCCESS;
+}
+
+/******************************************************************
+ * @brief  Creates a JSON buffer using the supplied data for the 
+ *         "get-bst-top" REST API.
+ *
+ * @param[in]   asicId      ASIC for which this data is being encoded.
+ * @param[in]   method      Method ID (from original request) that needs 
+ *                          to be encoded in JSON.
+ * @param[in]   top         Entries with the highest occupancy
+ * @param[out]  pJsonBuffer Filled-in JSON buffer
+ *                           
+ * @retval   BVIEW_STATUS_SUCCESS  Data is encoded into JSON successfully
+ * @retval   BVIEW_STATUS_INVALID_PARAMETER  Invalid input parameter
+ * @retval   BVIEW_STATUS_OUTOFMEMORY  No available memory to create JSON buffer
+ *
+ * @note     The value of a match is its occupancy, the highest of its
+ *           buffer counts, current or peak as the counters are
+ *           tracked. The returned json-encoded-buffer should be freed
+ *           using the bstjson_memory_free(). Failing to do so leads to
+ *           memory leaks
+ *********************************************************************/
+BVIEW_STATUS bstjson_encode_get_bst_top ( int asicId,
+                                          int method,
+                                          const BSTJSON_TOP_t *top,
+                                          uint8_t **pJsonBuffer
+                                          )
+{
+    char *jsonBuf, *start;
+    BVIEW_STATUS status;
+    int bufferLength = BSTJSON_MEMSIZE_REPORT;
+    int tempLength = 0;
+    bool truncated = false;
+    BSTJSON_QUERY_SAMPLE_t sample;
+    char asicIdStr[JSON_MAX_NODE_LENGTH] = { 0 };
+
+    char *getBstTopStart = " { \
+\"jsonrpc\": \"2.0\",\
+\"method\": \"get-bst-top\",\
+\"asic-id\": \"%s\",\
+\"tracking-mode\": \"%s\",\
+\"window-sec\": %u,\
+\"slice-sec\": %u,\
+\"num-slices\": %u,\
+\"start-time-ns\": %" PRIu64 ",\
+\"end-time-ns\": %" PRIu64 ",\
+\"count\": %u,\
+\"per-realm\": %d,";
+
+    _JSONENCODE_LOG(_JSONENCODE_DEBUG_TRACE, "BST-JSON-Encoder : Request for Get-Bst-Top \n");
+
+    /* Validate Input Parameters */
+    _JSONENCODE_ASSERT (top != NULL);
+    _JSONENCODE_ASSERT ((top->numMatches == 0) || (top->matches != NULL));
+
+    /* allocate memory for JSON */
+    status = bstjson_memory_allocate(BSTJSON_MEMSIZE_REPORT, (uint8_t **) & jsonBuf);
+    _JSONENCODE_ASSERT (status == BVIEW_STATUS_SUCCESS);
+
+    start = jsonBuf;
+
+    /* clear the buffer */
+    memset(jsonBuf, 0, BSTJSON_MEMSIZE_REPORT);
+
+    /* convert asicId to external  notation */
+    JSON_ASIC_ID_MAP_TO_NOTATION(asicId, &asicIdStr[0]);
+
+    /* fill the header */
+    tempLength = snprintf(jsonBuf, bufferLength, getBstTopStart, &asicIdStr[0],
+                          (top->peak == true) ? "peak" : "current",
+                          top->windowSec, top->sliceSec, top->numSlices,
+                          top->startNs, top->endNs, top->count,
+                          (top->perRealm == true) ? 1 : 0);
+    jsonBuf += tempLength;
+    bufferLength -= tempLength;
+
+    /* the matches are encoded as those of a sample of a query */
+    memset(&sample, 0, sizeof (sample));
+    sample.numMatches = top->numMatches;
+    sample.matches = top->matches;
+    status = _jsonencode_query_data(jsonBuf, asicId, &sample,
+                                    bufferLength - BSTJSON_HISTORY_END_LENGTH,
+                                    &tempLength, &truncated);
+    if (status != BVIEW_STATUS_SUCCESS)
+    {
+        bstjson_memory_free((uint8_t *) start);
+        return status;
+    }
+    jsonBuf += tempLength;
+    bufferLength -= tempLength;
+
+    snprintf(jsonBuf, bufferLength, ",\"truncated\": %d,\"id\": %d } ",
+             (truncated == true) ? 1 : 0, method);
+
+    *pJsonBuffer = (uint8_t *) start;
+
+    _JSONENCODE_LOG(_JSONENCODE_DEBUG_TRACE, "BST-JSON-Encoder : Request for Get-Bst-Top Complete [%d] bytes, %u matches \n",
+                    (int)strlen(start), top->numMatches);
+
+    _JSONENCODE_LOG(_JSONENCODE_DEBUG_DUMPJSON, "BST-JSON-Encoder : %s \n", start);
+
+    return BVIEW_STATUS_SUCCESS;
+}
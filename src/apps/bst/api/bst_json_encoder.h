@@ -46,8 +46,180 @@ typedef struct _bst_reporting_options_
     bool statUnitsInCells;
     bool reportTrigger;
     bool reportThreshold;
+    /* counter which raised the trigger, for trigger reports */
+    BVIEW_BST_TRIGGER_INFO_t triggerInfo;
+    /* distance of the sampling time from the aligned boundary,
+       for periodic reports of an aligned collection */
+    bool reportAlignment;
+    int64_t alignErrorNs;
 } BSTJSON_REPORT_OPTIONS_t;
 
+/* trigger counters */
+typedef struct _bst_trigger_stats_
+{
+    /* triggers raised by the asic */
+    uint64_t numTriggers;
+    /* trigger reports posted for collection */
+    uint64_t numReports;
+    /* triggers merged into a pending trigger report */
+    uint64_t numCoalesced;
+    /* triggers dropped by the rate limit or a full queue */
+    uint64_t numDropped;
+} BSTJSON_TRIGGER_STATS_t;
+
+/* periodic collection counters */
+typedef struct _bst_collection_stats_
+{
+    /* periodic collection cycles completed */
+    uint64_t numCycles;
+    /* cycles which took longer than the collection interval */
+    uint64_t numOverruns;
+    /* timer ticks skipped while the previous cycle was pending */
+    uint64_t numTicksSkipped;
+    /* periodic reports dropped while the sender was behind */
+    uint64_t numReportsDropped;
+    /* collection and report time of the last cycle, in micro seconds */
+    uint64_t lastCollectUs;
+    uint64_t lastReportUs;
+    /* longest cycle, in micro seconds */
+    uint64_t maxCycleUs;
+    /* interval in use, stretched on overruns by the adaptive back-off */
+    int effectiveIntervalMs;
+} BSTJSON_COLLECTION_STATS_t;
+
+/* snapshot history of an asic */
+typedef struct _bst_history_info_
+{
+    /* sequence number of the oldest entry kept, and of the next entry */
+    uint64_t firstSequenceNumber;
+    uint64_t nextSequenceNumber;
+    /* bytes of the history in use, and its size */
+    uint64_t bytesUsed;
+    uint64_t size;
+} BSTJSON_HISTORY_INFO_t;
+
+/* entry of the snapshot history */
+typedef struct _bst_history_entry_
+{
+    uint64_t sequenceNumber;
+    BVIEW_TIME_t time;
+    uint64_t realtimeNs;
+    /* counters before the entry, NULL if the entry is reported in full */
+    const BVIEW_BST_SNAPSHOT_DATA_t *previous;
+    const BVIEW_BST_SNAPSHOT_DATA_t *current;
+} BSTJSON_HISTORY_ENTRY_t;
+
+/* upper bounds of the length of the parts of a report, for the
+   encoders which fill a buffer with more than one report */
+#define BSTJSON_REPORT_REALMS_LENGTH    1024
+#define BSTJSON_REPORT_ENTRY_LENGTH     96
+#define BSTJSON_HISTORY_ENTRY_LENGTH    256
+#define BSTJSON_HISTORY_END_LENGTH      128
+
+/* returns the next entry of a history request, false past the last one */
+typedef bool (*BSTJSON_HISTORY_NEXT_t) (void *cookie, BSTJSON_HISTORY_ENTRY_t *entry);
+
+/* aggregate of the samples of a query of the history */
+typedef enum _bst_query_aggregate_
+{
+    BSTJSON_QUERY_AGGREGATE_NONE = 0,
+    BSTJSON_QUERY_AGGREGATE_MAX,
+    BSTJSON_QUERY_AGGREGATE_AVG,
+    BSTJSON_QUERY_AGGREGATE_LAST
+} BSTJSON_QUERY_AGGREGATE_t;
+
+/* values of a realm entry, at most. The max, min, mean and last
+   value of every counter of a bucket of a rollup */
+#define BSTJSON_QUERY_MAX_VALUES        16
+
+/* realm entry which matches a query of the history */
+typedef struct _bst_query_match_
+{
+    BVIEW_BST_REALM_t realm;
+    /* port of the entry, 0 for the realms not kept per port */
+    unsigned int port;
+    /* 0 based priority group, service pool or queue of the entry */
+    unsigned int index;
+    /* counters of the entry, in the units of the response */
+    unsigned int numValues;
+    uint64_t values[BSTJSON_QUERY_MAX_VALUES];
+} BSTJSON_QUERY_MATCH_t;
+
+/* sample of the history with its entries which match a query, or the
+   aggregate of the matches of all the samples */
+typedef struct _bst_query_sample_
+{
+    /* sample, the last one aggregated for an aggregate, or the
+       bucket of a rollup */
+    uint64_t sequenceNumber;
+    BVIEW_TIME_t time;
+    uint64_t realtimeNs;
+    /* samples with a match of an aggregate, or samples of a bucket */
+    uint64_t numSamples;
+    unsigned int numMatches;
+    const BSTJSON_QUERY_MATCH_t *matches;
+} BSTJSON_QUERY_SAMPLE_t;
+
+/* blocks of the history, or buckets of a rollup, visited by a query */
+typedef struct _bst_query_stats_
+{
+    unsigned int blocksDecoded;
+    unsigned int blocksSkipped;
+    /* interval of the buckets of the rollup walked, 0 for the samples
+       as collected */
+    unsigned int resolutionSec;
+} BSTJSON_QUERY_STATS_t;
+
+#define BSTJSON_QUERY_SAMPLE_LENGTH     224
+#define BSTJSON_QUERY_MATCH_LENGTH      448
+
+/* returns the next sample of a query, false past the last one */
+typedef bool (*BSTJSON_QUERY_NEXT_t) (void *cookie, BSTJSON_QUERY_SAMPLE_t *sample);
+
+/* percentiles of the counters over a window of the streaming
+   statistics, and the entries they are reported for */
+typedef struct _bst_statistics_
+{
+    /* window of the request in seconds, 0 for all the slices kept,
+       and the interval of a slice */
+    unsigned int windowSec;
+    unsigned int sliceSec;
+    /* slices merged, wall clock start of the oldest one and time of
+       the last sample, in nano seconds */
+    unsigned int numSlices;
+    uint64_t startNs;
+    uint64_t endNs;
+    uint64_t numSamples;
+    /* percentiles of every counter, reported before its max */
+    unsigned int numPercentiles;
+    const double *percentiles;
+    unsigned int numMatches;
+    BSTJSON_QUERY_MATCH_t *matches;
+} BSTJSON_STATISTICS_t;
+
+/* entries with the highest occupancy, of every realm or of all the
+   realms together, and the record or slices they are taken from */
+typedef struct _bst_top_
+{
+    /* counters are tracked as peaks, else as current values */
+    bool peak;
+    /* window of the request in seconds, 0 for the record collected
+       last, and the interval of a slice */
+    unsigned int windowSec;
+    unsigned int sliceSec;
+    /* slices merged, wall clock start of the oldest one and time of
+       the last record, in nano seconds */
+    unsigned int numSlices;
+    uint64_t startNs;
+    uint64_t endNs;
+    /* entries of every realm, or of all of them */
+    unsigned int count;
+    bool perRealm;
+    /* highest occupancy first, one value each */
+    unsigned int numMatches;
+    BSTJSON_QUERY_MATCH_t *matches;
+} BSTJSON_TOP_t;
+
 #define _JSONENCODE_DEBUG
 #define _JSONENCODE_DEBUG_LEVEL         _JSONENCODE_DEBUG_ERROR
 
@@ -98,6 +270,8 @@ typedef struct _bst_reporting_options_
 BVIEW_STATUS bstjson_encode_get_bst_feature(int asicId,
                                             int method,
                                             const BSTJSON_CONFIGURE_BST_FEATURE_t *pData,
+                                            const BSTJSON_TRIGGER_STATS_t *pStats,
+                                            const BSTJSON_COLLECTION_STATS_t *pCollection,
                                             uint8_t **pJsonBuffer
                                             );
 
@@ -107,20 +281,62 @@ BVIEW_STATUS bstjson_encode_get_bst_tracking(int asicId,
                                              uint8_t **pJsonBuffer
                                              );
 
+BVIEW_STATUS bstjson_encode_configure_bst_thresholds_bulk(int asicId,
+                                            int method,
+                                            const BVIEW_STATUS *status,
+                                            unsigned int numThresholds,
+                                            uint8_t **pJsonBuffer
+                                            );
+
 BVIEW_STATUS bstjson_encode_get_bst_report(int asicId,
                                            int method,
-                                           const BVIEW_BST_ASIC_SNAPSHOT_DATA_t *previous,
-                                           const BVIEW_BST_ASIC_SNAPSHOT_DATA_t *current,
+                                           const BVIEW_BST_SNAPSHOT_DATA_t *previous,
+                                           const BVIEW_BST_SNAPSHOT_DATA_t *current,
                                            const BSTJSON_REPORT_OPTIONS_t *options,
                                            const BVIEW_ASIC_CAPABILITIES_t *asic,
                                            const BVIEW_TIME_t *reportTime,
+                                           const BVIEW_BST_REALM_TIME_t *realmTime,
                                            uint8_t **pJsonBuffer
                                            );
 
+BVIEW_STATUS bstjson_encode_get_bst_history(int asicId,
+                                            int method,
+                                            const BSTJSON_REPORT_OPTIONS_t *options,
+                                            const BVIEW_ASIC_CAPABILITIES_t *asic,
+                                            const BSTJSON_HISTORY_INFO_t *info,
+                                            unsigned int maxEntries,
+                                            BSTJSON_HISTORY_NEXT_t next,
+                                            void *cookie,
+                                            uint8_t **pJsonBuffer
+                                            );
+
+BVIEW_STATUS bstjson_encode_query_bst_history(int asicId,
+                                              int method,
+                                              const BSTJSON_HISTORY_INFO_t *info,
+                                              BSTJSON_QUERY_AGGREGATE_t aggregate,
+                                              unsigned int maxEntries,
+                                              BSTJSON_QUERY_NEXT_t next,
+                                              void *cookie,
+                                              const BSTJSON_QUERY_STATS_t *stats,
+                                              uint8_t **pJsonBuffer
+                                              );
+
+BVIEW_STATUS bstjson_encode_get_bst_statistics(int asicId,
+                                               int method,
+                                               const BSTJSON_STATISTICS_t *stats,
+                                               uint8_t **pJsonBuffer
+                                               );
+
+BVIEW_STATUS bstjson_encode_get_bst_top(int asicId,
+                                        int method,
+                                        const BSTJSON_TOP_t *top,
+                                        uint8_t **pJsonBuffer
+                                        );
+
 BVIEW_STATUS _jsonencode_report_ingress(char *buffer,
                                         int asicId,
-                                        const BVIEW_BST_ASIC_SNAPSHOT_DATA_t *previous,
-                                        const BVIEW_BST_ASIC_SNAPSHOT_DATA_t *current,
+                                        const BVIEW_BST_SNAPSHOT_DATA_t *previous,
+                                        const BVIEW_BST_SNAPSHOT_DATA_t *current,
                                         const BSTJSON_REPORT_OPTIONS_t *options,
                                         const BVIEW_ASIC_CAPABILITIES_t *asic,
                                         int bufLen,
@@ -129,8 +345,8 @@ BVIEW_STATUS _jsonencode_report_ingress(char *buffer,
 
 BVIEW_STATUS _jsonencode_report_egress(char *buffer,
                                        int asicId,
-                                       const BVIEW_BST_ASIC_SNAPSHOT_DATA_t *previous,
-                                       const BVIEW_BST_ASIC_SNAPSHOT_DATA_t *current,
+                                       const BVIEW_BST_SNAPSHOT_DATA_t *previous,
+                                       const BVIEW_BST_SNAPSHOT_DATA_t *current,
                                        const BSTJSON_REPORT_OPTIONS_t *options,
                                        const BVIEW_ASIC_CAPABILITIES_t *asic,
                                        int bufLen,
@@ -36,8 +36,8 @@
  *
  *********************************************************************/
 static BVIEW_STATUS _jsonencode_report_egress_cpuq ( char *buffer, int asicId,
-                                                    const BVIEW_BST_ASIC_SNAPSHOT_DATA_t *previous,
-                                                    const BVIEW_BST_ASIC_SNAPSHOT_DATA_t *current,
+                                                    const BVIEW_BST_SNAPSHOT_DATA_t *previous,
+                                                    const BVIEW_BST_SNAPSHOT_DATA_t *current,
                                                     const BSTJSON_REPORT_OPTIONS_t *options,
                                                     const BVIEW_ASIC_CAPABILITIES_t *asic,
                                                     int bufLen,
@@ -46,6 +46,8 @@ static BVIEW_STATUS _jsonencode_report_egress_cpuq ( char *buffer, int asicId,
     int remLength = bufLen;
     int actualLength  = 0;
     int queue = 0;
+    unsigned int word = 0, entry = 0;
+    uint64_t bits = 0;
     uint64_t val = 0;
 
     char *realmTemplate = " { \"realm\": \"egress-cpu-queue\", \"%s\": [ ";
@@ -56,41 +58,32 @@ static BVIEW_STATUS _jsonencode_report_egress_cpuq ( char *buffer, int asicId,
     /* copying the header . Pointer and Length adjustments are handled by the macro */
     _JSONENCODE_COPY_FORMATTED_STRING_AND_ADVANCE(actualLength, buffer, remLength, length, realmTemplate, "data");
 
-    /* For each queue, check if there is a difference, and create the report. */
-    for (queue = 1; queue <= asic->numCpuQueues; queue++)
+    /* For each queue with data or a difference, create the report. */
+    BVIEW_BST_SS_ENTRY_ITER(current, BVIEW_BST_REALM_EGRESS_CPU_QUEUE, (previous != NULL), word, bits, entry)
     {
-        /* lets see if this queue needs to be included in the report at all */
-        /* if this queue needs not be reported, then we move to next queue */
-        if ((current->cpqQ.data[queue - 1].cpuBufferCount == 0) &&
-            (current->cpqQ.data[queue - 1].cpuQueueEntries == 0) )
-            continue;
+        queue = entry + 1;
 
-        if ((previous != NULL) &&
-            (previous->cpqQ.data[queue - 1].cpuBufferCount == current->cpqQ.data[queue - 1].cpuBufferCount) &&
-            (previous->cpqQ.data[queue - 1].cpuQueueEntries == current->cpqQ.data[queue - 1].cpuQueueEntries))
-            continue;
-
-             val = current->cpqQ.data[queue - 1].cpuBufferCount;
+             val = BVIEW_BST_SS_CNT(current, BVIEW_BST_CNT_CPUQ_BUFFER, queue - 1);
 
            /* check if we need to convert the data to cells */
              if ((true == options->statUnitsInCells) && 
                  (true == options->reportThreshold))
              {
-               val = current->cpqQ.data[queue - 1].cpuBufferCount / (asic->cellToByteConv);
+               val = BVIEW_BST_SS_CNT(current, BVIEW_BST_CNT_CPUQ_BUFFER, queue - 1) / (asic->cellToByteConv);
              }
              /* check if we need to convert the data to cells
                 the report always comes in cells from asic */
              else if ((false == options->statUnitsInCells) &&
                  (false == options->reportThreshold))
              {
-               val = current->cpqQ.data[queue - 1].cpuBufferCount * (asic->cellToByteConv);
+               val = BVIEW_BST_SS_CNT(current, BVIEW_BST_CNT_CPUQ_BUFFER, queue - 1) * (asic->cellToByteConv);
              }
                
         /* Now that this queue needs to be included in the report, add the data to report */
         _JSONENCODE_COPY_FORMATTED_STRING_AND_ADVANCE(actualLength, buffer, remLength, length,
                                                       cpuqTemplate, queue-1,
                                                       val,
-                                                      current->cpqQ.data[queue - 1].cpuQueueEntries
+                                                      BVIEW_BST_SS_CNT(current, BVIEW_BST_CNT_CPUQ_QENTRIES, queue - 1)
                                                       );
 
     }
@@ -115,8 +108,8 @@ static BVIEW_STATUS _jsonencode_report_egress_cpuq ( char *buffer, int asicId,
  *
  *********************************************************************/
 static BVIEW_STATUS _jsonencode_report_egress_rqeq ( char *buffer, int asicId,
-                                                    const BVIEW_BST_ASIC_SNAPSHOT_DATA_t *previous,
-                                                    const BVIEW_BST_ASIC_SNAPSHOT_DATA_t *current,
+                                                    const BVIEW_BST_SNAPSHOT_DATA_t *previous,
+                                                    const BVIEW_BST_SNAPSHOT_DATA_t *current,
                                                     const BSTJSON_REPORT_OPTIONS_t *options,
                                                     const BVIEW_ASIC_CAPABILITIES_t *asic,
                                                     int bufLen,
@@ -125,6 +118,8 @@ static BVIEW_STATUS _jsonencode_report_egress_rqeq ( char *buffer, int asicId,
     int remLength = bufLen;
     int actualLength  = 0;
     int queue = 0;
+    unsigned int word = 0, entry = 0;
+    uint64_t bits = 0;
     uint64_t val = 0;
 
     char *realmTemplate = " { \"realm\": \"egress-rqe-queue\", \"%s\": [ ";
@@ -135,40 +130,31 @@ static BVIEW_STATUS _jsonencode_report_egress_rqeq ( char *buffer, int asicId,
     /* copying the header . Pointer and Length adjustments are handled by the macro */
     _JSONENCODE_COPY_FORMATTED_STRING_AND_ADVANCE(actualLength, buffer, remLength, length, realmTemplate, "data");
 
-    /* For each queue, check if there is a difference, and create the report. */
-    for (queue = 1; queue <= asic->numRqeQueues; queue++)
+    /* For each queue with data or a difference, create the report. */
+    BVIEW_BST_SS_ENTRY_ITER(current, BVIEW_BST_REALM_EGRESS_RQE_QUEUE, (previous != NULL), word, bits, entry)
     {
-        /* lets see if this queue needs to be included in the report at all */
-        /* if this queue needs not be reported, then we move to next queue */
-        if ((current->rqeQ.data[queue - 1].rqeBufferCount == 0) &&
-            (current->rqeQ.data[queue - 1].rqeQueueEntries == 0) )
-            continue;
-
-        if ((previous != NULL) &&
-            (previous->rqeQ.data[queue - 1].rqeBufferCount == current->rqeQ.data[queue - 1].rqeBufferCount) &&
-            (previous->rqeQ.data[queue - 1].rqeQueueEntries == current->rqeQ.data[queue - 1].rqeQueueEntries))
-            continue;
+        queue = entry + 1;
 
-             val = current->rqeQ.data[queue - 1].rqeBufferCount;
+             val = BVIEW_BST_SS_CNT(current, BVIEW_BST_CNT_RQEQ_BUFFER, queue - 1);
 
            /* check if we need to convert the data to cells */
              if ((true == options->statUnitsInCells) && 
                  (true == options->reportThreshold))
              {
-               val = current->rqeQ.data[queue - 1].rqeBufferCount / (asic->cellToByteConv);
+               val = BVIEW_BST_SS_CNT(current, BVIEW_BST_CNT_RQEQ_BUFFER, queue - 1) / (asic->cellToByteConv);
              }
              /* check if we need to convert the data to cells
                 the report always comes in cells from asic */
              else if ((false == options->statUnitsInCells) &&
                  (false == options->reportThreshold))
              {
-               val = current->rqeQ.data[queue - 1].rqeBufferCount * (asic->cellToByteConv);
+               val = BVIEW_BST_SS_CNT(current, BVIEW_BST_CNT_RQEQ_BUFFER, queue - 1) * (asic->cellToByteConv);
              }
         /* Now that this queue needs to be included in the report, add the data to report */
         _JSONENCODE_COPY_FORMATTED_STRING_AND_ADVANCE(actualLength, buffer, remLength, length,
                                                       cpuqTemplate, queue-1,
                                                       val,
-                                                      current->rqeQ.data[queue - 1].rqeQueueEntries
+                                                      BVIEW_BST_SS_CNT(current, BVIEW_BST_CNT_RQEQ_QENTRIES, queue - 1)
                                                       );
 
     }
@@ -193,8 +179,8 @@ static BVIEW_STATUS _jsonencode_report_egress_rqeq ( char *buffer, int asicId,
  *
  *********************************************************************/
 static BVIEW_STATUS _jsonencode_report_egress_mcq ( char *buffer, int asicId,
-                                                   const BVIEW_BST_ASIC_SNAPSHOT_DATA_t *previous,
-                                                   const BVIEW_BST_ASIC_SNAPSHOT_DATA_t *current,
+                                                   const BVIEW_BST_SNAPSHOT_DATA_t *previous,
+                                                   const BVIEW_BST_SNAPSHOT_DATA_t *current,
                                                    const BSTJSON_REPORT_OPTIONS_t *options,
                                                    const BVIEW_ASIC_CAPABILITIES_t *asic,
                                                    int bufLen,
@@ -203,11 +189,15 @@ static BVIEW_STATUS _jsonencode_report_egress_mcq ( char *buffer, int asicId,
     int remLength = bufLen;
     int actualLength  = 0;
     int queue = 0;
+    unsigned int word = 0, entry = 0;
+    uint64_t bits = 0;
     uint64_t val = 0;
 
     char *realmTemplate = " { \"realm\": \"egress-mc-queue\", \"%s\": [ ";
-    char *dataTemplate = " [  %d , \"%s\" ,  %" PRIu64 ", %" PRIu64 " ] ,";
+    char *dataTemplate = " [  %d , \"%.*s\" ,  %" PRIu64 ", %" PRIu64 " ] ,";
     char portStr[JSON_MAX_NODE_LENGTH] = { 0 };
+    const char *portNotation = NULL;
+    int portLen = 0;
 
 
     _JSONENCODE_LOG(_JSONENCODE_DEBUG_TRACE, "BST-JSON-Encoder : (Report) Encoding EGRESS - MC Queue data \n");
@@ -215,44 +205,34 @@ static BVIEW_STATUS _jsonencode_report_egress_mcq ( char *buffer, int asicId,
     /* copying the header . Pointer and Length adjustments are handled by the macro */
     _JSONENCODE_COPY_FORMATTED_STRING_AND_ADVANCE(actualLength, buffer, remLength, length, realmTemplate, "data");
 
-    /* For each service pool, check if there is a difference, and create the report. */
-    for (queue = 1; queue <= asic->numMulticastQueues; queue++)
+    /* For each multicast queue with data or a difference, create the report. */
+    BVIEW_BST_SS_ENTRY_ITER(current, BVIEW_BST_REALM_EGRESS_MC_QUEUE, (previous != NULL), word, bits, entry)
     {
-        /* lets see if this queue needs to be included in the report at all */
-        /* if this queue needs not be reported, then we move to next queue */
-        if ((current->eMcQ.data[queue - 1].mcBufferCount == 0) &&
-            (current->eMcQ.data[queue - 1].mcQueueEntries == 0) )
-            continue;
-
-        if ((previous != NULL) &&
-            (previous->eMcQ.data[queue - 1].mcBufferCount == current->eMcQ.data[queue - 1].mcBufferCount ) &&
-            (previous->eMcQ.data[queue - 1].mcQueueEntries == current->eMcQ.data[queue - 1].mcQueueEntries))
-            continue;
+        queue = entry + 1;
 
         /* convert the port to an external representation */
-        memset(&portStr[0], 0, JSON_MAX_NODE_LENGTH);
-        JSON_PORT_MAP_TO_NOTATION(current->eMcQ.data[queue - 1].port, asicId, &portStr[0]);
+        JSON_PORT_NOTATION_GET(BVIEW_BST_SS_MC_QUEUE_PORT(current, queue - 1), asicId, portNotation, portLen, &portStr[0]);
 
-        val = current->eMcQ.data[queue - 1].mcBufferCount;
+        val = BVIEW_BST_SS_CNT(current, BVIEW_BST_CNT_EMCQ_MC, queue - 1);
            /* check if we need to convert the data to cells */
              if ((true == options->statUnitsInCells) && 
                  (true == options->reportThreshold))
              {
-               val = current->eMcQ.data[queue - 1].mcBufferCount / (asic->cellToByteConv);
+               val = BVIEW_BST_SS_CNT(current, BVIEW_BST_CNT_EMCQ_MC, queue - 1) / (asic->cellToByteConv);
              }
              /* check if we need to convert the data to cells
                 the report always comes in cells from asic */
              else if ((false == options->statUnitsInCells) &&
                  (false == options->reportThreshold))
              {
-               val = current->eMcQ.data[queue - 1].mcBufferCount * (asic->cellToByteConv);
+               val = BVIEW_BST_SS_CNT(current, BVIEW_BST_CNT_EMCQ_MC, queue - 1) * (asic->cellToByteConv);
              }
         /* Now that this pool needs to be included in the report, add the data to report */
         _JSONENCODE_COPY_FORMATTED_STRING_AND_ADVANCE(actualLength, buffer, remLength, length,
                                                       dataTemplate, queue-1,
-                                                      &portStr[0],
+                                                      portLen, portNotation,
                                                       val,
-                                                      current->eMcQ.data[queue - 1].mcQueueEntries
+                                                      BVIEW_BST_SS_CNT(current, BVIEW_BST_CNT_EMCQ_MC_QENTRIES, queue - 1)
                                                       );
 
     }
@@ -277,8 +257,8 @@ static BVIEW_STATUS _jsonencode_report_egress_mcq ( char *buffer, int asicId,
  *
  *********************************************************************/
 static BVIEW_STATUS _jsonencode_report_egress_ucq ( char *buffer, int asicId,
-                                                   const BVIEW_BST_ASIC_SNAPSHOT_DATA_t *previous,
-                                                   const BVIEW_BST_ASIC_SNAPSHOT_DATA_t *current,
+                                                   const BVIEW_BST_SNAPSHOT_DATA_t *previous,
+                                                   const BVIEW_BST_SNAPSHOT_DATA_t *current,
                                                    const BSTJSON_REPORT_OPTIONS_t *options,
                                                    const BVIEW_ASIC_CAPABILITIES_t *asic,
                                                    int bufLen,
@@ -287,11 +267,15 @@ static BVIEW_STATUS _jsonencode_report_egress_ucq ( char *buffer, int asicId,
     int remLength = bufLen;
     int actualLength  = 0;
     int queue = 0;
+    unsigned int word = 0, entry = 0;
+    uint64_t bits = 0;
     uint64_t val = 0;
 
     char *realmTemplate = " { \"realm\": \"egress-uc-queue\", \"%s\": [ ";
-    char *dataTemplate = " [  %d , \"%s\" , %" PRIu64 " ] ,";
+    char *dataTemplate = " [  %d , \"%.*s\" , %" PRIu64 " ] ,";
     char portStr[JSON_MAX_NODE_LENGTH] = { 0 };
+    const char *portNotation = NULL;
+    int portLen = 0;
 
 
     _JSONENCODE_LOG(_JSONENCODE_DEBUG_TRACE, "BST-JSON-Encoder : (Report) Encoding EGRESS - UC Queue data \n");
@@ -299,40 +283,32 @@ static BVIEW_STATUS _jsonencode_report_egress_ucq ( char *buffer, int asicId,
     /* copying the header . Pointer and Length adjustments are handled by the macro */
     _JSONENCODE_COPY_FORMATTED_STRING_AND_ADVANCE(actualLength, buffer, remLength, length, realmTemplate, "data");
 
-    /* For each unicast queues, check if there is a difference, and create the report. */
-    for (queue = 1; queue <= asic->numUnicastQueues; queue++)
+    /* For each unicast queue with data or a difference, create the report. */
+    BVIEW_BST_SS_ENTRY_ITER(current, BVIEW_BST_REALM_EGRESS_UC_QUEUE, (previous != NULL), word, bits, entry)
     {
-        /* lets see if this queue needs to be included in the report at all */
-        /* if this queue needs not be reported, then we move to next queue */
-        if (current->eUcQ.data[queue - 1].ucBufferCount == 0)
-            continue;
-
-        if ((previous != NULL) &&
-            (previous->eUcQ.data[queue - 1].ucBufferCount == current->eUcQ.data[queue - 1].ucBufferCount))
-            continue;
+        queue = entry + 1;
 
         /* convert the port to an external representation */
-        memset(&portStr[0], 0, JSON_MAX_NODE_LENGTH);
-        JSON_PORT_MAP_TO_NOTATION(current->eUcQ.data[queue - 1].port, asicId, &portStr[0]);
+        JSON_PORT_NOTATION_GET(BVIEW_BST_SS_UC_QUEUE_PORT(current, queue - 1), asicId, portNotation, portLen, &portStr[0]);
 
-        val = current->eUcQ.data[queue - 1].ucBufferCount;
+        val = BVIEW_BST_SS_CNT(current, BVIEW_BST_CNT_EUCQ_UC, queue - 1);
            /* check if we need to convert the data to cells */
              if ((true == options->statUnitsInCells) && 
                  (true == options->reportThreshold))
              {
-               val = current->eUcQ.data[queue - 1].ucBufferCount / (asic->cellToByteConv);
+               val = BVIEW_BST_SS_CNT(current, BVIEW_BST_CNT_EUCQ_UC, queue - 1) / (asic->cellToByteConv);
              }
              /* check if we need to convert the data to cells
                 the report always comes in cells from asic */
              else if ((false == options->statUnitsInCells) &&
                  (false == options->reportThreshold))
              {
-               val = current->eUcQ.data[queue - 1].ucBufferCount * (asic->cellToByteConv);
+               val = BVIEW_BST_SS_CNT(current, BVIEW_BST_CNT_EUCQ_UC, queue - 1) * (asic->cellToByteConv);
              }
         /* Now that this ucq needs to be included in the report, add the data to report */
         _JSONENCODE_COPY_FORMATTED_STRING_AND_ADVANCE(actualLength, buffer, remLength, length,
                                                       dataTemplate, queue-1,
-                                                      &portStr[0],
+                                                      portLen, portNotation,
                                                       val 
                                                       );
     }
@@ -357,8 +333,8 @@ static BVIEW_STATUS _jsonencode_report_egress_ucq ( char *buffer, int asicId,
  *
  *********************************************************************/
 static BVIEW_STATUS _jsonencode_report_egress_ucqg ( char *buffer, int asicId,
-                                                    const BVIEW_BST_ASIC_SNAPSHOT_DATA_t *previous,
-                                                    const BVIEW_BST_ASIC_SNAPSHOT_DATA_t *current,
+                                                    const BVIEW_BST_SNAPSHOT_DATA_t *previous,
+                                                    const BVIEW_BST_SNAPSHOT_DATA_t *current,
                                                     const BSTJSON_REPORT_OPTIONS_t *options,
                                                     const BVIEW_ASIC_CAPABILITIES_t *asic,
                                                     int bufLen,
@@ -367,6 +343,8 @@ static BVIEW_STATUS _jsonencode_report_egress_ucqg ( char *buffer, int asicId,
     int remLength = bufLen;
     int actualLength  = 0;
     int qg = 0;
+    unsigned int word = 0, entry = 0;
+    uint64_t bits = 0;
     uint64_t val = 0;
 
     char *realmTemplate = " { \"realm\": \"egress-uc-queue-group\", \"%s\": [ ";
@@ -377,31 +355,24 @@ static BVIEW_STATUS _jsonencode_report_egress_ucqg ( char *buffer, int asicId,
     /* copying the header . Pointer and Length adjustments are handled by the macro */
     _JSONENCODE_COPY_FORMATTED_STRING_AND_ADVANCE(actualLength, buffer, remLength, length, realmTemplate, "data");
 
-    /* For each unicast queue groups, check if there is a difference, and create the report. */
-    for (qg = 1; qg <= asic->numUnicastQueueGroups; qg++)
+    /* For each unicast queue group with data or a difference, create the report. */
+    BVIEW_BST_SS_ENTRY_ITER(current, BVIEW_BST_REALM_EGRESS_UC_QUEUEGROUPS, (previous != NULL), word, bits, entry)
     {
-        /* lets see if this queue needs to be included in the report at all */
-        /* if this queue needs not be reported, then we move to next queue */
-        if (current->eUcQg.data[qg - 1].ucBufferCount == 0)
-            continue;
-
-        if ((previous != NULL) &&
-            (previous->eUcQg.data[qg - 1].ucBufferCount == current->eUcQg.data[qg - 1].ucBufferCount))
-            continue;
+        qg = entry + 1;
 
-              val = current->eUcQg.data[qg - 1].ucBufferCount;
+              val = BVIEW_BST_SS_CNT(current, BVIEW_BST_CNT_EUCQG_UC, qg - 1);
            /* check if we need to convert the data to cells */
              if ((true == options->statUnitsInCells) && 
                  (true == options->reportThreshold))
              {
-               val = current->eUcQg.data[qg - 1].ucBufferCount / (asic->cellToByteConv);
+               val = BVIEW_BST_SS_CNT(current, BVIEW_BST_CNT_EUCQG_UC, qg - 1) / (asic->cellToByteConv);
              }
              /* check if we need to convert the data to cells
                 the report always comes in cells from asic */
              else if ((false == options->statUnitsInCells) &&
                  (false == options->reportThreshold))
              {
-               val = current->eUcQg.data[qg - 1].ucBufferCount * (asic->cellToByteConv);
+               val = BVIEW_BST_SS_CNT(current, BVIEW_BST_CNT_EUCQG_UC, qg - 1) * (asic->cellToByteConv);
              }
         /* Now that this ucqg needs to be included in the report, add the data to report */
         _JSONENCODE_COPY_FORMATTED_STRING_AND_ADVANCE(actualLength, buffer, remLength, length,
@@ -430,8 +401,8 @@ static BVIEW_STATUS _jsonencode_report_egress_ucqg ( char *buffer, int asicId,
  *
  *********************************************************************/
 static BVIEW_STATUS _jsonencode_report_egress_sp ( char *buffer, int asicId,
-                                                  const BVIEW_BST_ASIC_SNAPSHOT_DATA_t *previous,
-                                                  const BVIEW_BST_ASIC_SNAPSHOT_DATA_t *current,
+                                                  const BVIEW_BST_SNAPSHOT_DATA_t *previous,
+                                                  const BVIEW_BST_SNAPSHOT_DATA_t *current,
                                                   const BSTJSON_REPORT_OPTIONS_t *options,
                                                   const BVIEW_ASIC_CAPABILITIES_t *asic,
                                                   int bufLen,
@@ -440,6 +411,8 @@ static BVIEW_STATUS _jsonencode_report_egress_sp ( char *buffer, int asicId,
     int remLength = bufLen;
     int actualLength  = 0;
     int pool = 0;
+    unsigned int word = 0, entry = 0;
+    uint64_t bits = 0;
     uint64_t val1 = 0, val2 = 0;
 
     char *realmTemplate = " { \"realm\": \"egress-service-pool\", \"%s\": [ ";
@@ -450,44 +423,33 @@ static BVIEW_STATUS _jsonencode_report_egress_sp ( char *buffer, int asicId,
     /* copying the header . Pointer and Length adjustments are handled by the macro */
     _JSONENCODE_COPY_FORMATTED_STRING_AND_ADVANCE(actualLength, buffer, remLength, length, realmTemplate, "data");
 
-    /* For each service pool, check if there is a difference, and create the report. */
-    for (pool = 1; pool <= asic->numServicePools; pool++)
+    /* For each service pool with data or a difference, create the report. */
+    BVIEW_BST_SS_ENTRY_ITER(current, BVIEW_BST_REALM_EGRESS_SP, (previous != NULL), word, bits, entry)
     {
-        /* lets see if this sp needs to be included in the report at all */
-        /* if this sp needs not be reported, then we move to next sp */
-        if ((current->eSp.data[pool - 1].umShareBufferCount == 0) &&
-            (current->eSp.data[pool - 1].mcShareBufferCount == 0)  &&
-            (current->eSp.data[pool - 1].mcShareQueueEntries == 0) )
-            continue;
-
-        if ((previous != NULL) &&
-            (previous->eSp.data[pool - 1].umShareBufferCount == current->eSp.data[pool - 1].umShareBufferCount ) &&
-            (previous->eSp.data[pool - 1].mcShareBufferCount == current->eSp.data[pool - 1].mcShareBufferCount ) &&
-            (previous->eSp.data[pool - 1].mcShareQueueEntries == current->eSp.data[pool - 1].mcShareQueueEntries ))
-            continue;
-
-             val1 = current->eSp.data[pool - 1].umShareBufferCount;
-             val2 = current->eSp.data[pool - 1].mcShareBufferCount;
+        pool = entry + 1;
+
+             val1 = BVIEW_BST_SS_CNT(current, BVIEW_BST_CNT_ESP_UM_SHARE, pool - 1);
+             val2 = BVIEW_BST_SS_CNT(current, BVIEW_BST_CNT_ESP_MC_SHARE, pool - 1);
 
            /* check if we need to convert the data to cells */
              if ((true == options->statUnitsInCells) && 
                  (true == options->reportThreshold))
              {
-               val1 = current->eSp.data[pool - 1].umShareBufferCount / (asic->cellToByteConv);
-               val2 = current->eSp.data[pool - 1].mcShareBufferCount / (asic->cellToByteConv);
+               val1 = BVIEW_BST_SS_CNT(current, BVIEW_BST_CNT_ESP_UM_SHARE, pool - 1) / (asic->cellToByteConv);
+               val2 = BVIEW_BST_SS_CNT(current, BVIEW_BST_CNT_ESP_MC_SHARE, pool - 1) / (asic->cellToByteConv);
              }
              /* check if we need to convert the data to cells
                 the report always comes in cells from asic */
              else if ((false == options->statUnitsInCells) &&
                  (false == options->reportThreshold))
              {
-               val1 = current->eSp.data[pool - 1].umShareBufferCount * (asic->cellToByteConv);
-               val2 = current->eSp.data[pool - 1].mcShareBufferCount * (asic->cellToByteConv);
+               val1 = BVIEW_BST_SS_CNT(current, BVIEW_BST_CNT_ESP_UM_SHARE, pool - 1) * (asic->cellToByteConv);
+               val2 = BVIEW_BST_SS_CNT(current, BVIEW_BST_CNT_ESP_MC_SHARE, pool - 1) * (asic->cellToByteConv);
              }
         /* Now that this pool needs to be included in the report, add the data to report */
         _JSONENCODE_COPY_FORMATTED_STRING_AND_ADVANCE(actualLength, buffer, remLength, length,
                                                       dataTemplate, pool-1, val1,val2,
-                                                      current->eSp.data[pool - 1].mcShareQueueEntries
+                                                      BVIEW_BST_SS_CNT(current, BVIEW_BST_CNT_ESP_MC_SHARE_QENTRIES, pool - 1)
                                                       );
     }
 
@@ -511,8 +473,8 @@ static BVIEW_STATUS _jsonencode_report_egress_sp ( char *buffer, int asicId,
  *
  *********************************************************************/
 static BVIEW_STATUS _jsonencode_report_egress_epsp ( char *buffer, int asicId,
-                                                    const BVIEW_BST_ASIC_SNAPSHOT_DATA_t *previous,
-                                                    const BVIEW_BST_ASIC_SNAPSHOT_DATA_t *current,
+                                                    const BVIEW_BST_SNAPSHOT_DATA_t *previous,
+                                                    const BVIEW_BST_SNAPSHOT_DATA_t *current,
                                                     const BSTJSON_REPORT_OPTIONS_t *options,
                                                     const BVIEW_ASIC_CAPABILITIES_t *asic,
                                                     int bufLen,
@@ -520,16 +482,18 @@ static BVIEW_STATUS _jsonencode_report_egress_epsp ( char *buffer, int asicId,
 {
     int remLength = bufLen;
     int actualLength  = 0;
-    bool includePort = false;
     uint64_t val1 = 0, val2 = 0, val3 = 0;
 
-    int includeServicePool[BVIEW_ASIC_MAX_SERVICE_POOLS] = { 0 };
-    int port = 0, pool = 0;
+    int port = 0, pool = 0, lastPort = 0;
+    unsigned int stride = 0, word = 0, entry = 0;
+    uint64_t bits = 0;
 
     char *epspTemplate = " { \"realm\": \"egress-port-service-pool\", \"%s\": [ ";
-    char *epspPortTemplate = " { \"port\": \"%s\", \"data\": [ ";
+    char *epspPortTemplate = " { \"port\": \"%.*s\", \"data\": [ ";
     char *epspServicePoolTemplate = " [  %d , %" PRIu64 " , %" PRIu64 " , %" PRIu64 " ] ,";
     char portStr[JSON_MAX_NODE_LENGTH] = { 0 };
+    const char *portNotation = NULL;
+    int portLen = 0;
 
 
     _JSONENCODE_LOG(_JSONENCODE_DEBUG_TRACE, "BST-JSON-Encoder : (Report) Encoding EGRESS - EPSP data \n");
@@ -537,105 +501,69 @@ static BVIEW_STATUS _jsonencode_report_egress_epsp ( char *buffer, int asicId,
     /* copying the header . Pointer and Length adjustments are handled by the macro */
     _JSONENCODE_COPY_FORMATTED_STRING_AND_ADVANCE(actualLength, buffer, remLength, length, epspTemplate, "data");
 
-    /* For each port, and for each service pool in that port, 
-     *  1. attempt to see if this port needs to be reported.
+    /* For each service pool to be reported, in the order of the ports,
+     *  1. open the port when its first service pool is seen.
      *  2. create the report.
      */
-    for (port = 1; port <= asic->numPorts; port++)
+    stride = current->layout->stride[BVIEW_BST_CNT_EPSP_UM_SHARE];
+    BVIEW_BST_SS_ENTRY_ITER(current, BVIEW_BST_REALM_EGRESS_PORT_SP, (previous != NULL), word, bits, entry)
     {
-        includePort = false;
-        memset (&includeServicePool[0], 0, sizeof (includeServicePool));
+        port = (entry / stride) + 1;
+        pool = (entry % stride) + 1;
 
-        /* lets see if this port needs to be included in the report at all */
-        for (pool = 1; pool <= asic->numServicePools; pool++)
+        if (port != lastPort)
         {
-            /* By default, we plan to include the pool */
-            includeServicePool[pool - 1] = 1;
-
-            /* If there is no traffic reported for this priority group, ignore it */
-            if ( (current->ePortSp.data[port - 1][pool - 1].umShareBufferCount == 0) &&
-                (current->ePortSp.data[port - 1][pool - 1].ucShareBufferCount == 0) &&
-                (current->ePortSp.data[port - 1][pool - 1].mcShareBufferCount == 0) &&
-                (current->ePortSp.data[port - 1][pool - 1].mcShareQueueEntries == 0))
-            {
-                includeServicePool[pool - 1] = 0;
-                continue;
-            }
-
-            /* If this is snapshot report, include the port in the data  */
-            if (previous == NULL)
+            if (lastPort != 0)
             {
-                includePort = true;
-                continue;
+                /* adjust the buffer to remove the last ',' */
+                buffer = buffer - 1;
+                remLength += 1;
+                *length -= 1;
+
+                /* add the "] } ," for the next port */
+                _JSONENCODE_COPY_FORMATTED_STRING_AND_ADVANCE(actualLength, buffer, remLength, length,
+                                                              "] } ," );
             }
+            lastPort = port;
 
-            /* if there is traffic reported since the last snapshot, we can't ignore this pool */
-            if ( (previous->ePortSp.data[port - 1][pool - 1].umShareBufferCount
-                  != current->ePortSp.data[port - 1][pool - 1].umShareBufferCount) ||
-                (previous->ePortSp.data[port - 1][pool - 1].ucShareBufferCount
-                 != current->ePortSp.data[port - 1][pool - 1].ucShareBufferCount) ||
-                (previous->ePortSp.data[port - 1][pool - 1].mcShareBufferCount
-                 != current->ePortSp.data[port - 1][pool - 1].mcShareBufferCount) ||
-                (previous->ePortSp.data[port - 1][pool - 1].mcShareQueueEntries
-                 != current->ePortSp.data[port - 1][pool - 1].mcShareQueueEntries) )
-            {
-                includePort = true;
-                continue;
-            }
+            /* convert the port to an external representation */
+            JSON_PORT_NOTATION_GET(port, asicId, portNotation, portLen, &portStr[0]);
 
-            /* since there is no reason to include the pool, we can ignore it*/
-            includeServicePool[pool - 1] = 0;
-        }
-
-        /* if this port needs not be reported, then we move to next port */
-        if (includePort == false)
-        {
-            continue;
+            /* Now that this port needs to be included in the report, copy the header */
+            _JSONENCODE_COPY_FORMATTED_STRING_AND_ADVANCE(actualLength, buffer, remLength, length, epspPortTemplate, portLen, portNotation);
         }
 
-        /* convert the port to an external representation */
-        memset(&portStr[0], 0, JSON_MAX_NODE_LENGTH);
-        JSON_PORT_MAP_TO_NOTATION(port, asicId, &portStr[0]);
-
-        /* Now that this port needs to be included in the report, copy the header */
-        _JSONENCODE_COPY_FORMATTED_STRING_AND_ADVANCE(actualLength, buffer, remLength, length, epspPortTemplate, &portStr[0]);
-
-        /* for each priority-group, prepare the data */
-        for (pool = 1; pool <= asic->numServicePools; pool++)
-        {
-            /* we ignore if there is no data to be reported */
-            if (includeServicePool[pool - 1] == 0)
-                continue;
-
-            val1 = current->ePortSp.data[port - 1][pool - 1].ucShareBufferCount;
-            val2 = current->ePortSp.data[port - 1][pool - 1].umShareBufferCount;
-            val3 = current->ePortSp.data[port - 1][pool - 1].mcShareBufferCount;
-
-           /* check if we need to convert the data to cells */
-             if ((true == options->statUnitsInCells) && 
-                 (true == options->reportThreshold))
-             {
-               val1 = current->ePortSp.data[port - 1][pool - 1].ucShareBufferCount / (asic->cellToByteConv);
-               val2 = current->ePortSp.data[port - 1][pool - 1].umShareBufferCount / (asic->cellToByteConv);
-               val3 = current->ePortSp.data[port - 1][pool - 1].mcShareBufferCount / (asic->cellToByteConv);
-             }
-             /* check if we need to convert the data to cells
-                the report always comes in cells from asic */
-             else if ((false == options->statUnitsInCells) &&
-                 (false == options->reportThreshold))
-             {
-               val1 = current->ePortSp.data[port - 1][pool - 1].ucShareBufferCount * (asic->cellToByteConv);
-               val2 = current->ePortSp.data[port - 1][pool - 1].umShareBufferCount * (asic->cellToByteConv);
-               val3 = current->ePortSp.data[port - 1][pool - 1].mcShareBufferCount * (asic->cellToByteConv);
-             }
-            /* add the data to the report */
-            _JSONENCODE_COPY_FORMATTED_STRING_AND_ADVANCE(actualLength, buffer, remLength, length,
-                                                          epspServicePoolTemplate, pool-1,
-                                                          val1, val2, val3,
-                                                          current->ePortSp.data[port - 1][pool - 1].mcShareQueueEntries
-                                                          );
-        }
+        val1 = BVIEW_BST_SS_PORT_CNT(current, BVIEW_BST_CNT_EPSP_UC_SHARE, port - 1, pool - 1);
+        val2 = BVIEW_BST_SS_PORT_CNT(current, BVIEW_BST_CNT_EPSP_UM_SHARE, port - 1, pool - 1);
+        val3 = BVIEW_BST_SS_PORT_CNT(current, BVIEW_BST_CNT_EPSP_MC_SHARE, port - 1, pool - 1);
+
+       /* check if we need to convert the data to cells */
+         if ((true == options->statUnitsInCells) && 
+             (true == options->reportThreshold))
+         {
+           val1 = BVIEW_BST_SS_PORT_CNT(current, BVIEW_BST_CNT_EPSP_UC_SHARE, port - 1, pool - 1) / (asic->cellToByteConv);
+           val2 = BVIEW_BST_SS_PORT_CNT(current, BVIEW_BST_CNT_EPSP_UM_SHARE, port - 1, pool - 1) / (asic->cellToByteConv);
+           val3 = BVIEW_BST_SS_PORT_CNT(current, BVIEW_BST_CNT_EPSP_MC_SHARE, port - 1, pool - 1) / (asic->cellToByteConv);
+         }
+         /* check if we need to convert the data to cells
+            the report always comes in cells from asic */
+         else if ((false == options->statUnitsInCells) &&
+             (false == options->reportThreshold))
+         {
+           val1 = BVIEW_BST_SS_PORT_CNT(current, BVIEW_BST_CNT_EPSP_UC_SHARE, port - 1, pool - 1) * (asic->cellToByteConv);
+           val2 = BVIEW_BST_SS_PORT_CNT(current, BVIEW_BST_CNT_EPSP_UM_SHARE, port - 1, pool - 1) * (asic->cellToByteConv);
+           val3 = BVIEW_BST_SS_PORT_CNT(current, BVIEW_BST_CNT_EPSP_MC_SHARE, port - 1, pool - 1) * (asic->cellToByteConv);
+         }
+        /* add the data to the report */
+        _JSONENCODE_COPY_FORMATTED_STRING_AND_ADVANCE(actualLength, buffer, remLength, length,
+                                                      epspServicePoolTemplate, pool-1,
+                                                      val1, val2, val3,
+                                                      BVIEW_BST_SS_PORT_CNT(current, BVIEW_BST_CNT_EPSP_MC_SHARE_QENTRIES, port - 1, pool - 1)
+                                                      );
+    }
 
+    if (lastPort != 0)
+    {
         /* adjust the buffer to remove the last ',' */
         buffer = buffer - 1;
         remLength += 1;
@@ -667,8 +595,8 @@ static BVIEW_STATUS _jsonencode_report_egress_epsp ( char *buffer, int asicId,
  *
  *********************************************************************/
 BVIEW_STATUS _jsonencode_report_egress ( char *buffer, int asicId,
-                                        const BVIEW_BST_ASIC_SNAPSHOT_DATA_t *previous,
-                                        const BVIEW_BST_ASIC_SNAPSHOT_DATA_t *current,
+                                        const BVIEW_BST_SNAPSHOT_DATA_t *previous,
+                                        const BVIEW_BST_SNAPSHOT_DATA_t *current,
                                         const BSTJSON_REPORT_OPTIONS_t *options,
                                         const BVIEW_ASIC_CAPABILITIES_t *asic,
                                         int bufLen,
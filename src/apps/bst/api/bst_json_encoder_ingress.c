@@ -36,8 +36,8 @@
  *
  *********************************************************************/
 static BVIEW_STATUS _jsonencode_report_ingress_ippg ( char *buffer, int asicId,
-                                                     const BVIEW_BST_ASIC_SNAPSHOT_DATA_t *previous,
-                                                     const BVIEW_BST_ASIC_SNAPSHOT_DATA_t *current,
+                                                     const BVIEW_BST_SNAPSHOT_DATA_t *previous,
+                                                     const BVIEW_BST_SNAPSHOT_DATA_t *current,
                                                      const BSTJSON_REPORT_OPTIONS_t *options,
                                                      const BVIEW_ASIC_CAPABILITIES_t *asic,
                                                      int bufLen,
@@ -45,16 +45,18 @@ static BVIEW_STATUS _jsonencode_report_ingress_ippg ( char *buffer, int asicId,
 {
     int remLength = bufLen;
     int actualLength  = 0;
-    bool includePort = false;
     uint64_t val1 = 0;
     uint64_t val2 = 0;
 
-    int includePriorityGroups[BVIEW_ASIC_MAX_PRIORITY_GROUPS] = { 0 };
-    int port = 0, priGroup = 0;
+    int port = 0, priGroup = 0, lastPort = 0;
+    unsigned int stride = 0, word = 0, entry = 0;
+    uint64_t bits = 0;
     char portStr[JSON_MAX_NODE_LENGTH] = { 0 };
+    const char *portNotation = NULL;
+    int portLen = 0;
 
     char *ippgTemplate = " { \"realm\": \"ingress-port-priority-group\", \"%s\": [ ";
-    char *ippgPortTemplate = " { \"port\": \"%s\", \"data\": [ ";
+    char *ippgPortTemplate = " { \"port\": \"%.*s\", \"data\": [ ";
     //char *ippgPortGroupTemplate = " { \"pg\" : %d , \"um-share\": %" PRIu64 " , \"um-headroom\": %" PRIu64 " } ,";
     //char *ippgPortGroupTemplate = " { \"pg\" : %d , \"data\": [ %" PRIu64 " , %" PRIu64 " ] } ,";
     char *ippgPortGroupTemplate = " [  %d , %" PRIu64 " , %" PRIu64 " ] ,";
@@ -64,104 +66,68 @@ static BVIEW_STATUS _jsonencode_report_ingress_ippg ( char *buffer, int asicId,
     /* copying the header . Pointer and Length adjustments are handled by the macro */
     _JSONENCODE_COPY_FORMATTED_STRING_AND_ADVANCE(actualLength, buffer, remLength, length, ippgTemplate, "data");
 
-    /* For each port, and for each priority group in that port, 
-     *  1. attempt to see if this port needs to be reported.
+    /* For each priority group to be reported, in the order of the ports,
+     *  1. open the port when its first priority group is seen.
      *  2. create the report.
      */
-    for (port = 1; port <= asic->numPorts; port++)
+    stride = current->layout->stride[BVIEW_BST_CNT_IPPG_UM_SHARE];
+    BVIEW_BST_SS_ENTRY_ITER(current, BVIEW_BST_REALM_INGRESS_PORT_PG, (previous != NULL), word, bits, entry)
     {
-        includePort = false;
-        memset (&includePriorityGroups[0], 0, sizeof (includePriorityGroups));
+        port = (entry / stride) + 1;
+        priGroup = (entry % stride) + 1;
 
-        /* lets see if this port needs to be included in the report at all */
-        for (priGroup = 1; priGroup <= asic->numPriorityGroups; priGroup++)
+        if (port != lastPort)
         {
-            /* By default, we plan to include the pri-group */
-            includePriorityGroups[priGroup - 1] = 1;
-
-            /* If there is no traffic reported for this priority group, ignore it */
-            if ( (current->iPortPg.data[port - 1][priGroup - 1].umShareBufferCount == 0) &&
-                (current->iPortPg.data[port - 1][priGroup - 1].umHeadroomBufferCount == 0) )
+            if (lastPort != 0)
             {
-                includePriorityGroups[priGroup - 1] = 0;
-                continue;
+                /* adjust the buffer to remove the last ',' */
+                buffer = buffer - 1;
+                remLength += 1;
+                *length -= 1;
+
+                /* add the "] } ," for the next port */
+                _JSONENCODE_COPY_FORMATTED_STRING_AND_ADVANCE(actualLength, buffer, remLength, length,
+                                                              "] } ," );
             }
+            lastPort = port;
 
-            /* If this is snapshot report, include the port in the data  */
-            if (previous == NULL)
-            {
-                includePort = true;
-                continue;
-            }
-
-            /* if there is traffic reported since the last snapshot, we can't ignore this priority group */
-            if (previous->iPortPg.data[port - 1][priGroup - 1].umShareBufferCount
-                != current->iPortPg.data[port - 1][priGroup - 1].umShareBufferCount)
-            {
-                includePort = true;
-                continue;
-            }
-
-            if (previous->iPortPg.data[port - 1][priGroup - 1].umHeadroomBufferCount
-                != current->iPortPg.data[port - 1][priGroup - 1].umHeadroomBufferCount)
-            {
-                includePort = true;
-                continue;
-            }
+            /* convert the port to an external representation */
+            JSON_PORT_NOTATION_GET(port, asicId, portNotation, portLen, &portStr[0]);
 
-            /* since there is no reason to include the group, we can ignore it*/
-            includePriorityGroups[priGroup - 1] = 0;
+            /* Now that this port needs to be included in the report, copy the header */
+            _JSONENCODE_COPY_FORMATTED_STRING_AND_ADVANCE(actualLength, buffer, remLength, length, ippgPortTemplate, portLen, portNotation);
         }
 
-        /* if this port needs not be reported, then we move to next port */
-        if (includePort == false)
-        {
-            continue;
-        }
-
-        /* convert the port to an external representation */
-        memset(&portStr[0], 0, JSON_MAX_NODE_LENGTH);
-        JSON_PORT_MAP_TO_NOTATION(port, asicId, &portStr[0]);
-
-
-        /* Now that this port needs to be included in the report, copy the header */
-        _JSONENCODE_COPY_FORMATTED_STRING_AND_ADVANCE(actualLength, buffer, remLength, length, ippgPortTemplate, &portStr[0]);
-
-        /* for each priority-group, prepare the data */
-        for (priGroup = 1; priGroup <= asic->numPriorityGroups; priGroup++)
-        {
-            /* we ignore if there is no data to be reported */
-            if (includePriorityGroups[priGroup - 1] == 0)
-                continue;
-
-            val1 = current->iPortPg.data[port - 1][priGroup - 1].umShareBufferCount;
-            val2 = current->iPortPg.data[port - 1][priGroup - 1].umHeadroomBufferCount;
-
-            /* check if we need to convert the data to cells
-               threshold always comes in bytes from asic */
-            if ((true == options->statUnitsInCells) &&
-                (true == options->reportThreshold))
-             {
-               val1 = 
-                 current->iPortPg.data[port - 1][priGroup - 1].umShareBufferCount / (asic->cellToByteConv);
-               val2 = 
-                 current->iPortPg.data[port - 1][priGroup - 1].umHeadroomBufferCount / (asic->cellToByteConv);
-             }
-            /* check if we need to convert the data to cells
-                the report always comes in cells from asic */
-             else if ((false == options->statUnitsInCells) &&
-                     (false == options->reportThreshold))
-             {
-               val1 = 
-                 current->iPortPg.data[port - 1][priGroup - 1].umShareBufferCount * (asic->cellToByteConv);
-               val2 = 
-                 current->iPortPg.data[port - 1][priGroup - 1].umHeadroomBufferCount * (asic->cellToByteConv);
-             }
-            /* add the data to the report */
-            _JSONENCODE_COPY_FORMATTED_STRING_AND_ADVANCE(actualLength, buffer, remLength, length,
-                                                          ippgPortGroupTemplate, priGroup-1, val1, val2);
-        }
+        val1 = BVIEW_BST_SS_PORT_CNT(current, BVIEW_BST_CNT_IPPG_UM_SHARE, port - 1, priGroup - 1);
+        val2 = BVIEW_BST_SS_PORT_CNT(current, BVIEW_BST_CNT_IPPG_UM_HEADROOM, port - 1, priGroup - 1);
+
+        /* check if we need to convert the data to cells
+           threshold always comes in bytes from asic */
+        if ((true == options->statUnitsInCells) &&
+            (true == options->reportThreshold))
+         {
+           val1 = 
+             BVIEW_BST_SS_PORT_CNT(current, BVIEW_BST_CNT_IPPG_UM_SHARE, port - 1, priGroup - 1) / (asic->cellToByteConv);
+           val2 = 
+             BVIEW_BST_SS_PORT_CNT(current, BVIEW_BST_CNT_IPPG_UM_HEADROOM, port - 1, priGroup - 1) / (asic->cellToByteConv);
+         }
+        /* check if we need to convert the data to cells
+            the report always comes in cells from asic */
+         else if ((false == options->statUnitsInCells) &&
+                 (false == options->reportThreshold))
+         {
+           val1 = 
+             BVIEW_BST_SS_PORT_CNT(current, BVIEW_BST_CNT_IPPG_UM_SHARE, port - 1, priGroup - 1) * (asic->cellToByteConv);
+           val2 = 
+             BVIEW_BST_SS_PORT_CNT(current, BVIEW_BST_CNT_IPPG_UM_HEADROOM, port - 1, priGroup - 1) * (asic->cellToByteConv);
+         }
+        /* add the data to the report */
+        _JSONENCODE_COPY_FORMATTED_STRING_AND_ADVANCE(actualLength, buffer, remLength, length,
+                                                      ippgPortGroupTemplate, priGroup-1, val1, val2);
+    }
 
+    if (lastPort != 0)
+    {
         /* adjust the buffer to remove the last ',' */
         buffer = buffer - 1;
         remLength += 1;
@@ -193,8 +159,8 @@ static BVIEW_STATUS _jsonencode_report_ingress_ippg ( char *buffer, int asicId,
  *
  *********************************************************************/
 static BVIEW_STATUS _jsonencode_report_ingress_ipsp ( char *buffer, int asicId,
-                                                     const BVIEW_BST_ASIC_SNAPSHOT_DATA_t *previous,
-                                                     const BVIEW_BST_ASIC_SNAPSHOT_DATA_t *current,
+                                                     const BVIEW_BST_SNAPSHOT_DATA_t *previous,
+                                                     const BVIEW_BST_SNAPSHOT_DATA_t *current,
                                                      const BSTJSON_REPORT_OPTIONS_t *options,
                                                      const BVIEW_ASIC_CAPABILITIES_t *asic,
                                                      int bufLen,
@@ -202,16 +168,18 @@ static BVIEW_STATUS _jsonencode_report_ingress_ipsp ( char *buffer, int asicId,
 {
     int remLength = bufLen;
     int actualLength  = 0;
-    bool includePort = false;
     uint64_t val = 0;
 
-    int includeServicePool[BVIEW_ASIC_MAX_SERVICE_POOLS] = { 0 };
-    int port = 0, pool = 0;
+    int port = 0, pool = 0, lastPort = 0;
+    unsigned int stride = 0, word = 0, entry = 0;
+    uint64_t bits = 0;
     char portStr[JSON_MAX_NODE_LENGTH] = { 0 };
+    const char *portNotation = NULL;
+    int portLen = 0;
 
 
     char *ipspTemplate = " { \"realm\": \"ingress-port-service-pool\", \"%s\": [ ";
-    char *ipspPortTemplate = " { \"port\": \"%s\", \"data\": [ ";
+    char *ipspPortTemplate = " { \"port\": \"%.*s\", \"data\": [ ";
     //char *ippgPortGroupTemplate = " { \"pg\" : %d , \"um-share\": %" PRIu64 " , \"um-headroom\": %" PRIu64 " } ,";
     //char *ippgPortGroupTemplate = " { \"pg\" : %d , \"data\": [ %" PRIu64 " , %" PRIu64 " ] } ,";
     char *ipspServicePoolTemplate = " [  %d , %" PRIu64 " ] ,";
@@ -221,88 +189,65 @@ static BVIEW_STATUS _jsonencode_report_ingress_ipsp ( char *buffer, int asicId,
     /* copying the header . Pointer and Length adjustments are handled by the macro */
     _JSONENCODE_COPY_FORMATTED_STRING_AND_ADVANCE(actualLength, buffer, remLength, length, ipspTemplate, "data");
 
-    /* For each port, and for each priority group in that port, 
-     *  1. attempt to see if this port needs to be reported.
+    /* For each service pool to be reported, in the order of the ports,
+     *  1. open the port when its first service pool is seen.
      *  2. create the report.
      */
-    for (port = 1; port <= asic->numPorts; port++)
+    stride = current->layout->stride[BVIEW_BST_CNT_IPSP_UM_SHARE];
+    BVIEW_BST_SS_ENTRY_ITER(current, BVIEW_BST_REALM_INGRESS_PORT_SP, (previous != NULL), word, bits, entry)
     {
-        includePort = false;
-        memset (&includeServicePool[0], 0, sizeof (includeServicePool));
+        port = (entry / stride) + 1;
+        pool = (entry % stride) + 1;
 
-        /* lets see if this port needs to be included in the report at all */
-        for (pool = 1; pool <= asic->numServicePools; pool++)
-        {
-            /* By default, we plan to include the pool */
-            includeServicePool[pool - 1] = 1;
-
-            /* If there is no traffic reported for this priority group, ignore it */
-            if (current->iPortSp.data[port - 1][pool - 1].umShareBufferCount == 0)
-            {
-                includeServicePool[pool - 1] = 0;
-                continue;
-            }
+        /* common pools are not reported */
+        if (pool > asic->numServicePools)
+            continue;
 
-            /* If this is snapshot report, include the port in the data  */
-            if (previous == NULL)
+        if (port != lastPort)
+        {
+            if (lastPort != 0)
             {
-                includePort = true;
-                continue;
+                /* adjust the buffer to remove the last ',' */
+                buffer = buffer - 1;
+                remLength += 1;
+                *length -= 1;
+
+                /* add the "] } ," for the next port */
+                _JSONENCODE_COPY_FORMATTED_STRING_AND_ADVANCE(actualLength, buffer, remLength, length,
+                                                              "] } ," );
             }
+            lastPort = port;
 
-            /* if there is traffic reported since the last snapshot, we can't ignore this pool */
-            if (previous->iPortSp.data[port - 1][pool - 1].umShareBufferCount
-                != current->iPortSp.data[port - 1][pool - 1].umShareBufferCount)
-            {
-                includePort = true;
-                continue;
-            }
+            /* convert the port to an external representation */
+            JSON_PORT_NOTATION_GET(port, asicId, portNotation, portLen, &portStr[0]);
 
-            /* since there is no reason to include the pool, we can ignore it*/
-            includeServicePool[pool - 1] = 0;
+            /* Now that this port needs to be included in the report, copy the header */
+            _JSONENCODE_COPY_FORMATTED_STRING_AND_ADVANCE(actualLength, buffer, remLength, length, ipspPortTemplate, portLen, portNotation);
         }
 
-        /* if this port needs not be reported, then we move to next port */
-        if (includePort == false)
-        {
-            continue;
-        }
-
-        /* convert the port to an external representation */
-        memset(&portStr[0], 0, JSON_MAX_NODE_LENGTH);
-        JSON_PORT_MAP_TO_NOTATION(port, asicId, &portStr[0]);
-
-        /* Now that this port needs to be included in the report, copy the header */
-        _JSONENCODE_COPY_FORMATTED_STRING_AND_ADVANCE(actualLength, buffer, remLength, length, ipspPortTemplate,  &portStr[0]);
-
-        /* for each priority-group, prepare the data */
-        for (pool = 1; pool <= asic->numServicePools; pool++)
-        {
-            /* we ignore if there is no data to be reported */
-            if (includeServicePool[pool - 1] == 0)
-                continue;
-
-            val = current->iPortSp.data[port - 1][pool - 1].umShareBufferCount;
-            /* check if we need to convert the data to cells */
-            if ((true == options->statUnitsInCells) &&
-                (true == options->reportThreshold))
-             {
-               val = 
-                 current->iPortSp.data[port - 1][pool - 1].umShareBufferCount / (asic->cellToByteConv);
-             }
-            /* check if we need to convert the data to cells
-                the report always comes in cells from asic */
-             else if ((false == options->statUnitsInCells) &&
-                     (false == options->reportThreshold))
-             {
-               val = 
-                 current->iPortSp.data[port - 1][pool - 1].umShareBufferCount * (asic->cellToByteConv);
-             }
-            /* add the data to the report */
-            _JSONENCODE_COPY_FORMATTED_STRING_AND_ADVANCE(actualLength, buffer, remLength, length,
-                                                          ipspServicePoolTemplate, pool-1,val);
-        }
+        val = BVIEW_BST_SS_PORT_CNT(current, BVIEW_BST_CNT_IPSP_UM_SHARE, port - 1, pool - 1);
+        /* check if we need to convert the data to cells */
+        if ((true == options->statUnitsInCells) &&
+            (true == options->reportThreshold))
+         {
+           val = 
+             BVIEW_BST_SS_PORT_CNT(current, BVIEW_BST_CNT_IPSP_UM_SHARE, port - 1, pool - 1) / (asic->cellToByteConv);
+         }
+        /* check if we need to convert the data to cells
+            the report always comes in cells from asic */
+         else if ((false == options->statUnitsInCells) &&
+                 (false == options->reportThreshold))
+         {
+           val = 
+             BVIEW_BST_SS_PORT_CNT(current, BVIEW_BST_CNT_IPSP_UM_SHARE, port - 1, pool - 1) * (asic->cellToByteConv);
+         }
+        /* add the data to the report */
+        _JSONENCODE_COPY_FORMATTED_STRING_AND_ADVANCE(actualLength, buffer, remLength, length,
+                                                      ipspServicePoolTemplate, pool-1,val);
+    }
 
+    if (lastPort != 0)
+    {
         /* adjust the buffer to remove the last ',' */
         buffer = buffer - 1;
         remLength += 1;
@@ -334,8 +279,8 @@ static BVIEW_STATUS _jsonencode_report_ingress_ipsp ( char *buffer, int asicId,
  *
  *********************************************************************/
 static BVIEW_STATUS _jsonencode_report_ingress_sp ( char *buffer, int asicId,
-                                                   const BVIEW_BST_ASIC_SNAPSHOT_DATA_t *previous,
-                                                   const BVIEW_BST_ASIC_SNAPSHOT_DATA_t *current,
+                                                   const BVIEW_BST_SNAPSHOT_DATA_t *previous,
+                                                   const BVIEW_BST_SNAPSHOT_DATA_t *current,
                                                    const BSTJSON_REPORT_OPTIONS_t *options,
                                                    const BVIEW_ASIC_CAPABILITIES_t *asic,
                                                    int bufLen,
@@ -345,6 +290,8 @@ static BVIEW_STATUS _jsonencode_report_ingress_sp ( char *buffer, int asicId,
     int actualLength  = 0;
     int pool = 0;
     uint64_t val = 0;
+    unsigned int word = 0, entry = 0;
+    uint64_t bits = 0;
 
     char *ispTemplate = " { \"realm\": \"ingress-service-pool\", \"%s\": [ ";
     char *ispServicePoolTemplate = " [  %d , %" PRIu64 " ] ,";
@@ -354,26 +301,23 @@ static BVIEW_STATUS _jsonencode_report_ingress_sp ( char *buffer, int asicId,
     /* copying the header . Pointer and Length adjustments are handled by the macro */
     _JSONENCODE_COPY_FORMATTED_STRING_AND_ADVANCE(actualLength, buffer, remLength, length, ispTemplate, "data");
 
-    /* For each service pool, check if there is a difference, and create the report. */
-    for (pool = 1; pool <= asic->numServicePools; pool++)
+    /* For each service pool with data or a difference, create the report. */
+    BVIEW_BST_SS_ENTRY_ITER(current, BVIEW_BST_REALM_INGRESS_SP, (previous != NULL), word, bits, entry)
     {
-        /* lets see if this pool needs to be included in the report at all */
-        /* if this pool needs not be reported, then we move to next pool */
-        if (current->iSp.data[pool-1].umShareBufferCount == 0)
-            continue;
+        pool = entry + 1;
 
-        if ((previous != NULL) &&
-            (previous->iSp.data[pool-1].umShareBufferCount == current->iSp.data[pool-1].umShareBufferCount))
+        /* common pools are not reported */
+        if (pool > asic->numServicePools)
             continue;
 
-             val = current->iSp.data[pool-1].umShareBufferCount;
+             val = BVIEW_BST_SS_CNT(current, BVIEW_BST_CNT_ISP_UM_SHARE, pool-1);
 
             /* check if we need to convert the data to cells */
             if ((true == options->statUnitsInCells) &&
                 (true == options->reportThreshold))
              {
                val = 
-                 current->iSp.data[pool-1].umShareBufferCount / (asic->cellToByteConv);
+                 BVIEW_BST_SS_CNT(current, BVIEW_BST_CNT_ISP_UM_SHARE, pool-1) / (asic->cellToByteConv);
              }
             /* check if we need to convert the data to cells
                 the report always comes in cells from asic */
@@ -381,7 +325,7 @@ static BVIEW_STATUS _jsonencode_report_ingress_sp ( char *buffer, int asicId,
                      (false == options->reportThreshold))
              {
                val = 
-                 current->iSp.data[pool-1].umShareBufferCount * (asic->cellToByteConv);
+                 BVIEW_BST_SS_CNT(current, BVIEW_BST_CNT_ISP_UM_SHARE, pool-1) * (asic->cellToByteConv);
              }
         /* Now that this pool needs to be included in the report, add the data to report */
         _JSONENCODE_COPY_FORMATTED_STRING_AND_ADVANCE(actualLength, buffer, remLength, length,
@@ -411,8 +355,8 @@ static BVIEW_STATUS _jsonencode_report_ingress_sp ( char *buffer, int asicId,
  *********************************************************************/
 BVIEW_STATUS _jsonencode_report_ingress ( char *buffer, 
                                          int asicId,
-                                         const BVIEW_BST_ASIC_SNAPSHOT_DATA_t *previous,
-                                         const BVIEW_BST_ASIC_SNAPSHOT_DATA_t *current,
+                                         const BVIEW_BST_SNAPSHOT_DATA_t *previous,
+                                         const BVIEW_BST_SNAPSHOT_DATA_t *current,
                                          const BSTJSON_REPORT_OPTIONS_t *options,
                                          const BVIEW_ASIC_CAPABILITIES_t *asic,
                                          int bufLen,
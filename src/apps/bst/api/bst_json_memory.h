@@ -32,7 +32,7 @@ extern "C"
 
 typedef enum _bstjson_memory_size_
 {
-    BSTJSON_MEMSIZE_RESPONSE = 1024,
+    BSTJSON_MEMSIZE_RESPONSE = 2048,
     BSTJSON_MEMSIZE_REPORT = (sizeof(BVIEW_BST_ASIC_SNAPSHOT_DATA_t)+ 2048),
 } BSTJSON_MEMORY_SIZE;
 
@@ -48,17 +48,39 @@ BVIEW_STATUS bstjson_configure_bst_feature (void *cookie, char *jsonBuffer, int
     cJSON *json_jsonrpc, *json_method, *json_asicId;
     cJSON *json_id, *json_bstEnable, *json_sendAsyncReports;
     cJSON *json_collectionInterval, *json_statUnitsInCells,  *root, *params;
+    cJSON *json_triggerCoalesceInterval, *json_triggerRateLimit, *json_triggerBurst;
+    cJSON *json_collectionAlign, *json_collectionAlignOffsetMs;
+    cJSON *json_collectionAdaptive;
+    cJSON *json_historySizeMb;
+    cJSON *json_rollupSizeMb, *json_rollupTiers, *json_rollupTier;
+    cJSON *json_statisticsSizeMb, *json_statisticsSliceSec;
+    cJSON *json_journalSizeMb, *json_journalFile;
+    cJSON *json_collectionIntervalMs;
 
     /* Local non-command-parameter JSON variable declarations */
     char jsonrpc[JSON_MAX_NODE_LENGTH] = {0};
     char method[JSON_MAX_NODE_LENGTH] = {0};
     int asicId = 0, id = 0;
+    int index = 0;
 
     /* Local variable declarations */
     BVIEW_STATUS status = BVIEW_STATUS_SUCCESS;
     BSTJSON_CONFIGURE_BST_FEATURE_t command;
 
     memset(&command, 0, sizeof (command));
+    command.collectionIntervalMs = -1;
+    command.triggerCoalesceInterval = -1;
+    command.triggerRateLimit = -1;
+    command.triggerBurst = -1;
+    command.collectionAlign = -1;
+    command.collectionAlignOffsetMs = -1;
+    command.collectionAdaptive = -1;
+    command.historySizeMb = -1;
+    command.rollupSizeMb = -1;
+    command.numRollupTiers = -1;
+    command.statisticsSizeMb = -1;
+    command.statisticsSliceSec = -1;
+    command.journalSizeMb = -1;
 
     /* Validating input parameters */
 
@@ -141,14 +163,32 @@ BVIEW_STATUS bstjson_configure_bst_feature (void *cookie, char *jsonBuffer, int
     JSON_CHECK_VALUE_AND_CLEANUP (command.sendAsyncReports, 0, 1);
 
 
+    /* Parsing and Validating 'collection-interval-ms' from JSON buffer */
+    json_collectionIntervalMs = cJSON_GetObjectItem(params, "collection-interval-ms");
+    /* The node 'collection-interval-ms' is an optioanl one, ignore if not present in JSON */
+    if (json_collectionIntervalMs != NULL)
+    {
+        JSON_VALIDATE_JSON_POINTER(json_collectionIntervalMs, "collection-interval-ms", BVIEW_STATUS_INVALID_JSON);
+        JSON_VALIDATE_JSON_AS_NUMBER(json_collectionIntervalMs, "collection-interval-ms");
+        /* Copy the value */
+        command.collectionIntervalMs = json_collectionIntervalMs->valueint;
+        /* Ensure  that the number 'collection-interval-ms' is within range of [0,600000] */
+        JSON_CHECK_VALUE_AND_CLEANUP (command.collectionIntervalMs, 0, 600000);
+    } /* if optional */
+
+
     /* Parsing and Validating 'collection-interval' from JSON buffer */
     json_collectionInterval = cJSON_GetObjectItem(params, "collection-interval");
-    JSON_VALIDATE_JSON_POINTER(json_collectionInterval, "collection-interval", BVIEW_STATUS_INVALID_JSON);
-    JSON_VALIDATE_JSON_AS_NUMBER(json_collectionInterval, "collection-interval");
-    /* Copy the value */
-    command.collectionInterval = json_collectionInterval->valueint;
-    /* Ensure  that the number 'collection-interval' is within range of [0,600] */
-    JSON_CHECK_VALUE_AND_CLEANUP (command.collectionInterval, 0, 600);
+    /* The node 'collection-interval' can be left out if 'collection-interval-ms' is present */
+    if ((json_collectionInterval != NULL) || (json_collectionIntervalMs == NULL))
+    {
+        JSON_VALIDATE_JSON_POINTER(json_collectionInterval, "collection-interval", BVIEW_STATUS_INVALID_JSON);
+        JSON_VALIDATE_JSON_AS_NUMBER(json_collectionInterval, "collection-interval");
+        /* Copy the value */
+        command.collectionInterval = json_collectionInterval->valueint;
+        /* Ensure  that the number 'collection-interval' is within range of [0,600] */
+        JSON_CHECK_VALUE_AND_CLEANUP (command.collectionInterval, 0, 600);
+    }
 
 
     /* Parsing and Validating 'stat-units-in-cells' from JSON buffer */
@@ -161,6 +201,230 @@ BVIEW_STATUS bstjson_configure_bst_feature (void *cookie, char *jsonBuffer, int
     JSON_CHECK_VALUE_AND_CLEANUP (command.statUnitsInCells, 0, 1);
 
 
+    /* Parsing and Validating 'trigger-coalesce-interval' from JSON buffer */
+    json_triggerCoalesceInterval = cJSON_GetObjectItem(params, "trigger-coalesce-interval");
+    /* The node 'trigger-coalesce-interval' is an optioanl one, ignore if not present in JSON */
+    if (json_triggerCoalesceInterval != NULL)
+    {
+        JSON_VALIDATE_JSON_POINTER(json_triggerCoalesceInterval, "trigger-coalesce-interval", BVIEW_STATUS_INVALID_JSON);
+        JSON_VALIDATE_JSON_AS_NUMBER(json_triggerCoalesceInterval, "trigger-coalesce-interval");
+        /* Copy the value */
+        command.triggerCoalesceInterval = json_triggerCoalesceInterval->valueint;
+        /* Ensure  that the number 'trigger-coalesce-interval' is within range of [0,10000] */
+        JSON_CHECK_VALUE_AND_CLEANUP (command.triggerCoalesceInterval, 0, 10000);
+    } /* if optional */
+
+
+    /* Parsing and Validating 'trigger-rate-limit' from JSON buffer */
+    json_triggerRateLimit = cJSON_GetObjectItem(params, "trigger-rate-limit");
+    /* The node 'trigger-rate-limit' is an optioanl one, ignore if not present in JSON */
+    if (json_triggerRateLimit != NULL)
+    {
+        JSON_VALIDATE_JSON_POINTER(json_triggerRateLimit, "trigger-rate-limit", BVIEW_STATUS_INVALID_JSON);
+        JSON_VALIDATE_JSON_AS_NUMBER(json_triggerRateLimit, "trigger-rate-limit");
+        /* Copy the value */
+        command.triggerRateLimit = json_triggerRateLimit->valueint;
+        /* Ensure  that the number 'trigger-rate-limit' is within range of [0,1000] */
+        JSON_CHECK_VALUE_AND_CLEANUP (command.triggerRateLimit, 0, 1000);
+    } /* if optional */
+
+
+    /* Parsing and Validating 'trigger-burst' from JSON buffer */
+    json_triggerBurst = cJSON_GetObjectItem(params, "trigger-burst");
+    /* The node 'trigger-burst' is an optioanl one, ignore if not present in JSON */
+    if (json_triggerBurst != NULL)
+    {
+        JSON_VALIDATE_JSON_POINTER(json_triggerBurst, "trigger-burst", BVIEW_STATUS_INVALID_JSON);
+        JSON_VALIDATE_JSON_AS_NUMBER(json_triggerBurst, "trigger-burst");
+        /* Copy the value */
+        command.triggerBurst = json_triggerBurst->valueint;
+        /* Ensure  that the number 'trigger-burst' is within range of [1,1000] */
+        JSON_CHECK_VALUE_AND_CLEANUP (command.triggerBurst, 1, 1000);
+    } /* if optional */
+
+
+    /* Parsing and Validating 'collection-align' from JSON buffer */
+    json_collectionAlign = cJSON_GetObjectItem(params, "collection-align");
+    /* The node 'collection-align' is an optioanl one, ignore if not present in JSON */
+    if (json_collectionAlign != NULL)
+    {
+        JSON_VALIDATE_JSON_POINTER(json_collectionAlign, "collection-align", BVIEW_STATUS_INVALID_JSON);
+        JSON_VALIDATE_JSON_AS_NUMBER(json_collectionAlign, "collection-align");
+        /* Copy the value */
+        command.collectionAlign = json_collectionAlign->valueint;
+        /* Ensure  that the number 'collection-align' is within range of [0,1] */
+        JSON_CHECK_VALUE_AND_CLEANUP (command.collectionAlign, 0, 1);
+    } /* if optional */
+
+
+    /* Parsing and Validating 'collection-align-offset-ms' from JSON buffer */
+    json_collectionAlignOffsetMs = cJSON_GetObjectItem(params, "collection-align-offset-ms");
+    /* The node 'collection-align-offset-ms' is an optioanl one, ignore if not present in JSON */
+    if (json_collectionAlignOffsetMs != NULL)
+    {
+        JSON_VALIDATE_JSON_POINTER(json_collectionAlignOffsetMs, "collection-align-offset-ms", BVIEW_STATUS_INVALID_JSON);
+        JSON_VALIDATE_JSON_AS_NUMBER(json_collectionAlignOffsetMs, "collection-align-offset-ms");
+        /* Copy the value */
+        command.collectionAlignOffsetMs = json_collectionAlignOffsetMs->valueint;
+        /* Ensure  that the number 'collection-align-offset-ms' is within range of [0,600000] */
+        JSON_CHECK_VALUE_AND_CLEANUP (command.collectionAlignOffsetMs, 0, 600000);
+    } /* if optional */
+
+
+    /* Parsing and Validating 'collection-interval-adaptive' from JSON buffer */
+    json_collectionAdaptive = cJSON_GetObjectItem(params, "collection-interval-adaptive");
+    /* The node 'collection-interval-adaptive' is an optioanl one, ignore if not present in JSON */
+    if (json_collectionAdaptive != NULL)
+    {
+        JSON_VALIDATE_JSON_POINTER(json_collectionAdaptive, "collection-interval-adaptive", BVIEW_STATUS_INVALID_JSON);
+        JSON_VALIDATE_JSON_AS_NUMBER(json_collectionAdaptive, "collection-interval-adaptive");
+        /* Copy the value */
+        command.collectionAdaptive = json_collectionAdaptive->valueint;
+        /* Ensure  that the number 'collection-interval-adaptive' is within range of [0,1] */
+        JSON_CHECK_VALUE_AND_CLEANUP (command.collectionAdaptive, 0, 1);
+    } /* if optional */
+
+
+    /* Parsing and Validating 'history-size-mb' from JSON buffer */
+    json_historySizeMb = cJSON_GetObjectItem(params, "history-size-mb");
+    /* The node 'history-size-mb' is an optioanl one, ignore if not present in JSON */
+    if (json_historySizeMb != NULL)
+    {
+        JSON_VALIDATE_JSON_POINTER(json_historySizeMb, "history-size-mb", BVIEW_STATUS_INVALID_JSON);
+        JSON_VALIDATE_JSON_AS_NUMBER(json_historySizeMb, "history-size-mb");
+        /* Copy the value */
+        command.historySizeMb = json_historySizeMb->valueint;
+        /* Ensure  that the number 'history-size-mb' is within range of [0,1024] */
+        JSON_CHECK_VALUE_AND_CLEANUP (command.historySizeMb, 0, 1024);
+    } /* if optional */
+
+
+    /* Parsing and Validating 'rollup-size-mb' from JSON buffer */
+    json_rollupSizeMb = cJSON_GetObjectItem(params, "rollup-size-mb");
+    /* The node 'rollup-size-mb' is an optioanl one, ignore if not present in JSON */
+    if (json_rollupSizeMb != NULL)
+    {
+        JSON_VALIDATE_JSON_POINTER(json_rollupSizeMb, "rollup-size-mb", BVIEW_STATUS_INVALID_JSON);
+        JSON_VALIDATE_JSON_AS_NUMBER(json_rollupSizeMb, "rollup-size-mb");
+        /* Copy the value */
+        command.rollupSizeMb = json_rollupSizeMb->valueint;
+        /* Ensure  that the number 'rollup-size-mb' is within range of [0,1024] */
+        JSON_CHECK_VALUE_AND_CLEANUP (command.rollupSizeMb, 0, 1024);
+    } /* if optional */
+
+
+    /* Parsing and Validating 'rollup-tiers' from JSON buffer */
+    json_rollupTiers = cJSON_GetObjectItem(params, "rollup-tiers");
+    /* The node 'rollup-tiers' is an optioanl one, ignore if not present in JSON */
+    if (json_rollupTiers != NULL)
+    {
+        if (json_rollupTiers->type != cJSON_Array)
+        {
+            _jsonlog("Error parsing JSON, %s not an array ", "rollup-tiers");
+            cJSON_Delete(root);
+            return BVIEW_STATUS_INVALID_JSON;
+        }
+        command.numRollupTiers = cJSON_GetArraySize(json_rollupTiers);
+        /* Ensure  that the number of tiers is within range of [1,BSTJSON_MAX_ROLLUP_TIERS] */
+        JSON_CHECK_VALUE_AND_CLEANUP (command.numRollupTiers, 1, BSTJSON_MAX_ROLLUP_TIERS);
+
+        for (index = 0; index < command.numRollupTiers; index++)
+        {
+            /* every tier is a pair of [ interval-sec, retention ] */
+            json_rollupTier = cJSON_GetArrayItem(json_rollupTiers, index);
+            if ((json_rollupTier->type != cJSON_Array) ||
+                (cJSON_GetArraySize(json_rollupTier) != 2))
+            {
+                _jsonlog("Error parsing JSON, %s not an array of pairs of numbers ", "rollup-tiers");
+                cJSON_Delete(root);
+                return BVIEW_STATUS_INVALID_JSON;
+            }
+            JSON_VALIDATE_JSON_AS_NUMBER(cJSON_GetArrayItem(json_rollupTier, 0), "rollup-tiers");
+            JSON_VALIDATE_JSON_AS_NUMBER(cJSON_GetArrayItem(json_rollupTier, 1), "rollup-tiers");
+            /* Copy the values */
+            command.rollupIntervalSec[index] = cJSON_GetArrayItem(json_rollupTier, 0)->valueint;
+            command.rollupRetention[index] = cJSON_GetArrayItem(json_rollupTier, 1)->valueint;
+            /* Ensure  that the interval is within [1,86400] and the buckets kept within [1,100000] */
+            JSON_CHECK_VALUE_AND_CLEANUP (command.rollupIntervalSec[index], 1, 86400);
+            JSON_CHECK_VALUE_AND_CLEANUP (command.rollupRetention[index], 1, 100000);
+            /* Ensure  that a bucket of a tier is made of whole buckets of the finer tier */
+            if (index != 0)
+            {
+                JSON_CHECK_VALUE_AND_CLEANUP (command.rollupIntervalSec[index],
+                                              command.rollupIntervalSec[index - 1] + 1, 86400);
+                JSON_CHECK_VALUE_AND_CLEANUP (command.rollupIntervalSec[index] %
+                                              command.rollupIntervalSec[index - 1], 0, 0);
+            }
+        }
+    } /* if optional */
+
+
+    /* Parsing and Validating 'statistics-size-mb' from JSON buffer */
+    json_statisticsSizeMb = cJSON_GetObjectItem(params, "statistics-size-mb");
+    /* The node 'statistics-size-mb' is an optioanl one, ignore if not present in JSON */
+    if (json_statisticsSizeMb != NULL)
+    {
+        JSON_VALIDATE_JSON_POINTER(json_statisticsSizeMb, "statistics-size-mb", BVIEW_STATUS_INVALID_JSON);
+        JSON_VALIDATE_JSON_AS_NUMBER(json_statisticsSizeMb, "statistics-size-mb");
+        /* Copy the value */
+        command.statisticsSizeMb = json_statisticsSizeMb->valueint;
+        /* Ensure  that the number 'statistics-size-mb' is within range of [0,1024] */
+        JSON_CHECK_VALUE_AND_CLEANUP (command.statisticsSizeMb, 0, 1024);
+    } /* if optional */
+
+
+    /* Parsing and Validating 'statistics-slice-sec' from JSON buffer */
+    json_statisticsSliceSec = cJSON_GetObjectItem(params, "statistics-slice-sec");
+    /* The node 'statistics-slice-sec' is an optioanl one, ignore if not present in JSON */
+    if (json_statisticsSliceSec != NULL)
+    {
+        JSON_VALIDATE_JSON_POINTER(json_statisticsSliceSec, "statistics-slice-sec", BVIEW_STATUS_INVALID_JSON);
+        JSON_VALIDATE_JSON_AS_NUMBER(json_statisticsSliceSec, "statistics-slice-sec");
+        /* Copy the value */
+        command.statisticsSliceSec = json_statisticsSliceSec->valueint;
+        /* Ensure  that the number 'statistics-slice-sec' is within range of [1,600],
+           so that the samples of a slice fit the counts of its histograms */
+        JSON_CHECK_VALUE_AND_CLEANUP (command.statisticsSliceSec, 1, 600);
+    } /* if optional */
+
+
+    /* Parsing and Validating 'journal-size-mb' from JSON buffer */
+    json_journalSizeMb = cJSON_GetObjectItem(params, "journal-size-mb");
+    /* The node 'journal-size-mb' is an optioanl one, ignore if not present in JSON */
+    if (json_journalSizeMb != NULL)
+    {
+        JSON_VALIDATE_JSON_POINTER(json_journalSizeMb, "journal-size-mb", BVIEW_STATUS_INVALID_JSON);
+        JSON_VALIDATE_JSON_AS_NUMBER(json_journalSizeMb, "journal-size-mb");
+        /* Copy the value */
+        command.journalSizeMb = json_journalSizeMb->valueint;
+        /* Ensure  that the number 'journal-size-mb' is within range of [0,1024] */
+        JSON_CHECK_VALUE_AND_CLEANUP (command.journalSizeMb, 0, 1024);
+    } /* if optional */
+
+
+    /* Parsing and Validating 'journal-file' from JSON buffer */
+    json_journalFile = cJSON_GetObjectItem(params, "journal-file");
+    /* The node 'journal-file' is an optioanl one, ignore if not present in JSON */
+    if (json_journalFile != NULL)
+    {
+        JSON_VALIDATE_JSON_POINTER(json_journalFile, "journal-file", BVIEW_STATUS_INVALID_JSON);
+        JSON_VALIDATE_JSON_AS_STRING(json_journalFile, "journal-file", BVIEW_STATUS_INVALID_JSON);
+        /* Ensure  that 'journal-file' is an absolute path which fits, and
+           is reported back as is in get-bst-feature */
+        if ((json_journalFile->valuestring[0] != '/') ||
+            (strlen(json_journalFile->valuestring) >= BSTJSON_MAX_JOURNAL_FILE_LENGTH) ||
+            (strpbrk(json_journalFile->valuestring, "\"\\") != NULL))
+        {
+            _jsonlog("Error parsing JSON, %s not a valid path ", "journal-file");
+            cJSON_Delete(root);
+            return BVIEW_STATUS_INVALID_JSON;
+        }
+        /* Copy the string, with a limit on max characters */
+        strncpy (&command.journalFile[0], json_journalFile->valuestring,
+                 BSTJSON_MAX_JOURNAL_FILE_LENGTH - 1);
+    } /* if optional */
+
+
     /* Send the 'command' along with 'asicId' and 'cookie' to the Application thread. */
     status = bstjson_configure_bst_feature_impl (cookie, asicId, id, &command);
 
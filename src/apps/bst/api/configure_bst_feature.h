@@ -35,13 +35,52 @@ extern "C"
 
 #include "cJSON.h"
 
+/* tiers of the rollups, at most */
+#define BSTJSON_MAX_ROLLUP_TIERS    4
+#define BSTJSON_MAX_JOURNAL_FILE_LENGTH    128
+
 /* Structure to pass API parameters to the BST APP */
 typedef struct _bstjson_configure_bst_feature_
 {
     int bstEnable;
     int sendAsyncReports;
     int collectionInterval;
+    /* collection interval in milli seconds. Overrides collectionInterval,
+       -1 if not present in the request */
+    int collectionIntervalMs;
     int statUnitsInCells;
+    /* optional trigger parameters, -1 if not present in the request */
+    int triggerCoalesceInterval;
+    int triggerRateLimit;
+    int triggerBurst;
+    /* optional alignment of the periodic collection to the wall clock,
+       -1 if not present in the request */
+    int collectionAlign;
+    int collectionAlignOffsetMs;
+    /* optional back-off of the collection interval on overruns,
+       -1 if not present in the request */
+    int collectionAdaptive;
+    /* optional size of the snapshot history in MB, 0 disables it,
+       -1 if not present in the request */
+    int historySizeMb;
+    /* optional size of the rollups in MB, split among the tiers,
+       0 disables them, -1 if not present in the request */
+    int rollupSizeMb;
+    /* optional tiers of the rollups, finest first. Interval of a
+       bucket in seconds and buckets kept, -1 if not present */
+    int numRollupTiers;
+    int rollupIntervalSec[BSTJSON_MAX_ROLLUP_TIERS];
+    int rollupRetention[BSTJSON_MAX_ROLLUP_TIERS];
+    /* optional size of the streaming statistics in MB, 0 disables
+       them, and interval of a slice in seconds, -1 if not present */
+    int statisticsSizeMb;
+    int statisticsSliceSec;
+    /* optional size of the snapshot journal in MB, 0 disables it,
+       -1 if not present in the request */
+    int journalSizeMb;
+    /* optional path of the journal file, the unit id is appended to
+       it, empty if not present in the request */
+    char journalFile[BSTJSON_MAX_JOURNAL_FILE_LENGTH];
 } BSTJSON_CONFIGURE_BST_FEATURE_t;
 
 
@@ -46,12 +46,7 @@ BVIEW_STATUS bstjson_configure_bst_thresholds (void *cookie, char *jsonBuffer, i
 
     /* Local Variables for JSON Parsing */
     cJSON *json_jsonrpc, *json_method, *json_asicId;
-    cJSON *json_id, *json_realm, *json_port;
-    cJSON *json_priorityGroup, *json_servicePool, *json_queue;
-    cJSON *json_queueGroup, *json_threshold, *json_umShareThreshold;
-    cJSON *json_umHeadroomThreshold, *json_ucShareThreshold, *json_mcShareThreshold;
-    cJSON *json_mcShareQueueEntriesThreshold, *json_ucThreshold, *json_mcThreshold;
-    cJSON *json_mcQueueEntriesThreshold, *json_cpuThreshold, *json_rqeThreshold;
+    cJSON *json_id;
     cJSON  *root, *params;
 
     /* Local non-command-parameter JSON variable declarations */
@@ -126,12 +121,59 @@ BVIEW_STATUS bstjson_configure_bst_thresholds (void *cookie, char *jsonBuffer, i
     JSON_CHECK_VALUE_AND_CLEANUP (id, 1, 100000);
 
 
+    /* Parsing and Validating the threshold parameters from JSON buffer */
+    status = bstjson_configure_bst_thresholds_params_parse(params, &command);
+    if (status != BVIEW_STATUS_SUCCESS)
+    {
+        cJSON_Delete(root);
+        return status;
+    }
+
+
+    /* Send the 'command' along with 'asicId' and 'cookie' to the Application thread. */
+    status = bstjson_configure_bst_thresholds_impl (cookie, asicId, id, &command);
+
+    /* Free up any allocated resources and return status code */
+    if (root != NULL)
+    {
+        cJSON_Delete(root);
+    }
+
+    return status;
+}
+
+/******************************************************************
+ * @brief  Parses the threshold parameters of one realm entry
+ *
+ * @param[in]    params     JSON object holding the parameters
+ * @param[out]   pCommand   Parsed parameters
+ *                           
+ * @retval   BVIEW_STATUS_SUCCESS  Parameters parsed
+ * @retval   BVIEW_STATUS_INVALID_JSON  JSON is malformatted, or doesn't 
+ * 					have necessary data.
+ *
+ * @note     Shared by the single and the bulk threshold configuration.
+ *           The JSON is owned by the caller and freed by it on failure.
+ *********************************************************************/
+BVIEW_STATUS bstjson_configure_bst_thresholds_params_parse (cJSON *params,
+                                        BSTJSON_CONFIGURE_BST_THRESHOLDS_t *pCommand)
+{
+    /* Local Variables for JSON Parsing */
+    cJSON *json_realm, *json_port;
+    cJSON *json_priorityGroup, *json_servicePool, *json_queue;
+    cJSON *json_queueGroup, *json_threshold, *json_umShareThreshold;
+    cJSON *json_umHeadroomThreshold, *json_ucShareThreshold, *json_mcShareThreshold;
+    cJSON *json_mcShareQueueEntriesThreshold, *json_ucThreshold, *json_mcThreshold;
+    cJSON *json_mcQueueEntriesThreshold, *json_cpuThreshold, *json_rqeThreshold;
+    /* root is freed by the caller, the validation macros must not free it */
+    cJSON *root = NULL;
+
     /* Parsing and Validating 'realm' from JSON buffer */
     json_realm = cJSON_GetObjectItem(params, "realm");
     JSON_VALIDATE_JSON_POINTER(json_realm, "realm", BVIEW_STATUS_INVALID_JSON);
     JSON_VALIDATE_JSON_AS_STRING(json_realm, "realm", BVIEW_STATUS_INVALID_JSON);
     /* Copy the string, with a limit on max characters */
-    strncpy (&command.realm[0], json_realm->valuestring, JSON_MAX_NODE_LENGTH - 1);
+    strncpy (&pCommand->realm[0], json_realm->valuestring, JSON_MAX_NODE_LENGTH - 1);
 
 
     /* Parsing and Validating 'port' from JSON buffer */
@@ -142,7 +184,7 @@ BVIEW_STATUS bstjson_configure_bst_thresholds (void *cookie, char *jsonBuffer, i
         JSON_VALIDATE_JSON_POINTER(json_port, "port", BVIEW_STATUS_INVALID_JSON);
         JSON_VALIDATE_JSON_AS_STRING(json_port, "port", BVIEW_STATUS_INVALID_JSON);
         /* Copy the 'port' in external notation to our internal representation */
-        JSON_PORT_MAP_FROM_NOTATION(command.port, json_port->valuestring);
+        JSON_PORT_MAP_FROM_NOTATION(pCommand->port, json_port->valuestring);
     } /* if optional */
 
 
@@ -154,9 +196,9 @@ BVIEW_STATUS bstjson_configure_bst_thresholds (void *cookie, char *jsonBuffer, i
         JSON_VALIDATE_JSON_POINTER(json_priorityGroup, "priority-group", BVIEW_STATUS_INVALID_JSON);
         JSON_VALIDATE_JSON_AS_NUMBER(json_priorityGroup, "priority-group");
         /* Copy the value */
-        command.priorityGroup = json_priorityGroup->valueint;
+        pCommand->priorityGroup = json_priorityGroup->valueint;
         /* Ensure  that the number 'priority-group' is within range of [0,7] */
-        JSON_CHECK_VALUE_AND_CLEANUP (command.priorityGroup, 0, 7);
+        JSON_CHECK_VALUE_AND_CLEANUP (pCommand->priorityGroup, 0, 7);
     } /* if optional */
 
 
@@ -168,9 +210,9 @@ BVIEW_STATUS bstjson_configure_bst_thresholds (void *cookie, char *jsonBuffer, i
         JSON_VALIDATE_JSON_POINTER(json_servicePool, "service-pool", BVIEW_STATUS_INVALID_JSON);
         JSON_VALIDATE_JSON_AS_NUMBER(json_servicePool, "service-pool");
         /* Copy the value */
-        command.servicePool = json_servicePool->valueint;
+        pCommand->servicePool = json_servicePool->valueint;
         /* Ensure  that the number 'service-pool' is within range of [0,3] */
-        JSON_CHECK_VALUE_AND_CLEANUP (command.servicePool, 0, 3);
+        JSON_CHECK_VALUE_AND_CLEANUP (pCommand->servicePool, 0, 3);
     } /* if optional */
 
 
@@ -182,9 +224,9 @@ BVIEW_STATUS bstjson_configure_bst_thresholds (void *cookie, char *jsonBuffer, i
         JSON_VALIDATE_JSON_POINTER(json_queue, "queue", BVIEW_STATUS_INVALID_JSON);
         JSON_VALIDATE_JSON_AS_NUMBER(json_queue, "queue");
         /* Copy the value */
-        command.queue = json_queue->valueint;
+        pCommand->queue = json_queue->valueint;
         /* Ensure  that the number 'queue' is within range of [0,4095] */
-        JSON_CHECK_VALUE_AND_CLEANUP (command.queue, 0, 4095);
+        JSON_CHECK_VALUE_AND_CLEANUP (pCommand->queue, 0, 4095);
     } /* if optional */
 
 
@@ -196,9 +238,9 @@ BVIEW_STATUS bstjson_configure_bst_thresholds (void *cookie, char *jsonBuffer, i
         JSON_VALIDATE_JSON_POINTER(json_queueGroup, "queue-group", BVIEW_STATUS_INVALID_JSON);
         JSON_VALIDATE_JSON_AS_NUMBER(json_queueGroup, "queue-group");
         /* Copy the value */
-        command.queueGroup = json_queueGroup->valueint;
+        pCommand->queueGroup = json_queueGroup->valueint;
         /* Ensure  that the number 'queue-group' is within range of [0,7] */
-        JSON_CHECK_VALUE_AND_CLEANUP (command.queueGroup, 0, 127);
+        JSON_CHECK_VALUE_AND_CLEANUP (pCommand->queueGroup, 0, 127);
     } /* if optional */
 
 
@@ -210,7 +252,7 @@ BVIEW_STATUS bstjson_configure_bst_thresholds (void *cookie, char *jsonBuffer, i
         JSON_VALIDATE_JSON_POINTER(json_threshold, "threshold", BVIEW_STATUS_INVALID_JSON);
         JSON_VALIDATE_JSON_AS_NUMBER(json_threshold, "threshold");
         /* Copy the value */
-        command.threshold = json_threshold->valueint;
+        pCommand->threshold = json_threshold->valueint;
     } /* if optional */
 
 
@@ -222,7 +264,7 @@ BVIEW_STATUS bstjson_configure_bst_thresholds (void *cookie, char *jsonBuffer, i
         JSON_VALIDATE_JSON_POINTER(json_umShareThreshold, "um-share-threshold", BVIEW_STATUS_INVALID_JSON);
         JSON_VALIDATE_JSON_AS_NUMBER(json_umShareThreshold, "um-share-threshold");
         /* Copy the value */
-        command.umShareThreshold = json_umShareThreshold->valueint;
+        pCommand->umShareThreshold = json_umShareThreshold->valueint;
     } /* if optional */
 
 
@@ -234,7 +276,7 @@ BVIEW_STATUS bstjson_configure_bst_thresholds (void *cookie, char *jsonBuffer, i
         JSON_VALIDATE_JSON_POINTER(json_umHeadroomThreshold, "um-headroom-threshold", BVIEW_STATUS_INVALID_JSON);
         JSON_VALIDATE_JSON_AS_NUMBER(json_umHeadroomThreshold, "um-headroom-threshold");
         /* Copy the value */
-        command.umHeadroomThreshold = json_umHeadroomThreshold->valueint;
+        pCommand->umHeadroomThreshold = json_umHeadroomThreshold->valueint;
     } /* if optional */
 
 
@@ -246,7 +288,7 @@ BVIEW_STATUS bstjson_configure_bst_thresholds (void *cookie, char *jsonBuffer, i
         JSON_VALIDATE_JSON_POINTER(json_ucShareThreshold, "uc-share-threshold", BVIEW_STATUS_INVALID_JSON);
         JSON_VALIDATE_JSON_AS_NUMBER(json_ucShareThreshold, "uc-share-threshold");
         /* Copy the value */
-        command.ucShareThreshold = json_ucShareThreshold->valueint;
+        pCommand->ucShareThreshold = json_ucShareThreshold->valueint;
     } /* if optional */
 
 
@@ -258,7 +300,7 @@ BVIEW_STATUS bstjson_configure_bst_thresholds (void *cookie, char *jsonBuffer, i
         JSON_VALIDATE_JSON_POINTER(json_mcShareThreshold, "mc-share-threshold", BVIEW_STATUS_INVALID_JSON);
         JSON_VALIDATE_JSON_AS_NUMBER(json_mcShareThreshold, "mc-share-threshold");
         /* Copy the value */
-        command.mcShareThreshold = json_mcShareThreshold->valueint;
+        pCommand->mcShareThreshold = json_mcShareThreshold->valueint;
     } /* if optional */
 
 
@@ -270,7 +312,7 @@ BVIEW_STATUS bstjson_configure_bst_thresholds (void *cookie, char *jsonBuffer, i
         JSON_VALIDATE_JSON_POINTER(json_mcShareQueueEntriesThreshold, "mc-share-queue-entries-threshold", BVIEW_STATUS_INVALID_JSON);
         JSON_VALIDATE_JSON_AS_NUMBER(json_mcShareQueueEntriesThreshold, "mc-share-queue-entries-threshold");
         /* Copy the value */
-        command.mcShareQueueEntriesThreshold = json_mcShareQueueEntriesThreshold->valueint;
+        pCommand->mcShareQueueEntriesThreshold = json_mcShareQueueEntriesThreshold->valueint;
     } /* if optional */
 
 
@@ -282,7 +324,7 @@ BVIEW_STATUS bstjson_configure_bst_thresholds (void *cookie, char *jsonBuffer, i
         JSON_VALIDATE_JSON_POINTER(json_ucThreshold, "uc-threshold", BVIEW_STATUS_INVALID_JSON);
         JSON_VALIDATE_JSON_AS_NUMBER(json_ucThreshold, "uc-threshold");
         /* Copy the value */
-        command.ucThreshold = json_ucThreshold->valueint;
+        pCommand->ucThreshold = json_ucThreshold->valueint;
     } /* if optional */
 
 
@@ -294,7 +336,7 @@ BVIEW_STATUS bstjson_configure_bst_thresholds (void *cookie, char *jsonBuffer, i
         JSON_VALIDATE_JSON_POINTER(json_mcThreshold, "mc-threshold", BVIEW_STATUS_INVALID_JSON);
         JSON_VALIDATE_JSON_AS_NUMBER(json_mcThreshold, "mc-threshold");
         /* Copy the value */
-        command.mcThreshold = json_mcThreshold->valueint;
+        pCommand->mcThreshold = json_mcThreshold->valueint;
     } /* if optional */
 
 
@@ -306,7 +348,7 @@ BVIEW_STATUS bstjson_configure_bst_thresholds (void *cookie, char *jsonBuffer, i
         JSON_VALIDATE_JSON_POINTER(json_mcQueueEntriesThreshold, "mc-queue-entries-threshold", BVIEW_STATUS_INVALID_JSON);
         JSON_VALIDATE_JSON_AS_NUMBER(json_mcQueueEntriesThreshold, "mc-queue-entries-threshold");
         /* Copy the value */
-        command.mcQueueEntriesThreshold = json_mcQueueEntriesThreshold->valueint;
+        pCommand->mcQueueEntriesThreshold = json_mcQueueEntriesThreshold->valueint;
     } /* if optional */
 
 
@@ -318,7 +360,7 @@ BVIEW_STATUS bstjson_configure_bst_thresholds (void *cookie, char *jsonBuffer, i
         JSON_VALIDATE_JSON_POINTER(json_cpuThreshold, "cpu-threshold", BVIEW_STATUS_INVALID_JSON);
         JSON_VALIDATE_JSON_AS_NUMBER(json_cpuThreshold, "cpu-threshold");
         /* Copy the value */
-        command.cpuThreshold = json_cpuThreshold->valueint;
+        pCommand->cpuThreshold = json_cpuThreshold->valueint;
     } /* if optional */
 
 
@@ -330,18 +372,8 @@ BVIEW_STATUS bstjson_configure_bst_thresholds (void *cookie, char *jsonBuffer, i
         JSON_VALIDATE_JSON_POINTER(json_rqeThreshold, "rqe-threshold", BVIEW_STATUS_INVALID_JSON);
         JSON_VALIDATE_JSON_AS_NUMBER(json_rqeThreshold, "rqe-threshold");
         /* Copy the value */
-        command.rqeThreshold = json_rqeThreshold->valueint;
+        pCommand->rqeThreshold = json_rqeThreshold->valueint;
     } /* if optional */
 
-
-    /* Send the 'command' along with 'asicId' and 'cookie' to the Application thread. */
-    status = bstjson_configure_bst_thresholds_impl (cookie, asicId, id, &command);
-
-    /* Free up any allocated resources and return status code */
-    if (root != NULL)
-    {
-        cJSON_Delete(root);
-    }
-
-    return status;
+    return BVIEW_STATUS_SUCCESS;
 }
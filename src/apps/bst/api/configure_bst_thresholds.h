@@ -61,6 +61,7 @@ typedef struct _bstjson_configure_bst_thresholds_
 /* Function Prototypes */
 BVIEW_STATUS bstjson_configure_bst_thresholds(void *cookie, char *jsonBuffer, int bufLength);
 BVIEW_STATUS bstjson_configure_bst_thresholds_impl(void *cookie, int asicId, int id, BSTJSON_CONFIGURE_BST_THRESHOLDS_t *pCommand);
+BVIEW_STATUS bstjson_configure_bst_thresholds_params_parse(cJSON *params, BSTJSON_CONFIGURE_BST_THRESHOLDS_t *pCommand);
 
 
 #ifdef	__cplusplus  
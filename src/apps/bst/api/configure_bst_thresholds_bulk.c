@@ -0,0 +1,173 @@
+/*****************************************************************************
+  *
+  * (C) Copyright Broadcom Corporation 2015
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License");
+  * you may not use this file except in compliance with the License.
+  *
+  * You may obtain a copy of the License at
+  * http://www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ***************************************************************************/
+
+/* Include Header files */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "broadview.h"
+#include "json.h"
+
+#include "cJSON.h"
+#include "configure_bst_thresholds_bulk.h"
+
+/******************************************************************
+ * @brief  REST API Handler
+ *
+ * @param[in]    cookie     Context for the API from Web server
+ * @param[in]    jsonBuffer Raw Json Buffer
+ * @param[in]    bufLength  Json Buffer length (bytes)
+ *
+ * @retval   BVIEW_STATUS_SUCCESS  JSON Parsed and parameters passed to BST APP
+ * @retval   BVIEW_STATUS_INVALID_JSON  JSON is malformatted, or doesn't
+ * 					have necessary data.
+ * @retval   BVIEW_STATUS_INVALID_PARAMETER Invalid input parameter
+ * @retval   BVIEW_STATUS_OUTOFMEMORY  No memory for the thresholds
+ *
+ * @note     Every element of 'thresholds' carries the same parameters
+ *           as a configure-bst-thresholds request.
+ *           See the _impl() function for info passing to BST APP
+ *********************************************************************/
+BVIEW_STATUS bstjson_configure_bst_thresholds_bulk (void *cookie, char *jsonBuffer, int bufLength)
+{
+
+    /* Local Variables for JSON Parsing */
+    cJSON *json_jsonrpc, *json_method, *json_asicId;
+    cJSON *json_id, *json_thresholds, *json_entry;
+    cJSON  *root, *params;
+
+    /* Local non-command-parameter JSON variable declarations */
+    char jsonrpc[JSON_MAX_NODE_LENGTH] = {0};
+    char method[JSON_MAX_NODE_LENGTH] = {0};
+    int asicId = 0, id = 0, index = 0;
+
+    /* Local variable declarations */
+    BVIEW_STATUS status = BVIEW_STATUS_SUCCESS;
+    BSTJSON_CONFIGURE_BST_THRESHOLDS_BULK_t command;
+
+    memset(&command, 0, sizeof (command));
+
+    /* Validating input parameters */
+
+    /* Validating 'cookie' */
+    JSON_VALIDATE_POINTER(cookie, "cookie", BVIEW_STATUS_INVALID_PARAMETER);
+
+    /* Validating 'jsonBuffer' */
+    JSON_VALIDATE_POINTER(jsonBuffer, "jsonBuffer", BVIEW_STATUS_INVALID_PARAMETER);
+
+    /* Validating 'bufLength' */
+    if (bufLength > strlen(jsonBuffer))
+    {
+        _jsonlog("Invalid value for parameter bufLength %d ", bufLength );
+        return BVIEW_STATUS_INVALID_PARAMETER;
+    }
+
+    /* Parse JSON to a C-JSON root */
+    root = cJSON_Parse(jsonBuffer);
+    JSON_VALIDATE_JSON_POINTER(root, "root", BVIEW_STATUS_INVALID_JSON);
+
+    /* Obtain command parameters */
+    params = cJSON_GetObjectItem(root, "params");
+    JSON_VALIDATE_JSON_POINTER_AND_CLEANUP(params, "params", BVIEW_STATUS_INVALID_JSON);
+
+    /* Parsing and Validating 'jsonrpc' from JSON buffer */
+    json_jsonrpc = cJSON_GetObjectItem(root, "jsonrpc");
+    JSON_VALIDATE_JSON_POINTER_AND_CLEANUP(json_jsonrpc, "jsonrpc", BVIEW_STATUS_INVALID_JSON);
+    JSON_VALIDATE_JSON_AS_STRING(json_jsonrpc, "jsonrpc", BVIEW_STATUS_INVALID_JSON);
+    /* Copy the string, with a limit on max characters */
+    strncpy (&jsonrpc[0], json_jsonrpc->valuestring, JSON_MAX_NODE_LENGTH - 1);
+    /* Ensure that 'jsonrpc' in the JSON equals "2.0" */
+    JSON_COMPARE_STRINGS_AND_CLEANUP ("jsonrpc", &jsonrpc[0], "2.0");
+
+
+    /* Parsing and Validating 'method' from JSON buffer */
+    json_method = cJSON_GetObjectItem(root, "method");
+    JSON_VALIDATE_JSON_POINTER_AND_CLEANUP(json_method, "method", BVIEW_STATUS_INVALID_JSON);
+    JSON_VALIDATE_JSON_AS_STRING(json_method, "method", BVIEW_STATUS_INVALID_JSON);
+    /* Copy the string, with a limit on max characters */
+    strncpy (&method[0], json_method->valuestring, JSON_MAX_NODE_LENGTH - 1);
+    /* Ensure that 'method' in the JSON equals "configure-bst-thresholds-bulk" */
+    JSON_COMPARE_STRINGS_AND_CLEANUP ("method", &method[0], "configure-bst-thresholds-bulk");
+
+
+    /* Parsing and Validating 'asic-id' from JSON buffer */
+    json_asicId = cJSON_GetObjectItem(root, "asic-id");
+    JSON_VALIDATE_JSON_POINTER_AND_CLEANUP(json_asicId, "asic-id", BVIEW_STATUS_INVALID_JSON);
+    JSON_VALIDATE_JSON_AS_STRING(json_asicId, "asic-id", BVIEW_STATUS_INVALID_JSON);
+    /* Copy the 'asic-id' in external notation to our internal representation */
+    JSON_ASIC_ID_MAP_FROM_NOTATION(asicId, json_asicId->valuestring);
+
+
+    /* Parsing and Validating 'id' from JSON buffer */
+    json_id = cJSON_GetObjectItem(root, "id");
+    JSON_VALIDATE_JSON_POINTER_AND_CLEANUP(json_id, "id", BVIEW_STATUS_INVALID_JSON);
+    JSON_VALIDATE_JSON_AS_NUMBER(json_id, "id");
+    /* Copy the value */
+    id = json_id->valueint;
+    /* Ensure  that the number 'id' is within range of [1,100000] */
+    JSON_CHECK_VALUE_AND_CLEANUP (id, 1, 100000);
+
+
+    /* Parsing and Validating 'thresholds' from JSON buffer */
+    json_thresholds = cJSON_GetObjectItem(params, "thresholds");
+    JSON_VALIDATE_JSON_POINTER_AND_CLEANUP(json_thresholds, "thresholds", BVIEW_STATUS_INVALID_JSON);
+    if (json_thresholds->type != cJSON_Array)
+    {
+        _jsonlog("Error parsing JSON, %s not an array ", "thresholds");
+        cJSON_Delete(root);
+        return BVIEW_STATUS_INVALID_JSON;
+    }
+    command.numThresholds = cJSON_GetArraySize(json_thresholds);
+    /* Ensure  that the number of 'thresholds' is within range of [1,BSTJSON_MAX_BULK_THRESHOLDS] */
+    JSON_CHECK_VALUE_AND_CLEANUP (command.numThresholds, 1, BSTJSON_MAX_BULK_THRESHOLDS);
+
+    command.thresholds = calloc(command.numThresholds, sizeof (BSTJSON_CONFIGURE_BST_THRESHOLDS_t));
+    if (command.thresholds == NULL)
+    {
+        cJSON_Delete(root);
+        return BVIEW_STATUS_OUTOFMEMORY;
+    }
+
+    /* every element carries the parameters of a configure-bst-thresholds */
+    for (index = 0; index < command.numThresholds; index++)
+    {
+        json_entry = cJSON_GetArrayItem(json_thresholds, index);
+        status = bstjson_configure_bst_thresholds_params_parse(json_entry, &command.thresholds[index]);
+        if (status != BVIEW_STATUS_SUCCESS)
+        {
+            _jsonlog("Error parsing JSON, threshold %d of the bulk is invalid ", index);
+            free(command.thresholds);
+            cJSON_Delete(root);
+            return status;
+        }
+    }
+
+
+    /* Send the 'command' along with 'asicId' and 'cookie' to the Application thread. */
+    status = bstjson_configure_bst_thresholds_bulk_impl (cookie, asicId, id, &command);
+
+    /* Free up any allocated resources and return status code */
+    free(command.thresholds);
+    if (root != NULL)
+    {
+        cJSON_Delete(root);
+    }
+
+    return status;
+}
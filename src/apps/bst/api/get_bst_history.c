@@ -0,0 +1,244 @@
+/*****************************************************************************
+  *
+  * (C) Copyright Broadcom Corporation 2015
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License");
+  * you may not use this file except in compliance with the License.
+  *
+  * You may obtain a copy of the License at
+  * http://www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ***************************************************************************/
+
+/* Include Header files */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "broadview.h"
+#include "json.h"
+
+#include "cJSON.h"
+#include "get_bst_history.h"
+
+/* Optional realm selectors of the request, in the order of the
+   fields of BSTJSON_GET_BST_REPORT_t */
+static const char *bstjson_history_realm_params[] = {
+    "include-ingress-port-priority-group",
+    "include-ingress-port-service-pool",
+    "include-ingress-service-pool",
+    "include-egress-port-service-pool",
+    "include-egress-service-pool",
+    "include-egress-uc-queue",
+    "include-egress-uc-queue-group",
+    "include-egress-mc-queue",
+    "include-egress-cpu-queue",
+    "include-egress-rqe-queue",
+    "include-device"
+};
+
+/******************************************************************
+ * @brief  REST API Handler
+ *
+ * @param[in]    cookie     Context for the API from Web server
+ * @param[in]    jsonBuffer Raw Json Buffer
+ * @param[in]    bufLength  Json Buffer length (bytes)
+ *                           
+ * @retval   BVIEW_STATUS_SUCCESS  JSON Parsed and parameters passed to BST APP
+ * @retval   BVIEW_STATUS_INVALID_JSON  JSON is malformatted, or doesn't 
+ * 					have necessary data.
+ * @retval   BVIEW_STATUS_INVALID_PARAMETER Invalid input parameter
+ *
+ * @note     All the params are optional. The realms default to all of
+ *           them and the ranges to the whole history.
+ *           See the _impl() function for info passing to BST APP
+ *********************************************************************/
+BVIEW_STATUS bstjson_get_bst_history (void *cookie, char *jsonBuffer, int bufLength)
+{
+
+    /* Local Variables for JSON Parsing */
+    cJSON *json_jsonrpc, *json_method, *json_asicId;
+    cJSON *json_id, *json_include;
+    cJSON *json_startSequenceNumber, *json_endSequenceNumber;
+    cJSON *json_startTime, *json_endTime, *json_maxEntries;
+    cJSON  *root, *params;
+
+    /* Local non-command-parameter JSON variable declarations */
+    char jsonrpc[JSON_MAX_NODE_LENGTH] = {0};
+    char method[JSON_MAX_NODE_LENGTH] = {0};
+    int asicId = 0, id = 0;
+    unsigned int index = 0;
+    int *include;
+
+    /* Local variable declarations */
+    BVIEW_STATUS status = BVIEW_STATUS_SUCCESS;
+    BSTJSON_GET_BST_HISTORY_t command;
+
+    memset(&command, 0, sizeof (command));
+    command.startSequenceNumber = -1;
+    command.endSequenceNumber = -1;
+    command.startTime = -1;
+    command.endTime = -1;
+
+    /* Validating input parameters */
+
+    /* Validating 'cookie' */
+    JSON_VALIDATE_POINTER(cookie, "cookie", BVIEW_STATUS_INVALID_PARAMETER);
+
+    /* Validating 'jsonBuffer' */
+    JSON_VALIDATE_POINTER(jsonBuffer, "jsonBuffer", BVIEW_STATUS_INVALID_PARAMETER);
+
+    /* Validating 'bufLength' */
+    if (bufLength > strlen(jsonBuffer))
+    {
+        _jsonlog("Invalid value for parameter bufLength %d ", bufLength );
+        return BVIEW_STATUS_INVALID_PARAMETER;
+    }
+
+    /* Parse JSON to a C-JSON root */
+    root = cJSON_Parse(jsonBuffer);
+    JSON_VALIDATE_JSON_POINTER(root, "root", BVIEW_STATUS_INVALID_JSON);
+
+    /* Obtain command parameters */
+    params = cJSON_GetObjectItem(root, "params");
+    JSON_VALIDATE_JSON_POINTER(params, "params", BVIEW_STATUS_INVALID_JSON);
+
+    /* Parsing and Validating 'jsonrpc' from JSON buffer */
+    json_jsonrpc = cJSON_GetObjectItem(root, "jsonrpc");
+    JSON_VALIDATE_JSON_POINTER(json_jsonrpc, "jsonrpc", BVIEW_STATUS_INVALID_JSON);
+    JSON_VALIDATE_JSON_AS_STRING(json_jsonrpc, "jsonrpc", BVIEW_STATUS_INVALID_JSON);
+    /* Copy the string, with a limit on max characters */
+    strncpy (&jsonrpc[0], json_jsonrpc->valuestring, JSON_MAX_NODE_LENGTH - 1);
+    /* Ensure that 'jsonrpc' in the JSON equals "2.0" */
+    JSON_COMPARE_STRINGS_AND_CLEANUP ("jsonrpc", &jsonrpc[0], "2.0");
+
+
+    /* Parsing and Validating 'method' from JSON buffer */
+    json_method = cJSON_GetObjectItem(root, "method");
+    JSON_VALIDATE_JSON_POINTER(json_method, "method", BVIEW_STATUS_INVALID_JSON);
+    JSON_VALIDATE_JSON_AS_STRING(json_method, "method", BVIEW_STATUS_INVALID_JSON);
+    /* Copy the string, with a limit on max characters */
+    strncpy (&method[0], json_method->valuestring, JSON_MAX_NODE_LENGTH - 1);
+    /* Ensure that 'method' in the JSON equals "get-bst-history" */
+    JSON_COMPARE_STRINGS_AND_CLEANUP ("method", &method[0], "get-bst-history");
+
+
+    /* Parsing and Validating 'asic-id' from JSON buffer */
+    json_asicId = cJSON_GetObjectItem(root, "asic-id");
+    JSON_VALIDATE_JSON_POINTER(json_asicId, "asic-id", BVIEW_STATUS_INVALID_JSON);
+    JSON_VALIDATE_JSON_AS_STRING(json_asicId, "asic-id", BVIEW_STATUS_INVALID_JSON);
+    /* Copy the 'asic-id' in external notation to our internal representation */
+    JSON_ASIC_ID_MAP_FROM_NOTATION(asicId, json_asicId->valuestring);
+
+
+    /* Parsing and Validating 'id' from JSON buffer */
+    json_id = cJSON_GetObjectItem(root, "id");
+    JSON_VALIDATE_JSON_POINTER(json_id, "id", BVIEW_STATUS_INVALID_JSON);
+    JSON_VALIDATE_JSON_AS_NUMBER(json_id, "id");
+    /* Copy the value */
+    id = json_id->valueint;
+    /* Ensure  that the number 'id' is within range of [1,100000] */
+    JSON_CHECK_VALUE_AND_CLEANUP (id, 1, 100000);
+
+
+    /* Parsing and Validating the 'include-*' realm selectors from JSON buffer.
+       The nodes are optional ones, the realm is reported if not present in JSON */
+    include = &command.report.includeIngressPortPriorityGroup;
+    for (index = 0; index < (sizeof (bstjson_history_realm_params) / sizeof (bstjson_history_realm_params[0])); index++)
+    {
+        include[index] = 1;
+        json_include = cJSON_GetObjectItem(params, bstjson_history_realm_params[index]);
+        if (json_include != NULL)
+        {
+            JSON_VALIDATE_JSON_AS_NUMBER(json_include, bstjson_history_realm_params[index]);
+            /* Copy the value */
+            include[index] = json_include->valueint;
+            /* Ensure  that the number is within range of [0,1] */
+            JSON_CHECK_VALUE_AND_CLEANUP (include[index], 0, 1);
+        }
+    }
+
+
+    /* Parsing and Validating 'start-sequence-number' from JSON buffer */
+    json_startSequenceNumber = cJSON_GetObjectItem(params, "start-sequence-number");
+    /* The node 'start-sequence-number' is an optioanl one, ignore if not present in JSON */
+    if (json_startSequenceNumber != NULL)
+    {
+        JSON_VALIDATE_JSON_AS_NUMBER(json_startSequenceNumber, "start-sequence-number");
+        /* Copy the value, sequence numbers do not fit in an int */
+        command.startSequenceNumber = (int64_t) json_startSequenceNumber->valuedouble;
+        /* Ensure  that the number 'start-sequence-number' is not negative */
+        JSON_CHECK_VALUE_AND_CLEANUP ((command.startSequenceNumber < 0) ? -1 : 0, 0, 0);
+    } /* if optional */
+
+
+    /* Parsing and Validating 'end-sequence-number' from JSON buffer */
+    json_endSequenceNumber = cJSON_GetObjectItem(params, "end-sequence-number");
+    /* The node 'end-sequence-number' is an optioanl one, ignore if not present in JSON */
+    if (json_endSequenceNumber != NULL)
+    {
+        JSON_VALIDATE_JSON_AS_NUMBER(json_endSequenceNumber, "end-sequence-number");
+        /* Copy the value, sequence numbers do not fit in an int */
+        command.endSequenceNumber = (int64_t) json_endSequenceNumber->valuedouble;
+        /* Ensure  that the number 'end-sequence-number' is not negative */
+        JSON_CHECK_VALUE_AND_CLEANUP ((command.endSequenceNumber < 0) ? -1 : 0, 0, 0);
+    } /* if optional */
+
+
+    /* Parsing and Validating 'start-time' from JSON buffer */
+    json_startTime = cJSON_GetObjectItem(params, "start-time");
+    /* The node 'start-time' is an optioanl one, ignore if not present in JSON */
+    if (json_startTime != NULL)
+    {
+        JSON_VALIDATE_JSON_AS_NUMBER(json_startTime, "start-time");
+        /* Copy the value, seconds since the epoch with a fraction */
+        command.startTime = json_startTime->valuedouble;
+        /* Ensure  that the number 'start-time' is not negative */
+        JSON_CHECK_VALUE_AND_CLEANUP ((command.startTime < 0) ? -1 : 0, 0, 0);
+    } /* if optional */
+
+
+    /* Parsing and Validating 'end-time' from JSON buffer */
+    json_endTime = cJSON_GetObjectItem(params, "end-time");
+    /* The node 'end-time' is an optioanl one, ignore if not present in JSON */
+    if (json_endTime != NULL)
+    {
+        JSON_VALIDATE_JSON_AS_NUMBER(json_endTime, "end-time");
+        /* Copy the value, seconds since the epoch with a fraction */
+        command.endTime = json_endTime->valuedouble;
+        /* Ensure  that the number 'end-time' is not negative */
+        JSON_CHECK_VALUE_AND_CLEANUP ((command.endTime < 0) ? -1 : 0, 0, 0);
+    } /* if optional */
+
+
+    /* Parsing and Validating 'max-entries' from JSON buffer */
+    json_maxEntries = cJSON_GetObjectItem(params, "max-entries");
+    /* The node 'max-entries' is an optioanl one, ignore if not present in JSON */
+    if (json_maxEntries != NULL)
+    {
+        JSON_VALIDATE_JSON_AS_NUMBER(json_maxEntries, "max-entries");
+        /* Copy the value */
+        command.maxEntries = json_maxEntries->valueint;
+        /* Ensure  that the number 'max-entries' is within range of [0,100000] */
+        JSON_CHECK_VALUE_AND_CLEANUP (command.maxEntries, 0, 100000);
+    } /* if optional */
+
+
+    /* Send the 'command' along with 'asicId' and 'cookie' to the Application thread. */
+    status = bstjson_get_bst_history_impl (cookie, asicId, id, &command);
+
+    /* Free up any allocated resources and return status code */
+    if (root != NULL)
+    {
+        cJSON_Delete(root);
+    }
+
+    return status;
+}
+
@@ -0,0 +1,76 @@
+/*****************************************************************************
+  *
+  * (C) Copyright Broadcom Corporation 2015
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License");
+  * you may not use this file except in compliance with the License.
+  *
+  * You may obtain a copy of the License at
+  * http://www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ***************************************************************************/
+#ifndef INCLUDE_GET_BST_STATISTICS_H 
+#define	INCLUDE_GET_BST_STATISTICS_H  
+
+#ifdef	__cplusplus  
+extern "C"
+{
+#endif  
+
+
+/* Include Header files */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "broadview.h"
+#include "asic.h"
+#include "json.h"
+
+#include "cJSON.h"
+
+/* ports of a request, at most */
+#define BSTJSON_MAX_STATISTICS_PORTS        BVIEW_ASIC_MAX_PORTS
+/* percentiles of a request, at most. With the max they are reported
+   for every counter of an entry */
+#define BSTJSON_MAX_STATISTICS_PERCENTILES  3
+
+/* Structure to pass API parameters to the BST APP */
+typedef struct _bstjson_get_bst_statistics_
+{
+    /* realm of the entries, all of them if not present in the request */
+    char realm[JSON_MAX_NODE_LENGTH];
+    /* ports of the entries, any port if not present in the request */
+    int numPorts;
+    int ports[BSTJSON_MAX_STATISTICS_PORTS];
+    /* range of the priority group, service pool or queue of the
+       entries, -1 if not present in the request */
+    int minQueue;
+    int maxQueue;
+    /* lowest max of an entry in the window, in the units of the reports */
+    int64_t minOccupancy;
+    /* optional window in seconds, 0 for all the slices kept */
+    int windowSec;
+    /* percentiles of every counter, 50, 90 and 99 if not present
+       in the request */
+    int numPercentiles;
+    double percentiles[BSTJSON_MAX_STATISTICS_PERCENTILES];
+} BSTJSON_GET_BST_STATISTICS_t;
+
+
+/* Function Prototypes */
+BVIEW_STATUS bstjson_get_bst_statistics(void *cookie, char *jsonBuffer, int bufLength);
+BVIEW_STATUS bstjson_get_bst_statistics_impl(void *cookie, int asicId, int id, BSTJSON_GET_BST_STATISTICS_t *pCommand);
+
+
+#ifdef	__cplusplus  
+}
+#endif  
+
+#endif /* INCLUDE_GET_BST_STATISTICS_H */
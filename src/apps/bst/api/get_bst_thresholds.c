@@ -50,6 +50,7 @@ BVIEW_STATUS bstjson_get_bst_thresholds (void *cookie, char *jsonBuffer, int buf
     cJSON *json_includeIngressServicePool, *json_includeEgressPortServicePool, *json_includeEgressServicePool;
     cJSON *json_includeEgressUcQueue, *json_includeEgressUcQueueGroup, *json_includeEgressMcQueue;
     cJSON *json_includeEgressCpuQueue, *json_includeEgressRqeQueue, *json_includeDevice;
+    cJSON *json_verifyHardware;
     cJSON  *root, *params;
 
     /* Local non-command-parameter JSON variable declarations */
@@ -234,6 +235,19 @@ BVIEW_STATUS bstjson_get_bst_thresholds (void *cookie, char *jsonBuffer, int buf
     JSON_CHECK_VALUE_AND_CLEANUP (command.includeDevice, 0, 1);
 
 
+    /* Parsing and Validating 'verify-hardware' from JSON buffer */
+    json_verifyHardware = cJSON_GetObjectItem(params, "verify-hardware");
+    /* The node 'verify-hardware' is an optioanl one, ignore if not present in JSON */
+    if (json_verifyHardware != NULL)
+    {
+      JSON_VALIDATE_JSON_AS_NUMBER(json_verifyHardware, "verify-hardware");
+      /* Copy the value */
+      command.verifyHardware = json_verifyHardware->valueint;
+      /* Ensure  that the number 'verify-hardware' is within range of [0,1] */
+      JSON_CHECK_VALUE_AND_CLEANUP (command.verifyHardware, 0, 1);
+    }
+
+
     /* Send the 'command' along with 'asicId' and 'cookie' to the Application thread. */
     status = bstjson_get_bst_thresholds_impl (cookie, asicId, id, &command);
 
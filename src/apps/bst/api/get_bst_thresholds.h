@@ -49,6 +49,7 @@ typedef struct _bstjson_get_bst_thresholds_
     int includeEgressCpuQueue;
     int includeEgressRqeQueue;
     int includeDevice;
+    int verifyHardware;
 } BSTJSON_GET_BST_THRESHOLDS_t;
 
 
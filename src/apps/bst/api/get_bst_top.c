@@ -0,0 +1,189 @@
+/*****************************************************************************
+  *
+  * (C) Copyright Broadcom Corporation 2015
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License");
+  * you may not use this file except in compliance with the License.
+  *
+  * You may obtain a copy of the License at
+  * http://www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ***************************************************************************/
+
+/* Include Header files */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "broadview.h"
+#include "json.h"
+
+#include "cJSON.h"
+#include "get_bst_top.h"
+
+/******************************************************************
+ * @brief  REST API Handler
+ *
+ * @param[in]    cookie     Context for the API from Web server
+ * @param[in]    jsonBuffer Raw Json Buffer
+ * @param[in]    bufLength  Json Buffer length (bytes)
+ *                           
+ * @retval   BVIEW_STATUS_SUCCESS  JSON Parsed and parameters passed to BST APP
+ * @retval   BVIEW_STATUS_INVALID_JSON  JSON is malformatted, or doesn't 
+ * 					have necessary data.
+ * @retval   BVIEW_STATUS_INVALID_PARAMETER Invalid input parameter
+ *
+ * @note     All the params are optional. The realm defaults to all of
+ *           them, the count to 10 entries of all the realms together
+ *           and the window to the record collected last.
+ *           See the _impl() function for info passing to BST APP
+ *********************************************************************/
+BVIEW_STATUS bstjson_get_bst_top (void *cookie, char *jsonBuffer, int bufLength)
+{
+
+    /* Local Variables for JSON Parsing */
+    cJSON *json_jsonrpc, *json_method, *json_asicId;
+    cJSON *json_id, *json_realm, *json_count, *json_perRealm;
+    cJSON *json_windowSec;
+    cJSON  *root, *params;
+
+    /* Local non-command-parameter JSON variable declarations */
+    char jsonrpc[JSON_MAX_NODE_LENGTH] = {0};
+    char method[JSON_MAX_NODE_LENGTH] = {0};
+    int asicId = 0, id = 0;
+
+    /* Local variable declarations */
+    BVIEW_STATUS status = BVIEW_STATUS_SUCCESS;
+    BSTJSON_GET_BST_TOP_t command;
+
+    memset(&command, 0, sizeof (command));
+    command.count = 10;
+
+    /* Validating input parameters */
+
+    /* Validating 'cookie' */
+    JSON_VALIDATE_POINTER(cookie, "cookie", BVIEW_STATUS_INVALID_PARAMETER);
+
+    /* Validating 'jsonBuffer' */
+    JSON_VALIDATE_POINTER(jsonBuffer, "jsonBuffer", BVIEW_STATUS_INVALID_PARAMETER);
+
+    /* Validating 'bufLength' */
+    if (bufLength > strlen(jsonBuffer))
+    {
+        _jsonlog("Invalid value for parameter bufLength %d ", bufLength );
+        return BVIEW_STATUS_INVALID_PARAMETER;
+    }
+
+    /* Parse JSON to a C-JSON root */
+    root = cJSON_Parse(jsonBuffer);
+    JSON_VALIDATE_JSON_POINTER(root, "root", BVIEW_STATUS_INVALID_JSON);
+
+    /* Obtain command parameters */
+    params = cJSON_GetObjectItem(root, "params");
+    JSON_VALIDATE_JSON_POINTER(params, "params", BVIEW_STATUS_INVALID_JSON);
+
+    /* Parsing and Validating 'jsonrpc' from JSON buffer */
+    json_jsonrpc = cJSON_GetObjectItem(root, "jsonrpc");
+    JSON_VALIDATE_JSON_POINTER(json_jsonrpc, "jsonrpc", BVIEW_STATUS_INVALID_JSON);
+    JSON_VALIDATE_JSON_AS_STRING(json_jsonrpc, "jsonrpc", BVIEW_STATUS_INVALID_JSON);
+    /* Copy the string, with a limit on max characters */
+    strncpy (&jsonrpc[0], json_jsonrpc->valuestring, JSON_MAX_NODE_LENGTH - 1);
+    /* Ensure that 'jsonrpc' in the JSON equals "2.0" */
+    JSON_COMPARE_STRINGS_AND_CLEANUP ("jsonrpc", &jsonrpc[0], "2.0");
+
+
+    /* Parsing and Validating 'method' from JSON buffer */
+    json_method = cJSON_GetObjectItem(root, "method");
+    JSON_VALIDATE_JSON_POINTER(json_method, "method", BVIEW_STATUS_INVALID_JSON);
+    JSON_VALIDATE_JSON_AS_STRING(json_method, "method", BVIEW_STATUS_INVALID_JSON);
+    /* Copy the string, with a limit on max characters */
+    strncpy (&method[0], json_method->valuestring, JSON_MAX_NODE_LENGTH - 1);
+    /* Ensure that 'method' in the JSON equals "get-bst-top" */
+    JSON_COMPARE_STRINGS_AND_CLEANUP ("method", &method[0], "get-bst-top");
+
+
+    /* Parsing and Validating 'asic-id' from JSON buffer */
+    json_asicId = cJSON_GetObjectItem(root, "asic-id");
+    JSON_VALIDATE_JSON_POINTER(json_asicId, "asic-id", BVIEW_STATUS_INVALID_JSON);
+    JSON_VALIDATE_JSON_AS_STRING(json_asicId, "asic-id", BVIEW_STATUS_INVALID_JSON);
+    /* Copy the 'asic-id' in external notation to our internal representation */
+    JSON_ASIC_ID_MAP_FROM_NOTATION(asicId, json_asicId->valuestring);
+
+
+    /* Parsing and Validating 'id' from JSON buffer */
+    json_id = cJSON_GetObjectItem(root, "id");
+    JSON_VALIDATE_JSON_POINTER(json_id, "id", BVIEW_STATUS_INVALID_JSON);
+    JSON_VALIDATE_JSON_AS_NUMBER(json_id, "id");
+    /* Copy the value */
+    id = json_id->valueint;
+    /* Ensure  that the number 'id' is within range of [1,100000] */
+    JSON_CHECK_VALUE_AND_CLEANUP (id, 1, 100000);
+
+
+    /* Parsing and Validating 'realm' from JSON buffer */
+    json_realm = cJSON_GetObjectItem(params, "realm");
+    /* The node 'realm' is an optioanl one, ignore if not present in JSON */
+    if (json_realm != NULL)
+    {
+        JSON_VALIDATE_JSON_AS_STRING(json_realm, "realm", BVIEW_STATUS_INVALID_JSON);
+        /* Copy the string, with a limit on max characters */
+        strncpy (&command.realm[0], json_realm->valuestring, JSON_MAX_NODE_LENGTH - 1);
+    } /* if optional */
+
+
+    /* Parsing and Validating 'count' from JSON buffer */
+    json_count = cJSON_GetObjectItem(params, "count");
+    /* The node 'count' is an optioanl one, ignore if not present in JSON */
+    if (json_count != NULL)
+    {
+        JSON_VALIDATE_JSON_AS_NUMBER(json_count, "count");
+        /* Copy the value */
+        command.count = json_count->valueint;
+        /* Ensure  that the number 'count' is within range of [1,BSTJSON_MAX_TOP_ENTRIES] */
+        JSON_CHECK_VALUE_AND_CLEANUP (command.count, 1, BSTJSON_MAX_TOP_ENTRIES);
+    } /* if optional */
+
+
+    /* Parsing and Validating 'per-realm' from JSON buffer */
+    json_perRealm = cJSON_GetObjectItem(params, "per-realm");
+    /* The node 'per-realm' is an optioanl one, ignore if not present in JSON */
+    if (json_perRealm != NULL)
+    {
+        JSON_VALIDATE_JSON_AS_NUMBER(json_perRealm, "per-realm");
+        /* Copy the value */
+        command.perRealm = json_perRealm->valueint;
+        /* Ensure  that the number 'per-realm' is within range of [0,1] */
+        JSON_CHECK_VALUE_AND_CLEANUP (command.perRealm, 0, 1);
+    } /* if optional */
+
+
+    /* Parsing and Validating 'window-sec' from JSON buffer */
+    json_windowSec = cJSON_GetObjectItem(params, "window-sec");
+    /* The node 'window-sec' is an optioanl one, ignore if not present in JSON */
+    if (json_windowSec != NULL)
+    {
+        JSON_VALIDATE_JSON_AS_NUMBER(json_windowSec, "window-sec");
+        /* Copy the value */
+        command.windowSec = json_windowSec->valueint;
+        /* Ensure  that the number 'window-sec' is within range of [0,604800] */
+        JSON_CHECK_VALUE_AND_CLEANUP (command.windowSec, 0, 604800);
+    } /* if optional */
+
+
+    /* Send the 'command' along with 'asicId' and 'cookie' to the Application thread. */
+    status = bstjson_get_bst_top_impl (cookie, asicId, id, &command);
+
+    /* Free up any allocated resources and return status code */
+    if (root != NULL)
+    {
+        cJSON_Delete(root);
+    }
+
+    return status;
+}
@@ -0,0 +1,64 @@
+/*****************************************************************************
+  *
+  * (C) Copyright Broadcom Corporation 2015
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License");
+  * you may not use this file except in compliance with the License.
+  *
+  * You may obtain a copy of the License at
+  * http://www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ***************************************************************************/
+#ifndef INCLUDE_GET_BST_TOP_H 
+#define	INCLUDE_GET_BST_TOP_H  
+
+#ifdef	__cplusplus  
+extern "C"
+{
+#endif  
+
+
+/* Include Header files */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "broadview.h"
+#include "asic.h"
+#include "json.h"
+
+#include "cJSON.h"
+
+/* entries of a realm, or of all the realms, a request returns at most */
+#define BSTJSON_MAX_TOP_ENTRIES        64
+
+/* Structure to pass API parameters to the BST APP */
+typedef struct _bstjson_get_bst_top_
+{
+    /* realm of the entries, all of them if not present in the request */
+    char realm[JSON_MAX_NODE_LENGTH];
+    /* entries to return, 10 if not present in the request */
+    int count;
+    /* count entries of every realm instead of all of them together */
+    int perRealm;
+    /* optional window in seconds, 0 for the record collected last */
+    int windowSec;
+} BSTJSON_GET_BST_TOP_t;
+
+
+/* Function Prototypes */
+BVIEW_STATUS bstjson_get_bst_top(void *cookie, char *jsonBuffer, int bufLength);
+BVIEW_STATUS bstjson_get_bst_top_impl(void *cookie, int asicId, int id, BSTJSON_GET_BST_TOP_t *pCommand);
+
+
+#ifdef	__cplusplus  
+}
+#endif  
+
+#endif /* INCLUDE_GET_BST_TOP_H */
@@ -0,0 +1,81 @@
+/*****************************************************************************
+  *
+  * (C) Copyright Broadcom Corporation 2015
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License");
+  * you may not use this file except in compliance with the License.
+  *
+  * You may obtain a copy of the License at
+  * http://www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ***************************************************************************/
+#ifndef INCLUDE_QUERY_BST_HISTORY_H 
+#define	INCLUDE_QUERY_BST_HISTORY_H  
+
+#ifdef	__cplusplus  
+extern "C"
+{
+#endif  
+
+
+/* Include Header files */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "broadview.h"
+#include "asic.h"
+#include "json.h"
+
+#include "cJSON.h"
+
+/* ports of a query, at most */
+#define BSTJSON_MAX_QUERY_PORTS     BVIEW_ASIC_MAX_PORTS
+
+/* Structure to pass API parameters to the BST APP */
+typedef struct _bstjson_query_bst_history_
+{
+    /* realm of the entries, all of them if not present in the request */
+    char realm[JSON_MAX_NODE_LENGTH];
+    /* ports of the entries, any port if not present in the request */
+    int numPorts;
+    int ports[BSTJSON_MAX_QUERY_PORTS];
+    /* range of the priority group, service pool or queue of the
+       entries, -1 if not present in the request */
+    int minQueue;
+    int maxQueue;
+    /* lowest occupancy of a match, in the units of the reports */
+    int64_t minOccupancy;
+    /* "none", "max", "avg" or "last" */
+    char aggregate[JSON_MAX_NODE_LENGTH];
+    /* optional sequence number to resume from, -1 if not present */
+    int64_t startSequenceNumber;
+    /* optional time range in seconds since the epoch, -1 if not
+       present in the request */
+    double startTime;
+    double endTime;
+    /* optional number of samples of the response, 0 is as many as fit */
+    int maxEntries;
+    /* optional resolution of the samples in seconds, 0 for the
+       samples as collected */
+    int resolutionSec;
+} BSTJSON_QUERY_BST_HISTORY_t;
+
+
+/* Function Prototypes */
+BVIEW_STATUS bstjson_query_bst_history(void *cookie, char *jsonBuffer, int bufLength);
+BVIEW_STATUS bstjson_query_bst_history_impl(void *cookie, int asicId, int id, BSTJSON_QUERY_BST_HISTORY_t *pCommand);
+
+
+#ifdef	__cplusplus  
+}
+#endif  
+
+#endif /* INCLUDE_QUERY_BST_HISTORY_H */ 
+
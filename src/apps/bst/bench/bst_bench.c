@@ -0,0 +1,525 @@
+/*****************************************************************************
+  *
+  * (C) Copyright Broadcom Corporation 2015
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License");
+  * you may not use this file except in compliance with the License.
+  *
+  * You may obtain a copy of the License at
+  * http://www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ***************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <inttypes.h>
+#include <pthread.h>
+#include "json.h"
+#include "clear_bst_statistics.h"
+#include "clear_bst_thresholds.h"
+#include "configure_bst_thresholds.h"
+#include "configure_bst_feature.h"
+#include "configure_bst_tracking.h"
+#include "get_bst_tracking.h"
+#include "get_bst_feature.h"
+#include "get_bst_thresholds.h"
+#include "get_bst_report.h"
+#include "bst_json_encoder.h"
+#include "bst.h"
+#include "broadview.h"
+#include "bst_app.h"
+
+/* diffs timed per kernel, unless given on the command line */
+#define BST_BENCH_DIFF_ITERATIONS   200
+/* samples of the stream of the codec, unless given on the command line */
+#define BST_BENCH_CODEC_SAMPLES     100
+/* records added to the history of the check, the ring wraps several
+   times */
+#define BST_BENCH_HISTORY_RECORDS   1000
+
+/* kernels timed, in the order they are reported */
+static const struct
+{
+  BVIEW_BST_DIFF_KERNEL_t type;
+  const char *name;
+} bst_bench_kernels[] = {
+  {BVIEW_BST_DIFF_KERNEL_SCALAR, "scalar"},
+  {BVIEW_BST_DIFF_KERNEL_SSE2, "sse2"},
+  {BVIEW_BST_DIFF_KERNEL_AVX2, "avx2"},
+  {BVIEW_BST_DIFF_KERNEL_AUTO, "in use"}
+};
+
+/*********************************************************************
+* @brief : sets the capabilities of the largest asic
+*
+* @param[out] asic : capabilities, at the BVIEW_ASIC_MAX_* limits
+*
+* @retval  : none
+*
+*********************************************************************/
+static void bst_bench_asic_get (BVIEW_ASIC_CAPABILITIES_t *asic)
+{
+  memset (asic, 0, sizeof (BVIEW_ASIC_CAPABILITIES_t));
+  asic->numPorts = BVIEW_ASIC_MAX_PORTS;
+  asic->numUnicastQueues = BVIEW_ASIC_MAX_UC_QUEUES;
+  asic->numUnicastQueueGroups = BVIEW_ASIC_MAX_UC_QUEUE_GROUPS;
+  asic->numMulticastQueues = BVIEW_ASIC_MAX_MC_QUEUES;
+  asic->numServicePools = BVIEW_ASIC_MAX_SERVICE_POOLS;
+  asic->numCommonPools = BVIEW_ASIC_MAX_COMMON_POOLS;
+  asic->numCpuQueues = BVIEW_ASIC_MAX_CPU_QUEUES;
+  asic->numRqeQueues = BVIEW_ASIC_MAX_RQE_QUEUES;
+  asic->numPriorityGroups = BVIEW_ASIC_MAX_PRIORITY_GROUPS;
+}
+
+/*********************************************************************
+* @brief : entries of two full size records to be reported, compared
+*          one counter at a time
+*
+* @param[in] previous : previous record
+* @param[in] current : record
+* @param[in] asic : capabilities of the asic
+*
+* @retval  : number of entries to be reported
+*
+* @note    : the compare of the encoders before the bitmaps, the
+*            baseline of the diff kernels.
+*
+*********************************************************************/
+static unsigned int bst_bench_full_compare (const BVIEW_BST_ASIC_SNAPSHOT_DATA_t *previous,
+                                           const BVIEW_BST_ASIC_SNAPSHOT_DATA_t *current,
+                                           const BVIEW_ASIC_CAPABILITIES_t *asic)
+{
+  unsigned int num = 0;
+  int port, index;
+
+  for (port = 0; port < asic->numPorts; port++)
+  {
+    for (index = 0; index < asic->numPriorityGroups; index++)
+    {
+      if ((current->iPortPg.data[port][index].umShareBufferCount == 0) &&
+          (current->iPortPg.data[port][index].umHeadroomBufferCount == 0))
+        continue;
+      if ((previous->iPortPg.data[port][index].umShareBufferCount ==
+           current->iPortPg.data[port][index].umShareBufferCount) &&
+          (previous->iPortPg.data[port][index].umHeadroomBufferCount ==
+           current->iPortPg.data[port][index].umHeadroomBufferCount))
+        continue;
+      num++;
+    }
+    for (index = 0; index < asic->numServicePools; index++)
+    {
+      if ((current->iPortSp.data[port][index].umShareBufferCount != 0) &&
+          (previous->iPortSp.data[port][index].umShareBufferCount !=
+           current->iPortSp.data[port][index].umShareBufferCount))
+        num++;
+      if ((current->ePortSp.data[port][index].ucShareBufferCount == 0) &&
+          (current->ePortSp.data[port][index].umShareBufferCount == 0) &&
+          (current->ePortSp.data[port][index].mcShareBufferCount == 0) &&
+          (current->ePortSp.data[port][index].mcShareQueueEntries == 0))
+        continue;
+      if ((previous->ePortSp.data[port][index].ucShareBufferCount ==
+           current->ePortSp.data[port][index].ucShareBufferCount) &&
+          (previous->ePortSp.data[port][index].umShareBufferCount ==
+           current->ePortSp.data[port][index].umShareBufferCount) &&
+          (previous->ePortSp.data[port][index].mcShareBufferCount ==
+           current->ePortSp.data[port][index].mcShareBufferCount) &&
+          (previous->ePortSp.data[port][index].mcShareQueueEntries ==
+           current->ePortSp.data[port][index].mcShareQueueEntries))
+        continue;
+      num++;
+    }
+  }
+  for (index = 0; index < asic->numServicePools; index++)
+  {
+    if ((current->iSp.data[index].umShareBufferCount != 0) &&
+        (previous->iSp.data[index].umShareBufferCount !=
+         current->iSp.data[index].umShareBufferCount))
+      num++;
+    if ((current->eSp.data[index].umShareBufferCount == 0) &&
+        (current->eSp.data[index].mcShareBufferCount == 0) &&
+        (current->eSp.data[index].mcShareQueueEntries == 0))
+      continue;
+    if ((previous->eSp.data[index].umShareBufferCount ==
+         current->eSp.data[index].umShareBufferCount) &&
+        (previous->eSp.data[index].mcShareBufferCount ==
+         current->eSp.data[index].mcShareBufferCount) &&
+        (previous->eSp.data[index].mcShareQueueEntries ==
+         current->eSp.data[index].mcShareQueueEntries))
+      continue;
+    num++;
+  }
+  for (index = 0; index < asic->numUnicastQueues; index++)
+  {
+    if ((current->eUcQ.data[index].ucBufferCount != 0) &&
+        (previous->eUcQ.data[index].ucBufferCount !=
+         current->eUcQ.data[index].ucBufferCount))
+      num++;
+  }
+  for (index = 0; index < asic->numUnicastQueueGroups; index++)
+  {
+    if ((current->eUcQg.data[index].ucBufferCount != 0) &&
+        (previous->eUcQg.data[index].ucBufferCount !=
+         current->eUcQg.data[index].ucBufferCount))
+      num++;
+  }
+  for (index = 0; index < asic->numMulticastQueues; index++)
+  {
+    if ((current->eMcQ.data[index].mcBufferCount == 0) &&
+        (current->eMcQ.data[index].mcQueueEntries == 0))
+      continue;
+    if ((previous->eMcQ.data[index].mcBufferCount ==
+         current->eMcQ.data[index].mcBufferCount) &&
+        (previous->eMcQ.data[index].mcQueueEntries ==
+         current->eMcQ.data[index].mcQueueEntries))
+      continue;
+    num++;
+  }
+  for (index = 0; index < asic->numCpuQueues; index++)
+  {
+    if ((current->cpqQ.data[index].cpuBufferCount == 0) &&
+        (current->cpqQ.data[index].cpuQueueEntries == 0))
+      continue;
+    if ((previous->cpqQ.data[index].cpuBufferCount ==
+         current->cpqQ.data[index].cpuBufferCount) &&
+        (previous->cpqQ.data[index].cpuQueueEntries ==
+         current->cpqQ.data[index].cpuQueueEntries))
+      continue;
+    num++;
+  }
+  for (index = 0; index < asic->numRqeQueues; index++)
+  {
+    if ((current->rqeQ.data[index].rqeBufferCount == 0) &&
+        (current->rqeQ.data[index].rqeQueueEntries == 0))
+      continue;
+    if ((previous->rqeQ.data[index].rqeBufferCount ==
+         current->rqeQ.data[index].rqeBufferCount) &&
+        (previous->rqeQ.data[index].rqeQueueEntries ==
+         current->rqeQ.data[index].rqeQueueEntries))
+      continue;
+    num++;
+  }
+  return num;
+}
+
+/*********************************************************************
+* @brief : pseudo random buffer count, a quarter of them non zero
+*
+* @param[in,out] seed : state of the sequence
+*
+* @retval  : buffer count
+*
+*********************************************************************/
+static uint32_t bst_bench_value (uint32_t *seed)
+{
+  *seed = (*seed * 1103515245) + 12345;
+  return (0 == ((*seed >> 16) & 0x3)) ? ((*seed >> 8) & 0x3FFF) : 0;
+}
+
+/*********************************************************************
+* @brief : times the diff of two records of the largest asic
+*
+* @param[in] iterations : diffs timed per kernel
+*
+* @retval  : BVIEW_STATUS_SUCCESS : kernels are timed.
+* @retval  : BVIEW_STATUS_FAILURE : a kernel set other bitmaps than
+*                                   the scalar one.
+* @retval  : BVIEW_STATUS_OUTOFMEMORY : no memory for the records.
+*
+* @note    : an eighth of the counters change between the records.
+*            The baseline compares two full size records one counter
+*            at a time, as the encoders did before the bitmaps.
+*
+*********************************************************************/
+static BVIEW_STATUS bst_bench_diff (unsigned int iterations)
+{
+  BVIEW_ASIC_CAPABILITIES_t asic;
+  BVIEW_BST_SNAPSHOT_LAYOUT_t layout;
+  BVIEW_BST_SNAPSHOT_DATA_t records[2];
+  BVIEW_BST_ASIC_SNAPSHOT_DATA_t *full = NULL;
+  uint32_t *block = NULL;
+  uint64_t *bitmaps = NULL, *expected = NULL;
+  BVIEW_HR_TIME_t start, end;
+  volatile unsigned int sink = 0;
+  unsigned int index, iter, kernel;
+  uint32_t seed = 1;
+  uint64_t *word;
+  size_t bitmapSize;
+  BVIEW_STATUS rv = BVIEW_STATUS_SUCCESS;
+
+  bst_bench_asic_get (&asic);
+  bst_snapshot_layout_init (&layout, &asic);
+  bitmapSize = 2 * (layout.numBitmapWords + 1) * sizeof (uint64_t);
+
+  full = (BVIEW_BST_ASIC_SNAPSHOT_DATA_t *) calloc (2, sizeof (BVIEW_BST_ASIC_SNAPSHOT_DATA_t));
+  block = (uint32_t *) calloc (2 * layout.numCounters, sizeof (uint32_t));
+  bitmaps = (uint64_t *) calloc (4 * (layout.numBitmapWords + 1), sizeof (uint64_t));
+  expected = (uint64_t *) malloc (bitmapSize);
+  if ((NULL == full) || (NULL == block) || (NULL == bitmaps) || (NULL == expected))
+  {
+    free (full);
+    free (block);
+    free (bitmaps);
+    free (expected);
+    return BVIEW_STATUS_OUTOFMEMORY;
+  }
+
+  for (index = 0; index < 2; index++)
+  {
+    records[index].layout = &layout;
+    records[index].counters = &block[index * layout.numCounters];
+    records[index].nonzero = &bitmaps[2 * index * (layout.numBitmapWords + 1)];
+    records[index].changed = records[index].nonzero + layout.numBitmapWords + 1;
+  }
+
+  /* counters of the entries of both layouts, padding stays zero */
+  for (index = 0; index < BVIEW_BST_NUM_COUNTERS; index++)
+  {
+    for (iter = 0; iter < layout.count[index]; iter++)
+    {
+      records[0].counters[layout.offset[index] + iter] = bst_bench_value (&seed);
+      records[1].counters[layout.offset[index] + iter] =
+        (0 == (iter % 8)) ? bst_bench_value (&seed) :
+                            records[0].counters[layout.offset[index] + iter];
+    }
+  }
+  for (word = (uint64_t *) &full[0];
+       word < (uint64_t *) &full[1]; word++)
+  {
+    *word = bst_bench_value (&seed);
+    word[sizeof (BVIEW_BST_ASIC_SNAPSHOT_DATA_t) / sizeof (uint64_t)] =
+      (0 == ((seed >> 16) % 8)) ? bst_bench_value (&seed) : *word;
+  }
+
+  printf ("bst diff of %u counters, average of %u runs\n",
+          layout.numCounters, iterations);
+
+  BVIEW_HR_TIME_GET (&start);
+  for (iter = 0; iter < iterations; iter++)
+  {
+    sink += bst_bench_full_compare (&full[0], &full[1], &asic);
+  }
+  BVIEW_HR_TIME_GET (&end);
+  printf ("  %-20s %10" PRIu64 " ns\n", "full size compare",
+          (end.monotonic - start.monotonic) / iterations);
+
+  /* the bitmaps of the scalar kernel are the reference */
+  bst_diff_kernel_compute (BVIEW_BST_DIFF_KERNEL_SCALAR, &records[1], &records[0]);
+  memcpy (expected, records[1].nonzero, bitmapSize);
+
+  for (kernel = 0; kernel < (sizeof (bst_bench_kernels) / sizeof (bst_bench_kernels[0])); kernel++)
+  {
+    if (BVIEW_STATUS_SUCCESS !=
+        bst_diff_kernel_compute (bst_bench_kernels[kernel].type, &records[1], &records[0]))
+    {
+      printf ("  %-20s %10s\n", bst_bench_kernels[kernel].name, "-");
+      continue;
+    }
+    if (0 != memcmp (expected, records[1].nonzero, bitmapSize))
+    {
+      printf ("  %-20s bitmaps differ from the scalar kernel\n",
+              bst_bench_kernels[kernel].name);
+      rv = BVIEW_STATUS_FAILURE;
+      continue;
+    }
+    BVIEW_HR_TIME_GET (&start);
+    for (iter = 0; iter < iterations; iter++)
+    {
+      bst_diff_kernel_compute (bst_bench_kernels[kernel].type, &records[1], &records[0]);
+      sink += records[1].changedRealms;
+    }
+    BVIEW_HR_TIME_GET (&end);
+    printf ("  %-20s %10" PRIu64 " ns\n", bst_bench_kernels[kernel].name,
+            (end.monotonic - start.monotonic) / iterations);
+  }
+  (void) sink;
+
+  free (full);
+  free (block);
+  free (bitmaps);
+  free (expected);
+  return rv;
+}
+
+/*********************************************************************
+* @brief : times the codec over a stream of the largest asic
+*
+* @param[in] numSamples : samples of the stream
+*
+* @retval  : BVIEW_STATUS_SUCCESS : codec is timed.
+* @retval  : BVIEW_STATUS_FAILURE : the stream did not decode back.
+* @retval  : BVIEW_STATUS_OUTOFMEMORY : no memory for the stream.
+*
+* @note    : samples are 100 ms apart with a jitter of a few micro
+*            seconds. A quarter of the counters are in use, an eighth
+*            of them move by a small step from one sample to the next.
+*
+*********************************************************************/
+static BVIEW_STATUS bst_bench_codec (unsigned int numSamples)
+{
+  BVIEW_ASIC_CAPABILITIES_t asic;
+  BVIEW_BST_SNAPSHOT_LAYOUT_t layout;
+  BVIEW_BST_CODEC_t codec;
+  BVIEW_BST_CODEC_ITER_t iter;
+  BVIEW_HR_TIME_t start, end;
+  uint32_t *samples = NULL, *state = NULL;
+  uint64_t *times = NULL;
+  uint8_t *buf = NULL;
+  size_t size;
+  unsigned int sample, index;
+  uint32_t seed = 1;
+  uint64_t realtimeNs;
+  unsigned int numEncoded;
+  uint64_t encodeNs, decodeNs, rawBytes, encodedBytes;
+  BVIEW_STATUS rv = BVIEW_STATUS_SUCCESS;
+
+  bst_bench_asic_get (&asic);
+  bst_snapshot_layout_init (&layout, &asic);
+
+  /* the raw stream, as kept without the codec */
+  size = (size_t) numSamples * layout.numCounters * sizeof (uint32_t);
+  samples = (uint32_t *) calloc ((size_t) numSamples * layout.numCounters, sizeof (uint32_t));
+  times = (uint64_t *) calloc (numSamples, sizeof (uint64_t));
+  state = (uint32_t *) calloc (layout.numCounters, sizeof (uint32_t));
+  buf = (uint8_t *) malloc (size);
+  if ((NULL == samples) || (NULL == times) || (NULL == state) || (NULL == buf))
+  {
+    free (samples);
+    free (times);
+    free (state);
+    free (buf);
+    return BVIEW_STATUS_OUTOFMEMORY;
+  }
+
+  realtimeNs = 1000000000ULL * 1500000000ULL;
+  for (sample = 0; sample < numSamples; sample++)
+  {
+    seed = (seed * 1103515245) + 12345;
+    realtimeNs += 100000000ULL + ((seed >> 16) % 20000);
+    times[sample] = realtimeNs;
+    for (index = 0; index < layout.numCounters; index++)
+    {
+      uint32_t *value = &samples[((size_t) sample * layout.numCounters) + index];
+
+      *value = (0 == sample) ? 0 : value[-(long) layout.numCounters];
+      seed = (seed * 1103515245) + 12345;
+      if ((0 == (index & 0x3)) && (0 == ((seed >> 16) & 0x7)))
+      {
+        *value += ((seed >> 8) & 0xFF);
+        *value -= (*value >= 0x80) ? 0x80 : 0;
+      }
+    }
+  }
+
+  bst_codec_init (&codec, state, layout.numCounters);
+  bst_codec_iter_init (&iter, &codec, buf, size);
+  BVIEW_HR_TIME_GET (&start);
+  for (sample = 0; sample < numSamples; sample++)
+  {
+    if (false == bst_codec_iter_put (&iter, times[sample],
+                                     &samples[(size_t) sample * layout.numCounters]))
+    {
+      break;
+    }
+  }
+  BVIEW_HR_TIME_GET (&end);
+  numEncoded = sample;
+  encodeNs = (end.monotonic - start.monotonic) / ((0 != sample) ? sample : 1);
+  encodedBytes = iter.pos;
+
+  bst_codec_init (&codec, state, layout.numCounters);
+  bst_codec_iter_init (&iter, &codec, buf, encodedBytes);
+  BVIEW_HR_TIME_GET (&start);
+  for (sample = 0; sample < numEncoded; sample++)
+  {
+    if ((false == bst_codec_iter_get (&iter, &realtimeNs)) ||
+        (realtimeNs != times[sample]) ||
+        (0 != memcmp (state, &samples[(size_t) sample * layout.numCounters],
+                      layout.numCounters * sizeof (uint32_t))))
+    {
+      rv = BVIEW_STATUS_FAILURE;
+      break;
+    }
+  }
+  BVIEW_HR_TIME_GET (&end);
+  decodeNs = (end.monotonic - start.monotonic) / ((0 != sample) ? sample : 1);
+  rawBytes = (uint64_t) numEncoded *
+             (layout.numCounters * sizeof (uint32_t) + sizeof (uint64_t));
+
+  printf ("bst codec of %u counters, %u samples\n", layout.numCounters, numEncoded);
+  if (BVIEW_STATUS_SUCCESS != rv)
+  {
+    printf ("  sample %u did not decode back\n", sample);
+  }
+  else if (0 != numEncoded)
+  {
+    printf ("  %-20s %10" PRIu64 " bytes/sample\n", "raw", rawBytes / numEncoded);
+    printf ("  %-20s %10" PRIu64 " bytes/sample\n", "encoded", encodedBytes / numEncoded);
+    printf ("  %-20s %10" PRIu64 " ns/sample\n", "encode", encodeNs);
+    printf ("  %-20s %10" PRIu64 " ns/sample\n", "decode", decodeNs);
+  }
+
+  free (samples);
+  free (times);
+  free (state);
+  free (buf);
+  return rv;
+}
+
+/*********************************************************************
+* @brief : times the bst diff kernels and the history codec, and
+*          checks the history
+*
+* @param[in] argc : number of arguments
+* @param[in] argv : optional number of runs of every bench
+*
+* @retval  : 0 if every bench ran and the check passed, 1 otherwise
+*
+* @note    : runs on the host only, no asic or agent is needed.
+*
+*********************************************************************/
+int main (int argc, char **argv)
+{
+  unsigned int iterations = BST_BENCH_DIFF_ITERATIONS;
+  unsigned int samples = BST_BENCH_CODEC_SAMPLES;
+  int failed = 0;
+
+  if (argc > 1)
+  {
+    iterations = (unsigned int) strtoul (argv[1], NULL, 0);
+    samples = iterations;
+    if (0 == iterations)
+    {
+      printf ("usage: %s [runs]\n", argv[0]);
+      return 1;
+    }
+  }
+
+  if (BVIEW_STATUS_SUCCESS != bst_bench_diff (iterations))
+  {
+    failed = 1;
+  }
+  if (BVIEW_STATUS_SUCCESS != bst_bench_codec (samples))
+  {
+    failed = 1;
+  }
+
+  /* entries of a history that wrapped replay back to their records */
+  if (BVIEW_STATUS_SUCCESS != bst_history_check (BST_BENCH_HISTORY_RECORDS))
+  {
+    printf ("bst history check failed\n");
+    failed = 1;
+  }
+  else
+  {
+    printf ("bst history check of %u records passed\n", BST_BENCH_HISTORY_RECORDS);
+  }
+  return failed;
+}
@@ -26,12 +26,17 @@
 #include "clear_bst_statistics.h"
 #include "clear_bst_thresholds.h"
 #include "configure_bst_thresholds.h"
+#include "configure_bst_thresholds_bulk.h"
 #include "configure_bst_feature.h"
 #include "configure_bst_tracking.h"
 #include "get_bst_tracking.h"
 #include "get_bst_feature.h"
 #include "get_bst_thresholds.h"
 #include "get_bst_report.h"
+#include "get_bst_history.h"
+#include "query_bst_history.h"
+#include "get_bst_statistics.h"
+#include "get_bst_top.h"
 #include "bst_json_encoder.h"
 #include "bst.h"
 #include "broadview.h"
@@ -49,12 +54,17 @@ static BVIEW_REST_API_t bst_cmd_api_list[] = {
   {"configure-bst-tracking", bstjson_configure_bst_tracking},
   {"configure-bst-feature", bstjson_configure_bst_feature},
   {"configure-bst-thresholds", bstjson_configure_bst_thresholds},
+  {"configure-bst-thresholds-bulk", bstjson_configure_bst_thresholds_bulk},
   {"get-bst-report", bstjson_get_bst_report},
   {"get-bst-feature", bstjson_get_bst_feature},
   {"get-bst-tracking", bstjson_get_bst_tracking},
   {"get-bst-thresholds", bstjson_get_bst_thresholds},
   {"clear-bst-thresholds", bstjson_clear_bst_thresholds},
-  {"clear-bst-statistics", bstjson_clear_bst_statistics}
+  {"clear-bst-statistics", bstjson_clear_bst_statistics},
+  {"get-bst-history", bstjson_get_bst_history},
+  {"query-bst-history", bstjson_query_bst_history},
+  {"get-bst-statistics", bstjson_get_bst_statistics},
+  {"get-bst-top", bstjson_get_bst_top}
 };
 /*********************************************************************
 * @brief : application function to configure the bst features
@@ -81,6 +91,7 @@ BVIEW_STATUS bst_config_feature_set (BVIEW_BST_REQUEST_MSG_t * msg_data)
   BVIEW_BST_CONFIG_t bstMode;
   BVIEW_BST_CONFIG_PARAMS_t *ptr;
   bool timerUpdateReqd = false;
+  int intervalMs;
 
   /* check for the null of the input pointer */
   if (NULL == msg_data)
@@ -95,18 +106,61 @@ BVIEW_STATUS bst_config_feature_set (BVIEW_BST_REQUEST_MSG_t * msg_data)
     return BVIEW_STATUS_INVALID_PARAMETER;
   }
  
-  /* collection interval is maintained in seconds in application.
-      while adding the timer, the same should be converted into
-       milli seconds and added as the timer api expects 
-       interval in milli seconds. */ 
-  if (ptr->collectionInterval != msg_data->request.config.collectionInterval)
+  /* collection interval is maintained in milli seconds in application.
+     the interval in milli seconds overrides the one in seconds, 
+     if present in the request */ 
+  if (0 <= msg_data->request.config.collectionIntervalMs)
+  {
+    intervalMs = msg_data->request.config.collectionIntervalMs;
+  }
+  else
+  {
+    intervalMs = msg_data->request.config.collectionInterval * BVIEW_BST_TIME_CONVERSION_FACTOR;
+  }
+
+  if ((0 != intervalMs) && (BVIEW_BST_MIN_INTERVAL_MS > intervalMs))
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+
+  if (ptr->collectionIntervalMs != intervalMs)
   {
     /* Collection interval has changed.
        so need to register the modified interval with the timer */
-    ptr->collectionInterval = msg_data->request.config.collectionInterval;
+    ptr->collectionIntervalMs = intervalMs;
+    ptr->collectionInterval = intervalMs / BVIEW_BST_TIME_CONVERSION_FACTOR;
     timerUpdateReqd = true;
   }
 
+  /* alignment params are optional, the existing value is
+     retained if not present in the request */
+  if ((0 <= msg_data->request.config.collectionAlign) &&
+      (ptr->collectionAlign != msg_data->request.config.collectionAlign))
+  {
+    ptr->collectionAlign = msg_data->request.config.collectionAlign;
+    timerUpdateReqd = true;
+  }
+  if ((0 <= msg_data->request.config.collectionAlignOffsetMs) &&
+      (ptr->collectionAlignOffsetMs != msg_data->request.config.collectionAlignOffsetMs))
+  {
+    ptr->collectionAlignOffsetMs = msg_data->request.config.collectionAlignOffsetMs;
+    timerUpdateReqd = true;
+  }
+
+  /* adaptive back-off is optional, the existing value is
+     retained if not present in the request */
+  if (0 <= msg_data->request.config.collectionAdaptive)
+  {
+    ptr->collectionAdaptive = msg_data->request.config.collectionAdaptive;
+  }
+  /* an interval stretched on overruns is reset to the configured one */
+  if (ptr->collectionIntervalMs != bst_pacing_interval_get (msg_data->unit))
+  {
+    timerUpdateReqd = true;
+  }
+  bst_pacing_config_set (msg_data->unit, ptr->collectionIntervalMs,
+                         (0 != ptr->collectionAdaptive) ? true : false);
+
   if (true == msg_data->request.config.sendAsyncReports)
   {
     /* request contains sendAsyncReports = true */
@@ -139,6 +193,112 @@ BVIEW_STATUS bst_config_feature_set (BVIEW_BST_REQUEST_MSG_t * msg_data)
     ptr->statUnitsInCells = msg_data->request.config.statUnitsInCells;
   }
 
+  /* trigger params are optional, the existing value is
+     retained if not present in the request */
+  if (0 <= msg_data->request.config.triggerCoalesceInterval)
+  {
+    ptr->triggerCoalesceInterval = msg_data->request.config.triggerCoalesceInterval;
+  }
+  if (0 <= msg_data->request.config.triggerRateLimit)
+  {
+    ptr->triggerRateLimit = msg_data->request.config.triggerRateLimit;
+  }
+  if (0 < msg_data->request.config.triggerBurst)
+  {
+    ptr->triggerBurst = msg_data->request.config.triggerBurst;
+  }
+  bst_trigger_config_set (msg_data->unit, ptr->triggerCoalesceInterval,
+                          ptr->triggerRateLimit, ptr->triggerBurst);
+
+  /* history size is optional, the existing value is
+     retained if not present in the request */
+  if ((0 <= msg_data->request.config.historySizeMb) &&
+      (ptr->historySizeMb != msg_data->request.config.historySizeMb))
+  {
+    rv = bst_history_config_set (msg_data->unit, msg_data->request.config.historySizeMb);
+    if (BVIEW_STATUS_SUCCESS != rv)
+    {
+      /* the history is released if it can not be resized */
+      ptr->historySizeMb = 0;
+      return rv;
+    }
+    ptr->historySizeMb = msg_data->request.config.historySizeMb;
+  }
+
+  /* rollup size and tiers are optional, the existing rollups are
+     retained if neither is present in the request */
+  if ((0 <= msg_data->request.config.rollupSizeMb) ||
+      (0 < msg_data->request.config.numRollupTiers))
+  {
+    if (0 < msg_data->request.config.numRollupTiers)
+    {
+      ptr->numRollupTiers = msg_data->request.config.numRollupTiers;
+      memcpy (ptr->rollupIntervalSec, msg_data->request.config.rollupIntervalSec,
+              sizeof (ptr->rollupIntervalSec));
+      memcpy (ptr->rollupRetention, msg_data->request.config.rollupRetention,
+              sizeof (ptr->rollupRetention));
+    }
+    if (0 <= msg_data->request.config.rollupSizeMb)
+    {
+      ptr->rollupSizeMb = msg_data->request.config.rollupSizeMb;
+    }
+    rv = bst_rollup_config_set (msg_data->unit, ptr->rollupSizeMb, ptr->numRollupTiers,
+                                ptr->rollupIntervalSec, ptr->rollupRetention);
+    if (BVIEW_STATUS_SUCCESS != rv)
+    {
+      /* the rollups are released if they can not be resized */
+      ptr->rollupSizeMb = 0;
+      return rv;
+    }
+  }
+
+  /* statistics size and slice are optional, the existing statistics
+     are retained if neither is present in the request */
+  if ((0 <= msg_data->request.config.statisticsSizeMb) ||
+      (0 < msg_data->request.config.statisticsSliceSec))
+  {
+    if (0 <= msg_data->request.config.statisticsSizeMb)
+    {
+      ptr->statisticsSizeMb = msg_data->request.config.statisticsSizeMb;
+    }
+    if (0 < msg_data->request.config.statisticsSliceSec)
+    {
+      ptr->statisticsSliceSec = msg_data->request.config.statisticsSliceSec;
+    }
+    rv = bst_sketch_config_set (msg_data->unit, ptr->statisticsSizeMb,
+                                ptr->statisticsSliceSec);
+    if (BVIEW_STATUS_SUCCESS != rv)
+    {
+      /* the statistics are released if they can not be resized */
+      ptr->statisticsSizeMb = 0;
+      return rv;
+    }
+  }
+
+  /* journal size and file are optional, the existing journal is
+     retained if neither is present in the request */
+  if ((0 <= msg_data->request.config.journalSizeMb) ||
+      ('\0' != msg_data->request.config.journalFile[0]))
+  {
+    if (0 <= msg_data->request.config.journalSizeMb)
+    {
+      ptr->journalSizeMb = msg_data->request.config.journalSizeMb;
+    }
+    if ('\0' != msg_data->request.config.journalFile[0])
+    {
+      strncpy (ptr->journalFile, msg_data->request.config.journalFile,
+               sizeof (ptr->journalFile) - 1);
+    }
+    rv = bst_journal_config_set (msg_data->unit, ptr->journalSizeMb,
+                                 ptr->journalFile);
+    if (BVIEW_STATUS_SUCCESS != rv)
+    {
+      /* the journal is closed if its file can not be opened */
+      ptr->journalSizeMb = 0;
+      return rv;
+    }
+  }
+
   /* till now we have not checked if the same is enabled in h/w.
       Now check if the bst is enabled in asic.. 
      want to check from s/w .. but set can happen directly and get 
@@ -380,6 +540,59 @@ BVIEW_STATUS bst_config_track_get (BVIEW_BST_REQUEST_MSG_t * msg_data)
   return rv;
 }
 
+/*********************************************************************
+* @brief : computes the alignment error of a periodic snapshot
+*
+* @param[in] ss : snapshot collected by the aligned periodic timer
+* @param[in] intervalMs : collection interval in milli seconds
+* @param[in] offsetMs : offset of the collection from the wall clock boundary
+*
+* @retval  : signed distance in nano seconds of the sampling time from
+*            the nearest aligned boundary
+*
+* @note : the sampling time is the wall clock time at which the first
+*         realm of the snapshot was read. A positive error is a
+*         collection after the boundary.
+*
+*********************************************************************/
+static int64_t bst_align_error_get (const BVIEW_BST_REPORT_SNAPSHOT_t *ss,
+                                    int intervalMs, int offsetMs)
+{
+  const BVIEW_BST_REALM_TIME_t *window;
+  BVIEW_BST_REALM_t realm;
+  uint64_t sampleTime = 0;
+  int64_t period, offset, error;
+
+  BVIEW_BST_REALM_ITER (realm)
+  {
+    window = &ss->realmTime[BVIEW_BST_REALM_INDEX (realm)];
+    /* realms which are not read in this snapshot are skipped */
+    if (0 == window->end.monotonic)
+    {
+      continue;
+    }
+    if ((0 == sampleTime) || (window->start.realtime < sampleTime))
+    {
+      sampleTime = window->start.realtime;
+    }
+  }
+
+  if ((0 == sampleTime) || (0 >= intervalMs))
+  {
+    return 0;
+  }
+
+  period = (int64_t) intervalMs * 1000000LL;
+  offset = ((int64_t) offsetMs * 1000000LL) % period;
+  error = (int64_t) ((sampleTime - (uint64_t) offset) % (uint64_t) period);
+  /* the nearest boundary may be the next one */
+  if (error > (period / 2))
+  {
+    error -= period;
+  }
+  return error;
+}
+
 /*********************************************************************
 * @brief : application function to get the bst report and thresholds 
 *
@@ -395,10 +608,15 @@ BVIEW_STATUS bst_config_track_get (BVIEW_BST_REQUEST_MSG_t * msg_data)
 BVIEW_STATUS bst_get_report (BVIEW_BST_REQUEST_MSG_t * msg_data)
 {
   BVIEW_BST_REPORT_SNAPSHOT_t *ss;
+  BVIEW_BST_ASIC_SNAPSHOT_DATA_t *scratch;
   BVIEW_STATUS rv = BVIEW_STATUS_SUCCESS;
   BVIEW_BST_UNIT_CXT_t *ptr;
   BVIEW_BST_TRACK_PARAMS_t *track_ptr;
   BVIEW_BST_CONFIG_PARAMS_t *config_ptr;
+  BVIEW_BST_REALM_MASK_t realmMask;
+  BVIEW_BST_REALM_MASK_t triggerMask = 0;
+  BVIEW_TIME_t tv;
+  unsigned int mismatches = 0;
  
   if (NULL == msg_data)
   {
@@ -408,13 +626,24 @@ BVIEW_STATUS bst_get_report (BVIEW_BST_REQUEST_MSG_t * msg_data)
   track_ptr = BST_CONFIG_TRACK_PTR_GET (msg_data->unit);
   config_ptr = BST_CONFIG_FEATURE_PTR_GET (msg_data->unit);
   ptr = BST_UNIT_PTR_GET (msg_data->unit);
+  /* the asic fills the full size record, which is then
+     packed into the record of the unit */
+  scratch = bst_snapshot_scratch_get (msg_data->unit);
 
-  if ((NULL == ptr) || (NULL == track_ptr) || (NULL == config_ptr))
+  if ((NULL == ptr) || (NULL == track_ptr) || (NULL == config_ptr) ||
+      (NULL == scratch))
     return BVIEW_STATUS_INVALID_PARAMETER;
 
   /* request is to get the report.
    */
 
+  /* collect the trigger which posted the report, so that the unit
+     admits new triggers even if the report is not sent */
+  if (BVIEW_BST_CMD_API_TRIGGER_REPORT == msg_data->msg_type)
+  {
+    bst_trigger_take (msg_data);
+  }
+
    /* if bst is turned off, 
       no need to send the reports or triggers
       Ignore the same */
@@ -441,29 +670,86 @@ BVIEW_STATUS bst_get_report (BVIEW_BST_REQUEST_MSG_t * msg_data)
   if ((BVIEW_BST_CMD_API_GET_REPORT == msg_data->msg_type) ||
       (BVIEW_BST_CMD_API_TRIGGER_REPORT == msg_data->msg_type))
   {
+    /* read only the realms which are both tracked and requested.
+       realms which are not read are reported as zero */
+    realmMask = BST_TRACK_TO_REALM_MASK (track_ptr) &
+                BST_COLLECT_TO_REALM_MASK (&msg_data->request.collect);
+
     if (BVIEW_BST_CMD_API_TRIGGER_REPORT == msg_data->msg_type)
     {
+      /* the realm which raised the trigger is read first, closest to
+         the trigger and ahead of the threshold clear, which programs
+         every profile of the asic */
+      triggerMask = realmMask & msg_data->trigger_realms;
+
+      /* the current record is private to the collection
+         until it is published, no lock is needed to fill it */
+      bst_snapshot_put (msg_data->unit, ptr->stats_current_record_ptr);
+      ptr->stats_current_record_ptr = bst_snapshot_alloc (msg_data->unit);
+      ss = ptr->stats_current_record_ptr;
+      if (NULL == ss)
+      {
+        return BVIEW_STATUS_OUTOFMEMORY;
+      }
+      if ((true == config_ptr->bstEnable) && (0 != triggerMask))
+      {
+        rv = sbapi_bst_snapshot_get (msg_data->unit, triggerMask, 
+                                     scratch, &ss->tv,
+                                     ss->realmTime);
+        if (BVIEW_STATUS_SUCCESS == rv)
+        {
+          bst_snapshot_pack (msg_data->unit, triggerMask, ss);
+        }
+      }
+
       /* clear thresholds*/
       sbapi_bst_clear_thresholds(msg_data->unit);
-      BST_LOCK_TAKE (msg_data->unit);
       /* threshold clear is successful.. clear the record as well */
-      memset (ptr->threshold_record_ptr, 0, 
-          sizeof (BVIEW_BST_REPORT_SNAPSHOT_t));
-      BST_LOCK_GIVE (msg_data->unit);
+      bst_snapshot_clear (msg_data->unit, BVIEW_BST_THRESHOLD);
 
     } 
-    /* collect data.. since the data is huge.. give the current record 
-       memory pointer directly so that we can avoid, copy */
-    BST_LOCK_TAKE (msg_data->unit);
+    /* collect data.. the asic fills the full size record and the
+       realms read are packed into the current record. 
+       before we collect data..ensure there is no garbage.. 
+       the realm of the trigger is already read into the record */
+    if (0 == triggerMask)
+    {
+      bst_snapshot_put (msg_data->unit, ptr->stats_current_record_ptr);
+      ptr->stats_current_record_ptr = bst_snapshot_alloc (msg_data->unit);
+    }
     ss = ptr->stats_current_record_ptr;
-    /* before we collect data..ensure there is no garbage.. 
-     */
-    memset (ss, 0,
-        sizeof (BVIEW_BST_REPORT_SNAPSHOT_t));
+    if (NULL == ss)
+    {
+      return BVIEW_STATUS_OUTOFMEMORY;
+    }
+
+    /* the lock covers the bst state of the unit, a response being
+       sent holds references on the published records instead */
+    BST_LOCK_TAKE (msg_data->unit);
 
     if (true == config_ptr->bstEnable)
     {
-      rv = sbapi_bst_snapshot_get (msg_data->unit, &ss->snapshot_data, &ss->tv);
+      if (0 == triggerMask)
+      {
+        rv = sbapi_bst_snapshot_get (msg_data->unit, realmMask, 
+                                     scratch, &ss->tv,
+                                     ss->realmTime);
+        if (BVIEW_STATUS_SUCCESS == rv)
+        {
+          bst_snapshot_pack (msg_data->unit, realmMask, ss);
+        }
+      }
+      else if ((BVIEW_STATUS_SUCCESS == rv) && (0 != (realmMask & ~triggerMask)))
+      {
+        /* rest of the realms, report keeps the time of the trigger realm */
+        rv = sbapi_bst_snapshot_get (msg_data->unit, realmMask & ~triggerMask, 
+                                     scratch, &tv,
+                                     ss->realmTime);
+        if (BVIEW_STATUS_SUCCESS == rv)
+        {
+          bst_snapshot_pack (msg_data->unit, realmMask & ~triggerMask, ss);
+        }
+      }
 
       if (BVIEW_BST_CMD_API_TRIGGER_REPORT == msg_data->msg_type)
       {
@@ -472,6 +758,17 @@ BVIEW_STATUS bst_get_report (BVIEW_BST_REQUEST_MSG_t * msg_data)
         config_ptr->bstEnable = false;
       }
     }
+
+    /* periodic collection aligned to the wall clock,
+       record how far the sampling was from the boundary */
+    if ((BVIEW_BST_STATS_PERIODIC == msg_data->report_type) &&
+        (true == config_ptr->collectionAlign) &&
+        (BVIEW_STATUS_SUCCESS == rv))
+    {
+      ss->aligned = true;
+      ss->alignErrorNs = bst_align_error_get (ss, bst_pacing_interval_get (msg_data->unit),
+                                              config_ptr->collectionAlignOffsetMs);
+    }
     BST_LOCK_GIVE (msg_data->unit);
 
     if (BVIEW_STATUS_SUCCESS != rv)
@@ -479,7 +776,11 @@ BVIEW_STATUS bst_get_report (BVIEW_BST_REQUEST_MSG_t * msg_data)
       /* call failed..  log the reason code ..*/
       LOG_POST (BVIEW_LOG_ERROR, "Failed to get bst stats, err %d \r\n", rv);
       /* Since stats collection has failed.. no need to do the rest.
+         the partial record is dropped, so that it is not published.
          report the error to the calling function */
+      bst_snapshot_put (msg_data->unit, ptr->stats_current_record_ptr);
+      ptr->stats_current_record_ptr = NULL;
+      return rv;
     }
 
   }
@@ -488,30 +789,154 @@ BVIEW_STATUS bst_get_report (BVIEW_BST_REQUEST_MSG_t * msg_data)
    */
   if (BVIEW_BST_CMD_API_GET_THRESHOLD == msg_data->msg_type)
   {
-    /* here we need to take the lock, since we maintain only one record for
-       thresholds. assumption is that threshold get is called very sparingly,
-       where as report is quite often.. so one record is enough.. 
-       since we have single record, don't want a read while collecting the  information.
-       so protect the same */
-    BST_LOCK_TAKE (msg_data->unit);
-    /* make sure no garbage.. */
-    memset (&ptr->threshold_record_ptr->snapshot_data, 0, sizeof(BVIEW_BST_ASIC_SNAPSHOT_DATA_t));
+    /* thresholds are read into a new record, which is published
+       once complete. a response still encoding the previous
+       record keeps its reference on it */
+    ss = bst_snapshot_alloc (msg_data->unit);
+    if (NULL == ss)
+    {
+      return BVIEW_STATUS_OUTOFMEMORY;
+    }
   
-    rv = sbapi_bst_threshold_get (msg_data->unit, &ptr->threshold_record_ptr->snapshot_data, 
-                                  &ptr->threshold_record_ptr->tv);
-    /* Release  the lock . */
-    BST_LOCK_GIVE (msg_data->unit);
+    if (true == msg_data->verify_hw)
+    {
+      /* audit: read the thresholds from HW and check the shadow copy */
+      rv = sbapi_bst_threshold_verify (msg_data->unit, scratch,
+                                       &ss->tv, &mismatches);
+      if ((BVIEW_STATUS_SUCCESS == rv) && (0 != mismatches))
+      {
+        LOG_POST (BVIEW_LOG_WARNING, "unit %d: %u bst thresholds differ from HW, shadow resynced \r\n",
+                  msg_data->unit, mismatches);
+      }
+    }
+    else
+    {
+      rv = sbapi_bst_threshold_get (msg_data->unit, scratch, 
+                                    &ss->tv);
+    }
     if (BVIEW_STATUS_SUCCESS != rv)
     {
       /* call failed..  log the reason code ..*/
       LOG_POST (BVIEW_LOG_ERROR, "Failed to get bst stats, err %d \r\n", rv);
       /* Since threshold get has failed.. no need to do the rest.
+         the partial record is not published.
          report the error to the calling function */
+      bst_snapshot_put (msg_data->unit, ss);
+      return rv;
     }
+    bst_snapshot_pack (msg_data->unit, BVIEW_BST_REALM_ALL, ss);
+    bst_snapshot_publish (msg_data->unit, BVIEW_BST_THRESHOLD, ss);
   }
   return rv;
 }
 
+/*********************************************************************
+* @brief : application function to validate a history request
+*
+* @param[in] msg_data : pointer to the bst message request.
+*
+* @retval  : BVIEW_STATUS_SUCCESS : the history, or the rollups for a
+*                                   query at a resolution, are enabled.
+* @retval  : BVIEW_STATUS_RESOURCE_NOT_AVAILABLE : the history is disabled.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : the entries are read from the history of the unit when
+*            the response is encoded, nothing is read from the asic.
+*
+*********************************************************************/
+BVIEW_STATUS bst_get_history (BVIEW_BST_REQUEST_MSG_t * msg_data)
+{
+  BVIEW_BST_CONFIG_PARAMS_t *config_ptr;
+
+  if (NULL == msg_data)
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+
+  config_ptr = BST_CONFIG_FEATURE_PTR_GET (msg_data->unit);
+  if (NULL == config_ptr)
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+
+  /* a query at a resolution may be served by the rollups */
+  if ((0 == config_ptr->historySizeMb) &&
+      ((BVIEW_BST_CMD_API_QUERY_HISTORY != msg_data->msg_type) ||
+       (0 == msg_data->filter.resolutionSec) || (0 == config_ptr->rollupSizeMb)))
+  {
+    return BVIEW_STATUS_RESOURCE_NOT_AVAILABLE;
+  }
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief : application function to validate a statistics request
+*
+* @param[in] msg_data : pointer to the bst message request.
+*
+* @retval  : BVIEW_STATUS_SUCCESS : the statistics are enabled.
+* @retval  : BVIEW_STATUS_RESOURCE_NOT_AVAILABLE : the statistics are
+*                                                 disabled.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : the histograms of the unit are merged when the response
+*            is encoded, nothing is read from the asic.
+*
+*********************************************************************/
+BVIEW_STATUS bst_get_statistics (BVIEW_BST_REQUEST_MSG_t * msg_data)
+{
+  BVIEW_BST_CONFIG_PARAMS_t *config_ptr;
+
+  if (NULL == msg_data)
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+
+  config_ptr = BST_CONFIG_FEATURE_PTR_GET (msg_data->unit);
+  if (NULL == config_ptr)
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+
+  if (0 == config_ptr->statisticsSizeMb)
+  {
+    return BVIEW_STATUS_RESOURCE_NOT_AVAILABLE;
+  }
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief : application function to validate a top entries request
+*
+* @param[in] msg_data : pointer to the bst message request.
+*
+* @retval  : BVIEW_STATUS_SUCCESS : the top lists are kept.
+* @retval  : BVIEW_STATUS_RESOURCE_NOT_AVAILABLE : the top lists are
+*                                                 not sized.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : the top lists of the unit are merged when the response
+*            is encoded, nothing is read from the asic.
+*
+*********************************************************************/
+BVIEW_STATUS bst_get_top (BVIEW_BST_REQUEST_MSG_t * msg_data)
+{
+  BVIEW_BST_UNIT_CXT_t *ptr;
+
+  if ((NULL == msg_data) || (msg_data->unit < 0) ||
+      (msg_data->unit >= BVIEW_BST_MAX_UNITS))
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+
+  ptr = BST_UNIT_PTR_GET (msg_data->unit);
+  if (0 == ptr->top.numEntries)
+  {
+    return BVIEW_STATUS_RESOURCE_NOT_AVAILABLE;
+  }
+  return BVIEW_STATUS_SUCCESS;
+}
+
 /*********************************************************************
 * @brief : function to add timer for the periodic stats collection 
 *
@@ -559,13 +984,24 @@ BVIEW_STATUS bst_periodic_collection_timer_add (unsigned int  unit)
     }
   }
 
-  /* The timer add function expects the time in milli seconds..
-     so convert the time into milli seconds. , before adding
-     the timer node */
+  /* The timer add function expects the time in milli seconds,
+     as the interval is maintained. The interval in use may be
+     stretched beyond the configured one on overruns. An aligned timer expires at the
+     wall clock multiples of the interval plus the offset */
+  if ((true == ptr->collectionAlign) && (0 != ptr->collectionIntervalMs))
+  {
+    rv =  system_timer_add_aligned (bst_periodic_collection_cb,
+                  &bst_data_ptr->bst_timer.bstCollectionTimer,
+                  bst_pacing_interval_get (unit),
+                  ptr->collectionAlignOffsetMs, &bst_data_ptr->bst_timer.unit);
+  }
+  else
+  {
     rv =  system_timer_add (bst_periodic_collection_cb,
                   &bst_data_ptr->bst_timer.bstCollectionTimer,
-                  ptr->collectionInterval*BVIEW_BST_TIME_CONVERSION_FACTOR,
+                  bst_pacing_interval_get (unit),
                   PERIODIC_MODE, &bst_data_ptr->bst_timer.unit);
+  }
 
     if (BVIEW_STATUS_SUCCESS == rv)
     {
@@ -761,6 +1197,137 @@ BVIEW_STATUS bst_config_threshold_set (BVIEW_BST_REQUEST_MSG_t * msg_data)
   return rv;
 }
 
+/*********************************************************************
+* @brief : set the thresholds of a bulk request
+*
+* @param[in] msg_data : pointer to the bst message request.
+*
+* @retval  : BVIEW_STATUS_SUCCESS - thresholds are passed to the asic,
+*                                   status of each threshold is in the request
+* @retval  : BVIEW_STATUS_UNSUPPORTED - bulk threshold set is not supported
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : All the valid thresholds are applied in one SB batch.
+*            Failed thresholds are logged and reported in the response.
+*
+*********************************************************************/
+BVIEW_STATUS bst_config_threshold_bulk_set (BVIEW_BST_REQUEST_MSG_t * msg_data)
+{
+  BVIEW_BST_THRESHOLD_BULK_t *bulk;
+  BVIEW_STATUS rv = BVIEW_STATUS_SUCCESS;
+  unsigned int index = 0, failed = 0;
+
+  if ((NULL == msg_data) || (NULL == msg_data->bulk))
+    return BVIEW_STATUS_INVALID_PARAMETER;
+
+  bulk = msg_data->bulk;
+
+  if (0 != bulk->numValid)
+  {
+    /* entries the asic does not get to stay failed */
+    for (index = 0; index < bulk->numValid; index++)
+    {
+      bulk->entries[index].status = BVIEW_STATUS_FAILURE;
+    }
+
+    rv = sbapi_bst_threshold_bulk_set (msg_data->unit, bulk->entries, bulk->numValid);
+    if (BVIEW_STATUS_UNSUPPORTED == rv)
+    {
+      LOG_POST (BVIEW_LOG_ERROR, 
+         "bulk threshold set is not supported on unit %d \r\n", msg_data->unit);
+      return rv;
+    }
+
+    /* report the status of the asic against the request entry */
+    for (index = 0; index < bulk->numValid; index++)
+    {
+      bulk->status[bulk->validIndex[index]] = bulk->entries[index].status;
+    }
+  }
+
+  for (index = 0; index < bulk->numEntries; index++)
+  {
+    if (BVIEW_STATUS_SUCCESS != bulk->status[index])
+    {
+      failed++;
+    }
+  }
+
+  if (0 != failed)
+  {
+    _BST_LOG(_BST_DEBUG_ERROR,"bulk threshold set failed for %u of %u thresholds\r\n",
+             failed, bulk->numEntries); 
+    LOG_POST (BVIEW_LOG_ERROR, 
+       "bulk threshold set failed for %u of %u thresholds\r\n", 
+        failed, bulk->numEntries);
+  }
+  else
+  {
+    LOG_POST (BVIEW_LOG_INFO, 
+       "bulk threshold set successful for %u thresholds\r\n", bulk->numEntries);
+  }
+
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief : allocate the thresholds of a bulk request
+*
+* @param[in] numEntries : number of thresholds in the request
+*
+* @retval  : pointer to the bulk request, NULL if out of memory
+*
+* @note    : status of every threshold is initialized to failure.
+*
+*********************************************************************/
+BVIEW_BST_THRESHOLD_BULK_t *bst_threshold_bulk_alloc (unsigned int numEntries)
+{
+  BVIEW_BST_THRESHOLD_BULK_t *bulk;
+  unsigned int index = 0;
+
+  bulk = calloc (1, sizeof (BVIEW_BST_THRESHOLD_BULK_t));
+  if (NULL == bulk)
+    return NULL;
+
+  bulk->status = calloc (numEntries, sizeof (BVIEW_STATUS));
+  bulk->validIndex = calloc (numEntries, sizeof (unsigned int));
+  bulk->entries = calloc (numEntries, sizeof (BVIEW_BST_THRESHOLD_BULK_ENTRY_t));
+  if ((NULL == bulk->status) || (NULL == bulk->validIndex) ||
+      (NULL == bulk->entries))
+  {
+    bst_threshold_bulk_free (bulk);
+    return NULL;
+  }
+
+  bulk->numEntries = numEntries;
+  for (index = 0; index < numEntries; index++)
+  {
+    bulk->status[index] = BVIEW_STATUS_FAILURE;
+  }
+  return bulk;
+}
+
+/*********************************************************************
+* @brief : free the thresholds of a bulk request
+*
+* @param[in] bulk : pointer to the bulk request
+*
+* @retval  : none
+*
+* @note    : NULL is ignored.
+*
+*********************************************************************/
+void bst_threshold_bulk_free (BVIEW_BST_THRESHOLD_BULK_t *bulk)
+{
+  if (NULL == bulk)
+    return;
+
+  free (bulk->status);
+  free (bulk->validIndex);
+  free (bulk->entries);
+  free (bulk);
+}
+
 /*********************************************************************
 * @brief : function to clear the threshold set
 *
@@ -776,21 +1343,15 @@ BVIEW_STATUS bst_config_threshold_set (BVIEW_BST_REQUEST_MSG_t * msg_data)
 BVIEW_STATUS bst_clear_threshold_set (BVIEW_BST_REQUEST_MSG_t * msg_data)
 {
   BVIEW_STATUS rv = BVIEW_STATUS_SUCCESS;
-  BVIEW_BST_UNIT_CXT_t *ptr;
 
   if (NULL == msg_data)
     return BVIEW_STATUS_INVALID_PARAMETER;
 
-  ptr = BST_UNIT_PTR_GET (msg_data->unit);
-
   rv = sbapi_bst_clear_thresholds (msg_data->unit);
   if (BVIEW_STATUS_SUCCESS == rv)
   {
-    BST_LOCK_TAKE (msg_data->unit);
     /* threshold clear is successful.. clear the record as well */
-    memset (ptr->threshold_record_ptr, 0, 
-        sizeof (BVIEW_BST_REPORT_SNAPSHOT_t));
-    BST_LOCK_GIVE (msg_data->unit);
+    bst_snapshot_clear (msg_data->unit, BVIEW_BST_THRESHOLD);
 
       LOG_POST (BVIEW_LOG_INFO, 
            "threshold clear successful for the unit. %d \r\n", 
@@ -827,17 +1388,11 @@ BVIEW_STATUS bst_clear_stats_set (BVIEW_BST_REQUEST_MSG_t * msg_data)
     return BVIEW_STATUS_INVALID_PARAMETER;
 
   ptr = BST_UNIT_PTR_GET (msg_data->unit);
-  /* take the lock */
-  BST_LOCK_TAKE (msg_data->unit);
-  /* stats clear  */
-  memset (ptr->stats_backup_record_ptr, 0,
-      sizeof (BVIEW_BST_REPORT_SNAPSHOT_t));
-  memset (ptr->stats_active_record_ptr, 0,
-      sizeof (BVIEW_BST_REPORT_SNAPSHOT_t));
-  memset (ptr->stats_current_record_ptr, 0,
-      sizeof (BVIEW_BST_REPORT_SNAPSHOT_t));
-  /* release the lock */
-  BST_LOCK_GIVE (msg_data->unit);
+  /* stats clear. the cleared record is published in place of the
+     active and backup records */
+  bst_snapshot_put (msg_data->unit, ptr->stats_current_record_ptr);
+  ptr->stats_current_record_ptr = NULL;
+  bst_snapshot_clear (msg_data->unit, BVIEW_BST_STATS);
 
   /* clear in asic as well*/
 
@@ -860,32 +1415,25 @@ BVIEW_STATUS bst_clear_stats_set (BVIEW_BST_REQUEST_MSG_t * msg_data)
 *
 * @note : Once the collection of the stats is completeed, the existing active
 *        record becomes back up. The newly collected record become the new active
-*        record. Make sure to take the lock while updating..
+*        record. The new record is published atomically, the old records
+*        are released once the responses using them are sent.
 *
 *********************************************************************/
 BVIEW_STATUS bst_update_data (BVIEW_BST_REPORT_TYPE_t type, unsigned int unit)
 {
   BVIEW_BST_UNIT_CXT_t *ptr;
-  BVIEW_BST_REPORT_SNAPSHOT_t *temp;
 
   ptr = BST_UNIT_PTR_GET (unit);
 
   switch (type)
   {
   case BVIEW_BST_STATS:
-    BST_LOCK_TAKE (unit);
-    /* take the lock */
-    /* copy the backup pointer in a temporary variable */
-    temp = ptr->stats_backup_record_ptr;
-    /* make the active  as backup */
-    ptr->stats_backup_record_ptr = ptr->stats_active_record_ptr;
-
-    /* make the current as active */
-    ptr->stats_active_record_ptr = ptr->stats_current_record_ptr;
-    /* now make the old backup as current */
-    ptr->stats_current_record_ptr = temp;
-    /* release the lock */
-    BST_LOCK_GIVE (unit);
+    /* make the current as active, the active becomes its backup */
+    if (NULL != ptr->stats_current_record_ptr)
+    {
+      bst_snapshot_publish (unit, BVIEW_BST_STATS, ptr->stats_current_record_ptr);
+      ptr->stats_current_record_ptr = NULL;
+    }
     break;
 
   default:
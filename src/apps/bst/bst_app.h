@@ -76,8 +76,92 @@ extern "C" {
 #define BVIEW_BST_DEFAULT_TRACK_E_RQE_Q      true
 #define BVIEW_BST_DEFAULT_TRACK_MODE         BVIEW_BST_MODE_CURRENT
 
+  /* window in milli seconds over which triggers are merged into one report */
+#define BVIEW_BST_DEFAULT_TRIGGER_COALESCE_INTERVAL  10
+  /* trigger reports per second, 0 is unlimited */
+#define BVIEW_BST_DEFAULT_TRIGGER_RATE_LIMIT         0
+  /* trigger reports allowed back to back */
+#define BVIEW_BST_DEFAULT_TRIGGER_BURST              1
+
+  /* periodic collection is not aligned to the wall clock by default */
+#define BVIEW_BST_DEFAULT_COLLECTION_ALIGN           false
+  /* offset of the aligned collection from the wall clock boundary, in milli seconds */
+#define BVIEW_BST_DEFAULT_COLLECTION_ALIGN_OFFSET    0
+  /* collection interval is not stretched on overruns by default */
+#define BVIEW_BST_DEFAULT_COLLECTION_ADAPTIVE        false
+  /* size of the snapshot history of a unit in MB, 0 disables it.
+     The history is allocated when configured */
+#define BVIEW_BST_DEFAULT_HISTORY_SIZE_MB            0
+  /* entries of a block of the history, a block starts with an entry
+     which decodes on its own */
+#define BVIEW_BST_HISTORY_BLOCK_ENTRIES              64
+  /* summaries of the blocks of the history, per MB of the history.
+     Entries are added to the newest block once they are all in use */
+#define BVIEW_BST_HISTORY_BLOCKS_PER_MB              256
+  /* size of the rollups of a unit in MB, split evenly among the
+     tiers, 0 disables them. The rollups are allocated when configured */
+#define BVIEW_BST_DEFAULT_ROLLUP_SIZE_MB             0
+  /* rollup tiers by default, interval of a bucket in seconds and
+     buckets kept. 10 minutes of seconds, a day of minutes and a week
+     of hours */
+#define BVIEW_BST_DEFAULT_ROLLUP_TIERS               3
+#define BVIEW_BST_DEFAULT_ROLLUP_INTERVALS_SEC       {1, 60, 3600}
+#define BVIEW_BST_DEFAULT_ROLLUP_RETENTION           {600, 1440, 168}
+#define BVIEW_BST_ROLLUP_MAX_TIERS                   BSTJSON_MAX_ROLLUP_TIERS
+  /* max, min, mean and last value of a counter in a bucket */
+#define BVIEW_BST_ROLLUP_NUM_VALUES                  4
+  /* size of the streaming statistics of a unit in MB, 0 disables
+     them. The histograms of the closed slices are kept in it, oldest
+     dropped first, which bounds the longest window. The statistics
+     are allocated when configured */
+#define BVIEW_BST_DEFAULT_STATISTICS_SIZE_MB         0
+  /* interval of a slice of the statistics, in seconds */
+#define BVIEW_BST_DEFAULT_STATISTICS_SLICE_SEC       60
+  /* histogram of a counter. Values below 8 have a bucket each, every
+     power of two above them is split in 8 buckets up to 2^24, so that
+     a bucket is within 1/8 of its value */
+#define BVIEW_BST_SKETCH_SUB_BITS                    3
+#define BVIEW_BST_SKETCH_MAX_BITS                    24
+#define BVIEW_BST_SKETCH_BUCKETS                     ((1 << BVIEW_BST_SKETCH_SUB_BITS) * \
+                                                      (BVIEW_BST_SKETCH_MAX_BITS - BVIEW_BST_SKETCH_SUB_BITS + 1))
+  /* percentiles of a query, with the max they are reported for every
+     counter of an entry, up to four of them, in the values of a match */
+#define BVIEW_BST_SKETCH_MAX_PERCENTILES             ((BVIEW_BST_QUERY_MAX_VALUES / 4) - 1)
+  /* entries of every realm kept in the top lists, the most a query
+     of the top entries returns per realm */
+#define BVIEW_BST_TOP_MAX_ENTRIES                    64
+  /* interval of a slice of the top lists in seconds, and slices kept.
+     The top entries of every 10 seconds for an hour */
+#define BVIEW_BST_TOP_SLICE_SEC                      10
+#define BVIEW_BST_TOP_SLICES                         360
+  /* size of the snapshot journal file of a unit in MB, 0 disables it.
+     The journal is opened when configured */
+#define BVIEW_BST_DEFAULT_JOURNAL_SIZE_MB            0
+  /* journal file of a unit, the unit id is appended to it */
+#define BVIEW_BST_DEFAULT_JOURNAL_FILE               "/var/log/bst_journal_unit"
+  /* journal records between two records holding all the counters */
+#define BVIEW_BST_JOURNAL_KEYFRAME_INTERVAL          64
+  /* journal records appended between two flushes to the disk */
+#define BVIEW_BST_JOURNAL_SYNC_INTERVAL              16
+
 #define BVIEW_BST_MAX_UNITS 8
 #define BVIEW_BST_TIME_CONVERSION_FACTOR 1000
+  /* shortest periodic collection interval, in milli seconds */
+#define BVIEW_BST_MIN_INTERVAL_MS        10
+  /* longest collection interval, in milli seconds */
+#define BVIEW_BST_MAX_INTERVAL_MS        600000
+  /* cycles within a quarter of a stretched interval before it is halved */
+#define BVIEW_BST_PACING_RECOVERY_CYCLES 8
+  /* released records kept per unit for the next collections */
+#define BVIEW_BST_SNAPSHOT_POOL_SIZE     4
+  /* reports queued to the sender, periodic reports are dropped
+     beyond it */
+#define BVIEW_BST_SENDER_QUEUE_SIZE      16
+  /* counter arrays of a record start on a cache line */
+#define BVIEW_BST_SNAPSHOT_ALIGN         16
+  /* size in bytes of the ring of the history check of the bench tool,
+     the ring wraps several times */
+#define BVIEW_BST_HISTORY_CHECK_SIZE     65536
 
 /* Maximum number of failed Receive messages */
 #define BVIEW_BST_MAX_QUEUE_SEND_FAILS      10
@@ -87,6 +171,22 @@ typedef BSTJSON_CONFIGURE_BST_FEATURE_t   BVIEW_BST_CONFIG_PARAMS_t;
 typedef BSTJSON_REPORT_OPTIONS_t          BVIEW_BST_REPORT_OPTIONS_t;
 typedef BSTJSON_GET_BST_REPORT_t          BVIEW_BST_STAT_COLLECT_CONFIG_t;
 typedef BSTJSON_CONFIGURE_BST_THRESHOLDS_t BVIEW_BST_THRESHOLD_CONFIG_t;
+typedef BSTJSON_TRIGGER_STATS_t           BVIEW_BST_TRIGGER_STATS_t;
+typedef BSTJSON_COLLECTION_STATS_t        BVIEW_BST_COLLECTION_STATS_t;
+typedef BSTJSON_HISTORY_INFO_t            BVIEW_BST_HISTORY_INFO_t;
+typedef BSTJSON_HISTORY_ENTRY_t           BVIEW_BST_HISTORY_ENTRY_t;
+typedef BSTJSON_QUERY_AGGREGATE_t         BVIEW_BST_QUERY_AGGREGATE_t;
+typedef BSTJSON_QUERY_MATCH_t             BVIEW_BST_QUERY_MATCH_t;
+typedef BSTJSON_QUERY_SAMPLE_t            BVIEW_BST_QUERY_SAMPLE_t;
+typedef BSTJSON_QUERY_STATS_t             BVIEW_BST_QUERY_STATS_t;
+typedef BSTJSON_STATISTICS_t              BVIEW_BST_STATISTICS_t;
+typedef BSTJSON_TOP_t                     BVIEW_BST_TOP_t;
+
+#define BVIEW_BST_QUERY_AGGREGATE_NONE    BSTJSON_QUERY_AGGREGATE_NONE
+#define BVIEW_BST_QUERY_AGGREGATE_MAX     BSTJSON_QUERY_AGGREGATE_MAX
+#define BVIEW_BST_QUERY_AGGREGATE_AVG     BSTJSON_QUERY_AGGREGATE_AVG
+#define BVIEW_BST_QUERY_AGGREGATE_LAST    BSTJSON_QUERY_AGGREGATE_LAST
+#define BVIEW_BST_QUERY_MAX_VALUES        BSTJSON_QUERY_MAX_VALUES
 
 
 typedef enum _bst_report_type_ {
@@ -131,12 +231,17 @@ typedef enum _bst_cmd_ {
   BVIEW_BST_CMD_API_SET_THRESHOLD,
   BVIEW_BST_CMD_API_CLEAR_THRESHOLD,
   BVIEW_BST_CMD_API_CLEAR_STATS,
+  BVIEW_BST_CMD_API_SET_THRESHOLD_BULK,
   /* get group */
   BVIEW_BST_CMD_API_GET_REPORT,
   BVIEW_BST_CMD_API_GET_FEATURE,
   BVIEW_BST_CMD_API_GET_TRACK,
   BVIEW_BST_CMD_API_GET_THRESHOLD,
   BVIEW_BST_CMD_API_TRIGGER_REPORT,
+  BVIEW_BST_CMD_API_GET_HISTORY,
+  BVIEW_BST_CMD_API_QUERY_HISTORY,
+  BVIEW_BST_CMD_API_GET_STATISTICS,
+  BVIEW_BST_CMD_API_GET_TOP,
   BVIEW_BST_CMD_API_MAX
 }BVIEW_FEATURE_BST_CMD_API_t;
 
@@ -148,7 +253,21 @@ typedef enum _bst_cmd_ {
 
   typedef struct _bst_report_snapshot_data_ {
     BVIEW_TIME_t tv;
-    BVIEW_BST_ASIC_SNAPSHOT_DATA_t snapshot_data;
+    /* sampling window of every realm, indexed by BVIEW_BST_REALM_INDEX */
+    BVIEW_BST_REALM_TIME_t realmTime[BVIEW_BST_NUM_REALMS];
+    /* realms read into the record, the others are carried over from
+       the record published before it */
+    BVIEW_BST_REALM_MASK_t realmMask;
+    /* set when the snapshot is collected by an aligned periodic timer */
+    bool aligned;
+    /* distance of the sampling time from the aligned boundary, in nano seconds */
+    int64_t alignErrorNs;
+    /* references held on the record, it is released with the last one */
+    uint32_t refCount;
+    /* stats record published before this one, referenced by it */
+    struct _bst_report_snapshot_data_ *previous;
+    /* counters, laid out by the unit and allocated with the record */
+    BVIEW_BST_SNAPSHOT_DATA_t snapshot_data;
   }BVIEW_BST_REPORT_SNAPSHOT_t;
 
   typedef struct _bst_report_respose_ {
@@ -156,6 +275,86 @@ typedef enum _bst_cmd_ {
     BVIEW_BST_REPORT_SNAPSHOT_t *backup;
   }BVIEW_BST_REPORT_RESP_t;
 
+  /* thresholds of a bulk request. Allocated when the request is posted
+     and freed by the bst application once the response is sent */
+  typedef struct _bst_threshold_bulk_ {
+    /* number of thresholds in the request */
+    unsigned int numEntries;
+    /* status of every threshold of the request */
+    BVIEW_STATUS *status;
+    /* number of thresholds which passed validation */
+    unsigned int numValid;
+    /* request index of every valid threshold */
+    unsigned int *validIndex;
+    /* valid thresholds, applied in one SB batch */
+    BVIEW_BST_THRESHOLD_BULK_ENTRY_t *entries;
+  }BVIEW_BST_THRESHOLD_BULK_t;
+
+  /* range of the entries of a history request. Entries within both
+     the sequence number and the time range are reported */
+  typedef struct _bst_history_query_ {
+    uint64_t startSeq;
+    uint64_t endSeq;
+    /* wall clock time of the collection, in nano seconds */
+    uint64_t startNs;
+    uint64_t endNs;
+    /* entries of the response, 0 is as many as fit */
+    unsigned int maxEntries;
+  }BVIEW_BST_HISTORY_QUERY_t;
+
+  /* bit per port of a query, ports are 1 based */
+#define BVIEW_BST_QUERY_PORT_WORDS   ((BVIEW_ASIC_MAX_PORTS / 64) + 1)
+
+  /* filters of a query of the history. Realm entries of the samples
+     within the time range which pass all the filters are matches */
+  typedef struct _bst_history_filter_ {
+    /* wall clock time of the collection, in nano seconds */
+    uint64_t startNs;
+    uint64_t endNs;
+    /* samples from this sequence number on, to resume a query */
+    uint64_t startSeq;
+    BVIEW_BST_REALM_MASK_t realms;
+    /* ports of the entries, the realms not kept per port do not
+       match when a port is set */
+    bool anyPort;
+    uint64_t ports[BVIEW_BST_QUERY_PORT_WORDS];
+    /* range of the 0 based priority group, service pool or queue */
+    unsigned int minIndex;
+    unsigned int maxIndex;
+    /* lowest occupancy of a match, in the units of the response */
+    uint64_t minOccupancy;
+    BVIEW_BST_QUERY_AGGREGATE_t aggregate;
+    /* samples of the response, 0 is as many as fit */
+    unsigned int maxEntries;
+    /* resolution of the samples in seconds, the buckets of the
+       coarsest rollup tier within it are walked. 0 for the samples
+       as collected */
+    unsigned int resolutionSec;
+  }BVIEW_BST_HISTORY_FILTER_t;
+
+  /* query of the streaming statistics. The filters are those of a
+     query of the history, the occupancy is matched against the max
+     of an entry in the window */
+  typedef struct _bst_sketch_query_ {
+    BVIEW_BST_HISTORY_FILTER_t filter;
+    /* slices within this many seconds of now, 0 for all of them */
+    unsigned int windowSec;
+    unsigned int numPercentiles;
+    double percentiles[BVIEW_BST_SKETCH_MAX_PERCENTILES];
+  }BVIEW_BST_SKETCH_QUERY_t;
+
+  /* query of the top entries, the entries of the realms with the
+     highest occupancy, per realm or of all the realms together */
+  typedef struct _bst_top_query_ {
+    BVIEW_BST_REALM_MASK_t realms;
+    /* entries of every realm, or of all of them */
+    unsigned int count;
+    bool perRealm;
+    /* slices within this many seconds of now, 0 for the record
+       collected last */
+    unsigned int windowSec;
+  }BVIEW_BST_TOP_QUERY_t;
+
   typedef struct _bst_request_msg_ {
     long msg_type; /* message type */
     int unit; /* variable to hold the asic type */
@@ -165,6 +364,22 @@ typedef enum _bst_cmd_ {
     char realm[JSON_MAX_NODE_LENGTH];
     unsigned int threshold_type;
     BVIEW_BST_THRESHOLD_CONFIG_t threshold;
+    /* read thresholds from HW and verify the shadow copy */
+    bool verify_hw;
+    /* thresholds of a bulk threshold set */
+    BVIEW_BST_THRESHOLD_BULK_t *bulk;
+    /* counter which raised the trigger of a trigger report */
+    BVIEW_BST_TRIGGER_INFO_t trigger;
+    /* realms of all the triggers merged into the trigger report */
+    BVIEW_BST_REALM_MASK_t trigger_realms;
+    /* entries of a history request, realms are in request.collect */
+    BVIEW_BST_HISTORY_QUERY_t history;
+    /* filters of a query of the history */
+    BVIEW_BST_HISTORY_FILTER_t filter;
+    /* window and percentiles of a query of the statistics */
+    BVIEW_BST_SKETCH_QUERY_t sketch;
+    /* realms, count and window of a query of the top entries */
+    BVIEW_BST_TOP_QUERY_t top;
     union
     {
       /* feature params */
@@ -199,11 +414,20 @@ typedef enum _bst_cmd_ {
     BVIEW_ASIC_CAPABILITIES_t *asic_capabilities;
     BVIEW_BST_REPORT_OPTIONS_t   options;
     BVIEW_STATUS rv; /* return value for set request */
+    /* trigger counters of the unit, for get feature */
+    BVIEW_BST_TRIGGER_STATS_t trigger_stats;
+    /* periodic collection counters of the unit, for get feature */
+    BVIEW_BST_COLLECTION_STATS_t collection_stats;
     union
     {
       BVIEW_BST_CONFIG_PARAMS_t *config;
       BVIEW_BST_TRACK_PARAMS_t  *track;
       BVIEW_BST_REPORT_RESP_t   report;
+      BVIEW_BST_THRESHOLD_BULK_t *bulk;
+      const BVIEW_BST_HISTORY_QUERY_t *history;
+      const BVIEW_BST_HISTORY_FILTER_t *filter;
+      const BVIEW_BST_SKETCH_QUERY_t *sketch;
+      const BVIEW_BST_TOP_QUERY_t *top;
     }response;
   }BVIEW_BST_RESPONSE_MSG_t;
 
@@ -213,6 +437,432 @@ typedef enum _bst_cmd_ {
     timer_t bstCollectionTimer;
   }BVIEW_BST_TIMER_t;
 
+  /* trigger admission state of a unit. Triggers raised while a report
+     is pending are merged into it, new reports are rate limited
+     by a token bucket */
+  typedef struct _bst_trigger_cxt_ {
+    /* protects the trigger state, taken in asic context */
+    pthread_mutex_t lock;
+    unsigned int unit;
+    /* coalesce window in milli seconds */
+    int coalesceInterval;
+    /* reports per second, 0 is unlimited */
+    int rateLimit;
+    /* size of the token bucket */
+    int burst;
+    /* available tokens, in thousandths of a token */
+    uint64_t tokens;
+    /* time of the last refill in milli seconds */
+    uint64_t lastRefill;
+    /* a trigger report is posted and not yet collected */
+    bool pending;
+    /* counter which opened the window */
+    BVIEW_BST_TRIGGER_INFO_t first;
+    /* realms of the triggers merged into the window */
+    BVIEW_BST_REALM_MASK_t realms;
+    /* one shot timer closing the coalesce window */
+    timer_t windowTimer;
+    bool timerInUse;
+    BVIEW_BST_TRIGGER_STATS_t stats;
+  }BVIEW_BST_TRIGGER_CXT_t;
+
+  /* periodic collection pacing of a unit. At most one periodic request
+     is queued, cycles longer than the interval are counted as overruns
+     and optionally stretch the interval */
+  typedef struct _bst_pacing_cxt_ {
+    /* protects the pacing state, taken in timer context */
+    pthread_mutex_t lock;
+    unsigned int unit;
+    /* configured collection interval in milli seconds */
+    int intervalMs;
+    /* stretch the interval on overruns */
+    bool adaptive;
+    /* a periodic request is posted and not yet completed */
+    bool pending;
+    /* consecutive cycles well within the stretched interval */
+    unsigned int quietCycles;
+    BVIEW_BST_COLLECTION_STATS_t stats;
+  }BVIEW_BST_PACING_CXT_t;
+
+  /* publication state of the records of a unit. Records are immutable
+     once published, readers hold a reference instead of the unit lock */
+  typedef struct _bst_snapshot_cxt_ {
+    /* protects the pool of released records */
+    pthread_mutex_t lock;
+    /* readers in the middle of taking a reference */
+    uint32_t readers;
+    /* released records kept for the next collections */
+    BVIEW_BST_REPORT_SNAPSHOT_t *pool[BVIEW_BST_SNAPSHOT_POOL_SIZE];
+    unsigned int poolCount;
+    /* shape of the records, sized from the asic capabilities */
+    BVIEW_BST_SNAPSHOT_LAYOUT_t layout;
+    /* full size record filled by the asic, packed into the records */
+    BVIEW_BST_ASIC_SNAPSHOT_DATA_t *scratch;
+  }BVIEW_BST_SNAPSHOT_CXT_t;
+
+  /* state of a stream of samples of the counters of a unit, the same
+     for its encoder and its decoder */
+  typedef struct _bst_codec_ {
+    unsigned int numCounters;
+    /* counters of the previous sample, owned by the user of the stream */
+    uint32_t *counters;
+    /* samples so far */
+    uint64_t numSamples;
+    /* time of the previous sample and its distance from the one before */
+    uint64_t prevNs;
+    int64_t prevDeltaNs;
+  }BVIEW_BST_CODEC_t;
+
+  /* encoder or decoder of the samples of a stream in a buffer */
+  typedef struct _bst_codec_iter_ {
+    BVIEW_BST_CODEC_t *codec;
+    uint8_t *buf;
+    size_t size;
+    /* position of the next sample */
+    size_t pos;
+  }BVIEW_BST_CODEC_ITER_t;
+
+  /* summary of a block of entries of the history, so that a query
+     skips the blocks which can not match without decoding them */
+  typedef struct _bst_history_block_ {
+    /* sequence number and position in the ring of the first entry */
+    uint64_t firstSeq;
+    size_t offset;
+    unsigned int numEntries;
+    /* wall clock time of the oldest and of the newest entry */
+    uint64_t minNs;
+    uint64_t maxNs;
+    /* highest occupancy of an entry of every realm, in cells */
+    uint32_t realmMax[BVIEW_BST_NUM_REALMS];
+  }BVIEW_BST_HISTORY_BLOCK_t;
+
+  /* snapshot history of a unit. Entries are kept in a byte ring, in
+     the order of their sequence numbers. An entry holds the counters
+     which changed since the entry before it, but the first entry of a
+     block which holds all of them. The counters before the oldest
+     entry are kept aside. Used in the bst context only */
+  typedef struct _bst_history_cxt_ {
+    unsigned int unit;
+    uint8_t *ring;
+    /* size of the ring, position of the oldest entry and bytes used */
+    size_t size;
+    size_t head;
+    size_t used;
+    /* sequence number of the oldest entry, and of the next entry */
+    uint64_t firstSeq;
+    uint64_t nextSeq;
+    /* counters of the records */
+    unsigned int numCounters;
+    /* counters before the oldest entry and after the newest one */
+    uint32_t *base;
+    uint32_t *last;
+    /* codec stream before the oldest entry and after the newest one */
+    BVIEW_BST_CODEC_t first;
+    BVIEW_BST_CODEC_t next;
+    /* an entry being encoded or decoded, and the oldest entry being
+       dropped to make room for it */
+    uint8_t *scratch;
+    uint8_t *evictScratch;
+    size_t scratchSize;
+    /* layout of the counters of the entries */
+    const BVIEW_BST_SNAPSHOT_LAYOUT_t *layout;
+    /* ring of the summaries of the blocks, oldest block first */
+    BVIEW_BST_HISTORY_BLOCK_t *blocks;
+    unsigned int maxBlocks;
+    unsigned int headBlock;
+    unsigned int numBlocks;
+  }BVIEW_BST_HISTORY_CXT_t;
+
+  /* snapshot journal of a unit. Records are appended to a memory
+     mapped file, the oldest one is always a keyframe */
+  typedef struct _bst_journal_cxt_ {
+    unsigned int unit;
+    int fd;
+    uint8_t *map;
+    size_t mapSize;
+    /* records area of the file, position of the oldest record and
+       of the next one */
+    uint8_t *data;
+    size_t dataSize;
+    size_t head;
+    size_t tail;
+    /* sequence number of the oldest record, and of the next record */
+    uint64_t firstSeq;
+    uint64_t nextSeq;
+    /* generation of the header written last */
+    uint64_t generation;
+    /* records appended since the last keyframe, and since the last flush */
+    unsigned int sinceKeyframe;
+    unsigned int sinceSync;
+    /* counters of the records */
+    unsigned int numCounters;
+    /* counters of the newest record, and the codec stream up to it */
+    uint32_t *last;
+    BVIEW_BST_CODEC_t codec;
+    /* a record being encoded or decoded */
+    uint8_t *scratch;
+    size_t scratchSize;
+    /* a record was published since the init, the file is not restored
+       once the collection has started */
+    bool published;
+    /* flusher of the file, writes the records and the header to the
+       disk off the bst context. The lock protects the position of the
+       oldest record and the requests to the flusher */
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    pthread_t flusher;
+    bool flusherRunning;
+    bool flushPending;
+    bool exitPending;
+  }BVIEW_BST_JOURNAL_CXT_t;
+
+  /* reports encoded and sent off the bst context. The queued responses
+     hold references on the records they report. The lock protects
+     the queue and the requests to the sender */
+  typedef struct _bst_sender_cxt_ {
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    pthread_t sender;
+    bool senderRunning;
+    bool exitPending;
+    /* responses to be sent, oldest first */
+    BVIEW_BST_RESPONSE_MSG_t queue[BVIEW_BST_SENDER_QUEUE_SIZE];
+    unsigned int head;
+    unsigned int count;
+  }BVIEW_BST_SENDER_CXT_t;
+
+  /* walk of the entries of a history request */
+  typedef struct _bst_history_walk_ {
+    unsigned int unit;
+    BVIEW_BST_HISTORY_QUERY_t query;
+    /* sequence number and position in the ring of the next entry */
+    uint64_t seq;
+    size_t offset;
+    /* entries returned so far */
+    unsigned int numEntries;
+    /* codec stream of the entries, decoded into current */
+    BVIEW_BST_CODEC_t codec;
+    /* counters after the entry walked last, and before it */
+    BVIEW_BST_REPORT_SNAPSHOT_t *current;
+    BVIEW_BST_REPORT_SNAPSHOT_t *previous;
+  }BVIEW_BST_HISTORY_WALK_t;
+
+  /* walk of the samples of a query of the history, block by block */
+  typedef struct _bst_history_query_walk_ {
+    unsigned int unit;
+    BVIEW_BST_HISTORY_FILTER_t filter;
+    /* lowest occupancy of a match, in cells */
+    uint32_t minCells;
+    /* buffer counts are multiplied with it for the response */
+    unsigned int cellToByteConv;
+    /* blocks visited, and entries of the block walked left */
+    unsigned int numBlocks;
+    unsigned int entriesLeft;
+    /* sequence number and position in the ring of the next entry */
+    uint64_t seq;
+    size_t offset;
+    /* codec stream of the block walked, decoded into counters */
+    BVIEW_BST_CODEC_t codec;
+    uint32_t *counters;
+    /* entries of the realms which pass the filters, a bitmap block
+       of the layout of the unit */
+    uint64_t *select;
+    /* matches of the sample walked last, or of the aggregate */
+    BVIEW_BST_QUERY_MATCH_t *matches;
+    /* per counter maximum, last value, sum and samples of the matches
+       of an aggregate */
+    uint32_t *aggMax;
+    uint32_t *aggLast;
+    uint64_t *aggSum;
+    uint32_t *aggCount;
+    /* sample aggregated last, and samples with a match */
+    uint64_t lastSeq;
+    uint64_t lastNs;
+    uint64_t numSamples;
+    /* all the samples are walked, and the aggregate is returned */
+    bool done;
+    bool aggregated;
+    BVIEW_BST_QUERY_STATS_t stats;
+  }BVIEW_BST_HISTORY_QUERY_WALK_t;
+
+  /* rollups of the counters of a unit at the resolution of a tier.
+     Closed buckets are kept in a byte ring, oldest first. The open
+     bucket is accumulated in place, from the samples for the first
+     tier and from the closed buckets of the tier below for the others */
+  typedef struct _bst_rollup_tier_ {
+    /* interval of a bucket in seconds, and closed buckets kept */
+    unsigned int intervalSec;
+    unsigned int retention;
+    uint8_t *ring;
+    /* size of the ring, position of the oldest bucket and bytes used */
+    size_t size;
+    size_t head;
+    size_t used;
+    unsigned int numBuckets;
+    /* start of the open bucket in nano seconds, and its samples,
+       0 if there is no open bucket */
+    uint64_t openNs;
+    uint64_t numSamples;
+    /* per counter max, min, sum and last value of the open bucket */
+    uint32_t *max;
+    uint32_t *min;
+    uint64_t *sum;
+    uint32_t *last;
+  }BVIEW_BST_ROLLUP_TIER_t;
+
+  /* rollups of a unit, finest tier first. Used in the bst context only */
+  typedef struct _bst_rollup_cxt_ {
+    unsigned int unit;
+    unsigned int numTiers;
+    BVIEW_BST_ROLLUP_TIER_t tiers[BVIEW_BST_ROLLUP_MAX_TIERS];
+    /* counters of the records */
+    unsigned int numCounters;
+    /* sample of the open bucket of the first tier from which a
+       counter holds its last value, so that its sum is only added
+       to when it changes */
+    uint32_t *since;
+    /* the record folded last is the one the next record is diffed
+       against, its change bitmaps can be walked */
+    bool synced;
+    /* mean of a bucket being closed, and the codec stream of it */
+    uint32_t *mean;
+    uint32_t *state;
+    BVIEW_BST_CODEC_t codec;
+    /* a bucket being encoded */
+    uint8_t *scratch;
+    size_t scratchSize;
+  }BVIEW_BST_ROLLUP_CXT_t;
+
+  /* walk of the buckets of a rollup tier for a query, oldest first,
+     the open bucket last */
+  typedef struct _bst_rollup_query_walk_ {
+    unsigned int unit;
+    unsigned int tier;
+    BVIEW_BST_HISTORY_FILTER_t filter;
+    /* lowest occupancy of a match, in cells */
+    uint32_t minCells;
+    /* buffer counts are multiplied with it for the response */
+    unsigned int cellToByteConv;
+    /* closed buckets visited, and position in the ring of the next one */
+    unsigned int numBuckets;
+    size_t offset;
+    /* max, min, mean and last values of the bucket walked, one array
+       of the counters after the other */
+    uint32_t *values;
+    BVIEW_BST_CODEC_t codec;
+    /* entries of the realms which pass the filters, a bitmap block
+       of the layout of the unit */
+    uint64_t *select;
+    /* matches of the bucket walked last */
+    BVIEW_BST_QUERY_MATCH_t *matches;
+    /* the open bucket is walked */
+    bool done;
+    BVIEW_BST_QUERY_STATS_t stats;
+  }BVIEW_BST_ROLLUP_QUERY_WALK_t;
+
+  /* streaming statistics of the counters of a unit, a histogram of
+     every counter per slice of time. The open slice is kept as is,
+     closed slices are kept in a byte ring with the buckets in use of
+     every counter only, oldest first. Used in the bst context only */
+  typedef struct _bst_sketch_cxt_ {
+    unsigned int unit;
+    /* interval of a slice in seconds */
+    unsigned int sliceSec;
+    uint8_t *ring;
+    /* size of the ring, position of the oldest slice and bytes used */
+    size_t size;
+    size_t head;
+    size_t used;
+    unsigned int numSlices;
+    /* counters of the records */
+    unsigned int numCounters;
+    /* start of the open slice in nano seconds, its samples, 0 if
+       there is no open slice, and the time of its last sample */
+    uint64_t openNs;
+    uint32_t numSamples;
+    uint64_t lastNs;
+    /* per counter samples of every bucket of the open slice, saturated */
+    uint16_t *counts;
+    /* per counter max of the open slice */
+    uint32_t *max;
+    /* per counter value held since a sample of the open slice, its
+       bucket is only added to when the value changes */
+    uint32_t *held;
+    uint32_t *since;
+    /* the record folded last is the one the next record is diffed
+       against, its change bitmaps can be walked */
+    bool synced;
+    /* a slice being encoded, and slices too long for the ring */
+    uint8_t *scratch;
+    size_t scratchSize;
+    unsigned int numDropped;
+  }BVIEW_BST_SKETCH_CXT_t;
+
+  /* entry of a realm in a top list, and its occupancy in cells */
+  typedef struct _bst_top_entry_ {
+    uint32_t entry;
+    uint32_t value;
+  }BVIEW_BST_TOP_ENTRY_t;
+
+  /* entries with the highest occupancy of every realm, a min heap
+     bounded to BVIEW_BST_TOP_MAX_ENTRIES. Entries with no occupancy
+     are not kept */
+  typedef struct _bst_top_list_ {
+    unsigned int numEntries[BVIEW_BST_NUM_REALMS];
+    BVIEW_BST_TOP_ENTRY_t entries[BVIEW_BST_NUM_REALMS][BVIEW_BST_TOP_MAX_ENTRIES];
+  }BVIEW_BST_TOP_LIST_t;
+
+  /* top list of the max occupancy of the entries over a slice */
+  typedef struct _bst_top_slice_ {
+    /* wall clock start of the slice, a multiple of the interval */
+    uint64_t startNs;
+    uint64_t numSamples;
+    BVIEW_BST_TOP_LIST_t list;
+  }BVIEW_BST_TOP_SLICE_t;
+
+  /* top entries of a unit, kept as the records are collected. The
+     list of the record folded last, and the list of every slice of
+     time, so that a query reads no more than the lists. Used in the
+     bst context only */
+  typedef struct _bst_top_cxt_ {
+    unsigned int unit;
+    /* entries of all the realms, 0 if the lists are not sized, and
+       the first entry of every realm in the arrays per entry */
+    unsigned int numEntries;
+    unsigned int base[BVIEW_BST_NUM_REALMS];
+    /* counters of the layout which are buffer counts, a bit each */
+    uint32_t bufferCounters;
+    /* counters are tracked as peaks, the lists are dropped when the
+       tracking mode changes */
+    bool peak;
+    /* per entry occupancy of the record folded last, and its list */
+    uint32_t *occupancy;
+    int32_t *latestPosition;
+    BVIEW_BST_TOP_LIST_t latest;
+    uint64_t latestNs;
+    /* per entry max of the open slice, 0 samples if there is no
+       open slice, and its list */
+    uint32_t *max;
+    int32_t *openPosition;
+    BVIEW_BST_TOP_SLICE_t open;
+    /* ring of the closed slices, oldest first */
+    BVIEW_BST_TOP_SLICE_t *slices;
+    unsigned int head;
+    unsigned int numSlices;
+    /* the record folded last is the one the next record is diffed
+       against, its change bitmaps can be walked */
+    bool synced;
+  }BVIEW_BST_TOP_CXT_t;
+
+  /* kernels computing the change bitmaps of a record */
+  typedef enum _bst_diff_kernel_ {
+    /* widest kernel the cpu supports */
+    BVIEW_BST_DIFF_KERNEL_AUTO = 0,
+    BVIEW_BST_DIFF_KERNEL_SCALAR,
+    BVIEW_BST_DIFF_KERNEL_SSE2,
+    BVIEW_BST_DIFF_KERNEL_AVX2
+  }BVIEW_BST_DIFF_KERNEL_t;
+
   typedef struct _bst_data_ {
     BVIEW_BST_TIMER_t bst_timer;
     BVIEW_BST_CFG_PARAMS_t bst_config;
@@ -222,12 +872,14 @@ typedef enum _bst_cmd_ {
 
   typedef struct _bst_context_unit_info__
 {
-  /* stats records */
+  /* stats records. The active record is published, its previous
+     record is the backup. The current record is being collected */
   BVIEW_BST_REPORT_SNAPSHOT_t *stats_active_record_ptr;
-  BVIEW_BST_REPORT_SNAPSHOT_t *stats_backup_record_ptr;
   BVIEW_BST_REPORT_SNAPSHOT_t *stats_current_record_ptr;
-  /* threshold records */
+  /* threshold records, published */
   BVIEW_BST_REPORT_SNAPSHOT_t *threshold_record_ptr;
+  /* reference counts and pool of the records */
+  BVIEW_BST_SNAPSHOT_CXT_t snapshot;
 
   /* config data */
   BVIEW_BST_DATA_t *bst_data;
@@ -240,6 +892,27 @@ typedef enum _bst_cmd_ {
   /* trigger callback cookie */
   int cb_cookie;
 
+  /* trigger coalescing and rate limiting */
+  BVIEW_BST_TRIGGER_CXT_t trigger;
+
+  /* periodic collection overrun detection and back-off */
+  BVIEW_BST_PACING_CXT_t pacing;
+
+  /* snapshot history */
+  BVIEW_BST_HISTORY_CXT_t history;
+
+  /* snapshot journal, persists across restarts */
+  BVIEW_BST_JOURNAL_CXT_t journal;
+
+  /* rollups of the counters at coarser resolutions */
+  BVIEW_BST_ROLLUP_CXT_t rollup;
+
+  /* streaming statistics of the counters */
+  BVIEW_BST_SKETCH_CXT_t sketch;
+
+  /* entries with the highest occupancy */
+  BVIEW_BST_TOP_CXT_t top;
+
 } BVIEW_BST_UNIT_CXT_t;
 
 
@@ -252,6 +925,8 @@ typedef enum _bst_cmd_ {
   int recvMsgQid;
   /* pthread ID*/
   pthread_t bst_thread;
+  /* sender of the reports of all units */
+  BVIEW_BST_SENDER_CXT_t sender;
 
   } BVIEW_BST_CXT_t;
 
@@ -336,6 +1011,54 @@ typedef struct _feature_bst_api_
               (_track_ptr)->trackEgressRqeQueue;                                        \
             }
 
+/* Macro to build the snapshot realm mask from track structure */
+#define BST_TRACK_TO_REALM_MASK(_track_ptr)                                          \
+            (((_track_ptr)->trackDevice ? BVIEW_BST_REALM_DEVICE : 0) |              \
+             ((_track_ptr)->trackIngressPortPriorityGroup ?                          \
+                        BVIEW_BST_REALM_INGRESS_PORT_PG : 0) |                       \
+             ((_track_ptr)->trackIngressPortServicePool ?                            \
+                        BVIEW_BST_REALM_INGRESS_PORT_SP : 0) |                       \
+             ((_track_ptr)->trackIngressServicePool ?                                \
+                        BVIEW_BST_REALM_INGRESS_SP : 0) |                            \
+             ((_track_ptr)->trackEgressPortServicePool ?                             \
+                        BVIEW_BST_REALM_EGRESS_PORT_SP : 0) |                        \
+             ((_track_ptr)->trackEgressServicePool ?                                 \
+                        BVIEW_BST_REALM_EGRESS_SP : 0) |                             \
+             ((_track_ptr)->trackEgressUcQueue ?                                     \
+                        BVIEW_BST_REALM_EGRESS_UC_QUEUE : 0) |                       \
+             ((_track_ptr)->trackEgressUcQueueGroup ?                                \
+                        BVIEW_BST_REALM_EGRESS_UC_QUEUEGROUPS : 0) |                 \
+             ((_track_ptr)->trackEgressMcQueue ?                                     \
+                        BVIEW_BST_REALM_EGRESS_MC_QUEUE : 0) |                       \
+             ((_track_ptr)->trackEgressCpuQueue ?                                    \
+                        BVIEW_BST_REALM_EGRESS_CPU_QUEUE : 0) |                      \
+             ((_track_ptr)->trackEgressRqeQueue ?                                    \
+                        BVIEW_BST_REALM_EGRESS_RQE_QUEUE : 0))
+
+/* Macro to build the snapshot realm mask from collect structure */
+#define BST_COLLECT_TO_REALM_MASK(_collect_ptr)                                      \
+            (((_collect_ptr)->includeDevice ? BVIEW_BST_REALM_DEVICE : 0) |          \
+             ((_collect_ptr)->includeIngressPortPriorityGroup ?                      \
+                        BVIEW_BST_REALM_INGRESS_PORT_PG : 0) |                       \
+             ((_collect_ptr)->includeIngressPortServicePool ?                        \
+                        BVIEW_BST_REALM_INGRESS_PORT_SP : 0) |                       \
+             ((_collect_ptr)->includeIngressServicePool ?                            \
+                        BVIEW_BST_REALM_INGRESS_SP : 0) |                            \
+             ((_collect_ptr)->includeEgressPortServicePool ?                         \
+                        BVIEW_BST_REALM_EGRESS_PORT_SP : 0) |                        \
+             ((_collect_ptr)->includeEgressServicePool ?                             \
+                        BVIEW_BST_REALM_EGRESS_SP : 0) |                             \
+             ((_collect_ptr)->includeEgressUcQueue ?                                 \
+                        BVIEW_BST_REALM_EGRESS_UC_QUEUE : 0) |                       \
+             ((_collect_ptr)->includeEgressUcQueueGroup ?                            \
+                        BVIEW_BST_REALM_EGRESS_UC_QUEUEGROUPS : 0) |                 \
+             ((_collect_ptr)->includeEgressMcQueue ?                                 \
+                        BVIEW_BST_REALM_EGRESS_MC_QUEUE : 0) |                       \
+             ((_collect_ptr)->includeEgressCpuQueue ?                                \
+                        BVIEW_BST_REALM_EGRESS_CPU_QUEUE : 0) |                      \
+             ((_collect_ptr)->includeEgressRqeQueue ?                                \
+                        BVIEW_BST_REALM_EGRESS_RQE_QUEUE : 0))
+
 /* Macro to copy collect structures to response options structure */
 
 #define  BST_COPY_COLLECT_TO_RESP(_collect_ptr, _resp_ptr)                                 \
@@ -522,6 +1245,50 @@ BVIEW_STATUS bst_config_track_get(BVIEW_BST_REQUEST_MSG_t *msg_data);
 *********************************************************************/
 BVIEW_STATUS bst_get_report(BVIEW_BST_REQUEST_MSG_t *msg_data);
 
+/*********************************************************************
+* @brief : application function to validate a history request
+*
+* @param[in] msg_data : pointer to the bst message request.
+*
+* @retval  : BVIEW_STATUS_SUCCESS : the history is enabled.
+* @retval  : BVIEW_STATUS_RESOURCE_NOT_AVAILABLE : the history is disabled.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : the entries are read when the response is encoded.
+*
+*********************************************************************/
+BVIEW_STATUS bst_get_history(BVIEW_BST_REQUEST_MSG_t *msg_data);
+
+/*********************************************************************
+* @brief : application function to validate a statistics request
+*
+* @param[in] msg_data : pointer to the bst message request.
+*
+* @retval  : BVIEW_STATUS_SUCCESS : the statistics are enabled.
+* @retval  : BVIEW_STATUS_RESOURCE_NOT_AVAILABLE : the statistics are
+*                                                 disabled.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : the histograms are merged when the response is encoded.
+*
+*********************************************************************/
+BVIEW_STATUS bst_get_statistics(BVIEW_BST_REQUEST_MSG_t *msg_data);
+
+/*********************************************************************
+* @brief : application function to validate a top entries request
+*
+* @param[in] msg_data : pointer to the bst message request.
+*
+* @retval  : BVIEW_STATUS_SUCCESS : the top lists are kept.
+* @retval  : BVIEW_STATUS_RESOURCE_NOT_AVAILABLE : the top lists are
+*                                                 not sized.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : the lists are merged when the response is encoded.
+*
+*********************************************************************/
+BVIEW_STATUS bst_get_top(BVIEW_BST_REQUEST_MSG_t *msg_data);
+
 /*********************************************************************
 * @brief : function to add timer for the periodic stats collection 
 *
@@ -665,6 +1432,45 @@ BVIEW_STATUS bst_periodic_collection_cb (union sigval sigval);
 *
 *********************************************************************/
 BVIEW_STATUS bst_config_threshold_set (BVIEW_BST_REQUEST_MSG_t * msg_data);
+
+/*********************************************************************
+* @brief : set the thresholds of a bulk request
+*
+* @param[in] msg_data : pointer to the bst message request.
+*
+* @retval  : BVIEW_STATUS_SUCCESS - thresholds are passed to the asic,
+*                                   status of each threshold is in the request
+* @retval  : BVIEW_STATUS_UNSUPPORTED - bulk threshold set is not supported
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameters to function.
+*
+* @note    : All the valid thresholds are applied in one SB batch.
+*
+*********************************************************************/
+BVIEW_STATUS bst_config_threshold_bulk_set (BVIEW_BST_REQUEST_MSG_t * msg_data);
+
+/*********************************************************************
+* @brief : allocate the thresholds of a bulk request
+*
+* @param[in] numEntries : number of thresholds in the request
+*
+* @retval  : pointer to the bulk request, NULL if out of memory
+*
+* @note    : status of every threshold is initialized to failure.
+*
+*********************************************************************/
+BVIEW_BST_THRESHOLD_BULK_t *bst_threshold_bulk_alloc (unsigned int numEntries);
+
+/*********************************************************************
+* @brief : free the thresholds of a bulk request
+*
+* @param[in] bulk : pointer to the bulk request
+*
+* @retval  : none
+*
+* @note    : NULL is ignored.
+*
+*********************************************************************/
+void bst_threshold_bulk_free (BVIEW_BST_THRESHOLD_BULK_t *bulk);
 /*********************************************************************
 * @brief : function to clear the threshold set
 *
@@ -717,7 +1523,7 @@ BVIEW_STATUS bst_update_data(BVIEW_BST_REPORT_TYPE_t type,unsigned int unit);
 *
 * @param[in] unit : unit for which the trigger is generated 
 * @param[in] cookie : cookie
-* @param[in] type : trigger type
+* @param[in] triggerInfo : realm, port and index which raised the trigger
 *
 * @retval  : BVIEW_STATUS_SUCCESS : successfully posted message to bst
 * @retval  : BVIEW_STATUS_FAILURE : message posting to bst queue failed.
@@ -731,7 +1537,7 @@ BVIEW_STATUS bst_update_data(BVIEW_BST_REPORT_TYPE_t type,unsigned int unit);
 *          application take a trigger report and sends the same to collector.
 *
 *************************************************************/
-BVIEW_STATUS bst_trigger_cb(int unit,void *cookie,BVIEW_BST_TRIGGER_TYPE type);
+BVIEW_STATUS bst_trigger_cb(int unit,void *cookie,BVIEW_BST_TRIGGER_INFO_t *triggerInfo);
 
 /*********************************************************************
 * @brief : REST API handler to clear the bst stats
@@ -907,10 +1713,1242 @@ BVIEW_STATUS bstjson_get_bst_tracking_impl(void *cookie,int asicId,int id,BSTJSO
  *********************************************************************/
 BVIEW_STATUS bst_type_api_get (int type, BVIEW_BST_API_HANDLER_t *handler);
 
+/*********************************************************************
+* @brief : initializes the trigger admission state of a unit
+*
+* @param[in] unit : unit id
+*
+* @retval  : BVIEW_STATUS_SUCCESS : trigger state is initialized.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+*********************************************************************/
+BVIEW_STATUS bst_trigger_init (unsigned int unit);
 
-#ifdef __cplusplus
-}
-#endif
+/*********************************************************************
+* @brief : releases the trigger admission state of a unit
+*
+* @param[in] unit : unit id
+*
+* @retval  : none
+*
+* @note    : deletes the coalesce window timer, if any.
+*
+*********************************************************************/
+void bst_trigger_uninit (unsigned int unit);
 
-#endif /* INCLUDE_BST_APP_H */
+/*********************************************************************
+* @brief : sets the trigger coalesce and rate limit parameters
+*
+* @param[in] unit : unit id
+* @param[in] coalesceInterval : coalesce window in milli seconds
+* @param[in] rateLimit : trigger reports per second, 0 is unlimited
+* @param[in] burst : trigger reports allowed back to back
+*
+* @retval  : BVIEW_STATUS_SUCCESS : parameters are applied.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : the token bucket is refilled to the new burst.
+*
+*********************************************************************/
+BVIEW_STATUS bst_trigger_config_set (unsigned int unit, int coalesceInterval,
+                                     int rateLimit, int burst);
+
+/*********************************************************************
+* @brief : admits a trigger raised by the asic
+*
+* @param[in] unit : unit id
+* @param[in] triggerInfo : counter which raised the trigger
+*
+* @retval  : BVIEW_STATUS_SUCCESS : trigger is posted, merged or dropped.
+* @retval  : BVIEW_STATUS_FAILURE : failed to post the trigger report.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : invoked in the asic context. A trigger raised while a report
+*            is pending is merged into it. Otherwise a token is taken and
+*            the report is posted once the coalesce window closes.
+*
+*********************************************************************/
+BVIEW_STATUS bst_trigger_admit (unsigned int unit,
+                                BVIEW_BST_TRIGGER_INFO_t *triggerInfo);
+
+/*********************************************************************
+* @brief : collects the pending trigger of a unit into the request
+*
+* @param[in,out] msg_data : trigger report request
+*
+* @retval  : BVIEW_STATUS_SUCCESS : trigger info is copied.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : invoked in the bst context, reopens the admission of triggers.
+*
+*********************************************************************/
+BVIEW_STATUS bst_trigger_take (BVIEW_BST_REQUEST_MSG_t *msg_data);
+
+/*********************************************************************
+* @brief : reads the trigger counters of a unit
+*
+* @param[in] unit : unit id
+* @param[out] stats : trigger counters
+*
+* @retval  : BVIEW_STATUS_SUCCESS : counters are copied.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+*********************************************************************/
+BVIEW_STATUS bst_trigger_stats_get (unsigned int unit,
+                                    BVIEW_BST_TRIGGER_STATS_t *stats);
+
+/*********************************************************************
+* @brief : initializes the periodic collection pacing state of a unit
+*
+* @param[in] unit : unit id
+*
+* @retval  : BVIEW_STATUS_SUCCESS : pacing state is initialized.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+*********************************************************************/
+BVIEW_STATUS bst_pacing_init (unsigned int unit);
+
+/*********************************************************************
+* @brief : releases the periodic collection pacing state of a unit
+*
+* @param[in] unit : unit id
+*
+* @retval  : none
+*
+*********************************************************************/
+void bst_pacing_uninit (unsigned int unit);
+
+/*********************************************************************
+* @brief : sets the collection interval and the adaptive back-off
+*
+* @param[in] unit : unit id
+* @param[in] intervalMs : configured collection interval in milli seconds
+* @param[in] adaptive : stretch the interval on overruns
+*
+* @retval  : BVIEW_STATUS_SUCCESS : parameters are applied.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : the interval in use is reset to the configured one.
+*
+*********************************************************************/
+BVIEW_STATUS bst_pacing_config_set (unsigned int unit, int intervalMs,
+                                    bool adaptive);
+
+/*********************************************************************
+* @brief : returns the collection interval in use for a unit
+*
+* @param[in] unit : unit id
+*
+* @retval  : interval in milli seconds
+*
+*********************************************************************/
+int bst_pacing_interval_get (unsigned int unit);
+
+/*********************************************************************
+* @brief : admits a tick of the periodic collection timer
+*
+* @param[in] unit : unit id
+*
+* @retval  : BVIEW_STATUS_SUCCESS : the periodic request is to be posted.
+* @retval  : BVIEW_STATUS_NOTREADY : the previous cycle is still
+*                                    pending, the tick is skipped.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : invoked in the timer context.
+*
+*********************************************************************/
+BVIEW_STATUS bst_pacing_tick (unsigned int unit);
+
+/*********************************************************************
+* @brief : releases the tick of a periodic request which is not posted
+*
+* @param[in] unit : unit id
+*
+* @retval  : none
+*
+*********************************************************************/
+void bst_pacing_tick_cancel (unsigned int unit);
+
+/*********************************************************************
+* @brief : accounts a completed periodic collection cycle
+*
+* @param[in] unit : unit id
+* @param[in] collectNs : time taken to collect the snapshot, in nano seconds
+* @param[in] reportNs : time taken to hand the report to the sender, in nano seconds
+*
+* @retval  : BVIEW_STATUS_SUCCESS : cycle is accounted.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : invoked in the bst context, detects overruns and applies
+*            the adaptive back-off.
+*
+*********************************************************************/
+BVIEW_STATUS bst_pacing_cycle_end (unsigned int unit, uint64_t collectNs,
+                                   uint64_t reportNs);
+
+/*********************************************************************
+* @brief : accounts a periodic report dropped as the sender is behind
+*
+* @param[in] unit : unit id
+*
+* @retval  : none
+*
+*********************************************************************/
+void bst_pacing_report_drop (unsigned int unit);
+
+/*********************************************************************
+* @brief : reads the periodic collection counters of a unit
+*
+* @param[in] unit : unit id
+* @param[out] stats : collection counters
+*
+* @retval  : BVIEW_STATUS_SUCCESS : counters are copied.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+*********************************************************************/
+BVIEW_STATUS bst_pacing_stats_get (unsigned int unit,
+                                   BVIEW_BST_COLLECTION_STATS_t *stats);
+
+/*********************************************************************
+* @brief : initializes the snapshot records state of a unit
+*
+* @param[in] unit : unit id
+*
+* @retval  : BVIEW_STATUS_SUCCESS : state is initialized.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+*********************************************************************/
+BVIEW_STATUS bst_snapshot_init (unsigned int unit);
+
+/*********************************************************************
+* @brief : releases the records of a unit
+*
+* @param[in] unit : unit id
+*
+* @retval  : none
+*
+*********************************************************************/
+void bst_snapshot_uninit (unsigned int unit);
 
+/*********************************************************************
+* @brief : allocates a cleared record
+*
+* @param[in] unit : unit id
+*
+* @retval  : record holding one reference, NULL if out of memory
+*
+*********************************************************************/
+BVIEW_BST_REPORT_SNAPSHOT_t *bst_snapshot_alloc (unsigned int unit);
+
+/*********************************************************************
+* @brief : drops a reference on a record
+*
+* @param[in] unit : unit id
+* @param[in] ss : record, may be NULL
+*
+* @retval  : none
+*
+*********************************************************************/
+void bst_snapshot_put (unsigned int unit, BVIEW_BST_REPORT_SNAPSHOT_t *ss);
+
+/*********************************************************************
+* @brief : publishes a collected record
+*
+* @param[in] unit : unit id
+* @param[in] type : BVIEW_BST_STATS or BVIEW_BST_THRESHOLD
+* @param[in] ss : record, the reference of the caller moves to the unit
+*
+* @retval  : BVIEW_STATUS_SUCCESS : record is published.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : invoked in the bst context only.
+*
+*********************************************************************/
+BVIEW_STATUS bst_snapshot_publish (unsigned int unit, BVIEW_BST_REPORT_TYPE_t type,
+                                   BVIEW_BST_REPORT_SNAPSHOT_t *ss);
+
+/*********************************************************************
+* @brief : publishes a cleared record in place of the collected ones
+*
+* @param[in] unit : unit id
+* @param[in] type : BVIEW_BST_STATS or BVIEW_BST_THRESHOLD
+*
+* @retval  : BVIEW_STATUS_SUCCESS : cleared record is published.
+* @retval  : BVIEW_STATUS_OUTOFMEMORY : no memory for the record.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : invoked in the bst context only.
+*
+*********************************************************************/
+BVIEW_STATUS bst_snapshot_clear (unsigned int unit, BVIEW_BST_REPORT_TYPE_t type);
+
+/*********************************************************************
+* @brief : takes a reference on the published record
+*
+* @param[in] unit : unit id
+* @param[in] type : BVIEW_BST_STATS or BVIEW_BST_THRESHOLD
+* @param[out] ss : published record
+* @param[out] previous : record published before the stats record,
+*                        may be NULL if not required
+*
+* @retval  : BVIEW_STATUS_SUCCESS : references are taken.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+*********************************************************************/
+BVIEW_STATUS bst_snapshot_acquire (unsigned int unit, BVIEW_BST_REPORT_TYPE_t type,
+                                   BVIEW_BST_REPORT_SNAPSHOT_t **ss,
+                                   BVIEW_BST_REPORT_SNAPSHOT_t **previous);
+
+/*********************************************************************
+* @brief : computes the shape of the records of an asic
+*
+* @param[out] layout : layout, the queue port maps are not allocated
+* @param[in] asic : capabilities of the asic
+*
+* @retval  : BVIEW_STATUS_SUCCESS : layout is computed.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+*********************************************************************/
+BVIEW_STATUS bst_snapshot_layout_init (BVIEW_BST_SNAPSHOT_LAYOUT_t *layout,
+                                       const BVIEW_ASIC_CAPABILITIES_t *asic);
+
+/*********************************************************************
+* @brief : sizes the records of a unit from the asic capabilities
+*
+* @param[in] unit : unit id
+* @param[in] asic : capabilities of the asic
+*
+* @retval  : BVIEW_STATUS_SUCCESS : layout is set.
+* @retval  : BVIEW_STATUS_OUTOFMEMORY : no memory for the layout.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : invoked once, before any record of the unit is allocated.
+*
+*********************************************************************/
+BVIEW_STATUS bst_snapshot_layout_set (unsigned int unit,
+                                      const BVIEW_ASIC_CAPABILITIES_t *asic);
+
+/*********************************************************************
+* @brief : returns the full size record of a unit to be filled by the asic
+*
+* @param[in] unit : unit id
+*
+* @retval  : record, NULL for an invalid unit
+*
+* @note    : invoked in the bst context only. The realms read into
+*            the record are moved to a record with bst_snapshot_pack.
+*
+*********************************************************************/
+BVIEW_BST_ASIC_SNAPSHOT_DATA_t *bst_snapshot_scratch_get (unsigned int unit);
+
+/*********************************************************************
+* @brief : moves realms of the full size record into a record
+*
+* @param[in] unit : unit id
+* @param[in] realmMask : realms read into the full size record
+* @param[in] ss : record being collected
+*
+* @retval  : BVIEW_STATUS_SUCCESS : realms are packed.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : invoked in the bst context only.
+*
+*********************************************************************/
+BVIEW_STATUS bst_snapshot_pack (unsigned int unit, BVIEW_BST_REALM_MASK_t realmMask,
+                                BVIEW_BST_REPORT_SNAPSHOT_t *ss);
+
+/*********************************************************************
+* @brief : returns whether a stats record holds every tracked realm
+*
+* @param[in] unit : unit id
+* @param[in] ss : record
+*
+* @retval  : true : every tracked realm is read into the record.
+* @retval  : false : the record is of a few realms, the others are
+*                    carried over from the record before it.
+*
+*********************************************************************/
+bool bst_snapshot_is_complete (unsigned int unit, const BVIEW_BST_REPORT_SNAPSHOT_t *ss);
+
+/*********************************************************************
+* @brief : computes the entries of a record to be reported
+*
+* @param[in,out] current : record, its bitmaps are set
+* @param[in] previous : previous record of the same unit, may be NULL
+*
+* @retval  : BVIEW_STATUS_SUCCESS : bitmaps are set.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : invoked once per record, when it is published.
+*
+*********************************************************************/
+BVIEW_STATUS bst_diff_compute (BVIEW_BST_SNAPSHOT_DATA_t *current,
+                               const BVIEW_BST_SNAPSHOT_DATA_t *previous);
+
+/*********************************************************************
+* @brief : computes the entries of a record to be reported with the
+*          given kernel
+*
+* @param[in] type : kernel, BVIEW_BST_DIFF_KERNEL_AUTO for the widest
+*                   one the cpu supports
+* @param[in,out] current : record, its bitmaps are set
+* @param[in] previous : previous record of the same layout, may be NULL
+*
+* @retval  : BVIEW_STATUS_SUCCESS : bitmaps are set.
+* @retval  : BVIEW_STATUS_UNSUPPORTED : the cpu does not support the
+*                                       kernel.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+*********************************************************************/
+BVIEW_STATUS bst_diff_kernel_compute (BVIEW_BST_DIFF_KERNEL_t type,
+                                      BVIEW_BST_SNAPSHOT_DATA_t *current,
+                                      const BVIEW_BST_SNAPSHOT_DATA_t *previous);
+
+
+/*********************************************************************
+* @brief : initializes the snapshot history of a unit
+*
+* @param[in] unit : unit id
+*
+* @retval  : BVIEW_STATUS_SUCCESS : history is initialized.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+*********************************************************************/
+BVIEW_STATUS bst_history_init (unsigned int unit);
+
+/*********************************************************************
+* @brief : releases the snapshot history of a unit
+*
+* @param[in] unit : unit id
+*
+* @retval  : none
+*
+*********************************************************************/
+void bst_history_uninit (unsigned int unit);
+
+/*********************************************************************
+* @brief : sizes the snapshot history of a unit
+*
+* @param[in] unit : unit id
+* @param[in] sizeMb : size of the history in MB, 0 disables it
+*
+* @retval  : BVIEW_STATUS_SUCCESS : history is sized.
+* @retval  : BVIEW_STATUS_OUTOFMEMORY : no memory for the history.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : the entries are dropped when the size changes.
+*
+*********************************************************************/
+BVIEW_STATUS bst_history_config_set (unsigned int unit, int sizeMb);
+
+/*********************************************************************
+* @brief : adds a stats record to the snapshot history of a unit
+*
+* @param[in] unit : unit id
+* @param[in] ss : record, published
+*
+* @retval  : BVIEW_STATUS_SUCCESS : record is added, or the history
+*                                   is disabled.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : invoked in the bst context only.
+*
+*********************************************************************/
+BVIEW_STATUS bst_history_append (unsigned int unit,
+                                 const BVIEW_BST_REPORT_SNAPSHOT_t *ss);
+
+/*********************************************************************
+* @brief : adds an entry read back from the journal to the history
+*
+* @param[in] unit : unit id
+* @param[in] seq : sequence number of the entry
+* @param[in] realtimeNs : wall clock time of the collection
+* @param[in] counters : counters of the entry
+*
+* @retval  : BVIEW_STATUS_SUCCESS : entry is added, or the history
+*                                   is disabled.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : invoked in the bst context only, before the collection
+*            starts.
+*
+*********************************************************************/
+BVIEW_STATUS bst_history_restore (unsigned int unit, uint64_t seq,
+                                  uint64_t realtimeNs, const uint32_t *counters);
+
+/*********************************************************************
+* @brief : returns the wall clock time of a stats record
+*
+* @param[in] ss : record
+*
+* @retval  : time of the realm read last, in nano seconds
+*
+*********************************************************************/
+uint64_t bst_history_realtime_get (const BVIEW_BST_REPORT_SNAPSHOT_t *ss);
+
+/*********************************************************************
+* @brief : returns the sequence numbers and the usage of the history
+*
+* @param[in] unit : unit id
+* @param[out] info : sequence numbers and usage
+*
+* @retval  : BVIEW_STATUS_SUCCESS : info is returned.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+*********************************************************************/
+BVIEW_STATUS bst_history_info_get (unsigned int unit, BVIEW_BST_HISTORY_INFO_t *info);
+
+/*********************************************************************
+* @brief : starts a walk of the entries of a history request
+*
+* @param[in] unit : unit id
+* @param[in] query : range of the entries
+* @param[out] walk : walk, ended with bst_history_walk_end
+*
+* @retval  : BVIEW_STATUS_SUCCESS : walk is started.
+* @retval  : BVIEW_STATUS_RESOURCE_NOT_AVAILABLE : history is disabled.
+* @retval  : BVIEW_STATUS_OUTOFMEMORY : no memory for the records.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+*********************************************************************/
+BVIEW_STATUS bst_history_walk_start (unsigned int unit,
+                                     const BVIEW_BST_HISTORY_QUERY_t *query,
+                                     BVIEW_BST_HISTORY_WALK_t *walk);
+
+/*********************************************************************
+* @brief : returns the next entry of a history request
+*
+* @param[in] cookie : walk of the request
+* @param[out] entry : entry, valid till the next call
+*
+* @retval  : true : entry is returned.
+* @retval  : false : no more entries in the range.
+*
+*********************************************************************/
+bool bst_history_walk_next (void *cookie, BVIEW_BST_HISTORY_ENTRY_t *entry);
+
+/*********************************************************************
+* @brief : ends a walk of the entries of a history request
+*
+* @param[in] walk : walk
+*
+* @retval  : none
+*
+*********************************************************************/
+void bst_history_walk_end (BVIEW_BST_HISTORY_WALK_t *walk);
+
+/*********************************************************************
+* @brief : starts a walk of the samples of a query of the history
+*
+* @param[in] unit : unit id
+* @param[in] filter : filters of the query
+* @param[in] cellToByteConv : bytes per cell of the response, 1 to
+*                             respond in cells
+* @param[out] walk : walk, ended with bst_history_query_end
+*
+* @retval  : BVIEW_STATUS_SUCCESS : walk is started.
+* @retval  : BVIEW_STATUS_RESOURCE_NOT_AVAILABLE : history is disabled.
+* @retval  : BVIEW_STATUS_OUTOFMEMORY : no memory for the walk.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : invoked in the bst context only.
+*
+*********************************************************************/
+BVIEW_STATUS bst_history_query_start (unsigned int unit,
+                                      const BVIEW_BST_HISTORY_FILTER_t *filter,
+                                      unsigned int cellToByteConv,
+                                      BVIEW_BST_HISTORY_QUERY_WALK_t *walk);
+
+/*********************************************************************
+* @brief : returns the next sample of a query with a match, or the
+*          aggregate of the matches of all the samples
+*
+* @param[in] cookie : walk of the query
+* @param[out] sample : sample, valid till the next call
+*
+* @retval  : true : sample is returned.
+* @retval  : false : no more samples.
+*
+*********************************************************************/
+bool bst_history_query_next (void *cookie, BVIEW_BST_QUERY_SAMPLE_t *sample);
+
+/*********************************************************************
+* @brief : ends a walk of the samples of a query of the history
+*
+* @param[in] walk : walk
+*
+* @retval  : none
+*
+*********************************************************************/
+void bst_history_query_end (BVIEW_BST_HISTORY_QUERY_WALK_t *walk);
+
+/*********************************************************************
+* @brief : checks a small history against the records added to it
+*
+* @param[in] numRecords : records added, the ring wraps several times
+*
+* @retval  : BVIEW_STATUS_SUCCESS : every entry kept replays back to
+*                                   its record.
+* @retval  : BVIEW_STATUS_FAILURE : an entry did not replay back.
+* @retval  : BVIEW_STATUS_OUTOFMEMORY : no memory for the records.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : run by the bench tool, not by the agent.
+*
+*********************************************************************/
+BVIEW_STATUS bst_history_check (unsigned int numRecords);
+
+/*********************************************************************
+* @brief : returns whether a counter is a buffer count
+*
+* @param[in] counter : counter array
+*
+* @retval  : true : counter is a buffer count, in cells.
+* @retval  : false : counter is a count of queue entries.
+*
+*********************************************************************/
+bool bst_history_counter_is_buffer (BVIEW_BST_COUNTER_t counter);
+
+/*********************************************************************
+* @brief : returns the highest occupancy of the entries of every realm
+*
+* @param[in] layout : layout of the counters
+* @param[in] counters : counters of a record
+* @param[out] realmMax : occupancy of every realm, in cells
+*
+* @retval  : none
+*
+*********************************************************************/
+void bst_history_realm_max_get (const BVIEW_BST_SNAPSHOT_LAYOUT_t *layout,
+                                const uint32_t *counters, uint32_t *realmMax);
+
+/*********************************************************************
+* @brief : returns the port and the index of a realm entry
+*
+* @param[in] layout : layout of the counters
+* @param[in] realm : realm of the entry
+* @param[in] entry : entry, in the order of the realm
+* @param[out] port : 1 based port, 0 if the realm is not kept per port
+* @param[out] index : 0 based priority group, service pool or queue
+*
+* @retval  : none
+*
+*********************************************************************/
+void bst_history_entry_locate (const BVIEW_BST_SNAPSHOT_LAYOUT_t *layout,
+                               BVIEW_BST_REALM_t realm, unsigned int entry,
+                               unsigned int *port, unsigned int *index);
+
+/*********************************************************************
+* @brief : marks the entries which pass the realm, port and queue
+*          filters of a query
+*
+* @param[in] layout : layout of the counters
+* @param[in] filter : filters of the query
+* @param[out] select : bitmap block of the layout, cleared
+*
+* @retval  : entries marked
+*
+*********************************************************************/
+unsigned int bst_history_query_select (const BVIEW_BST_SNAPSHOT_LAYOUT_t *layout,
+                                       const BVIEW_BST_HISTORY_FILTER_t *filter,
+                                       uint64_t *select);
+
+/*********************************************************************
+* @brief : initializes the snapshot journal of a unit
+*
+* @param[in] unit : unit id
+*
+* @retval  : BVIEW_STATUS_SUCCESS : journal is initialized.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+*********************************************************************/
+BVIEW_STATUS bst_journal_init (unsigned int unit);
+
+/*********************************************************************
+* @brief : flushes and closes the snapshot journal of a unit
+*
+* @param[in] unit : unit id
+*
+* @retval  : none
+*
+*********************************************************************/
+void bst_journal_uninit (unsigned int unit);
+
+/*********************************************************************
+* @brief : sizes the snapshot journal of a unit, opens its file and
+*          restores its records
+*
+* @param[in] unit : unit id
+* @param[in] sizeMb : size of the file in MB, 0 closes the journal
+* @param[in] file : path of the file, the unit id is appended to it
+*
+* @retval  : BVIEW_STATUS_SUCCESS : journal is open, or disabled.
+* @retval  : BVIEW_STATUS_FAILURE : journal file could not be mapped.
+* @retval  : BVIEW_STATUS_OUTOFMEMORY : no memory for the journal.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : invoked once the records and the history of the unit
+*            are sized. The records are restored into the history
+*            before the first collection only.
+*
+*********************************************************************/
+BVIEW_STATUS bst_journal_config_set (unsigned int unit, unsigned int sizeMb,
+                                     const char *file);
+
+/*********************************************************************
+* @brief : adds a stats record to the snapshot journal of a unit
+*
+* @param[in] unit : unit id
+* @param[in] ss : record, published
+*
+* @retval  : BVIEW_STATUS_SUCCESS : record is added, or the journal
+*                                   is closed.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : invoked in the bst context only.
+*
+*********************************************************************/
+BVIEW_STATUS bst_journal_append (unsigned int unit,
+                                 const BVIEW_BST_REPORT_SNAPSHOT_t *ss);
+
+/*********************************************************************
+* @brief : writes the records of the snapshot journal of a unit
+*          to the disk and stops its flusher
+*
+* @param[in] unit : unit id
+*
+* @retval  : none
+*
+* @note    : invoked when the bst context exits.
+*
+*********************************************************************/
+void bst_journal_flush (unsigned int unit);
+
+/*********************************************************************
+* @brief : starts the sender of the reports
+*
+* @retval  : BVIEW_STATUS_SUCCESS : sender is started.
+* @retval  : BVIEW_STATUS_FAILURE : sender thread could not be created.
+*
+*********************************************************************/
+BVIEW_STATUS bst_sender_init (void);
+
+/*********************************************************************
+* @brief : sends the queued reports and stops the sender
+*
+* @retval  : none
+*
+* @note    : invoked once no more reports are posted.
+*
+*********************************************************************/
+void bst_sender_uninit (void);
+
+/*********************************************************************
+* @brief : queues a report response to be encoded and sent
+*
+* @param[in] reply_data : response, copied into the queue
+*
+* @retval  : BVIEW_STATUS_SUCCESS : response is queued, the references
+*                                   on its records move to the sender.
+* @retval  : BVIEW_STATUS_TABLE_FULL : queue is full, nothing is taken.
+* @retval  : BVIEW_STATUS_FAILURE : sender is stopped, nothing is taken.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : invoked in the bst context only.
+*
+*********************************************************************/
+BVIEW_STATUS bst_sender_post (const BVIEW_BST_RESPONSE_MSG_t *reply_data);
+
+/*********************************************************************
+* @brief : starts a stream of samples
+*
+* @param[out] codec : state of the stream
+* @param[in] counters : counters of the previous sample, cleared
+* @param[in] numCounters : counters of a sample
+*
+* @retval  : none
+*
+*********************************************************************/
+void bst_codec_init (BVIEW_BST_CODEC_t *codec, uint32_t *counters,
+                     unsigned int numCounters);
+
+/*********************************************************************
+* @brief : moves a stream to a sample stored without the codec
+*
+* @param[in,out] codec : state of the stream
+* @param[in] realtimeNs : time of the sample
+* @param[in] counters : counters of the sample, NULL if already in
+*                       the state
+*
+* @retval  : none
+*
+* @note    : the time stamps of the stream restart from the sample.
+*
+*********************************************************************/
+void bst_codec_sample_set (BVIEW_BST_CODEC_t *codec, uint64_t realtimeNs,
+                           const uint32_t *counters);
+
+/*********************************************************************
+* @brief : encodes a sample of a stream
+*
+* @param[in,out] codec : state of the stream
+* @param[in] realtimeNs : time of the sample
+* @param[in] counters : counters of the sample
+* @param[out] dst : encoded sample
+* @param[in] limit : size of dst
+*
+* @retval  : length of the encoded sample, 0 if it does not fit in the
+*            limit
+*
+*********************************************************************/
+size_t bst_codec_encode (BVIEW_BST_CODEC_t *codec, uint64_t realtimeNs,
+                         const uint32_t *counters, uint8_t *dst, size_t limit);
+
+/*********************************************************************
+* @brief : decodes a sample of a stream
+*
+* @param[in,out] codec : state of the stream, the counters of the
+*                        sample on return
+* @param[in] src : encoded sample
+* @param[in] len : bytes available at src
+* @param[out] realtimeNs : time of the sample
+*
+* @retval  : length of the encoded sample, 0 if it is not complete
+*
+*********************************************************************/
+size_t bst_codec_decode (BVIEW_BST_CODEC_t *codec, const uint8_t *src, size_t len,
+                         uint64_t *realtimeNs);
+
+/*********************************************************************
+* @brief : starts an iterator over a buffer of samples of a stream
+*
+* @param[out] iter : iterator
+* @param[in] codec : state of the stream
+* @param[in] buf : buffer of the samples
+* @param[in] size : size of the buffer, or of the samples in it
+*
+* @retval  : none
+*
+*********************************************************************/
+void bst_codec_iter_init (BVIEW_BST_CODEC_ITER_t *iter, BVIEW_BST_CODEC_t *codec,
+                          uint8_t *buf, size_t size);
+
+/*********************************************************************
+* @brief : appends a sample to the buffer of an iterator
+*
+* @param[in,out] iter : iterator
+* @param[in] realtimeNs : time of the sample
+* @param[in] counters : counters of the sample
+*
+* @retval  : true : sample is appended.
+* @retval  : false : buffer is full.
+*
+*********************************************************************/
+bool bst_codec_iter_put (BVIEW_BST_CODEC_ITER_t *iter, uint64_t realtimeNs,
+                         const uint32_t *counters);
+
+/*********************************************************************
+* @brief : returns the next sample of the buffer of an iterator
+*
+* @param[in,out] iter : iterator
+* @param[out] realtimeNs : time of the sample
+*
+* @retval  : true : sample is in the counters of the stream.
+* @retval  : false : no more samples.
+*
+*********************************************************************/
+bool bst_codec_iter_get (BVIEW_BST_CODEC_ITER_t *iter, uint64_t *realtimeNs);
+
+/*********************************************************************
+* @brief : initializes the rollups of a unit
+*
+* @param[in] unit : unit id
+*
+* @retval  : BVIEW_STATUS_SUCCESS : rollups are initialized.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+*********************************************************************/
+BVIEW_STATUS bst_rollup_init (unsigned int unit);
+
+/*********************************************************************
+* @brief : frees the rollups of a unit
+*
+* @param[in] unit : unit id
+*
+* @retval  : none
+*
+*********************************************************************/
+void bst_rollup_uninit (unsigned int unit);
+
+/*********************************************************************
+* @brief : sizes the rollups of a unit, the buckets so far are dropped
+*
+* @param[in] unit : unit id
+* @param[in] sizeMb : size of the rollups in MB, 0 disables them
+* @param[in] numTiers : tiers of the rollups
+* @param[in] intervalSec : interval of a bucket of every tier, in
+*                          seconds, finest first
+* @param[in] retention : buckets kept of every tier
+*
+* @retval  : BVIEW_STATUS_SUCCESS : rollups are sized.
+* @retval  : BVIEW_STATUS_OUTOFMEMORY : no memory for the rollups.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+*********************************************************************/
+BVIEW_STATUS bst_rollup_config_set (unsigned int unit, int sizeMb, int numTiers,
+                                    const int *intervalSec, const int *retention);
+
+/*********************************************************************
+* @brief : folds a stats record into the rollups of a unit
+*
+* @param[in] unit : unit id
+* @param[in] ss : record, published with its change bitmaps
+*
+* @retval  : BVIEW_STATUS_SUCCESS : record is folded, or the rollups
+*                                   are disabled.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+*********************************************************************/
+BVIEW_STATUS bst_rollup_append (unsigned int unit,
+                                const BVIEW_BST_REPORT_SNAPSHOT_t *ss);
+
+/*********************************************************************
+* @brief : folds an entry read back from the journal into the rollups
+*
+* @param[in] unit : unit id
+* @param[in] realtimeNs : wall clock time of the collection
+* @param[in] counters : counters of the entry
+*
+* @retval  : BVIEW_STATUS_SUCCESS : entry is folded, or the rollups
+*                                   are disabled.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+*********************************************************************/
+BVIEW_STATUS bst_rollup_restore (unsigned int unit, uint64_t realtimeNs,
+                                 const uint32_t *counters);
+
+/*********************************************************************
+* @brief : notes that the next stats record is not diffed against the
+*          record folded last
+*
+* @param[in] unit : unit id
+*
+* @retval  : none
+*
+*********************************************************************/
+void bst_rollup_resync (unsigned int unit);
+
+/*********************************************************************
+* @brief : returns the coarsest rollup tier within a resolution
+*
+* @param[in] unit : unit id
+* @param[in] resolutionSec : resolution, in seconds
+* @param[out] tier : tier
+*
+* @retval  : BVIEW_STATUS_SUCCESS : tier is returned.
+* @retval  : BVIEW_STATUS_RESOURCE_NOT_AVAILABLE : no tier is within
+*                                                 the resolution.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+*********************************************************************/
+BVIEW_STATUS bst_rollup_tier_select (unsigned int unit, unsigned int resolutionSec,
+                                     unsigned int *tier);
+
+/*********************************************************************
+* @brief : returns the bucket numbers and the usage of a rollup tier
+*
+* @param[in] unit : unit id
+* @param[in] tier : tier
+* @param[out] info : numbers of the oldest and past the open bucket,
+*                    and usage
+*
+* @retval  : BVIEW_STATUS_SUCCESS : info is returned.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+*********************************************************************/
+BVIEW_STATUS bst_rollup_info_get (unsigned int unit, unsigned int tier,
+                                  BVIEW_BST_HISTORY_INFO_t *info);
+
+/*********************************************************************
+* @brief : starts a walk of the buckets of a rollup tier for a query
+*
+* @param[in] unit : unit id
+* @param[in] tier : tier
+* @param[in] filter : filters of the query
+* @param[in] cellToByteConv : bytes per cell of the response, 1 to
+*                             respond in cells
+* @param[out] walk : walk, ended with bst_rollup_query_end
+*
+* @retval  : BVIEW_STATUS_SUCCESS : walk is started.
+* @retval  : BVIEW_STATUS_RESOURCE_NOT_AVAILABLE : rollups are disabled.
+* @retval  : BVIEW_STATUS_OUTOFMEMORY : no memory for the walk.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : invoked in the bst context only.
+*
+*********************************************************************/
+BVIEW_STATUS bst_rollup_query_start (unsigned int unit, unsigned int tier,
+                                     const BVIEW_BST_HISTORY_FILTER_t *filter,
+                                     unsigned int cellToByteConv,
+                                     BVIEW_BST_ROLLUP_QUERY_WALK_t *walk);
+
+/*********************************************************************
+* @brief : returns the next bucket of a rollup tier with a match
+*
+* @param[in] cookie : walk of the query
+* @param[out] sample : bucket, valid till the next call
+*
+* @retval  : true : bucket is returned.
+* @retval  : false : no more buckets.
+*
+*********************************************************************/
+bool bst_rollup_query_next (void *cookie, BVIEW_BST_QUERY_SAMPLE_t *sample);
+
+/*********************************************************************
+* @brief : ends a walk of the buckets of a rollup tier
+*
+* @param[in] walk : walk
+*
+* @retval  : none
+*
+*********************************************************************/
+void bst_rollup_query_end (BVIEW_BST_ROLLUP_QUERY_WALK_t *walk);
+
+/*********************************************************************
+* @brief : initializes the streaming statistics of a unit
+*
+* @param[in] unit : unit id
+*
+* @retval  : BVIEW_STATUS_SUCCESS : statistics are initialized.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+*********************************************************************/
+BVIEW_STATUS bst_sketch_init (unsigned int unit);
+
+/*********************************************************************
+* @brief : frees the streaming statistics of a unit
+*
+* @param[in] unit : unit id
+*
+* @retval  : none
+*
+*********************************************************************/
+void bst_sketch_uninit (unsigned int unit);
+
+/*********************************************************************
+* @brief : sizes the streaming statistics of a unit, the slices so
+*          far are dropped
+*
+* @param[in] unit : unit id
+* @param[in] sizeMb : size of the closed slices in MB, 0 disables them
+* @param[in] sliceSec : interval of a slice, in seconds
+*
+* @retval  : BVIEW_STATUS_SUCCESS : statistics are sized.
+* @retval  : BVIEW_STATUS_OUTOFMEMORY : no memory for the statistics.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : invoked in the bst context only, once the records of the
+*            unit are sized.
+*
+*********************************************************************/
+BVIEW_STATUS bst_sketch_config_set (unsigned int unit, int sizeMb, int sliceSec);
+
+/*********************************************************************
+* @brief : folds a stats record into the streaming statistics of a unit
+*
+* @param[in] unit : unit id
+* @param[in] ss : record, published with its change bitmaps
+*
+* @retval  : BVIEW_STATUS_SUCCESS : record is folded, or the statistics
+*                                   are disabled.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : invoked in the bst context only.
+*
+*********************************************************************/
+BVIEW_STATUS bst_sketch_append (unsigned int unit,
+                                const BVIEW_BST_REPORT_SNAPSHOT_t *ss);
+
+/*********************************************************************
+* @brief : folds an entry read back from the journal into the
+*          streaming statistics
+*
+* @param[in] unit : unit id
+* @param[in] realtimeNs : wall clock time of the collection
+* @param[in] counters : counters of the entry
+*
+* @retval  : BVIEW_STATUS_SUCCESS : entry is folded, or the statistics
+*                                   are disabled.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : invoked in the bst context only, before the collection
+*            starts.
+*
+*********************************************************************/
+BVIEW_STATUS bst_sketch_restore (unsigned int unit, uint64_t realtimeNs,
+                                 const uint32_t *counters);
+
+/*********************************************************************
+* @brief : notes that the next stats record is not diffed against the
+*          record folded last
+*
+* @param[in] unit : unit id
+*
+* @retval  : none
+*
+*********************************************************************/
+void bst_sketch_resync (unsigned int unit);
+
+/*********************************************************************
+* @brief : merges the histograms of the slices within a window and
+*          returns the percentiles of the entries which match a query
+*
+* @param[in] unit : unit id
+* @param[in] query : filters, window and percentiles of the query
+* @param[in] cellToByteConv : bytes per cell of the response, 1 to
+*                             respond in cells
+* @param[out] stats : statistics, freed with bst_sketch_query_end
+*
+* @retval  : BVIEW_STATUS_SUCCESS : statistics are returned.
+* @retval  : BVIEW_STATUS_RESOURCE_NOT_AVAILABLE : statistics are disabled.
+* @retval  : BVIEW_STATUS_OUTOFMEMORY : no memory for the query.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : invoked in the bst context only.
+*
+*********************************************************************/
+BVIEW_STATUS bst_sketch_query (unsigned int unit,
+                               const BVIEW_BST_SKETCH_QUERY_t *query,
+                               unsigned int cellToByteConv,
+                               BVIEW_BST_STATISTICS_t *stats);
+
+/*********************************************************************
+* @brief : frees the matches of a query of the streaming statistics
+*
+* @param[in] stats : statistics
+*
+* @retval  : none
+*
+*********************************************************************/
+void bst_sketch_query_end (BVIEW_BST_STATISTICS_t *stats);
+
+/*********************************************************************
+* @brief : initializes the top entries of a unit
+*
+* @param[in] unit : unit id
+*
+* @retval  : BVIEW_STATUS_SUCCESS : top entries are initialized.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+*********************************************************************/
+BVIEW_STATUS bst_top_init (unsigned int unit);
+
+/*********************************************************************
+* @brief : frees the top entries of a unit
+*
+* @param[in] unit : unit id
+*
+* @retval  : none
+*
+*********************************************************************/
+void bst_top_uninit (unsigned int unit);
+
+/*********************************************************************
+* @brief : sizes the top lists of a unit from its layout
+*
+* @param[in] unit : unit id
+*
+* @retval  : BVIEW_STATUS_SUCCESS : top lists are sized.
+* @retval  : BVIEW_STATUS_OUTOFMEMORY : no memory for the top lists.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : invoked in the bst context only, once the records of the
+*            unit are sized.
+*
+*********************************************************************/
+BVIEW_STATUS bst_top_config_set (unsigned int unit);
+
+/*********************************************************************
+* @brief : folds a stats record into the top entries of a unit
+*
+* @param[in] unit : unit id
+* @param[in] ss : record, published with its change bitmaps
+*
+* @retval  : BVIEW_STATUS_SUCCESS : record is folded, or the top lists
+*                                   are not sized.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : invoked in the bst context only.
+*
+*********************************************************************/
+BVIEW_STATUS bst_top_append (unsigned int unit,
+                             const BVIEW_BST_REPORT_SNAPSHOT_t *ss);
+
+/*********************************************************************
+* @brief : folds an entry read back from the journal into the top
+*          entries
+*
+* @param[in] unit : unit id
+* @param[in] realtimeNs : wall clock time of the collection
+* @param[in] counters : counters of the entry
+*
+* @retval  : BVIEW_STATUS_SUCCESS : entry is folded, or the top lists
+*                                   are not sized.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : invoked in the bst context only, before the collection
+*            starts.
+*
+*********************************************************************/
+BVIEW_STATUS bst_top_restore (unsigned int unit, uint64_t realtimeNs,
+                              const uint32_t *counters);
+
+/*********************************************************************
+* @brief : notes that the next stats record is not diffed against the
+*          record folded last
+*
+* @param[in] unit : unit id
+*
+* @retval  : none
+*
+*********************************************************************/
+void bst_top_resync (unsigned int unit);
+
+/*********************************************************************
+* @brief : returns the entries with the highest occupancy of the
+*          record folded last, or of the slices within a window
+*
+* @param[in] unit : unit id
+* @param[in] query : realms, count and window of the query
+* @param[in] cellToByteConv : bytes per cell of the response, 1 to
+*                             respond in cells
+* @param[out] top : top entries, freed with bst_top_query_end
+*
+* @retval  : BVIEW_STATUS_SUCCESS : top entries are returned.
+* @retval  : BVIEW_STATUS_RESOURCE_NOT_AVAILABLE : top lists are not sized.
+* @retval  : BVIEW_STATUS_OUTOFMEMORY : no memory for the query.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : invoked in the bst context only.
+*
+*********************************************************************/
+BVIEW_STATUS bst_top_query (unsigned int unit,
+                            const BVIEW_BST_TOP_QUERY_t *query,
+                            unsigned int cellToByteConv,
+                            BVIEW_BST_TOP_t *top);
+
+/*********************************************************************
+* @brief : frees the matches of a query of the top entries
+*
+* @param[in] top : top entries
+*
+* @retval  : none
+*
+*********************************************************************/
+void bst_top_query_end (BVIEW_BST_TOP_t *top);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INCLUDE_BST_APP_H */
@@ -0,0 +1,450 @@
+/*****************************************************************************
+  *
+  * (C) Copyright Broadcom Corporation 2015
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License");
+  * you may not use this file except in compliance with the License.
+  *
+  * You may obtain a copy of the License at
+  * http://www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ***************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <inttypes.h>
+#include <pthread.h>
+#include "json.h"
+#include "clear_bst_statistics.h"
+#include "clear_bst_thresholds.h"
+#include "configure_bst_thresholds.h"
+#include "configure_bst_feature.h"
+#include "configure_bst_tracking.h"
+#include "get_bst_tracking.h"
+#include "get_bst_feature.h"
+#include "get_bst_thresholds.h"
+#include "get_bst_report.h"
+#include "bst_json_encoder.h"
+#include "bst.h"
+#include "broadview.h"
+#include "bst_app.h"
+#include "openapps_log_api.h"
+
+/* A sample of the stream is, in bits
+ *   delta of delta of its time stamp, zigzag
+ *   number of counters which changed since the sample before
+ *   for each of them, the unchanged counters skipped before it and
+ *   the zigzag delta of its value
+ * Each of the fields is coded with a prefix selecting the width of
+ * the value, as in Gorilla. A sample is padded to a byte, so that the
+ * samples can be stored and dropped one at a time.
+ */
+
+/* widths of the value of a field, selected by a prefix of
+   0, 10, 110, ... and all ones for the last one */
+typedef struct _bst_codec_field_
+{
+  unsigned int numWidths;
+  unsigned int width[5];
+} BST_CODEC_FIELD_t;
+
+/* time stamps are collected at a fixed interval, with a jitter of a
+   few micro seconds */
+static const BST_CODEC_FIELD_t bst_codec_time_field = { 5, { 0, 16, 24, 32, 64 } };
+/* most of the counters do not change between two collections */
+static const BST_CODEC_FIELD_t bst_codec_count_field = { 4, { 0, 4, 10, 32 } };
+/* changes of neighbouring counters, queues of a port and the like */
+static const BST_CODEC_FIELD_t bst_codec_gap_field = { 4, { 0, 4, 10, 32 } };
+/* slowly varying buffer counts */
+static const BST_CODEC_FIELD_t bst_codec_delta_field = { 4, { 6, 13, 20, 34 } };
+
+/* bits of a sample being written or read */
+typedef struct _bst_codec_bits_
+{
+  uint8_t *buf;
+  size_t size;
+  size_t pos;
+  uint64_t acc;
+  unsigned int numBits;
+  bool overflow;
+} BST_CODEC_BITS_t;
+
+#define BST_CODEC_ZIGZAG(_v)    (((uint64_t) (_v) << 1) ^ (uint64_t) ((_v) >> 63))
+#define BST_CODEC_UNZIGZAG(_v)  ((int64_t) (((_v) >> 1) ^ (~((_v) & 1) + 1)))
+
+/*********************************************************************
+* @brief : appends bits to a sample
+*
+* @param[in,out] bits : sample being written
+* @param[in] value : bits, the low ones
+* @param[in] count : number of bits, up to 32
+*
+* @retval  : none
+*
+*********************************************************************/
+static void bst_codec_bits_put (BST_CODEC_BITS_t *bits, uint64_t value, unsigned int count)
+{
+  if (0 == count)
+  {
+    return;
+  }
+  bits->acc |= (value & ((1ULL << count) - 1)) << bits->numBits;
+  bits->numBits += count;
+  while (8 <= bits->numBits)
+  {
+    if (bits->pos >= bits->size)
+    {
+      bits->overflow = true;
+      bits->numBits = 0;
+      bits->acc = 0;
+      return;
+    }
+    bits->buf[bits->pos++] = (uint8_t) bits->acc;
+    bits->acc >>= 8;
+    bits->numBits -= 8;
+  }
+}
+
+/*********************************************************************
+* @brief : reads bits of a sample
+*
+* @param[in,out] bits : sample being read
+* @param[in] count : number of bits, up to 32
+*
+* @retval  : bits read, 0 past the end of the sample
+*
+*********************************************************************/
+static uint64_t bst_codec_bits_get (BST_CODEC_BITS_t *bits, unsigned int count)
+{
+  uint64_t value;
+
+  if (0 == count)
+  {
+    return 0;
+  }
+  while (bits->numBits < count)
+  {
+    if (bits->pos >= bits->size)
+    {
+      bits->overflow = true;
+      return 0;
+    }
+    bits->acc |= ((uint64_t) bits->buf[bits->pos++]) << bits->numBits;
+    bits->numBits += 8;
+  }
+  value = bits->acc & ((1ULL << count) - 1);
+  bits->acc >>= count;
+  bits->numBits -= count;
+  return value;
+}
+
+/*********************************************************************
+* @brief : appends a field to a sample
+*
+* @param[in,out] bits : sample being written
+* @param[in] field : widths of the field
+* @param[in] value : value of the field
+*
+* @retval  : none
+*
+*********************************************************************/
+static void bst_codec_field_put (BST_CODEC_BITS_t *bits, const BST_CODEC_FIELD_t *field,
+                                 uint64_t value)
+{
+  unsigned int index, width;
+
+  for (index = 0; index < (field->numWidths - 1); index++)
+  {
+    width = field->width[index];
+    if ((0 == width) ? (0 == value) : (0 == (value >> width)))
+    {
+      /* index ones and a zero */
+      bst_codec_bits_put (bits, (1ULL << index) - 1, index + 1);
+      break;
+    }
+  }
+  if (index == (field->numWidths - 1))
+  {
+    bst_codec_bits_put (bits, (1ULL << index) - 1, index);
+  }
+
+  width = field->width[index];
+  if (32 < width)
+  {
+    bst_codec_bits_put (bits, value, 32);
+    bst_codec_bits_put (bits, value >> 32, width - 32);
+  }
+  else
+  {
+    bst_codec_bits_put (bits, value, width);
+  }
+}
+
+/*********************************************************************
+* @brief : reads a field of a sample
+*
+* @param[in,out] bits : sample being read
+* @param[in] field : widths of the field
+*
+* @retval  : value of the field
+*
+*********************************************************************/
+static uint64_t bst_codec_field_get (BST_CODEC_BITS_t *bits, const BST_CODEC_FIELD_t *field)
+{
+  unsigned int index = 0, width;
+  uint64_t value;
+
+  while ((index < (field->numWidths - 1)) && (0 != bst_codec_bits_get (bits, 1)))
+  {
+    index++;
+  }
+
+  width = field->width[index];
+  if (32 < width)
+  {
+    value = bst_codec_bits_get (bits, 32);
+    value |= bst_codec_bits_get (bits, width - 32) << 32;
+  }
+  else
+  {
+    value = bst_codec_bits_get (bits, width);
+  }
+  return value;
+}
+
+/*********************************************************************
+* @brief : starts a stream of samples
+*
+* @param[out] codec : state of the stream
+* @param[in] counters : counters of the previous sample, cleared
+* @param[in] numCounters : counters of a sample
+*
+* @retval  : none
+*
+* @note    : the encoder and the decoder of a stream start from the
+*            same state.
+*
+*********************************************************************/
+void bst_codec_init (BVIEW_BST_CODEC_t *codec, uint32_t *counters,
+                     unsigned int numCounters)
+{
+  memset (codec, 0, sizeof (BVIEW_BST_CODEC_t));
+  codec->counters = counters;
+  codec->numCounters = numCounters;
+  if (NULL != counters)
+  {
+    memset (counters, 0, numCounters * sizeof (uint32_t));
+  }
+}
+
+/*********************************************************************
+* @brief : moves a stream to a sample stored without the codec
+*
+* @param[in,out] codec : state of the stream
+* @param[in] realtimeNs : time of the sample
+* @param[in] counters : counters of the sample, NULL if already in
+*                       the state
+*
+* @retval  : none
+*
+* @note    : the time stamps of the stream restart from the sample, so
+*            that a stream can be decoded from any such sample on.
+*
+*********************************************************************/
+void bst_codec_sample_set (BVIEW_BST_CODEC_t *codec, uint64_t realtimeNs,
+                           const uint32_t *counters)
+{
+  if ((NULL != counters) && (counters != codec->counters))
+  {
+    memcpy (codec->counters, counters, codec->numCounters * sizeof (uint32_t));
+  }
+  codec->prevDeltaNs = 0;
+  codec->prevNs = realtimeNs;
+  codec->numSamples++;
+}
+
+/*********************************************************************
+* @brief : encodes a sample of a stream
+*
+* @param[in,out] codec : state of the stream
+* @param[in] realtimeNs : time of the sample
+* @param[in] counters : counters of the sample
+* @param[out] dst : encoded sample
+* @param[in] limit : size of dst
+*
+* @retval  : length of the encoded sample, 0 if it does not fit in the
+*            limit
+*
+* @note    : the state moves to the sample only if it is encoded.
+*
+*********************************************************************/
+size_t bst_codec_encode (BVIEW_BST_CODEC_t *codec, uint64_t realtimeNs,
+                         const uint32_t *counters, uint8_t *dst, size_t limit)
+{
+  BST_CODEC_BITS_t bits;
+  const uint32_t *prev = codec->counters;
+  unsigned int index, last = 0, numChanged = 0;
+  int64_t delta;
+
+  memset (&bits, 0, sizeof (bits));
+  bits.buf = dst;
+  bits.size = limit;
+
+  delta = (int64_t) (realtimeNs - codec->prevNs);
+  bst_codec_field_put (&bits, &bst_codec_time_field,
+                       BST_CODEC_ZIGZAG (delta - codec->prevDeltaNs));
+
+  for (index = 0; index < codec->numCounters; index++)
+  {
+    numChanged += (0 != (prev[index] ^ counters[index])) ? 1 : 0;
+  }
+  bst_codec_field_put (&bits, &bst_codec_count_field, numChanged);
+
+  for (index = 0; (index < codec->numCounters) && (false == bits.overflow); index++)
+  {
+    if (0 == (prev[index] ^ counters[index]))
+    {
+      continue;
+    }
+    bst_codec_field_put (&bits, &bst_codec_gap_field, index - last);
+    bst_codec_field_put (&bits, &bst_codec_delta_field,
+                         BST_CODEC_ZIGZAG ((int64_t) counters[index] - (int64_t) prev[index]));
+    last = index + 1;
+  }
+
+  /* pad the sample to a byte */
+  bst_codec_bits_put (&bits, 0, (8 - (bits.numBits % 8)) % 8);
+  if (true == bits.overflow)
+  {
+    return 0;
+  }
+
+  memcpy (codec->counters, counters, codec->numCounters * sizeof (uint32_t));
+  codec->prevDeltaNs = delta;
+  codec->prevNs = realtimeNs;
+  codec->numSamples++;
+  return bits.pos;
+}
+
+/*********************************************************************
+* @brief : decodes a sample of a stream
+*
+* @param[in,out] codec : state of the stream, the counters of the
+*                        sample on return
+* @param[in] src : encoded sample
+* @param[in] len : bytes available at src
+* @param[out] realtimeNs : time of the sample
+*
+* @retval  : length of the encoded sample, 0 if it is not complete
+*
+*********************************************************************/
+size_t bst_codec_decode (BVIEW_BST_CODEC_t *codec, const uint8_t *src, size_t len,
+                         uint64_t *realtimeNs)
+{
+  BST_CODEC_BITS_t bits;
+  uint64_t numChanged, value;
+  uint64_t index = 0;
+  int64_t delta;
+
+  memset (&bits, 0, sizeof (bits));
+  bits.buf = (uint8_t *) src;
+  bits.size = len;
+
+  value = bst_codec_field_get (&bits, &bst_codec_time_field);
+  delta = codec->prevDeltaNs + BST_CODEC_UNZIGZAG (value);
+  *realtimeNs = codec->prevNs + (uint64_t) delta;
+
+  numChanged = bst_codec_field_get (&bits, &bst_codec_count_field);
+  while ((0 != numChanged--) && (false == bits.overflow))
+  {
+    index += bst_codec_field_get (&bits, &bst_codec_gap_field);
+    value = bst_codec_field_get (&bits, &bst_codec_delta_field);
+    if (index < codec->numCounters)
+    {
+      codec->counters[index] += (uint32_t) BST_CODEC_UNZIGZAG (value);
+    }
+    index++;
+  }
+  if (true == bits.overflow)
+  {
+    return 0;
+  }
+
+  codec->prevDeltaNs = delta;
+  codec->prevNs = *realtimeNs;
+  codec->numSamples++;
+  return bits.pos;
+}
+
+/*********************************************************************
+* @brief : starts an iterator over a buffer of samples of a stream
+*
+* @param[out] iter : iterator
+* @param[in] codec : state of the stream
+* @param[in] buf : buffer of the samples
+* @param[in] size : size of the buffer, or of the samples in it
+*
+* @retval  : none
+*
+*********************************************************************/
+void bst_codec_iter_init (BVIEW_BST_CODEC_ITER_t *iter, BVIEW_BST_CODEC_t *codec,
+                          uint8_t *buf, size_t size)
+{
+  iter->codec = codec;
+  iter->buf = buf;
+  iter->size = size;
+  iter->pos = 0;
+}
+
+/*********************************************************************
+* @brief : appends a sample to the buffer of an iterator
+*
+* @param[in,out] iter : iterator
+* @param[in] realtimeNs : time of the sample
+* @param[in] counters : counters of the sample
+*
+* @retval  : true : sample is appended.
+* @retval  : false : buffer is full.
+*
+*********************************************************************/
+bool bst_codec_iter_put (BVIEW_BST_CODEC_ITER_t *iter, uint64_t realtimeNs,
+                         const uint32_t *counters)
+{
+  size_t len;
+
+  len = bst_codec_encode (iter->codec, realtimeNs, counters,
+                          &iter->buf[iter->pos], iter->size - iter->pos);
+  iter->pos += len;
+  return (0 != len) ? true : false;
+}
+
+/*********************************************************************
+* @brief : returns the next sample of the buffer of an iterator
+*
+* @param[in,out] iter : iterator
+* @param[out] realtimeNs : time of the sample
+*
+* @retval  : true : sample is in the counters of the stream.
+* @retval  : false : no more samples.
+*
+*********************************************************************/
+bool bst_codec_iter_get (BVIEW_BST_CODEC_ITER_t *iter, uint64_t *realtimeNs)
+{
+  size_t len;
+
+  if (iter->pos >= iter->size)
+  {
+    return false;
+  }
+  len = bst_codec_decode (iter->codec, &iter->buf[iter->pos],
+                          iter->size - iter->pos, realtimeNs);
+  iter->pos += len;
+  return (0 != len) ? true : false;
+}
@@ -0,0 +1,426 @@
+/*****************************************************************************
+  *
+  * (C) Copyright Broadcom Corporation 2015
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License");
+  * you may not use this file except in compliance with the License.
+  *
+  * You may obtain a copy of the License at
+  * http://www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ***************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <inttypes.h>
+#include <pthread.h>
+#include "json.h"
+#include "clear_bst_statistics.h"
+#include "clear_bst_thresholds.h"
+#include "configure_bst_thresholds.h"
+#include "configure_bst_feature.h"
+#include "configure_bst_tracking.h"
+#include "get_bst_tracking.h"
+#include "get_bst_feature.h"
+#include "get_bst_thresholds.h"
+#include "get_bst_report.h"
+#include "bst_json_encoder.h"
+#include "bst.h"
+#include "broadview.h"
+#include "bst_app.h"
+#include "openapps_log_api.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define BST_DIFF_X86
+#include <immintrin.h>
+#endif
+
+/* compares blocks of BVIEW_BST_SNAPSHOT_ALIGN counters and sets the bit
+   of every counter which is non zero / differs from the previous one */
+typedef void (*BST_DIFF_KERNEL_t) (const uint32_t *current,
+                                   const uint32_t *previous,
+                                   unsigned int count,
+                                   uint64_t *nonzero, uint64_t *changed);
+
+/* ORs the bits of a block into the bitmap */
+#define BST_DIFF_BITS_SET(_bitmap, _index, _bits) \
+  ((_bitmap)[(_index) / 64] |= ((uint64_t) (_bits)) << ((_index) % 64))
+
+/* the kernels are optimized even if the rest of the agent is not.
+   The scalar kernel is the fallback of the cpus without the vector
+   kernels, vectorizing it is left to them */
+#if defined(__GNUC__) && !defined(__clang__)
+#define BST_DIFF_KERNEL_ATTR  __attribute__ ((optimize ("O2")))
+#define BST_DIFF_SCALAR_ATTR  __attribute__ ((optimize ("O2", "no-tree-vectorize")))
+#else
+#define BST_DIFF_KERNEL_ATTR
+#define BST_DIFF_SCALAR_ATTR
+#endif
+
+/* sets the bit of a lane of a block, if the counter is non zero /
+   differs from the previous one */
+#define BST_DIFF_LANE_NZ(_nz, _cur, _lane) \
+  ((_nz) |= ((uint32_t) (0 != (_cur)[(_lane)])) << (_lane))
+#define BST_DIFF_LANE_CH(_ch, _cur, _prev, _lane) \
+  ((_ch) |= ((uint32_t) ((_cur)[(_lane)] != (_prev)[(_lane)])) << (_lane))
+
+#if (16 != BVIEW_BST_SNAPSHOT_ALIGN)
+#error "bst_diff_scalar unrolls blocks of 16 counters"
+#endif
+
+/*********************************************************************
+* @brief : diff kernel, one counter at a time
+*
+* @param[in] current : counters of the record
+* @param[in] previous : counters of the previous record, may be NULL
+* @param[in] count : number of counters, multiple of BVIEW_BST_SNAPSHOT_ALIGN
+* @param[out] nonzero : bits of the non zero counters are set
+* @param[out] changed : bits of the changed counters are set
+*
+* @retval  : none
+*
+* @note    : the lanes of a block are unrolled, BVIEW_BST_SNAPSHOT_ALIGN
+*            is 16.
+*
+*********************************************************************/
+BST_DIFF_SCALAR_ATTR
+static void bst_diff_scalar (const uint32_t *current, const uint32_t *previous,
+                             unsigned int count,
+                             uint64_t *nonzero, uint64_t *changed)
+{
+  const uint32_t *cur, *prev;
+  unsigned int index;
+  uint32_t nz, ch;
+
+  for (index = 0; index < count; index += BVIEW_BST_SNAPSHOT_ALIGN)
+  {
+    cur = &current[index];
+    nz = 0;
+    BST_DIFF_LANE_NZ (nz, cur, 0);
+    BST_DIFF_LANE_NZ (nz, cur, 1);
+    BST_DIFF_LANE_NZ (nz, cur, 2);
+    BST_DIFF_LANE_NZ (nz, cur, 3);
+    BST_DIFF_LANE_NZ (nz, cur, 4);
+    BST_DIFF_LANE_NZ (nz, cur, 5);
+    BST_DIFF_LANE_NZ (nz, cur, 6);
+    BST_DIFF_LANE_NZ (nz, cur, 7);
+    BST_DIFF_LANE_NZ (nz, cur, 8);
+    BST_DIFF_LANE_NZ (nz, cur, 9);
+    BST_DIFF_LANE_NZ (nz, cur, 10);
+    BST_DIFF_LANE_NZ (nz, cur, 11);
+    BST_DIFF_LANE_NZ (nz, cur, 12);
+    BST_DIFF_LANE_NZ (nz, cur, 13);
+    BST_DIFF_LANE_NZ (nz, cur, 14);
+    BST_DIFF_LANE_NZ (nz, cur, 15);
+    BST_DIFF_BITS_SET (nonzero, index, nz);
+    if (NULL == previous)
+    {
+      continue;
+    }
+
+    prev = &previous[index];
+    ch = 0;
+    BST_DIFF_LANE_CH (ch, cur, prev, 0);
+    BST_DIFF_LANE_CH (ch, cur, prev, 1);
+    BST_DIFF_LANE_CH (ch, cur, prev, 2);
+    BST_DIFF_LANE_CH (ch, cur, prev, 3);
+    BST_DIFF_LANE_CH (ch, cur, prev, 4);
+    BST_DIFF_LANE_CH (ch, cur, prev, 5);
+    BST_DIFF_LANE_CH (ch, cur, prev, 6);
+    BST_DIFF_LANE_CH (ch, cur, prev, 7);
+    BST_DIFF_LANE_CH (ch, cur, prev, 8);
+    BST_DIFF_LANE_CH (ch, cur, prev, 9);
+    BST_DIFF_LANE_CH (ch, cur, prev, 10);
+    BST_DIFF_LANE_CH (ch, cur, prev, 11);
+    BST_DIFF_LANE_CH (ch, cur, prev, 12);
+    BST_DIFF_LANE_CH (ch, cur, prev, 13);
+    BST_DIFF_LANE_CH (ch, cur, prev, 14);
+    BST_DIFF_LANE_CH (ch, cur, prev, 15);
+    BST_DIFF_BITS_SET (changed, index, ch);
+  }
+}
+
+#ifdef __SSE2__
+/*********************************************************************
+* @brief : diff kernel, four counters at a time
+*
+* @param[in] current : counters of the record
+* @param[in] previous : counters of the previous record, may be NULL
+* @param[in] count : number of counters, multiple of BVIEW_BST_SNAPSHOT_ALIGN
+* @param[out] nonzero : bits of the non zero counters are set
+* @param[out] changed : bits of the changed counters are set
+*
+* @retval  : none
+*
+*********************************************************************/
+BST_DIFF_KERNEL_ATTR
+static void bst_diff_sse2 (const uint32_t *current, const uint32_t *previous,
+                           unsigned int count,
+                           uint64_t *nonzero, uint64_t *changed)
+{
+  const __m128i zero = _mm_setzero_si128 ();
+  __m128i cur, prev;
+  unsigned int index, lane;
+  uint32_t nz, ch;
+
+  for (index = 0; index < count; index += BVIEW_BST_SNAPSHOT_ALIGN)
+  {
+    nz = 0;
+    ch = 0;
+    for (lane = 0; lane < BVIEW_BST_SNAPSHOT_ALIGN; lane += 4)
+    {
+      cur = _mm_loadu_si128 ((const __m128i *) &current[index + lane]);
+      nz |= ((uint32_t) (~_mm_movemask_ps (_mm_castsi128_ps (_mm_cmpeq_epi32 (cur, zero))) & 0xF)) << lane;
+      if (NULL != previous)
+      {
+        prev = _mm_loadu_si128 ((const __m128i *) &previous[index + lane]);
+        ch |= ((uint32_t) (~_mm_movemask_ps (_mm_castsi128_ps (_mm_cmpeq_epi32 (cur, prev))) & 0xF)) << lane;
+      }
+    }
+    BST_DIFF_BITS_SET (nonzero, index, nz);
+    BST_DIFF_BITS_SET (changed, index, ch);
+  }
+}
+#endif
+
+#ifdef BST_DIFF_X86
+/*********************************************************************
+* @brief : diff kernel, eight counters at a time
+*
+* @param[in] current : counters of the record
+* @param[in] previous : counters of the previous record, may be NULL
+* @param[in] count : number of counters, multiple of BVIEW_BST_SNAPSHOT_ALIGN
+* @param[out] nonzero : bits of the non zero counters are set
+* @param[out] changed : bits of the changed counters are set
+*
+* @retval  : none
+*
+* @note    : used only if the cpu supports avx2.
+*
+*********************************************************************/
+BST_DIFF_KERNEL_ATTR __attribute__ ((target ("avx2")))
+static void bst_diff_avx2 (const uint32_t *current, const uint32_t *previous,
+                           unsigned int count,
+                           uint64_t *nonzero, uint64_t *changed)
+{
+  const __m256i zero = _mm256_setzero_si256 ();
+  __m256i cur, prev;
+  unsigned int index, lane;
+  uint32_t nz, ch;
+
+  for (index = 0; index < count; index += BVIEW_BST_SNAPSHOT_ALIGN)
+  {
+    nz = 0;
+    ch = 0;
+    for (lane = 0; lane < BVIEW_BST_SNAPSHOT_ALIGN; lane += 8)
+    {
+      cur = _mm256_loadu_si256 ((const __m256i *) &current[index + lane]);
+      nz |= ((uint32_t) (~_mm256_movemask_ps (_mm256_castsi256_ps (_mm256_cmpeq_epi32 (cur, zero))) & 0xFF)) << lane;
+      if (NULL != previous)
+      {
+        prev = _mm256_loadu_si256 ((const __m256i *) &previous[index + lane]);
+        ch |= ((uint32_t) (~_mm256_movemask_ps (_mm256_castsi256_ps (_mm256_cmpeq_epi32 (cur, prev))) & 0xFF)) << lane;
+      }
+    }
+    BST_DIFF_BITS_SET (nonzero, index, nz);
+    BST_DIFF_BITS_SET (changed, index, ch);
+  }
+}
+#endif
+
+/*********************************************************************
+* @brief : returns a diff kernel
+*
+* @param[in] type : kernel, BVIEW_BST_DIFF_KERNEL_AUTO for the widest
+*                   one the cpu supports
+*
+* @retval  : diff kernel, NULL if the cpu does not support it
+*
+*********************************************************************/
+static BST_DIFF_KERNEL_t bst_diff_kernel_get (BVIEW_BST_DIFF_KERNEL_t type)
+{
+  static BST_DIFF_KERNEL_t kernel = NULL;
+
+  switch (type)
+  {
+    case BVIEW_BST_DIFF_KERNEL_SCALAR:
+      return bst_diff_scalar;
+    case BVIEW_BST_DIFF_KERNEL_SSE2:
+#ifdef __SSE2__
+      return bst_diff_sse2;
+#else
+      return NULL;
+#endif
+    case BVIEW_BST_DIFF_KERNEL_AVX2:
+#ifdef BST_DIFF_X86
+      __builtin_cpu_init ();
+      return (__builtin_cpu_supports ("avx2")) ? bst_diff_avx2 : NULL;
+#else
+      return NULL;
+#endif
+    case BVIEW_BST_DIFF_KERNEL_AUTO:
+      break;
+    default:
+      return NULL;
+  }
+
+  if (NULL != kernel)
+  {
+    return kernel;
+  }
+  kernel = bst_diff_scalar;
+#ifdef __SSE2__
+  kernel = bst_diff_sse2;
+#endif
+#ifdef BST_DIFF_X86
+  __builtin_cpu_init ();
+  if (__builtin_cpu_supports ("avx2"))
+  {
+    kernel = bst_diff_avx2;
+  }
+#endif
+  return kernel;
+}
+
+/*********************************************************************
+* @brief : computes the bitmaps of a record with the given kernel
+*
+* @param[in] kernel : diff kernel
+* @param[in,out] current : record
+* @param[in] previous : previous record, may be NULL
+*
+* @retval  : none
+*
+*********************************************************************/
+static void bst_diff_run (BST_DIFF_KERNEL_t kernel,
+                          BVIEW_BST_SNAPSHOT_DATA_t *current,
+                          const BVIEW_BST_SNAPSHOT_DATA_t *previous)
+{
+  const BVIEW_BST_SNAPSHOT_LAYOUT_t *layout = current->layout;
+  unsigned int realmIndex, cnt, last, count, word;
+  uint64_t *nonzero, *changed;
+  uint64_t nzWords, chWords;
+
+  memset (current->nonzero, 0, layout->numBitmapWords * sizeof (uint64_t));
+  memset (current->changed, 0, layout->numBitmapWords * sizeof (uint64_t));
+  current->nonzeroRealms = 0;
+  current->changedRealms = 0;
+
+  for (realmIndex = 0; realmIndex < BVIEW_BST_NUM_REALMS; realmIndex++)
+  {
+    if (0 == layout->bitmapWords[realmIndex])
+    {
+      continue;
+    }
+    nonzero = &current->nonzero[layout->bitmapOffset[realmIndex]];
+    changed = &current->changed[layout->bitmapOffset[realmIndex]];
+    /* arrays are padded with zeros up to the alignment */
+    count = (layout->realmEntries[realmIndex] + BVIEW_BST_SNAPSHOT_ALIGN - 1) &
+            ~(BVIEW_BST_SNAPSHOT_ALIGN - 1);
+
+    /* an entry is set if any counter of the entry is */
+    last = layout->realmCounter[realmIndex] + layout->realmNumCounters[realmIndex];
+    for (cnt = layout->realmCounter[realmIndex]; cnt < last; cnt++)
+    {
+      kernel (&current->counters[layout->offset[cnt]],
+              (NULL != previous) ? &previous->counters[layout->offset[cnt]] : NULL,
+              count, nonzero, changed);
+    }
+
+    nzWords = 0;
+    chWords = 0;
+    for (word = 0; word < layout->bitmapWords[realmIndex]; word++)
+    {
+      nzWords |= nonzero[word];
+      chWords |= changed[word];
+    }
+    if (0 != nzWords)
+    {
+      current->nonzeroRealms |= (0x1 << realmIndex);
+    }
+    if (0 != chWords)
+    {
+      current->changedRealms |= (0x1 << realmIndex);
+    }
+  }
+}
+
+/*********************************************************************
+* @brief : computes the entries of a record to be reported
+*
+* @param[in,out] current : record, its bitmaps are set
+* @param[in] previous : previous record of the same unit, may be NULL
+*
+* @retval  : BVIEW_STATUS_SUCCESS : bitmaps are set.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : invoked once per record, when it is published. The
+*            encoders visit only the entries set in the bitmaps.
+*
+*********************************************************************/
+BVIEW_STATUS bst_diff_compute (BVIEW_BST_SNAPSHOT_DATA_t *current,
+                               const BVIEW_BST_SNAPSHOT_DATA_t *previous)
+{
+  return bst_diff_kernel_compute (BVIEW_BST_DIFF_KERNEL_AUTO, current, previous);
+}
+
+/*********************************************************************
+* @brief : computes the entries of a record to be reported with the
+*          given kernel
+*
+* @param[in] type : kernel, BVIEW_BST_DIFF_KERNEL_AUTO for the widest
+*                   one the cpu supports
+* @param[in,out] current : record, its bitmaps are set
+* @param[in] previous : previous record of the same layout, may be NULL
+*
+* @retval  : BVIEW_STATUS_SUCCESS : bitmaps are set.
+* @retval  : BVIEW_STATUS_UNSUPPORTED : the cpu does not support the
+*                                       kernel.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : every kernel sets the same bitmaps.
+*
+*********************************************************************/
+BVIEW_STATUS bst_diff_kernel_compute (BVIEW_BST_DIFF_KERNEL_t type,
+                                      BVIEW_BST_SNAPSHOT_DATA_t *current,
+                                      const BVIEW_BST_SNAPSHOT_DATA_t *previous)
+{
+  BST_DIFF_KERNEL_t kernel;
+  BVIEW_HR_TIME_t start, end;
+
+  if ((NULL == current) || (NULL == current->layout))
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+  if ((NULL != previous) && (previous->layout != current->layout))
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+  kernel = bst_diff_kernel_get (type);
+  if (NULL == kernel)
+  {
+    return BVIEW_STATUS_UNSUPPORTED;
+  }
+
+  if (0 != (_BST_DEBUG_LEVEL & _BST_DEBUG_TRACE))
+  {
+    BVIEW_HR_TIME_GET (&start);
+  }
+
+  bst_diff_run (kernel, current, previous);
+
+  if (0 != (_BST_DEBUG_LEVEL & _BST_DEBUG_TRACE))
+  {
+    BVIEW_HR_TIME_GET (&end);
+    _BST_LOG(_BST_DEBUG_TRACE, "bst diff of %u counters took %" PRIu64 " ns\n",
+             current->layout->numCounters, end.monotonic - start.monotonic);
+  }
+  return BVIEW_STATUS_SUCCESS;
+}
@@ -0,0 +1,1617 @@
+/*****************************************************************************
+  *
+  * (C) Copyright Broadcom Corporation 2015
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License");
+  * you may not use this file except in compliance with the License.
+  *
+  * You may obtain a copy of the License at
+  * http://www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ***************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <inttypes.h>
+#include <pthread.h>
+#include "json.h"
+#include "clear_bst_statistics.h"
+#include "clear_bst_thresholds.h"
+#include "configure_bst_thresholds.h"
+#include "configure_bst_feature.h"
+#include "configure_bst_tracking.h"
+#include "get_bst_tracking.h"
+#include "get_bst_feature.h"
+#include "get_bst_thresholds.h"
+#include "get_bst_report.h"
+#include "bst_json_encoder.h"
+#include "bst.h"
+#include "broadview.h"
+#include "bst_app.h"
+#include "openapps_log_api.h"
+
+/* BST Context Info*/
+extern BVIEW_BST_CXT_t bst_info;
+
+#define BST_HISTORY_CXT_GET(_unit)  &bst_info.unit[_unit].history
+
+#define BST_HISTORY_BYTES_PER_MB    (1024 * 1024)
+#define BST_HISTORY_NSEC_PER_SEC    1000000000ULL
+
+/* payload of the entry is the time and the counters of the record as is */
+#define BST_HISTORY_ENTRY_RAW       0x1
+/* payload of the entry is a sample of a stream restarted from it */
+#define BST_HISTORY_ENTRY_KEYFRAME  0x2
+
+/* summary of a block, 0 is the oldest block */
+#define BST_HISTORY_BLOCK_GET(_cxt, _index) \
+              (&(_cxt)->blocks[((_cxt)->headBlock + (_index)) % (_cxt)->maxBlocks])
+
+/* header of an entry in the ring, followed by its payload. The payload
+   is a sample of the codec stream of the unit, or the record as is
+   when that is shorter. Entries are numbered from the oldest one */
+typedef struct _bst_history_entry_hdr_
+{
+  uint32_t length;
+  uint32_t flags;
+} BST_HISTORY_ENTRY_HDR_t;
+
+/*********************************************************************
+* @brief : copies bytes into the ring
+*
+* @param[in] cxt : history of the unit
+* @param[in] offset : position in the ring
+* @param[in] src : bytes to copy
+* @param[in] len : number of bytes
+*
+* @retval  : position in the ring past the bytes
+*
+*********************************************************************/
+static size_t bst_history_ring_write (BVIEW_BST_HISTORY_CXT_t *cxt, size_t offset,
+                                      const void *src, size_t len)
+{
+  size_t first = cxt->size - offset;
+
+  if (len <= first)
+  {
+    memcpy (&cxt->ring[offset], src, len);
+  }
+  else
+  {
+    memcpy (&cxt->ring[offset], src, first);
+    memcpy (cxt->ring, (const uint8_t *) src + first, len - first);
+  }
+  return (offset + len) % cxt->size;
+}
+
+/*********************************************************************
+* @brief : copies bytes out of the ring
+*
+* @param[in] cxt : history of the unit
+* @param[in] offset : position in the ring
+* @param[out] dst : buffer of the bytes
+* @param[in] len : number of bytes
+*
+* @retval  : position in the ring past the bytes
+*
+*********************************************************************/
+static size_t bst_history_ring_read (const BVIEW_BST_HISTORY_CXT_t *cxt, size_t offset,
+                                     void *dst, size_t len)
+{
+  size_t first = cxt->size - offset;
+
+  if (len <= first)
+  {
+    memcpy (dst, &cxt->ring[offset], len);
+  }
+  else
+  {
+    memcpy (dst, &cxt->ring[offset], first);
+    memcpy ((uint8_t *) dst + first, cxt->ring, len - first);
+  }
+  return (offset + len) % cxt->size;
+}
+
+/*********************************************************************
+* @brief : decodes an entry of the history
+*
+* @param[in,out] codec : stream before the entry, after it on return
+* @param[in] payload : payload of the entry
+* @param[in] hdr : header of the entry
+*
+* @retval  : wall clock time of the entry
+*
+*********************************************************************/
+static uint64_t bst_history_entry_decode (BVIEW_BST_CODEC_t *codec, const uint8_t *payload,
+                                          const BST_HISTORY_ENTRY_HDR_t *hdr)
+{
+  uint64_t realtimeNs = 0;
+
+  if (0 != (hdr->flags & BST_HISTORY_ENTRY_RAW))
+  {
+    memcpy (&realtimeNs, payload, sizeof (realtimeNs));
+    bst_codec_sample_set (codec, realtimeNs, (const uint32_t *) (payload + sizeof (realtimeNs)));
+  }
+  else
+  {
+    if (0 != (hdr->flags & BST_HISTORY_ENTRY_KEYFRAME))
+    {
+      bst_codec_init (codec, codec->counters, codec->numCounters);
+    }
+    bst_codec_decode (codec, payload, hdr->length, &realtimeNs);
+  }
+  return realtimeNs;
+}
+
+/*********************************************************************
+* @brief : returns whether a counter is a buffer count
+*
+* @param[in] counter : counter array
+*
+* @retval  : true : counter is a buffer count, in cells.
+* @retval  : false : counter is a count of queue entries.
+*
+*********************************************************************/
+bool bst_history_counter_is_buffer (BVIEW_BST_COUNTER_t counter)
+{
+  switch (counter)
+  {
+    case BVIEW_BST_CNT_EPSP_MC_SHARE_QENTRIES:
+    case BVIEW_BST_CNT_ESP_MC_SHARE_QENTRIES:
+    case BVIEW_BST_CNT_EMCQ_MC_QENTRIES:
+    case BVIEW_BST_CNT_CPUQ_QENTRIES:
+    case BVIEW_BST_CNT_RQEQ_QENTRIES:
+      return false;
+    default:
+      return true;
+  }
+}
+
+/*********************************************************************
+* @brief : returns the highest occupancy of the entries of every realm
+*
+* @param[in] layout : layout of the counters
+* @param[in] counters : counters of a record
+* @param[out] realmMax : occupancy of every realm, in cells
+*
+* @retval  : none
+*
+* @note    : the occupancy of an entry is its highest buffer count.
+*
+*********************************************************************/
+void bst_history_realm_max_get (const BVIEW_BST_SNAPSHOT_LAYOUT_t *layout,
+                                const uint32_t *counters, uint32_t *realmMax)
+{
+  unsigned int realmIndex, counter, index;
+  const uint32_t *array;
+
+  for (realmIndex = 0; realmIndex < BVIEW_BST_NUM_REALMS; realmIndex++)
+  {
+    realmMax[realmIndex] = 0;
+    for (counter = layout->realmCounter[realmIndex];
+         counter < (layout->realmCounter[realmIndex] + layout->realmNumCounters[realmIndex]);
+         counter++)
+    {
+      if (false == bst_history_counter_is_buffer ((BVIEW_BST_COUNTER_t) counter))
+      {
+        continue;
+      }
+      array = &counters[layout->offset[counter]];
+      for (index = 0; index < layout->count[counter]; index++)
+      {
+        if (realmMax[realmIndex] < array[index])
+        {
+          realmMax[realmIndex] = array[index];
+        }
+      }
+    }
+  }
+}
+
+/*********************************************************************
+* @brief : drops the oldest entry of the history
+*
+* @param[in] cxt : history of the unit
+*
+* @retval  : none
+*
+* @note    : the entry is folded into the counters before the oldest
+*            entry, and dropped from the oldest block.
+*
+*********************************************************************/
+static void bst_history_evict (BVIEW_BST_HISTORY_CXT_t *cxt)
+{
+  BVIEW_BST_HISTORY_BLOCK_t *block;
+  BST_HISTORY_ENTRY_HDR_t hdr;
+  size_t offset;
+
+  /* the entry being added is in the scratch buffer */
+  offset = bst_history_ring_read (cxt, cxt->head, &hdr, sizeof (hdr));
+  bst_history_ring_read (cxt, offset, cxt->evictScratch, hdr.length);
+  bst_history_entry_decode (&cxt->first, cxt->evictScratch, &hdr);
+
+  cxt->head = (cxt->head + sizeof (hdr) + hdr.length) % cxt->size;
+  cxt->used -= sizeof (hdr) + hdr.length;
+  cxt->firstSeq++;
+
+  /* the oldest block starts with the next entry, or is gone */
+  if (0 != cxt->numBlocks)
+  {
+    block = BST_HISTORY_BLOCK_GET (cxt, 0);
+    block->firstSeq = cxt->firstSeq;
+    block->offset = cxt->head;
+    block->numEntries--;
+    if (0 == block->numEntries)
+    {
+      cxt->headBlock = (cxt->headBlock + 1) % cxt->maxBlocks;
+      cxt->numBlocks--;
+    }
+  }
+}
+
+/*********************************************************************
+* @brief : frees the memory of the history of a unit
+*
+* @param[in] cxt : history of the unit
+*
+* @retval  : none
+*
+* @note    : the sequence numbers continue from the entries dropped.
+*
+*********************************************************************/
+static void bst_history_free (BVIEW_BST_HISTORY_CXT_t *cxt)
+{
+  free (cxt->ring);
+  free (cxt->base);
+  free (cxt->last);
+  free (cxt->scratch);
+  free (cxt->evictScratch);
+  free (cxt->blocks);
+  cxt->ring = NULL;
+  cxt->base = NULL;
+  cxt->last = NULL;
+  cxt->scratch = NULL;
+  cxt->evictScratch = NULL;
+  cxt->blocks = NULL;
+  cxt->size = 0;
+  cxt->head = 0;
+  cxt->used = 0;
+  cxt->maxBlocks = 0;
+  cxt->headBlock = 0;
+  cxt->numBlocks = 0;
+  cxt->firstSeq = cxt->nextSeq;
+}
+
+/*********************************************************************
+* @brief : allocates the ring and the buffers of a history
+*
+* @param[in,out] cxt : history, freed
+* @param[in] layout : layout of the counters of the entries
+* @param[in] size : size of the ring, in bytes
+* @param[in] maxBlocks : blocks of the ring
+*
+* @retval  : BVIEW_STATUS_SUCCESS : history is allocated, empty.
+* @retval  : BVIEW_STATUS_OUTOFMEMORY : no memory for the history.
+*
+*********************************************************************/
+static BVIEW_STATUS bst_history_alloc (BVIEW_BST_HISTORY_CXT_t *cxt,
+                                       const BVIEW_BST_SNAPSHOT_LAYOUT_t *layout,
+                                       size_t size, unsigned int maxBlocks)
+{
+  unsigned int numCounters = layout->numCounters;
+
+  cxt->layout = layout;
+  cxt->numCounters = numCounters;
+  cxt->scratchSize = (numCounters * sizeof (uint32_t)) + sizeof (uint64_t);
+  cxt->ring = (uint8_t *) malloc (size);
+  cxt->base = (uint32_t *) calloc (numCounters, sizeof (uint32_t));
+  cxt->last = (uint32_t *) calloc (numCounters, sizeof (uint32_t));
+  cxt->scratch = (uint8_t *) malloc (cxt->scratchSize);
+  cxt->evictScratch = (uint8_t *) malloc (cxt->scratchSize);
+  cxt->maxBlocks = maxBlocks;
+  cxt->blocks = (BVIEW_BST_HISTORY_BLOCK_t *) calloc (maxBlocks,
+                                                     sizeof (BVIEW_BST_HISTORY_BLOCK_t));
+  if ((NULL == cxt->ring) || (NULL == cxt->base) || (NULL == cxt->last) ||
+      (NULL == cxt->scratch) || (NULL == cxt->evictScratch) || (NULL == cxt->blocks))
+  {
+    bst_history_free (cxt);
+    return BVIEW_STATUS_OUTOFMEMORY;
+  }
+  cxt->size = size;
+  bst_codec_init (&cxt->first, cxt->base, numCounters);
+  bst_codec_init (&cxt->next, cxt->last, numCounters);
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief : initializes the snapshot history of a unit
+*
+* @param[in] unit : unit id
+*
+* @retval  : BVIEW_STATUS_SUCCESS : history is initialized.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : the history is empty until it is sized with
+*            bst_history_config_set.
+*
+*********************************************************************/
+BVIEW_STATUS bst_history_init (unsigned int unit)
+{
+  BVIEW_BST_HISTORY_CXT_t *cxt;
+
+  if (unit >= BVIEW_BST_MAX_UNITS)
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+  cxt = BST_HISTORY_CXT_GET (unit);
+
+  memset (cxt, 0, sizeof (BVIEW_BST_HISTORY_CXT_t));
+  cxt->unit = unit;
+  cxt->firstSeq = 1;
+  cxt->nextSeq = 1;
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief : releases the snapshot history of a unit
+*
+* @param[in] unit : unit id
+*
+* @retval  : none
+*
+*********************************************************************/
+void bst_history_uninit (unsigned int unit)
+{
+  if (unit >= BVIEW_BST_MAX_UNITS)
+  {
+    return;
+  }
+  bst_history_free (BST_HISTORY_CXT_GET (unit));
+}
+
+/*********************************************************************
+* @brief : sizes the snapshot history of a unit
+*
+* @param[in] unit : unit id
+* @param[in] sizeMb : size of the history in MB, 0 disables it
+*
+* @retval  : BVIEW_STATUS_SUCCESS : history is sized.
+* @retval  : BVIEW_STATUS_OUTOFMEMORY : no memory for the history.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : invoked in the bst context only, once the records of the
+*            unit are sized. The entries are dropped when the size
+*            changes.
+*
+*********************************************************************/
+BVIEW_STATUS bst_history_config_set (unsigned int unit, int sizeMb)
+{
+  BVIEW_BST_HISTORY_CXT_t *cxt;
+  unsigned int numCounters;
+
+  if ((unit >= BVIEW_BST_MAX_UNITS) || (0 > sizeMb))
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+  cxt = BST_HISTORY_CXT_GET (unit);
+  numCounters = bst_info.unit[unit].snapshot.layout.numCounters;
+
+  if ((NULL != cxt->ring) &&
+      (cxt->size == ((size_t) sizeMb * BST_HISTORY_BYTES_PER_MB)))
+  {
+    return BVIEW_STATUS_SUCCESS;
+  }
+  bst_history_free (cxt);
+  if ((0 == sizeMb) || (0 == numCounters))
+  {
+    return BVIEW_STATUS_SUCCESS;
+  }
+
+  if (BVIEW_STATUS_SUCCESS !=
+      bst_history_alloc (cxt, &bst_info.unit[unit].snapshot.layout,
+                         (size_t) sizeMb * BST_HISTORY_BYTES_PER_MB,
+                         (unsigned int) sizeMb * BVIEW_BST_HISTORY_BLOCKS_PER_MB))
+  {
+    LOG_POST (BVIEW_LOG_ERROR,
+              "Failed to allocate %d MB of snapshot history for unit %d\r\n",
+              sizeMb, unit);
+    return BVIEW_STATUS_OUTOFMEMORY;
+  }
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief : adds the counters of a record to the history
+*
+* @param[in] cxt : history of the unit
+* @param[in] realtimeNs : wall clock time of the collection
+* @param[in] counters : counters of the record
+*
+* @retval  : none
+*
+* @note    : the oldest entries are dropped to make room for the
+*            record, they are decoded aside of it. A record is stored
+*            as is when that is shorter than its sample of the codec.
+*            The first entry of a block is encoded from a cleared
+*            stream, mostly idle counters keep it short.
+*
+*********************************************************************/
+static void bst_history_entry_add (BVIEW_BST_HISTORY_CXT_t *cxt, uint64_t realtimeNs,
+                                   const uint32_t *counters)
+{
+  BVIEW_BST_HISTORY_BLOCK_t *block;
+  BST_HISTORY_ENTRY_HDR_t hdr;
+  uint32_t realmMax[BVIEW_BST_NUM_REALMS];
+  unsigned int realmIndex;
+  size_t offset, entryOffset;
+  bool keyframe;
+
+  /* an entry larger than the ring is not stored, the stream is not
+     moved past it */
+  if ((sizeof (hdr) + cxt->scratchSize) > cxt->size)
+  {
+    return;
+  }
+  keyframe = (0 == cxt->numBlocks) ||
+             ((BST_HISTORY_BLOCK_GET (cxt, cxt->numBlocks - 1)->numEntries >=
+               BVIEW_BST_HISTORY_BLOCK_ENTRIES) &&
+              (cxt->numBlocks < cxt->maxBlocks));
+
+  memset (&hdr, 0, sizeof (hdr));
+  if (true == keyframe)
+  {
+    hdr.flags = BST_HISTORY_ENTRY_KEYFRAME;
+    bst_codec_init (&cxt->next, cxt->last, cxt->numCounters);
+  }
+  hdr.length = bst_codec_encode (&cxt->next, realtimeNs, counters,
+                                 cxt->scratch, cxt->numCounters * sizeof (uint32_t));
+  if (0 == hdr.length)
+  {
+    hdr.flags = BST_HISTORY_ENTRY_RAW;
+    hdr.length = cxt->scratchSize;
+    memcpy (cxt->scratch, &realtimeNs, sizeof (realtimeNs));
+    memcpy (cxt->scratch + sizeof (realtimeNs), counters,
+            cxt->numCounters * sizeof (uint32_t));
+    bst_codec_sample_set (&cxt->next, realtimeNs, counters);
+  }
+
+  while ((cxt->size - cxt->used) < (sizeof (hdr) + hdr.length))
+  {
+    bst_history_evict (cxt);
+  }
+
+  entryOffset = (cxt->head + cxt->used) % cxt->size;
+  offset = bst_history_ring_write (cxt, entryOffset, &hdr, sizeof (hdr));
+  bst_history_ring_write (cxt, offset, cxt->scratch, hdr.length);
+  cxt->used += sizeof (hdr) + hdr.length;
+
+  /* the entry starts a block, or is added to the newest one. The
+     oldest block may start with any entry, it is decoded from the
+     counters before the oldest entry */
+  if ((true == keyframe) || (0 == cxt->numBlocks))
+  {
+    block = BST_HISTORY_BLOCK_GET (cxt, cxt->numBlocks);
+    memset (block, 0, sizeof (BVIEW_BST_HISTORY_BLOCK_t));
+    block->firstSeq = cxt->nextSeq;
+    block->offset = entryOffset;
+    block->minNs = realtimeNs;
+    block->maxNs = realtimeNs;
+    cxt->numBlocks++;
+  }
+  block = BST_HISTORY_BLOCK_GET (cxt, cxt->numBlocks - 1);
+  block->numEntries++;
+  if (block->minNs > realtimeNs)
+  {
+    block->minNs = realtimeNs;
+  }
+  if (block->maxNs < realtimeNs)
+  {
+    block->maxNs = realtimeNs;
+  }
+  bst_history_realm_max_get (cxt->layout, counters, realmMax);
+  for (realmIndex = 0; realmIndex < BVIEW_BST_NUM_REALMS; realmIndex++)
+  {
+    if (block->realmMax[realmIndex] < realmMax[realmIndex])
+    {
+      block->realmMax[realmIndex] = realmMax[realmIndex];
+    }
+  }
+
+  _BST_LOG(_BST_DEBUG_TRACE, "bst history entry %" PRIu64 " of %u bytes, %s\n",
+           cxt->nextSeq, hdr.length,
+           (0 != (hdr.flags & BST_HISTORY_ENTRY_RAW)) ? "raw" :
+           ((0 != (hdr.flags & BST_HISTORY_ENTRY_KEYFRAME)) ? "keyframe" : "codec"));
+  cxt->nextSeq++;
+}
+
+/*********************************************************************
+* @brief : returns the wall clock time of a stats record
+*
+* @param[in] ss : record
+*
+* @retval  : time of the realm read last, in nano seconds
+*
+* @note    : falls back to the collection time of the record when no
+*            realm has a sampling window.
+*
+*********************************************************************/
+uint64_t bst_history_realtime_get (const BVIEW_BST_REPORT_SNAPSHOT_t *ss)
+{
+  uint64_t realtimeNs = 0;
+  unsigned int index;
+
+  for (index = 0; index < BVIEW_BST_NUM_REALMS; index++)
+  {
+    if (realtimeNs < ss->realmTime[index].end.realtime)
+    {
+      realtimeNs = ss->realmTime[index].end.realtime;
+    }
+  }
+  if (0 == realtimeNs)
+  {
+    realtimeNs = (uint64_t) ss->tv * BST_HISTORY_NSEC_PER_SEC;
+  }
+  return realtimeNs;
+}
+
+/*********************************************************************
+* @brief : adds a stats record to the snapshot history of a unit
+*
+* @param[in] unit : unit id
+* @param[in] ss : record, published
+*
+* @retval  : BVIEW_STATUS_SUCCESS : record is added, or the history
+*                                   is disabled.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : invoked in the bst context only.
+*
+*********************************************************************/
+BVIEW_STATUS bst_history_append (unsigned int unit,
+                                 const BVIEW_BST_REPORT_SNAPSHOT_t *ss)
+{
+  BVIEW_BST_HISTORY_CXT_t *cxt;
+
+  if ((unit >= BVIEW_BST_MAX_UNITS) || (NULL == ss))
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+  cxt = BST_HISTORY_CXT_GET (unit);
+  if (NULL == cxt->ring)
+  {
+    return BVIEW_STATUS_SUCCESS;
+  }
+
+  bst_history_entry_add (cxt, bst_history_realtime_get (ss),
+                         ss->snapshot_data.counters);
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief : adds an entry read back from the journal to the history
+*
+* @param[in] unit : unit id
+* @param[in] seq : sequence number of the entry
+* @param[in] realtimeNs : wall clock time of the collection
+* @param[in] counters : counters of the entry
+*
+* @retval  : BVIEW_STATUS_SUCCESS : entry is added, or the history
+*                                   is disabled.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : invoked in the bst context only, before the collection
+*            starts. The sequence numbers of the history continue
+*            from the ones of the journal.
+*
+*********************************************************************/
+BVIEW_STATUS bst_history_restore (unsigned int unit, uint64_t seq,
+                                  uint64_t realtimeNs, const uint32_t *counters)
+{
+  BVIEW_BST_HISTORY_CXT_t *cxt;
+
+  if ((unit >= BVIEW_BST_MAX_UNITS) || (NULL == counters) || (0 == seq))
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+  cxt = BST_HISTORY_CXT_GET (unit);
+
+  if ((0 == cxt->used) || (seq != cxt->nextSeq))
+  {
+    /* a gap in the sequence, the entries so far do not lead to it */
+    if (NULL != cxt->ring)
+    {
+      bst_codec_init (&cxt->first, cxt->base, cxt->numCounters);
+      bst_codec_init (&cxt->next, cxt->last, cxt->numCounters);
+    }
+    cxt->head = 0;
+    cxt->used = 0;
+    cxt->headBlock = 0;
+    cxt->numBlocks = 0;
+    cxt->firstSeq = seq;
+    cxt->nextSeq = seq;
+  }
+  if (NULL == cxt->ring)
+  {
+    cxt->firstSeq = seq + 1;
+    cxt->nextSeq = seq + 1;
+    return BVIEW_STATUS_SUCCESS;
+  }
+
+  bst_history_entry_add (cxt, realtimeNs, counters);
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief : returns the sequence numbers and the usage of the history
+*
+* @param[in] unit : unit id
+* @param[out] info : sequence numbers and usage
+*
+* @retval  : BVIEW_STATUS_SUCCESS : info is returned.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+*********************************************************************/
+BVIEW_STATUS bst_history_info_get (unsigned int unit, BVIEW_BST_HISTORY_INFO_t *info)
+{
+  BVIEW_BST_HISTORY_CXT_t *cxt;
+
+  if ((unit >= BVIEW_BST_MAX_UNITS) || (NULL == info))
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+  cxt = BST_HISTORY_CXT_GET (unit);
+
+  info->firstSequenceNumber = cxt->firstSeq;
+  info->nextSequenceNumber = cxt->nextSeq;
+  info->bytesUsed = cxt->used;
+  info->size = cxt->size;
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief : starts a walk of the entries of a history request
+*
+* @param[in] unit : unit id
+* @param[in] query : range of the entries
+* @param[out] walk : walk, ended with bst_history_walk_end
+*
+* @retval  : BVIEW_STATUS_SUCCESS : walk is started.
+* @retval  : BVIEW_STATUS_RESOURCE_NOT_AVAILABLE : history is disabled.
+* @retval  : BVIEW_STATUS_OUTOFMEMORY : no memory for the records.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : invoked in the bst context only. The entries are decoded
+*            into two records of the unit, from the oldest entry on.
+*
+*********************************************************************/
+BVIEW_STATUS bst_history_walk_start (unsigned int unit,
+                                     const BVIEW_BST_HISTORY_QUERY_t *query,
+                                     BVIEW_BST_HISTORY_WALK_t *walk)
+{
+  BVIEW_BST_HISTORY_CXT_t *cxt;
+
+  if ((unit >= BVIEW_BST_MAX_UNITS) || (NULL == query) || (NULL == walk))
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+  cxt = BST_HISTORY_CXT_GET (unit);
+  memset (walk, 0, sizeof (BVIEW_BST_HISTORY_WALK_t));
+  if (NULL == cxt->ring)
+  {
+    return BVIEW_STATUS_RESOURCE_NOT_AVAILABLE;
+  }
+
+  walk->unit = unit;
+  walk->current = bst_snapshot_alloc (unit);
+  walk->previous = bst_snapshot_alloc (unit);
+  if ((NULL == walk->current) || (NULL == walk->previous))
+  {
+    bst_history_walk_end (walk);
+    return BVIEW_STATUS_OUTOFMEMORY;
+  }
+
+  walk->query = *query;
+  walk->seq = cxt->firstSeq;
+  walk->offset = cxt->head;
+  /* the stream from the oldest entry on, decoded in the record */
+  walk->codec = cxt->first;
+  walk->codec.counters = walk->current->snapshot_data.counters;
+  memcpy (walk->codec.counters, cxt->base, cxt->numCounters * sizeof (uint32_t));
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief : returns the next entry of a history request
+*
+* @param[in] cookie : walk of the request
+* @param[out] entry : entry, valid till the next call
+*
+* @retval  : true : entry is returned.
+* @retval  : false : no more entries in the range.
+*
+* @note    : the first entry returned is to be reported in full, the
+*            others against the entry before them.
+*
+*********************************************************************/
+bool bst_history_walk_next (void *cookie, BVIEW_BST_HISTORY_ENTRY_t *entry)
+{
+  BVIEW_BST_HISTORY_WALK_t *walk = (BVIEW_BST_HISTORY_WALK_t *) cookie;
+  BVIEW_BST_HISTORY_CXT_t *cxt;
+  BST_HISTORY_ENTRY_HDR_t hdr;
+  uint64_t seq, realtimeNs;
+
+  if ((NULL == walk) || (NULL == walk->current) || (NULL == entry))
+  {
+    return false;
+  }
+  cxt = BST_HISTORY_CXT_GET (walk->unit);
+
+  while ((walk->seq < cxt->nextSeq) && (walk->seq <= walk->query.endSeq))
+  {
+    walk->offset = bst_history_ring_read (cxt, walk->offset, &hdr, sizeof (hdr));
+    walk->offset = bst_history_ring_read (cxt, walk->offset, cxt->scratch, hdr.length);
+    seq = walk->seq++;
+
+    /* the counters before the entry are kept only if it may be reported */
+    if ((seq >= walk->query.startSeq) && (0 != walk->numEntries))
+    {
+      memcpy (walk->previous->snapshot_data.counters,
+              walk->current->snapshot_data.counters,
+              cxt->numCounters * sizeof (uint32_t));
+    }
+    realtimeNs = bst_history_entry_decode (&walk->codec, cxt->scratch, &hdr);
+
+    /* entries are in the order of the collections */
+    if (realtimeNs > walk->query.endNs)
+    {
+      walk->seq = cxt->nextSeq;
+      break;
+    }
+    if ((seq < walk->query.startSeq) || (realtimeNs < walk->query.startNs))
+    {
+      continue;
+    }
+
+    bst_diff_compute (&walk->current->snapshot_data,
+                      (0 != walk->numEntries) ? &walk->previous->snapshot_data : NULL);
+
+    entry->sequenceNumber = seq;
+    entry->time = (BVIEW_TIME_t) (realtimeNs / BST_HISTORY_NSEC_PER_SEC);
+    entry->realtimeNs = realtimeNs;
+    entry->previous = (0 != walk->numEntries) ? &walk->previous->snapshot_data : NULL;
+    entry->current = &walk->current->snapshot_data;
+    walk->numEntries++;
+    return true;
+  }
+  return false;
+}
+
+/*********************************************************************
+* @brief : ends a walk of the entries of a history request
+*
+* @param[in] walk : walk
+*
+* @retval  : none
+*
+*********************************************************************/
+void bst_history_walk_end (BVIEW_BST_HISTORY_WALK_t *walk)
+{
+  if (NULL == walk)
+  {
+    return;
+  }
+  bst_snapshot_put (walk->unit, walk->current);
+  bst_snapshot_put (walk->unit, walk->previous);
+  walk->current = NULL;
+  walk->previous = NULL;
+}
+
+/*********************************************************************
+* @brief : returns the port and the index of a realm entry
+*
+* @param[in] layout : layout of the counters
+* @param[in] realm : realm of the entry
+* @param[in] entry : entry, in the order of the realm
+* @param[out] port : 1 based port, 0 if the realm is not kept per port
+* @param[out] index : 0 based priority group, service pool or queue
+*
+* @retval  : none
+*
+*********************************************************************/
+void bst_history_entry_locate (const BVIEW_BST_SNAPSHOT_LAYOUT_t *layout,
+                               BVIEW_BST_REALM_t realm, unsigned int entry,
+                               unsigned int *port, unsigned int *index)
+{
+  unsigned int stride;
+
+  stride = layout->stride[layout->realmCounter[BVIEW_BST_REALM_INDEX (realm)]];
+  *port = 0;
+  *index = entry;
+
+  if (BVIEW_BST_REALM_EGRESS_UC_QUEUE == realm)
+  {
+    *port = layout->ucQueuePort[entry];
+  }
+  else if (BVIEW_BST_REALM_EGRESS_MC_QUEUE == realm)
+  {
+    *port = layout->mcQueuePort[entry];
+  }
+  else if (0 != stride)
+  {
+    *port = (entry / stride) + 1;
+    *index = entry % stride;
+  }
+}
+
+/*********************************************************************
+* @brief : returns a counter in the units of the response of a query
+*
+* @param[in] walk : walk of the query
+* @param[in] counter : counter array
+* @param[in] value : counter, in cells for a buffer count
+*
+* @retval  : counter in the units of the response
+*
+*********************************************************************/
+static uint64_t bst_history_query_value (const BVIEW_BST_HISTORY_QUERY_WALK_t *walk,
+                                         unsigned int counter, uint64_t value)
+{
+  if (true == bst_history_counter_is_buffer ((BVIEW_BST_COUNTER_t) counter))
+  {
+    return value * walk->cellToByteConv;
+  }
+  return value;
+}
+
+/*********************************************************************
+* @brief : frees the memory of a walk of a query
+*
+* @param[in] walk : walk
+*
+* @retval  : none
+*
+*********************************************************************/
+static void bst_history_query_free (BVIEW_BST_HISTORY_QUERY_WALK_t *walk)
+{
+  free (walk->counters);
+  free (walk->select);
+  free (walk->matches);
+  free (walk->aggMax);
+  free (walk->aggLast);
+  free (walk->aggSum);
+  free (walk->aggCount);
+  walk->counters = NULL;
+  walk->select = NULL;
+  walk->matches = NULL;
+  walk->aggMax = NULL;
+  walk->aggLast = NULL;
+  walk->aggSum = NULL;
+  walk->aggCount = NULL;
+}
+
+/*********************************************************************
+* @brief : marks the entries which pass the realm, port and queue
+*          filters of a query
+*
+* @param[in] layout : layout of the counters
+* @param[in] filter : filters of the query
+* @param[out] select : bitmap block of the layout, cleared
+*
+* @retval  : entries marked
+*
+* @note    : the filters are resolved once per query, the samples are
+*            matched against the bitmap.
+*
+*********************************************************************/
+unsigned int bst_history_query_select (const BVIEW_BST_SNAPSHOT_LAYOUT_t *layout,
+                                       const BVIEW_BST_HISTORY_FILTER_t *filter,
+                                       uint64_t *select)
+{
+  BVIEW_BST_REALM_t realm;
+  unsigned int realmIndex, entry, port, index, numSelected = 0;
+
+  BVIEW_BST_REALM_ITER (realm)
+  {
+    if (0 == (filter->realms & realm))
+    {
+      continue;
+    }
+    realmIndex = BVIEW_BST_REALM_INDEX (realm);
+    for (entry = 0; entry < layout->realmEntries[realmIndex]; entry++)
+    {
+      bst_history_entry_locate (layout, realm, entry, &port, &index);
+      if ((false == filter->anyPort) &&
+          ((0 == port) || (port >= (BVIEW_BST_QUERY_PORT_WORDS * 64)) ||
+           (0 == (filter->ports[port / 64] & (1ULL << (port % 64))))))
+      {
+        continue;
+      }
+      if ((index < filter->minIndex) || (index > filter->maxIndex))
+      {
+        continue;
+      }
+      select[layout->bitmapOffset[realmIndex] + (entry / 64)] |= 1ULL << (entry % 64);
+      numSelected++;
+    }
+  }
+  return numSelected;
+}
+
+/*********************************************************************
+* @brief : starts a walk of the samples of a query of the history
+*
+* @param[in] unit : unit id
+* @param[in] filter : filters of the query
+* @param[in] cellToByteConv : bytes per cell of the response, 1 to
+*                             respond in cells
+* @param[out] walk : walk, ended with bst_history_query_end
+*
+* @retval  : BVIEW_STATUS_SUCCESS : walk is started.
+* @retval  : BVIEW_STATUS_RESOURCE_NOT_AVAILABLE : history is disabled.
+* @retval  : BVIEW_STATUS_OUTOFMEMORY : no memory for the walk.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : invoked in the bst context only. The realm, port and
+*            queue filters are resolved once into a bitmap of the
+*            entries to be matched.
+*
+*********************************************************************/
+BVIEW_STATUS bst_history_query_start (unsigned int unit,
+                                      const BVIEW_BST_HISTORY_FILTER_t *filter,
+                                      unsigned int cellToByteConv,
+                                      BVIEW_BST_HISTORY_QUERY_WALK_t *walk)
+{
+  BVIEW_BST_HISTORY_CXT_t *cxt;
+  const BVIEW_BST_SNAPSHOT_LAYOUT_t *layout;
+  unsigned int numSelected = 0;
+  uint64_t minCells;
+
+  if ((unit >= BVIEW_BST_MAX_UNITS) || (NULL == filter) || (NULL == walk))
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+  cxt = BST_HISTORY_CXT_GET (unit);
+  layout = &bst_info.unit[unit].snapshot.layout;
+  memset (walk, 0, sizeof (BVIEW_BST_HISTORY_QUERY_WALK_t));
+  if (NULL == cxt->ring)
+  {
+    return BVIEW_STATUS_RESOURCE_NOT_AVAILABLE;
+  }
+
+  walk->unit = unit;
+  walk->filter = *filter;
+  walk->cellToByteConv = (0 == cellToByteConv) ? 1 : cellToByteConv;
+  /* an occupancy in bytes matches from the cell it falls in */
+  minCells = (filter->minOccupancy + walk->cellToByteConv - 1) / walk->cellToByteConv;
+  walk->minCells = (minCells > UINT32_MAX) ? UINT32_MAX : (uint32_t) minCells;
+
+  walk->counters = (uint32_t *) calloc (cxt->numCounters, sizeof (uint32_t));
+  walk->select = (uint64_t *) calloc (layout->numBitmapWords + 1, sizeof (uint64_t));
+  if ((NULL == walk->counters) || (NULL == walk->select))
+  {
+    bst_history_query_free (walk);
+    return BVIEW_STATUS_OUTOFMEMORY;
+  }
+
+  numSelected = bst_history_query_select (layout, filter, walk->select);
+
+  walk->matches = (BVIEW_BST_QUERY_MATCH_t *) calloc (numSelected + 1,
+                                                      sizeof (BVIEW_BST_QUERY_MATCH_t));
+  if (BVIEW_BST_QUERY_AGGREGATE_NONE != filter->aggregate)
+  {
+    walk->aggMax = (uint32_t *) calloc (cxt->numCounters, sizeof (uint32_t));
+    walk->aggLast = (uint32_t *) calloc (cxt->numCounters, sizeof (uint32_t));
+    walk->aggSum = (uint64_t *) calloc (cxt->numCounters, sizeof (uint64_t));
+    walk->aggCount = (uint32_t *) calloc (cxt->numCounters, sizeof (uint32_t));
+    if ((NULL == walk->aggMax) || (NULL == walk->aggLast) ||
+        (NULL == walk->aggSum) || (NULL == walk->aggCount))
+    {
+      bst_history_query_free (walk);
+      return BVIEW_STATUS_OUTOFMEMORY;
+    }
+  }
+  if (NULL == walk->matches)
+  {
+    bst_history_query_free (walk);
+    return BVIEW_STATUS_OUTOFMEMORY;
+  }
+
+  bst_codec_init (&walk->codec, walk->counters, cxt->numCounters);
+  _BST_LOG(_BST_DEBUG_TRACE, "bst history query of %u entries over %u blocks\n",
+           numSelected, cxt->numBlocks);
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief : moves a walk of a query to the next block which may match
+*
+* @param[in,out] walk : walk of the query
+* @param[in] cxt : history of the unit
+*
+* @retval  : true : the entries of the block are to be walked.
+* @retval  : false : no more blocks.
+*
+* @note    : a block is skipped if it is out of the time or sequence
+*            range, or if no realm of the query reaches the occupancy
+*            in it. The blocks after the oldest one start with an
+*            entry which decodes on its own.
+*
+*********************************************************************/
+static bool bst_history_query_block_next (BVIEW_BST_HISTORY_QUERY_WALK_t *walk,
+                                          const BVIEW_BST_HISTORY_CXT_t *cxt)
+{
+  const BVIEW_BST_HISTORY_BLOCK_t *block;
+  BVIEW_BST_REALM_t realm;
+  unsigned int index;
+  bool match;
+
+  while (walk->numBlocks < cxt->numBlocks)
+  {
+    index = walk->numBlocks++;
+    block = BST_HISTORY_BLOCK_GET (cxt, index);
+
+    match = ((block->firstSeq + block->numEntries) > walk->filter.startSeq) &&
+            (block->maxNs >= walk->filter.startNs) &&
+            (block->minNs <= walk->filter.endNs);
+    if (true == match)
+    {
+      match = false;
+      BVIEW_BST_REALM_ITER (realm)
+      {
+        if ((0 != (walk->filter.realms & realm)) &&
+            (block->realmMax[BVIEW_BST_REALM_INDEX (realm)] >= walk->minCells))
+        {
+          match = true;
+          break;
+        }
+      }
+    }
+    if (false == match)
+    {
+      walk->stats.blocksSkipped++;
+      continue;
+    }
+
+    walk->seq = block->firstSeq;
+    walk->offset = block->offset;
+    walk->entriesLeft = block->numEntries;
+    if (0 == index)
+    {
+      /* the stream from the oldest entry on, decoded in the walk */
+      walk->codec = cxt->first;
+      walk->codec.counters = walk->counters;
+      memcpy (walk->counters, cxt->base, cxt->numCounters * sizeof (uint32_t));
+    }
+    walk->stats.blocksDecoded++;
+    return true;
+  }
+  return false;
+}
+
+/*********************************************************************
+* @brief : matches the counters of a sample against a query
+*
+* @param[in,out] walk : walk of the query, with the sample decoded
+*
+* @retval  : entries which match
+*
+* @note    : the matches are returned in the walk, or added to its
+*            aggregate.
+*
+*********************************************************************/
+static unsigned int bst_history_query_match (BVIEW_BST_HISTORY_QUERY_WALK_t *walk)
+{
+  const BVIEW_BST_SNAPSHOT_LAYOUT_t *layout = &bst_info.unit[walk->unit].snapshot.layout;
+  BVIEW_BST_QUERY_MATCH_t *match;
+  BVIEW_BST_REALM_t realm;
+  unsigned int realmIndex, word, entry, counter, firstCounter, lastCounter, pos;
+  unsigned int numMatches = 0;
+  uint32_t occupancy, value;
+  uint64_t bits;
+
+  BVIEW_BST_REALM_ITER (realm)
+  {
+    if (0 == (walk->filter.realms & realm))
+    {
+      continue;
+    }
+    realmIndex = BVIEW_BST_REALM_INDEX (realm);
+    firstCounter = layout->realmCounter[realmIndex];
+    lastCounter = firstCounter + layout->realmNumCounters[realmIndex];
+
+    for (word = 0; word < layout->bitmapWords[realmIndex]; word++)
+    {
+      for (bits = walk->select[layout->bitmapOffset[realmIndex] + word];
+           bits != 0; bits &= (bits - 1))
+      {
+        entry = (word * 64) + __builtin_ctzll (bits);
+
+        occupancy = 0;
+        for (counter = firstCounter; counter < lastCounter; counter++)
+        {
+          if ((true == bst_history_counter_is_buffer ((BVIEW_BST_COUNTER_t) counter)) &&
+              (occupancy < walk->counters[layout->offset[counter] + entry]))
+          {
+            occupancy = walk->counters[layout->offset[counter] + entry];
+          }
+        }
+        if (occupancy < walk->minCells)
+        {
+          continue;
+        }
+
+        if (BVIEW_BST_QUERY_AGGREGATE_NONE == walk->filter.aggregate)
+        {
+          match = &walk->matches[numMatches];
+          match->realm = realm;
+          bst_history_entry_locate (layout, realm, entry, &match->port, &match->index);
+          match->numValues = 0;
+          for (counter = firstCounter;
+               (counter < lastCounter) && (match->numValues < BVIEW_BST_QUERY_MAX_VALUES);
+               counter++)
+          {
+            match->values[match->numValues++] =
+              bst_history_query_value (walk, counter,
+                                       walk->counters[layout->offset[counter] + entry]);
+          }
+        }
+        else
+        {
+          for (counter = firstCounter; counter < lastCounter; counter++)
+          {
+            pos = layout->offset[counter] + entry;
+            value = walk->counters[pos];
+            if (walk->aggMax[pos] < value)
+            {
+              walk->aggMax[pos] = value;
+            }
+            walk->aggLast[pos] = value;
+            walk->aggSum[pos] += value;
+            walk->aggCount[pos]++;
+          }
+        }
+        numMatches++;
+      }
+    }
+  }
+  return numMatches;
+}
+
+/*********************************************************************
+* @brief : returns the aggregate of the matches of a query
+*
+* @param[in,out] walk : walk of the query, with all the samples walked
+* @param[out] sample : aggregate
+*
+* @retval  : none
+*
+*********************************************************************/
+static void bst_history_query_aggregate (BVIEW_BST_HISTORY_QUERY_WALK_t *walk,
+                                         BVIEW_BST_QUERY_SAMPLE_t *sample)
+{
+  const BVIEW_BST_SNAPSHOT_LAYOUT_t *layout = &bst_info.unit[walk->unit].snapshot.layout;
+  BVIEW_BST_QUERY_MATCH_t *match;
+  BVIEW_BST_REALM_t realm;
+  unsigned int realmIndex, word, entry, counter, firstCounter, lastCounter, pos;
+  unsigned int numMatches = 0;
+  uint64_t bits, value;
+
+  BVIEW_BST_REALM_ITER (realm)
+  {
+    if (0 == (walk->filter.realms & realm))
+    {
+      continue;
+    }
+    realmIndex = BVIEW_BST_REALM_INDEX (realm);
+    firstCounter = layout->realmCounter[realmIndex];
+    lastCounter = firstCounter + layout->realmNumCounters[realmIndex];
+
+    for (word = 0; word < layout->bitmapWords[realmIndex]; word++)
+    {
+      for (bits = walk->select[layout->bitmapOffset[realmIndex] + word];
+           bits != 0; bits &= (bits - 1))
+      {
+        entry = (word * 64) + __builtin_ctzll (bits);
+        /* the counters of an entry are aggregated together */
+        if (0 == walk->aggCount[layout->offset[firstCounter] + entry])
+        {
+          continue;
+        }
+
+        match = &walk->matches[numMatches++];
+        match->realm = realm;
+        bst_history_entry_locate (layout, realm, entry, &match->port, &match->index);
+        match->numValues = 0;
+        for (counter = firstCounter;
+             (counter < lastCounter) && (match->numValues < BVIEW_BST_QUERY_MAX_VALUES);
+             counter++)
+        {
+          pos = layout->offset[counter] + entry;
+          switch (walk->filter.aggregate)
+          {
+            case BVIEW_BST_QUERY_AGGREGATE_MAX:
+              value = walk->aggMax[pos];
+              break;
+            case BVIEW_BST_QUERY_AGGREGATE_AVG:
+              value = (walk->aggSum[pos] + (walk->aggCount[pos] / 2)) / walk->aggCount[pos];
+              break;
+            default:
+              value = walk->aggLast[pos];
+              break;
+          }
+          match->values[match->numValues++] = bst_history_query_value (walk, counter, value);
+        }
+      }
+    }
+  }
+
+  sample->sequenceNumber = walk->lastSeq;
+  sample->time = (BVIEW_TIME_t) (walk->lastNs / BST_HISTORY_NSEC_PER_SEC);
+  sample->realtimeNs = walk->lastNs;
+  sample->numSamples = walk->numSamples;
+  sample->numMatches = numMatches;
+  sample->matches = walk->matches;
+}
+
+/*********************************************************************
+* @brief : returns the next sample of a query with a match, or the
+*          aggregate of the matches of all the samples
+*
+* @param[in] cookie : walk of the query
+* @param[out] sample : sample, valid till the next call
+*
+* @retval  : true : sample is returned.
+* @retval  : false : no more samples.
+*
+* @note    : the aggregate is returned once, after all the samples
+*            are walked.
+*
+*********************************************************************/
+bool bst_history_query_next (void *cookie, BVIEW_BST_QUERY_SAMPLE_t *sample)
+{
+  BVIEW_BST_HISTORY_QUERY_WALK_t *walk = (BVIEW_BST_HISTORY_QUERY_WALK_t *) cookie;
+  BVIEW_BST_HISTORY_CXT_t *cxt;
+  BST_HISTORY_ENTRY_HDR_t hdr;
+  uint64_t seq, realtimeNs;
+  unsigned int numMatches;
+
+  if ((NULL == walk) || (NULL == walk->counters) || (NULL == sample))
+  {
+    return false;
+  }
+  cxt = BST_HISTORY_CXT_GET (walk->unit);
+
+  while (false == walk->done)
+  {
+    if ((0 == walk->entriesLeft) &&
+        (false == bst_history_query_block_next (walk, cxt)))
+    {
+      walk->done = true;
+      break;
+    }
+
+    walk->offset = bst_history_ring_read (cxt, walk->offset, &hdr, sizeof (hdr));
+    walk->offset = bst_history_ring_read (cxt, walk->offset, cxt->scratch, hdr.length);
+    realtimeNs = bst_history_entry_decode (&walk->codec, cxt->scratch, &hdr);
+    seq = walk->seq++;
+    walk->entriesLeft--;
+
+    if ((seq < walk->filter.startSeq) ||
+        (realtimeNs < walk->filter.startNs) || (realtimeNs > walk->filter.endNs))
+    {
+      continue;
+    }
+
+    numMatches = bst_history_query_match (walk);
+    if (0 == numMatches)
+    {
+      continue;
+    }
+    if (BVIEW_BST_QUERY_AGGREGATE_NONE == walk->filter.aggregate)
+    {
+      sample->sequenceNumber = seq;
+      sample->time = (BVIEW_TIME_t) (realtimeNs / BST_HISTORY_NSEC_PER_SEC);
+      sample->realtimeNs = realtimeNs;
+      sample->numSamples = 1;
+      sample->numMatches = numMatches;
+      sample->matches = walk->matches;
+      return true;
+    }
+    walk->lastSeq = seq;
+    walk->lastNs = realtimeNs;
+    walk->numSamples++;
+  }
+
+  if ((BVIEW_BST_QUERY_AGGREGATE_NONE != walk->filter.aggregate) &&
+      (false == walk->aggregated))
+  {
+    walk->aggregated = true;
+    bst_history_query_aggregate (walk, sample);
+    return true;
+  }
+  return false;
+}
+
+/*********************************************************************
+* @brief : ends a walk of the samples of a query of the history
+*
+* @param[in] walk : walk
+*
+* @retval  : none
+*
+*********************************************************************/
+void bst_history_query_end (BVIEW_BST_HISTORY_QUERY_WALK_t *walk)
+{
+  if (NULL == walk)
+  {
+    return;
+  }
+  bst_history_query_free (walk);
+}
+
+/*********************************************************************
+* @brief : checks the summary of a block against its entries
+*
+* @param[in] cxt : history
+* @param[in] blockIndex : block, 0 for the oldest one
+* @param[in] summary : summary of the entries of the block, replayed
+*
+* @retval  : true : summary of the block matches its entries.
+* @retval  : false : a query may skip an entry of the block.
+*
+* @note    : the oldest block keeps the summary of the entries
+*            dropped from it, which only covers more than its entries.
+*
+*********************************************************************/
+static bool bst_history_block_check (const BVIEW_BST_HISTORY_CXT_t *cxt,
+                                     unsigned int blockIndex,
+                                     const BVIEW_BST_HISTORY_BLOCK_t *summary)
+{
+  const BVIEW_BST_HISTORY_BLOCK_t *block = BST_HISTORY_BLOCK_GET (cxt, blockIndex);
+  unsigned int realmIndex;
+  bool oldest = (0 == blockIndex) ? true : false;
+
+  if ((blockIndex >= cxt->numBlocks) ||
+      (block->firstSeq != summary->firstSeq) ||
+      (block->numEntries != summary->numEntries) ||
+      (block->minNs > summary->minNs) || (block->maxNs != summary->maxNs) ||
+      ((false == oldest) && (block->minNs != summary->minNs)))
+  {
+    LOG_POST (BVIEW_LOG_ERROR,
+              "bst history block of entry %" PRIu64 " does not match its entries\r\n",
+              summary->firstSeq);
+    return false;
+  }
+  for (realmIndex = 0; realmIndex < BVIEW_BST_NUM_REALMS; realmIndex++)
+  {
+    if ((block->realmMax[realmIndex] < summary->realmMax[realmIndex]) ||
+        ((false == oldest) &&
+         (block->realmMax[realmIndex] != summary->realmMax[realmIndex])))
+    {
+      LOG_POST (BVIEW_LOG_ERROR,
+                "bst history block of entry %" PRIu64 " does not match its entries\r\n",
+                summary->firstSeq);
+      return false;
+    }
+  }
+  return true;
+}
+
+/*********************************************************************
+* @brief : checks a small history against the records added to it
+*
+* @param[in] numRecords : records added, the ring wraps several times
+*
+* @retval  : BVIEW_STATUS_SUCCESS : every entry kept replays back to
+*                                   its record.
+* @retval  : BVIEW_STATUS_FAILURE : an entry did not replay back.
+* @retval  : BVIEW_STATUS_OUTOFMEMORY : no memory for the records.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : records are 100 ms apart with a jitter of a few micro
+*            seconds, a collection is missed now and then. Every
+*            eighth record is a random spike, to be stored as is, some
+*            do not change and the others move a few counters by a
+*            small step. The entries kept are to hold keyframes, entries of
+*            the codec and raw ones, and the summaries of the blocks
+*            are checked against the entries replayed. Run by the
+*            bench tool, not by the agent.
+*
+*********************************************************************/
+BVIEW_STATUS bst_history_check (unsigned int numRecords)
+{
+  BVIEW_ASIC_CAPABILITIES_t asic;
+  BVIEW_BST_SNAPSHOT_LAYOUT_t layout;
+  BVIEW_BST_HISTORY_CXT_t cxt;
+  BVIEW_BST_CODEC_t codec;
+  BST_HISTORY_ENTRY_HDR_t hdr;
+  uint32_t *records = NULL, *counters = NULL;
+  uint64_t *times = NULL;
+  BVIEW_BST_HISTORY_BLOCK_t summary;
+  uint32_t realmMax[BVIEW_BST_NUM_REALMS];
+  uint64_t seq, realtimeNs;
+  unsigned int record, index, blockIndex = 0;
+  unsigned int numRaw = 0, numKeyframes = 0, numEncoded = 0;
+  uint32_t seed = 1;
+  size_t offset, entryOffset;
+  BVIEW_STATUS rv = BVIEW_STATUS_SUCCESS;
+
+  if (0 == numRecords)
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+
+  memset (&asic, 0, sizeof (asic));
+  asic.numPorts = 4;
+  asic.numUnicastQueues = 32;
+  asic.numUnicastQueueGroups = 4;
+  asic.numMulticastQueues = 16;
+  asic.numServicePools = 4;
+  asic.numCommonPools = 1;
+  asic.numCpuQueues = 8;
+  asic.numRqeQueues = 11;
+  asic.numPriorityGroups = 8;
+  bst_snapshot_layout_init (&layout, &asic);
+
+  memset (&cxt, 0, sizeof (cxt));
+  records = (uint32_t *) calloc ((size_t) numRecords * layout.numCounters, sizeof (uint32_t));
+  times = (uint64_t *) calloc (numRecords, sizeof (uint64_t));
+  counters = (uint32_t *) calloc (layout.numCounters, sizeof (uint32_t));
+  if ((NULL == records) || (NULL == times) || (NULL == counters) ||
+      (BVIEW_STATUS_SUCCESS !=
+       bst_history_alloc (&cxt, &layout, BVIEW_BST_HISTORY_CHECK_SIZE, 4)))
+  {
+    free (records);
+    free (times);
+    free (counters);
+    return BVIEW_STATUS_OUTOFMEMORY;
+  }
+  cxt.firstSeq = 1;
+  cxt.nextSeq = 1;
+
+  realtimeNs = 1000000000ULL * 1500000000ULL;
+  for (record = 0; record < numRecords; record++)
+  {
+    uint32_t *array = &records[(size_t) record * layout.numCounters];
+    const uint32_t *previous = NULL;
+
+    /* a random record is a spike, the record after it moves on from
+       the one before it */
+    if (0 != record)
+    {
+      previous = array - (((0 == (record & 0x7)) ? 2 : 1) * (size_t) layout.numCounters);
+    }
+    seed = (seed * 1103515245) + 12345;
+    realtimeNs += 100000000ULL + ((seed >> 16) % 20000);
+    if (0 == ((seed >> 8) & 0x1F))
+    {
+      realtimeNs += 100000000ULL;
+    }
+    times[record] = realtimeNs;
+    for (index = 0; index < layout.numCounters; index++)
+    {
+      array[index] = (NULL == previous) ? 0 : previous[index];
+      seed = (seed * 1103515245) + 12345;
+      if (0x7 == (record & 0x7))
+      {
+        array[index] = seed;
+      }
+      else if (0 == (record % 5))
+      {
+        continue;
+      }
+      else if (0 == ((seed >> 16) & 0x7))
+      {
+        array[index] += ((seed >> 8) & 0xFF);
+        array[index] -= (array[index] >= 0x80) ? 0x80 : 0;
+      }
+    }
+    bst_history_entry_add (&cxt, realtimeNs, array);
+  }
+
+  /* the oldest entries are dropped, the others replay from the
+     counters before the oldest one */
+  if ((cxt.nextSeq != ((uint64_t) numRecords + 1)) || (1 == cxt.firstSeq))
+  {
+    rv = BVIEW_STATUS_FAILURE;
+  }
+  codec = cxt.first;
+  codec.counters = counters;
+  memcpy (counters, cxt.base, layout.numCounters * sizeof (uint32_t));
+  offset = cxt.head;
+  memset (&summary, 0, sizeof (summary));
+  for (seq = cxt.firstSeq; (BVIEW_STATUS_SUCCESS == rv) && (seq < cxt.nextSeq); seq++)
+  {
+    entryOffset = offset;
+    offset = bst_history_ring_read (&cxt, offset, &hdr, sizeof (hdr));
+    offset = bst_history_ring_read (&cxt, offset, cxt.scratch, hdr.length);
+    realtimeNs = bst_history_entry_decode (&codec, cxt.scratch, &hdr);
+    if (0 != (hdr.flags & BST_HISTORY_ENTRY_RAW))
+    {
+      numRaw++;
+    }
+    else if (0 != (hdr.flags & BST_HISTORY_ENTRY_KEYFRAME))
+    {
+      numKeyframes++;
+    }
+    else
+    {
+      numEncoded++;
+    }
+
+    record = (unsigned int) (seq - 1);
+    if ((realtimeNs != times[record]) ||
+        (0 != memcmp (counters, &records[(size_t) record * layout.numCounters],
+                      layout.numCounters * sizeof (uint32_t))))
+    {
+      LOG_POST (BVIEW_LOG_ERROR,
+                "bst history entry %" PRIu64 " does not replay back\r\n", seq);
+      rv = BVIEW_STATUS_FAILURE;
+    }
+
+    /* the entry is summarized by its block */
+    if ((0 != summary.numEntries) && (blockIndex < cxt.numBlocks) &&
+        (seq == (summary.firstSeq + BST_HISTORY_BLOCK_GET (&cxt, blockIndex)->numEntries)))
+    {
+      if (false == bst_history_block_check (&cxt, blockIndex, &summary))
+      {
+        rv = BVIEW_STATUS_FAILURE;
+      }
+      blockIndex++;
+      memset (&summary, 0, sizeof (summary));
+    }
+    if ((blockIndex >= cxt.numBlocks) ||
+        ((0 == summary.numEntries) &&
+         ((seq != BST_HISTORY_BLOCK_GET (&cxt, blockIndex)->firstSeq) ||
+          (entryOffset != BST_HISTORY_BLOCK_GET (&cxt, blockIndex)->offset))))
+    {
+      LOG_POST (BVIEW_LOG_ERROR,
+                "bst history entry %" PRIu64 " is not in its block\r\n", seq);
+      rv = BVIEW_STATUS_FAILURE;
+      break;
+    }
+    if (0 == summary.numEntries)
+    {
+      summary = *BST_HISTORY_BLOCK_GET (&cxt, blockIndex);
+      summary.numEntries = 0;
+      summary.minNs = realtimeNs;
+      summary.maxNs = realtimeNs;
+      memset (summary.realmMax, 0, sizeof (summary.realmMax));
+    }
+    summary.numEntries++;
+    summary.minNs = (summary.minNs > realtimeNs) ? realtimeNs : summary.minNs;
+    summary.maxNs = (summary.maxNs < realtimeNs) ? realtimeNs : summary.maxNs;
+    bst_history_realm_max_get (&layout, counters, realmMax);
+    for (index = 0; index < BVIEW_BST_NUM_REALMS; index++)
+    {
+      if (summary.realmMax[index] < realmMax[index])
+      {
+        summary.realmMax[index] = realmMax[index];
+      }
+    }
+  }
+  if ((BVIEW_STATUS_SUCCESS == rv) &&
+      ((false == bst_history_block_check (&cxt, blockIndex, &summary)) ||
+       ((blockIndex + 1) != cxt.numBlocks)))
+  {
+    rv = BVIEW_STATUS_FAILURE;
+  }
+  if ((BVIEW_STATUS_SUCCESS == rv) &&
+      ((0 == numRaw) || (0 == numKeyframes) || (0 == numEncoded)))
+  {
+    rv = BVIEW_STATUS_FAILURE;
+  }
+
+  bst_history_free (&cxt);
+  free (records);
+  free (times);
+  free (counters);
+  return rv;
+}
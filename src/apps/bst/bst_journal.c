@@ -0,0 +1,871 @@
+/*****************************************************************************
+  *
+  * (C) Copyright Broadcom Corporation 2015
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License");
+  * you may not use this file except in compliance with the License.
+  *
+  * You may obtain a copy of the License at
+  * http://www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ***************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stddef.h>
+#include <time.h>
+#include <inttypes.h>
+#include <pthread.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "json.h"
+#include "clear_bst_statistics.h"
+#include "clear_bst_thresholds.h"
+#include "configure_bst_thresholds.h"
+#include "configure_bst_feature.h"
+#include "configure_bst_tracking.h"
+#include "get_bst_tracking.h"
+#include "get_bst_feature.h"
+#include "get_bst_thresholds.h"
+#include "get_bst_report.h"
+#include "bst_json_encoder.h"
+#include "bst.h"
+#include "broadview.h"
+#include "bst_app.h"
+#include "openapps_log_api.h"
+
+/* BST Context Info*/
+extern BVIEW_BST_CXT_t bst_info;
+
+#define BST_JOURNAL_CXT_GET(_unit)  &bst_info.unit[_unit].journal
+
+#define BST_JOURNAL_BYTES_PER_MB    (1024 * 1024)
+
+/* file starts with two copies of the header, written in turns so that
+   one of them is always complete. The records follow */
+#define BST_JOURNAL_HDR_AREA        4096
+#define BST_JOURNAL_HDR_SLOT        512
+
+#define BST_JOURNAL_MAGIC           0x4a545342   /* "BSTJ" */
+#define BST_JOURNAL_RECORD_MAGIC    0x52545342   /* "BSTR" */
+#define BST_JOURNAL_VERSION         2
+
+/* payload of the record is the counters as is, the codec stream
+   restarts from it */
+#define BST_JOURNAL_RECORD_KEYFRAME 0x1
+/* the records continue at the start of the records area */
+#define BST_JOURNAL_RECORD_WRAP     0x2
+
+#define BST_JOURNAL_ALIGN(_len)     (((_len) + 7) & ~((size_t) 7))
+
+/* header of the file. The crc covers the fields after it */
+typedef struct _bst_journal_hdr_
+{
+  uint32_t magic;
+  uint32_t crc;
+  uint32_t version;
+  uint32_t numCounters;
+  uint64_t dataSize;
+  uint64_t generation;
+  /* position and sequence number of the oldest record */
+  uint64_t head;
+  uint64_t firstSeq;
+} BST_JOURNAL_HDR_t;
+
+/* header of a record, followed by its payload. The crc covers the
+   fields after it and the payload. The payload of the other records
+   is a sample of the codec stream of the unit */
+typedef struct _bst_journal_record_
+{
+  uint32_t magic;
+  uint32_t crc;
+  uint64_t seq;
+  uint64_t realtimeNs;
+  uint32_t length;
+  uint32_t flags;
+} BST_JOURNAL_RECORD_t;
+
+static uint32_t bst_journal_crc_table[256];
+
+/*********************************************************************
+* @brief : computes the crc32 of a buffer
+*
+* @param[in] crc : crc of the bytes before the buffer, 0 to start
+* @param[in] buf : buffer
+* @param[in] len : length of the buffer
+*
+* @retval  : crc32 of the bytes so far
+*
+*********************************************************************/
+static uint32_t bst_journal_crc (uint32_t crc, const void *buf, size_t len)
+{
+  const uint8_t *ptr = (const uint8_t *) buf;
+
+  crc = ~crc;
+  while (len--)
+  {
+    crc = bst_journal_crc_table[(crc ^ *ptr++) & 0xff] ^ (crc >> 8);
+  }
+  return ~crc;
+}
+
+/*********************************************************************
+* @brief : computes the crc32 of a record
+*
+* @param[in] rec : header of the record
+* @param[in] payload : payload of the record
+*
+* @retval  : crc32 of the record
+*
+*********************************************************************/
+static uint32_t bst_journal_record_crc (const BST_JOURNAL_RECORD_t *rec,
+                                        const uint8_t *payload)
+{
+  uint32_t crc;
+
+  crc = bst_journal_crc (0, &rec->seq,
+                         sizeof (BST_JOURNAL_RECORD_t) - offsetof (BST_JOURNAL_RECORD_t, seq));
+  return bst_journal_crc (crc, payload, rec->length);
+}
+
+/*********************************************************************
+* @brief : returns the position of a record, past the wrap marker
+*
+* @param[in] cxt : journal of the unit
+* @param[in] offset : position of the record
+*
+* @retval  : position of the record
+*
+* @note    : the records continue at the start of the records area
+*            when there is no room left for a record header.
+*
+*********************************************************************/
+static size_t bst_journal_offset_get (const BVIEW_BST_JOURNAL_CXT_t *cxt, size_t offset)
+{
+  BST_JOURNAL_RECORD_t rec;
+
+  if ((offset + sizeof (rec)) > cxt->dataSize)
+  {
+    return 0;
+  }
+  memcpy (&rec, &cxt->data[offset], sizeof (rec));
+  if ((BST_JOURNAL_RECORD_MAGIC == rec.magic) &&
+      (0 != (rec.flags & BST_JOURNAL_RECORD_WRAP)))
+  {
+    return 0;
+  }
+  return offset;
+}
+
+/*********************************************************************
+* @brief : reads back a record of the file
+*
+* @param[in] cxt : journal of the unit
+* @param[in] offset : position of the record
+* @param[in] seq : sequence number the record is expected to have
+* @param[out] rec : header of the record
+*
+* @retval  : true : record is complete.
+* @retval  : false : no such record, or it was not completely written.
+*
+*********************************************************************/
+static bool bst_journal_record_valid (const BVIEW_BST_JOURNAL_CXT_t *cxt, size_t offset,
+                                      uint64_t seq, BST_JOURNAL_RECORD_t *rec)
+{
+  if ((offset + sizeof (BST_JOURNAL_RECORD_t)) > cxt->dataSize)
+  {
+    return false;
+  }
+  memcpy (rec, &cxt->data[offset], sizeof (BST_JOURNAL_RECORD_t));
+
+  if ((BST_JOURNAL_RECORD_MAGIC != rec->magic) || (seq != rec->seq) ||
+      (rec->length > cxt->scratchSize) ||
+      ((offset + BST_JOURNAL_ALIGN (sizeof (BST_JOURNAL_RECORD_t) + rec->length)) > cxt->dataSize))
+  {
+    return false;
+  }
+  if ((0 != (rec->flags & BST_JOURNAL_RECORD_KEYFRAME)) &&
+      (rec->length != cxt->numCounters * sizeof (uint32_t)))
+  {
+    return false;
+  }
+  return (rec->crc == bst_journal_record_crc (rec, &cxt->data[offset + sizeof (BST_JOURNAL_RECORD_t)])) ?
+         true : false;
+}
+
+/*********************************************************************
+* @brief : writes the records so far and a header to the file
+*
+* @param[in] cxt : journal of the unit
+* @param[in] head : position of the oldest record
+* @param[in] firstSeq : sequence number of the oldest record
+*
+* @retval  : none
+*
+* @note    : the header is written to the older of its two copies,
+*            after the records it points to are on the disk. Invoked
+*            by the flusher once it is running.
+*
+*********************************************************************/
+static void bst_journal_header_write (BVIEW_BST_JOURNAL_CXT_t *cxt,
+                                      size_t head, uint64_t firstSeq)
+{
+  BST_JOURNAL_HDR_t hdr;
+
+  msync (cxt->map, cxt->mapSize, MS_SYNC);
+
+  memset (&hdr, 0, sizeof (hdr));
+  cxt->generation++;
+  hdr.magic = BST_JOURNAL_MAGIC;
+  hdr.version = BST_JOURNAL_VERSION;
+  hdr.numCounters = cxt->numCounters;
+  hdr.dataSize = cxt->dataSize;
+  hdr.generation = cxt->generation;
+  hdr.head = head;
+  hdr.firstSeq = firstSeq;
+  hdr.crc = bst_journal_crc (0, &hdr.version,
+                             sizeof (hdr) - offsetof (BST_JOURNAL_HDR_t, version));
+
+  memcpy (&cxt->map[(cxt->generation & 1) * BST_JOURNAL_HDR_SLOT], &hdr, sizeof (hdr));
+  msync (cxt->map, BST_JOURNAL_HDR_AREA, MS_SYNC);
+}
+
+/*********************************************************************
+* @brief : flusher of the file of a unit
+*
+* @param[in] arg : journal of the unit
+*
+* @retval  : NULL
+*
+* @note    : writes the records and a header on every request, and
+*            once more before it exits, so that the bst context does
+*            not wait for the disk.
+*
+*********************************************************************/
+static void *bst_journal_flusher (void *arg)
+{
+  BVIEW_BST_JOURNAL_CXT_t *cxt = (BVIEW_BST_JOURNAL_CXT_t *) arg;
+  uint64_t firstSeq;
+  size_t head;
+
+  pthread_mutex_lock (&cxt->lock);
+  while (true)
+  {
+    while ((false == cxt->flushPending) && (false == cxt->exitPending))
+    {
+      pthread_cond_wait (&cxt->cond, &cxt->lock);
+    }
+    if (false == cxt->flushPending)
+    {
+      break;
+    }
+    cxt->flushPending = false;
+    head = cxt->head;
+    firstSeq = cxt->firstSeq;
+    pthread_mutex_unlock (&cxt->lock);
+
+    bst_journal_header_write (cxt, head, firstSeq);
+
+    pthread_mutex_lock (&cxt->lock);
+  }
+  pthread_mutex_unlock (&cxt->lock);
+  return NULL;
+}
+
+/*********************************************************************
+* @brief : asks the flusher to write the records and the header
+*
+* @param[in] cxt : journal of the unit
+*
+* @retval  : none
+*
+*********************************************************************/
+static void bst_journal_flush_request (BVIEW_BST_JOURNAL_CXT_t *cxt)
+{
+  pthread_mutex_lock (&cxt->lock);
+  cxt->flushPending = true;
+  pthread_cond_signal (&cxt->cond);
+  pthread_mutex_unlock (&cxt->lock);
+  cxt->sinceSync = 0;
+}
+
+/*********************************************************************
+* @brief : stops the flusher of the file of a unit
+*
+* @param[in] cxt : journal of the unit
+*
+* @retval  : none
+*
+* @note    : the records so far are on the disk when it returns.
+*
+*********************************************************************/
+static void bst_journal_flusher_stop (BVIEW_BST_JOURNAL_CXT_t *cxt)
+{
+  if (false == cxt->flusherRunning)
+  {
+    return;
+  }
+  pthread_mutex_lock (&cxt->lock);
+  cxt->flushPending = true;
+  cxt->exitPending = true;
+  pthread_cond_signal (&cxt->cond);
+  pthread_mutex_unlock (&cxt->lock);
+
+  pthread_join (cxt->flusher, NULL);
+  cxt->flusherRunning = false;
+  cxt->exitPending = false;
+}
+
+/*********************************************************************
+* @brief : reads back the newest complete header of the file
+*
+* @param[in] cxt : journal of the unit
+* @param[out] hdr : header
+*
+* @retval  : true : the file has a header of this layout.
+* @retval  : false : the file is to be formatted.
+*
+*********************************************************************/
+static bool bst_journal_header_read (BVIEW_BST_JOURNAL_CXT_t *cxt, BST_JOURNAL_HDR_t *hdr)
+{
+  BST_JOURNAL_HDR_t slot;
+  bool found = false;
+  int index;
+
+  for (index = 0; index < 2; index++)
+  {
+    if (sizeof (slot) != pread (cxt->fd, &slot, sizeof (slot), index * BST_JOURNAL_HDR_SLOT))
+    {
+      continue;
+    }
+    if ((BST_JOURNAL_MAGIC != slot.magic) ||
+        (slot.crc != bst_journal_crc (0, &slot.version,
+                                      sizeof (slot) - offsetof (BST_JOURNAL_HDR_t, version))) ||
+        (BST_JOURNAL_VERSION != slot.version) ||
+        (cxt->numCounters != slot.numCounters) ||
+        (cxt->dataSize != slot.dataSize) ||
+        (slot.head >= slot.dataSize) || (0 == slot.firstSeq))
+    {
+      continue;
+    }
+    if ((false == found) || (slot.generation > hdr->generation))
+    {
+      *hdr = slot;
+      found = true;
+    }
+  }
+  return found;
+}
+
+/*********************************************************************
+* @brief : drops the oldest records of the journal
+*
+* @param[in] cxt : journal of the unit
+*
+* @retval  : none
+*
+* @note    : records are dropped up to the next keyframe, so that the
+*            oldest record can always be decoded. The flusher is asked
+*            for a header pointing past them, the file may restore no
+*            records if the agent stops before it is written.
+*
+*********************************************************************/
+static void bst_journal_evict (BVIEW_BST_JOURNAL_CXT_t *cxt)
+{
+  BST_JOURNAL_RECORD_t rec;
+
+  pthread_mutex_lock (&cxt->lock);
+  do
+  {
+    cxt->head = bst_journal_offset_get (cxt, cxt->head);
+    memcpy (&rec, &cxt->data[cxt->head], sizeof (rec));
+    cxt->head += BST_JOURNAL_ALIGN (sizeof (rec) + rec.length);
+    cxt->firstSeq++;
+    if (cxt->firstSeq == cxt->nextSeq)
+    {
+      cxt->head = 0;
+      cxt->tail = 0;
+      break;
+    }
+    cxt->head = bst_journal_offset_get (cxt, cxt->head);
+    memcpy (&rec, &cxt->data[cxt->head], sizeof (rec));
+  } while (0 == (rec.flags & BST_JOURNAL_RECORD_KEYFRAME));
+  pthread_mutex_unlock (&cxt->lock);
+
+  bst_journal_flush_request (cxt);
+}
+
+/*********************************************************************
+* @brief : makes room for a record at the end of the journal
+*
+* @param[in] cxt : journal of the unit
+* @param[in] size : size of the record
+*
+* @retval  : none
+*
+* @note    : the record does not wrap around the end of the records
+*            area, a wrap marker sends the reader to its start.
+*
+*********************************************************************/
+static void bst_journal_reserve (BVIEW_BST_JOURNAL_CXT_t *cxt, size_t size)
+{
+  BST_JOURNAL_RECORD_t rec;
+
+  while (true)
+  {
+    if ((cxt->firstSeq == cxt->nextSeq) && (0 != cxt->head))
+    {
+      pthread_mutex_lock (&cxt->lock);
+      cxt->head = 0;
+      pthread_mutex_unlock (&cxt->lock);
+    }
+    if (cxt->firstSeq == cxt->nextSeq)
+    {
+      cxt->tail = 0;
+    }
+
+    if ((cxt->tail > cxt->head) || (cxt->firstSeq == cxt->nextSeq))
+    {
+      if ((cxt->tail + size) <= cxt->dataSize)
+      {
+        return;
+      }
+      if (size < cxt->head)
+      {
+        if ((cxt->tail + sizeof (rec)) <= cxt->dataSize)
+        {
+          memset (&rec, 0, sizeof (rec));
+          rec.magic = BST_JOURNAL_RECORD_MAGIC;
+          rec.seq = cxt->nextSeq;
+          rec.flags = BST_JOURNAL_RECORD_WRAP;
+          rec.crc = bst_journal_record_crc (&rec, NULL);
+          memcpy (&cxt->data[cxt->tail], &rec, sizeof (rec));
+        }
+        cxt->tail = 0;
+        return;
+      }
+    }
+    else if ((cxt->tail + size) < cxt->head)
+    {
+      return;
+    }
+    bst_journal_evict (cxt);
+  }
+}
+
+/*********************************************************************
+* @brief : initializes the snapshot journal of a unit
+*
+* @param[in] unit : unit id
+*
+* @retval  : BVIEW_STATUS_SUCCESS : journal is initialized.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : the journal is closed until bst_journal_config_set.
+*
+*********************************************************************/
+BVIEW_STATUS bst_journal_init (unsigned int unit)
+{
+  BVIEW_BST_JOURNAL_CXT_t *cxt;
+  uint32_t crc;
+  unsigned int index, bit;
+
+  if (unit >= BVIEW_BST_MAX_UNITS)
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+  cxt = BST_JOURNAL_CXT_GET (unit);
+
+  memset (cxt, 0, sizeof (BVIEW_BST_JOURNAL_CXT_t));
+  cxt->unit = unit;
+  cxt->fd = -1;
+  cxt->firstSeq = 1;
+  cxt->nextSeq = 1;
+  pthread_mutex_init (&cxt->lock, NULL);
+  pthread_cond_init (&cxt->cond, NULL);
+
+  /* crc32 table, reflected polynomial */
+  for (index = 0; index < 256; index++)
+  {
+    crc = index;
+    for (bit = 0; bit < 8; bit++)
+    {
+      crc = (0 != (crc & 1)) ? (0xedb88320 ^ (crc >> 1)) : (crc >> 1);
+    }
+    bst_journal_crc_table[index] = crc;
+  }
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief : flushes and closes the journal file of a unit
+*
+* @param[in] cxt : journal of the unit
+*
+* @retval  : none
+*
+*********************************************************************/
+static void bst_journal_close (BVIEW_BST_JOURNAL_CXT_t *cxt)
+{
+  bst_journal_flusher_stop (cxt);
+  if (NULL != cxt->map)
+  {
+    munmap (cxt->map, cxt->mapSize);
+  }
+  if (0 <= cxt->fd)
+  {
+    close (cxt->fd);
+  }
+  free (cxt->last);
+  free (cxt->scratch);
+  cxt->map = NULL;
+  cxt->data = NULL;
+  cxt->last = NULL;
+  cxt->scratch = NULL;
+  cxt->fd = -1;
+}
+
+/*********************************************************************
+* @brief : flushes and closes the snapshot journal of a unit
+*
+* @param[in] unit : unit id
+*
+* @retval  : none
+*
+*********************************************************************/
+void bst_journal_uninit (unsigned int unit)
+{
+  BVIEW_BST_JOURNAL_CXT_t *cxt;
+
+  if (unit >= BVIEW_BST_MAX_UNITS)
+  {
+    return;
+  }
+  cxt = BST_JOURNAL_CXT_GET (unit);
+
+  bst_journal_close (cxt);
+  pthread_mutex_destroy (&cxt->lock);
+  pthread_cond_destroy (&cxt->cond);
+}
+
+/*********************************************************************
+* @brief : opens the journal file of a unit and reads back its records
+*
+* @param[in] cxt : journal of the unit, closed
+* @param[in] sizeMb : size of the file in MB
+* @param[in] file : path of the file, the unit id is appended to it
+*
+* @retval  : BVIEW_STATUS_SUCCESS : journal is open.
+* @retval  : BVIEW_STATUS_FAILURE : journal file could not be mapped.
+* @retval  : BVIEW_STATUS_OUTOFMEMORY : no memory for the journal.
+*
+* @note    : a file of another size or layout is formatted. The
+*            records are read back up to the first one which was not
+*            completely written, and restored into the history, the
+*            rollups, the statistics and the top entries if nothing
+*            was collected so far. The records which follow continue
+*            the file either way.
+*
+*********************************************************************/
+static BVIEW_STATUS bst_journal_open (BVIEW_BST_JOURNAL_CXT_t *cxt,
+                                      unsigned int sizeMb, const char *file)
+{
+  BST_JOURNAL_HDR_t hdr;
+  BST_JOURNAL_RECORD_t rec;
+  char path[BSTJSON_MAX_JOURNAL_FILE_LENGTH + JSON_MAX_NODE_LENGTH];
+  unsigned int unit = cxt->unit;
+  struct stat st;
+  size_t offset;
+  uint64_t seq, realtimeNs;
+  bool restore = (false == cxt->published) ? true : false;
+
+  cxt->numCounters = bst_info.unit[unit].snapshot.layout.numCounters;
+  cxt->scratchSize = cxt->numCounters * sizeof (uint32_t);
+  cxt->mapSize = (size_t) sizeMb * BST_JOURNAL_BYTES_PER_MB;
+  cxt->dataSize = cxt->mapSize - BST_JOURNAL_HDR_AREA;
+  cxt->last = (uint32_t *) calloc (cxt->numCounters, sizeof (uint32_t));
+  cxt->scratch = (uint8_t *) malloc (cxt->scratchSize);
+  if ((NULL == cxt->last) || (NULL == cxt->scratch))
+  {
+    bst_journal_close (cxt);
+    return BVIEW_STATUS_OUTOFMEMORY;
+  }
+  bst_codec_init (&cxt->codec, cxt->last, cxt->numCounters);
+
+  snprintf (path, sizeof (path), "%s%u", file, unit);
+  cxt->fd = open (path, O_RDWR | O_CREAT, 0644);
+  if ((0 > cxt->fd) || (0 != fstat (cxt->fd, &st)))
+  {
+    LOG_POST (BVIEW_LOG_ERROR,
+              "Failed to open bst journal %s, err = %d\r\n", path, errno);
+    bst_journal_close (cxt);
+    return BVIEW_STATUS_FAILURE;
+  }
+
+  memset (&hdr, 0, sizeof (hdr));
+  if (((size_t) st.st_size != cxt->mapSize) ||
+      (false == bst_journal_header_read (cxt, &hdr)))
+  {
+    /* a new file, or one of another layout. Start from zeros */
+    memset (&hdr, 0, sizeof (hdr));
+    hdr.firstSeq = 1;
+    if ((0 != ftruncate (cxt->fd, 0)) ||
+        (0 != ftruncate (cxt->fd, (off_t) cxt->mapSize)))
+    {
+      LOG_POST (BVIEW_LOG_ERROR,
+                "Failed to size bst journal %s, err = %d\r\n", path, errno);
+      bst_journal_close (cxt);
+      return BVIEW_STATUS_FAILURE;
+    }
+  }
+
+  cxt->map = (uint8_t *) mmap (NULL, cxt->mapSize, PROT_READ | PROT_WRITE,
+                               MAP_SHARED, cxt->fd, 0);
+  if (MAP_FAILED == cxt->map)
+  {
+    LOG_POST (BVIEW_LOG_ERROR,
+              "Failed to map bst journal %s, err = %d\r\n", path, errno);
+    cxt->map = NULL;
+    bst_journal_close (cxt);
+    return BVIEW_STATUS_FAILURE;
+  }
+  cxt->data = &cxt->map[BST_JOURNAL_HDR_AREA];
+  cxt->generation = hdr.generation;
+  cxt->head = hdr.head;
+  cxt->firstSeq = hdr.firstSeq;
+
+  /* read back the records, the oldest one is a keyframe */
+  offset = cxt->head;
+  seq = cxt->firstSeq;
+  while (true == bst_journal_record_valid (cxt, offset, seq, &rec))
+  {
+    if (0 != (rec.flags & BST_JOURNAL_RECORD_WRAP))
+    {
+      if (0 == offset)
+      {
+        break;
+      }
+      offset = 0;
+      continue;
+    }
+    if ((seq == cxt->firstSeq) && (0 == (rec.flags & BST_JOURNAL_RECORD_KEYFRAME)))
+    {
+      break;
+    }
+    if (0 != (rec.flags & BST_JOURNAL_RECORD_KEYFRAME))
+    {
+      bst_codec_sample_set (&cxt->codec, rec.realtimeNs,
+                            (const uint32_t *) &cxt->data[offset + sizeof (rec)]);
+    }
+    else if (0 == bst_codec_decode (&cxt->codec, &cxt->data[offset + sizeof (rec)],
+                                    rec.length, &realtimeNs))
+    {
+      break;
+    }
+    if (true == restore)
+    {
+      bst_history_restore (unit, rec.seq, rec.realtimeNs, cxt->last);
+      bst_rollup_restore (unit, rec.realtimeNs, cxt->last);
+      bst_sketch_restore (unit, rec.realtimeNs, cxt->last);
+      bst_top_restore (unit, rec.realtimeNs, cxt->last);
+    }
+
+    cxt->sinceKeyframe = (0 != (rec.flags & BST_JOURNAL_RECORD_KEYFRAME)) ?
+                         1 : (cxt->sinceKeyframe + 1);
+    offset += BST_JOURNAL_ALIGN (sizeof (rec) + rec.length);
+    if ((offset + sizeof (rec)) > cxt->dataSize)
+    {
+      offset = 0;
+    }
+    seq++;
+  }
+  cxt->tail = offset;
+  cxt->nextSeq = seq;
+  if (cxt->firstSeq == cxt->nextSeq)
+  {
+    cxt->head = 0;
+    cxt->tail = 0;
+  }
+  bst_journal_header_write (cxt, cxt->head, cxt->firstSeq);
+
+  if (0 != pthread_create (&cxt->flusher, NULL, bst_journal_flusher, cxt))
+  {
+    LOG_POST (BVIEW_LOG_ERROR,
+              "Failed to start the flusher of bst journal %s\r\n", path);
+    bst_journal_close (cxt);
+    return BVIEW_STATUS_FAILURE;
+  }
+  cxt->flusherRunning = true;
+
+  LOG_POST (BVIEW_LOG_INFO,
+            "bst application: journal %s %s %" PRIu64 " records of unit %d\r\n",
+            path, (true == restore) ? "restored" : "continues after",
+            cxt->nextSeq - cxt->firstSeq, unit);
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief : sizes the snapshot journal of a unit, opens its file and
+*          restores its records
+*
+* @param[in] unit : unit id
+* @param[in] sizeMb : size of the file in MB, 0 closes the journal
+* @param[in] file : path of the file, the unit id is appended to it
+*
+* @retval  : BVIEW_STATUS_SUCCESS : journal is open, or disabled.
+* @retval  : BVIEW_STATUS_FAILURE : journal file could not be mapped.
+* @retval  : BVIEW_STATUS_OUTOFMEMORY : no memory for the journal.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : invoked in the bst context only, once the records and
+*            the history of the unit are sized. The records are
+*            restored into the history before the first collection
+*            only, the history is not rewound under its readers.
+*
+*********************************************************************/
+BVIEW_STATUS bst_journal_config_set (unsigned int unit, unsigned int sizeMb,
+                                     const char *file)
+{
+  BVIEW_BST_JOURNAL_CXT_t *cxt;
+
+  if ((unit >= BVIEW_BST_MAX_UNITS) || (NULL == file))
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+  cxt = BST_JOURNAL_CXT_GET (unit);
+
+  bst_journal_close (cxt);
+  if ((0 == sizeMb) ||
+      (0 == bst_info.unit[unit].snapshot.layout.numCounters))
+  {
+    return BVIEW_STATUS_SUCCESS;
+  }
+  return bst_journal_open (cxt, sizeMb, file);
+}
+
+/*********************************************************************
+* @brief : adds a stats record to the snapshot journal of a unit
+*
+* @param[in] unit : unit id
+* @param[in] ss : record, published
+*
+* @retval  : BVIEW_STATUS_SUCCESS : record is added, or the journal
+*                                   is closed.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : invoked in the bst context only. The record is copied to
+*            the mapped file, the flusher writes it to the disk every
+*            few records.
+*            Every few records is a keyframe, the others hold the
+*            changes since the record before them.
+*
+*********************************************************************/
+BVIEW_STATUS bst_journal_append (unsigned int unit,
+                                 const BVIEW_BST_REPORT_SNAPSHOT_t *ss)
+{
+  BVIEW_BST_JOURNAL_CXT_t *cxt;
+  BST_JOURNAL_RECORD_t rec;
+  const uint32_t *counters;
+  const uint8_t *payload;
+  bool keyframe;
+  size_t size;
+
+  if ((unit >= BVIEW_BST_MAX_UNITS) || (NULL == ss))
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+  cxt = BST_JOURNAL_CXT_GET (unit);
+  cxt->published = true;
+  if (NULL == cxt->map)
+  {
+    return BVIEW_STATUS_SUCCESS;
+  }
+  counters = ss->snapshot_data.counters;
+
+  memset (&rec, 0, sizeof (rec));
+  rec.magic = BST_JOURNAL_RECORD_MAGIC;
+  rec.realtimeNs = bst_history_realtime_get (ss);
+
+  keyframe = ((cxt->firstSeq == cxt->nextSeq) ||
+              (cxt->sinceKeyframe >= BVIEW_BST_JOURNAL_KEYFRAME_INTERVAL)) ? true : false;
+  while (true)
+  {
+    payload = cxt->scratch;
+    rec.length = 0;
+    if (false == keyframe)
+    {
+      rec.length = bst_codec_encode (&cxt->codec, rec.realtimeNs, counters,
+                                     cxt->scratch, cxt->scratchSize);
+      keyframe = (0 == rec.length) ? true : false;
+    }
+    if (true == keyframe)
+    {
+      rec.length = cxt->numCounters * sizeof (uint32_t);
+      payload = (const uint8_t *) counters;
+    }
+
+    size = BST_JOURNAL_ALIGN (sizeof (rec) + rec.length);
+    if ((size + sizeof (rec)) >= cxt->dataSize)
+    {
+      return BVIEW_STATUS_SUCCESS;
+    }
+    bst_journal_reserve (cxt, size);
+
+    /* a delta needs the record before it */
+    if ((true == keyframe) || (cxt->firstSeq != cxt->nextSeq))
+    {
+      break;
+    }
+    keyframe = true;
+  }
+
+  rec.seq = cxt->nextSeq;
+  rec.flags = (true == keyframe) ? BST_JOURNAL_RECORD_KEYFRAME : 0;
+  rec.crc = bst_journal_record_crc (&rec, payload);
+  memcpy (&cxt->data[cxt->tail], &rec, sizeof (rec));
+  memcpy (&cxt->data[cxt->tail + sizeof (rec)], payload, rec.length);
+  cxt->tail += size;
+  cxt->nextSeq++;
+  if (true == keyframe)
+  {
+    bst_codec_sample_set (&cxt->codec, rec.realtimeNs, counters);
+  }
+  cxt->sinceKeyframe = (true == keyframe) ? 1 : (cxt->sinceKeyframe + 1);
+
+  if (++cxt->sinceSync >= BVIEW_BST_JOURNAL_SYNC_INTERVAL)
+  {
+    bst_journal_flush_request (cxt);
+  }
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief : writes the records of the snapshot journal of a unit
+*          to the disk and stops its flusher
+*
+* @param[in] unit : unit id
+*
+* @retval  : none
+*
+* @note    : invoked when the bst context exits, no record is
+*            appended after it.
+*
+*********************************************************************/
+void bst_journal_flush (unsigned int unit)
+{
+  if (unit >= BVIEW_BST_MAX_UNITS)
+  {
+    return;
+  }
+  bst_journal_flusher_stop (BST_JOURNAL_CXT_GET (unit));
+}
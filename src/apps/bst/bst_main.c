@@ -70,9 +70,14 @@ BVIEW_STATUS bst_type_api_get (int type, BVIEW_BST_API_HANDLER_t *handler)
     {BVIEW_BST_CMD_API_GET_REPORT, bst_get_report},
     {BVIEW_BST_CMD_API_GET_THRESHOLD, bst_get_report},
     {BVIEW_BST_CMD_API_TRIGGER_REPORT, bst_get_report},
+    {BVIEW_BST_CMD_API_GET_HISTORY, bst_get_history},
+    {BVIEW_BST_CMD_API_QUERY_HISTORY, bst_get_history},
+    {BVIEW_BST_CMD_API_GET_STATISTICS, bst_get_statistics},
+    {BVIEW_BST_CMD_API_GET_TOP, bst_get_top},
     {BVIEW_BST_CMD_API_SET_FEATURE, bst_config_feature_set},
     {BVIEW_BST_CMD_API_SET_TRACK, bst_config_track_set},
     {BVIEW_BST_CMD_API_SET_THRESHOLD, bst_config_threshold_set},
+    {BVIEW_BST_CMD_API_SET_THRESHOLD_BULK, bst_config_threshold_bulk_set},
     {BVIEW_BST_CMD_API_CLEAR_THRESHOLD, bst_clear_threshold_set},
     {BVIEW_BST_CMD_API_CLEAR_STATS, bst_clear_stats_set}
   };
@@ -114,6 +119,8 @@ BVIEW_STATUS bst_app_main (void)
   unsigned int rcvd_err = 0;
   unsigned int id = 0, num_units = 0;
   BVIEW_BST_API_HANDLER_t handler;
+  BVIEW_HR_TIME_t cycleStart, collectEnd, reportEnd;
+  bool periodic;
 
   if (BVIEW_STATUS_SUCCESS != bst_module_register ())
   {
@@ -142,38 +149,25 @@ BVIEW_STATUS bst_app_main (void)
           "Failed to register with asic for callbacks for  unit %d\r\n", id);
       return BVIEW_STATUS_FAILURE;
     }
-  /* get the asic capabilities of the system 
-     save the same so that the same can be reused */
-      if (BVIEW_STATUS_SUCCESS != sbapi_system_asic_capabilities_get(id, 
-                                          &bst_info.unit[id].asic_capabilities))
-      {
-        /* unable to get the asic capabilities
-           log error and return */
-          LOG_POST (BVIEW_LOG_ERROR, 
-               "Failed to Get Asic capabilities for unit %d. \r\n", id);
-          return BVIEW_STATUS_FAILURE;
-      }
-      else
-      {
-             
-        _BST_LOG(_BST_DEBUG_INFO, "supported capabilities are\n"
-            "num ports = %d, numUnicastQueues = %d\n" 
-            "numUnicastQueueGroups = %d, numMulticastQueues = %d\n" 
-            "numServicePools = %d, numCommonPools = %d\n" 
-            "numCpuQueues = %d, numRqeQueues = %d\n" 
-            "numRqeQueuePools = %d, numPriorityGroups = %d\n",
-             bst_info.unit[id].asic_capabilities.numPorts, 
-             bst_info.unit[id].asic_capabilities.numUnicastQueues, 
-             bst_info.unit[id].asic_capabilities.numUnicastQueueGroups, 
-             bst_info.unit[id].asic_capabilities.numMulticastQueues, 
-             bst_info.unit[id].asic_capabilities.numServicePools, 
-             bst_info.unit[id].asic_capabilities.numCommonPools, 
-             bst_info.unit[id].asic_capabilities.numCpuQueues, 
-             bst_info.unit[id].asic_capabilities.numRqeQueues, 
-             bst_info.unit[id].asic_capabilities.numRqeQueuePools, 
-             bst_info.unit[id].asic_capabilities.numPriorityGroups 
-            ); 
-      }
+    /* the asic capabilities are read when the records
+       of the unit are sized */
+    _BST_LOG(_BST_DEBUG_INFO, "supported capabilities are\n"
+        "num ports = %d, numUnicastQueues = %d\n" 
+        "numUnicastQueueGroups = %d, numMulticastQueues = %d\n" 
+        "numServicePools = %d, numCommonPools = %d\n" 
+        "numCpuQueues = %d, numRqeQueues = %d\n" 
+        "numRqeQueuePools = %d, numPriorityGroups = %d\n",
+         bst_info.unit[id].asic_capabilities.numPorts, 
+         bst_info.unit[id].asic_capabilities.numUnicastQueues, 
+         bst_info.unit[id].asic_capabilities.numUnicastQueueGroups, 
+         bst_info.unit[id].asic_capabilities.numMulticastQueues, 
+         bst_info.unit[id].asic_capabilities.numServicePools, 
+         bst_info.unit[id].asic_capabilities.numCommonPools, 
+         bst_info.unit[id].asic_capabilities.numCpuQueues, 
+         bst_info.unit[id].asic_capabilities.numRqeQueues, 
+         bst_info.unit[id].asic_capabilities.numRqeQueuePools, 
+         bst_info.unit[id].asic_capabilities.numPriorityGroups 
+        ); 
   }
 
 
@@ -209,6 +203,11 @@ BVIEW_STATUS bst_app_main (void)
           LOG_POST (BVIEW_LOG_ERROR,
               "failed to send response for command %d , err = %d. \r\n", msg_data.msg_type, rv);
         }
+        /* thresholds of a bulk request are owned by the message */
+        if (BVIEW_BST_CMD_API_SET_THRESHOLD_BULK == msg_data.msg_type)
+        {
+          bst_threshold_bulk_free (msg_data.bulk);
+        }
         continue;
       }
       /* Counter to check for read errors.. 
@@ -220,20 +219,51 @@ BVIEW_STATUS bst_app_main (void)
       /* get the api function for the method type */
       if (BVIEW_STATUS_SUCCESS != bst_type_api_get(msg_data.msg_type, &handler))
       {
+        /* thresholds of a bulk request are owned by the message */
+        if (BVIEW_BST_CMD_API_SET_THRESHOLD_BULK == msg_data.msg_type)
+        {
+          bst_threshold_bulk_free (msg_data.bulk);
+        }
         continue;
       }
 
+      /* periodic cycles are timed to detect overruns */
+      periodic = ((BVIEW_BST_CMD_API_GET_REPORT == msg_data.msg_type) &&
+                  (BVIEW_BST_STATS_PERIODIC == msg_data.report_type)) ? true : false;
+      if (true == periodic)
+      {
+        BVIEW_HR_TIME_GET (&cycleStart);
+      }
+
       rv = handler(&msg_data);
 
       reply_data.rv = rv;
 
+      if (true == periodic)
+      {
+        BVIEW_HR_TIME_GET (&collectEnd);
+      }
+
       rv = bst_copy_reply_params (&msg_data, &reply_data);
+
+      if (true == periodic)
+      {
+        BVIEW_HR_TIME_GET (&reportEnd);
+        bst_pacing_cycle_end (msg_data.unit,
+                              collectEnd.monotonic - cycleStart.monotonic,
+                              reportEnd.monotonic - collectEnd.monotonic);
+      }
       if (BVIEW_STATUS_SUCCESS != rv)
       {
         _BST_LOG(_BST_DEBUG_ERROR, "bst_main.c failed to send response for command %ld , err = %d. \r\n", msg_data.msg_type, rv);
          LOG_POST (BVIEW_LOG_ERROR,
             "failed to send response for command %d , err = %d. \r\n", msg_data.msg_type, rv);
       }
+      /* response is sent, release the thresholds of a bulk request */
+      if (BVIEW_BST_CMD_API_SET_THRESHOLD_BULK == msg_data.msg_type)
+      {
+        bst_threshold_bulk_free (msg_data.bulk);
+      }
       continue;
 
     }
@@ -254,6 +284,13 @@ BVIEW_STATUS bst_app_main (void)
         continue;
     }
   }                             /* while (1) */
+  /* send the reports queued so far */
+  bst_sender_uninit ();
+  /* keep the journal of the collections so far */
+  for (id = 0; id < num_units; id++)
+  {
+    bst_journal_flush (id);
+  }
              LOG_POST (BVIEW_LOG_EMERGENCY,
                  "exiting from bst pthread ... \r\n");
   pthread_exit(&bst_info.bst_thread);
@@ -283,6 +320,9 @@ BVIEW_STATUS bst_app_config_init (unsigned int num_units)
 
   BVIEW_BST_CONFIG_t bstMode;
   int unit_id = 0;
+  int tier = 0;
+  const int rollupIntervalSec[BVIEW_BST_DEFAULT_ROLLUP_TIERS] = BVIEW_BST_DEFAULT_ROLLUP_INTERVALS_SEC;
+  const int rollupRetention[BVIEW_BST_DEFAULT_ROLLUP_TIERS] = BVIEW_BST_DEFAULT_ROLLUP_RETENTION;
 
   if (0 == num_units)
   {
@@ -318,8 +358,71 @@ BVIEW_STATUS bst_app_config_init (unsigned int num_units)
     ptr->config.sendAsyncReports = BVIEW_BST_PERIODIC_REPORT_DEFAULT;
     /* collection interval  */
     ptr->config.collectionInterval = BVIEW_BST_DEFAULT_INTERVAL;
+    ptr->config.collectionIntervalMs = BVIEW_BST_DEFAULT_INTERVAL * BVIEW_BST_TIME_CONVERSION_FACTOR;
     /* stats in cells or bytes.  */
     ptr->config.statUnitsInCells = BVIEW_BST_DEFAULT_STATS_UNITS;
+    /* trigger coalesce window and rate limit */
+    ptr->config.triggerCoalesceInterval = BVIEW_BST_DEFAULT_TRIGGER_COALESCE_INTERVAL;
+    ptr->config.triggerRateLimit = BVIEW_BST_DEFAULT_TRIGGER_RATE_LIMIT;
+    ptr->config.triggerBurst = BVIEW_BST_DEFAULT_TRIGGER_BURST;
+    /* alignment of the periodic collection to the wall clock */
+    ptr->config.collectionAlign = BVIEW_BST_DEFAULT_COLLECTION_ALIGN;
+    ptr->config.collectionAlignOffsetMs = BVIEW_BST_DEFAULT_COLLECTION_ALIGN_OFFSET;
+    /* back-off of the collection interval on overruns */
+    ptr->config.collectionAdaptive = BVIEW_BST_DEFAULT_COLLECTION_ADAPTIVE;
+    bst_pacing_config_set (unit_id, ptr->config.collectionIntervalMs,
+                           ptr->config.collectionAdaptive);
+    /* snapshot history, disabled until configured */
+    ptr->config.historySizeMb = BVIEW_BST_DEFAULT_HISTORY_SIZE_MB;
+    if (BVIEW_STATUS_SUCCESS != bst_history_config_set (unit_id,
+                                          ptr->config.historySizeMb))
+    {
+      ptr->config.historySizeMb = 0;
+    }
+    /* rollups of the history at coarser resolutions, disabled until
+       configured. The default tiers are used unless others are given */
+    ptr->config.rollupSizeMb = BVIEW_BST_DEFAULT_ROLLUP_SIZE_MB;
+    ptr->config.numRollupTiers = BVIEW_BST_DEFAULT_ROLLUP_TIERS;
+    for (tier = 0; tier < BVIEW_BST_DEFAULT_ROLLUP_TIERS; tier++)
+    {
+      ptr->config.rollupIntervalSec[tier] = rollupIntervalSec[tier];
+      ptr->config.rollupRetention[tier] = rollupRetention[tier];
+    }
+    if (BVIEW_STATUS_SUCCESS != bst_rollup_config_set (unit_id,
+                                          ptr->config.rollupSizeMb,
+                                          ptr->config.numRollupTiers,
+                                          ptr->config.rollupIntervalSec,
+                                          ptr->config.rollupRetention))
+    {
+      ptr->config.rollupSizeMb = 0;
+    }
+    /* streaming statistics of the counters, disabled until configured */
+    ptr->config.statisticsSizeMb = BVIEW_BST_DEFAULT_STATISTICS_SIZE_MB;
+    ptr->config.statisticsSliceSec = BVIEW_BST_DEFAULT_STATISTICS_SLICE_SEC;
+    if (BVIEW_STATUS_SUCCESS != bst_sketch_config_set (unit_id,
+                                          ptr->config.statisticsSizeMb,
+                                          ptr->config.statisticsSliceSec))
+    {
+      ptr->config.statisticsSizeMb = 0;
+    }
+    /* top entries of the realms */
+    if (BVIEW_STATUS_SUCCESS != bst_top_config_set (unit_id))
+    {
+      LOG_POST (BVIEW_LOG_ERROR,
+                "Failed to size the top entries for unit %d\r\n", unit_id);
+    }
+    /* snapshot journal, disabled until configured. The records of
+       the earlier runs are restored into the history, the rollups,
+       the statistics and the top entries when it is opened */
+    ptr->config.journalSizeMb = BVIEW_BST_DEFAULT_JOURNAL_SIZE_MB;
+    strncpy (ptr->config.journalFile, BVIEW_BST_DEFAULT_JOURNAL_FILE,
+             sizeof (ptr->config.journalFile) - 1);
+    if (BVIEW_STATUS_SUCCESS != bst_journal_config_set (unit_id,
+                                          ptr->config.journalSizeMb,
+                                          ptr->config.journalFile))
+    {
+      ptr->config.journalSizeMb = 0;
+    }
 
 
     /* enable device tracking   */
@@ -417,6 +520,13 @@ BVIEW_STATUS bst_send_response (BVIEW_BST_RESPONSE_MSG_t * reply_data)
 {
   BVIEW_STATUS rv = BVIEW_STATUS_SUCCESS;
   uint8_t *pJsonBuffer = NULL;
+  BVIEW_BST_HISTORY_WALK_t walk;
+  BVIEW_BST_HISTORY_QUERY_WALK_t query;
+  BVIEW_BST_ROLLUP_QUERY_WALK_t rollup;
+  BVIEW_BST_HISTORY_INFO_t info;
+  BVIEW_BST_STATISTICS_t stats;
+  BVIEW_BST_TOP_t top;
+  unsigned int tier = 0;
 
   if (NULL == reply_data)
     return BVIEW_STATUS_INVALID_PARAMETER;
@@ -447,8 +557,8 @@ BVIEW_STATUS bst_send_response (BVIEW_BST_RESPONSE_MSG_t * reply_data)
 
   } 
 
-  /* Take lock*/
-  BST_LOCK_TAKE (reply_data->unit);
+  /* No lock is taken. the records hold a reference for the response,
+     config and track are only modified in this context */
   switch (reply_data->msg_type)
   {
     case BVIEW_BST_CMD_API_GET_TRACK:
@@ -464,6 +574,8 @@ BVIEW_STATUS bst_send_response (BVIEW_BST_RESPONSE_MSG_t * reply_data)
 
       rv = bstjson_encode_get_bst_feature (reply_data->unit, reply_data->msg_type,
           reply_data->response.config,
+          &reply_data->trigger_stats,
+          &reply_data->collection_stats,
           &pJsonBuffer);
       break;
 
@@ -485,6 +597,7 @@ BVIEW_STATUS bst_send_response (BVIEW_BST_RESPONSE_MSG_t * reply_data)
                                           &reply_data->options,
                                           reply_data->asic_capabilities,
                                           &reply_data->response.report.active->tv,
+                                          reply_data->response.report.active->realmTime,
                                           &pJsonBuffer); 
       }
       else
@@ -495,10 +608,112 @@ BVIEW_STATUS bst_send_response (BVIEW_BST_RESPONSE_MSG_t * reply_data)
                                           &reply_data->options,
                                           reply_data->asic_capabilities,
                                           &reply_data->response.report.active->tv,
+                                          reply_data->response.report.active->realmTime,
                                           &pJsonBuffer); 
       }
 
         break;
+
+    case BVIEW_BST_CMD_API_GET_HISTORY:
+      /* call json encoder api for the history, the entries
+         are decoded one at a time as they are encoded */
+      rv = bst_history_walk_start (reply_data->unit, reply_data->response.history, &walk);
+      if (BVIEW_STATUS_SUCCESS == rv)
+      {
+        bst_history_info_get (reply_data->unit, &info);
+        rv = bstjson_encode_get_bst_history (reply_data->unit, reply_data->id,
+                                             &reply_data->options,
+                                             reply_data->asic_capabilities,
+                                             &info,
+                                             reply_data->response.history->maxEntries,
+                                             bst_history_walk_next, &walk,
+                                             &pJsonBuffer);
+        bst_history_walk_end (&walk);
+      }
+      break;
+
+    case BVIEW_BST_CMD_API_QUERY_HISTORY:
+      /* a query at a resolution is served by the coarsest rollup
+         tier within it, the buckets are decoded as they are encoded */
+      if ((0 != reply_data->response.filter->resolutionSec) &&
+          (BVIEW_STATUS_SUCCESS == bst_rollup_tier_select (reply_data->unit,
+                                          reply_data->response.filter->resolutionSec, &tier)))
+      {
+        rv = bst_rollup_query_start (reply_data->unit, tier, reply_data->response.filter,
+                                     (true == reply_data->options.statUnitsInCells) ? 1 :
+                                     reply_data->asic_capabilities->cellToByteConv,
+                                     &rollup);
+        if (BVIEW_STATUS_SUCCESS == rv)
+        {
+          bst_rollup_info_get (reply_data->unit, tier, &info);
+          rv = bstjson_encode_query_bst_history (reply_data->unit, reply_data->id,
+                                                 &info,
+                                                 reply_data->response.filter->aggregate,
+                                                 reply_data->response.filter->maxEntries,
+                                                 bst_rollup_query_next, &rollup,
+                                                 &rollup.stats,
+                                                 &pJsonBuffer);
+          bst_rollup_query_end (&rollup);
+        }
+        break;
+      }
+      /* call json encoder api for the query, the blocks of
+         the history which may match are decoded as they are encoded */
+      rv = bst_history_query_start (reply_data->unit, reply_data->response.filter,
+                                    (true == reply_data->options.statUnitsInCells) ? 1 :
+                                    reply_data->asic_capabilities->cellToByteConv,
+                                    &query);
+      if (BVIEW_STATUS_SUCCESS == rv)
+      {
+        bst_history_info_get (reply_data->unit, &info);
+        rv = bstjson_encode_query_bst_history (reply_data->unit, reply_data->id,
+                                               &info,
+                                               reply_data->response.filter->aggregate,
+                                               reply_data->response.filter->maxEntries,
+                                               bst_history_query_next, &query,
+                                               &query.stats,
+                                               &pJsonBuffer);
+        bst_history_query_end (&query);
+      }
+      break;
+
+    case BVIEW_BST_CMD_API_GET_STATISTICS:
+      /* the histograms of the slices within the window are merged,
+         and the percentiles of the matches encoded */
+      rv = bst_sketch_query (reply_data->unit, reply_data->response.sketch,
+                             (true == reply_data->options.statUnitsInCells) ? 1 :
+                             reply_data->asic_capabilities->cellToByteConv,
+                             &stats);
+      if (BVIEW_STATUS_SUCCESS == rv)
+      {
+        rv = bstjson_encode_get_bst_statistics (reply_data->unit, reply_data->id,
+                                                &stats, &pJsonBuffer);
+        bst_sketch_query_end (&stats);
+      }
+      break;
+
+    case BVIEW_BST_CMD_API_GET_TOP:
+      /* the top lists of the record or of the slices within the
+         window are merged, and the entries encoded */
+      rv = bst_top_query (reply_data->unit, reply_data->response.top,
+                          (true == reply_data->options.statUnitsInCells) ? 1 :
+                          reply_data->asic_capabilities->cellToByteConv,
+                          &top);
+      if (BVIEW_STATUS_SUCCESS == rv)
+      {
+        rv = bstjson_encode_get_bst_top (reply_data->unit, reply_data->id,
+                                         &top, &pJsonBuffer);
+        bst_top_query_end (&top);
+      }
+      break;
+
+    case BVIEW_BST_CMD_API_SET_THRESHOLD_BULK:
+      /* call json encoder api for the status of every threshold */
+      rv = bstjson_encode_configure_bst_thresholds_bulk (reply_data->unit, reply_data->id,
+                                          reply_data->response.bulk->status,
+                                          reply_data->response.bulk->numEntries,
+                                          &pJsonBuffer);
+      break;
     default:
       break;
   }
@@ -535,8 +750,6 @@ BVIEW_STATUS bst_send_response (BVIEW_BST_RESPONSE_MSG_t * reply_data)
       bstjson_memory_free(pJsonBuffer);
     }
   }
-  /* release the lock for success and failed cases */
-  BST_LOCK_GIVE(reply_data->unit);
   return rv;
 }
 
@@ -560,8 +773,9 @@ BVIEW_STATUS bst_send_response (BVIEW_BST_RESPONSE_MSG_t * reply_data)
 *          trigger or get report, then only the active record is required. 
 *          incse of periodic report, the report contains 
 *          incremental/differential changes.. Wher as for get report 
-*          the report is complete. Ensure that the lock is taken at this function
-*          is released when the buffer for the data is allocated.
+*          the report is complete. The reports are handed to the sender
+*          with the references on their records, a periodic report is
+*          dropped if the sender is behind.
 *
 *********************************************************************/
 BVIEW_STATUS bst_copy_reply_params (BVIEW_BST_REQUEST_MSG_t * msg_data,
@@ -570,6 +784,7 @@ BVIEW_STATUS bst_copy_reply_params (BVIEW_BST_REQUEST_MSG_t * msg_data,
   BVIEW_BST_UNIT_CXT_t *ptr;
   BVIEW_BST_STAT_COLLECT_CONFIG_t *pCollect = &msg_data->request.collect;
   BVIEW_BST_REPORT_OPTIONS_t  *pResp; 
+  BVIEW_STATUS rv;
 
   if ((NULL == msg_data) || (NULL == reply_data))
     return BVIEW_STATUS_INVALID_PARAMETER;
@@ -609,6 +824,7 @@ BVIEW_STATUS bst_copy_reply_params (BVIEW_BST_REQUEST_MSG_t * msg_data,
           /* this report is of type trigger */
           reply_data->options.reportTrigger = true;
           reply_data->options.reportThreshold = false;
+          reply_data->options.triggerInfo = msg_data->trigger;
           reply_data->cookie = NULL;
         }
 
@@ -616,19 +832,24 @@ BVIEW_STATUS bst_copy_reply_params (BVIEW_BST_REQUEST_MSG_t * msg_data,
            and current record as new active */
         bst_update_data (BVIEW_BST_STATS, msg_data->unit);
 
-        /* assign the active records */
-        reply_data->response.report.active = ptr->stats_active_record_ptr;
+        /* hold the active and backup records till the response is sent */
+        bst_snapshot_acquire (msg_data->unit, BVIEW_BST_STATS,
+                              &reply_data->response.report.active,
+                              &reply_data->response.report.backup);
 
         /* copy the backup record ptr if and only if the report is periodic */
 
         if (BVIEW_BST_STATS_PERIODIC == msg_data->report_type)
         {
-          reply_data->response.report.backup = ptr->stats_backup_record_ptr;
           reply_data->cookie = NULL;
+          /* alignment error of the aligned periodic collection */
+          reply_data->options.reportAlignment = reply_data->response.report.active->aligned;
+          reply_data->options.alignErrorNs = reply_data->response.report.active->alignErrorNs;
         }
         else
         {
           /* copy null as the encoder function expects the null for non-periodic cases */
+          bst_snapshot_put (msg_data->unit, reply_data->response.report.backup);
           reply_data->response.report.backup = NULL;
         }
       }
@@ -637,7 +858,8 @@ BVIEW_STATUS bst_copy_reply_params (BVIEW_BST_REQUEST_MSG_t * msg_data,
     case BVIEW_BST_CMD_API_GET_THRESHOLD:
       {
         reply_data->options.reportThreshold = true;
-        reply_data->response.report.active = ptr->threshold_record_ptr;
+        bst_snapshot_acquire (msg_data->unit, BVIEW_BST_THRESHOLD,
+                              &reply_data->response.report.active, NULL);
         /* copy null as the encoder function expects the null  */
         reply_data->response.report.backup = NULL;
       }
@@ -645,18 +867,72 @@ BVIEW_STATUS bst_copy_reply_params (BVIEW_BST_REQUEST_MSG_t * msg_data,
 
     case BVIEW_BST_CMD_API_GET_FEATURE:
       reply_data->response.config = &ptr->bst_data->bst_config.config;
+      bst_trigger_stats_get (reply_data->unit, &reply_data->trigger_stats);
+      bst_pacing_stats_get (reply_data->unit, &reply_data->collection_stats);
       break;
 
     case BVIEW_BST_CMD_API_GET_TRACK:
       reply_data->response.track = &ptr->bst_data->bst_config.track;
       break;
 
+    case BVIEW_BST_CMD_API_SET_THRESHOLD_BULK:
+      reply_data->response.bulk = msg_data->bulk;
+      break;
+
+    case BVIEW_BST_CMD_API_GET_HISTORY:
+      /* the entries are read from the history while encoding */
+      reply_data->response.history = &msg_data->history;
+      break;
+
+    case BVIEW_BST_CMD_API_QUERY_HISTORY:
+      /* the samples are matched against the filters while encoding */
+      reply_data->response.filter = &msg_data->filter;
+      break;
+
+    case BVIEW_BST_CMD_API_GET_STATISTICS:
+      /* the histograms are merged while encoding */
+      reply_data->response.sketch = &msg_data->sketch;
+      break;
+
+    case BVIEW_BST_CMD_API_GET_TOP:
+      /* the top lists are merged while encoding */
+      reply_data->response.top = &msg_data->top;
+      break;
+
     default:
       break;
   }
-  /* release the lock for success and failed cases */
+  if ((BVIEW_BST_CMD_API_GET_REPORT != msg_data->msg_type) &&
+      (BVIEW_BST_CMD_API_TRIGGER_REPORT != msg_data->msg_type) &&
+      (BVIEW_BST_CMD_API_GET_THRESHOLD != msg_data->msg_type))
+  {
+    return bst_send_response(reply_data);
+  }
 
-  return bst_send_response(reply_data);
+  /* the report is encoded and sent off the bst context, the sender
+     releases the records once it is sent */
+  rv = bst_sender_post (reply_data);
+  if (BVIEW_STATUS_SUCCESS == rv)
+  {
+    return rv;
+  }
+  if ((BVIEW_STATUS_TABLE_FULL == rv) &&
+      (BVIEW_BST_CMD_API_GET_REPORT == msg_data->msg_type) &&
+      (BVIEW_BST_STATS_PERIODIC == msg_data->report_type))
+  {
+    /* the sender is behind, the periodic report is dropped
+       rather than stalling the collection */
+    bst_pacing_report_drop (msg_data->unit);
+    rv = BVIEW_STATUS_SUCCESS;
+  }
+  else
+  {
+    /* requested reports are not dropped, send it from here */
+    rv = bst_send_response(reply_data);
+  }
+  bst_snapshot_put (msg_data->unit, reply_data->response.report.active);
+  bst_snapshot_put (msg_data->unit, reply_data->response.report.backup);
+  return rv;
 }
 
 /*********************************************************************
@@ -710,13 +986,23 @@ BVIEW_STATUS bst_periodic_collection_cb (union sigval sigval)
   BVIEW_BST_REQUEST_MSG_t msg_data;
   BVIEW_STATUS rv; 
 
+  memset (&msg_data, 0, sizeof (BVIEW_BST_REQUEST_MSG_t));
   msg_data.report_type = BVIEW_BST_STATS_PERIODIC;
   msg_data.msg_type = BVIEW_BST_CMD_API_GET_REPORT;
   msg_data.unit = (*(int *)sigval.sival_ptr);
+
+  /* the previous cycle is still in progress, skip this tick
+     instead of queuing a stale request behind it */
+  if (BVIEW_STATUS_SUCCESS != bst_pacing_tick (msg_data.unit))
+  {
+    return BVIEW_STATUS_SUCCESS;
+  }
+
   /* Send the message to the bst application */
   rv = bst_send_request (&msg_data);
   if (BVIEW_STATUS_SUCCESS != rv)
   {
+    bst_pacing_tick_cancel (msg_data.unit);
     LOG_POST (BVIEW_LOG_ERROR,
         "Failed to send periodic collection message to bst application. err = %d\r\n", rv);
        return BVIEW_STATUS_FAILURE;
@@ -749,6 +1035,8 @@ void bst_app_uninit ()
   {
     LOG_POST (BVIEW_LOG_ERROR, "Failed to get num of units\r\n");
   }
+  /* queued reports hold references on the records */
+  bst_sender_uninit ();
   for (id = 0; id < num_units; id++)
   {
     /* if periodic collection is enabled
@@ -759,32 +1047,20 @@ void bst_app_uninit ()
     /* Destroy mutex */
     bst_mutex = &bst_info.unit[id].bst_mutex;
     pthread_mutex_destroy (bst_mutex);
+    bst_trigger_uninit (id);
+    bst_pacing_uninit (id);
+    bst_journal_uninit (id);
+    bst_history_uninit (id);
+    bst_rollup_uninit (id);
+    bst_sketch_uninit (id);
+    bst_top_uninit (id);
+    bst_snapshot_uninit (id);
 
     /* free all memeory */
     if (NULL != bst_info.unit[id].bst_data)
     {
       free (bst_info.unit[id].bst_data);
     }
-
-    if (NULL != bst_info.unit[id].stats_active_record_ptr)
-    {
-      free (bst_info.unit[id].stats_active_record_ptr);
-    }
-
-    if (NULL != bst_info.unit[id].stats_backup_record_ptr)
-    {
-      free (bst_info.unit[id].stats_backup_record_ptr);
-    }
-
-    if (NULL != bst_info.unit[id].stats_current_record_ptr)
-    {
-      free (bst_info.unit[id].stats_current_record_ptr);
-    }
-
-    if (NULL != bst_info.unit[id].threshold_record_ptr)
-    {
-      free (bst_info.unit[id].threshold_record_ptr);
-    }
   }
   
   /* check if the message queue already exists.
@@ -839,6 +1115,22 @@ BVIEW_STATUS bst_main ()
   {
     bst_mutex = &bst_info.unit[id].bst_mutex;
     pthread_mutex_init (bst_mutex, NULL);
+    /* trigger coalescing state, has its own lock */
+    bst_trigger_init (id);
+    /* periodic collection pacing, has its own lock */
+    bst_pacing_init (id);
+    /* published records, reference counted */
+    bst_snapshot_init (id);
+    /* snapshot history, sized with the config */
+    bst_history_init (id);
+    /* snapshot journal, opened with the config */
+    bst_journal_init (id);
+    /* rollups, sized with the config */
+    bst_rollup_init (id);
+    /* streaming statistics, sized with the config */
+    bst_sketch_init (id);
+    /* top entries, sized with the layout */
+    bst_top_init (id);
   }
 
   /* get the number of units */
@@ -858,26 +1150,32 @@ BVIEW_STATUS bst_main ()
     bst_info.unit[id].bst_data =
       (BVIEW_BST_DATA_t *) malloc (sizeof (BVIEW_BST_DATA_t));
 
-    /* stats records */
-    bst_info.unit[id].stats_active_record_ptr =
-      (BVIEW_BST_REPORT_SNAPSHOT_t *)
-      malloc (sizeof (BVIEW_BST_REPORT_SNAPSHOT_t));
-    bst_info.unit[id].stats_backup_record_ptr =
-      (BVIEW_BST_REPORT_SNAPSHOT_t *)
-      malloc (sizeof (BVIEW_BST_REPORT_SNAPSHOT_t));
-    bst_info.unit[id].stats_current_record_ptr =
-      (BVIEW_BST_REPORT_SNAPSHOT_t *)
-      malloc (sizeof (BVIEW_BST_REPORT_SNAPSHOT_t));
+    /* get the asic capabilities of the system 
+       save the same so that the same can be reused.
+       the records are sized from the same */
+    if ((BVIEW_STATUS_SUCCESS != sbapi_system_asic_capabilities_get (id, 
+                                        &bst_info.unit[id].asic_capabilities)) ||
+        (BVIEW_STATUS_SUCCESS != bst_snapshot_layout_set (id,
+                                        &bst_info.unit[id].asic_capabilities)))
+    {
+      /* Free the resources allocated so far */
+      bst_app_uninit ();
+
+      LOG_POST (BVIEW_LOG_EMERGENCY,
+                "Failed to Get Asic capabilities for unit %d. \r\n", id);
+      return BVIEW_STATUS_RESOURCE_NOT_AVAILABLE;
+    }
+
+    /* stats records, the first collection is reported
+       against the cleared active record */
+    bst_info.unit[id].stats_active_record_ptr = bst_snapshot_alloc (id);
+    bst_info.unit[id].stats_current_record_ptr = NULL;
 
     /* threshold records */
-    bst_info.unit[id].threshold_record_ptr =
-      (BVIEW_BST_REPORT_SNAPSHOT_t *)
-      malloc (sizeof (BVIEW_BST_REPORT_SNAPSHOT_t));
+    bst_info.unit[id].threshold_record_ptr = bst_snapshot_alloc (id);
 
     if ((NULL == bst_info.unit[id].bst_data) ||
         (NULL == bst_info.unit[id].stats_active_record_ptr) ||
-        (NULL == bst_info.unit[id].stats_backup_record_ptr) ||
-        (NULL == bst_info.unit[id].stats_current_record_ptr) ||
         (NULL == bst_info.unit[id].threshold_record_ptr))
     {
       /* Free the resources allocated so far */
@@ -892,16 +1190,6 @@ BVIEW_STATUS bst_main ()
   for (id = 0; id < num_units; id++)
   {
     memset (bst_info.unit[id].bst_data, 0, sizeof (BVIEW_BST_DATA_t));
-
-    memset (bst_info.unit[id].stats_active_record_ptr, 0,
-            sizeof (BVIEW_BST_REPORT_SNAPSHOT_t));
-    memset (bst_info.unit[id].stats_backup_record_ptr, 0,
-            sizeof (BVIEW_BST_REPORT_SNAPSHOT_t));
-    memset (bst_info.unit[id].stats_current_record_ptr, 0,
-            sizeof (BVIEW_BST_REPORT_SNAPSHOT_t));
-
-    memset (bst_info.unit[id].threshold_record_ptr, 0,
-            sizeof (BVIEW_BST_REPORT_SNAPSHOT_t));
   }
 
     LOG_POST (BVIEW_LOG_INFO,
@@ -958,6 +1246,13 @@ BVIEW_STATUS bst_main ()
   }
   bst_info.recvMsgQid = recvMsgQid;
 
+  /* reports are sent off the bst thread */
+  if (BVIEW_STATUS_SUCCESS != bst_sender_init ())
+  {
+    LOG_POST (BVIEW_LOG_ERROR,
+              "bst application: reports are sent from the bst thread\r\n");
+  }
+
    /* create pthread for bst application */
   if (0 != pthread_create (&bst_info.bst_thread, NULL, (void *) &bst_app_main, NULL))
   {
@@ -978,7 +1273,7 @@ BVIEW_STATUS bst_main ()
 *
 * @param[in] unit : unit for which the trigger is generated 
 * @param[in] cookie : cookie
-* @param[in] type : trigger type
+* @param[in] triggerInfo : realm, port and index which raised the trigger
 *
 * @retval  : BVIEW_STATUS_SUCCESS
 * @retval  : BVIEW_STATUS_FAILURE
@@ -992,17 +1287,21 @@ BVIEW_STATUS bst_main ()
 *
 *************************************************************/
 BVIEW_STATUS bst_trigger_cb (int unit, void *cookie,
-                             BVIEW_BST_TRIGGER_TYPE type)
+                             BVIEW_BST_TRIGGER_INFO_t *triggerInfo)
 {
-  BVIEW_BST_REQUEST_MSG_t msg_data = {0};
+  BVIEW_BST_TRIGGER_INFO_t info;
   BVIEW_STATUS rv;
 
-  msg_data.unit = unit;
-  msg_data.msg_type = BVIEW_BST_CMD_API_TRIGGER_REPORT;
-  msg_data.report_type = BVIEW_BST_STATS_TRIGGER;
+  memset (&info, 0, sizeof (BVIEW_BST_TRIGGER_INFO_t));
+  /* the realm which raised the trigger is collected first */
+  if (NULL != triggerInfo)
+  {
+    info = *triggerInfo;
+  }
 
-  /* Send the message to the bst application */
-  rv = bst_send_request (&msg_data);
+  /* triggers are merged and rate limited before they are
+     posted to the bst application */
+  rv = bst_trigger_admit (unit, &info);
   if (BVIEW_STATUS_SUCCESS != rv)
   {
     LOG_POST (BVIEW_LOG_ERROR,
@@ -21,12 +21,17 @@
 #include "clear_bst_statistics.h"
 #include "clear_bst_thresholds.h"
 #include "configure_bst_thresholds.h"
+#include "configure_bst_thresholds_bulk.h"
 #include "configure_bst_feature.h"
 #include "configure_bst_tracking.h"
 #include "get_bst_tracking.h"
 #include "get_bst_feature.h"
 #include "get_bst_thresholds.h"
 #include "get_bst_report.h"
+#include "get_bst_history.h"
+#include "query_bst_history.h"
+#include "get_bst_statistics.h"
+#include "get_bst_top.h"
 #include "bst_json_encoder.h"
 #include "system.h"
 #include "bst.h"
@@ -488,6 +493,264 @@ BVIEW_STATUS bstjson_configure_bst_thresholds_impl (void *cookie, int asicId,
   return rv;
 }
 
+/*********************************************************************
+* @brief : validate one threshold of a bulk request and build its 
+*          south bound entry
+*
+* @param[in] capabilities : capabilities of the asic
+* @param[in] pCommand : parameters of the threshold
+* @param[out] entry : south bound entry of the threshold
+*
+* @retval  : BVIEW_STATUS_SUCCESS : the threshold is valid.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid realm, index or threshold.
+*
+* @note    : the checks are the ones of configure-bst-thresholds.
+*
+*********************************************************************/
+static BVIEW_STATUS bst_threshold_bulk_entry_build (BVIEW_ASIC_CAPABILITIES_t *capabilities,
+                                                    BSTJSON_CONFIGURE_BST_THRESHOLDS_t *pCommand,
+                                                    BVIEW_BST_THRESHOLD_BULK_ENTRY_t *entry)
+{
+  unsigned int threshold_type;
+
+  memset (entry, 0, sizeof (BVIEW_BST_THRESHOLD_BULK_ENTRY_t));
+
+  threshold_type = bst_realm_type_get (pCommand->realm);
+  if (0 == threshold_type)
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+
+  _BST_INPUT_PARAMS_CHECK(threshold_type, (*capabilities), pCommand);
+
+  entry->port = pCommand->port;
+
+  switch (threshold_type)
+  {
+  case BVIEW_BST_DEVICE_THRESHOLD:
+    if (BVIEW_BST_DEVICE_THRESHOLD_CHECK (pCommand))
+    {
+      return BVIEW_STATUS_INVALID_PARAMETER;
+    }
+    entry->realm = BVIEW_BST_REALM_DEVICE;
+    entry->threshold.device.threshold = pCommand->threshold;
+    break;
+
+  case BVIEW_BST_INGRESS_PORT_PG_THRESHOLD:
+    if ((0 == pCommand->port) ||
+        (BVIEW_BST_IPPG_SHRD_THRESHOLD_CHECK (pCommand)) ||
+        (BVIEW_BST_IPPG_HDRM_THRESHOLD_CHECK (pCommand)))
+    {
+      return BVIEW_STATUS_INVALID_PARAMETER;
+    }
+    entry->realm = BVIEW_BST_REALM_INGRESS_PORT_PG;
+    entry->index = pCommand->priorityGroup;
+    entry->threshold.ippg.umShareThreshold = pCommand->umShareThreshold;
+    entry->threshold.ippg.umHeadroomThreshold = pCommand->umHeadroomThreshold;
+    break;
+
+  case BVIEW_BST_INGRESS_PORT_SP_THRESHOLD:
+    if ((0 == pCommand->port) || (BVIEW_BST_IPSP_THRESHOLD_CHECK (pCommand)))
+    {
+      return BVIEW_STATUS_INVALID_PARAMETER;
+    }
+    entry->realm = BVIEW_BST_REALM_INGRESS_PORT_SP;
+    entry->index = pCommand->servicePool;
+    entry->threshold.ipsp.umShareThreshold = pCommand->umShareThreshold;
+    break;
+
+  case BVIEW_BST_INGRESS_SP_THRESHOLD:
+    if (BVIEW_BST_ISP_THRESHOLD_CHECK (pCommand))
+    {
+      return BVIEW_STATUS_INVALID_PARAMETER;
+    }
+    entry->realm = BVIEW_BST_REALM_INGRESS_SP;
+    entry->index = pCommand->servicePool;
+    entry->threshold.isp.umShareThreshold = pCommand->umShareThreshold;
+    break;
+
+  case BVIEW_BST_EGRESS_PORT_SP_THRESHOLD:
+    if ((0 == pCommand->port) || 
+        (BVIEW_BST_EPSP_UC_THRESHOLD_CHECK (pCommand)) ||
+        (BVIEW_BST_EPSP_UM_THRESHOLD_CHECK (pCommand)) ||
+        (BVIEW_BST_EPSP_MC_THRESHOLD_CHECK (pCommand)) ||
+        (BVIEW_BST_EPSP_MC_SQ_THRESHOLD_CHECK (pCommand)))
+    {
+      return BVIEW_STATUS_INVALID_PARAMETER;
+    }
+    entry->realm = BVIEW_BST_REALM_EGRESS_PORT_SP;
+    entry->index = pCommand->servicePool;
+    entry->threshold.epsp.ucShareThreshold = pCommand->ucShareThreshold;
+    entry->threshold.epsp.umShareThreshold = pCommand->umShareThreshold;
+    entry->threshold.epsp.mcShareThreshold = pCommand->mcShareThreshold;
+    break;
+
+  case BVIEW_BST_EGRESS_SP_THRESHOLD:
+    if ((BVIEW_BST_E_SP_UM_THRESHOLD_CHECK (pCommand)) ||
+        (BVIEW_BST_E_SP_MC_THRESHOLD_CHECK (pCommand)) ||
+        (BVIEW_BST_E_SP_MC_SQ_THRESHOLD_CHECK (pCommand)))
+    {
+      return BVIEW_STATUS_INVALID_PARAMETER;
+    }
+    entry->realm = BVIEW_BST_REALM_EGRESS_SP;
+    entry->index = pCommand->servicePool;
+    entry->threshold.esp.umShareThreshold = pCommand->umShareThreshold;
+    entry->threshold.esp.mcShareThreshold = pCommand->mcShareThreshold;
+    break;
+
+  case BVIEW_BST_EGRESS_UC_QUEUE_THRESHOLD:
+    if (BVIEW_BST_EGRESS_UC_THRESHOLD_CHECK (pCommand))
+    {
+      return BVIEW_STATUS_INVALID_PARAMETER;
+    }
+    entry->realm = BVIEW_BST_REALM_EGRESS_UC_QUEUE;
+    entry->index = pCommand->queue;
+    entry->threshold.eucq.ucBufferThreshold = pCommand->ucThreshold;
+    break;
+
+  case BVIEW_BST_EGRESS_UC_QUEUEGROUPS_THRESHOLD:
+    if (pCommand->queue || pCommand->servicePool ||
+        pCommand->threshold || pCommand->umShareThreshold || pCommand->umHeadroomThreshold ||
+        pCommand->ucShareThreshold || pCommand->mcShareThreshold ||
+        pCommand->mcShareQueueEntriesThreshold || pCommand->mcThreshold ||
+        pCommand->mcQueueEntriesThreshold || pCommand->cpuThreshold ||
+        pCommand->rqeThreshold ||
+        (BVIEW_BST_EGRESS_UC_THRESHOLD_CHECK (pCommand)))
+    {
+      return BVIEW_STATUS_INVALID_PARAMETER;
+    }
+    entry->realm = BVIEW_BST_REALM_EGRESS_UC_QUEUEGROUPS;
+    entry->index = pCommand->queueGroup;
+    entry->threshold.eucqg.ucBufferThreshold = pCommand->ucThreshold;
+    break;
+
+  case BVIEW_BST_EGRESS_MC_QUEUE_THRESHOLD:
+    if ((BVIEW_BST_E_MC_QG_THRESHOLD_CHECK (pCommand)) ||
+        (BVIEW_BST_E_MC_SQG_THRESHOLD_CHECK (pCommand)))
+    {
+      return BVIEW_STATUS_INVALID_PARAMETER;
+    }
+    entry->realm = BVIEW_BST_REALM_EGRESS_MC_QUEUE;
+    entry->index = pCommand->queue;
+    entry->threshold.emcq.mcBufferThreshold = pCommand->mcThreshold;
+    entry->threshold.emcq.mcQueueThreshold = pCommand->mcQueueEntriesThreshold;
+    break;
+
+  case BVIEW_BST_EGRESS_CPU_QUEUE_THRESHOLD:
+    if (BVIEW_BST_EGRESS_CPU_THRESHOLD_CHECK (pCommand))
+    {
+      return BVIEW_STATUS_INVALID_PARAMETER;
+    }
+    entry->realm = BVIEW_BST_REALM_EGRESS_CPU_QUEUE;
+    entry->index = pCommand->queue;
+    entry->threshold.cpuq.cpuBufferThreshold = pCommand->cpuThreshold;
+    break;
+
+  case BVIEW_BST_EGRESS_RQE_QUEUE_THRESHOLD:
+    if (BVIEW_BST_EGRESS_RQE_QUEUE_THRESHOLD_CHECK (pCommand))
+    {
+      return BVIEW_STATUS_INVALID_PARAMETER;
+    }
+    entry->realm = BVIEW_BST_REALM_EGRESS_RQE_QUEUE;
+    entry->index = pCommand->queue;
+    entry->threshold.rqeq.rqeBufferThreshold = pCommand->rqeThreshold;
+    break;
+
+  default:
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief : REST API handler to configure many bst thresholds
+*
+* @param[in] cookie : pointer to the cookie
+* @param[in] asicId : asic id 
+* @param[in] id     : unit id
+* @param[in] pCommand : pointer to the input command structure
+*
+* @retval  : BVIEW_STATUS_SUCCESS : the message is successfully posted to bst queue.
+* @retval  : BVIEW_STATUS_FAILURE : failed to post the message to bst.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+* @retval  : BVIEW_STATUS_OUTOFMEMORY : no memory for the thresholds.
+*
+* @note    : All the thresholds are validated against the asic capabilities
+*            here. Invalid ones are reported in the response, the valid ones
+*            are posted in one request and applied by the asic in one batch.
+*
+*********************************************************************/
+BVIEW_STATUS bstjson_configure_bst_thresholds_bulk_impl (void *cookie, int asicId,
+                                                    int id,
+                                                    BSTJSON_CONFIGURE_BST_THRESHOLDS_BULK_t
+                                                    * pCommand)
+{
+  BVIEW_BST_REQUEST_MSG_t msg_data;
+  BVIEW_STATUS rv = BVIEW_STATUS_SUCCESS;
+  BVIEW_ASIC_CAPABILITIES_t capabilities;
+  BVIEW_BST_THRESHOLD_BULK_t *bulk;
+  unsigned int index = 0;
+
+  if ((NULL == pCommand) || (NULL == pCommand->thresholds) ||
+      (0 >= pCommand->numThresholds))
+    return BVIEW_STATUS_INVALID_PARAMETER;
+
+  memset(&capabilities, 0, sizeof(BVIEW_ASIC_CAPABILITIES_t));
+
+  if (BVIEW_STATUS_SUCCESS != sbapi_system_asic_capabilities_get(asicId,
+        &capabilities))
+  {
+    /* unable to get the asic capabilities
+       log error and return */
+    LOG_POST (BVIEW_LOG_ERROR,
+        "Failed to Get Asic capabilities for unit %d. \r\n", asicId);
+    return BVIEW_STATUS_FAILURE;
+  }
+
+  bulk = bst_threshold_bulk_alloc (pCommand->numThresholds);
+  if (NULL == bulk)
+  {
+    LOG_POST (BVIEW_LOG_ERROR,
+        "Failed to allocate %d thresholds of bulk request. \r\n", pCommand->numThresholds);
+    return BVIEW_STATUS_OUTOFMEMORY;
+  }
+
+  /* validate all the thresholds, only the valid ones go to the asic */
+  for (index = 0; index < bulk->numEntries; index++)
+  {
+    bulk->status[index] = bst_threshold_bulk_entry_build (&capabilities,
+                                  &pCommand->thresholds[index],
+                                  &bulk->entries[bulk->numValid]);
+    if (BVIEW_STATUS_SUCCESS != bulk->status[index])
+    {
+      _BST_LOG(_BST_DEBUG_ERROR, "validation for bst threshold %u of bulk has failed for threshold type %s. \r\n",
+               index, pCommand->thresholds[index].realm);
+      continue;
+    }
+    bulk->validIndex[bulk->numValid] = index;
+    bulk->numValid++;
+  }
+
+  memset (&msg_data, 0, sizeof (BVIEW_BST_REQUEST_MSG_t));
+  msg_data.unit = asicId;
+  msg_data.cookie = cookie;
+  msg_data.msg_type = BVIEW_BST_CMD_API_SET_THRESHOLD_BULK;
+  msg_data.id = id;
+  msg_data.bulk = bulk;
+
+  /* send message to bst application */
+  rv = bst_send_request (&msg_data);
+  if (BVIEW_STATUS_SUCCESS != rv)
+  {
+    LOG_POST (BVIEW_LOG_ERROR,
+        "failed to post bulk bst thresholds to bst queue. err = %d.\r\n",rv);
+    /* the application never gets the thresholds */
+    bst_threshold_bulk_free (bulk);
+  }
+  return rv;
+}
+
 /*********************************************************************
 * @brief : REST API handler to configure the bst track params 
 *
@@ -609,6 +872,332 @@ BVIEW_STATUS bstjson_get_bst_report_impl (void *cookie, int asicId, int id,
   return rv;
 }
 
+/*********************************************************************
+* @brief : REST API handler to get the bst snapshot history
+*
+* @param[in] cookie : pointer to the cookie
+* @param[in] asicId : asic id 
+* @param[in] id     : unit id
+* @param[in] pCommand : pointer to the input command structure
+*
+* @retval  : BVIEW_STATUS_SUCCESS : the message is successfully posted to bst queue.
+* @retval  : BVIEW_STATUS_FAILURE : failed to post the message to bst.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : This api posts the request to bst application to walk the
+*            history ring. Absent bounds of the command (-1) select the
+*            whole range, times are converted to nanoseconds.
+*
+*********************************************************************/
+BVIEW_STATUS bstjson_get_bst_history_impl (void *cookie, int asicId, int id,
+                                           BSTJSON_GET_BST_HISTORY_t * pCommand)
+{
+  BVIEW_BST_REQUEST_MSG_t msg_data;
+  BVIEW_STATUS rv;
+
+  if (NULL == pCommand)
+    return BVIEW_STATUS_INVALID_PARAMETER;
+
+  memset (&msg_data, 0, sizeof (BVIEW_BST_REQUEST_MSG_t));
+  msg_data.unit = asicId;
+  msg_data.cookie = cookie;
+  msg_data.msg_type = BVIEW_BST_CMD_API_GET_HISTORY;
+  msg_data.id = id;
+  msg_data.request.collect = pCommand->report;
+
+  msg_data.history.startSeq = (pCommand->startSequenceNumber < 0) ? 0 :
+                              (uint64_t) pCommand->startSequenceNumber;
+  msg_data.history.endSeq = (pCommand->endSequenceNumber < 0) ? UINT64_MAX :
+                            (uint64_t) pCommand->endSequenceNumber;
+  msg_data.history.startNs = (pCommand->startTime < 0) ? 0 :
+                             (uint64_t) (pCommand->startTime * 1e9);
+  msg_data.history.endNs = (pCommand->endTime < 0) ? UINT64_MAX :
+                           (uint64_t) (pCommand->endTime * 1e9);
+  msg_data.history.maxEntries = pCommand->maxEntries;
+
+  /* send message to bst application */
+  rv = bst_send_request (&msg_data);
+  if (BVIEW_STATUS_SUCCESS != rv)
+  {
+    LOG_POST (BVIEW_LOG_ERROR,
+        "failed to post get bst history to bst queue. err = %d.\r\n",rv);
+  }
+  return rv;
+}
+
+/*********************************************************************
+* @brief : maps the realm, port and queue filters of a request
+*
+* @param[in] realm : name of the realm, all of them if empty
+* @param[in] numPorts : ports of the request, any port if 0
+* @param[in] ports : ports of the request
+* @param[in] minQueue : lowest queue, -1 if not present
+* @param[in] maxQueue : highest queue, -1 if not present
+* @param[in] minOccupancy : lowest occupancy of a match
+* @param[out] filter : filters of the query
+*
+* @retval  : BVIEW_STATUS_SUCCESS : filters are mapped.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : unknown realm or port.
+*
+*********************************************************************/
+static BVIEW_STATUS bstjson_query_filter_map (const char *realm, int numPorts,
+                                              const int *ports, int minQueue,
+                                              int maxQueue, int64_t minOccupancy,
+                                              BVIEW_BST_HISTORY_FILTER_t *filter)
+{
+  unsigned int i = 0;
+  int port = 0;
+
+  /* names of the realms, in the order of their bits */
+  const char *realm_names[BVIEW_BST_NUM_REALMS] = {
+    "device",
+    "ingress-port-priority-group",
+    "ingress-port-service-pool",
+    "ingress-service-pool",
+    "egress-port-service-pool",
+    "egress-service-pool",
+    "egress-uc-queue",
+    "egress-uc-queue-group",
+    "egress-mc-queue",
+    "egress-cpu-queue",
+    "egress-rqe-queue"
+  };
+
+  filter->realms = BVIEW_BST_REALM_ALL;
+  if (0 != realm[0])
+  {
+    filter->realms = 0;
+    for (i = 0; i < BVIEW_BST_NUM_REALMS; i++)
+    {
+      if (0 == strcmp (realm, realm_names[i]))
+      {
+        filter->realms = (0x1 << i);
+        break;
+      }
+    }
+    if (0 == filter->realms)
+    {
+      _BST_LOG(_BST_DEBUG_ERROR, "requested realm %s not found for the query\n", realm);
+      return BVIEW_STATUS_INVALID_PARAMETER;
+    }
+  }
+
+  /* entries of any port unless the ports are listed */
+  filter->anyPort = (0 == numPorts);
+  for (i = 0; i < (unsigned int) numPorts; i++)
+  {
+    port = ports[i];
+    if ((port <= 0) || (port >= (BVIEW_BST_QUERY_PORT_WORDS * 64)))
+    {
+      return BVIEW_STATUS_INVALID_PARAMETER;
+    }
+    filter->ports[port / 64] |= (1ULL << (port % 64));
+  }
+
+  filter->minIndex = (minQueue < 0) ? 0 : (unsigned int) minQueue;
+  filter->maxIndex = (maxQueue < 0) ? UINT32_MAX : (unsigned int) maxQueue;
+  filter->minOccupancy = (uint64_t) minOccupancy;
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief : REST API handler to query the bst history
+*
+* @param[in] cookie : pointer to the cookie
+* @param[in] asicId : asic id 
+* @param[in] id     : unit id
+* @param[in] pCommand : pointer to the input command structure
+*
+* @retval  : BVIEW_STATUS_SUCCESS : the message is successfully posted to bst queue.
+* @retval  : BVIEW_STATUS_FAILURE : failed to post the message to bst.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : This api posts the request to bst application to query the
+*            snapshot history. The realm and the aggregate are mapped
+*            from their names here.
+*
+*********************************************************************/
+BVIEW_STATUS bstjson_query_bst_history_impl (void *cookie, int asicId, int id,
+                                             BSTJSON_QUERY_BST_HISTORY_t * pCommand)
+{
+  BVIEW_BST_REQUEST_MSG_t msg_data;
+  BVIEW_STATUS rv;
+  unsigned int i = 0;
+
+  /* names of the aggregates, in the order of their values */
+  const char *aggregate_names[] = {"none", "max", "avg", "last"};
+
+  if (NULL == pCommand)
+    return BVIEW_STATUS_INVALID_PARAMETER;
+
+  memset (&msg_data, 0, sizeof (BVIEW_BST_REQUEST_MSG_t));
+  msg_data.unit = asicId;
+  msg_data.cookie = cookie;
+  msg_data.msg_type = BVIEW_BST_CMD_API_QUERY_HISTORY;
+  msg_data.id = id;
+
+  rv = bstjson_query_filter_map (pCommand->realm, pCommand->numPorts, pCommand->ports,
+                                 pCommand->minQueue, pCommand->maxQueue,
+                                 pCommand->minOccupancy, &msg_data.filter);
+  if (BVIEW_STATUS_SUCCESS != rv)
+  {
+    return rv;
+  }
+
+  msg_data.filter.aggregate = BVIEW_BST_QUERY_AGGREGATE_LAST + 1;
+  for (i = 0; i < (sizeof (aggregate_names) / sizeof (aggregate_names[0])); i++)
+  {
+    if (0 == strcmp (pCommand->aggregate, aggregate_names[i]))
+    {
+      msg_data.filter.aggregate = (BVIEW_BST_QUERY_AGGREGATE_t) i;
+      break;
+    }
+  }
+  if (BVIEW_BST_QUERY_AGGREGATE_LAST < msg_data.filter.aggregate)
+  {
+    _BST_LOG(_BST_DEBUG_ERROR, "requested aggregate %s is not supported\n", pCommand->aggregate);
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+
+  msg_data.filter.startSeq = (pCommand->startSequenceNumber < 0) ? 0 :
+                             (uint64_t) pCommand->startSequenceNumber;
+  msg_data.filter.startNs = (pCommand->startTime < 0) ? 0 :
+                            (uint64_t) (pCommand->startTime * 1e9);
+  msg_data.filter.endNs = (pCommand->endTime < 0) ? UINT64_MAX :
+                          (uint64_t) (pCommand->endTime * 1e9);
+  msg_data.filter.maxEntries = pCommand->maxEntries;
+
+  /* the buckets of a rollup are not aggregated further */
+  msg_data.filter.resolutionSec = (unsigned int) pCommand->resolutionSec;
+  if ((0 != msg_data.filter.resolutionSec) &&
+      (BVIEW_BST_QUERY_AGGREGATE_NONE != msg_data.filter.aggregate))
+  {
+    _BST_LOG(_BST_DEBUG_ERROR, "aggregate %s is not supported with a resolution\n", pCommand->aggregate);
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+
+  /* send message to bst application */
+  rv = bst_send_request (&msg_data);
+  if (BVIEW_STATUS_SUCCESS != rv)
+  {
+    LOG_POST (BVIEW_LOG_ERROR,
+        "failed to post query bst history to bst queue. err = %d.\r\n",rv);
+  }
+  return rv;
+}
+
+/*********************************************************************
+* @brief : REST API handler to get the streaming statistics
+*
+* @param[in] cookie : pointer to the cookie
+* @param[in] asicId : asic id 
+* @param[in] id     : unit id
+* @param[in] pCommand : pointer to the input command structure
+*
+* @retval  : BVIEW_STATUS_SUCCESS : the message is successfully posted to bst queue.
+* @retval  : BVIEW_STATUS_FAILURE : failed to post the message to bst.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : This api posts the request to bst application to get the
+*            percentiles of the counters over a window. The realm is
+*            mapped from its name here.
+*
+*********************************************************************/
+BVIEW_STATUS bstjson_get_bst_statistics_impl (void *cookie, int asicId, int id,
+                                              BSTJSON_GET_BST_STATISTICS_t * pCommand)
+{
+  BVIEW_BST_REQUEST_MSG_t msg_data;
+  BVIEW_STATUS rv;
+
+  if ((NULL == pCommand) || (0 >= pCommand->numPercentiles) ||
+      (BVIEW_BST_SKETCH_MAX_PERCENTILES < pCommand->numPercentiles))
+    return BVIEW_STATUS_INVALID_PARAMETER;
+
+  memset (&msg_data, 0, sizeof (BVIEW_BST_REQUEST_MSG_t));
+  msg_data.unit = asicId;
+  msg_data.cookie = cookie;
+  msg_data.msg_type = BVIEW_BST_CMD_API_GET_STATISTICS;
+  msg_data.id = id;
+
+  rv = bstjson_query_filter_map (pCommand->realm, pCommand->numPorts, pCommand->ports,
+                                 pCommand->minQueue, pCommand->maxQueue,
+                                 pCommand->minOccupancy, &msg_data.sketch.filter);
+  if (BVIEW_STATUS_SUCCESS != rv)
+  {
+    return rv;
+  }
+  msg_data.sketch.windowSec = (unsigned int) pCommand->windowSec;
+  msg_data.sketch.numPercentiles = (unsigned int) pCommand->numPercentiles;
+  memcpy (msg_data.sketch.percentiles, pCommand->percentiles,
+          pCommand->numPercentiles * sizeof (double));
+
+  /* send message to bst application */
+  rv = bst_send_request (&msg_data);
+  if (BVIEW_STATUS_SUCCESS != rv)
+  {
+    LOG_POST (BVIEW_LOG_ERROR,
+        "failed to post get bst statistics to bst queue. err = %d.\r\n",rv);
+  }
+  return rv;
+}
+
+/*********************************************************************
+* @brief : REST API handler to get the entries with the highest
+*          occupancy
+*
+* @param[in] cookie : pointer to the cookie
+* @param[in] asicId : asic id 
+* @param[in] id     : unit id
+* @param[in] pCommand : pointer to the input command structure
+*
+* @retval  : BVIEW_STATUS_SUCCESS : the message is successfully posted to bst queue.
+* @retval  : BVIEW_STATUS_FAILURE : failed to post the message to bst.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : This api posts the request to bst application to get the
+*            top entries of the record collected last or of a window.
+*            The realm is mapped from its name here.
+*
+*********************************************************************/
+BVIEW_STATUS bstjson_get_bst_top_impl (void *cookie, int asicId, int id,
+                                       BSTJSON_GET_BST_TOP_t * pCommand)
+{
+  BVIEW_BST_REQUEST_MSG_t msg_data;
+  BVIEW_BST_HISTORY_FILTER_t filter;
+  BVIEW_STATUS rv;
+
+  if ((NULL == pCommand) || (0 >= pCommand->count) ||
+      (BVIEW_BST_TOP_MAX_ENTRIES < pCommand->count))
+    return BVIEW_STATUS_INVALID_PARAMETER;
+
+  memset (&msg_data, 0, sizeof (BVIEW_BST_REQUEST_MSG_t));
+  msg_data.unit = asicId;
+  msg_data.cookie = cookie;
+  msg_data.msg_type = BVIEW_BST_CMD_API_GET_TOP;
+  msg_data.id = id;
+
+  /* the realm is mapped as that of a query, there are no other filters */
+  memset (&filter, 0, sizeof (filter));
+  rv = bstjson_query_filter_map (pCommand->realm, 0, NULL, -1, -1, 0, &filter);
+  if (BVIEW_STATUS_SUCCESS != rv)
+  {
+    return rv;
+  }
+  msg_data.top.realms = filter.realms;
+  msg_data.top.count = (unsigned int) pCommand->count;
+  msg_data.top.perRealm = (0 != pCommand->perRealm);
+  msg_data.top.windowSec = (unsigned int) pCommand->windowSec;
+
+  /* send message to bst application */
+  rv = bst_send_request (&msg_data);
+  if (BVIEW_STATUS_SUCCESS != rv)
+  {
+    LOG_POST (BVIEW_LOG_ERROR,
+        "failed to post get bst top to bst queue. err = %d.\r\n",rv);
+  }
+  return rv;
+}
+
 /*********************************************************************
 * @brief : REST API handler to get the bst threshold 
 *
@@ -639,8 +1228,10 @@ BVIEW_STATUS bstjson_get_bst_thresholds_impl (void *cookie, int asicId, int id,
   msg_data.cookie = cookie;
   msg_data.msg_type = BVIEW_BST_CMD_API_GET_THRESHOLD;
   msg_data.id = id;
+  msg_data.verify_hw = (pCommand->verifyHardware == 1) ? true : false;
 
-  memcpy (&msg_data.request.collect, pCommand, sizeof(BSTJSON_GET_BST_THRESHOLDS_t));
+  /* realm selection shares the layout of the report request */
+  memcpy (&msg_data.request.collect, pCommand, sizeof(BVIEW_BST_STAT_COLLECT_CONFIG_t));
 
   /* send message to bst application */
   rv = bst_send_request (&msg_data);
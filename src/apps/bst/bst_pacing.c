@@ -0,0 +1,371 @@
+/*****************************************************************************
+  *
+  * (C) Copyright Broadcom Corporation 2015
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License");
+  * you may not use this file except in compliance with the License.
+  *
+  * You may obtain a copy of the License at
+  * http://www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ***************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <signal.h>
+#include <pthread.h>
+#include "json.h"
+#include "clear_bst_statistics.h"
+#include "clear_bst_thresholds.h"
+#include "configure_bst_thresholds.h"
+#include "configure_bst_feature.h"
+#include "configure_bst_tracking.h"
+#include "get_bst_tracking.h"
+#include "get_bst_feature.h"
+#include "get_bst_thresholds.h"
+#include "get_bst_report.h"
+#include "bst_json_encoder.h"
+#include "bst.h"
+#include "broadview.h"
+#include "bst_app.h"
+#include "system.h"
+#include "openapps_log_api.h"
+
+/* BST Context Info*/
+extern BVIEW_BST_CXT_t bst_info;
+
+#define BVIEW_BST_PACING_NSEC_PER_USEC   1000ULL
+#define BVIEW_BST_PACING_NSEC_PER_MSEC   1000000ULL
+
+#define BST_PACING_CXT_GET(_unit)  &bst_info.unit[_unit].pacing
+
+/*********************************************************************
+* @brief : initializes the periodic collection pacing state of a unit
+*
+* @param[in] unit : unit id
+*
+* @retval  : BVIEW_STATUS_SUCCESS : pacing state is initialized.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+*********************************************************************/
+BVIEW_STATUS bst_pacing_init (unsigned int unit)
+{
+  BVIEW_BST_PACING_CXT_t *cxt;
+
+  if (unit >= BVIEW_BST_MAX_UNITS)
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+  cxt = BST_PACING_CXT_GET (unit);
+
+  memset (cxt, 0, sizeof (BVIEW_BST_PACING_CXT_t));
+  pthread_mutex_init (&cxt->lock, NULL);
+  cxt->unit = unit;
+  cxt->intervalMs = BVIEW_BST_DEFAULT_INTERVAL * BVIEW_BST_TIME_CONVERSION_FACTOR;
+  cxt->adaptive = BVIEW_BST_DEFAULT_COLLECTION_ADAPTIVE;
+  cxt->stats.effectiveIntervalMs = cxt->intervalMs;
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief : releases the periodic collection pacing state of a unit
+*
+* @param[in] unit : unit id
+*
+* @retval  : none
+*
+*********************************************************************/
+void bst_pacing_uninit (unsigned int unit)
+{
+  BVIEW_BST_PACING_CXT_t *cxt;
+
+  if (unit >= BVIEW_BST_MAX_UNITS)
+  {
+    return;
+  }
+  cxt = BST_PACING_CXT_GET (unit);
+  pthread_mutex_destroy (&cxt->lock);
+}
+
+/*********************************************************************
+* @brief : sets the collection interval and the adaptive back-off
+*
+* @param[in] unit : unit id
+* @param[in] intervalMs : configured collection interval in milli seconds
+* @param[in] adaptive : stretch the interval on overruns
+*
+* @retval  : BVIEW_STATUS_SUCCESS : parameters are applied.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : the interval in use is reset to the configured one. The
+*            caller registers the timer with bst_pacing_interval_get.
+*
+*********************************************************************/
+BVIEW_STATUS bst_pacing_config_set (unsigned int unit, int intervalMs,
+                                    bool adaptive)
+{
+  BVIEW_BST_PACING_CXT_t *cxt;
+
+  if ((unit >= BVIEW_BST_MAX_UNITS) || (intervalMs < 0))
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+  cxt = BST_PACING_CXT_GET (unit);
+
+  pthread_mutex_lock (&cxt->lock);
+  cxt->intervalMs = intervalMs;
+  cxt->adaptive = adaptive;
+  cxt->stats.effectiveIntervalMs = intervalMs;
+  cxt->quietCycles = 0;
+  pthread_mutex_unlock (&cxt->lock);
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief : returns the collection interval in use for a unit
+*
+* @param[in] unit : unit id
+*
+* @retval  : interval in milli seconds, the configured interval
+*            stretched by the adaptive back-off
+*
+*********************************************************************/
+int bst_pacing_interval_get (unsigned int unit)
+{
+  BVIEW_BST_PACING_CXT_t *cxt;
+  int intervalMs;
+
+  if (unit >= BVIEW_BST_MAX_UNITS)
+  {
+    return 0;
+  }
+  cxt = BST_PACING_CXT_GET (unit);
+
+  pthread_mutex_lock (&cxt->lock);
+  intervalMs = cxt->stats.effectiveIntervalMs;
+  pthread_mutex_unlock (&cxt->lock);
+  return intervalMs;
+}
+
+/*********************************************************************
+* @brief : admits a tick of the periodic collection timer
+*
+* @param[in] unit : unit id
+*
+* @retval  : BVIEW_STATUS_SUCCESS : the periodic request is to be posted.
+* @retval  : BVIEW_STATUS_NOTREADY : the previous cycle is still
+*                                    pending, the tick is skipped.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : invoked in the timer context. At most one periodic request
+*            of a unit is in the bst queue, so that a slow cycle does
+*            not pile up stale requests.
+*
+*********************************************************************/
+BVIEW_STATUS bst_pacing_tick (unsigned int unit)
+{
+  BVIEW_BST_PACING_CXT_t *cxt;
+  BVIEW_STATUS rv = BVIEW_STATUS_SUCCESS;
+
+  if (unit >= BVIEW_BST_MAX_UNITS)
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+  cxt = BST_PACING_CXT_GET (unit);
+
+  pthread_mutex_lock (&cxt->lock);
+  if (true == cxt->pending)
+  {
+    cxt->stats.numTicksSkipped++;
+    rv = BVIEW_STATUS_NOTREADY;
+  }
+  else
+  {
+    cxt->pending = true;
+  }
+  pthread_mutex_unlock (&cxt->lock);
+  return rv;
+}
+
+/*********************************************************************
+* @brief : releases the tick of a periodic request which is not posted
+*
+* @param[in] unit : unit id
+*
+* @retval  : none
+*
+*********************************************************************/
+void bst_pacing_tick_cancel (unsigned int unit)
+{
+  BVIEW_BST_PACING_CXT_t *cxt;
+
+  if (unit >= BVIEW_BST_MAX_UNITS)
+  {
+    return;
+  }
+  cxt = BST_PACING_CXT_GET (unit);
+
+  pthread_mutex_lock (&cxt->lock);
+  cxt->pending = false;
+  pthread_mutex_unlock (&cxt->lock);
+}
+
+/*********************************************************************
+* @brief : accounts a completed periodic collection cycle
+*
+* @param[in] unit : unit id
+* @param[in] collectNs : time taken to collect the snapshot, in nano seconds
+* @param[in] reportNs : time taken to hand the report to the sender, in nano seconds
+*
+* @retval  : BVIEW_STATUS_SUCCESS : cycle is accounted.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : invoked in the bst context. A cycle longer than the interval
+*            in use is an overrun. With the adaptive back-off, an overrun
+*            doubles the interval until the cycle fits, and the interval
+*            is halved back towards the configured one after
+*            BVIEW_BST_PACING_RECOVERY_CYCLES cycles which would also
+*            fit in a quarter of it. The timer is re-registered when
+*            the interval changes.
+*
+*********************************************************************/
+BVIEW_STATUS bst_pacing_cycle_end (unsigned int unit, uint64_t collectNs,
+                                   uint64_t reportNs)
+{
+  BVIEW_BST_PACING_CXT_t *cxt;
+  BVIEW_BST_DATA_t *bst_data_ptr;
+  uint64_t cycleNs, effectiveNs;
+  int intervalMs, previousMs;
+
+  if (unit >= BVIEW_BST_MAX_UNITS)
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+  cxt = BST_PACING_CXT_GET (unit);
+  cycleNs = collectNs + reportNs;
+
+  pthread_mutex_lock (&cxt->lock);
+  cxt->pending = false;
+  cxt->stats.numCycles++;
+  cxt->stats.lastCollectUs = collectNs / BVIEW_BST_PACING_NSEC_PER_USEC;
+  cxt->stats.lastReportUs = reportNs / BVIEW_BST_PACING_NSEC_PER_USEC;
+  if ((cycleNs / BVIEW_BST_PACING_NSEC_PER_USEC) > cxt->stats.maxCycleUs)
+  {
+    cxt->stats.maxCycleUs = cycleNs / BVIEW_BST_PACING_NSEC_PER_USEC;
+  }
+
+  previousMs = cxt->stats.effectiveIntervalMs;
+  intervalMs = previousMs;
+  effectiveNs = (uint64_t) intervalMs * BVIEW_BST_PACING_NSEC_PER_MSEC;
+
+  if ((0 != intervalMs) && (cycleNs > effectiveNs))
+  {
+    cxt->stats.numOverruns++;
+    cxt->quietCycles = 0;
+    if (true == cxt->adaptive)
+    {
+      /* stretch the interval till the cycle fits */
+      while ((intervalMs < BVIEW_BST_MAX_INTERVAL_MS) &&
+             (cycleNs > ((uint64_t) intervalMs * BVIEW_BST_PACING_NSEC_PER_MSEC)))
+      {
+        intervalMs *= 2;
+      }
+      if (intervalMs > BVIEW_BST_MAX_INTERVAL_MS)
+      {
+        intervalMs = BVIEW_BST_MAX_INTERVAL_MS;
+      }
+    }
+  }
+  else if ((intervalMs > cxt->intervalMs) && ((cycleNs * 4) <= effectiveNs))
+  {
+    /* the pipeline has caught up, move back towards the configured interval */
+    cxt->quietCycles++;
+    if (BVIEW_BST_PACING_RECOVERY_CYCLES <= cxt->quietCycles)
+    {
+      intervalMs /= 2;
+      if (intervalMs < cxt->intervalMs)
+      {
+        intervalMs = cxt->intervalMs;
+      }
+      cxt->quietCycles = 0;
+    }
+  }
+  else
+  {
+    cxt->quietCycles = 0;
+  }
+  cxt->stats.effectiveIntervalMs = intervalMs;
+  pthread_mutex_unlock (&cxt->lock);
+
+  if (intervalMs != previousMs)
+  {
+    LOG_POST (BVIEW_LOG_INFO,
+        "bst application: collection interval of unit %d is %d ms, cycle took %llu us\r\n",
+        unit, intervalMs, (unsigned long long) (cycleNs / BVIEW_BST_PACING_NSEC_PER_USEC));
+    bst_data_ptr = BST_UNIT_DATA_PTR_GET (unit);
+    if ((NULL != bst_data_ptr) && (true == bst_data_ptr->bst_timer.in_use))
+    {
+      bst_periodic_collection_timer_add (unit);
+    }
+  }
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief : accounts a periodic report dropped as the sender is behind
+*
+* @param[in] unit : unit id
+*
+* @retval  : none
+*
+* @note    : the cycle is still accounted with bst_pacing_cycle_end.
+*
+*********************************************************************/
+void bst_pacing_report_drop (unsigned int unit)
+{
+  BVIEW_BST_PACING_CXT_t *cxt;
+
+  if (unit >= BVIEW_BST_MAX_UNITS)
+  {
+    return;
+  }
+  cxt = BST_PACING_CXT_GET (unit);
+
+  pthread_mutex_lock (&cxt->lock);
+  cxt->stats.numReportsDropped++;
+  pthread_mutex_unlock (&cxt->lock);
+}
+
+/*********************************************************************
+* @brief : reads the periodic collection counters of a unit
+*
+* @param[in] unit : unit id
+* @param[out] stats : collection counters
+*
+* @retval  : BVIEW_STATUS_SUCCESS : counters are copied.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+*********************************************************************/
+BVIEW_STATUS bst_pacing_stats_get (unsigned int unit,
+                                   BVIEW_BST_COLLECTION_STATS_t *stats)
+{
+  BVIEW_BST_PACING_CXT_t *cxt;
+
+  if ((unit >= BVIEW_BST_MAX_UNITS) || (NULL == stats))
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+  cxt = BST_PACING_CXT_GET (unit);
+
+  pthread_mutex_lock (&cxt->lock);
+  *stats = cxt->stats;
+  pthread_mutex_unlock (&cxt->lock);
+  return BVIEW_STATUS_SUCCESS;
+}
@@ -0,0 +1,1138 @@
+/*****************************************************************************
+  *
+  * (C) Copyright Broadcom Corporation 2015
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License");
+  * you may not use this file except in compliance with the License.
+  *
+  * You may obtain a copy of the License at
+  * http://www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ***************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include <pthread.h>
+#include "json.h"
+#include "clear_bst_statistics.h"
+#include "clear_bst_thresholds.h"
+#include "configure_bst_thresholds.h"
+#include "configure_bst_feature.h"
+#include "configure_bst_tracking.h"
+#include "get_bst_tracking.h"
+#include "get_bst_feature.h"
+#include "get_bst_thresholds.h"
+#include "get_bst_report.h"
+#include "bst_json_encoder.h"
+#include "bst.h"
+#include "broadview.h"
+#include "bst_app.h"
+#include "openapps_log_api.h"
+
+/* BST Context Info*/
+extern BVIEW_BST_CXT_t bst_info;
+
+#define BST_ROLLUP_CXT_GET(_unit)  &bst_info.unit[_unit].rollup
+
+#define BST_ROLLUP_BYTES_PER_MB    (1024 * 1024)
+#define BST_ROLLUP_NSEC_PER_SEC    1000000000ULL
+
+/* payload of the bucket is its values as is */
+#define BST_ROLLUP_BUCKET_RAW      0x1
+
+/* interval of a bucket of a tier, in nano seconds */
+#define BST_ROLLUP_INTERVAL_NS(_tier)  ((uint64_t) (_tier)->intervalSec * BST_ROLLUP_NSEC_PER_SEC)
+
+/* header of a closed bucket in the ring of a tier, followed by its
+   payload. The payload is the max, min, mean and last values of the
+   counters, as four samples of a codec stream started from cleared
+   counters, or as is when that is shorter. A bucket decodes on its
+   own, the oldest one is dropped first */
+typedef struct _bst_rollup_bucket_hdr_
+{
+  /* wall clock start of the bucket, a multiple of the interval */
+  uint64_t startNs;
+  uint64_t numSamples;
+  uint32_t length;
+  uint32_t flags;
+  /* highest occupancy of an entry of every realm, in cells */
+  uint32_t realmMax[BVIEW_BST_NUM_REALMS];
+} BST_ROLLUP_BUCKET_HDR_t;
+
+/*********************************************************************
+* @brief : copies bytes into the ring of a tier
+*
+* @param[in] tier : tier
+* @param[in] offset : position in the ring
+* @param[in] src : bytes to copy
+* @param[in] len : number of bytes
+*
+* @retval  : position in the ring past the bytes
+*
+*********************************************************************/
+static size_t bst_rollup_ring_write (BVIEW_BST_ROLLUP_TIER_t *tier, size_t offset,
+                                     const void *src, size_t len)
+{
+  size_t first = tier->size - offset;
+
+  if (len <= first)
+  {
+    memcpy (&tier->ring[offset], src, len);
+  }
+  else
+  {
+    memcpy (&tier->ring[offset], src, first);
+    memcpy (tier->ring, (const uint8_t *) src + first, len - first);
+  }
+  return (offset + len) % tier->size;
+}
+
+/*********************************************************************
+* @brief : copies bytes out of the ring of a tier
+*
+* @param[in] tier : tier
+* @param[in] offset : position in the ring
+* @param[out] dst : buffer of the bytes
+* @param[in] len : number of bytes
+*
+* @retval  : position in the ring past the bytes
+*
+*********************************************************************/
+static size_t bst_rollup_ring_read (const BVIEW_BST_ROLLUP_TIER_t *tier, size_t offset,
+                                    void *dst, size_t len)
+{
+  size_t first = tier->size - offset;
+
+  if (len <= first)
+  {
+    memcpy (dst, &tier->ring[offset], len);
+  }
+  else
+  {
+    memcpy (dst, &tier->ring[offset], first);
+    memcpy ((uint8_t *) dst + first, tier->ring, len - first);
+  }
+  return (offset + len) % tier->size;
+}
+
+/*********************************************************************
+* @brief : frees the memory of the rollups of a unit
+*
+* @param[in] cxt : rollups of the unit
+*
+* @retval  : none
+*
+*********************************************************************/
+static void bst_rollup_free (BVIEW_BST_ROLLUP_CXT_t *cxt)
+{
+  BVIEW_BST_ROLLUP_TIER_t *tier;
+  unsigned int index;
+
+  for (index = 0; index < BVIEW_BST_ROLLUP_MAX_TIERS; index++)
+  {
+    tier = &cxt->tiers[index];
+    free (tier->ring);
+    free (tier->max);
+    free (tier->min);
+    free (tier->sum);
+    free (tier->last);
+    memset (tier, 0, sizeof (BVIEW_BST_ROLLUP_TIER_t));
+  }
+  free (cxt->since);
+  free (cxt->mean);
+  free (cxt->state);
+  free (cxt->scratch);
+  cxt->since = NULL;
+  cxt->mean = NULL;
+  cxt->state = NULL;
+  cxt->scratch = NULL;
+  cxt->scratchSize = 0;
+  cxt->numTiers = 0;
+  cxt->numCounters = 0;
+  cxt->synced = false;
+}
+
+/*********************************************************************
+* @brief : initializes the rollups of a unit
+*
+* @param[in] unit : unit id
+*
+* @retval  : BVIEW_STATUS_SUCCESS : rollups are initialized.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : there are no tiers until they are set with
+*            bst_rollup_config_set.
+*
+*********************************************************************/
+BVIEW_STATUS bst_rollup_init (unsigned int unit)
+{
+  BVIEW_BST_ROLLUP_CXT_t *cxt;
+
+  if (unit >= BVIEW_BST_MAX_UNITS)
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+  cxt = BST_ROLLUP_CXT_GET (unit);
+
+  memset (cxt, 0, sizeof (BVIEW_BST_ROLLUP_CXT_t));
+  cxt->unit = unit;
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief : frees the rollups of a unit
+*
+* @param[in] unit : unit id
+*
+* @retval  : none
+*
+*********************************************************************/
+void bst_rollup_uninit (unsigned int unit)
+{
+  if (unit >= BVIEW_BST_MAX_UNITS)
+  {
+    return;
+  }
+  bst_rollup_free (BST_ROLLUP_CXT_GET (unit));
+}
+
+/*********************************************************************
+* @brief : sizes the rollups of a unit, the buckets so far are dropped
+*
+* @param[in] unit : unit id
+* @param[in] sizeMb : size of the rollups in MB, 0 disables them
+* @param[in] numTiers : tiers of the rollups
+* @param[in] intervalSec : interval of a bucket of every tier, in
+*                          seconds, finest first
+* @param[in] retention : buckets kept of every tier
+*
+* @retval  : BVIEW_STATUS_SUCCESS : rollups are sized.
+* @retval  : BVIEW_STATUS_OUTOFMEMORY : no memory for the rollups.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : invoked in the bst context only, once the records of the
+*            unit are sized. The size is split evenly among the tiers.
+*            The interval of a tier is a multiple of the one of the
+*            tier below it, so that its buckets are made of whole
+*            buckets of that tier.
+*
+*********************************************************************/
+BVIEW_STATUS bst_rollup_config_set (unsigned int unit, int sizeMb, int numTiers,
+                                    const int *intervalSec, const int *retention)
+{
+  BVIEW_BST_ROLLUP_CXT_t *cxt;
+  BVIEW_BST_ROLLUP_TIER_t *tier;
+  unsigned int numCounters;
+  int index;
+  bool failed = false;
+
+  if ((unit >= BVIEW_BST_MAX_UNITS) || (0 > sizeMb) ||
+      (0 > numTiers) || (BVIEW_BST_ROLLUP_MAX_TIERS < numTiers) ||
+      ((0 != numTiers) && ((NULL == intervalSec) || (NULL == retention))))
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+  for (index = 0; index < numTiers; index++)
+  {
+    if ((0 >= intervalSec[index]) || (0 >= retention[index]) ||
+        ((0 != index) && ((intervalSec[index] <= intervalSec[index - 1]) ||
+                          (0 != (intervalSec[index] % intervalSec[index - 1])))))
+    {
+      return BVIEW_STATUS_INVALID_PARAMETER;
+    }
+  }
+  cxt = BST_ROLLUP_CXT_GET (unit);
+  numCounters = bst_info.unit[unit].snapshot.layout.numCounters;
+
+  bst_rollup_free (cxt);
+  if ((0 == sizeMb) || (0 == numTiers) || (0 == numCounters))
+  {
+    return BVIEW_STATUS_SUCCESS;
+  }
+
+  cxt->numCounters = numCounters;
+  cxt->scratchSize = BVIEW_BST_ROLLUP_NUM_VALUES * numCounters * sizeof (uint32_t);
+  cxt->since = (uint32_t *) calloc (numCounters, sizeof (uint32_t));
+  cxt->mean = (uint32_t *) calloc (numCounters, sizeof (uint32_t));
+  cxt->state = (uint32_t *) calloc (numCounters, sizeof (uint32_t));
+  cxt->scratch = (uint8_t *) malloc (cxt->scratchSize);
+  failed = (NULL == cxt->since) || (NULL == cxt->mean) ||
+           (NULL == cxt->state) || (NULL == cxt->scratch);
+
+  for (index = 0; (index < numTiers) && (false == failed); index++)
+  {
+    tier = &cxt->tiers[index];
+    tier->intervalSec = (unsigned int) intervalSec[index];
+    tier->retention = (unsigned int) retention[index];
+    tier->size = ((size_t) sizeMb * BST_ROLLUP_BYTES_PER_MB) / (size_t) numTiers;
+    tier->ring = (uint8_t *) malloc (tier->size);
+    tier->max = (uint32_t *) calloc (numCounters, sizeof (uint32_t));
+    tier->min = (uint32_t *) calloc (numCounters, sizeof (uint32_t));
+    tier->sum = (uint64_t *) calloc (numCounters, sizeof (uint64_t));
+    tier->last = (uint32_t *) calloc (numCounters, sizeof (uint32_t));
+    failed = (NULL == tier->ring) || (NULL == tier->max) || (NULL == tier->min) ||
+             (NULL == tier->sum) || (NULL == tier->last);
+  }
+  if (true == failed)
+  {
+    bst_rollup_free (cxt);
+    LOG_POST (BVIEW_LOG_ERROR,
+              "Failed to allocate %d MB of rollups for unit %d\r\n",
+              sizeMb, unit);
+    return BVIEW_STATUS_OUTOFMEMORY;
+  }
+  cxt->numTiers = (unsigned int) numTiers;
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief : drops the oldest closed bucket of a tier
+*
+* @param[in] tier : tier
+*
+* @retval  : none
+*
+*********************************************************************/
+static void bst_rollup_evict (BVIEW_BST_ROLLUP_TIER_t *tier)
+{
+  BST_ROLLUP_BUCKET_HDR_t hdr;
+
+  bst_rollup_ring_read (tier, tier->head, &hdr, sizeof (hdr));
+  tier->head = (tier->head + sizeof (hdr) + hdr.length) % tier->size;
+  tier->used -= sizeof (hdr) + hdr.length;
+  tier->numBuckets--;
+}
+
+/*********************************************************************
+* @brief : adds the open bucket of a tier to its ring
+*
+* @param[in] cxt : rollups of the unit
+* @param[in] tier : tier, with the mean of the open bucket computed
+*
+* @retval  : none
+*
+* @note    : the oldest buckets are dropped to keep the retention of
+*            the tier and to make room for the bucket.
+*
+*********************************************************************/
+static void bst_rollup_bucket_store (BVIEW_BST_ROLLUP_CXT_t *cxt,
+                                     BVIEW_BST_ROLLUP_TIER_t *tier)
+{
+  BST_ROLLUP_BUCKET_HDR_t hdr;
+  const uint32_t *values[BVIEW_BST_ROLLUP_NUM_VALUES];
+  unsigned int index;
+  size_t length, offset;
+
+  values[0] = tier->max;
+  values[1] = tier->min;
+  values[2] = cxt->mean;
+  values[3] = tier->last;
+
+  memset (&hdr, 0, sizeof (hdr));
+  hdr.startNs = tier->openNs;
+  hdr.numSamples = tier->numSamples;
+  bst_history_realm_max_get (&bst_info.unit[cxt->unit].snapshot.layout,
+                             tier->max, hdr.realmMax);
+
+  /* the values follow each other in a stream of their own, the
+     ones of a counter are mostly alike */
+  bst_codec_init (&cxt->codec, cxt->state, cxt->numCounters);
+  for (index = 0; index < BVIEW_BST_ROLLUP_NUM_VALUES; index++)
+  {
+    length = bst_codec_encode (&cxt->codec, 0, values[index],
+                               cxt->scratch + hdr.length, cxt->scratchSize - hdr.length);
+    if (0 == length)
+    {
+      break;
+    }
+    hdr.length += length;
+  }
+  if (BVIEW_BST_ROLLUP_NUM_VALUES != index)
+  {
+    hdr.flags = BST_ROLLUP_BUCKET_RAW;
+    hdr.length = 0;
+    for (index = 0; index < BVIEW_BST_ROLLUP_NUM_VALUES; index++)
+    {
+      memcpy (cxt->scratch + hdr.length, values[index],
+              cxt->numCounters * sizeof (uint32_t));
+      hdr.length += cxt->numCounters * sizeof (uint32_t);
+    }
+  }
+
+  if ((sizeof (hdr) + hdr.length) > tier->size)
+  {
+    return;
+  }
+  while ((0 != tier->numBuckets) &&
+         ((tier->numBuckets >= tier->retention) ||
+          ((tier->size - tier->used) < (sizeof (hdr) + hdr.length))))
+  {
+    bst_rollup_evict (tier);
+  }
+
+  offset = (tier->head + tier->used) % tier->size;
+  offset = bst_rollup_ring_write (tier, offset, &hdr, sizeof (hdr));
+  bst_rollup_ring_write (tier, offset, cxt->scratch, hdr.length);
+  tier->used += sizeof (hdr) + hdr.length;
+  tier->numBuckets++;
+
+  _BST_LOG(_BST_DEBUG_TRACE, "bst rollup bucket of %u s at %" PRIu64 " of %" PRIu64
+           " samples in %u bytes%s\n", tier->intervalSec, hdr.startNs, hdr.numSamples,
+           hdr.length, (0 != (hdr.flags & BST_ROLLUP_BUCKET_RAW)) ? ", raw" : "");
+}
+
+static void bst_rollup_bucket_merge (BVIEW_BST_ROLLUP_CXT_t *cxt, unsigned int index,
+                                     const BVIEW_BST_ROLLUP_TIER_t *child);
+
+/*********************************************************************
+* @brief : closes the open bucket of a tier
+*
+* @param[in] cxt : rollups of the unit
+* @param[in] index : tier
+*
+* @retval  : none
+*
+* @note    : the bucket is kept in the ring of the tier and merged
+*            into the open bucket of the tier above it.
+*
+*********************************************************************/
+static void bst_rollup_bucket_close (BVIEW_BST_ROLLUP_CXT_t *cxt, unsigned int index)
+{
+  BVIEW_BST_ROLLUP_TIER_t *tier = &cxt->tiers[index];
+  uint64_t numSamples = tier->numSamples;
+  unsigned int counter;
+
+  for (counter = 0; counter < cxt->numCounters; counter++)
+  {
+    /* the last values of the first tier are held since they changed */
+    if (0 == index)
+    {
+      tier->sum[counter] += (uint64_t) tier->last[counter] *
+                            (numSamples - cxt->since[counter]);
+    }
+    cxt->mean[counter] = (uint32_t) ((tier->sum[counter] + (numSamples / 2)) / numSamples);
+  }
+  bst_rollup_bucket_store (cxt, tier);
+
+  if ((index + 1) < cxt->numTiers)
+  {
+    bst_rollup_bucket_merge (cxt, index + 1, tier);
+  }
+  tier->numSamples = 0;
+  tier->openNs = 0;
+}
+
+/*********************************************************************
+* @brief : merges a closed bucket into the open bucket of a tier
+*
+* @param[in] cxt : rollups of the unit
+* @param[in] index : tier
+* @param[in] child : tier below, with the bucket being closed
+*
+* @retval  : none
+*
+* @note    : the open bucket is closed first if the bucket starts
+*            past it. A bucket which starts before it, after the
+*            wall clock is set back, is merged into it.
+*
+*********************************************************************/
+static void bst_rollup_bucket_merge (BVIEW_BST_ROLLUP_CXT_t *cxt, unsigned int index,
+                                     const BVIEW_BST_ROLLUP_TIER_t *child)
+{
+  BVIEW_BST_ROLLUP_TIER_t *tier = &cxt->tiers[index];
+  uint64_t startNs;
+  unsigned int counter;
+
+  startNs = child->openNs - (child->openNs % BST_ROLLUP_INTERVAL_NS (tier));
+  if ((0 != tier->numSamples) && (startNs > tier->openNs))
+  {
+    bst_rollup_bucket_close (cxt, index);
+  }
+
+  if (0 == tier->numSamples)
+  {
+    memcpy (tier->max, child->max, cxt->numCounters * sizeof (uint32_t));
+    memcpy (tier->min, child->min, cxt->numCounters * sizeof (uint32_t));
+    memcpy (tier->sum, child->sum, cxt->numCounters * sizeof (uint64_t));
+    memcpy (tier->last, child->last, cxt->numCounters * sizeof (uint32_t));
+    tier->openNs = startNs;
+    tier->numSamples = child->numSamples;
+    return;
+  }
+
+  for (counter = 0; counter < cxt->numCounters; counter++)
+  {
+    if (tier->max[counter] < child->max[counter])
+    {
+      tier->max[counter] = child->max[counter];
+    }
+    if (tier->min[counter] > child->min[counter])
+    {
+      tier->min[counter] = child->min[counter];
+    }
+    tier->sum[counter] += child->sum[counter];
+    tier->last[counter] = child->last[counter];
+  }
+  tier->numSamples += child->numSamples;
+}
+
+/*********************************************************************
+* @brief : folds a counter of a sample into the open bucket of the
+*          first tier
+*
+* @param[in] cxt : rollups of the unit
+* @param[in] tier : first tier
+* @param[in] counter : counter
+* @param[in] sample : sample of the bucket, 0 based
+* @param[in] value : counter in the sample
+*
+* @retval  : none
+*
+* @note    : the sum is brought up to the sample only when the value
+*            changes, an unchanged counter is left as is.
+*
+*********************************************************************/
+static inline void bst_rollup_counter_fold (BVIEW_BST_ROLLUP_CXT_t *cxt,
+                                            BVIEW_BST_ROLLUP_TIER_t *tier,
+                                            unsigned int counter, uint32_t sample,
+                                            uint32_t value)
+{
+  if (tier->last[counter] == value)
+  {
+    return;
+  }
+  tier->sum[counter] += (uint64_t) tier->last[counter] * (sample - cxt->since[counter]);
+  tier->last[counter] = value;
+  cxt->since[counter] = sample;
+  if (tier->max[counter] < value)
+  {
+    tier->max[counter] = value;
+  }
+  if (tier->min[counter] > value)
+  {
+    tier->min[counter] = value;
+  }
+}
+
+/*********************************************************************
+* @brief : folds a sample into the rollups of a unit
+*
+* @param[in] cxt : rollups of the unit
+* @param[in] realtimeNs : wall clock time of the collection
+* @param[in] counters : counters of the sample
+* @param[in] data : change bitmaps of the sample against the sample
+*                   folded last, NULL to fold all the counters
+*
+* @retval  : none
+*
+* @note    : a sample past the open bucket of the first tier closes
+*            it, and the next bucket starts from all the counters of
+*            the sample. Otherwise only the entries which changed are
+*            visited.
+*
+*********************************************************************/
+static void bst_rollup_sample_add (BVIEW_BST_ROLLUP_CXT_t *cxt, uint64_t realtimeNs,
+                                   const uint32_t *counters,
+                                   const BVIEW_BST_SNAPSHOT_DATA_t *data)
+{
+  const BVIEW_BST_SNAPSHOT_LAYOUT_t *layout = &bst_info.unit[cxt->unit].snapshot.layout;
+  BVIEW_BST_ROLLUP_TIER_t *tier = &cxt->tiers[0];
+  BVIEW_BST_REALM_t realm;
+  unsigned int realmIndex, word, entry, counter, lastCounter;
+  uint64_t startNs, bits;
+  uint32_t sample;
+
+  startNs = realtimeNs - (realtimeNs % BST_ROLLUP_INTERVAL_NS (tier));
+  if ((0 != tier->numSamples) && (startNs > tier->openNs))
+  {
+    bst_rollup_bucket_close (cxt, 0);
+  }
+
+  if (0 == tier->numSamples)
+  {
+    memcpy (tier->max, counters, cxt->numCounters * sizeof (uint32_t));
+    memcpy (tier->min, counters, cxt->numCounters * sizeof (uint32_t));
+    memcpy (tier->last, counters, cxt->numCounters * sizeof (uint32_t));
+    memset (tier->sum, 0, cxt->numCounters * sizeof (uint64_t));
+    memset (cxt->since, 0, cxt->numCounters * sizeof (uint32_t));
+    tier->openNs = startNs;
+    tier->numSamples = 1;
+    return;
+  }
+
+  sample = (uint32_t) tier->numSamples;
+  if (NULL == data)
+  {
+    for (counter = 0; counter < cxt->numCounters; counter++)
+    {
+      bst_rollup_counter_fold (cxt, tier, counter, sample, counters[counter]);
+    }
+  }
+  else
+  {
+    BVIEW_BST_REALM_ITER (realm)
+    {
+      if (0 == (data->changedRealms & realm))
+      {
+        continue;
+      }
+      realmIndex = BVIEW_BST_REALM_INDEX (realm);
+      lastCounter = layout->realmCounter[realmIndex] + layout->realmNumCounters[realmIndex];
+      for (word = 0; word < layout->bitmapWords[realmIndex]; word++)
+      {
+        for (bits = data->changed[layout->bitmapOffset[realmIndex] + word];
+             bits != 0; bits &= (bits - 1))
+        {
+          entry = (word * 64) + __builtin_ctzll (bits);
+          for (counter = layout->realmCounter[realmIndex]; counter < lastCounter; counter++)
+          {
+            bst_rollup_counter_fold (cxt, tier, layout->offset[counter] + entry, sample,
+                                     counters[layout->offset[counter] + entry]);
+          }
+        }
+      }
+    }
+  }
+  tier->numSamples++;
+}
+
+/*********************************************************************
+* @brief : folds a stats record into the rollups of a unit
+*
+* @param[in] unit : unit id
+* @param[in] ss : record, published with its change bitmaps
+*
+* @retval  : BVIEW_STATUS_SUCCESS : record is folded, or the rollups
+*                                   are disabled.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : invoked in the bst context only. The entries which
+*            changed since the previous record are folded, all the
+*            counters if the previous record is not the one folded
+*            last. A record of a few realms is not folded, as it is
+*            not kept in the history.
+*
+*********************************************************************/
+BVIEW_STATUS bst_rollup_append (unsigned int unit,
+                                const BVIEW_BST_REPORT_SNAPSHOT_t *ss)
+{
+  BVIEW_BST_ROLLUP_CXT_t *cxt;
+
+  if ((unit >= BVIEW_BST_MAX_UNITS) || (NULL == ss))
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+  cxt = BST_ROLLUP_CXT_GET (unit);
+  if (0 == cxt->numTiers)
+  {
+    return BVIEW_STATUS_SUCCESS;
+  }
+  if (false == bst_snapshot_is_complete (unit, ss))
+  {
+    /* the next record is not diffed against the record folded last */
+    cxt->synced = false;
+    return BVIEW_STATUS_SUCCESS;
+  }
+
+  bst_rollup_sample_add (cxt, bst_history_realtime_get (ss), ss->snapshot_data.counters,
+                         ((true == cxt->synced) && (NULL != ss->previous)) ?
+                         &ss->snapshot_data : NULL);
+  cxt->synced = true;
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief : folds an entry read back from the journal into the rollups
+*
+* @param[in] unit : unit id
+* @param[in] realtimeNs : wall clock time of the collection
+* @param[in] counters : counters of the entry
+*
+* @retval  : BVIEW_STATUS_SUCCESS : entry is folded, or the rollups
+*                                   are disabled.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : invoked in the bst context only, before the collection
+*            starts. All the counters of the entry are folded.
+*
+*********************************************************************/
+BVIEW_STATUS bst_rollup_restore (unsigned int unit, uint64_t realtimeNs,
+                                 const uint32_t *counters)
+{
+  BVIEW_BST_ROLLUP_CXT_t *cxt;
+
+  if ((unit >= BVIEW_BST_MAX_UNITS) || (NULL == counters))
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+  cxt = BST_ROLLUP_CXT_GET (unit);
+  if (0 == cxt->numTiers)
+  {
+    return BVIEW_STATUS_SUCCESS;
+  }
+
+  bst_rollup_sample_add (cxt, realtimeNs, counters, NULL);
+  /* the first record collected is not diffed against the entry */
+  cxt->synced = false;
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief : notes that the next stats record is not diffed against the
+*          record folded last
+*
+* @param[in] unit : unit id
+*
+* @retval  : none
+*
+* @note    : invoked in the bst context only, when a cleared record is
+*            published in place of the collected ones.
+*
+*********************************************************************/
+void bst_rollup_resync (unsigned int unit)
+{
+  if (unit >= BVIEW_BST_MAX_UNITS)
+  {
+    return;
+  }
+  bst_info.unit[unit].rollup.synced = false;
+}
+
+/*********************************************************************
+* @brief : returns the coarsest rollup tier within a resolution
+*
+* @param[in] unit : unit id
+* @param[in] resolutionSec : resolution, in seconds
+* @param[out] tier : tier
+*
+* @retval  : BVIEW_STATUS_SUCCESS : tier is returned.
+* @retval  : BVIEW_STATUS_RESOURCE_NOT_AVAILABLE : no tier is within
+*                                                 the resolution.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+*********************************************************************/
+BVIEW_STATUS bst_rollup_tier_select (unsigned int unit, unsigned int resolutionSec,
+                                     unsigned int *tier)
+{
+  BVIEW_BST_ROLLUP_CXT_t *cxt;
+  unsigned int index;
+  BVIEW_STATUS rv = BVIEW_STATUS_RESOURCE_NOT_AVAILABLE;
+
+  if ((unit >= BVIEW_BST_MAX_UNITS) || (NULL == tier))
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+  cxt = BST_ROLLUP_CXT_GET (unit);
+
+  /* tiers are kept finest first */
+  for (index = 0; index < cxt->numTiers; index++)
+  {
+    if (cxt->tiers[index].intervalSec <= resolutionSec)
+    {
+      *tier = index;
+      rv = BVIEW_STATUS_SUCCESS;
+    }
+  }
+  return rv;
+}
+
+/*********************************************************************
+* @brief : returns the bucket numbers and the usage of a rollup tier
+*
+* @param[in] unit : unit id
+* @param[in] tier : tier
+* @param[out] info : numbers of the oldest and past the open bucket,
+*                    and usage
+*
+* @retval  : BVIEW_STATUS_SUCCESS : info is returned.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : a bucket is numbered by its start over its interval.
+*
+*********************************************************************/
+BVIEW_STATUS bst_rollup_info_get (unsigned int unit, unsigned int tier,
+                                  BVIEW_BST_HISTORY_INFO_t *info)
+{
+  BVIEW_BST_ROLLUP_CXT_t *cxt;
+  BVIEW_BST_ROLLUP_TIER_t *ptr;
+  BST_ROLLUP_BUCKET_HDR_t hdr;
+
+  if ((unit >= BVIEW_BST_MAX_UNITS) || (NULL == info))
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+  cxt = BST_ROLLUP_CXT_GET (unit);
+  if (tier >= cxt->numTiers)
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+  ptr = &cxt->tiers[tier];
+
+  memset (info, 0, sizeof (BVIEW_BST_HISTORY_INFO_t));
+  if (0 != ptr->numBuckets)
+  {
+    bst_rollup_ring_read (ptr, ptr->head, &hdr, sizeof (hdr));
+    info->firstSequenceNumber = hdr.startNs / BST_ROLLUP_INTERVAL_NS (ptr);
+  }
+  else
+  {
+    info->firstSequenceNumber = ptr->openNs / BST_ROLLUP_INTERVAL_NS (ptr);
+  }
+  info->nextSequenceNumber = (0 == ptr->numSamples) ? info->firstSequenceNumber :
+                             (ptr->openNs / BST_ROLLUP_INTERVAL_NS (ptr)) + 1;
+  info->bytesUsed = ptr->used;
+  info->size = ptr->size;
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief : frees the memory of a walk of a rollup tier
+*
+* @param[in] walk : walk
+*
+* @retval  : none
+*
+*********************************************************************/
+static void bst_rollup_query_free (BVIEW_BST_ROLLUP_QUERY_WALK_t *walk)
+{
+  free (walk->values);
+  free (walk->select);
+  free (walk->matches);
+  walk->values = NULL;
+  walk->select = NULL;
+  walk->matches = NULL;
+}
+
+/*********************************************************************
+* @brief : starts a walk of the buckets of a rollup tier for a query
+*
+* @param[in] unit : unit id
+* @param[in] tier : tier
+* @param[in] filter : filters of the query
+* @param[in] cellToByteConv : bytes per cell of the response, 1 to
+*                             respond in cells
+* @param[out] walk : walk, ended with bst_rollup_query_end
+*
+* @retval  : BVIEW_STATUS_SUCCESS : walk is started.
+* @retval  : BVIEW_STATUS_RESOURCE_NOT_AVAILABLE : rollups are disabled.
+* @retval  : BVIEW_STATUS_OUTOFMEMORY : no memory for the walk.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : invoked in the bst context only. The filters are those of
+*            a query of the history, the occupancy is matched against
+*            the max of a bucket. The sequence numbers are the numbers
+*            of the buckets.
+*
+*********************************************************************/
+BVIEW_STATUS bst_rollup_query_start (unsigned int unit, unsigned int tier,
+                                     const BVIEW_BST_HISTORY_FILTER_t *filter,
+                                     unsigned int cellToByteConv,
+                                     BVIEW_BST_ROLLUP_QUERY_WALK_t *walk)
+{
+  BVIEW_BST_ROLLUP_CXT_t *cxt;
+  const BVIEW_BST_SNAPSHOT_LAYOUT_t *layout;
+  unsigned int numSelected;
+  uint64_t minCells;
+
+  if ((unit >= BVIEW_BST_MAX_UNITS) || (NULL == filter) || (NULL == walk))
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+  cxt = BST_ROLLUP_CXT_GET (unit);
+  layout = &bst_info.unit[unit].snapshot.layout;
+  memset (walk, 0, sizeof (BVIEW_BST_ROLLUP_QUERY_WALK_t));
+  if (tier >= cxt->numTiers)
+  {
+    return BVIEW_STATUS_RESOURCE_NOT_AVAILABLE;
+  }
+
+  walk->unit = unit;
+  walk->tier = tier;
+  walk->filter = *filter;
+  walk->cellToByteConv = (0 == cellToByteConv) ? 1 : cellToByteConv;
+  /* an occupancy in bytes matches from the cell it falls in */
+  minCells = (filter->minOccupancy + walk->cellToByteConv - 1) / walk->cellToByteConv;
+  walk->minCells = (minCells > UINT32_MAX) ? UINT32_MAX : (uint32_t) minCells;
+  walk->offset = cxt->tiers[tier].head;
+  walk->stats.resolutionSec = cxt->tiers[tier].intervalSec;
+
+  walk->values = (uint32_t *) calloc (BVIEW_BST_ROLLUP_NUM_VALUES * cxt->numCounters,
+                                      sizeof (uint32_t));
+  walk->select = (uint64_t *) calloc (layout->numBitmapWords + 1, sizeof (uint64_t));
+  if ((NULL == walk->values) || (NULL == walk->select))
+  {
+    bst_rollup_query_free (walk);
+    return BVIEW_STATUS_OUTOFMEMORY;
+  }
+  numSelected = bst_history_query_select (layout, filter, walk->select);
+  walk->matches = (BVIEW_BST_QUERY_MATCH_t *) calloc (numSelected + 1,
+                                                      sizeof (BVIEW_BST_QUERY_MATCH_t));
+  if (NULL == walk->matches)
+  {
+    bst_rollup_query_free (walk);
+    return BVIEW_STATUS_OUTOFMEMORY;
+  }
+
+  _BST_LOG(_BST_DEBUG_TRACE, "bst rollup query of %u entries over %u buckets of %u s\n",
+           numSelected, cxt->tiers[tier].numBuckets, cxt->tiers[tier].intervalSec);
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief : decodes a closed bucket into the values of a walk
+*
+* @param[in,out] walk : walk of the query
+* @param[in] hdr : header of the bucket
+* @param[in] payload : payload of the bucket
+*
+* @retval  : none
+*
+*********************************************************************/
+static void bst_rollup_bucket_decode (BVIEW_BST_ROLLUP_QUERY_WALK_t *walk,
+                                      const BST_ROLLUP_BUCKET_HDR_t *hdr,
+                                      const uint8_t *payload)
+{
+  unsigned int numCounters = bst_info.unit[walk->unit].rollup.numCounters;
+  unsigned int index;
+  size_t pos = 0;
+  uint64_t realtimeNs;
+
+  if (0 != (hdr->flags & BST_ROLLUP_BUCKET_RAW))
+  {
+    memcpy (walk->values, payload, BVIEW_BST_ROLLUP_NUM_VALUES * numCounters * sizeof (uint32_t));
+    return;
+  }
+
+  /* every value is decoded on top of the one before it */
+  bst_codec_init (&walk->codec, walk->values, numCounters);
+  for (index = 0; index < BVIEW_BST_ROLLUP_NUM_VALUES; index++)
+  {
+    if (0 != index)
+    {
+      memcpy (&walk->values[index * numCounters], &walk->values[(index - 1) * numCounters],
+              numCounters * sizeof (uint32_t));
+      walk->codec.counters = &walk->values[index * numCounters];
+    }
+    pos += bst_codec_decode (&walk->codec, payload + pos, hdr->length - pos, &realtimeNs);
+  }
+}
+
+/*********************************************************************
+* @brief : matches the values of a bucket against a query
+*
+* @param[in,out] walk : walk of the query, with the bucket decoded
+*
+* @retval  : entries which match
+*
+* @note    : the max, min, mean and last values of every counter of
+*            a match follow each other.
+*
+*********************************************************************/
+static unsigned int bst_rollup_query_match (BVIEW_BST_ROLLUP_QUERY_WALK_t *walk)
+{
+  const BVIEW_BST_SNAPSHOT_LAYOUT_t *layout = &bst_info.unit[walk->unit].snapshot.layout;
+  unsigned int numCounters = bst_info.unit[walk->unit].rollup.numCounters;
+  BVIEW_BST_QUERY_MATCH_t *match;
+  BVIEW_BST_REALM_t realm;
+  unsigned int realmIndex, word, entry, counter, firstCounter, lastCounter, index;
+  unsigned int numMatches = 0;
+  uint32_t occupancy;
+  uint64_t bits, value;
+
+  BVIEW_BST_REALM_ITER (realm)
+  {
+    if (0 == (walk->filter.realms & realm))
+    {
+      continue;
+    }
+    realmIndex = BVIEW_BST_REALM_INDEX (realm);
+    firstCounter = layout->realmCounter[realmIndex];
+    lastCounter = firstCounter + layout->realmNumCounters[realmIndex];
+
+    for (word = 0; word < layout->bitmapWords[realmIndex]; word++)
+    {
+      for (bits = walk->select[layout->bitmapOffset[realmIndex] + word];
+           bits != 0; bits &= (bits - 1))
+      {
+        entry = (word * 64) + __builtin_ctzll (bits);
+
+        /* the max values come first */
+        occupancy = 0;
+        for (counter = firstCounter; counter < lastCounter; counter++)
+        {
+          if ((true == bst_history_counter_is_buffer ((BVIEW_BST_COUNTER_t) counter)) &&
+              (occupancy < walk->values[layout->offset[counter] + entry]))
+          {
+            occupancy = walk->values[layout->offset[counter] + entry];
+          }
+        }
+        if (occupancy < walk->minCells)
+        {
+          continue;
+        }
+
+        match = &walk->matches[numMatches++];
+        match->realm = realm;
+        bst_history_entry_locate (layout, realm, entry, &match->port, &match->index);
+        match->numValues = 0;
+        for (counter = firstCounter; counter < lastCounter; counter++)
+        {
+          for (index = 0; (index < BVIEW_BST_ROLLUP_NUM_VALUES) &&
+                          (match->numValues < BVIEW_BST_QUERY_MAX_VALUES); index++)
+          {
+            value = walk->values[(index * numCounters) + layout->offset[counter] + entry];
+            if (true == bst_history_counter_is_buffer ((BVIEW_BST_COUNTER_t) counter))
+            {
+              value *= walk->cellToByteConv;
+            }
+            match->values[match->numValues++] = value;
+          }
+        }
+      }
+    }
+  }
+  return numMatches;
+}
+
+/*********************************************************************
+* @brief : returns the next bucket of a rollup tier with a match
+*
+* @param[in] cookie : walk of the query
+* @param[out] sample : bucket, valid till the next call
+*
+* @retval  : true : bucket is returned.
+* @retval  : false : no more buckets.
+*
+* @note    : a closed bucket is skipped without decoding it if it is
+*            out of the time or bucket number range, or if no realm
+*            of the query reaches the occupancy in it. The open bucket
+*            is returned last, as it is so far.
+*
+*********************************************************************/
+bool bst_rollup_query_next (void *cookie, BVIEW_BST_QUERY_SAMPLE_t *sample)
+{
+  BVIEW_BST_ROLLUP_QUERY_WALK_t *walk = (BVIEW_BST_ROLLUP_QUERY_WALK_t *) cookie;
+  BVIEW_BST_ROLLUP_CXT_t *cxt;
+  BVIEW_BST_ROLLUP_TIER_t *tier;
+  BST_ROLLUP_BUCKET_HDR_t hdr;
+  BVIEW_BST_REALM_t realm;
+  unsigned int numMatches, counter, numCounters;
+  uint64_t intervalNs, remaining;
+  size_t offset;
+  bool match;
+
+  if ((NULL == walk) || (NULL == walk->values) || (NULL == sample))
+  {
+    return false;
+  }
+  cxt = BST_ROLLUP_CXT_GET (walk->unit);
+  tier = &cxt->tiers[walk->tier];
+  intervalNs = BST_ROLLUP_INTERVAL_NS (tier);
+  numCounters = cxt->numCounters;
+
+  while (walk->numBuckets < tier->numBuckets)
+  {
+    walk->numBuckets++;
+    offset = bst_rollup_ring_read (tier, walk->offset, &hdr, sizeof (hdr));
+    walk->offset = (offset + hdr.length) % tier->size;
+
+    match = ((hdr.startNs / intervalNs) >= walk->filter.startSeq) &&
+            ((hdr.startNs + intervalNs) > walk->filter.startNs) &&
+            (hdr.startNs <= walk->filter.endNs);
+    if (true == match)
+    {
+      match = false;
+      BVIEW_BST_REALM_ITER (realm)
+      {
+        if ((0 != (walk->filter.realms & realm)) &&
+            (hdr.realmMax[BVIEW_BST_REALM_INDEX (realm)] >= walk->minCells))
+        {
+          match = true;
+          break;
+        }
+      }
+    }
+    if (false == match)
+    {
+      walk->stats.blocksSkipped++;
+      continue;
+    }
+
+    bst_rollup_ring_read (tier, offset, cxt->scratch, hdr.length);
+    bst_rollup_bucket_decode (walk, &hdr, cxt->scratch);
+    walk->stats.blocksDecoded++;
+
+    numMatches = bst_rollup_query_match (walk);
+    if (0 == numMatches)
+    {
+      continue;
+    }
+    sample->sequenceNumber = hdr.startNs / intervalNs;
+    sample->time = (BVIEW_TIME_t) (hdr.startNs / BST_ROLLUP_NSEC_PER_SEC);
+    sample->realtimeNs = hdr.startNs;
+    sample->numSamples = hdr.numSamples;
+    sample->numMatches = numMatches;
+    sample->matches = walk->matches;
+    return true;
+  }
+
+  if ((true == walk->done) || (0 == tier->numSamples) ||
+      ((tier->openNs / intervalNs) < walk->filter.startSeq) ||
+      ((tier->openNs + intervalNs) <= walk->filter.startNs) ||
+      (tier->openNs > walk->filter.endNs))
+  {
+    walk->done = true;
+    return false;
+  }
+  walk->done = true;
+
+  /* the open bucket, the last values of the first tier are held
+     since they changed */
+  memcpy (&walk->values[0], tier->max, numCounters * sizeof (uint32_t));
+  memcpy (&walk->values[numCounters], tier->min, numCounters * sizeof (uint32_t));
+  memcpy (&walk->values[3 * numCounters], tier->last, numCounters * sizeof (uint32_t));
+  for (counter = 0; counter < numCounters; counter++)
+  {
+    remaining = (0 == walk->tier) ?
+                ((uint64_t) tier->last[counter] * (tier->numSamples - cxt->since[counter])) : 0;
+    walk->values[(2 * numCounters) + counter] =
+      (uint32_t) ((tier->sum[counter] + remaining + (tier->numSamples / 2)) / tier->numSamples);
+  }
+
+  numMatches = bst_rollup_query_match (walk);
+  if (0 == numMatches)
+  {
+    return false;
+  }
+  sample->sequenceNumber = tier->openNs / intervalNs;
+  sample->time = (BVIEW_TIME_t) (tier->openNs / BST_ROLLUP_NSEC_PER_SEC);
+  sample->realtimeNs = tier->openNs;
+  sample->numSamples = tier->numSamples;
+  sample->numMatches = numMatches;
+  sample->matches = walk->matches;
+  return true;
+}
+
+/*********************************************************************
+* @brief : ends a walk of the buckets of a rollup tier
+*
+* @param[in] walk : walk
+*
+* @retval  : none
+*
+*********************************************************************/
+void bst_rollup_query_end (BVIEW_BST_ROLLUP_QUERY_WALK_t *walk)
+{
+  if (NULL == walk)
+  {
+    return;
+  }
+  bst_rollup_query_free (walk);
+}
@@ -0,0 +1,196 @@
+/*****************************************************************************
+  *
+  * (C) Copyright Broadcom Corporation 2015
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License");
+  * you may not use this file except in compliance with the License.
+  *
+  * You may obtain a copy of the License at
+  * http://www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ***************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include "json.h"
+#include "clear_bst_statistics.h"
+#include "clear_bst_thresholds.h"
+#include "configure_bst_thresholds.h"
+#include "configure_bst_feature.h"
+#include "configure_bst_tracking.h"
+#include "get_bst_tracking.h"
+#include "get_bst_feature.h"
+#include "get_bst_thresholds.h"
+#include "get_bst_report.h"
+#include "bst_json_encoder.h"
+#include "bst.h"
+#include "broadview.h"
+#include "bst_app.h"
+#include "openapps_log_api.h"
+
+/* BST Context Info*/
+extern BVIEW_BST_CXT_t bst_info;
+
+#define BST_SENDER_CXT_GET()  &bst_info.sender
+
+/*********************************************************************
+* @brief : sender of the reports
+*
+* @param[in] arg : sender context
+*
+* @retval  : NULL
+*
+* @note    : encodes and sends the queued responses in order, and
+*            releases the records they reference. The queue is
+*            drained before it exits, so that the bst context does
+*            not wait for the network.
+*
+*********************************************************************/
+static void *bst_sender_main (void *arg)
+{
+  BVIEW_BST_SENDER_CXT_t *cxt = (BVIEW_BST_SENDER_CXT_t *) arg;
+  BVIEW_BST_RESPONSE_MSG_t reply;
+  BVIEW_STATUS rv;
+
+  pthread_mutex_lock (&cxt->lock);
+  while (true)
+  {
+    while ((0 == cxt->count) && (false == cxt->exitPending))
+    {
+      pthread_cond_wait (&cxt->cond, &cxt->lock);
+    }
+    if (0 == cxt->count)
+    {
+      break;
+    }
+    reply = cxt->queue[cxt->head];
+    cxt->head = (cxt->head + 1) % BVIEW_BST_SENDER_QUEUE_SIZE;
+    cxt->count--;
+    pthread_mutex_unlock (&cxt->lock);
+
+    rv = bst_send_response (&reply);
+    if (BVIEW_STATUS_SUCCESS != rv)
+    {
+      LOG_POST (BVIEW_LOG_ERROR,
+          "failed to send response for command %d , err = %d. \r\n", reply.msg_type, rv);
+    }
+    /* response is sent, release the records */
+    bst_snapshot_put (reply.unit, reply.response.report.active);
+    bst_snapshot_put (reply.unit, reply.response.report.backup);
+
+    pthread_mutex_lock (&cxt->lock);
+  }
+  pthread_mutex_unlock (&cxt->lock);
+  return NULL;
+}
+
+/*********************************************************************
+* @brief : starts the sender of the reports
+*
+* @retval  : BVIEW_STATUS_SUCCESS : sender is started.
+* @retval  : BVIEW_STATUS_FAILURE : sender thread could not be created.
+*
+*********************************************************************/
+BVIEW_STATUS bst_sender_init (void)
+{
+  BVIEW_BST_SENDER_CXT_t *cxt = BST_SENDER_CXT_GET ();
+
+  memset (cxt, 0, sizeof (BVIEW_BST_SENDER_CXT_t));
+  pthread_mutex_init (&cxt->lock, NULL);
+  pthread_cond_init (&cxt->cond, NULL);
+
+  if (0 != pthread_create (&cxt->sender, NULL, bst_sender_main, cxt))
+  {
+    LOG_POST (BVIEW_LOG_ERROR, "Failed to start the bst report sender\r\n");
+    pthread_cond_destroy (&cxt->cond);
+    pthread_mutex_destroy (&cxt->lock);
+    return BVIEW_STATUS_FAILURE;
+  }
+  cxt->senderRunning = true;
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief : sends the queued reports and stops the sender
+*
+* @retval  : none
+*
+* @note    : invoked once no more reports are posted. The records of
+*            the queued reports are released before it returns.
+*
+*********************************************************************/
+void bst_sender_uninit (void)
+{
+  BVIEW_BST_SENDER_CXT_t *cxt = BST_SENDER_CXT_GET ();
+
+  if (false == cxt->senderRunning)
+  {
+    return;
+  }
+  pthread_mutex_lock (&cxt->lock);
+  cxt->exitPending = true;
+  pthread_cond_signal (&cxt->cond);
+  pthread_mutex_unlock (&cxt->lock);
+
+  pthread_join (cxt->sender, NULL);
+  cxt->senderRunning = false;
+  pthread_cond_destroy (&cxt->cond);
+  pthread_mutex_destroy (&cxt->lock);
+}
+
+/*********************************************************************
+* @brief : queues a report response to be encoded and sent
+*
+* @param[in] reply_data : response, copied into the queue
+*
+* @retval  : BVIEW_STATUS_SUCCESS : response is queued, the references
+*                                   on its records move to the sender.
+* @retval  : BVIEW_STATUS_TABLE_FULL : queue is full, nothing is taken.
+* @retval  : BVIEW_STATUS_FAILURE : sender is stopped, nothing is taken.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : invoked in the bst context only. Only the reports are
+*            queued, their records are not modified once published.
+*            The other responses read the state of the unit and are
+*            sent in the bst context.
+*
+*********************************************************************/
+BVIEW_STATUS bst_sender_post (const BVIEW_BST_RESPONSE_MSG_t *reply_data)
+{
+  BVIEW_BST_SENDER_CXT_t *cxt = BST_SENDER_CXT_GET ();
+  BVIEW_STATUS rv = BVIEW_STATUS_SUCCESS;
+
+  if (NULL == reply_data)
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+  if (false == cxt->senderRunning)
+  {
+    return BVIEW_STATUS_FAILURE;
+  }
+
+  pthread_mutex_lock (&cxt->lock);
+  if (true == cxt->exitPending)
+  {
+    rv = BVIEW_STATUS_FAILURE;
+  }
+  else if (BVIEW_BST_SENDER_QUEUE_SIZE <= cxt->count)
+  {
+    rv = BVIEW_STATUS_TABLE_FULL;
+  }
+  else
+  {
+    cxt->queue[(cxt->head + cxt->count) % BVIEW_BST_SENDER_QUEUE_SIZE] = *reply_data;
+    cxt->count++;
+    pthread_cond_signal (&cxt->cond);
+  }
+  pthread_mutex_unlock (&cxt->lock);
+  return rv;
+}
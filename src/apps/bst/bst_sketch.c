@@ -0,0 +1,1003 @@
+/*****************************************************************************
+  *
+  * (C) Copyright Broadcom Corporation 2015
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License");
+  * you may not use this file except in compliance with the License.
+  *
+  * You may obtain a copy of the License at
+  * http://www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ***************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <inttypes.h>
+#include <pthread.h>
+#include "json.h"
+#include "clear_bst_statistics.h"
+#include "clear_bst_thresholds.h"
+#include "configure_bst_thresholds.h"
+#include "configure_bst_feature.h"
+#include "configure_bst_tracking.h"
+#include "get_bst_tracking.h"
+#include "get_bst_feature.h"
+#include "get_bst_thresholds.h"
+#include "get_bst_report.h"
+#include "bst_json_encoder.h"
+#include "bst.h"
+#include "broadview.h"
+#include "bst_app.h"
+#include "openapps_log_api.h"
+
+/* BST Context Info*/
+extern BVIEW_BST_CXT_t bst_info;
+
+#define BST_SKETCH_CXT_GET(_unit)  &bst_info.unit[_unit].sketch
+
+#define BST_SKETCH_BYTES_PER_MB    (1024 * 1024)
+#define BST_SKETCH_NSEC_PER_SEC    1000000000ULL
+
+/* buckets of a power of two */
+#define BST_SKETCH_SUB_BUCKETS     (1 << BVIEW_BST_SKETCH_SUB_BITS)
+
+/* interval of a slice, in nano seconds */
+#define BST_SKETCH_SLICE_NS(_cxt)  ((uint64_t) (_cxt)->sliceSec * BST_SKETCH_NSEC_PER_SEC)
+
+/* longest encoding of a counter in a closed slice. The number of its
+   buckets in use, the number and the 16 bit count of every one of
+   them, and its max as a base 128 varint */
+#define BST_SKETCH_COUNTER_MAX_LENGTH  (1 + (BVIEW_BST_SKETCH_BUCKETS * 3) + 5)
+
+/* header of a closed slice in the ring, followed by its payload. The
+   payload is the encoding of every counter, in the order of the layout */
+typedef struct _bst_sketch_slice_hdr_
+{
+  /* wall clock start of the slice, a multiple of the interval */
+  uint64_t startNs;
+  uint64_t numSamples;
+  uint32_t length;
+  uint32_t reserved;
+} BST_SKETCH_SLICE_HDR_t;
+
+/*********************************************************************
+* @brief : returns the bucket of the histogram a value falls in
+*
+* @param[in] value : value
+*
+* @retval  : bucket
+*
+* @note    : the values past the last bucket fall in it.
+*
+*********************************************************************/
+static inline unsigned int bst_sketch_bucket (uint32_t value)
+{
+  unsigned int exp;
+
+  if (value < BST_SKETCH_SUB_BUCKETS)
+  {
+    return value;
+  }
+  if (value >= (1U << BVIEW_BST_SKETCH_MAX_BITS))
+  {
+    value = (1U << BVIEW_BST_SKETCH_MAX_BITS) - 1;
+  }
+  exp = 31 - __builtin_clz (value);
+  return ((exp - BVIEW_BST_SKETCH_SUB_BITS + 1) << BVIEW_BST_SKETCH_SUB_BITS) +
+         ((value >> (exp - BVIEW_BST_SKETCH_SUB_BITS)) & (BST_SKETCH_SUB_BUCKETS - 1));
+}
+
+/*********************************************************************
+* @brief : returns the value reported for a bucket of the histogram
+*
+* @param[in] bucket : bucket
+*
+* @retval  : middle of the values of the bucket
+*
+*********************************************************************/
+static inline uint32_t bst_sketch_bucket_value (unsigned int bucket)
+{
+  unsigned int shift;
+
+  if (bucket < BST_SKETCH_SUB_BUCKETS)
+  {
+    return bucket;
+  }
+  shift = (bucket >> BVIEW_BST_SKETCH_SUB_BITS) - 1;
+  return ((BST_SKETCH_SUB_BUCKETS + (bucket & (BST_SKETCH_SUB_BUCKETS - 1))) << shift) +
+         (((1U << shift) - 1) / 2);
+}
+
+/*********************************************************************
+* @brief : adds samples to a bucket of the open slice
+*
+* @param[in,out] count : samples of the bucket, saturated
+* @param[in] samples : samples to add
+*
+* @retval  : none
+*
+*********************************************************************/
+static inline void bst_sketch_count_add (uint16_t *count, uint32_t samples)
+{
+  uint32_t sum = (uint32_t) *count + samples;
+
+  *count = (sum > UINT16_MAX) ? UINT16_MAX : (uint16_t) sum;
+}
+
+/*********************************************************************
+* @brief : copies bytes into the ring of the statistics
+*
+* @param[in] cxt : statistics of the unit
+* @param[in] offset : position in the ring
+* @param[in] src : bytes to copy
+* @param[in] len : number of bytes
+*
+* @retval  : position in the ring past the bytes
+*
+*********************************************************************/
+static size_t bst_sketch_ring_write (BVIEW_BST_SKETCH_CXT_t *cxt, size_t offset,
+                                     const void *src, size_t len)
+{
+  size_t first = cxt->size - offset;
+
+  if (len <= first)
+  {
+    memcpy (&cxt->ring[offset], src, len);
+  }
+  else
+  {
+    memcpy (&cxt->ring[offset], src, first);
+    memcpy (cxt->ring, (const uint8_t *) src + first, len - first);
+  }
+  return (offset + len) % cxt->size;
+}
+
+/*********************************************************************
+* @brief : copies bytes out of the ring of the statistics
+*
+* @param[in] cxt : statistics of the unit
+* @param[in] offset : position in the ring
+* @param[out] dst : buffer of the bytes
+* @param[in] len : number of bytes
+*
+* @retval  : position in the ring past the bytes
+*
+*********************************************************************/
+static size_t bst_sketch_ring_read (const BVIEW_BST_SKETCH_CXT_t *cxt, size_t offset,
+                                    void *dst, size_t len)
+{
+  size_t first = cxt->size - offset;
+
+  if (len <= first)
+  {
+    memcpy (dst, &cxt->ring[offset], len);
+  }
+  else
+  {
+    memcpy (dst, &cxt->ring[offset], first);
+    memcpy ((uint8_t *) dst + first, cxt->ring, len - first);
+  }
+  return (offset + len) % cxt->size;
+}
+
+/*********************************************************************
+* @brief : frees the memory of the statistics of a unit
+*
+* @param[in] cxt : statistics of the unit
+*
+* @retval  : none
+*
+*********************************************************************/
+static void bst_sketch_free (BVIEW_BST_SKETCH_CXT_t *cxt)
+{
+  free (cxt->ring);
+  free (cxt->counts);
+  free (cxt->max);
+  free (cxt->held);
+  free (cxt->since);
+  free (cxt->scratch);
+  cxt->ring = NULL;
+  cxt->counts = NULL;
+  cxt->max = NULL;
+  cxt->held = NULL;
+  cxt->since = NULL;
+  cxt->scratch = NULL;
+  cxt->size = 0;
+  cxt->head = 0;
+  cxt->used = 0;
+  cxt->numSlices = 0;
+  cxt->scratchSize = 0;
+  cxt->numCounters = 0;
+  cxt->openNs = 0;
+  cxt->numSamples = 0;
+  cxt->lastNs = 0;
+  cxt->synced = false;
+}
+
+/*********************************************************************
+* @brief : initializes the streaming statistics of a unit
+*
+* @param[in] unit : unit id
+*
+* @retval  : BVIEW_STATUS_SUCCESS : statistics are initialized.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : there are no histograms until they are sized with
+*            bst_sketch_config_set.
+*
+*********************************************************************/
+BVIEW_STATUS bst_sketch_init (unsigned int unit)
+{
+  BVIEW_BST_SKETCH_CXT_t *cxt;
+
+  if (unit >= BVIEW_BST_MAX_UNITS)
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+  cxt = BST_SKETCH_CXT_GET (unit);
+
+  memset (cxt, 0, sizeof (BVIEW_BST_SKETCH_CXT_t));
+  cxt->unit = unit;
+  cxt->sliceSec = BVIEW_BST_DEFAULT_STATISTICS_SLICE_SEC;
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief : frees the streaming statistics of a unit
+*
+* @param[in] unit : unit id
+*
+* @retval  : none
+*
+*********************************************************************/
+void bst_sketch_uninit (unsigned int unit)
+{
+  if (unit >= BVIEW_BST_MAX_UNITS)
+  {
+    return;
+  }
+  bst_sketch_free (BST_SKETCH_CXT_GET (unit));
+}
+
+/*********************************************************************
+* @brief : sizes the streaming statistics of a unit, the slices so
+*          far are dropped
+*
+* @param[in] unit : unit id
+* @param[in] sizeMb : size of the closed slices in MB, 0 disables them
+* @param[in] sliceSec : interval of a slice, in seconds
+*
+* @retval  : BVIEW_STATUS_SUCCESS : statistics are sized.
+* @retval  : BVIEW_STATUS_OUTOFMEMORY : no memory for the statistics.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : invoked in the bst context only, once the records of the
+*            unit are sized. The ring of the closed slices takes the
+*            size, the open slice is kept in full besides it.
+*
+*********************************************************************/
+BVIEW_STATUS bst_sketch_config_set (unsigned int unit, int sizeMb, int sliceSec)
+{
+  BVIEW_BST_SKETCH_CXT_t *cxt;
+  unsigned int numCounters;
+
+  if ((unit >= BVIEW_BST_MAX_UNITS) || (0 > sizeMb) || (0 >= sliceSec))
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+  cxt = BST_SKETCH_CXT_GET (unit);
+  numCounters = bst_info.unit[unit].snapshot.layout.numCounters;
+
+  bst_sketch_free (cxt);
+  cxt->sliceSec = (unsigned int) sliceSec;
+  if ((0 == sizeMb) || (0 == numCounters))
+  {
+    return BVIEW_STATUS_SUCCESS;
+  }
+
+  cxt->size = (size_t) sizeMb * BST_SKETCH_BYTES_PER_MB;
+  /* a slice longer than the ring is not kept */
+  cxt->scratchSize = (size_t) numCounters * BST_SKETCH_COUNTER_MAX_LENGTH;
+  if (cxt->scratchSize > cxt->size)
+  {
+    cxt->scratchSize = cxt->size;
+  }
+  cxt->ring = (uint8_t *) malloc (cxt->size);
+  cxt->counts = (uint16_t *) calloc ((size_t) numCounters * BVIEW_BST_SKETCH_BUCKETS,
+                                     sizeof (uint16_t));
+  cxt->max = (uint32_t *) calloc (numCounters, sizeof (uint32_t));
+  cxt->held = (uint32_t *) calloc (numCounters, sizeof (uint32_t));
+  cxt->since = (uint32_t *) calloc (numCounters, sizeof (uint32_t));
+  cxt->scratch = (uint8_t *) malloc (cxt->scratchSize);
+  if ((NULL == cxt->ring) || (NULL == cxt->counts) || (NULL == cxt->max) ||
+      (NULL == cxt->held) || (NULL == cxt->since) || (NULL == cxt->scratch))
+  {
+    bst_sketch_free (cxt);
+    LOG_POST (BVIEW_LOG_ERROR,
+              "Failed to allocate %d MB of statistics for unit %d\r\n",
+              sizeMb, unit);
+    return BVIEW_STATUS_OUTOFMEMORY;
+  }
+  cxt->numCounters = numCounters;
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief : drops the oldest closed slice
+*
+* @param[in] cxt : statistics of the unit
+*
+* @retval  : none
+*
+*********************************************************************/
+static void bst_sketch_evict (BVIEW_BST_SKETCH_CXT_t *cxt)
+{
+  BST_SKETCH_SLICE_HDR_t hdr;
+
+  bst_sketch_ring_read (cxt, cxt->head, &hdr, sizeof (hdr));
+  cxt->head = (cxt->head + sizeof (hdr) + hdr.length) % cxt->size;
+  cxt->used -= sizeof (hdr) + hdr.length;
+  cxt->numSlices--;
+}
+
+/*********************************************************************
+* @brief : closes the open slice and adds it to the ring
+*
+* @param[in] cxt : statistics of the unit
+*
+* @retval  : none
+*
+* @note    : the counts of the open slice are cleared as they are
+*            encoded, for the next slice. The oldest slices are
+*            dropped to make room for it.
+*
+*********************************************************************/
+static void bst_sketch_slice_close (BVIEW_BST_SKETCH_CXT_t *cxt)
+{
+  BST_SKETCH_SLICE_HDR_t hdr;
+  uint16_t *counts;
+  uint8_t *pos = cxt->scratch;
+  uint8_t *numPos;
+  unsigned int counter, bucket, numUsed;
+  uint32_t value;
+  size_t offset;
+  bool fits = true;
+
+  for (counter = 0; counter < cxt->numCounters; counter++)
+  {
+    counts = &cxt->counts[(size_t) counter * BVIEW_BST_SKETCH_BUCKETS];
+    /* the value held till the end of the slice */
+    bst_sketch_count_add (&counts[bst_sketch_bucket (cxt->held[counter])],
+                          cxt->numSamples - cxt->since[counter]);
+
+    if ((true == fits) &&
+        ((size_t) (pos - cxt->scratch) + BST_SKETCH_COUNTER_MAX_LENGTH > cxt->scratchSize))
+    {
+      fits = false;
+    }
+    if (true == fits)
+    {
+      numPos = pos++;
+      numUsed = 0;
+      for (bucket = 0; bucket < BVIEW_BST_SKETCH_BUCKETS; bucket++)
+      {
+        if (0 == counts[bucket])
+        {
+          continue;
+        }
+        *pos++ = (uint8_t) bucket;
+        memcpy (pos, &counts[bucket], sizeof (uint16_t));
+        pos += sizeof (uint16_t);
+        numUsed++;
+      }
+      *numPos = (uint8_t) numUsed;
+      for (value = cxt->max[counter]; value >= 0x80; value >>= 7)
+      {
+        *pos++ = (uint8_t) (value | 0x80);
+      }
+      *pos++ = (uint8_t) value;
+    }
+    memset (counts, 0, BVIEW_BST_SKETCH_BUCKETS * sizeof (uint16_t));
+  }
+
+  if (false == fits)
+  {
+    cxt->numDropped++;
+    _BST_LOG(_BST_DEBUG_ERROR, "bst statistics slice of unit %u does not fit in %zu bytes\n",
+             cxt->unit, cxt->scratchSize);
+    return;
+  }
+
+  memset (&hdr, 0, sizeof (hdr));
+  hdr.startNs = cxt->openNs;
+  hdr.numSamples = cxt->numSamples;
+  hdr.length = (uint32_t) (pos - cxt->scratch);
+  while ((0 != cxt->numSlices) && (cxt->size - cxt->used < sizeof (hdr) + hdr.length))
+  {
+    bst_sketch_evict (cxt);
+  }
+  if (cxt->size - cxt->used < sizeof (hdr) + hdr.length)
+  {
+    cxt->numDropped++;
+    return;
+  }
+  offset = (cxt->head + cxt->used) % cxt->size;
+  offset = bst_sketch_ring_write (cxt, offset, &hdr, sizeof (hdr));
+  bst_sketch_ring_write (cxt, offset, cxt->scratch, hdr.length);
+  cxt->used += sizeof (hdr) + hdr.length;
+  cxt->numSlices++;
+}
+
+/*********************************************************************
+* @brief : folds the value of a counter at a sample into the open slice
+*
+* @param[in] cxt : statistics of the unit
+* @param[in] counter : counter
+* @param[in] sample : sample of the open slice
+* @param[in] value : value of the counter at the sample
+*
+* @retval  : none
+*
+* @note    : the samples the previous value was held for are added to
+*            its bucket only when the value changes.
+*
+*********************************************************************/
+static inline void bst_sketch_counter_fold (BVIEW_BST_SKETCH_CXT_t *cxt,
+                                            unsigned int counter, uint32_t sample,
+                                            uint32_t value)
+{
+  if (cxt->held[counter] == value)
+  {
+    return;
+  }
+  bst_sketch_count_add (&cxt->counts[((size_t) counter * BVIEW_BST_SKETCH_BUCKETS) +
+                                     bst_sketch_bucket (cxt->held[counter])],
+                        sample - cxt->since[counter]);
+  cxt->held[counter] = value;
+  cxt->since[counter] = sample;
+  if (cxt->max[counter] < value)
+  {
+    cxt->max[counter] = value;
+  }
+}
+
+/*********************************************************************
+* @brief : folds a sample into the statistics of a unit
+*
+* @param[in] cxt : statistics of the unit
+* @param[in] realtimeNs : wall clock time of the collection
+* @param[in] counters : counters of the sample
+* @param[in] data : change bitmaps of the sample against the sample
+*                   folded last, NULL to fold all the counters
+*
+* @retval  : none
+*
+* @note    : a sample past the open slice closes it, and the next
+*            slice starts from all the counters of the sample.
+*            Otherwise only the entries which changed are visited.
+*
+*********************************************************************/
+static void bst_sketch_sample_add (BVIEW_BST_SKETCH_CXT_t *cxt, uint64_t realtimeNs,
+                                   const uint32_t *counters,
+                                   const BVIEW_BST_SNAPSHOT_DATA_t *data)
+{
+  const BVIEW_BST_SNAPSHOT_LAYOUT_t *layout = &bst_info.unit[cxt->unit].snapshot.layout;
+  BVIEW_BST_REALM_t realm;
+  unsigned int realmIndex, word, entry, counter, lastCounter;
+  uint64_t startNs, bits;
+
+  startNs = realtimeNs - (realtimeNs % BST_SKETCH_SLICE_NS (cxt));
+  if ((0 != cxt->numSamples) && (startNs > cxt->openNs))
+  {
+    bst_sketch_slice_close (cxt);
+    cxt->numSamples = 0;
+  }
+  cxt->lastNs = realtimeNs;
+
+  if (0 == cxt->numSamples)
+  {
+    memcpy (cxt->held, counters, cxt->numCounters * sizeof (uint32_t));
+    memcpy (cxt->max, counters, cxt->numCounters * sizeof (uint32_t));
+    memset (cxt->since, 0, cxt->numCounters * sizeof (uint32_t));
+    cxt->openNs = startNs;
+    cxt->numSamples = 1;
+    return;
+  }
+
+  if (NULL == data)
+  {
+    for (counter = 0; counter < cxt->numCounters; counter++)
+    {
+      bst_sketch_counter_fold (cxt, counter, cxt->numSamples, counters[counter]);
+    }
+  }
+  else
+  {
+    BVIEW_BST_REALM_ITER (realm)
+    {
+      if (0 == (data->changedRealms & realm))
+      {
+        continue;
+      }
+      realmIndex = BVIEW_BST_REALM_INDEX (realm);
+      lastCounter = layout->realmCounter[realmIndex] + layout->realmNumCounters[realmIndex];
+      for (word = 0; word < layout->bitmapWords[realmIndex]; word++)
+      {
+        for (bits = data->changed[layout->bitmapOffset[realmIndex] + word];
+             bits != 0; bits &= (bits - 1))
+        {
+          entry = (word * 64) + __builtin_ctzll (bits);
+          for (counter = layout->realmCounter[realmIndex]; counter < lastCounter; counter++)
+          {
+            bst_sketch_counter_fold (cxt, layout->offset[counter] + entry, cxt->numSamples,
+                                     counters[layout->offset[counter] + entry]);
+          }
+        }
+      }
+    }
+  }
+  cxt->numSamples++;
+}
+
+/*********************************************************************
+* @brief : folds a stats record into the streaming statistics of a unit
+*
+* @param[in] unit : unit id
+* @param[in] ss : record, published with its change bitmaps
+*
+* @retval  : BVIEW_STATUS_SUCCESS : record is folded, or the statistics
+*                                   are disabled.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : invoked in the bst context only. The entries which
+*            changed since the previous record are folded, all the
+*            counters if the previous record is not the one folded
+*            last. A record of a few realms is not folded, as it is
+*            not kept in the history.
+*
+*********************************************************************/
+BVIEW_STATUS bst_sketch_append (unsigned int unit,
+                                const BVIEW_BST_REPORT_SNAPSHOT_t *ss)
+{
+  BVIEW_BST_SKETCH_CXT_t *cxt;
+
+  if ((unit >= BVIEW_BST_MAX_UNITS) || (NULL == ss))
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+  cxt = BST_SKETCH_CXT_GET (unit);
+  if (0 == cxt->numCounters)
+  {
+    return BVIEW_STATUS_SUCCESS;
+  }
+  if (false == bst_snapshot_is_complete (unit, ss))
+  {
+    /* the next record is not diffed against the record folded last */
+    cxt->synced = false;
+    return BVIEW_STATUS_SUCCESS;
+  }
+
+  bst_sketch_sample_add (cxt, bst_history_realtime_get (ss), ss->snapshot_data.counters,
+                         ((true == cxt->synced) && (NULL != ss->previous)) ?
+                         &ss->snapshot_data : NULL);
+  cxt->synced = true;
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief : folds an entry read back from the journal into the
+*          streaming statistics
+*
+* @param[in] unit : unit id
+* @param[in] realtimeNs : wall clock time of the collection
+* @param[in] counters : counters of the entry
+*
+* @retval  : BVIEW_STATUS_SUCCESS : entry is folded, or the statistics
+*                                   are disabled.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : invoked in the bst context only, before the collection
+*            starts. All the counters of the entry are folded.
+*
+*********************************************************************/
+BVIEW_STATUS bst_sketch_restore (unsigned int unit, uint64_t realtimeNs,
+                                 const uint32_t *counters)
+{
+  BVIEW_BST_SKETCH_CXT_t *cxt;
+
+  if ((unit >= BVIEW_BST_MAX_UNITS) || (NULL == counters))
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+  cxt = BST_SKETCH_CXT_GET (unit);
+  if (0 == cxt->numCounters)
+  {
+    return BVIEW_STATUS_SUCCESS;
+  }
+
+  bst_sketch_sample_add (cxt, realtimeNs, counters, NULL);
+  /* the first record collected is not diffed against the entry */
+  cxt->synced = false;
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief : notes that the next stats record is not diffed against the
+*          record folded last
+*
+* @param[in] unit : unit id
+*
+* @retval  : none
+*
+* @note    : invoked in the bst context only, when a cleared record is
+*            published in place of the collected ones.
+*
+*********************************************************************/
+void bst_sketch_resync (unsigned int unit)
+{
+  if (unit >= BVIEW_BST_MAX_UNITS)
+  {
+    return;
+  }
+  bst_info.unit[unit].sketch.synced = false;
+}
+
+/*********************************************************************
+* @brief : merges a closed slice into the histograms of a query
+*
+* @param[in] cxt : statistics of the unit
+* @param[in] payload : payload of the slice
+* @param[in] slot : histogram of every counter, UINT32_MAX for the
+*                   counters not queried
+* @param[in,out] hist : histograms of the query
+* @param[in,out] max : max of every histogram of the query
+*
+* @retval  : none
+*
+*********************************************************************/
+static void bst_sketch_slice_merge (const BVIEW_BST_SKETCH_CXT_t *cxt,
+                                    const uint8_t *payload, const uint32_t *slot,
+                                    uint32_t *hist, uint32_t *max)
+{
+  const uint8_t *pos = payload;
+  unsigned int counter, index, numUsed, shift;
+  uint16_t count;
+  uint32_t value;
+
+  for (counter = 0; counter < cxt->numCounters; counter++)
+  {
+    numUsed = *pos++;
+    if (UINT32_MAX == slot[counter])
+    {
+      pos += numUsed * 3;
+      while (0 != (*pos++ & 0x80))
+      {
+        ;
+      }
+      continue;
+    }
+    for (index = 0; index < numUsed; index++)
+    {
+      memcpy (&count, pos + 1, sizeof (uint16_t));
+      hist[((size_t) slot[counter] * BVIEW_BST_SKETCH_BUCKETS) + pos[0]] += count;
+      pos += 3;
+    }
+    value = 0;
+    for (shift = 0; ; shift += 7)
+    {
+      value |= (uint32_t) (*pos & 0x7f) << shift;
+      if (0 == (*pos++ & 0x80))
+      {
+        break;
+      }
+    }
+    if (max[slot[counter]] < value)
+    {
+      max[slot[counter]] = value;
+    }
+  }
+}
+
+/*********************************************************************
+* @brief : returns a percentile of a histogram
+*
+* @param[in] hist : histogram
+* @param[in] percentile : percentile, 0 to 100
+* @param[in] max : max of the histogram
+*
+* @retval  : value of the bucket the percentile falls in, not past
+*            the max
+*
+*********************************************************************/
+static uint32_t bst_sketch_percentile (const uint32_t *hist, double percentile,
+                                       uint32_t max)
+{
+  unsigned int bucket;
+  uint64_t total = 0, seen = 0, rank;
+  double exact;
+  uint32_t value;
+
+  for (bucket = 0; bucket < BVIEW_BST_SKETCH_BUCKETS; bucket++)
+  {
+    total += hist[bucket];
+  }
+  if ((0 == total) || (100 <= percentile))
+  {
+    return max;
+  }
+
+  /* nearest rank, the first sample is the lowest one */
+  exact = (percentile * (double) total) / 100;
+  rank = (uint64_t) exact;
+  if ((double) rank < exact)
+  {
+    rank++;
+  }
+  if (0 == rank)
+  {
+    rank = 1;
+  }
+  for (bucket = 0; bucket < BVIEW_BST_SKETCH_BUCKETS; bucket++)
+  {
+    seen += hist[bucket];
+    if (seen >= rank)
+    {
+      value = bst_sketch_bucket_value (bucket);
+      return (value > max) ? max : value;
+    }
+  }
+  return max;
+}
+
+/*********************************************************************
+* @brief : merges the histograms of the slices within a window and
+*          returns the percentiles of the entries which match a query
+*
+* @param[in] unit : unit id
+* @param[in] query : filters, window and percentiles of the query
+* @param[in] cellToByteConv : bytes per cell of the response, 1 to
+*                             respond in cells
+* @param[out] stats : statistics, freed with bst_sketch_query_end
+*
+* @retval  : BVIEW_STATUS_SUCCESS : statistics are returned.
+* @retval  : BVIEW_STATUS_RESOURCE_NOT_AVAILABLE : statistics are disabled.
+* @retval  : BVIEW_STATUS_OUTOFMEMORY : no memory for the query.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : invoked in the bst context only. A slice is within the
+*            window if it ends after its start, the open slice is
+*            merged as it is so far. The occupancy is matched against
+*            the max of an entry in the window. The percentiles of
+*            every counter of a match are followed by its max.
+*
+*********************************************************************/
+BVIEW_STATUS bst_sketch_query (unsigned int unit,
+                               const BVIEW_BST_SKETCH_QUERY_t *query,
+                               unsigned int cellToByteConv,
+                               BVIEW_BST_STATISTICS_t *stats)
+{
+  BVIEW_BST_SKETCH_CXT_t *cxt;
+  const BVIEW_BST_SNAPSHOT_LAYOUT_t *layout;
+  BST_SKETCH_SLICE_HDR_t hdr;
+  BVIEW_BST_QUERY_MATCH_t *match;
+  BVIEW_BST_REALM_t realm;
+  struct timespec now;
+  unsigned int realmIndex, word, entry, counter, firstCounter, lastCounter;
+  unsigned int index, bucket, percentile, numSelected, numSlots = 0;
+  uint64_t *select;
+  uint32_t *slot, *hist, *max;
+  uint32_t *counterHist;
+  uint32_t occupancy, minCells;
+  uint64_t bits, value, cells, startNs = 0, nowNs;
+  size_t offset;
+
+  if ((unit >= BVIEW_BST_MAX_UNITS) || (NULL == query) || (NULL == stats))
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+  cxt = BST_SKETCH_CXT_GET (unit);
+  layout = &bst_info.unit[unit].snapshot.layout;
+  memset (stats, 0, sizeof (BVIEW_BST_STATISTICS_t));
+  if (0 == cxt->numCounters)
+  {
+    return BVIEW_STATUS_RESOURCE_NOT_AVAILABLE;
+  }
+
+  cellToByteConv = (0 == cellToByteConv) ? 1 : cellToByteConv;
+  /* an occupancy in bytes matches from the cell it falls in */
+  cells = (query->filter.minOccupancy + cellToByteConv - 1) / cellToByteConv;
+  minCells = (cells > UINT32_MAX) ? UINT32_MAX : (uint32_t) cells;
+  stats->windowSec = query->windowSec;
+  stats->sliceSec = cxt->sliceSec;
+  stats->numPercentiles = query->numPercentiles;
+  stats->percentiles = query->percentiles;
+  if (0 != query->windowSec)
+  {
+    clock_gettime (CLOCK_REALTIME, &now);
+    nowNs = ((uint64_t) now.tv_sec * BST_SKETCH_NSEC_PER_SEC) + (uint64_t) now.tv_nsec;
+    startNs = ((uint64_t) query->windowSec * BST_SKETCH_NSEC_PER_SEC);
+    startNs = (nowNs > startNs) ? (nowNs - startNs) : 0;
+  }
+
+  select = (uint64_t *) calloc (layout->numBitmapWords + 1, sizeof (uint64_t));
+  slot = (uint32_t *) malloc (cxt->numCounters * sizeof (uint32_t));
+  if ((NULL == select) || (NULL == slot))
+  {
+    free (select);
+    free (slot);
+    return BVIEW_STATUS_OUTOFMEMORY;
+  }
+  numSelected = bst_history_query_select (layout, &query->filter, select);
+
+  /* a histogram for every counter of the entries selected */
+  memset (slot, 0xff, cxt->numCounters * sizeof (uint32_t));
+  BVIEW_BST_REALM_ITER (realm)
+  {
+    if (0 == (query->filter.realms & realm))
+    {
+      continue;
+    }
+    realmIndex = BVIEW_BST_REALM_INDEX (realm);
+    firstCounter = layout->realmCounter[realmIndex];
+    lastCounter = firstCounter + layout->realmNumCounters[realmIndex];
+    for (word = 0; word < layout->bitmapWords[realmIndex]; word++)
+    {
+      for (bits = select[layout->bitmapOffset[realmIndex] + word]; bits != 0; bits &= (bits - 1))
+      {
+        entry = (word * 64) + __builtin_ctzll (bits);
+        for (counter = firstCounter; counter < lastCounter; counter++)
+        {
+          slot[layout->offset[counter] + entry] = numSlots++;
+        }
+      }
+    }
+  }
+  hist = (uint32_t *) calloc (((size_t) numSlots * BVIEW_BST_SKETCH_BUCKETS) + 1, sizeof (uint32_t));
+  max = (uint32_t *) calloc (numSlots + 1, sizeof (uint32_t));
+  stats->matches = (BVIEW_BST_QUERY_MATCH_t *) calloc (numSelected + 1,
+                                                       sizeof (BVIEW_BST_QUERY_MATCH_t));
+  if ((NULL == hist) || (NULL == max) || (NULL == stats->matches))
+  {
+    free (select);
+    free (slot);
+    free (hist);
+    free (max);
+    bst_sketch_query_end (stats);
+    return BVIEW_STATUS_OUTOFMEMORY;
+  }
+
+  /* closed slices within the window, oldest first */
+  offset = cxt->head;
+  for (index = 0; index < cxt->numSlices; index++)
+  {
+    offset = bst_sketch_ring_read (cxt, offset, &hdr, sizeof (hdr));
+    if (hdr.startNs + BST_SKETCH_SLICE_NS (cxt) > startNs)
+    {
+      bst_sketch_ring_read (cxt, offset, cxt->scratch, hdr.length);
+      bst_sketch_slice_merge (cxt, cxt->scratch, slot, hist, max);
+      if (0 == stats->numSlices)
+      {
+        stats->startNs = hdr.startNs;
+      }
+      stats->numSlices++;
+      stats->numSamples += hdr.numSamples;
+    }
+    offset = (offset + hdr.length) % cxt->size;
+  }
+
+  /* the open slice, with the values held so far */
+  if ((0 != cxt->numSamples) && (cxt->openNs + BST_SKETCH_SLICE_NS (cxt) > startNs))
+  {
+    for (counter = 0; counter < cxt->numCounters; counter++)
+    {
+      if (UINT32_MAX == slot[counter])
+      {
+        continue;
+      }
+      counterHist = &hist[(size_t) slot[counter] * BVIEW_BST_SKETCH_BUCKETS];
+      for (bucket = 0; bucket < BVIEW_BST_SKETCH_BUCKETS; bucket++)
+      {
+        counterHist[bucket] += cxt->counts[((size_t) counter * BVIEW_BST_SKETCH_BUCKETS) + bucket];
+      }
+      counterHist[bst_sketch_bucket (cxt->held[counter])] += cxt->numSamples - cxt->since[counter];
+      if (max[slot[counter]] < cxt->max[counter])
+      {
+        max[slot[counter]] = cxt->max[counter];
+      }
+    }
+    if (0 == stats->numSlices)
+    {
+      stats->startNs = cxt->openNs;
+    }
+    stats->numSlices++;
+    stats->numSamples += cxt->numSamples;
+  }
+  stats->endNs = cxt->lastNs;
+
+  BVIEW_BST_REALM_ITER (realm)
+  {
+    if ((0 == stats->numSlices) || (0 == (query->filter.realms & realm)))
+    {
+      continue;
+    }
+    realmIndex = BVIEW_BST_REALM_INDEX (realm);
+    firstCounter = layout->realmCounter[realmIndex];
+    lastCounter = firstCounter + layout->realmNumCounters[realmIndex];
+    for (word = 0; word < layout->bitmapWords[realmIndex]; word++)
+    {
+      for (bits = select[layout->bitmapOffset[realmIndex] + word]; bits != 0; bits &= (bits - 1))
+      {
+        entry = (word * 64) + __builtin_ctzll (bits);
+
+        occupancy = 0;
+        for (counter = firstCounter; counter < lastCounter; counter++)
+        {
+          if ((true == bst_history_counter_is_buffer ((BVIEW_BST_COUNTER_t) counter)) &&
+              (occupancy < max[slot[layout->offset[counter] + entry]]))
+          {
+            occupancy = max[slot[layout->offset[counter] + entry]];
+          }
+        }
+        if (occupancy < minCells)
+        {
+          continue;
+        }
+
+        match = &stats->matches[stats->numMatches++];
+        match->realm = realm;
+        bst_history_entry_locate (layout, realm, entry, &match->port, &match->index);
+        match->numValues = 0;
+        for (counter = firstCounter; counter < lastCounter; counter++)
+        {
+          index = slot[layout->offset[counter] + entry];
+          for (percentile = 0; (percentile <= query->numPercentiles) &&
+                               (match->numValues < BVIEW_BST_QUERY_MAX_VALUES); percentile++)
+          {
+            value = (percentile == query->numPercentiles) ? max[index] :
+                    bst_sketch_percentile (&hist[(size_t) index * BVIEW_BST_SKETCH_BUCKETS],
+                                           query->percentiles[percentile], max[index]);
+            if (true == bst_history_counter_is_buffer ((BVIEW_BST_COUNTER_t) counter))
+            {
+              value *= cellToByteConv;
+            }
+            match->values[match->numValues++] = value;
+          }
+        }
+      }
+    }
+  }
+
+  _BST_LOG(_BST_DEBUG_TRACE, "bst statistics query of %u entries over %u slices, %u matches\n",
+           numSelected, stats->numSlices, stats->numMatches);
+  free (select);
+  free (slot);
+  free (hist);
+  free (max);
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief : frees the matches of a query of the streaming statistics
+*
+* @param[in] stats : statistics
+*
+* @retval  : none
+*
+*********************************************************************/
+void bst_sketch_query_end (BVIEW_BST_STATISTICS_t *stats)
+{
+  if (NULL == stats)
+  {
+    return;
+  }
+  free (stats->matches);
+  stats->matches = NULL;
+  stats->numMatches = 0;
+}
@@ -0,0 +1,945 @@
+/*****************************************************************************
+  *
+  * (C) Copyright Broadcom Corporation 2015
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License");
+  * you may not use this file except in compliance with the License.
+  *
+  * You may obtain a copy of the License at
+  * http://www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ***************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include <sched.h>
+#include <pthread.h>
+#include "json.h"
+#include "clear_bst_statistics.h"
+#include "clear_bst_thresholds.h"
+#include "configure_bst_thresholds.h"
+#include "configure_bst_feature.h"
+#include "configure_bst_tracking.h"
+#include "get_bst_tracking.h"
+#include "get_bst_feature.h"
+#include "get_bst_thresholds.h"
+#include "get_bst_report.h"
+#include "bst_json_encoder.h"
+#include "bst.h"
+#include "broadview.h"
+#include "bst_app.h"
+#include "openapps_log_api.h"
+
+/* BST Context Info*/
+extern BVIEW_BST_CXT_t bst_info;
+
+#define BST_SNAPSHOT_CXT_GET(_unit)  &bst_info.unit[_unit].snapshot
+
+/* counter array of a record */
+#define BST_SNAPSHOT_ARRAY(_ss, _cnt) \
+  (&(_ss)->snapshot_data.counters[(_ss)->snapshot_data.layout->offset[(_cnt)]])
+
+/* moves a counter of the full size record into a record. The full size
+   record is left cleared for the next collection */
+#define BST_SNAPSHOT_MOVE(_dst, _src)                                  \
+  do {                                                                 \
+    (_dst) = ((_src) > UINT32_MAX) ? UINT32_MAX : (uint32_t) (_src);   \
+    (_src) = 0;                                                        \
+  } while (0)
+
+/*********************************************************************
+* @brief : returns the published record slot of the given type
+*
+* @param[in] unit : unit id
+* @param[in] type : BVIEW_BST_STATS or BVIEW_BST_THRESHOLD
+*
+* @retval  : pointer to the published record pointer, NULL for
+*            other types
+*
+*********************************************************************/
+static BVIEW_BST_REPORT_SNAPSHOT_t **bst_snapshot_slot_get (unsigned int unit,
+                                                           BVIEW_BST_REPORT_TYPE_t type)
+{
+  switch (type)
+  {
+    case BVIEW_BST_STATS:
+      return &bst_info.unit[unit].stats_active_record_ptr;
+    case BVIEW_BST_THRESHOLD:
+      return &bst_info.unit[unit].threshold_record_ptr;
+    default:
+      return NULL;
+  }
+}
+
+/*********************************************************************
+* @brief : takes a reference on a record
+*
+* @param[in] ss : record, may be NULL
+*
+* @retval  : none
+*
+*********************************************************************/
+static void bst_snapshot_get (BVIEW_BST_REPORT_SNAPSHOT_t *ss)
+{
+  if (NULL != ss)
+  {
+    __atomic_add_fetch (&ss->refCount, 1, __ATOMIC_RELAXED);
+  }
+}
+
+/*********************************************************************
+* @brief : publishes a record in place of the one in the slot
+*
+* @param[in] unit : unit id
+* @param[in] slot : published record pointer
+* @param[in] ss : record to publish
+*
+* @retval  : record which was published before
+*
+* @note : the pointer is swapped atomically. The function returns once
+*         the readers which may have seen the old record hold their
+*         reference on it, so that the caller can drop the reference
+*         of the slot.
+*
+*********************************************************************/
+static BVIEW_BST_REPORT_SNAPSHOT_t *bst_snapshot_swap (unsigned int unit,
+                                                      BVIEW_BST_REPORT_SNAPSHOT_t **slot,
+                                                      BVIEW_BST_REPORT_SNAPSHOT_t *ss)
+{
+  BVIEW_BST_SNAPSHOT_CXT_t *cxt = BST_SNAPSHOT_CXT_GET (unit);
+  BVIEW_BST_REPORT_SNAPSHOT_t *old;
+
+  old = __atomic_exchange_n (slot, ss, __ATOMIC_SEQ_CST);
+  /* grace period, readers only take a reference within it */
+  while (0 != __atomic_load_n (&cxt->readers, __ATOMIC_SEQ_CST))
+  {
+    sched_yield ();
+  }
+  return old;
+}
+
+/*********************************************************************
+* @brief : initializes the snapshot records state of a unit
+*
+* @param[in] unit : unit id
+*
+* @retval  : BVIEW_STATUS_SUCCESS : state is initialized.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+*********************************************************************/
+BVIEW_STATUS bst_snapshot_init (unsigned int unit)
+{
+  BVIEW_BST_SNAPSHOT_CXT_t *cxt;
+
+  if (unit >= BVIEW_BST_MAX_UNITS)
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+  cxt = BST_SNAPSHOT_CXT_GET (unit);
+
+  memset (cxt, 0, sizeof (BVIEW_BST_SNAPSHOT_CXT_t));
+  pthread_mutex_init (&cxt->lock, NULL);
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief : releases the records of a unit
+*
+* @param[in] unit : unit id
+*
+* @retval  : none
+*
+* @note    : invoked once no response of the unit is in progress.
+*
+*********************************************************************/
+void bst_snapshot_uninit (unsigned int unit)
+{
+  BVIEW_BST_SNAPSHOT_CXT_t *cxt;
+  BVIEW_BST_UNIT_CXT_t *ptr;
+  unsigned int index;
+
+  if (unit >= BVIEW_BST_MAX_UNITS)
+  {
+    return;
+  }
+  cxt = BST_SNAPSHOT_CXT_GET (unit);
+  ptr = BST_UNIT_PTR_GET (unit);
+
+  bst_snapshot_put (unit, ptr->stats_active_record_ptr);
+  ptr->stats_active_record_ptr = NULL;
+  bst_snapshot_put (unit, ptr->stats_current_record_ptr);
+  ptr->stats_current_record_ptr = NULL;
+  bst_snapshot_put (unit, ptr->threshold_record_ptr);
+  ptr->threshold_record_ptr = NULL;
+
+  for (index = 0; index < cxt->poolCount; index++)
+  {
+    free (cxt->pool[index]);
+  }
+  cxt->poolCount = 0;
+
+  free (cxt->layout.ucQueuePort);
+  free (cxt->layout.mcQueuePort);
+  free (cxt->scratch);
+  memset (&cxt->layout, 0, sizeof (BVIEW_BST_SNAPSHOT_LAYOUT_t));
+  cxt->scratch = NULL;
+  pthread_mutex_destroy (&cxt->lock);
+}
+
+/*********************************************************************
+* @brief : allocates a cleared record
+*
+* @param[in] unit : unit id
+*
+* @retval  : record holding one reference, NULL if out of memory
+*
+* @note    : records released to the pool of the unit are reused.
+*            The counters and bitmaps are allocated with the record,
+*            sized by the layout of the unit.
+*
+*********************************************************************/
+BVIEW_BST_REPORT_SNAPSHOT_t *bst_snapshot_alloc (unsigned int unit)
+{
+  BVIEW_BST_SNAPSHOT_CXT_t *cxt;
+  BVIEW_BST_REPORT_SNAPSHOT_t *ss = NULL;
+  size_t size;
+
+  if (unit >= BVIEW_BST_MAX_UNITS)
+  {
+    return NULL;
+  }
+  cxt = BST_SNAPSHOT_CXT_GET (unit);
+  if (0 == cxt->layout.numCounters)
+  {
+    /* layout of the unit is not set */
+    return NULL;
+  }
+  size = (cxt->layout.numCounters * sizeof (uint32_t)) +
+         (2 * cxt->layout.numBitmapWords * sizeof (uint64_t));
+
+  pthread_mutex_lock (&cxt->lock);
+  if (0 != cxt->poolCount)
+  {
+    cxt->poolCount--;
+    ss = cxt->pool[cxt->poolCount];
+  }
+  pthread_mutex_unlock (&cxt->lock);
+
+  if (NULL == ss)
+  {
+    ss = (BVIEW_BST_REPORT_SNAPSHOT_t *) malloc (sizeof (BVIEW_BST_REPORT_SNAPSHOT_t) + size);
+    if (NULL == ss)
+    {
+      return NULL;
+    }
+  }
+  memset (ss, 0, sizeof (BVIEW_BST_REPORT_SNAPSHOT_t));
+  ss->snapshot_data.layout = &cxt->layout;
+  ss->snapshot_data.counters = (uint32_t *) (ss + 1);
+  ss->snapshot_data.nonzero = (uint64_t *) &ss->snapshot_data.counters[cxt->layout.numCounters];
+  ss->snapshot_data.changed = &ss->snapshot_data.nonzero[cxt->layout.numBitmapWords];
+  memset (ss->snapshot_data.counters, 0, size);
+  ss->refCount = 1;
+  return ss;
+}
+
+/*********************************************************************
+* @brief : drops a reference on a record
+*
+* @param[in] unit : unit id
+* @param[in] ss : record, may be NULL
+*
+* @retval  : none
+*
+* @note    : the record is released with its last reference, along with
+*            the reference it holds on the previous record.
+*
+*********************************************************************/
+void bst_snapshot_put (unsigned int unit, BVIEW_BST_REPORT_SNAPSHOT_t *ss)
+{
+  BVIEW_BST_SNAPSHOT_CXT_t *cxt;
+  BVIEW_BST_REPORT_SNAPSHOT_t *previous;
+
+  if (unit >= BVIEW_BST_MAX_UNITS)
+  {
+    return;
+  }
+  cxt = BST_SNAPSHOT_CXT_GET (unit);
+
+  while ((NULL != ss) &&
+         (0 == __atomic_sub_fetch (&ss->refCount, 1, __ATOMIC_ACQ_REL)))
+  {
+    previous = ss->previous;
+
+    pthread_mutex_lock (&cxt->lock);
+    if (BVIEW_BST_SNAPSHOT_POOL_SIZE > cxt->poolCount)
+    {
+      cxt->pool[cxt->poolCount] = ss;
+      cxt->poolCount++;
+      ss = NULL;
+    }
+    pthread_mutex_unlock (&cxt->lock);
+
+    if (NULL != ss)
+    {
+      free (ss);
+    }
+    ss = previous;
+  }
+}
+
+/*********************************************************************
+* @brief : carries the realms not read into a stats record over from
+*          the record published before it
+*
+* @param[in] unit : unit id
+* @param[in,out] ss : record being published, referencing the previous
+*
+* @retval  : none
+*
+* @note    : the carried realms keep the sampling window of the
+*            previous record, and do not change against it.
+*
+*********************************************************************/
+static void bst_snapshot_realm_carry (unsigned int unit, BVIEW_BST_REPORT_SNAPSHOT_t *ss)
+{
+  BVIEW_BST_SNAPSHOT_CXT_t *cxt = BST_SNAPSHOT_CXT_GET (unit);
+  const BVIEW_BST_SNAPSHOT_LAYOUT_t *layout = &cxt->layout;
+  unsigned int realmIndex, counter;
+  BVIEW_BST_REALM_t realm;
+
+  if (NULL == ss->previous)
+  {
+    return;
+  }
+  BVIEW_BST_REALM_ITER (realm)
+  {
+    if (0 != (ss->realmMask & realm))
+    {
+      continue;
+    }
+    realmIndex = BVIEW_BST_REALM_INDEX (realm);
+    for (counter = layout->realmCounter[realmIndex];
+         counter < (layout->realmCounter[realmIndex] + layout->realmNumCounters[realmIndex]);
+         counter++)
+    {
+      memcpy (&ss->snapshot_data.counters[layout->offset[counter]],
+              &ss->previous->snapshot_data.counters[layout->offset[counter]],
+              layout->count[counter] * sizeof (uint32_t));
+    }
+    ss->realmTime[realmIndex] = ss->previous->realmTime[realmIndex];
+  }
+}
+
+/*********************************************************************
+* @brief : publishes a collected record
+*
+* @param[in] unit : unit id
+* @param[in] type : BVIEW_BST_STATS or BVIEW_BST_THRESHOLD
+* @param[in] ss : record, the reference of the caller moves to the unit
+*
+* @retval  : BVIEW_STATUS_SUCCESS : record is published.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : invoked in the bst context only. A stats record references
+*            the stats record published before it, which is the
+*            baseline of the periodic reports. The change bitmaps of
+*            the record are computed against the same. The record is
+*            not modified once published, a stats record is added to
+*            the snapshot history and journal and folded into the
+*            rollups, the streaming statistics and the top entries.
+*            Realms not read into a stats record, as for a report of
+*            a few realms, are carried over from the previous record.
+*            Only a record of every tracked realm is added to the
+*            history and journal.
+*
+*********************************************************************/
+BVIEW_STATUS bst_snapshot_publish (unsigned int unit, BVIEW_BST_REPORT_TYPE_t type,
+                                   BVIEW_BST_REPORT_SNAPSHOT_t *ss)
+{
+  BVIEW_BST_REPORT_SNAPSHOT_t **slot;
+  BVIEW_BST_REPORT_SNAPSHOT_t *old, *previous;
+
+  if ((unit >= BVIEW_BST_MAX_UNITS) || (NULL == ss))
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+  slot = bst_snapshot_slot_get (unit, type);
+  if (NULL == slot)
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+
+  if (BVIEW_BST_STATS == type)
+  {
+    /* the slot is only written in this context */
+    ss->previous = *slot;
+    bst_snapshot_get (ss->previous);
+    bst_snapshot_realm_carry (unit, ss);
+  }
+
+  /* entries to be reported, against the previous record if any */
+  bst_diff_compute (&ss->snapshot_data,
+                    (NULL != ss->previous) ? &ss->previous->snapshot_data : NULL);
+
+  /* collected stats are kept in the history and journal of the unit */
+  if (BVIEW_BST_STATS == type)
+  {
+    if (true == bst_snapshot_is_complete (unit, ss))
+    {
+      bst_history_append (unit, ss);
+      bst_journal_append (unit, ss);
+    }
+    bst_rollup_append (unit, ss);
+    bst_sketch_append (unit, ss);
+    bst_top_append (unit, ss);
+  }
+
+  old = bst_snapshot_swap (unit, slot, ss);
+  if (NULL != old)
+  {
+    /* readers of the old record hold their own reference on its
+       previous one, the chain ends at the baseline of the new record */
+    previous = old->previous;
+    old->previous = NULL;
+    bst_snapshot_put (unit, previous);
+    bst_snapshot_put (unit, old);
+  }
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief : publishes a cleared record in place of the collected ones
+*
+* @param[in] unit : unit id
+* @param[in] type : BVIEW_BST_STATS or BVIEW_BST_THRESHOLD
+*
+* @retval  : BVIEW_STATUS_SUCCESS : cleared record is published.
+* @retval  : BVIEW_STATUS_OUTOFMEMORY : no memory for the record.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : invoked in the bst context only. The next stats record
+*            is reported against the cleared record.
+*
+*********************************************************************/
+BVIEW_STATUS bst_snapshot_clear (unsigned int unit, BVIEW_BST_REPORT_TYPE_t type)
+{
+  BVIEW_BST_REPORT_SNAPSHOT_t **slot;
+  BVIEW_BST_REPORT_SNAPSHOT_t *ss, *old, *previous;
+
+  if (unit >= BVIEW_BST_MAX_UNITS)
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+  slot = bst_snapshot_slot_get (unit, type);
+  if (NULL == slot)
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+
+  ss = bst_snapshot_alloc (unit);
+  if (NULL == ss)
+  {
+    return BVIEW_STATUS_OUTOFMEMORY;
+  }
+  ss->realmMask = BVIEW_BST_REALM_ALL;
+
+  old = bst_snapshot_swap (unit, slot, ss);
+  if (NULL != old)
+  {
+    previous = old->previous;
+    old->previous = NULL;
+    bst_snapshot_put (unit, previous);
+    bst_snapshot_put (unit, old);
+  }
+  /* the next stats record is diffed against the cleared one */
+  if (BVIEW_BST_STATS == type)
+  {
+    bst_rollup_resync (unit);
+    bst_sketch_resync (unit);
+    bst_top_resync (unit);
+  }
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief : takes a reference on the published record
+*
+* @param[in] unit : unit id
+* @param[in] type : BVIEW_BST_STATS or BVIEW_BST_THRESHOLD
+* @param[out] ss : published record
+* @param[out] previous : record published before the stats record,
+*                        may be NULL if not required
+*
+* @retval  : BVIEW_STATUS_SUCCESS : references are taken.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : the references are dropped with bst_snapshot_put once the
+*            records are encoded. No lock is held meanwhile, a new
+*            record can be published while the response is sent.
+*
+*********************************************************************/
+BVIEW_STATUS bst_snapshot_acquire (unsigned int unit, BVIEW_BST_REPORT_TYPE_t type,
+                                   BVIEW_BST_REPORT_SNAPSHOT_t **ss,
+                                   BVIEW_BST_REPORT_SNAPSHOT_t **previous)
+{
+  BVIEW_BST_SNAPSHOT_CXT_t *cxt;
+  BVIEW_BST_REPORT_SNAPSHOT_t **slot;
+
+  if ((unit >= BVIEW_BST_MAX_UNITS) || (NULL == ss))
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+  slot = bst_snapshot_slot_get (unit, type);
+  if (NULL == slot)
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+  cxt = BST_SNAPSHOT_CXT_GET (unit);
+
+  __atomic_add_fetch (&cxt->readers, 1, __ATOMIC_SEQ_CST);
+  *ss = __atomic_load_n (slot, __ATOMIC_SEQ_CST);
+  bst_snapshot_get (*ss);
+  if (NULL != previous)
+  {
+    *previous = (NULL != *ss) ? (*ss)->previous : NULL;
+    bst_snapshot_get (*previous);
+  }
+  __atomic_sub_fetch (&cxt->readers, 1, __ATOMIC_SEQ_CST);
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/* counter arrays of every realm, in the order of the realms */
+static const struct
+{
+  BVIEW_BST_COUNTER_t first;
+  unsigned int num;
+} bst_snapshot_realm_counters[BVIEW_BST_NUM_REALMS] = {
+  {BVIEW_BST_CNT_DEVICE, 1},
+  {BVIEW_BST_CNT_IPPG_UM_SHARE, 2},
+  {BVIEW_BST_CNT_IPSP_UM_SHARE, 1},
+  {BVIEW_BST_CNT_ISP_UM_SHARE, 1},
+  {BVIEW_BST_CNT_EPSP_UC_SHARE, 4},
+  {BVIEW_BST_CNT_ESP_UM_SHARE, 3},
+  {BVIEW_BST_CNT_EUCQ_UC, 1},
+  {BVIEW_BST_CNT_EUCQG_UC, 1},
+  {BVIEW_BST_CNT_EMCQ_MC, 2},
+  {BVIEW_BST_CNT_CPUQ_BUFFER, 2},
+  {BVIEW_BST_CNT_RQEQ_BUFFER, 2}
+};
+
+/*********************************************************************
+* @brief : limits a capability of the asic to the size of the full
+*          size record
+*
+* @param[in] value : capability
+* @param[in] max : entries of the full size record
+*
+* @retval  : number of entries
+*
+*********************************************************************/
+static unsigned int bst_snapshot_dim_get (int value, unsigned int max)
+{
+  if (value <= 0)
+  {
+    return 0;
+  }
+  return ((unsigned int) value < max) ? (unsigned int) value : max;
+}
+
+/*********************************************************************
+* @brief : places a counter array in the counter block
+*
+* @param[in] layout : layout being set
+* @param[in] cnt : counter array
+* @param[in] count : number of counters
+* @param[in] stride : counters per port, 0 if not kept per port
+*
+* @retval  : none
+*
+*********************************************************************/
+static void bst_snapshot_array_set (BVIEW_BST_SNAPSHOT_LAYOUT_t *layout,
+                                    BVIEW_BST_COUNTER_t cnt,
+                                    unsigned int count, unsigned int stride)
+{
+  layout->count[cnt] = count;
+  layout->stride[cnt] = stride;
+  layout->offset[cnt] = layout->numCounters;
+  layout->numCounters += (count + BVIEW_BST_SNAPSHOT_ALIGN - 1) &
+                         ~(BVIEW_BST_SNAPSHOT_ALIGN - 1);
+}
+
+/*********************************************************************
+* @brief : computes the shape of the records of an asic
+*
+* @param[out] layout : layout, the queue port maps are not allocated
+* @param[in] asic : capabilities of the asic
+*
+* @retval  : BVIEW_STATUS_SUCCESS : layout is computed.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : every counter array holds the entries the asic has, not
+*            the maximum of all asics. Arrays start on a cache line and
+*            the bitmap of a realm covers the padded entries.
+*
+*********************************************************************/
+BVIEW_STATUS bst_snapshot_layout_init (BVIEW_BST_SNAPSHOT_LAYOUT_t *layout,
+                                       const BVIEW_ASIC_CAPABILITIES_t *asic)
+{
+  unsigned int numPorts, numPg, numIsp, numSp;
+  unsigned int numUcq, numUcqg, numMcq, numCpuq, numRqeq;
+  unsigned int index, entries;
+
+  if ((NULL == layout) || (NULL == asic))
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+
+  numPorts = bst_snapshot_dim_get (asic->numPorts, BVIEW_ASIC_MAX_PORTS);
+  numPg = bst_snapshot_dim_get (asic->numPriorityGroups, BVIEW_ASIC_MAX_PRIORITY_GROUPS);
+  numSp = bst_snapshot_dim_get (asic->numServicePools, BVIEW_ASIC_MAX_SERVICE_POOLS);
+  /* ingress service pools include the common pools */
+  numIsp = bst_snapshot_dim_get (asic->numServicePools + asic->numCommonPools,
+                                 BVIEW_ASIC_MAX_INGRESS_SERVICE_POOLS);
+  numUcq = bst_snapshot_dim_get (asic->numUnicastQueues, BVIEW_ASIC_MAX_UC_QUEUES);
+  numUcqg = bst_snapshot_dim_get (asic->numUnicastQueueGroups, BVIEW_ASIC_MAX_UC_QUEUE_GROUPS);
+  numMcq = bst_snapshot_dim_get (asic->numMulticastQueues, BVIEW_ASIC_MAX_MC_QUEUES);
+  numCpuq = bst_snapshot_dim_get (asic->numCpuQueues, BVIEW_ASIC_MAX_CPU_QUEUES);
+  numRqeq = bst_snapshot_dim_get (asic->numRqeQueues, BVIEW_ASIC_MAX_RQE_QUEUES);
+
+  memset (layout, 0, sizeof (BVIEW_BST_SNAPSHOT_LAYOUT_t));
+  layout->numPorts = numPorts;
+
+  bst_snapshot_array_set (layout, BVIEW_BST_CNT_DEVICE, 1, 0);
+  bst_snapshot_array_set (layout, BVIEW_BST_CNT_IPPG_UM_SHARE, numPorts * numPg, numPg);
+  bst_snapshot_array_set (layout, BVIEW_BST_CNT_IPPG_UM_HEADROOM, numPorts * numPg, numPg);
+  bst_snapshot_array_set (layout, BVIEW_BST_CNT_IPSP_UM_SHARE, numPorts * numIsp, numIsp);
+  bst_snapshot_array_set (layout, BVIEW_BST_CNT_ISP_UM_SHARE, numIsp, 0);
+  bst_snapshot_array_set (layout, BVIEW_BST_CNT_EPSP_UC_SHARE, numPorts * numSp, numSp);
+  bst_snapshot_array_set (layout, BVIEW_BST_CNT_EPSP_UM_SHARE, numPorts * numSp, numSp);
+  bst_snapshot_array_set (layout, BVIEW_BST_CNT_EPSP_MC_SHARE, numPorts * numSp, numSp);
+  bst_snapshot_array_set (layout, BVIEW_BST_CNT_EPSP_MC_SHARE_QENTRIES, numPorts * numSp, numSp);
+  bst_snapshot_array_set (layout, BVIEW_BST_CNT_ESP_UM_SHARE, numSp, 0);
+  bst_snapshot_array_set (layout, BVIEW_BST_CNT_ESP_MC_SHARE, numSp, 0);
+  bst_snapshot_array_set (layout, BVIEW_BST_CNT_ESP_MC_SHARE_QENTRIES, numSp, 0);
+  bst_snapshot_array_set (layout, BVIEW_BST_CNT_EUCQ_UC, numUcq, 0);
+  bst_snapshot_array_set (layout, BVIEW_BST_CNT_EUCQG_UC, numUcqg, 0);
+  bst_snapshot_array_set (layout, BVIEW_BST_CNT_EMCQ_MC, numMcq, 0);
+  bst_snapshot_array_set (layout, BVIEW_BST_CNT_EMCQ_MC_QENTRIES, numMcq, 0);
+  bst_snapshot_array_set (layout, BVIEW_BST_CNT_CPUQ_BUFFER, numCpuq, 0);
+  bst_snapshot_array_set (layout, BVIEW_BST_CNT_CPUQ_QENTRIES, numCpuq, 0);
+  bst_snapshot_array_set (layout, BVIEW_BST_CNT_RQEQ_BUFFER, numRqeq, 0);
+  bst_snapshot_array_set (layout, BVIEW_BST_CNT_RQEQ_QENTRIES, numRqeq, 0);
+
+  /* the arrays of a realm have the entries of the realm, the
+     bitmaps of the realm have one bit per padded entry */
+  for (index = 0; index < BVIEW_BST_NUM_REALMS; index++)
+  {
+    layout->realmCounter[index] = bst_snapshot_realm_counters[index].first;
+    layout->realmNumCounters[index] = bst_snapshot_realm_counters[index].num;
+    entries = layout->count[bst_snapshot_realm_counters[index].first];
+    layout->realmEntries[index] = entries;
+    layout->bitmapOffset[index] = layout->numBitmapWords;
+    layout->bitmapWords[index] = (entries + 63) / 64;
+    layout->numBitmapWords += layout->bitmapWords[index];
+  }
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief : sizes the records of a unit from the asic capabilities
+*
+* @param[in] unit : unit id
+* @param[in] asic : capabilities of the asic
+*
+* @retval  : BVIEW_STATUS_SUCCESS : layout is set.
+* @retval  : BVIEW_STATUS_OUTOFMEMORY : no memory for the layout.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : invoked once, before any record of the unit is allocated.
+*            The full size record is kept for the asic to fill.
+*
+*********************************************************************/
+BVIEW_STATUS bst_snapshot_layout_set (unsigned int unit,
+                                      const BVIEW_ASIC_CAPABILITIES_t *asic)
+{
+  BVIEW_BST_SNAPSHOT_CXT_t *cxt;
+  BVIEW_BST_SNAPSHOT_LAYOUT_t *layout;
+  BVIEW_STATUS rv;
+
+  if ((unit >= BVIEW_BST_MAX_UNITS) || (NULL == asic))
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+  cxt = BST_SNAPSHOT_CXT_GET (unit);
+  layout = &cxt->layout;
+
+  rv = bst_snapshot_layout_init (layout, asic);
+  if (BVIEW_STATUS_SUCCESS != rv)
+  {
+    return rv;
+  }
+
+  /* queue to port mapping of the asic, learnt from the collections */
+  layout->ucQueuePort = (uint16_t *) calloc (layout->count[BVIEW_BST_CNT_EUCQ_UC] + 1,
+                                             sizeof (uint16_t));
+  layout->mcQueuePort = (uint16_t *) calloc (layout->count[BVIEW_BST_CNT_EMCQ_MC] + 1,
+                                             sizeof (uint16_t));
+  cxt->scratch = (BVIEW_BST_ASIC_SNAPSHOT_DATA_t *)
+                     calloc (1, sizeof (BVIEW_BST_ASIC_SNAPSHOT_DATA_t));
+  if ((NULL == layout->ucQueuePort) || (NULL == layout->mcQueuePort) ||
+      (NULL == cxt->scratch))
+  {
+    free (layout->ucQueuePort);
+    free (layout->mcQueuePort);
+    free (cxt->scratch);
+    memset (layout, 0, sizeof (BVIEW_BST_SNAPSHOT_LAYOUT_t));
+    cxt->scratch = NULL;
+    return BVIEW_STATUS_OUTOFMEMORY;
+  }
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief : returns the full size record of a unit to be filled by the asic
+*
+* @param[in] unit : unit id
+*
+* @retval  : record, NULL for an invalid unit
+*
+* @note    : invoked in the bst context only. The realms read into
+*            the record are moved to a record with bst_snapshot_pack,
+*            which leaves them cleared for the next read.
+*
+*********************************************************************/
+BVIEW_BST_ASIC_SNAPSHOT_DATA_t *bst_snapshot_scratch_get (unsigned int unit)
+{
+  if (unit >= BVIEW_BST_MAX_UNITS)
+  {
+    return NULL;
+  }
+  return bst_info.unit[unit].snapshot.scratch;
+}
+
+/*********************************************************************
+* @brief : moves one realm of the full size record into a record
+*
+* @param[in] layout : layout of the unit
+* @param[in] realm : realm
+* @param[in] src : full size record
+* @param[in] ss : record being collected
+*
+* @retval  : none
+*
+* @note    : only the entries the asic has are touched.
+*
+*********************************************************************/
+static void bst_snapshot_realm_pack (BVIEW_BST_SNAPSHOT_LAYOUT_t *layout,
+                                     BVIEW_BST_REALM_t realm,
+                                     BVIEW_BST_ASIC_SNAPSHOT_DATA_t *src,
+                                     BVIEW_BST_REPORT_SNAPSHOT_t *ss)
+{
+  uint32_t *cnt1, *cnt2, *cnt3, *cnt4;
+  unsigned int port, index, stride, entry;
+
+  switch (realm)
+  {
+    case BVIEW_BST_REALM_DEVICE:
+      cnt1 = BST_SNAPSHOT_ARRAY (ss, BVIEW_BST_CNT_DEVICE);
+      BST_SNAPSHOT_MOVE (cnt1[0], src->device.bufferCount);
+      break;
+
+    case BVIEW_BST_REALM_INGRESS_PORT_PG:
+      cnt1 = BST_SNAPSHOT_ARRAY (ss, BVIEW_BST_CNT_IPPG_UM_SHARE);
+      cnt2 = BST_SNAPSHOT_ARRAY (ss, BVIEW_BST_CNT_IPPG_UM_HEADROOM);
+      stride = layout->stride[BVIEW_BST_CNT_IPPG_UM_SHARE];
+      for (port = 0; port < layout->numPorts; port++)
+      {
+        for (index = 0; index < stride; index++)
+        {
+          entry = (port * stride) + index;
+          BST_SNAPSHOT_MOVE (cnt1[entry], src->iPortPg.data[port][index].umShareBufferCount);
+          BST_SNAPSHOT_MOVE (cnt2[entry], src->iPortPg.data[port][index].umHeadroomBufferCount);
+        }
+      }
+      break;
+
+    case BVIEW_BST_REALM_INGRESS_PORT_SP:
+      cnt1 = BST_SNAPSHOT_ARRAY (ss, BVIEW_BST_CNT_IPSP_UM_SHARE);
+      stride = layout->stride[BVIEW_BST_CNT_IPSP_UM_SHARE];
+      for (port = 0; port < layout->numPorts; port++)
+      {
+        for (index = 0; index < stride; index++)
+        {
+          entry = (port * stride) + index;
+          BST_SNAPSHOT_MOVE (cnt1[entry], src->iPortSp.data[port][index].umShareBufferCount);
+        }
+      }
+      break;
+
+    case BVIEW_BST_REALM_INGRESS_SP:
+      cnt1 = BST_SNAPSHOT_ARRAY (ss, BVIEW_BST_CNT_ISP_UM_SHARE);
+      for (index = 0; index < layout->count[BVIEW_BST_CNT_ISP_UM_SHARE]; index++)
+      {
+        BST_SNAPSHOT_MOVE (cnt1[index], src->iSp.data[index].umShareBufferCount);
+      }
+      break;
+
+    case BVIEW_BST_REALM_EGRESS_PORT_SP:
+      cnt1 = BST_SNAPSHOT_ARRAY (ss, BVIEW_BST_CNT_EPSP_UC_SHARE);
+      cnt2 = BST_SNAPSHOT_ARRAY (ss, BVIEW_BST_CNT_EPSP_UM_SHARE);
+      cnt3 = BST_SNAPSHOT_ARRAY (ss, BVIEW_BST_CNT_EPSP_MC_SHARE);
+      cnt4 = BST_SNAPSHOT_ARRAY (ss, BVIEW_BST_CNT_EPSP_MC_SHARE_QENTRIES);
+      stride = layout->stride[BVIEW_BST_CNT_EPSP_UC_SHARE];
+      for (port = 0; port < layout->numPorts; port++)
+      {
+        for (index = 0; index < stride; index++)
+        {
+          entry = (port * stride) + index;
+          BST_SNAPSHOT_MOVE (cnt1[entry], src->ePortSp.data[port][index].ucShareBufferCount);
+          BST_SNAPSHOT_MOVE (cnt2[entry], src->ePortSp.data[port][index].umShareBufferCount);
+          BST_SNAPSHOT_MOVE (cnt3[entry], src->ePortSp.data[port][index].mcShareBufferCount);
+          BST_SNAPSHOT_MOVE (cnt4[entry], src->ePortSp.data[port][index].mcShareQueueEntries);
+        }
+      }
+      break;
+
+    case BVIEW_BST_REALM_EGRESS_SP:
+      cnt1 = BST_SNAPSHOT_ARRAY (ss, BVIEW_BST_CNT_ESP_UM_SHARE);
+      cnt2 = BST_SNAPSHOT_ARRAY (ss, BVIEW_BST_CNT_ESP_MC_SHARE);
+      cnt3 = BST_SNAPSHOT_ARRAY (ss, BVIEW_BST_CNT_ESP_MC_SHARE_QENTRIES);
+      for (index = 0; index < layout->count[BVIEW_BST_CNT_ESP_UM_SHARE]; index++)
+      {
+        BST_SNAPSHOT_MOVE (cnt1[index], src->eSp.data[index].umShareBufferCount);
+        BST_SNAPSHOT_MOVE (cnt2[index], src->eSp.data[index].mcShareBufferCount);
+        BST_SNAPSHOT_MOVE (cnt3[index], src->eSp.data[index].mcShareQueueEntries);
+      }
+      break;
+
+    case BVIEW_BST_REALM_EGRESS_UC_QUEUE:
+      cnt1 = BST_SNAPSHOT_ARRAY (ss, BVIEW_BST_CNT_EUCQ_UC);
+      for (index = 0; index < layout->count[BVIEW_BST_CNT_EUCQ_UC]; index++)
+      {
+        BST_SNAPSHOT_MOVE (cnt1[index], src->eUcQ.data[index].ucBufferCount);
+        /* the mapping is the same in every read */
+        if (0 != src->eUcQ.data[index].port)
+        {
+          layout->ucQueuePort[index] = (uint16_t) src->eUcQ.data[index].port;
+          src->eUcQ.data[index].port = 0;
+        }
+      }
+      break;
+
+    case BVIEW_BST_REALM_EGRESS_UC_QUEUEGROUPS:
+      cnt1 = BST_SNAPSHOT_ARRAY (ss, BVIEW_BST_CNT_EUCQG_UC);
+      for (index = 0; index < layout->count[BVIEW_BST_CNT_EUCQG_UC]; index++)
+      {
+        BST_SNAPSHOT_MOVE (cnt1[index], src->eUcQg.data[index].ucBufferCount);
+      }
+      break;
+
+    case BVIEW_BST_REALM_EGRESS_MC_QUEUE:
+      cnt1 = BST_SNAPSHOT_ARRAY (ss, BVIEW_BST_CNT_EMCQ_MC);
+      cnt2 = BST_SNAPSHOT_ARRAY (ss, BVIEW_BST_CNT_EMCQ_MC_QENTRIES);
+      for (index = 0; index < layout->count[BVIEW_BST_CNT_EMCQ_MC]; index++)
+      {
+        BST_SNAPSHOT_MOVE (cnt1[index], src->eMcQ.data[index].mcBufferCount);
+        BST_SNAPSHOT_MOVE (cnt2[index], src->eMcQ.data[index].mcQueueEntries);
+        if (0 != src->eMcQ.data[index].port)
+        {
+          layout->mcQueuePort[index] = (uint16_t) src->eMcQ.data[index].port;
+          src->eMcQ.data[index].port = 0;
+        }
+      }
+      break;
+
+    case BVIEW_BST_REALM_EGRESS_CPU_QUEUE:
+      cnt1 = BST_SNAPSHOT_ARRAY (ss, BVIEW_BST_CNT_CPUQ_BUFFER);
+      cnt2 = BST_SNAPSHOT_ARRAY (ss, BVIEW_BST_CNT_CPUQ_QENTRIES);
+      for (index = 0; index < layout->count[BVIEW_BST_CNT_CPUQ_BUFFER]; index++)
+      {
+        BST_SNAPSHOT_MOVE (cnt1[index], src->cpqQ.data[index].cpuBufferCount);
+        BST_SNAPSHOT_MOVE (cnt2[index], src->cpqQ.data[index].cpuQueueEntries);
+      }
+      break;
+
+    case BVIEW_BST_REALM_EGRESS_RQE_QUEUE:
+      cnt1 = BST_SNAPSHOT_ARRAY (ss, BVIEW_BST_CNT_RQEQ_BUFFER);
+      cnt2 = BST_SNAPSHOT_ARRAY (ss, BVIEW_BST_CNT_RQEQ_QENTRIES);
+      for (index = 0; index < layout->count[BVIEW_BST_CNT_RQEQ_BUFFER]; index++)
+      {
+        BST_SNAPSHOT_MOVE (cnt1[index], src->rqeQ.data[index].rqeBufferCount);
+        BST_SNAPSHOT_MOVE (cnt2[index], src->rqeQ.data[index].rqeQueueEntries);
+      }
+      break;
+
+    default:
+      break;
+  }
+}
+
+/*********************************************************************
+* @brief : moves realms of the full size record into a record
+*
+* @param[in] unit : unit id
+* @param[in] realmMask : realms read into the full size record
+* @param[in] ss : record being collected
+*
+* @retval  : BVIEW_STATUS_SUCCESS : realms are packed.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : invoked in the bst context only. Counters beyond 32 bits
+*            are saturated. Queue ports are kept in the layout.
+*
+*********************************************************************/
+BVIEW_STATUS bst_snapshot_pack (unsigned int unit, BVIEW_BST_REALM_MASK_t realmMask,
+                                BVIEW_BST_REPORT_SNAPSHOT_t *ss)
+{
+  BVIEW_BST_SNAPSHOT_CXT_t *cxt;
+  BVIEW_BST_REALM_t realm;
+
+  if ((unit >= BVIEW_BST_MAX_UNITS) || (NULL == ss))
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+  cxt = BST_SNAPSHOT_CXT_GET (unit);
+  if (NULL == cxt->scratch)
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+
+  BVIEW_BST_REALM_ITER (realm)
+  {
+    if (0 != (realmMask & realm))
+    {
+      bst_snapshot_realm_pack (&cxt->layout, realm, cxt->scratch, ss);
+    }
+  }
+  ss->realmMask |= realmMask;
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief : returns whether a stats record holds every tracked realm
+*
+* @param[in] unit : unit id
+* @param[in] ss : record
+*
+* @retval  : true : every tracked realm is read into the record.
+* @retval  : false : the record is of a few realms, the others are
+*                    carried over from the record before it.
+*
+*********************************************************************/
+bool bst_snapshot_is_complete (unsigned int unit, const BVIEW_BST_REPORT_SNAPSHOT_t *ss)
+{
+  BVIEW_BST_REALM_MASK_t trackMask;
+
+  trackMask = BST_TRACK_TO_REALM_MASK (BST_CONFIG_TRACK_PTR_GET (unit));
+  return (0 == (trackMask & ~ss->realmMask)) ? true : false;
+}
@@ -0,0 +1,962 @@
+/*****************************************************************************
+  *
+  * (C) Copyright Broadcom Corporation 2015
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License");
+  * you may not use this file except in compliance with the License.
+  *
+  * You may obtain a copy of the License at
+  * http://www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ***************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <inttypes.h>
+#include <pthread.h>
+#include "json.h"
+#include "clear_bst_statistics.h"
+#include "clear_bst_thresholds.h"
+#include "configure_bst_thresholds.h"
+#include "configure_bst_feature.h"
+#include "configure_bst_tracking.h"
+#include "get_bst_tracking.h"
+#include "get_bst_feature.h"
+#include "get_bst_thresholds.h"
+#include "get_bst_report.h"
+#include "bst_json_encoder.h"
+#include "bst.h"
+#include "broadview.h"
+#include "bst_app.h"
+#include "openapps_log_api.h"
+
+/* BST Context Info*/
+extern BVIEW_BST_CXT_t bst_info;
+
+#define BST_TOP_CXT_GET(_unit)  &bst_info.unit[_unit].top
+
+#define BST_TOP_NSEC_PER_SEC    1000000000ULL
+
+/* interval of a slice, in nano seconds */
+#define BST_TOP_SLICE_NS        ((uint64_t) BVIEW_BST_TOP_SLICE_SEC * BST_TOP_NSEC_PER_SEC)
+
+/* not in a top list */
+#define BST_TOP_NO_POSITION     (-1)
+
+/*********************************************************************
+* @brief : puts an entry at a position of the heap of a realm
+*
+* @param[in,out] heap : heap of the realm
+* @param[in,out] position : position of every entry in the heap
+* @param[in] slot : position in the heap
+* @param[in] item : entry and its occupancy
+*
+* @retval  : none
+*
+*********************************************************************/
+static inline void bst_top_heap_set (BVIEW_BST_TOP_ENTRY_t *heap, int32_t *position,
+                                     unsigned int slot, BVIEW_BST_TOP_ENTRY_t item)
+{
+  heap[slot] = item;
+  position[item.entry] = (int32_t) slot;
+}
+
+/*********************************************************************
+* @brief : moves an entry of the heap of a realm towards its root
+*
+* @param[in,out] heap : heap of the realm
+* @param[in,out] position : position of every entry in the heap
+* @param[in] slot : position of the entry
+*
+* @retval  : none
+*
+*********************************************************************/
+static void bst_top_heap_up (BVIEW_BST_TOP_ENTRY_t *heap, int32_t *position,
+                             unsigned int slot)
+{
+  BVIEW_BST_TOP_ENTRY_t item = heap[slot];
+  unsigned int parent;
+
+  while (slot > 0)
+  {
+    parent = (slot - 1) / 2;
+    if (heap[parent].value <= item.value)
+    {
+      break;
+    }
+    bst_top_heap_set (heap, position, slot, heap[parent]);
+    slot = parent;
+  }
+  bst_top_heap_set (heap, position, slot, item);
+}
+
+/*********************************************************************
+* @brief : moves an entry of the heap of a realm away from its root
+*
+* @param[in,out] heap : heap of the realm
+* @param[in] numEntries : entries of the heap
+* @param[in,out] position : position of every entry in the heap
+* @param[in] slot : position of the entry
+*
+* @retval  : none
+*
+*********************************************************************/
+static void bst_top_heap_down (BVIEW_BST_TOP_ENTRY_t *heap, unsigned int numEntries,
+                               int32_t *position, unsigned int slot)
+{
+  BVIEW_BST_TOP_ENTRY_t item = heap[slot];
+  unsigned int child;
+
+  for (;;)
+  {
+    child = (2 * slot) + 1;
+    if (child >= numEntries)
+    {
+      break;
+    }
+    if (((child + 1) < numEntries) && (heap[child + 1].value < heap[child].value))
+    {
+      child++;
+    }
+    if (item.value <= heap[child].value)
+    {
+      break;
+    }
+    bst_top_heap_set (heap, position, slot, heap[child]);
+    slot = child;
+  }
+  bst_top_heap_set (heap, position, slot, item);
+}
+
+/*********************************************************************
+* @brief : offers the occupancy of an entry to the list of its realm
+*
+* @param[in,out] list : top list
+* @param[in] realmIndex : realm of the entry
+* @param[in,out] position : position of every entry of the realm in
+*                           its heap
+* @param[in] entry : entry of the realm
+* @param[in] value : occupancy of the entry, in cells
+*
+* @retval  : none
+*
+* @note    : the occupancy of an entry already in the list is only
+*            raised. The lowest entry of a full list gives way to a
+*            higher one.
+*
+*********************************************************************/
+static void bst_top_list_offer (BVIEW_BST_TOP_LIST_t *list, unsigned int realmIndex,
+                                int32_t *position, unsigned int entry, uint32_t value)
+{
+  BVIEW_BST_TOP_ENTRY_t *heap = list->entries[realmIndex];
+  unsigned int *numEntries = &list->numEntries[realmIndex];
+  BVIEW_BST_TOP_ENTRY_t item;
+
+  if (BST_TOP_NO_POSITION != position[entry])
+  {
+    heap[position[entry]].value = value;
+    bst_top_heap_down (heap, *numEntries, position, (unsigned int) position[entry]);
+    return;
+  }
+
+  item.entry = entry;
+  item.value = value;
+  if (*numEntries < BVIEW_BST_TOP_MAX_ENTRIES)
+  {
+    bst_top_heap_set (heap, position, (*numEntries)++, item);
+    bst_top_heap_up (heap, position, *numEntries - 1);
+    return;
+  }
+  if (value <= heap[0].value)
+  {
+    return;
+  }
+  position[heap[0].entry] = BST_TOP_NO_POSITION;
+  bst_top_heap_set (heap, position, 0, item);
+  bst_top_heap_down (heap, *numEntries, position, 0);
+}
+
+/*********************************************************************
+* @brief : empties the list of a realm
+*
+* @param[in,out] list : top list
+* @param[in] realmIndex : realm
+* @param[in,out] position : position of every entry of the realm in
+*                           its heap
+*
+* @retval  : none
+*
+*********************************************************************/
+static void bst_top_list_reset (BVIEW_BST_TOP_LIST_t *list, unsigned int realmIndex,
+                                int32_t *position)
+{
+  unsigned int slot;
+
+  for (slot = 0; slot < list->numEntries[realmIndex]; slot++)
+  {
+    position[list->entries[realmIndex][slot].entry] = BST_TOP_NO_POSITION;
+  }
+  list->numEntries[realmIndex] = 0;
+}
+
+/*********************************************************************
+* @brief : frees the memory of the top entries of a unit
+*
+* @param[in] cxt : top entries of the unit
+*
+* @retval  : none
+*
+*********************************************************************/
+static void bst_top_free (BVIEW_BST_TOP_CXT_t *cxt)
+{
+  unsigned int unit = cxt->unit;
+
+  free (cxt->occupancy);
+  free (cxt->latestPosition);
+  free (cxt->max);
+  free (cxt->openPosition);
+  free (cxt->slices);
+  memset (cxt, 0, sizeof (BVIEW_BST_TOP_CXT_t));
+  cxt->unit = unit;
+}
+
+/*********************************************************************
+* @brief : drops the slices of the top entries of a unit
+*
+* @param[in] cxt : top entries of the unit
+*
+* @retval  : none
+*
+* @note    : the next record folded opens a slice with all its entries.
+*
+*********************************************************************/
+static void bst_top_slices_reset (BVIEW_BST_TOP_CXT_t *cxt)
+{
+  unsigned int realmIndex;
+
+  for (realmIndex = 0; realmIndex < BVIEW_BST_NUM_REALMS; realmIndex++)
+  {
+    bst_top_list_reset (&cxt->open.list, realmIndex, &cxt->openPosition[cxt->base[realmIndex]]);
+  }
+  memset (cxt->max, 0, cxt->numEntries * sizeof (uint32_t));
+  cxt->open.numSamples = 0;
+  cxt->head = 0;
+  cxt->numSlices = 0;
+}
+
+/*********************************************************************
+* @brief : initializes the top entries of a unit
+*
+* @param[in] unit : unit id
+*
+* @retval  : BVIEW_STATUS_SUCCESS : top entries are initialized.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : there are no lists until they are sized with
+*            bst_top_config_set.
+*
+*********************************************************************/
+BVIEW_STATUS bst_top_init (unsigned int unit)
+{
+  BVIEW_BST_TOP_CXT_t *cxt;
+
+  if (unit >= BVIEW_BST_MAX_UNITS)
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+  cxt = BST_TOP_CXT_GET (unit);
+
+  memset (cxt, 0, sizeof (BVIEW_BST_TOP_CXT_t));
+  cxt->unit = unit;
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief : frees the top entries of a unit
+*
+* @param[in] unit : unit id
+*
+* @retval  : none
+*
+*********************************************************************/
+void bst_top_uninit (unsigned int unit)
+{
+  if (unit >= BVIEW_BST_MAX_UNITS)
+  {
+    return;
+  }
+  bst_top_free (BST_TOP_CXT_GET (unit));
+}
+
+/*********************************************************************
+* @brief : sizes the top lists of a unit from its layout
+*
+* @param[in] unit : unit id
+*
+* @retval  : BVIEW_STATUS_SUCCESS : top lists are sized.
+* @retval  : BVIEW_STATUS_OUTOFMEMORY : no memory for the top lists.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : invoked in the bst context only, once the records of the
+*            unit are sized. The occupancy and max of every entry are
+*            kept besides the lists, so that a record is folded from
+*            the entries which changed only.
+*
+*********************************************************************/
+BVIEW_STATUS bst_top_config_set (unsigned int unit)
+{
+  BVIEW_BST_TOP_CXT_t *cxt;
+  const BVIEW_BST_SNAPSHOT_LAYOUT_t *layout;
+  unsigned int realmIndex, counter, numEntries = 0;
+
+  if (unit >= BVIEW_BST_MAX_UNITS)
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+  cxt = BST_TOP_CXT_GET (unit);
+  layout = &bst_info.unit[unit].snapshot.layout;
+
+  bst_top_free (cxt);
+  for (realmIndex = 0; realmIndex < BVIEW_BST_NUM_REALMS; realmIndex++)
+  {
+    cxt->base[realmIndex] = numEntries;
+    numEntries += layout->realmEntries[realmIndex];
+  }
+  if ((0 == numEntries) || (0 == layout->numCounters))
+  {
+    return BVIEW_STATUS_SUCCESS;
+  }
+  for (counter = 0; counter < BVIEW_BST_NUM_COUNTERS; counter++)
+  {
+    if (true == bst_history_counter_is_buffer ((BVIEW_BST_COUNTER_t) counter))
+    {
+      cxt->bufferCounters |= (1U << counter);
+    }
+  }
+
+  cxt->occupancy = (uint32_t *) calloc (numEntries, sizeof (uint32_t));
+  cxt->latestPosition = (int32_t *) malloc (numEntries * sizeof (int32_t));
+  cxt->max = (uint32_t *) calloc (numEntries, sizeof (uint32_t));
+  cxt->openPosition = (int32_t *) malloc (numEntries * sizeof (int32_t));
+  cxt->slices = (BVIEW_BST_TOP_SLICE_t *) malloc (BVIEW_BST_TOP_SLICES *
+                                                  sizeof (BVIEW_BST_TOP_SLICE_t));
+  if ((NULL == cxt->occupancy) || (NULL == cxt->latestPosition) || (NULL == cxt->max) ||
+      (NULL == cxt->openPosition) || (NULL == cxt->slices))
+  {
+    bst_top_free (cxt);
+    LOG_POST (BVIEW_LOG_ERROR,
+              "Failed to allocate the top entries for unit %d\r\n", unit);
+    return BVIEW_STATUS_OUTOFMEMORY;
+  }
+  /* all the bytes of a position set is no position */
+  memset (cxt->latestPosition, 0xff, numEntries * sizeof (int32_t));
+  memset (cxt->openPosition, 0xff, numEntries * sizeof (int32_t));
+  cxt->numEntries = numEntries;
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief : returns the occupancy of an entry of a record
+*
+* @param[in] cxt : top entries of the unit
+* @param[in] layout : layout of the counters
+* @param[in] realmIndex : realm of the entry
+* @param[in] counters : counters of the record
+* @param[in] entry : entry of the realm
+*
+* @retval  : highest buffer count of the entry, in cells
+*
+*********************************************************************/
+static inline uint32_t bst_top_occupancy (const BVIEW_BST_TOP_CXT_t *cxt,
+                                          const BVIEW_BST_SNAPSHOT_LAYOUT_t *layout,
+                                          unsigned int realmIndex,
+                                          const uint32_t *counters, unsigned int entry)
+{
+  unsigned int counter, lastCounter;
+  uint32_t occupancy = 0;
+
+  lastCounter = layout->realmCounter[realmIndex] + layout->realmNumCounters[realmIndex];
+  for (counter = layout->realmCounter[realmIndex]; counter < lastCounter; counter++)
+  {
+    if ((0 != (cxt->bufferCounters & (1U << counter))) &&
+        (occupancy < counters[layout->offset[counter] + entry]))
+    {
+      occupancy = counters[layout->offset[counter] + entry];
+    }
+  }
+  return occupancy;
+}
+
+/*********************************************************************
+* @brief : folds the occupancy of an entry of a record into the lists
+*
+* @param[in] cxt : top entries of the unit
+* @param[in] realmIndex : realm of the entry
+* @param[in] entry : entry of the realm
+* @param[in] value : occupancy of the entry, in cells
+* @param[in,out] rebuild : the list of the record is to be rebuilt,
+*                          it is not updated then
+*
+* @retval  : none
+*
+* @note    : an entry which rises is offered to the lists. An entry of
+*            the list of the record which falls may give way to one
+*            out of it, the list of the realm is rebuilt then.
+*
+*********************************************************************/
+static inline void bst_top_entry_fold (BVIEW_BST_TOP_CXT_t *cxt, unsigned int realmIndex,
+                                       unsigned int entry, uint32_t value, bool *rebuild)
+{
+  unsigned int index = cxt->base[realmIndex] + entry;
+
+  if (cxt->max[index] < value)
+  {
+    cxt->max[index] = value;
+    bst_top_list_offer (&cxt->open.list, realmIndex,
+                        &cxt->openPosition[cxt->base[realmIndex]], entry, value);
+  }
+  if (false == *rebuild)
+  {
+    if ((value < cxt->occupancy[index]) &&
+        (BST_TOP_NO_POSITION != cxt->latestPosition[index]))
+    {
+      *rebuild = true;
+    }
+    else if (value > cxt->occupancy[index])
+    {
+      bst_top_list_offer (&cxt->latest, realmIndex,
+                          &cxt->latestPosition[cxt->base[realmIndex]], entry, value);
+    }
+  }
+  cxt->occupancy[index] = value;
+}
+
+/*********************************************************************
+* @brief : closes the open slice and adds it to the ring
+*
+* @param[in] cxt : top entries of the unit
+*
+* @retval  : none
+*
+* @note    : the oldest slice gives way to it once the ring is full.
+*            The list and max of the open slice are cleared for the
+*            next slice.
+*
+*********************************************************************/
+static void bst_top_slice_close (BVIEW_BST_TOP_CXT_t *cxt)
+{
+  unsigned int realmIndex;
+
+  if (BVIEW_BST_TOP_SLICES == cxt->numSlices)
+  {
+    cxt->head = (cxt->head + 1) % BVIEW_BST_TOP_SLICES;
+    cxt->numSlices--;
+  }
+  cxt->slices[(cxt->head + cxt->numSlices) % BVIEW_BST_TOP_SLICES] = cxt->open;
+  cxt->numSlices++;
+
+  for (realmIndex = 0; realmIndex < BVIEW_BST_NUM_REALMS; realmIndex++)
+  {
+    bst_top_list_reset (&cxt->open.list, realmIndex, &cxt->openPosition[cxt->base[realmIndex]]);
+  }
+  memset (cxt->max, 0, cxt->numEntries * sizeof (uint32_t));
+  cxt->open.numSamples = 0;
+}
+
+/*********************************************************************
+* @brief : folds a record into the top entries of a unit
+*
+* @param[in] cxt : top entries of the unit
+* @param[in] realtimeNs : wall clock time of the collection
+* @param[in] counters : counters of the record
+* @param[in] data : change bitmaps of the record against the record
+*                   folded last, NULL to fold all the entries
+*
+* @retval  : none
+*
+* @note    : a record past the open slice closes it, and the next
+*            slice starts from all the entries of the record.
+*            Otherwise only the entries which changed are visited,
+*            and the list of a realm is rebuilt from the occupancy of
+*            its entries only when one of the list falls.
+*
+*********************************************************************/
+static void bst_top_sample_add (BVIEW_BST_TOP_CXT_t *cxt, uint64_t realtimeNs,
+                                const uint32_t *counters,
+                                const BVIEW_BST_SNAPSHOT_DATA_t *data)
+{
+  const BVIEW_BST_SNAPSHOT_LAYOUT_t *layout = &bst_info.unit[cxt->unit].snapshot.layout;
+  BVIEW_BST_REALM_t realm;
+  unsigned int realmIndex, word, entry;
+  uint64_t startNs, bits;
+  int32_t *position;
+  bool all, rebuild;
+
+  startNs = realtimeNs - (realtimeNs % BST_TOP_SLICE_NS);
+  if ((0 != cxt->open.numSamples) && (startNs > cxt->open.startNs))
+  {
+    bst_top_slice_close (cxt);
+  }
+  if (0 == cxt->open.numSamples)
+  {
+    cxt->open.startNs = startNs;
+  }
+  all = ((NULL == data) || (0 == cxt->open.numSamples));
+
+  BVIEW_BST_REALM_ITER (realm)
+  {
+    if ((false == all) && (0 == (data->changedRealms & realm)))
+    {
+      continue;
+    }
+    realmIndex = BVIEW_BST_REALM_INDEX (realm);
+    rebuild = all;
+    if (true == all)
+    {
+      for (entry = 0; entry < layout->realmEntries[realmIndex]; entry++)
+      {
+        bst_top_entry_fold (cxt, realmIndex, entry,
+                            bst_top_occupancy (cxt, layout, realmIndex, counters, entry),
+                            &rebuild);
+      }
+    }
+    else
+    {
+      for (word = 0; word < layout->bitmapWords[realmIndex]; word++)
+      {
+        for (bits = data->changed[layout->bitmapOffset[realmIndex] + word];
+             bits != 0; bits &= (bits - 1))
+        {
+          entry = (word * 64) + __builtin_ctzll (bits);
+          bst_top_entry_fold (cxt, realmIndex, entry,
+                              bst_top_occupancy (cxt, layout, realmIndex, counters, entry),
+                              &rebuild);
+        }
+      }
+    }
+
+    if (true == rebuild)
+    {
+      position = &cxt->latestPosition[cxt->base[realmIndex]];
+      bst_top_list_reset (&cxt->latest, realmIndex, position);
+      for (entry = 0; entry < layout->realmEntries[realmIndex]; entry++)
+      {
+        if (0 != cxt->occupancy[cxt->base[realmIndex] + entry])
+        {
+          bst_top_list_offer (&cxt->latest, realmIndex, position, entry,
+                              cxt->occupancy[cxt->base[realmIndex] + entry]);
+        }
+      }
+    }
+  }
+  cxt->open.numSamples++;
+  cxt->latestNs = realtimeNs;
+}
+
+/*********************************************************************
+* @brief : notes the tracking mode of the records folded next
+*
+* @param[in] cxt : top entries of the unit
+*
+* @retval  : none
+*
+* @note    : peaks and current values are not compared, the slices
+*            are dropped when the mode changes.
+*
+*********************************************************************/
+static void bst_top_mode_sync (BVIEW_BST_TOP_CXT_t *cxt)
+{
+  BVIEW_BST_DATA_t *bst_data = bst_info.unit[cxt->unit].bst_data;
+  bool peak;
+
+  peak = ((NULL != bst_data) && (true == bst_data->bst_config.track.trackPeakStats));
+  if (peak != cxt->peak)
+  {
+    bst_top_slices_reset (cxt);
+    cxt->peak = peak;
+  }
+}
+
+/*********************************************************************
+* @brief : folds a stats record into the top entries of a unit
+*
+* @param[in] unit : unit id
+* @param[in] ss : record, published with its change bitmaps
+*
+* @retval  : BVIEW_STATUS_SUCCESS : record is folded, or the top lists
+*                                   are not sized.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : invoked in the bst context only. The entries which
+*            changed since the previous record are folded, all the
+*            entries if the previous record is not the one folded
+*            last. A record of a few realms is not folded, as it is
+*            not kept in the history.
+*
+*********************************************************************/
+BVIEW_STATUS bst_top_append (unsigned int unit,
+                             const BVIEW_BST_REPORT_SNAPSHOT_t *ss)
+{
+  BVIEW_BST_TOP_CXT_t *cxt;
+
+  if ((unit >= BVIEW_BST_MAX_UNITS) || (NULL == ss))
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+  cxt = BST_TOP_CXT_GET (unit);
+  if (0 == cxt->numEntries)
+  {
+    return BVIEW_STATUS_SUCCESS;
+  }
+
+  if (false == bst_snapshot_is_complete (unit, ss))
+  {
+    /* the next record is not diffed against the record folded last */
+    cxt->synced = false;
+    return BVIEW_STATUS_SUCCESS;
+  }
+
+  bst_top_mode_sync (cxt);
+  bst_top_sample_add (cxt, bst_history_realtime_get (ss), ss->snapshot_data.counters,
+                      ((true == cxt->synced) && (NULL != ss->previous)) ?
+                      &ss->snapshot_data : NULL);
+  cxt->synced = true;
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief : folds an entry read back from the journal into the top
+*          entries
+*
+* @param[in] unit : unit id
+* @param[in] realtimeNs : wall clock time of the collection
+* @param[in] counters : counters of the entry
+*
+* @retval  : BVIEW_STATUS_SUCCESS : entry is folded, or the top lists
+*                                   are not sized.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : invoked in the bst context only, before the collection
+*            starts. All the entries are folded, the journal does not
+*            keep the tracking mode and the one configured is taken.
+*
+*********************************************************************/
+BVIEW_STATUS bst_top_restore (unsigned int unit, uint64_t realtimeNs,
+                              const uint32_t *counters)
+{
+  BVIEW_BST_TOP_CXT_t *cxt;
+
+  if ((unit >= BVIEW_BST_MAX_UNITS) || (NULL == counters))
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+  cxt = BST_TOP_CXT_GET (unit);
+  if (0 == cxt->numEntries)
+  {
+    return BVIEW_STATUS_SUCCESS;
+  }
+
+  bst_top_mode_sync (cxt);
+  bst_top_sample_add (cxt, realtimeNs, counters, NULL);
+  /* the first record collected is not diffed against the entry */
+  cxt->synced = false;
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief : notes that the next stats record is not diffed against the
+*          record folded last
+*
+* @param[in] unit : unit id
+*
+* @retval  : none
+*
+* @note    : invoked in the bst context only, when a cleared record is
+*            published in place of the collected ones.
+*
+*********************************************************************/
+void bst_top_resync (unsigned int unit)
+{
+  if (unit >= BVIEW_BST_MAX_UNITS)
+  {
+    return;
+  }
+  bst_info.unit[unit].top.synced = false;
+}
+
+/*********************************************************************
+* @brief : orders entries of a realm by entry, highest occupancy first
+*
+* @param[in] a : first entry
+* @param[in] b : second entry
+*
+* @retval  : negative, 0 or positive as a goes before, with or after b
+*
+*********************************************************************/
+static int bst_top_entry_compare (const void *a, const void *b)
+{
+  const BVIEW_BST_TOP_ENTRY_t *x = (const BVIEW_BST_TOP_ENTRY_t *) a;
+  const BVIEW_BST_TOP_ENTRY_t *y = (const BVIEW_BST_TOP_ENTRY_t *) b;
+
+  if (x->entry != y->entry)
+  {
+    return (x->entry < y->entry) ? -1 : 1;
+  }
+  return (x->value > y->value) ? -1 : (x->value < y->value);
+}
+
+/*********************************************************************
+* @brief : orders entries of a realm by occupancy, highest first
+*
+* @param[in] a : first entry
+* @param[in] b : second entry
+*
+* @retval  : negative, 0 or positive as a goes before, with or after b
+*
+*********************************************************************/
+static int bst_top_value_compare (const void *a, const void *b)
+{
+  const BVIEW_BST_TOP_ENTRY_t *x = (const BVIEW_BST_TOP_ENTRY_t *) a;
+  const BVIEW_BST_TOP_ENTRY_t *y = (const BVIEW_BST_TOP_ENTRY_t *) b;
+
+  if (x->value != y->value)
+  {
+    return (x->value > y->value) ? -1 : 1;
+  }
+  return (x->entry < y->entry) ? -1 : (x->entry > y->entry);
+}
+
+/*********************************************************************
+* @brief : orders matches of all the realms by occupancy, highest first
+*
+* @param[in] a : first entry
+* @param[in] b : second entry
+*
+* @retval  : negative, 0 or positive as a goes before, with or after b
+*
+*********************************************************************/
+static int bst_top_match_compare (const void *a, const void *b)
+{
+  const BVIEW_BST_QUERY_MATCH_t *x = (const BVIEW_BST_QUERY_MATCH_t *) a;
+  const BVIEW_BST_QUERY_MATCH_t *y = (const BVIEW_BST_QUERY_MATCH_t *) b;
+
+  if (x->values[0] != y->values[0])
+  {
+    return (x->values[0] > y->values[0]) ? -1 : 1;
+  }
+  if (x->realm != y->realm)
+  {
+    return (x->realm < y->realm) ? -1 : 1;
+  }
+  if (x->port != y->port)
+  {
+    return (x->port < y->port) ? -1 : 1;
+  }
+  return (x->index < y->index) ? -1 : (x->index > y->index);
+}
+
+/*********************************************************************
+* @brief : returns the entries with the highest occupancy of the
+*          record folded last, or of the slices within a window
+*
+* @param[in] unit : unit id
+* @param[in] query : realms, count and window of the query
+* @param[in] cellToByteConv : bytes per cell of the response, 1 to
+*                             respond in cells
+* @param[out] top : top entries, freed with bst_top_query_end
+*
+* @retval  : BVIEW_STATUS_SUCCESS : top entries are returned.
+* @retval  : BVIEW_STATUS_RESOURCE_NOT_AVAILABLE : top lists are not sized.
+* @retval  : BVIEW_STATUS_OUTOFMEMORY : no memory for the query.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : invoked in the bst context only. Only the lists are read,
+*            never the entries of a record. The occupancy of an entry
+*            over a window is its max in the slices within it, a slice
+*            is within the window if it ends after its start. An entry
+*            among the top ones of a window is among the top ones of
+*            the slice of its max, so merging the lists of the slices
+*            loses none of them.
+*
+*********************************************************************/
+BVIEW_STATUS bst_top_query (unsigned int unit,
+                            const BVIEW_BST_TOP_QUERY_t *query,
+                            unsigned int cellToByteConv,
+                            BVIEW_BST_TOP_t *top)
+{
+  BVIEW_BST_TOP_CXT_t *cxt;
+  const BVIEW_BST_SNAPSHOT_LAYOUT_t *layout;
+  const BVIEW_BST_TOP_SLICE_t *slice;
+  BVIEW_BST_TOP_ENTRY_t *candidates;
+  BVIEW_BST_QUERY_MATCH_t *match;
+  BVIEW_BST_REALM_t realm;
+  struct timespec now;
+  unsigned int realmIndex, index, numRealms = 0, numCandidates, numKept, count;
+  uint64_t startNs = 0, nowNs;
+
+  if ((unit >= BVIEW_BST_MAX_UNITS) || (NULL == query) || (NULL == top) ||
+      (0 == query->count) || (BVIEW_BST_TOP_MAX_ENTRIES < query->count))
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+  cxt = BST_TOP_CXT_GET (unit);
+  layout = &bst_info.unit[unit].snapshot.layout;
+  memset (top, 0, sizeof (BVIEW_BST_TOP_t));
+  if (0 == cxt->numEntries)
+  {
+    return BVIEW_STATUS_RESOURCE_NOT_AVAILABLE;
+  }
+
+  cellToByteConv = (0 == cellToByteConv) ? 1 : cellToByteConv;
+  top->peak = cxt->peak;
+  top->windowSec = query->windowSec;
+  top->sliceSec = (0 == query->windowSec) ? 0 : BVIEW_BST_TOP_SLICE_SEC;
+  top->count = query->count;
+  top->perRealm = query->perRealm;
+  top->startNs = cxt->latestNs;
+  top->endNs = cxt->latestNs;
+  if (0 != query->windowSec)
+  {
+    clock_gettime (CLOCK_REALTIME, &now);
+    nowNs = ((uint64_t) now.tv_sec * BST_TOP_NSEC_PER_SEC) + (uint64_t) now.tv_nsec;
+    startNs = ((uint64_t) query->windowSec * BST_TOP_NSEC_PER_SEC);
+    startNs = (nowNs > startNs) ? (nowNs - startNs) : 0;
+  }
+
+  BVIEW_BST_REALM_ITER (realm)
+  {
+    if (0 != (query->realms & realm))
+    {
+      numRealms++;
+    }
+  }
+  /* slices within the window, the open slice last */
+  for (index = 0; (0 != query->windowSec) && (index <= cxt->numSlices); index++)
+  {
+    slice = (index < cxt->numSlices) ?
+            &cxt->slices[(cxt->head + index) % BVIEW_BST_TOP_SLICES] : &cxt->open;
+    if ((0 == slice->numSamples) || (slice->startNs + BST_TOP_SLICE_NS <= startNs))
+    {
+      continue;
+    }
+    if (0 == top->numSlices)
+    {
+      top->startNs = slice->startNs;
+    }
+    top->numSlices++;
+  }
+  /* the lists of every slice and of the open slice, for one realm */
+  candidates = (BVIEW_BST_TOP_ENTRY_t *) malloc ((BVIEW_BST_TOP_SLICES + 1) *
+                                                 BVIEW_BST_TOP_MAX_ENTRIES *
+                                                 sizeof (BVIEW_BST_TOP_ENTRY_t));
+  top->matches = (BVIEW_BST_QUERY_MATCH_t *) calloc ((numRealms * query->count) + 1,
+                                                     sizeof (BVIEW_BST_QUERY_MATCH_t));
+  if ((NULL == candidates) || (NULL == top->matches))
+  {
+    free (candidates);
+    bst_top_query_end (top);
+    return BVIEW_STATUS_OUTOFMEMORY;
+  }
+
+  BVIEW_BST_REALM_ITER (realm)
+  {
+    if (0 == (query->realms & realm))
+    {
+      continue;
+    }
+    realmIndex = BVIEW_BST_REALM_INDEX (realm);
+    numCandidates = 0;
+
+    if (0 == query->windowSec)
+    {
+      numCandidates = cxt->latest.numEntries[realmIndex];
+      memcpy (candidates, cxt->latest.entries[realmIndex],
+              numCandidates * sizeof (BVIEW_BST_TOP_ENTRY_t));
+    }
+    else
+    {
+      /* closed slices within the window, then the open slice */
+      for (index = 0; index <= cxt->numSlices; index++)
+      {
+        slice = (index < cxt->numSlices) ?
+                &cxt->slices[(cxt->head + index) % BVIEW_BST_TOP_SLICES] : &cxt->open;
+        if ((0 == slice->numSamples) || (slice->startNs + BST_TOP_SLICE_NS <= startNs))
+        {
+          continue;
+        }
+        memcpy (&candidates[numCandidates], slice->list.entries[realmIndex],
+                slice->list.numEntries[realmIndex] * sizeof (BVIEW_BST_TOP_ENTRY_t));
+        numCandidates += slice->list.numEntries[realmIndex];
+      }
+
+      /* the max of every entry over the slices */
+      qsort (candidates, numCandidates, sizeof (BVIEW_BST_TOP_ENTRY_t), bst_top_entry_compare);
+      for (index = 0, numKept = 0; index < numCandidates; index++)
+      {
+        if ((0 == numKept) || (candidates[numKept - 1].entry != candidates[index].entry))
+        {
+          candidates[numKept++] = candidates[index];
+        }
+      }
+      numCandidates = numKept;
+    }
+
+    qsort (candidates, numCandidates, sizeof (BVIEW_BST_TOP_ENTRY_t), bst_top_value_compare);
+    count = (numCandidates < query->count) ? numCandidates : query->count;
+    for (index = 0; index < count; index++)
+    {
+      match = &top->matches[top->numMatches++];
+      match->realm = realm;
+      bst_history_entry_locate (layout, realm, candidates[index].entry,
+                                &match->port, &match->index);
+      match->numValues = 1;
+      match->values[0] = candidates[index].value;
+    }
+  }
+
+  /* the top entries of all the realms are among those of every realm */
+  if (false == query->perRealm)
+  {
+    qsort (top->matches, top->numMatches, sizeof (BVIEW_BST_QUERY_MATCH_t),
+           bst_top_match_compare);
+    if (top->numMatches > query->count)
+    {
+      top->numMatches = query->count;
+    }
+  }
+  for (index = 0; index < top->numMatches; index++)
+  {
+    top->matches[index].values[0] *= cellToByteConv;
+  }
+
+  _BST_LOG(_BST_DEBUG_TRACE, "bst top query of %u realms over %u slices, %u matches\n",
+           numRealms, top->numSlices, top->numMatches);
+  free (candidates);
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief : frees the matches of a query of the top entries
+*
+* @param[in] top : top entries
+*
+* @retval  : none
+*
+*********************************************************************/
+void bst_top_query_end (BVIEW_BST_TOP_t *top)
+{
+  if (NULL == top)
+  {
+    return;
+  }
+  free (top->matches);
+  top->matches = NULL;
+  top->numMatches = 0;
+}
@@ -0,0 +1,400 @@
+/*****************************************************************************
+  *
+  * (C) Copyright Broadcom Corporation 2015
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License");
+  * you may not use this file except in compliance with the License.
+  *
+  * You may obtain a copy of the License at
+  * http://www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ***************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <signal.h>
+#include <pthread.h>
+#include "json.h"
+#include "clear_bst_statistics.h"
+#include "clear_bst_thresholds.h"
+#include "configure_bst_thresholds.h"
+#include "configure_bst_feature.h"
+#include "configure_bst_tracking.h"
+#include "get_bst_tracking.h"
+#include "get_bst_feature.h"
+#include "get_bst_thresholds.h"
+#include "get_bst_report.h"
+#include "bst_json_encoder.h"
+#include "bst.h"
+#include "broadview.h"
+#include "bst_app.h"
+#include "system.h"
+#include "openapps_log_api.h"
+
+/* BST Context Info*/
+extern BVIEW_BST_CXT_t bst_info;
+
+/* one token of the bucket, tokens are kept in thousandths */
+#define BVIEW_BST_TRIGGER_TOKEN   1000
+
+#define BST_TRIGGER_CXT_GET(_unit)  &bst_info.unit[_unit].trigger
+
+/*********************************************************************
+* @brief : returns the monotonic time in milli seconds
+*
+* @retval  : time in milli seconds
+*
+*********************************************************************/
+static uint64_t bst_trigger_time_ms (void)
+{
+  struct timespec ts;
+
+  clock_gettime (CLOCK_MONOTONIC, &ts);
+  return ((uint64_t) ts.tv_sec * 1000) + (ts.tv_nsec / 1000000);
+}
+
+/*********************************************************************
+* @brief : refills the token bucket for the time elapsed since the
+*          last refill
+*
+* @param[in] cxt : trigger state of the unit
+*
+* @retval  : none
+*
+* @note : caller holds the trigger lock.
+*
+*********************************************************************/
+static void bst_trigger_refill (BVIEW_BST_TRIGGER_CXT_t *cxt)
+{
+  uint64_t now, capacity;
+
+  now = bst_trigger_time_ms ();
+  capacity = (uint64_t) cxt->burst * BVIEW_BST_TRIGGER_TOKEN;
+
+  /* rateLimit tokens per second is rateLimit thousandths per milli second */
+  cxt->tokens += (now - cxt->lastRefill) * cxt->rateLimit;
+  if (cxt->tokens > capacity)
+  {
+    cxt->tokens = capacity;
+  }
+  cxt->lastRefill = now;
+}
+
+/*********************************************************************
+* @brief : posts the trigger report of the open window to bst application
+*
+* @param[in] cxt : trigger state of the unit
+*
+* @retval  : BVIEW_STATUS_SUCCESS : message is successfully posted to bst.
+* @retval  : BVIEW_STATUS_FAILURE : failed to post message to bst.
+*
+* @note : caller holds the trigger lock. The trigger info is collected
+*         by the bst application with bst_trigger_take. If the post fails,
+*         the window is closed so that the next trigger opens a new one.
+*
+*********************************************************************/
+static BVIEW_STATUS bst_trigger_post (BVIEW_BST_TRIGGER_CXT_t *cxt)
+{
+  BVIEW_BST_REQUEST_MSG_t msg_data;
+  BVIEW_STATUS rv;
+
+  memset (&msg_data, 0, sizeof (BVIEW_BST_REQUEST_MSG_t));
+  msg_data.unit = cxt->unit;
+  msg_data.msg_type = BVIEW_BST_CMD_API_TRIGGER_REPORT;
+  msg_data.report_type = BVIEW_BST_STATS_TRIGGER;
+
+  /* Send the message to the bst application */
+  rv = bst_send_request (&msg_data);
+  if (BVIEW_STATUS_SUCCESS != rv)
+  {
+    cxt->pending = false;
+    cxt->stats.numDropped++;
+    LOG_POST (BVIEW_LOG_ERROR,
+        "Failed to send trigger report message to bst application. err = %d\r\n", rv);
+    return BVIEW_STATUS_FAILURE;
+  }
+  cxt->stats.numReports++;
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+*  @brief:  callback function closing the trigger coalesce window
+*
+* @param[in]   sigval : Data passed with notification after timer expires
+*
+* @retval  : BVIEW_STATUS_SUCCESS : message is successfully posted to bst.
+* @retval  : BVIEW_STATUS_FAILURE : failed to post message to bst.
+*
+* @note : invoked in the timer context. The parameter returned from
+*         the callback is the reference to unit id.
+*
+*********************************************************************/
+static BVIEW_STATUS bst_trigger_window_cb (union sigval sigval)
+{
+  BVIEW_BST_TRIGGER_CXT_t *cxt;
+  BVIEW_STATUS rv = BVIEW_STATUS_SUCCESS;
+  unsigned int unit;
+
+  unit = *(unsigned int *) sigval.sival_ptr;
+  if (unit >= BVIEW_BST_MAX_UNITS)
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+  cxt = BST_TRIGGER_CXT_GET (unit);
+
+  pthread_mutex_lock (&cxt->lock);
+  if (true == cxt->pending)
+  {
+    rv = bst_trigger_post (cxt);
+  }
+  pthread_mutex_unlock (&cxt->lock);
+  return rv;
+}
+
+/*********************************************************************
+* @brief : initializes the trigger admission state of a unit
+*
+* @param[in] unit : unit id
+*
+* @retval  : BVIEW_STATUS_SUCCESS : trigger state is initialized.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+*********************************************************************/
+BVIEW_STATUS bst_trigger_init (unsigned int unit)
+{
+  BVIEW_BST_TRIGGER_CXT_t *cxt;
+
+  if (unit >= BVIEW_BST_MAX_UNITS)
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+  cxt = BST_TRIGGER_CXT_GET (unit);
+
+  memset (cxt, 0, sizeof (BVIEW_BST_TRIGGER_CXT_t));
+  pthread_mutex_init (&cxt->lock, NULL);
+  cxt->unit = unit;
+  cxt->coalesceInterval = BVIEW_BST_DEFAULT_TRIGGER_COALESCE_INTERVAL;
+  cxt->rateLimit = BVIEW_BST_DEFAULT_TRIGGER_RATE_LIMIT;
+  cxt->burst = BVIEW_BST_DEFAULT_TRIGGER_BURST;
+  cxt->tokens = (uint64_t) cxt->burst * BVIEW_BST_TRIGGER_TOKEN;
+  cxt->lastRefill = bst_trigger_time_ms ();
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief : releases the trigger admission state of a unit
+*
+* @param[in] unit : unit id
+*
+* @retval  : none
+*
+* @note    : deletes the coalesce window timer, if any.
+*
+*********************************************************************/
+void bst_trigger_uninit (unsigned int unit)
+{
+  BVIEW_BST_TRIGGER_CXT_t *cxt;
+
+  if (unit >= BVIEW_BST_MAX_UNITS)
+  {
+    return;
+  }
+  cxt = BST_TRIGGER_CXT_GET (unit);
+
+  if (true == cxt->timerInUse)
+  {
+    system_timer_delete (cxt->windowTimer);
+    cxt->timerInUse = false;
+  }
+  pthread_mutex_destroy (&cxt->lock);
+}
+
+/*********************************************************************
+* @brief : sets the trigger coalesce and rate limit parameters
+*
+* @param[in] unit : unit id
+* @param[in] coalesceInterval : coalesce window in milli seconds
+* @param[in] rateLimit : trigger reports per second, 0 is unlimited
+* @param[in] burst : trigger reports allowed back to back
+*
+* @retval  : BVIEW_STATUS_SUCCESS : parameters are applied.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : the token bucket is refilled to the new burst.
+*
+*********************************************************************/
+BVIEW_STATUS bst_trigger_config_set (unsigned int unit, int coalesceInterval,
+                                     int rateLimit, int burst)
+{
+  BVIEW_BST_TRIGGER_CXT_t *cxt;
+
+  if ((unit >= BVIEW_BST_MAX_UNITS) || (coalesceInterval < 0) ||
+      (rateLimit < 0) || (burst < 1))
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+  cxt = BST_TRIGGER_CXT_GET (unit);
+
+  pthread_mutex_lock (&cxt->lock);
+  cxt->coalesceInterval = coalesceInterval;
+  cxt->rateLimit = rateLimit;
+  cxt->burst = burst;
+  cxt->tokens = (uint64_t) burst * BVIEW_BST_TRIGGER_TOKEN;
+  cxt->lastRefill = bst_trigger_time_ms ();
+  pthread_mutex_unlock (&cxt->lock);
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief : admits a trigger raised by the asic
+*
+* @param[in] unit : unit id
+* @param[in] triggerInfo : counter which raised the trigger
+*
+* @retval  : BVIEW_STATUS_SUCCESS : trigger is posted, merged or dropped.
+* @retval  : BVIEW_STATUS_FAILURE : failed to post the trigger report.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : invoked in the asic context. A trigger raised while a report
+*            is pending is merged into it. Otherwise a token is taken and
+*            the report is posted once the coalesce window closes.
+*
+*********************************************************************/
+BVIEW_STATUS bst_trigger_admit (unsigned int unit,
+                                BVIEW_BST_TRIGGER_INFO_t *triggerInfo)
+{
+  BVIEW_BST_TRIGGER_CXT_t *cxt;
+  BVIEW_STATUS rv = BVIEW_STATUS_SUCCESS;
+
+  if ((unit >= BVIEW_BST_MAX_UNITS) || (NULL == triggerInfo))
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+  cxt = BST_TRIGGER_CXT_GET (unit);
+
+  pthread_mutex_lock (&cxt->lock);
+  cxt->stats.numTriggers++;
+
+  if (true == cxt->pending)
+  {
+    /* a report is on its way, it reads the realm of this trigger as well */
+    cxt->realms |= triggerInfo->realm;
+    cxt->stats.numCoalesced++;
+    pthread_mutex_unlock (&cxt->lock);
+    return BVIEW_STATUS_SUCCESS;
+  }
+
+  if (0 != cxt->rateLimit)
+  {
+    bst_trigger_refill (cxt);
+    if (cxt->tokens < BVIEW_BST_TRIGGER_TOKEN)
+    {
+      cxt->stats.numDropped++;
+      pthread_mutex_unlock (&cxt->lock);
+      return BVIEW_STATUS_SUCCESS;
+    }
+    cxt->tokens -= BVIEW_BST_TRIGGER_TOKEN;
+  }
+
+  /* open a new window */
+  cxt->pending = true;
+  cxt->first = *triggerInfo;
+  cxt->realms = triggerInfo->realm;
+
+  if (0 == cxt->coalesceInterval)
+  {
+    rv = bst_trigger_post (cxt);
+  }
+  else
+  {
+    if (true == cxt->timerInUse)
+    {
+      rv = system_timer_set (cxt->windowTimer, cxt->coalesceInterval,
+                             NON_PERIODIC_MODE);
+    }
+    else
+    {
+      rv = system_timer_add (bst_trigger_window_cb, &cxt->windowTimer,
+                             cxt->coalesceInterval, NON_PERIODIC_MODE,
+                             &cxt->unit);
+      if (BVIEW_STATUS_SUCCESS == rv)
+      {
+        cxt->timerInUse = true;
+      }
+    }
+
+    if (BVIEW_STATUS_SUCCESS != rv)
+    {
+      /* no window, report the trigger right away */
+      LOG_POST (BVIEW_LOG_ERROR,
+          "Failed to start trigger coalesce timer for unit %d, err %d \r\n", unit, rv);
+      rv = bst_trigger_post (cxt);
+    }
+  }
+  pthread_mutex_unlock (&cxt->lock);
+  return rv;
+}
+
+/*********************************************************************
+* @brief : collects the pending trigger of a unit into the request
+*
+* @param[in,out] msg_data : trigger report request
+*
+* @retval  : BVIEW_STATUS_SUCCESS : trigger info is copied.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+* @note    : invoked in the bst context, reopens the admission of triggers.
+*
+*********************************************************************/
+BVIEW_STATUS bst_trigger_take (BVIEW_BST_REQUEST_MSG_t *msg_data)
+{
+  BVIEW_BST_TRIGGER_CXT_t *cxt;
+
+  if ((NULL == msg_data) || (msg_data->unit < 0) ||
+      (msg_data->unit >= BVIEW_BST_MAX_UNITS))
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+  cxt = BST_TRIGGER_CXT_GET (msg_data->unit);
+
+  pthread_mutex_lock (&cxt->lock);
+  msg_data->trigger = cxt->first;
+  msg_data->trigger_realms = cxt->realms;
+  cxt->pending = false;
+  pthread_mutex_unlock (&cxt->lock);
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief : reads the trigger counters of a unit
+*
+* @param[in] unit : unit id
+* @param[out] stats : trigger counters
+*
+* @retval  : BVIEW_STATUS_SUCCESS : counters are copied.
+* @retval  : BVIEW_STATUS_INVALID_PARAMETER : invalid parameter.
+*
+*********************************************************************/
+BVIEW_STATUS bst_trigger_stats_get (unsigned int unit,
+                                    BVIEW_BST_TRIGGER_STATS_t *stats)
+{
+  BVIEW_BST_TRIGGER_CXT_t *cxt;
+
+  if ((unit >= BVIEW_BST_MAX_UNITS) || (NULL == stats))
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+  cxt = BST_TRIGGER_CXT_GET (unit);
+
+  pthread_mutex_lock (&cxt->lock);
+  *stats = cxt->stats;
+  pthread_mutex_unlock (&cxt->lock);
+  return BVIEW_STATUS_SUCCESS;
+}
@@ -21,20 +21,288 @@
 #include <stdio.h>
 #include <string.h>
 #include <errno.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/epoll.h>
+#include <sys/timerfd.h>
 #include "system.h"
 #include "openapps_log_api.h"
 
 #define CONVERSION_FACTOR 1000000L
 
+/* Maximum number of timers served by the scheduler */
+#define SYSTEM_TIMER_MAX_JOBS    64
+
+/* Nano seconds in a second */
+#define SYSTEM_TIMER_NSEC_PER_SEC   1000000000ULL
+
+/* timer_t handed to the callers is the job index + 1 */
+#define SYSTEM_TIMER_ID_TO_INDEX(_id)     ((uintptr_t) (_id) - 1)
+#define SYSTEM_TIMER_INDEX_TO_ID(_index)  ((timer_t) ((uintptr_t) (_index) + 1))
+
+/* Callback of a timer, the same as the one of a SIGEV_THREAD timer */
+typedef void (*SYSTEM_TIMER_HANDLER_t) (union sigval sigval);
+
+/* One timer of the scheduler */
+typedef struct _system_timer_job_
+{
+  bool inUse;
+  /* armed timers have a deadline */
+  bool armed;
+  SYSTEM_TIMER_HANDLER_t handler;
+  void *param;
+  /* period in nano seconds, 0 for a one shot timer */
+  uint64_t period;
+  /* next expiry, absolute CLOCK_MONOTONIC time in nano seconds */
+  uint64_t deadline;
+  /* expiries are aligned to CLOCK_REALTIME multiples of the period */
+  bool aligned;
+  /* offset of the expiries from the wall clock boundary, in nano seconds */
+  uint64_t offset;
+  /* wall clock time of the next expiry of an aligned timer */
+  uint64_t boundary;
+} SYSTEM_TIMER_JOB_t;
+
+/* Timer scheduler. One thread waits on a timerfd which is always
+   programmed with the earliest deadline of the armed timers */
+typedef struct _system_timer_sched_
+{
+  /* protects the jobs and the timerfd programming */
+  pthread_mutex_t lock;
+  pthread_t thread;
+  int epollFd;
+  int timerFd;
+  BVIEW_STATUS initStatus;
+  SYSTEM_TIMER_JOB_t job[SYSTEM_TIMER_MAX_JOBS];
+} SYSTEM_TIMER_SCHED_t;
+
+static SYSTEM_TIMER_SCHED_t timerSched = { .lock = PTHREAD_MUTEX_INITIALIZER };
+static pthread_once_t timerSchedOnce = PTHREAD_ONCE_INIT;
+
+/*********************************************************************
+* @brief      Function used to read the monotonic clock
+*
+* @retval     time in nano seconds
+*
+* @end
+*********************************************************************/
+static uint64_t system_timer_now (void)
+{
+  struct timespec ts;
+
+  clock_gettime (CLOCK_MONOTONIC, &ts);
+  return ((uint64_t) ts.tv_sec * SYSTEM_TIMER_NSEC_PER_SEC) + (uint64_t) ts.tv_nsec;
+}
+
+/*********************************************************************
+* @brief      Function used to move an aligned timer to its next
+*             wall clock boundary
+*
+* @param[in]  job  aligned timer
+*
+* @note       Caller holds the scheduler lock. The deadline is derived
+*             from the wall clock on every expiry, so that the expiries
+*             follow the wall clock as it is adjusted. Boundaries which
+*             are already past are skipped.
+*
+* @end
+*********************************************************************/
+static void system_timer_align (SYSTEM_TIMER_JOB_t *job)
+{
+  struct timespec ts;
+  uint64_t realNow, monoNow;
+
+  monoNow = system_timer_now ();
+  clock_gettime (CLOCK_REALTIME, &ts);
+  realNow = ((uint64_t) ts.tv_sec * SYSTEM_TIMER_NSEC_PER_SEC) + (uint64_t) ts.tv_nsec;
+
+  if (job->boundary != 0)
+  {
+    job->boundary += job->period;
+  }
+  if (job->boundary <= realNow)
+  {
+    job->boundary = (((realNow - job->offset) / job->period) + 1) * job->period +
+                    job->offset;
+  }
+  job->deadline = monoNow + (job->boundary - realNow);
+}
+
+/*********************************************************************
+* @brief      Function used to program the timerfd with the earliest
+*             deadline of the armed timers
+*
+* @note       Caller holds the scheduler lock. The timerfd is disarmed
+*             when no timer is armed.
+*
+* @end
+*********************************************************************/
+static void system_timer_rearm (void)
+{
+  struct itimerspec timerVal;
+  uint64_t earliest = 0;
+  unsigned int index;
+
+  for (index = 0; index < SYSTEM_TIMER_MAX_JOBS; index++)
+  {
+    if ((timerSched.job[index].armed == true) &&
+        ((earliest == 0) || (timerSched.job[index].deadline < earliest)))
+    {
+      earliest = timerSched.job[index].deadline;
+    }
+  }
+
+  memset (&timerVal, 0, sizeof (timerVal));
+  timerVal.it_value.tv_sec = earliest / SYSTEM_TIMER_NSEC_PER_SEC;
+  timerVal.it_value.tv_nsec = earliest % SYSTEM_TIMER_NSEC_PER_SEC;
+  if (timerfd_settime (timerSched.timerFd, TFD_TIMER_ABSTIME, &timerVal, NULL) != 0)
+  {
+    LOG_POST (BVIEW_LOG_ERROR, "Timer scheduler rearm failed, Error no : %d\r\n", errno);
+  }
+}
+
+/*********************************************************************
+* @brief      Timer scheduler thread
+*
+* @param[in]  arg  unused
+*
+* @note       Collects the expired timers under the lock, moves periodic
+*             timers to their next deadline and invokes the callbacks
+*             after releasing the lock, so that a callback can add, set
+*             or delete timers. Deadlines of periodic timers advance by
+*             whole periods from the previous deadline, so they do not
+*             drift with the callback latency. A period missed entirely
+*             is skipped.
+*
+* @end
+*********************************************************************/
+static void *system_timer_thread (void *arg)
+{
+  struct epoll_event event;
+  SYSTEM_TIMER_HANDLER_t handler[SYSTEM_TIMER_MAX_JOBS];
+  union sigval sigval[SYSTEM_TIMER_MAX_JOBS];
+  SYSTEM_TIMER_JOB_t *job;
+  unsigned int index, numDue;
+  uint64_t expirations, now;
+
+  while (1)
+  {
+    if (epoll_wait (timerSched.epollFd, &event, 1, -1) <= 0)
+    {
+      continue;
+    }
+    /* the timerfd is non blocking, it may have been reprogrammed
+       since it woke us up */
+    if (read (timerSched.timerFd, &expirations, sizeof (expirations)) < 0)
+    {
+      continue;
+    }
+
+    numDue = 0;
+    now = system_timer_now ();
+    pthread_mutex_lock (&timerSched.lock);
+    for (index = 0; index < SYSTEM_TIMER_MAX_JOBS; index++)
+    {
+      job = &timerSched.job[index];
+      if ((job->armed == false) || (job->deadline > now))
+      {
+        continue;
+      }
+      handler[numDue] = job->handler;
+      sigval[numDue].sival_ptr = job->param;
+      numDue++;
+
+      if (job->period == 0)
+      {
+        job->armed = false;
+        continue;
+      }
+      if (job->aligned == true)
+      {
+        system_timer_align (job);
+        continue;
+      }
+      job->deadline += job->period;
+      while (job->deadline <= now)
+      {
+        job->deadline += job->period;
+      }
+    }
+    system_timer_rearm ();
+    pthread_mutex_unlock (&timerSched.lock);
+
+    for (index = 0; index < numDue; index++)
+    {
+      handler[index] (sigval[index]);
+    }
+  }
+  return NULL;
+}
+
+/*********************************************************************
+* @brief      Function used to start the timer scheduler
+*
+* @note       Invoked once, on the first timer add
+*
+* @end
+*********************************************************************/
+static void system_timer_sched_init (void)
+{
+  struct epoll_event event;
+  pthread_attr_t attr;
+
+  timerSched.initStatus = BVIEW_STATUS_FAILURE;
+
+  timerSched.timerFd = timerfd_create (CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+  if (timerSched.timerFd < 0)
+  {
+    LOG_POST (BVIEW_LOG_ERROR, "Timer scheduler timerfd create failed, Error no : %d\r\n", errno);
+    return;
+  }
+
+  timerSched.epollFd = epoll_create1 (EPOLL_CLOEXEC);
+  if (timerSched.epollFd < 0)
+  {
+    LOG_POST (BVIEW_LOG_ERROR, "Timer scheduler epoll create failed, Error no : %d\r\n", errno);
+    close (timerSched.timerFd);
+    return;
+  }
+
+  memset (&event, 0, sizeof (event));
+  event.events = EPOLLIN;
+  event.data.fd = timerSched.timerFd;
+  if (epoll_ctl (timerSched.epollFd, EPOLL_CTL_ADD, timerSched.timerFd, &event) != 0)
+  {
+    LOG_POST (BVIEW_LOG_ERROR, "Timer scheduler epoll add failed, Error no : %d\r\n", errno);
+    close (timerSched.epollFd);
+    close (timerSched.timerFd);
+    return;
+  }
+
+  pthread_attr_init (&attr);
+  pthread_attr_setdetachstate (&attr, PTHREAD_CREATE_DETACHED);
+  if (pthread_create (&timerSched.thread, &attr, system_timer_thread, NULL) != 0)
+  {
+    LOG_POST (BVIEW_LOG_ERROR, "Timer scheduler thread create failed, Error no : %d\r\n", errno);
+    pthread_attr_destroy (&attr);
+    close (timerSched.epollFd);
+    close (timerSched.timerFd);
+    return;
+  }
+  pthread_attr_destroy (&attr);
+
+  timerSched.initStatus = BVIEW_STATUS_SUCCESS;
+}
+
 /*********************************************************************
 * @brief         Function used to create and arm a timer
 *
 *
 * @param[in]     handler        function pointer to handle the callback
 *                               The callback function address is passed
-*                               using a void * because the function declared
-*                               in linux "sigev_notify_function" has a 
-*                               return type "void"  
+*                               using a void * because the callback is
+*                               declared with a return type "void"  
 * @param[in,out] timerId        timerId of the timer which is created
 * @param[in]     timeInMilliSec Time after which callback is required
 * @param[in]     mode           mode specifing if the timer must be
@@ -44,7 +312,8 @@
 * @retval        BVIEW_STATUS_SUCCESS
 * @retval        BVIEW_STATUS_FAILURE
 *
-* @note          NA
+* @note          The callback is invoked in the timer scheduler thread
+*                with param in sival_ptr, and must not block.
 *
 * @end
 *********************************************************************/
@@ -52,9 +321,7 @@
 
 BVIEW_STATUS system_timer_add(void * handler,timer_t * timerId, int timeInMilliSec, TIMER_MODE mode, void * param)
 {
-  struct sigevent sigTime;
-  struct timespec monotonic_time;
-  clockid_t clock;
+  unsigned int index;
   int ret = BVIEW_STATUS_SUCCESS;
   /*Validate callback function pointers*/
   if (handler == NULL)
@@ -70,32 +337,40 @@ BVIEW_STATUS system_timer_add(void * handler,timer_t * timerId, int timeInMilliS
     return BVIEW_STATUS_FAILURE;
   }
 
-  /*Populate the structures in-order to create the timer*/
-  memset(&sigTime, 0,sizeof(struct sigevent)); 
-  sigTime.sigev_notify = SIGEV_THREAD;
-  sigTime.sigev_notify_attributes = NULL;
-  sigTime.sigev_notify_function = handler;
-  sigTime.sigev_value.sival_ptr = param;
-  /*Monotonic clock is used if available else realtime clock is used*/ 
-  if (!clock_gettime(CLOCK_MONOTONIC, &monotonic_time)) 
-   {
-     clock = CLOCK_MONOTONIC;
-   } 
-   else 
-   {
-     clock = CLOCK_REALTIME;
-   }
+  /*Scheduler thread is started with the first timer*/
+  pthread_once (&timerSchedOnce, system_timer_sched_init);
+  if (timerSched.initStatus != BVIEW_STATUS_SUCCESS)
+  {
+    return BVIEW_STATUS_FAILURE;
+  }
 
   /*Timer is created*/
-  if (timer_create(clock, &sigTime, timerId) == 0)
-   {
-     ret = system_timer_set(*timerId,timeInMilliSec,mode); 
-   }
-   else 
-   {
-     LOG_POST (BVIEW_LOG_ERROR, "Timer Creation Failed Error no : %d\r\n",errno);
-     ret = BVIEW_STATUS_FAILURE;
-   }
+  pthread_mutex_lock (&timerSched.lock);
+  for (index = 0; index < SYSTEM_TIMER_MAX_JOBS; index++)
+  {
+    if (timerSched.job[index].inUse == false)
+    {
+      break;
+    }
+  }
+  if (index == SYSTEM_TIMER_MAX_JOBS)
+  {
+    pthread_mutex_unlock (&timerSched.lock);
+    LOG_POST (BVIEW_LOG_ERROR, "Timer Creation Failed, no free timer\r\n");
+    return BVIEW_STATUS_FAILURE;
+  }
+  memset (&timerSched.job[index], 0, sizeof (SYSTEM_TIMER_JOB_t));
+  timerSched.job[index].inUse = true;
+  timerSched.job[index].handler = (SYSTEM_TIMER_HANDLER_t) handler;
+  timerSched.job[index].param = param;
+  *timerId = SYSTEM_TIMER_INDEX_TO_ID (index);
+  pthread_mutex_unlock (&timerSched.lock);
+
+  ret = system_timer_set(*timerId,timeInMilliSec,mode); 
+  if (ret != BVIEW_STATUS_SUCCESS)
+  {
+    system_timer_delete (*timerId);
+  }
   return ret;
 }
 
@@ -108,7 +383,8 @@ BVIEW_STATUS system_timer_add(void * handler,timer_t * timerId, int timeInMilliS
 * @retval     BVIEW_STATUS_SUCCESS
 * @retval     BVIEW_STATUS_FAILURE
 *
-* @note          NA
+* @note       A callback which has already expired may still be
+*             invoked once after the timer is destroyed
 *
 * @end
 *********************************************************************/
@@ -116,11 +392,21 @@ BVIEW_STATUS system_timer_add(void * handler,timer_t * timerId, int timeInMilliS
 
 BVIEW_STATUS system_timer_delete(timer_t timerId)
 {
+  uintptr_t index = SYSTEM_TIMER_ID_TO_INDEX (timerId);
   int ret = BVIEW_STATUS_SUCCESS;
-  if ((timer_delete(timerId)) !=0)
+
+  pthread_mutex_lock (&timerSched.lock);
+  if ((index >= SYSTEM_TIMER_MAX_JOBS) || (timerSched.job[index].inUse == false))
   {
     ret = BVIEW_STATUS_FAILURE;
   }
+  else
+  {
+    timerSched.job[index].inUse = false;
+    timerSched.job[index].armed = false;
+    system_timer_rearm ();
+  }
+  pthread_mutex_unlock (&timerSched.lock);
   return ret;
 }
 
@@ -137,7 +423,9 @@ BVIEW_STATUS system_timer_delete(timer_t timerId)
 * @retval     BVIEW_STATUS_SUCCESS
 * @retval     BVIEW_STATUS_FAILURE
 *
-* @note       NA
+* @note       The first expiry is timeInMilliSec from now, a time of
+*             zero disarms the timer. An aligned timer is no longer
+*             aligned once it is set.
 *
 * @end
 *********************************************************************/
@@ -145,25 +433,97 @@ BVIEW_STATUS system_timer_delete(timer_t timerId)
 
 BVIEW_STATUS system_timer_set(timer_t timerId,int timeInMilliSec,TIMER_MODE mode)
 {
+  uintptr_t index = SYSTEM_TIMER_ID_TO_INDEX (timerId);
+  SYSTEM_TIMER_JOB_t *job;
+  uint64_t interval;
   int ret = BVIEW_STATUS_SUCCESS;
-  struct itimerspec timerVal;
-  timerVal.it_value.tv_sec = timeInMilliSec / 1000;
-  timerVal.it_value.tv_nsec = (long)(timeInMilliSec % 1000) * CONVERSION_FACTOR;
+
+  if (timeInMilliSec < 0)
+  {
+    LOG_POST (BVIEW_LOG_ERROR, "Timer Initialization Failed, invalid time %d\r\n", timeInMilliSec);
+    return BVIEW_STATUS_FAILURE;
+  }
+  interval = (uint64_t) timeInMilliSec * CONVERSION_FACTOR;
+
+  pthread_mutex_lock (&timerSched.lock);
+  if ((index >= SYSTEM_TIMER_MAX_JOBS) || (timerSched.job[index].inUse == false))
+  {
+    pthread_mutex_unlock (&timerSched.lock);
+    LOG_POST (BVIEW_LOG_ERROR, "Timer Initialization Failed, invalid timer\r\n");
+    return BVIEW_STATUS_FAILURE;
+  }
+  job = &timerSched.job[index];
   if (mode == PERIODIC_MODE)/*Timer is triggered periodically*/
   {
-    timerVal.it_interval.tv_sec = timerVal.it_value.tv_sec;
-    timerVal.it_interval.tv_nsec = timerVal.it_value.tv_nsec;
+    job->period = interval;
   }
   else/*Timer is triggered only once, but timer is not destroyed*/
   {
-    timerVal.it_interval.tv_sec = 0;
-    timerVal.it_interval.tv_nsec = 0;
+    job->period = 0;
   }
   /*Timer is set*/
-  if (timer_settime(timerId, 0, &timerVal, NULL) != 0)
+  job->aligned = false;
+  job->armed = (interval != 0) ? true : false;
+  job->deadline = system_timer_now () + interval;
+  system_timer_rearm ();
+  pthread_mutex_unlock (&timerSched.lock);
+  return ret;
+}
+
+/*********************************************************************
+* @brief         Function used to create a periodic timer aligned to
+*                the wall clock
+*
+*
+* @param[in]     handler        function pointer to handle the callback
+* @param[in,out] timerId        timerId of the timer which is created
+* @param[in]     periodInMilliSec  Period of the timer
+* @param[in]     offsetInMilliSec  Offset of the expiries from the 
+*                               wall clock multiples of the period
+* @param[in]     param          Arguments passed from the calling function
+*
+* @retval        BVIEW_STATUS_SUCCESS
+* @retval        BVIEW_STATUS_FAILURE
+*
+* @note          With a period of 1000 and an offset of 250 the timer
+*                expires at every second of the wall clock plus 250 ms.
+*                Timers of different units and of different systems
+*                with synchronized clocks expire together.
+*
+* @end
+*********************************************************************/
+
+
+BVIEW_STATUS system_timer_add_aligned(void * handler,timer_t * timerId, int periodInMilliSec, int offsetInMilliSec, void * param)
+{
+  uintptr_t index;
+  SYSTEM_TIMER_JOB_t *job;
+  int ret;
+
+  if ((periodInMilliSec <= 0) || (offsetInMilliSec < 0))
   {
-    LOG_POST (BVIEW_LOG_ERROR, "Timer Initialization Failed, Error no : %d\r\n",errno);
-    ret = BVIEW_STATUS_FAILURE;
+    LOG_POST (BVIEW_LOG_ERROR, "Invalid period %d or offset %d during timer registration\r\n",
+              periodInMilliSec, offsetInMilliSec);
+    return BVIEW_STATUS_FAILURE;
   }
-  return ret;
+
+  /*Timer is created disarmed and then aligned*/
+  ret = system_timer_add (handler, timerId, 0, PERIODIC_MODE, param);
+  if (ret != BVIEW_STATUS_SUCCESS)
+  {
+    return ret;
+  }
+
+  index = SYSTEM_TIMER_ID_TO_INDEX (*timerId);
+  pthread_mutex_lock (&timerSched.lock);
+  job = &timerSched.job[index];
+  job->period = (uint64_t) periodInMilliSec * CONVERSION_FACTOR;
+  job->offset = ((uint64_t) offsetInMilliSec * CONVERSION_FACTOR) % job->period;
+  job->aligned = true;
+  job->boundary = 0;
+  system_timer_align (job);
+  job->armed = true;
+  system_timer_rearm ();
+  pthread_mutex_unlock (&timerSched.lock);
+  return BVIEW_STATUS_SUCCESS;
 }
@@ -34,6 +34,8 @@ extern "C"
 
 #define REST_MAX_STRING_LENGTH      128
 #define REST_MAX_HTTP_BUFFER_LENGTH 2048
+/* request buffer of a session, sized for bulk configuration requests */
+#define REST_MAX_HTTP_REQUEST_LENGTH (128 * 1024)
 
 #define REST_MAX_SESSIONS    5
 
@@ -80,7 +82,7 @@ typedef struct _rest_session_
     int connectionFd;
 
     /* buffer to store the HTTP request message */
-    char buffer[REST_MAX_HTTP_BUFFER_LENGTH + 1];
+    char buffer[REST_MAX_HTTP_REQUEST_LENGTH + 1];
 
     /* data length */
     int length;
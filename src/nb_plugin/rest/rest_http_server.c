@@ -223,7 +223,7 @@ static BVIEW_STATUS rest_process_http_request (REST_CONTEXT_t *rest,
        break;
      }
 
-     temp = read(fd, (buf + length), (REST_MAX_HTTP_BUFFER_LENGTH - length));
+     temp = read(fd, (buf + length), (REST_MAX_HTTP_REQUEST_LENGTH - length));
      if (temp < 0)
      {
        if (errno == EINTR)
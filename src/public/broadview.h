@@ -96,6 +96,27 @@ extern "C"
 #endif
 #endif
 
+ /** High resolution time stamp, in nano seconds.
+     monotonic orders and measures the samples,
+     realtime correlates them with the wall clock */
+    typedef struct _bview_hr_time_
+    {
+      uint64_t monotonic;
+      uint64_t realtime;
+    } BVIEW_HR_TIME_t;
+
+ /** Macro to read both the clocks into a BVIEW_HR_TIME_t */
+#define BVIEW_HR_TIME_GET(_hrTime)                                         \
+          do {                                                             \
+            struct timespec _ts;                                           \
+            clock_gettime (CLOCK_MONOTONIC, &_ts);                         \
+            (_hrTime)->monotonic = ((uint64_t) _ts.tv_sec * 1000000000ULL) \
+                                   + (uint64_t) _ts.tv_nsec;               \
+            clock_gettime (CLOCK_REALTIME, &_ts);                          \
+            (_hrTime)->realtime = ((uint64_t) _ts.tv_sec * 1000000000ULL)  \
+                                  + (uint64_t) _ts.tv_nsec;                \
+          } while (0)
+
 #ifdef __cplusplus
 }
 #endif
@@ -185,6 +185,235 @@ typedef struct _bst_asic_data_snapshot_
 
 } BVIEW_BST_ASIC_SNAPSHOT_DATA_t;
 
+/* Realms of a snapshot. Used to select the realms to be read from asic */
+typedef enum _bst_realm_
+{
+    BVIEW_BST_REALM_DEVICE = (0x1 << 0),
+    BVIEW_BST_REALM_INGRESS_PORT_PG = (0x1 << 1),
+    BVIEW_BST_REALM_INGRESS_PORT_SP = (0x1 << 2),
+    BVIEW_BST_REALM_INGRESS_SP = (0x1 << 3),
+    BVIEW_BST_REALM_EGRESS_PORT_SP = (0x1 << 4),
+    BVIEW_BST_REALM_EGRESS_SP = (0x1 << 5),
+    BVIEW_BST_REALM_EGRESS_UC_QUEUE = (0x1 << 6),
+    BVIEW_BST_REALM_EGRESS_UC_QUEUEGROUPS = (0x1 << 7),
+    BVIEW_BST_REALM_EGRESS_MC_QUEUE = (0x1 << 8),
+    BVIEW_BST_REALM_EGRESS_CPU_QUEUE = (0x1 << 9),
+    BVIEW_BST_REALM_EGRESS_RQE_QUEUE = (0x1 << 10)
+
+} BVIEW_BST_REALM_t;
+
+/* Mask of BVIEW_BST_REALM_t values */
+typedef unsigned int BVIEW_BST_REALM_MASK_t;
+
+/* Number of realms of a snapshot */
+#define BVIEW_BST_NUM_REALMS       11
+
+/* Mask selecting all the realms of a snapshot */
+#define BVIEW_BST_REALM_ALL        ((0x1 << BVIEW_BST_NUM_REALMS) - 1)
+
+/* Position of a realm in the arrays kept per realm */
+#define BVIEW_BST_REALM_INDEX(_realm)   (__builtin_ctz ((unsigned int) (_realm)))
+
+/* Sampling window of one realm of a snapshot. A realm which is
+ * not read keeps a zero end time
+ */
+typedef struct _bst_realm_time_
+{
+    BVIEW_HR_TIME_t start;
+    BVIEW_HR_TIME_t end;
+
+} BVIEW_BST_REALM_TIME_t;
+
+/* Macro to iterate all the realms of a snapshot */
+#define BVIEW_BST_REALM_ITER(_realm)                                     \
+              for ((_realm) = BVIEW_BST_REALM_DEVICE;                    \
+                   ((_realm) & BVIEW_BST_REALM_ALL) != 0;                \
+                   (_realm) = (BVIEW_BST_REALM_t) ((_realm) << 1))
+
+/* Counter arrays of a compact snapshot, one per counter of a realm entry */
+typedef enum _bst_counter_
+{
+    BVIEW_BST_CNT_DEVICE = 0,
+    BVIEW_BST_CNT_IPPG_UM_SHARE,
+    BVIEW_BST_CNT_IPPG_UM_HEADROOM,
+    BVIEW_BST_CNT_IPSP_UM_SHARE,
+    BVIEW_BST_CNT_ISP_UM_SHARE,
+    BVIEW_BST_CNT_EPSP_UC_SHARE,
+    BVIEW_BST_CNT_EPSP_UM_SHARE,
+    BVIEW_BST_CNT_EPSP_MC_SHARE,
+    BVIEW_BST_CNT_EPSP_MC_SHARE_QENTRIES,
+    BVIEW_BST_CNT_ESP_UM_SHARE,
+    BVIEW_BST_CNT_ESP_MC_SHARE,
+    BVIEW_BST_CNT_ESP_MC_SHARE_QENTRIES,
+    BVIEW_BST_CNT_EUCQ_UC,
+    BVIEW_BST_CNT_EUCQG_UC,
+    BVIEW_BST_CNT_EMCQ_MC,
+    BVIEW_BST_CNT_EMCQ_MC_QENTRIES,
+    BVIEW_BST_CNT_CPUQ_BUFFER,
+    BVIEW_BST_CNT_CPUQ_QENTRIES,
+    BVIEW_BST_CNT_RQEQ_BUFFER,
+    BVIEW_BST_CNT_RQEQ_QENTRIES,
+    BVIEW_BST_NUM_COUNTERS
+
+} BVIEW_BST_COUNTER_t;
+
+/* Shape of the compact snapshots of a unit, sized from the asic
+ * capabilities. Arrays of the realms kept per port are port major
+ */
+typedef struct _bst_snapshot_layout_
+{
+    /* number of counters of every array */
+    unsigned int count[BVIEW_BST_NUM_COUNTERS];
+    /* position of every array in the counter block */
+    unsigned int offset[BVIEW_BST_NUM_COUNTERS];
+    /* counters per port of the arrays kept per port, else 0 */
+    unsigned int stride[BVIEW_BST_NUM_COUNTERS];
+    /* size of the counter block */
+    unsigned int numCounters;
+    /* number of ports of the arrays kept per port */
+    unsigned int numPorts;
+    /* first counter array and number of arrays of every realm */
+    unsigned int realmCounter[BVIEW_BST_NUM_REALMS];
+    unsigned int realmNumCounters[BVIEW_BST_NUM_REALMS];
+    /* entries of every realm, shared by the arrays of the realm */
+    unsigned int realmEntries[BVIEW_BST_NUM_REALMS];
+    /* position and size of the bitmap of every realm, in words */
+    unsigned int bitmapOffset[BVIEW_BST_NUM_REALMS];
+    unsigned int bitmapWords[BVIEW_BST_NUM_REALMS];
+    /* size of a bitmap block, in words */
+    unsigned int numBitmapWords;
+    /* port of every unicast and multicast queue, kept once
+       instead of with every snapshot */
+    uint16_t *ucQueuePort;
+    uint16_t *mcQueuePort;
+
+} BVIEW_BST_SNAPSHOT_LAYOUT_t;
+
+/* Compact snapshot. Counters are 32 bits wide, buffer counts and
+ * thresholds of the asic are well within the range
+ */
+typedef struct _bst_snapshot_data_
+{
+    const BVIEW_BST_SNAPSHOT_LAYOUT_t *layout;
+    uint32_t *counters;
+    /* one bit per entry of a realm, set if a counter of the entry is
+       non zero / differs from the previous record */
+    uint64_t *nonzero;
+    uint64_t *changed;
+    /* realms with a bit set in the bitmaps */
+    BVIEW_BST_REALM_MASK_t nonzeroRealms;
+    BVIEW_BST_REALM_MASK_t changedRealms;
+
+} BVIEW_BST_SNAPSHOT_DATA_t;
+
+/* Counter of an entry of a compact snapshot, 0 based index */
+#define BVIEW_BST_SS_CNT(_ss, _cnt, _index)                              \
+              ((uint64_t) (_ss)->counters[(_ss)->layout->offset[(_cnt)] + \
+                                          (_index)])
+
+/* Counter of an entry of a port of a compact snapshot, 0 based port and index */
+#define BVIEW_BST_SS_PORT_CNT(_ss, _cnt, _port, _index)                  \
+              BVIEW_BST_SS_CNT ((_ss), (_cnt),                           \
+                                ((_port) * (_ss)->layout->stride[(_cnt)]) + (_index))
+
+/* Port of a unicast / multicast queue of a compact snapshot, 0 based queue */
+#define BVIEW_BST_SS_UC_QUEUE_PORT(_ss, _queue)  ((_ss)->layout->ucQueuePort[(_queue)])
+#define BVIEW_BST_SS_MC_QUEUE_PORT(_ss, _queue)  ((_ss)->layout->mcQueuePort[(_queue)])
+
+/* Word of the bitmap of a realm of a compact snapshot, with the bits of
+ * the entries to be reported. Entries with data, which also changed since
+ * the previous record when reported against it
+ */
+#define BVIEW_BST_SS_REPORT_BITS(_ss, _realmIndex, _changedOnly, _word)           \
+              ((_ss)->nonzero[(_ss)->layout->bitmapOffset[(_realmIndex)] + (_word)] & \
+               ((_changedOnly) ?                                                  \
+                (_ss)->changed[(_ss)->layout->bitmapOffset[(_realmIndex)] + (_word)] : \
+                ~((uint64_t) 0)))
+
+/* Words of the bitmap of a realm to be visited, none if the realm
+ * has no data or no change
+ */
+#define BVIEW_BST_SS_REPORT_WORDS(_ss, _realm, _changedOnly)                      \
+              ((0 == ((_ss)->nonzeroRealms & (_realm)) ||                         \
+                ((_changedOnly) && (0 == ((_ss)->changedRealms & (_realm))))) ?   \
+               0 : (_ss)->layout->bitmapWords[BVIEW_BST_REALM_INDEX (_realm)])
+
+/* Macro to iterate the entries of a realm of a compact snapshot which
+ * are to be reported, in the order of the entries
+ */
+#define BVIEW_BST_SS_ENTRY_ITER(_ss, _realm, _changedOnly, _word, _bits, _entry)  \
+              for ((_word) = 0;                                                   \
+                   (_word) < BVIEW_BST_SS_REPORT_WORDS ((_ss), (_realm), (_changedOnly)); \
+                   (_word)++)                                                     \
+                for ((_bits) = BVIEW_BST_SS_REPORT_BITS ((_ss), BVIEW_BST_REALM_INDEX (_realm), \
+                                                         (_changedOnly), (_word)); \
+                     ((_bits) != 0) &&                                            \
+                     (((_entry) = ((_word) * 64) + __builtin_ctzll (_bits)), 1);  \
+                     (_bits) &= ((_bits) - 1))
+
+/* Counter types of the realms, one per counter of a realm entry */
+typedef enum _bst_stat_
+{
+    BVIEW_BST_STAT_DEVICE = 0,
+    BVIEW_BST_STAT_ING_PORT_PG_SHARED,
+    BVIEW_BST_STAT_ING_PORT_PG_HEADROOM,
+    BVIEW_BST_STAT_ING_PORT_SP_SHARED,
+    BVIEW_BST_STAT_ING_SP_SHARED,
+    BVIEW_BST_STAT_EGR_PORT_SP_UC_SHARED,
+    BVIEW_BST_STAT_EGR_PORT_SP_SHARED,
+    BVIEW_BST_STAT_EGR_SP_SHARED,
+    BVIEW_BST_STAT_EGR_SP_MC_SHARED,
+    BVIEW_BST_STAT_EGR_UC_QUEUE,
+    BVIEW_BST_STAT_EGR_UC_QUEUE_GROUP,
+    BVIEW_BST_STAT_EGR_MC_QUEUE,
+    BVIEW_BST_STAT_EGR_CPU_QUEUE,
+    BVIEW_BST_STAT_EGR_RQE_QUEUE,
+    BVIEW_BST_STAT_MAX
+
+} BVIEW_BST_STAT_t;
+
+/* Counters of one counter type for a range of ports and indexes.
+ * Counter of (port, index) is stored at
+ * values[(port - firstPort) * portStride + index * indexStride]
+ */
+typedef struct _bst_stat_bulk_
+{
+    BVIEW_BST_STAT_t stat;
+    /* first port, 1 based. Ignored by counter types not kept per port */
+    unsigned int firstPort;
+    /* number of ports. Must be 1 for counter types not kept per port */
+    unsigned int numPorts;
+    /* number of counters (PGs, SPs or queues) per port */
+    unsigned int numIndex;
+    /* distance between the counters of two consecutive ports */
+    unsigned int portStride;
+    /* distance between two consecutive counters of a port */
+    unsigned int indexStride;
+    /* counters, in units of buffers */
+    uint64_t *values;
+
+} BVIEW_BST_STAT_BULK_t;
+
+/* Timing of the snapshot collection cycles of a unit. A cycle syncs the
+ * stat ids of the requested realms once and then reads the realms
+ */
+typedef struct _bst_collect_stats_
+{
+    /* number of collection cycles */
+    uint64_t numCycles;
+    /* number of stat ids synced by the last cycle */
+    unsigned int lastSyncCount;
+    /* duration of the sync phase of the last cycle, in usec */
+    uint64_t lastSyncUsec;
+    /* duration of the read phase of the last cycle, in usec */
+    uint64_t lastReadUsec;
+    /* longest sync phase, in usec */
+    uint64_t maxSyncUsec;
+    /* time spent in the sync phase by all cycles, in usec */
+    uint64_t totalSyncUsec;
+
+} BVIEW_BST_COLLECT_STATS_t;
+
 /* Statistics collection mode */
 typedef enum _bst_collection_mode_
 {
@@ -217,6 +446,21 @@ typedef enum _bst_trigger_type_
 
 } BVIEW_BST_TRIGGER_TYPE;
 
+/* Context of a trigger, i.e the counter which crossed its threshold */
+typedef struct _bst_trigger_info_
+{
+    /* Coarse type of the trigger */
+    BVIEW_BST_TRIGGER_TYPE type;
+    /* Realm of the counter, 0 if not known */
+    BVIEW_BST_REALM_t realm;
+    /* Port of the counter, 0 for realms which are not per port */
+    int port;
+    /* Index of the counter in the realm, i.e priority group,
+       service pool or queue. Same as the index of configure-bst-thresholds */
+    int index;
+
+} BVIEW_BST_TRIGGER_INFO_t;
+
 /* Profile configuration  for Egress Port + Service Pools */
 typedef struct _bst_ep_sp_threshold_
 {
@@ -291,10 +535,40 @@ typedef struct _bst_rqe_q_threshold_
     uint64_t rqeQueueThreshold;
 } BVIEW_BST_EGRESS_RQE_QUEUE_THRESHOLD_t;
 
+/* Threshold of one realm entry, applied by a bulk threshold set */
+typedef struct _bst_threshold_bulk_entry_
+{
+    /* realm of the threshold */
+    BVIEW_BST_REALM_t realm;
+    /* port, 1 based. Ignored by realms not kept per port */
+    int port;
+    /* priority group, service pool, queue or queue group of the realm.
+     * Ignored by the device realm */
+    int index;
+    /* threshold, the member of the realm is used */
+    union
+    {
+        BVIEW_BST_DEVICE_THRESHOLD_t device;
+        BVIEW_BST_INGRESS_PORT_PG_THRESHOLD_t ippg;
+        BVIEW_BST_INGRESS_PORT_SP_THRESHOLD_t ipsp;
+        BVIEW_BST_INGRESS_SP_THRESHOLD_t isp;
+        BVIEW_BST_EGRESS_PORT_SP_THRESHOLD_t epsp;
+        BVIEW_BST_EGRESS_SP_THRESHOLD_t esp;
+        BVIEW_BST_EGRESS_UC_QUEUE_THRESHOLD_t eucq;
+        BVIEW_BST_EGRESS_UC_QUEUEGROUPS_THRESHOLD_t eucqg;
+        BVIEW_BST_EGRESS_MC_QUEUE_THRESHOLD_t emcq;
+        BVIEW_BST_EGRESS_CPU_QUEUE_THRESHOLD_t cpuq;
+        BVIEW_BST_EGRESS_RQE_QUEUE_THRESHOLD_t rqeq;
+    } threshold;
+    /* status of the threshold set, filled in by the SB plugin */
+    BVIEW_STATUS status;
+
+} BVIEW_BST_THRESHOLD_BULK_ENTRY_t;
+
 /* The callback for invoking when a configured trigger goes off */
 typedef BVIEW_STATUS(*BVIEW_BST_TRIGGER_CALLBACK_t) (int asic,
         void *cookie,
-        BVIEW_BST_TRIGGER_TYPE type );
+        BVIEW_BST_TRIGGER_INFO_t *triggerInfo );
 
 
 /* macros for threshold validation */
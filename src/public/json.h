@@ -157,6 +157,16 @@ extern "C"
             return BVIEW_STATUS_INVALID_JSON; \
     } \
     } while(0)
+
+/* Points _portStr to the cached external notation of the port, no copy.
+ * Ports outside the port map are converted into _scratch */
+#define JSON_PORT_NOTATION_GET(_port, _asic, _portStr, _portLen, _scratch) do { \
+    if (sbapi_system_port_notation_get((_asic), (int)(_port), &(_portStr), &(_portLen)) != BVIEW_STATUS_SUCCESS) { \
+        JSON_PORT_MAP_TO_NOTATION((_port), (_asic), (_scratch)); \
+        (_portStr) = (_scratch); \
+        (_portLen) = (int) strlen(_scratch); \
+    } \
+    } while(0)
     
 #ifdef __cplusplus
 }
@@ -80,8 +80,12 @@ BVIEW_STATUS  sbapi_bst_config_set(int asic, BVIEW_BST_CONFIG_t *config);
 * @brief       Get BST snapshot
 *
 * @param[in]     asic                  Unit number
+* @param[in]     realmMask             Mask of realms to be read
 * @param[out]    snapshot              BST snapshot
 * @param[out]    time                  Time
+* @param[out]    realmTime             Sampling window of every realm
+*                                      read, indexed by BVIEW_BST_REALM_INDEX.
+*                                      Can be NULL
 *
 * @retval   BVIEW_STATUS_FAILURE      Due to lock acquistion failure or 
 *                                     Not able to get asic type of this unit or
@@ -93,8 +97,58 @@ BVIEW_STATUS  sbapi_bst_config_set(int asic, BVIEW_BST_CONFIG_t *config);
 * @retval   BVIEW_STATUS_UNSUPPORTED  BST snapshot get functionality is 
 *                                     not supported on this unit
 *
+* @notes    Realms not present in realmMask are neither synced nor read
+*           and are left untouched in the snapshot.
+*
+*********************************************************************/
+BVIEW_STATUS  sbapi_bst_snapshot_get(int asic, BVIEW_BST_REALM_MASK_t realmMask,
+                                     BVIEW_BST_ASIC_SNAPSHOT_DATA_t *snapshot, BVIEW_TIME_t *time,
+                                     BVIEW_BST_REALM_TIME_t *realmTime);
+
+/*****************************************************************//**
+* @brief       Get the counters of one counter type in bulk
+*
+* @param[in]     asic                  Unit number
+* @param[in,out] bulk                  Counter type, port and index
+*                                      range and the counters
+*
+* @retval   BVIEW_STATUS_FAILURE      Due to lock acquistion failure or 
+*                                     Not able to get asic type of this unit or
+*                                     BST feature is not present or
+*                                     BST south bound function has returned failure
+*
+* @retval   BVIEW_STATUS_SUCCESS      BST bulk stat get is successful 
+*
+* @retval   BVIEW_STATUS_UNSUPPORTED  BST bulk stat get functionality is 
+*                                     not supported on this unit
+*
+* @notes    Counters are not synced from HW, they are read as last
+*           synced by a realm or snapshot get.
+*
+*********************************************************************/
+BVIEW_STATUS  sbapi_bst_stat_bulk_get(int asic, BVIEW_BST_STAT_BULK_t *bulk);
+
+/*****************************************************************//**
+* @brief       Get the timing of the snapshot collection cycles
+*
+* @param[in]     asic                  Unit number
+* @param[out]    stats                 Collection cycle timing
+*
+* @retval   BVIEW_STATUS_FAILURE      Due to lock acquistion failure or 
+*                                     Not able to get asic type of this unit or
+*                                     BST feature is not present or
+*                                     BST south bound function has returned failure
+*
+* @retval   BVIEW_STATUS_SUCCESS      BST collection stats get is successful 
+*
+* @retval   BVIEW_STATUS_UNSUPPORTED  BST collection stats get functionality is 
+*                                     not supported on this unit
+*
+* @notes    Only snapshot gets are collection cycles, realm gets
+*           are not accounted.
+*
 *********************************************************************/
-BVIEW_STATUS  sbapi_bst_snapshot_get(int asic, BVIEW_BST_ASIC_SNAPSHOT_DATA_t *snapshot, BVIEW_TIME_t *time);
+BVIEW_STATUS  sbapi_bst_collect_stats_get(int asic, BVIEW_BST_COLLECT_STATS_t *stats);
 
 /*****************************************************************//**
 * @brief  Obtain Device Statistics
@@ -607,6 +661,30 @@ BVIEW_STATUS sbapi_bst_cpuq_threshold_set(int asic, int cpuQueue, BVIEW_BST_EGRE
 *********************************************************************/
 BVIEW_STATUS sbapi_bst_rqeq_threshold_set(int asic, int rqeQueue, BVIEW_BST_EGRESS_RQE_QUEUE_THRESHOLD_t *threshold);
 
+/*****************************************************************//**
+* @brief  Set threshold configuration of many realm entries in
+*           one batch
+*
+* @param[in]     asic                    unit
+* @param[in,out] entries                 Realm entries and thresholds,
+*                                        status of each entry
+* @param[in]     numEntries              Number of entries
+*
+* @retval   BVIEW_STATUS_FAILURE      Not able to get asic type of this unit or
+*                                     BST feature is not present or
+*                                     threshold set of an entry has failed
+*
+* @retval   BVIEW_STATUS_SUCCESS      Thresholds of all entries are set
+*
+* @retval   BVIEW_STATUS_UNSUPPORTED  Bulk threshold set functionality is
+*                                     not supported on this unit
+*
+* @notes    A failed entry does not stop the batch, the status
+*           of every entry is returned in the entry.
+*
+*********************************************************************/
+BVIEW_STATUS sbapi_bst_threshold_bulk_set(int asic, BVIEW_BST_THRESHOLD_BULK_ENTRY_t *entries, unsigned int numEntries);
+
 /*****************************************************************//**
 * @brief  Get snapshot of all thresholds configured
 *
@@ -627,6 +705,29 @@ BVIEW_STATUS sbapi_bst_rqeq_threshold_set(int asic, int rqeQueue, BVIEW_BST_EGRE
 BVIEW_STATUS sbapi_bst_threshold_get(int asic, BVIEW_BST_ASIC_SNAPSHOT_DATA_t *thresholdSnapshot,
                                      BVIEW_TIME_t * time);
 
+/*****************************************************************//**
+* @brief  Read snapshot of all thresholds configured from HW and
+*         verify the shadow copy of the thresholds
+*
+* @param[in]   asic                          unit
+* @param[out]  thresholdSnapshot             threshold snapshot
+* @param[out]  time                          time
+* @param[out]  mismatches                    number of thresholds that
+*                                            differ from the shadow copy
+*
+* @retval   BVIEW_STATUS_FAILURE      Not able to get asic type of this unit or
+*                                     BST feature is not present or
+*                                     BST south bound function has returned failure
+*
+* @retval   BVIEW_STATUS_SUCCESS      Threshold verify is successful 
+*
+* @retval   BVIEW_STATUS_UNSUPPORTED  Threshold verify functionality is 
+*                                     not supported on this unit
+*
+*********************************************************************/
+BVIEW_STATUS sbapi_bst_threshold_verify(int asic, BVIEW_BST_ASIC_SNAPSHOT_DATA_t *thresholdSnapshot,
+                                        BVIEW_TIME_t * time, unsigned int *mismatches);
+
 /*****************************************************************//**
 * @brief  Restore threshold configuration to defaults
 *
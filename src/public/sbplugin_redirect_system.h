@@ -232,6 +232,30 @@ BVIEW_STATUS sbapi_system_port_translate_from_notation(char *src, int *port);
 *********************************************************************/
 BVIEW_STATUS sbapi_system_port_translate_to_notation(int asic, int port, char *dst);
 
+/*******************************************************************//**
+* @brief       Get the cached notational representation(string) of a
+*                port and its length
+*
+* @param[in]  asic        System asic number 
+* @param[in]  port        System port number 
+* @param[out] notation    Port number in notational(string) form
+* @param[out] length      Length of the string
+*
+* @retval   BVIEW_STATUS_FAILURE      System feature is not present or
+*                                     port is not in the port map
+*
+* @retval   BVIEW_STATUS_SUCCESS      Port string is found
+*
+* @retval   BVIEW_STATUS_UNSUPPORTED  Port notation get functionality is 
+*                                     not supported on this unit
+*
+* @notes    The string is owned by the south bound plug-in, it must not
+*           be modified.
+*
+*********************************************************************/
+BVIEW_STATUS sbapi_system_port_notation_get(int asic, int port,
+                                            const char **notation, int *length);
+
   /* Acquire Read lock */
 /*******************************************************************//**
 * @brief       Get number of ports in a unit
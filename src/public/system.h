@@ -72,7 +72,10 @@ void system_deinit();
 * @retval        BVIEW_STATUS_SUCCESS
 * @retval        BVIEW_STATUS_FAILURE
 *
-* @note          NA
+* @note          All the timers are served by a single scheduler thread
+*                on a timerfd. The handler is invoked in that thread
+*                with param in sival_ptr, and must not block. Periodic
+*                timers expire on absolute deadlines which do not drift.
 *
 * @end
 *********************************************************************/
@@ -118,5 +121,29 @@ BVIEW_STATUS system_timer_delete(timer_t timerId);
 
 BVIEW_STATUS system_timer_set(timer_t timerId,int timeInMilliSec,TIMER_MODE mode);
 
+/*********************************************************************
+* @brief         Function used to create a periodic timer aligned to
+*                the wall clock
+*
+*
+* @param[in]     handler        function pointer to handle the callback
+* @param[in,out] timerId        timerId of the timer which is created
+* @param[in]     periodInMilliSec  Period of the timer
+* @param[in]     offsetInMilliSec  Offset of the expiries from the 
+*                               wall clock multiples of the period
+* @param[in]     param          Arguments passed from the calling function
+*
+* @retval        BVIEW_STATUS_SUCCESS
+* @retval        BVIEW_STATUS_FAILURE
+*
+* @note          The timer expires at the wall clock multiples of the
+*                period plus the offset. It is destroyed with
+*                system_timer_delete.
+*
+* @end
+*********************************************************************/
+
+BVIEW_STATUS system_timer_add_aligned(void * handler,timer_t * timerId, int periodInMilliSec, int offsetInMilliSec, void * param);
+
 #endif /* INCLUDE_SYSTEM_H */
 
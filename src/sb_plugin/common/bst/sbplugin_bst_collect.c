@@ -0,0 +1,484 @@
+/*****************************************************************************
+  *
+  * (C) Copyright Broadcom Corporation 2015
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License");
+  * you may not use this file except in compliance with the License.
+  *
+  * You may obtain a copy of the License at
+  * http://www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ***************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include "feature.h"
+#include "bst.h"
+#include "sbfeature_bst.h"
+#include "openapps_log_api.h"
+#include "sbplugin_bst_collect.h"
+
+/* One realm to be read by a collection worker */
+typedef struct _bview_bst_collect_job_
+{
+  int                             asic;
+  BVIEW_BST_REALM_t               realm;
+  BVIEW_BST_ASIC_SNAPSHOT_DATA_t *snapshot;
+  BVIEW_TIME_t                    time;
+  BVIEW_BST_REALM_TIME_t          realmTime;
+  BVIEW_STATUS                    rv;
+} BVIEW_BST_COLLECT_JOB_t;
+
+/* Snapshot collection worker pool */
+typedef struct _bview_bst_collect_pool_
+{
+  /* serializes the snapshot requests */
+  pthread_mutex_t          runLock;
+  /* protects the job list */
+  pthread_mutex_t          lock;
+  pthread_cond_t           workCond;
+  pthread_cond_t           doneCond;
+  unsigned int             numWorkers;
+  pthread_t                worker[BVIEW_BST_COLLECT_WORKERS_MAX];
+  BVIEW_BST_COLLECT_JOB_t  job[BVIEW_BST_NUM_REALMS];
+  unsigned int             numJobs;
+  unsigned int             nextJob;
+  unsigned int             doneJobs;
+} BVIEW_BST_COLLECT_POOL_t;
+
+static BVIEW_BST_COLLECT_POOL_t bstCollectPool;
+
+/* Hooks of the south bound plugin */
+static const BVIEW_BST_COLLECT_OPS_t *bstCollectOps;
+
+/* Macro to iterate 'n'  times*/
+#define BVIEW_BST_COLLECT_ITER(_index,_n)                      \
+              for ((_index) = 0; (_index) < (_n); (_index)++)
+
+/* Collection cycle timing of the units */
+static BVIEW_BST_COLLECT_STATS_t bstCollectStats[BVIEW_MAX_ASICS_ON_A_PLATFORM];
+static pthread_mutex_t bstCollectStatsLock = PTHREAD_MUTEX_INITIALIZER;
+
+/* Realms in the order they are handed to the workers. Realms with the
+   most counters go first, so that the slowest realm starts first */
+static const BVIEW_BST_REALM_t bstCollectOrder[BVIEW_BST_NUM_REALMS] =
+{
+  BVIEW_BST_REALM_INGRESS_PORT_PG,
+  BVIEW_BST_REALM_EGRESS_UC_QUEUE,
+  BVIEW_BST_REALM_EGRESS_MC_QUEUE,
+  BVIEW_BST_REALM_EGRESS_PORT_SP,
+  BVIEW_BST_REALM_INGRESS_PORT_SP,
+  BVIEW_BST_REALM_EGRESS_UC_QUEUEGROUPS,
+  BVIEW_BST_REALM_EGRESS_RQE_QUEUE,
+  BVIEW_BST_REALM_EGRESS_CPU_QUEUE,
+  BVIEW_BST_REALM_INGRESS_SP,
+  BVIEW_BST_REALM_EGRESS_SP,
+  BVIEW_BST_REALM_DEVICE
+};
+
+/*********************************************************************
+* @brief  Snapshot collection worker
+*
+* @param[in]   arg                   - worker pool
+*
+* @retval   none
+*
+* @notes    Picks the realms of the current request till none is
+*           left and signals the requester once all are done.
+*
+*
+*********************************************************************/
+static void *sbplugin_bst_collect_worker (void *arg)
+{
+  BVIEW_BST_COLLECT_POOL_t *pool = (BVIEW_BST_COLLECT_POOL_t *) arg;
+  BVIEW_BST_COLLECT_JOB_t *job;
+
+  pthread_mutex_lock (&pool->lock);
+  while (true)
+  {
+    while (pool->nextJob >= pool->numJobs)
+    {
+      pthread_cond_wait (&pool->workCond, &pool->lock);
+    }
+    job = &pool->job[pool->nextJob++];
+    pthread_mutex_unlock (&pool->lock);
+
+    BVIEW_HR_TIME_GET (&job->realmTime.start);
+    job->rv = bstCollectOps->realm_get_cb (job->asic, job->realm,
+                                         job->snapshot, &job->time);
+    BVIEW_HR_TIME_GET (&job->realmTime.end);
+
+    pthread_mutex_lock (&pool->lock);
+    pool->doneJobs++;
+    if (pool->doneJobs == pool->numJobs)
+    {
+      pthread_cond_signal (&pool->doneCond);
+    }
+  }
+  return NULL;
+}
+
+/*********************************************************************
+* @brief  Start the snapshot collection workers
+*
+* @param[in]   ops                   - hooks of the south bound plugin
+*
+* @retval BVIEW_STATUS_INVALID_PARAMETER if ops is invalid.
+* @retval BVIEW_STATUS_SUCCESS           if workers are started or
+*                                        parallel collection is disabled.
+* @retval BVIEW_STATUS_FAILURE           if the pool can not be set up.
+*
+* @notes    Number of workers is BVIEW_BST_COLLECT_WORKERS of feature.h.
+*
+*
+*********************************************************************/
+BVIEW_STATUS sbplugin_bst_collect_init (const BVIEW_BST_COLLECT_OPS_t *ops)
+{
+  BVIEW_BST_COLLECT_POOL_t *pool = &bstCollectPool;
+  unsigned int numWorkers = BVIEW_BST_COLLECT_WORKERS;
+  unsigned int index = 0;
+
+  if ((ops == NULL) || (ops->realmSync == NULL) ||
+      (ops->stat_sync_cb == NULL) || (ops->realm_get_cb == NULL) ||
+      (ops->numAsics > BVIEW_MAX_ASICS_ON_A_PLATFORM))
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+  bstCollectOps = ops;
+
+  pool->numWorkers = 0;
+  pool->numJobs = 0;
+  pool->nextJob = 0;
+  pool->doneJobs = 0;
+
+  /* Single worker is no better than reading in the caller's thread */
+  if (numWorkers <= 1)
+  {
+    return BVIEW_STATUS_SUCCESS;
+  }
+
+  if ((pthread_mutex_init (&pool->runLock, NULL) != 0) ||
+      (pthread_mutex_init (&pool->lock, NULL) != 0) ||
+      (pthread_cond_init (&pool->workCond, NULL) != 0) ||
+      (pthread_cond_init (&pool->doneCond, NULL) != 0))
+  {
+    log_post (BVIEW_LOG_ERROR, "Failed to init BST collection pool");
+    return BVIEW_STATUS_FAILURE;
+  }
+
+  BVIEW_BST_COLLECT_ITER (index, numWorkers)
+  {
+    if (pthread_create (&pool->worker[index], NULL,
+                        sbplugin_bst_collect_worker, pool) != 0)
+    {
+      log_post (BVIEW_LOG_ERROR, "Failed to start BST collection worker %u",
+                index);
+      break;
+    }
+    pool->numWorkers++;
+  }
+
+  log_post (BVIEW_LOG_INFO, "BST snapshot collection with %u workers",
+            pool->numWorkers);
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief  Number of snapshot collection workers
+*
+* @retval   number of workers, 0 if parallel collection is disabled
+*
+* @notes    none
+*
+*
+*********************************************************************/
+unsigned int sbplugin_bst_collect_workers_get (void)
+{
+  return bstCollectPool.numWorkers;
+}
+
+/*********************************************************************
+* @brief  Read the selected realms of the snapshot in parallel
+*
+* @param[in]      asic               - unit
+* @param[in]      realmMask          - mask of realms to be read
+* @param[out]     snapshot           - snapshot data structure
+* @param[out]     time               - time
+* @param[out]     realmTime          - sampling window of every realm
+*                                      read, can be NULL
+*
+* @retval BVIEW_STATUS_FAILURE           if any realm get is failed.
+* @retval BVIEW_STATUS_SUCCESS           if all realms are read.
+*
+* @notes    Returns after all the realms are read. time is set to
+*           the time of the last realm read.
+*
+*
+*********************************************************************/
+static BVIEW_STATUS sbplugin_bst_collect_run (int asic,
+                                 BVIEW_BST_REALM_MASK_t realmMask,
+                                 BVIEW_BST_ASIC_SNAPSHOT_DATA_t *snapshot,
+                                 BVIEW_TIME_t *time,
+                                 BVIEW_BST_REALM_TIME_t *realmTime)
+{
+  BVIEW_BST_COLLECT_POOL_t *pool = &bstCollectPool;
+  BVIEW_STATUS rv = BVIEW_STATUS_SUCCESS;
+  unsigned int index = 0, numJobs = 0;
+
+  pthread_mutex_lock (&pool->runLock);
+
+  BVIEW_BST_COLLECT_ITER (index, BVIEW_BST_NUM_REALMS)
+  {
+    if ((realmMask & bstCollectOrder[index]) == 0)
+    {
+      continue;
+    }
+    pool->job[numJobs].asic = asic;
+    pool->job[numJobs].realm = bstCollectOrder[index];
+    pool->job[numJobs].snapshot = snapshot;
+    pool->job[numJobs].time = *time;
+    pool->job[numJobs].rv = BVIEW_STATUS_SUCCESS;
+    numJobs++;
+  }
+
+  /* Hand the realms to the workers and wait for all of them */
+  pthread_mutex_lock (&pool->lock);
+  pool->nextJob = 0;
+  pool->doneJobs = 0;
+  pool->numJobs = numJobs;
+  pthread_cond_broadcast (&pool->workCond);
+  while (pool->doneJobs < pool->numJobs)
+  {
+    pthread_cond_wait (&pool->doneCond, &pool->lock);
+  }
+  pool->numJobs = 0;
+  pool->nextJob = 0;
+  pthread_mutex_unlock (&pool->lock);
+
+  BVIEW_BST_COLLECT_ITER (index, numJobs)
+  {
+    if (pool->job[index].rv != BVIEW_STATUS_SUCCESS)
+    {
+      rv = BVIEW_STATUS_FAILURE;
+    }
+    if (pool->job[index].time > *time)
+    {
+      *time = pool->job[index].time;
+    }
+    if (realmTime != NULL)
+    {
+      realmTime[BVIEW_BST_REALM_INDEX (pool->job[index].realm)] =
+                                              pool->job[index].realmTime;
+    }
+  }
+
+  pthread_mutex_unlock (&pool->runLock);
+  return rv;
+}
+
+/*********************************************************************
+* @brief  Monotonic time in usec
+*
+* @retval   time in usec
+*
+* @notes    none
+*
+*
+*********************************************************************/
+static uint64_t sbplugin_bst_usec_get (void)
+{
+  struct timespec ts;
+
+  clock_gettime (CLOCK_MONOTONIC, &ts);
+  return ((uint64_t) ts.tv_sec * 1000000) + ((uint64_t) ts.tv_nsec / 1000);
+}
+
+/*********************************************************************
+* @brief  Sync the stat ids of the selected realms
+*
+* @param[in]   asic                  - unit
+* @param[in]   realmMask             - mask of realms to be synced
+* @param[out]  numSynced             - number of stat ids synced, can
+*                                      be NULL
+*
+* @retval BVIEW_STATUS_FAILURE           if a stat sync is failed.
+* @retval BVIEW_STATUS_SUCCESS           if all stat ids are synced.
+*
+* @notes    A stat id shared by realms is synced once.
+*
+*
+*********************************************************************/
+BVIEW_STATUS sbplugin_bst_realm_sync (int asic,
+                                 BVIEW_BST_REALM_MASK_t realmMask,
+                                 unsigned int *numSynced)
+{
+  const BVIEW_BST_COLLECT_REALM_SYNC_t *realmSync = bstCollectOps->realmSync;
+  int synced[BVIEW_BST_NUM_REALMS * BVIEW_BST_COLLECT_REALM_MAX_BIDS];
+  unsigned int index = 0, bidIndex = 0, syncIndex = 0, count = 0;
+  int bid;
+
+  BVIEW_BST_COLLECT_ITER (index, BVIEW_BST_NUM_REALMS)
+  {
+    if ((realmMask & realmSync[index].realm) == 0)
+    {
+      continue;
+    }
+    BVIEW_BST_COLLECT_ITER (bidIndex, realmSync[index].numBids)
+    {
+      bid = realmSync[index].bid[bidIndex];
+      BVIEW_BST_COLLECT_ITER (syncIndex, count)
+      {
+        if (synced[syncIndex] == bid)
+        {
+          break;
+        }
+      }
+      if (syncIndex < count)
+      {
+        continue;
+      }
+      if (bstCollectOps->stat_sync_cb (asic, bid) != BVIEW_STATUS_SUCCESS)
+      {
+        return BVIEW_STATUS_FAILURE;
+      }
+      synced[count++] = bid;
+    }
+  }
+
+  if (numSynced != NULL)
+  {
+    *numSynced = count;
+  }
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief  Run one snapshot collection cycle
+*
+* @param[in]      asic               - unit
+* @param[in]      realmMask          - mask of realms to be read
+* @param[out]     snapshot           - snapshot data structure
+* @param[out]     time               - time
+* @param[out]     realmTime          - sampling window of every realm
+*                                      read, can be NULL
+*
+* @retval BVIEW_STATUS_INVALID_PARAMETER if asic is invalid.
+* @retval BVIEW_STATUS_FAILURE           if sync or any realm get is failed.
+* @retval BVIEW_STATUS_SUCCESS           if all realms are read.
+*
+* @notes    The stat ids of all the selected realms are synced once
+*           up front, then the realms are read without syncing,
+*           in parallel if collection workers are configured. The
+*           duration of both phases is accounted per unit.
+*
+*
+*********************************************************************/
+BVIEW_STATUS sbplugin_bst_collect_cycle (int asic,
+                                 BVIEW_BST_REALM_MASK_t realmMask,
+                                 BVIEW_BST_ASIC_SNAPSHOT_DATA_t *snapshot,
+                                 BVIEW_TIME_t *time,
+                                 BVIEW_BST_REALM_TIME_t *realmTime)
+{
+  BVIEW_BST_COLLECT_STATS_t *stats;
+  BVIEW_STATUS rv = BVIEW_STATUS_SUCCESS;
+  BVIEW_BST_REALM_t realm;
+  BVIEW_BST_REALM_TIME_t window;
+  unsigned int numSynced = 0;
+  uint64_t start = 0, synced = 0, done = 0;
+
+  if ((bstCollectOps == NULL) ||
+      (asic < 0) || (asic >= (int) bstCollectOps->numAsics))
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+
+  start = sbplugin_bst_usec_get ();
+  rv = sbplugin_bst_realm_sync (asic, realmMask, &numSynced);
+  synced = sbplugin_bst_usec_get ();
+
+  if (rv != BVIEW_STATUS_SUCCESS)
+  {
+    rv = BVIEW_STATUS_FAILURE;
+  }
+  else if (sbplugin_bst_collect_workers_get () > 1)
+  {
+    /* Fan out the realms to the collection workers */
+    rv = sbplugin_bst_collect_run (asic, realmMask, snapshot, time,
+                                          realmTime);
+  }
+  else
+  {
+    BVIEW_BST_REALM_ITER (realm)
+    {
+      if ((realmMask & realm) == 0)
+      {
+        continue;
+      }
+      BVIEW_HR_TIME_GET (&window.start);
+      if (bstCollectOps->realm_get_cb (asic, realm, snapshot, time) !=
+          BVIEW_STATUS_SUCCESS)
+      {
+        rv = BVIEW_STATUS_FAILURE;
+        break;
+      }
+      BVIEW_HR_TIME_GET (&window.end);
+      if (realmTime != NULL)
+      {
+        realmTime[BVIEW_BST_REALM_INDEX (realm)] = window;
+      }
+    }
+  }
+  done = sbplugin_bst_usec_get ();
+
+  pthread_mutex_lock (&bstCollectStatsLock);
+  stats = &bstCollectStats[asic];
+  stats->numCycles++;
+  stats->lastSyncCount = numSynced;
+  stats->lastSyncUsec = synced - start;
+  stats->lastReadUsec = done - synced;
+  stats->totalSyncUsec += stats->lastSyncUsec;
+  if (stats->lastSyncUsec > stats->maxSyncUsec)
+  {
+    stats->maxSyncUsec = stats->lastSyncUsec;
+  }
+  pthread_mutex_unlock (&bstCollectStatsLock);
+
+  return rv;
+}
+
+/*********************************************************************
+* @brief  Obtain the timing of the snapshot collection cycles
+*
+* @param[in]   asic                  - unit
+* @param[out]  stats                 - collection cycle timing
+*
+* @retval BVIEW_STATUS_INVALID_PARAMETER if input data is invalid.
+* @retval BVIEW_STATUS_SUCCESS           if stats get is success.
+*
+* @notes    none
+*
+*
+*********************************************************************/
+BVIEW_STATUS sbplugin_bst_collect_stats_get (int asic,
+                                 BVIEW_BST_COLLECT_STATS_t *stats)
+{
+  if ((stats == NULL) || (bstCollectOps == NULL) ||
+      (asic < 0) || (asic >= (int) bstCollectOps->numAsics))
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+
+  pthread_mutex_lock (&bstCollectStatsLock);
+  *stats = bstCollectStats[asic];
+  pthread_mutex_unlock (&bstCollectStatsLock);
+  return BVIEW_STATUS_SUCCESS;
+}
@@ -28,6 +28,22 @@ extern "C"
 #include "sbplugin.h"
 #include "bst.h"
 
+/** Maximum number of collection workers, one per realm */
+#define BVIEW_BST_COLLECT_WORKERS_MAX        BVIEW_BST_NUM_REALMS
+
+/** Number of snapshot collection workers. 0 or 1 reads the realms
+    sequentially in the calling thread. A build target reads them in
+    parallel by defining it in its feature.h, e.g.
+    #define BVIEW_BST_COLLECT_WORKERS 4 */
+#ifndef BVIEW_BST_COLLECT_WORKERS
+#define BVIEW_BST_COLLECT_WORKERS            0
+#endif
+
+#if (BVIEW_BST_COLLECT_WORKERS < 0) || \
+    (BVIEW_BST_COLLECT_WORKERS > BVIEW_BST_COLLECT_WORKERS_MAX)
+#error "BVIEW_BST_COLLECT_WORKERS is out of range"
+#endif
+
 /** The BST Southbound Feature Definition */
 
 typedef struct _bst_sb_feature_
@@ -40,7 +56,15 @@ typedef struct _bst_sb_feature_
     BVIEW_STATUS(*bst_config_get_cb)(int asic, BVIEW_BST_CONFIG_t *config);
 
     /** Obtain Complete ASIC Statistics Report */
-    BVIEW_STATUS(*bst_snapshot_get_cb)(int asic, BVIEW_BST_ASIC_SNAPSHOT_DATA_t *snapshot, BVIEW_TIME_t *time);
+    BVIEW_STATUS(*bst_snapshot_get_cb)(int asic, BVIEW_BST_REALM_MASK_t realmMask,
+                                       BVIEW_BST_ASIC_SNAPSHOT_DATA_t *snapshot, BVIEW_TIME_t *time,
+                                       BVIEW_BST_REALM_TIME_t *realmTime);
+
+    /** Obtain the timing of the snapshot collection cycles */
+    BVIEW_STATUS(*bst_collect_stats_get_cb)(int asic, BVIEW_BST_COLLECT_STATS_t *stats);
+
+    /** Obtain the counters of one counter type for a range of ports and indexes */
+    BVIEW_STATUS(*bst_stat_bulk_get_cb)(int asic, BVIEW_BST_STAT_BULK_t *bulk);
 
     /** Obtain Device Statistics */
     BVIEW_STATUS(*bst_device_data_get_cb)(int asic, BVIEW_BST_DEVICE_DATA_t *data, BVIEW_TIME_t *time);
@@ -108,9 +132,15 @@ typedef struct _bst_sb_feature_
     /** Set threshold configuration for Egress Egress RQE Queues Statistics */
     BVIEW_STATUS(*bst_rqeq_threshold_set_cb)(int asic, int rqeQueue, BVIEW_BST_EGRESS_RQE_QUEUE_THRESHOLD_t *threshold);
 
+    /** Set threshold configuration of many realm entries in one batch */
+    BVIEW_STATUS(*bst_threshold_bulk_set_cb)(int asic, BVIEW_BST_THRESHOLD_BULK_ENTRY_t *entries, unsigned int numEntries);
+
     /** Get all threshold configurations  */
     BVIEW_STATUS(*bst_threshold_get_cb)(int asic, BVIEW_BST_ASIC_SNAPSHOT_DATA_t *thresholdSnapshot, BVIEW_TIME_t *time);
 
+    /** Read all threshold configurations from HW and verify the shadow copy */
+    BVIEW_STATUS(*bst_threshold_verify_cb)(int asic, BVIEW_BST_ASIC_SNAPSHOT_DATA_t *thresholdSnapshot, BVIEW_TIME_t *time, unsigned int *mismatches);
+
     /** Clear all statistics  */
     BVIEW_STATUS(*bst_clear_stats_cb) (int asic);
 
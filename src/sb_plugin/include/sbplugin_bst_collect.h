@@ -0,0 +1,152 @@
+/*****************************************************************************
+  *
+  * (C) Copyright Broadcom Corporation 2015
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License");
+  * you may not use this file except in compliance with the License.
+  *
+  * You may obtain a copy of the License at
+  * http://www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ***************************************************************************/
+
+#ifndef INCLUDE_SBPLUGIN_BST_COLLECT_H
+#define INCLUDE_SBPLUGIN_BST_COLLECT_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "broadview.h"
+#include "sbfeature_bst.h"
+
+/** Maximum number of stat ids synced for a realm */
+#define BVIEW_BST_COLLECT_REALM_MAX_BIDS     2
+
+/** Stat ids of the south bound plugin synced for a realm */
+typedef struct _bst_collect_realm_sync_
+{
+  BVIEW_BST_REALM_t   realm;
+  unsigned int        numBids;
+  int                 bid[BVIEW_BST_COLLECT_REALM_MAX_BIDS];
+} BVIEW_BST_COLLECT_REALM_SYNC_t;
+
+/** Hooks of the south bound plugin used by the snapshot collection */
+typedef struct _bst_collect_ops_
+{
+  /** Number of units of the plugin */
+  unsigned int numAsics;
+
+  /** Stat ids of every realm, BVIEW_BST_NUM_REALMS entries */
+  const BVIEW_BST_COLLECT_REALM_SYNC_t *realmSync;
+
+  /** Sync one stat id of the unit to the SDK */
+  BVIEW_STATUS(*stat_sync_cb)(int asic, int bid);
+
+  /** Read one realm of the snapshot, its stat ids already synced */
+  BVIEW_STATUS(*realm_get_cb)(int asic, BVIEW_BST_REALM_t realm,
+                              BVIEW_BST_ASIC_SNAPSHOT_DATA_t *snapshot,
+                              BVIEW_TIME_t *time);
+} BVIEW_BST_COLLECT_OPS_t;
+
+/*********************************************************************
+* @brief  Start the snapshot collection workers
+*
+* @param[in]   ops                   - hooks of the south bound plugin
+*
+* @retval BVIEW_STATUS_INVALID_PARAMETER if ops is invalid.
+* @retval BVIEW_STATUS_SUCCESS           if workers are started or
+*                                        parallel collection is disabled.
+* @retval BVIEW_STATUS_FAILURE           if the pool can not be set up.
+*
+* @notes    Number of workers is BVIEW_BST_COLLECT_WORKERS of feature.h.
+*           ops must stay valid as long as the plugin is loaded.
+*
+*
+*********************************************************************/
+BVIEW_STATUS sbplugin_bst_collect_init (const BVIEW_BST_COLLECT_OPS_t *ops);
+
+/*********************************************************************
+* @brief  Number of snapshot collection workers
+*
+* @retval   number of workers, 0 if parallel collection is disabled
+*
+* @notes    none
+*
+*
+*********************************************************************/
+unsigned int sbplugin_bst_collect_workers_get (void);
+
+/*********************************************************************
+* @brief  Sync the stat ids of the selected realms
+*
+* @param[in]   asic                  - unit
+* @param[in]   realmMask             - mask of realms to be synced
+* @param[out]  numSynced             - number of stat ids synced, can
+*                                      be NULL
+*
+* @retval BVIEW_STATUS_FAILURE           if a stat sync is failed.
+* @retval BVIEW_STATUS_SUCCESS           if all stat ids are synced.
+*
+* @notes    A stat id shared by realms is synced once.
+*
+*
+*********************************************************************/
+BVIEW_STATUS sbplugin_bst_realm_sync (int asic,
+                                 BVIEW_BST_REALM_MASK_t realmMask,
+                                 unsigned int *numSynced);
+
+/*********************************************************************
+* @brief  Run one snapshot collection cycle
+*
+* @param[in]      asic               - unit
+* @param[in]      realmMask          - mask of realms to be read
+* @param[out]     snapshot           - snapshot data structure
+* @param[out]     time               - time
+* @param[out]     realmTime          - sampling window of every realm
+*                                      read, can be NULL
+*
+* @retval BVIEW_STATUS_INVALID_PARAMETER if asic is invalid.
+* @retval BVIEW_STATUS_FAILURE           if sync or any realm get is failed.
+* @retval BVIEW_STATUS_SUCCESS           if all realms are read.
+*
+* @notes    The stat ids of all the selected realms are synced once
+*           up front, then the realms are read without syncing,
+*           in parallel if collection workers are configured.
+*
+*
+*********************************************************************/
+BVIEW_STATUS sbplugin_bst_collect_cycle (int asic,
+                                 BVIEW_BST_REALM_MASK_t realmMask,
+                                 BVIEW_BST_ASIC_SNAPSHOT_DATA_t *snapshot,
+                                 BVIEW_TIME_t *time,
+                                 BVIEW_BST_REALM_TIME_t *realmTime);
+
+/*********************************************************************
+* @brief  Obtain the timing of the snapshot collection cycles
+*
+* @param[in]   asic                  - unit
+* @param[out]  stats                 - collection cycle timing
+*
+* @retval BVIEW_STATUS_INVALID_PARAMETER if input data is invalid.
+* @retval BVIEW_STATUS_SUCCESS           if stats get is success.
+*
+* @notes    none
+*
+*
+*********************************************************************/
+BVIEW_STATUS sbplugin_bst_collect_stats_get (int asic,
+                                 BVIEW_BST_COLLECT_STATS_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INCLUDE_SBPLUGIN_BST_COLLECT_H */
@@ -63,6 +63,9 @@ extern "C"
         /** Get Port String from Port Number*/
         BVIEW_STATUS(*system_port_translate_to_notation_cb) (int asic, int port, char *dst);        
 
+        /** Get cached Port String and its length from Port Number */
+        BVIEW_STATUS(*system_port_notation_get_cb) (int asic, int port, const char **notation, int *length);
+
     } BVIEW_SB_SYSTEM_FEATURE_t;
 
 #ifdef __cplusplus
@@ -17,6 +17,8 @@
   ***************************************************************************/
 
 #include <stdbool.h>
+#include <string.h>
+#include <pthread.h>
 #include "bst.h"
 #include "sbplugin_common_bst.h"
 #include "sbplugin_common_system.h"
@@ -27,7 +29,180 @@
 
 /* HW Trigger Callback handle from Applciation*/
 static BVIEW_BST_TRIGGER_CALLBACK_t        bst_hw_trigger_cb;
+
+/* SDK stat id of a counter type*/
+typedef struct _bst_stat_map_
+{
+  int   bid;
+  /* counters are per front panel port*/
+  bool  perPort;
+} BVIEW_BST_STAT_MAP_t;
+
+static const BVIEW_BST_STAT_MAP_t bstStatMap[BVIEW_BST_STAT_MAX] =
+{
+  /* BVIEW_BST_STAT_DEVICE */
+  {SB_BRCM_BST_STAT_ID_DEVICE, false},
+  /* BVIEW_BST_STAT_ING_PORT_PG_SHARED */
+  {SB_BRCM_BST_STAT_ID_PRI_GROUP_SHARED, true},
+  /* BVIEW_BST_STAT_ING_PORT_PG_HEADROOM */
+  {SB_BRCM_BST_STAT_ID_PRI_GROUP_HEADROOM, true},
+  /* BVIEW_BST_STAT_ING_PORT_SP_SHARED */
+  {SB_BRCM_BST_STAT_ID_PORT_POOL, true},
+  /* BVIEW_BST_STAT_ING_SP_SHARED */
+  {SB_BRCM_BST_STAT_ID_ING_POOL, false},
+  /* BVIEW_BST_STAT_EGR_PORT_SP_UC_SHARED */
+  {SB_BRCM_BST_STAT_ID_EGR_UCAST_PORT_SHARED, true},
+  /* BVIEW_BST_STAT_EGR_PORT_SP_SHARED */
+  {SB_BRCM_BST_STAT_ID_EGR_PORT_SHARED, true},
+  /* BVIEW_BST_STAT_EGR_SP_SHARED */
+  {SB_BRCM_BST_STAT_ID_EGR_POOL, false},
+  /* BVIEW_BST_STAT_EGR_SP_MC_SHARED */
+  {SB_BRCM_BST_STAT_ID_EGR_MCAST_POOL, false},
+  /* BVIEW_BST_STAT_EGR_UC_QUEUE */
+  {SB_BRCM_BST_STAT_ID_UCAST, true},
+  /* BVIEW_BST_STAT_EGR_UC_QUEUE_GROUP */
+  {SB_BRCM_BST_STAT_ID_UCAST_GROUP, false},
+  /* BVIEW_BST_STAT_EGR_MC_QUEUE */
+  {SB_BRCM_BST_STAT_ID_MCAST, true},
+  /* BVIEW_BST_STAT_EGR_CPU_QUEUE */
+  {SB_BRCM_BST_STAT_ID_MCAST, false},
+  /* BVIEW_BST_STAT_EGR_RQE_QUEUE */
+  {SB_BRCM_BST_STAT_ID_RQE_QUEUE, false}
+};
+
+/* Stat ids synced for a realm */
+static const BVIEW_BST_COLLECT_REALM_SYNC_t bstRealmSync[BVIEW_BST_NUM_REALMS] =
+{
+  {BVIEW_BST_REALM_DEVICE, 1, {SB_BRCM_BST_STAT_ID_DEVICE}},
+  {BVIEW_BST_REALM_INGRESS_PORT_PG, 2,
+   {SB_BRCM_BST_STAT_ID_PRI_GROUP_SHARED, SB_BRCM_BST_STAT_ID_PRI_GROUP_HEADROOM}},
+  {BVIEW_BST_REALM_INGRESS_PORT_SP, 1, {SB_BRCM_BST_STAT_ID_PORT_POOL}},
+  {BVIEW_BST_REALM_INGRESS_SP, 1, {SB_BRCM_BST_STAT_ID_ING_POOL}},
+  {BVIEW_BST_REALM_EGRESS_PORT_SP, 2,
+   {SB_BRCM_BST_STAT_ID_EGR_PORT_SHARED, SB_BRCM_BST_STAT_ID_EGR_UCAST_PORT_SHARED}},
+  {BVIEW_BST_REALM_EGRESS_SP, 2,
+   {SB_BRCM_BST_STAT_ID_EGR_POOL, SB_BRCM_BST_STAT_ID_EGR_MCAST_POOL}},
+  {BVIEW_BST_REALM_EGRESS_UC_QUEUE, 1, {SB_BRCM_BST_STAT_ID_UCAST}},
+  {BVIEW_BST_REALM_EGRESS_UC_QUEUEGROUPS, 1, {SB_BRCM_BST_STAT_ID_UCAST_GROUP}},
+  {BVIEW_BST_REALM_EGRESS_MC_QUEUE, 1, {SB_BRCM_BST_STAT_ID_MCAST}},
+  /* CPU queues are MC queues of the CPU port */
+  {BVIEW_BST_REALM_EGRESS_CPU_QUEUE, 1, {SB_BRCM_BST_STAT_ID_MCAST}},
+  {BVIEW_BST_REALM_EGRESS_RQE_QUEUE, 1, {SB_BRCM_BST_STAT_ID_RQE_QUEUE}}
+};
+
+/* Shadow copy of the thresholds programmed on a unit. Thresholds are
+ * written through to the shadow when they are set, so that threshold
+ * get does not read back every profile from HW*/
+typedef struct _bst_threshold_shadow_
+{
+  pthread_mutex_t                  lock;
+  /* shadow is seeded from HW by the first threshold get*/
+  bool                             valid;
+  BVIEW_BST_ASIC_SNAPSHOT_DATA_t   data;
+} BVIEW_BST_THRESHOLD_SHADOW_t;
+
+static BVIEW_BST_THRESHOLD_SHADOW_t bstThresholdShadow[BVIEW_MAX_ASICS_ON_A_PLATFORM];
+
+/* Write a threshold programmed in HW through to the shadow, entries
+ * out of _inRange are not part of the threshold snapshot*/
+#define BVIEW_BST_SHADOW_SET(_asic,_inRange,_field,_value)                  \
+              if (_inRange)                                                 \
+              {                                                             \
+                pthread_mutex_lock (&bstThresholdShadow[(_asic)].lock);     \
+                bstThresholdShadow[(_asic)].data._field = (_value);         \
+                pthread_mutex_unlock (&bstThresholdShadow[(_asic)].lock);   \
+              }
+
+/* Entry of a per index threshold is in the snapshot*/
+#define BVIEW_BST_SHADOW_INDEX_RANGE(_index,_max)                           \
+              (((_index) >= 0) && ((_index) < (_max)))
+
+/* Entry of a per (port, pg) threshold is in the snapshot*/
+#define BVIEW_BST_SHADOW_PORT_PG_RANGE(_port,_pg)                           \
+              (((_port) > 0) && ((_port) <= BVIEW_ASIC_MAX_PORTS) &&         \
+               BVIEW_BST_SHADOW_INDEX_RANGE ((_pg), BVIEW_ASIC_MAX_PRIORITY_GROUPS))
+
+/* Entry of a per (port, sp) threshold is in the snapshot*/
+#define BVIEW_BST_SHADOW_PORT_SP_RANGE(_port,_sp)                           \
+              (((_port) > 0) && ((_port) <= BVIEW_ASIC_MAX_PORTS) &&         \
+               BVIEW_BST_SHADOW_INDEX_RANGE ((_sp), BVIEW_ASIC_MAX_SERVICE_POOLS))
+
+static BVIEW_STATUS sbplugin_common_bst_threshold_read (int asic,
+                              BVIEW_BST_ASIC_SNAPSHOT_DATA_t *thresholdSnapshot);
+
+/* Realm readers, the stat ids are synced by the callers*/
+static BVIEW_STATUS sbplugin_common_bst_device_data_read (int asic, 
+                                    BVIEW_BST_DEVICE_DATA_t *data, 
+                                    BVIEW_TIME_t *time);
+
+static BVIEW_STATUS sbplugin_common_bst_ippg_data_read (int asic, 
+                              BVIEW_BST_INGRESS_PORT_PG_DATA_t *data, 
+                              BVIEW_TIME_t *time);
+
+static BVIEW_STATUS sbplugin_common_bst_ipsp_data_read (int asic, 
+                                  BVIEW_BST_INGRESS_PORT_SP_DATA_t *data, 
+                                  BVIEW_TIME_t *time);
+
+static BVIEW_STATUS sbplugin_common_bst_isp_data_read (int asic, 
+                                 BVIEW_BST_INGRESS_SP_DATA_t *data, 
+                                 BVIEW_TIME_t *time);
+
+static BVIEW_STATUS sbplugin_common_bst_epsp_data_read (int asic, 
+                                BVIEW_BST_EGRESS_PORT_SP_DATA_t *data, 
+                                BVIEW_TIME_t *time);
+
+static BVIEW_STATUS sbplugin_common_bst_esp_data_read (int asic, 
+                               BVIEW_BST_EGRESS_SP_DATA_t *data, 
+                               BVIEW_TIME_t *time);
+
+static BVIEW_STATUS sbplugin_common_bst_eucq_data_read (int asic, 
+                              BVIEW_BST_EGRESS_UC_QUEUE_DATA_t *data, 
+                              BVIEW_TIME_t *time);
+
+static BVIEW_STATUS sbplugin_common_bst_eucqg_data_read (int asic, 
+                        BVIEW_BST_EGRESS_UC_QUEUEGROUPS_DATA_t *data, 
+                        BVIEW_TIME_t *time);
+
+static BVIEW_STATUS sbplugin_common_bst_emcq_data_read (int asic, 
+                              BVIEW_BST_EGRESS_MC_QUEUE_DATA_t *data, 
+                              BVIEW_TIME_t *time);
+
+static BVIEW_STATUS sbplugin_common_bst_cpuq_data_read (int asic, 
+                             BVIEW_BST_EGRESS_CPU_QUEUE_DATA_t *data, 
+                             BVIEW_TIME_t *time);
+
+static BVIEW_STATUS sbplugin_common_bst_rqeq_data_read (int asic, 
+                                   BVIEW_BST_EGRESS_RQE_QUEUE_DATA_t *data, 
+                                   BVIEW_TIME_t *time);
  
+/*********************************************************************
+* @brief  Sync a stat id for the snapshot collection
+*
+* @param[in]   asic                  - unit
+* @param[in]   bid                   - BST stat id
+*
+* @retval BVIEW_STATUS_FAILURE           if sync is failed.
+* @retval BVIEW_STATUS_SUCCESS           if sync is success.
+*
+* @notes    none
+*
+*
+*********************************************************************/
+static BVIEW_STATUS sbplugin_common_bst_collect_stat_sync (int asic, int bid)
+{
+  BVIEW_BST_STAT_SYNC (asic, bid);
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/* Hooks of the SDK for the snapshot collection */
+static const BVIEW_BST_COLLECT_OPS_t bstCollectOps =
+{
+  BVIEW_MAX_ASICS_ON_A_PLATFORM,
+  bstRealmSync,
+  sbplugin_common_bst_collect_stat_sync,
+  sbplugin_common_bst_realm_get
+};
+
 /*********************************************************************
 * @brief  BCM SDK BST feature init
 *
@@ -44,6 +219,8 @@ static BVIEW_BST_TRIGGER_CALLBACK_t        bst_hw_trigger_cb;
 *********************************************************************/
 BVIEW_STATUS sbplugin_common_bst_init (BVIEW_SB_BST_FEATURE_t *bcmBst)
 {
+  unsigned int asic = 0;
+
   /* NULL Pointer check*/
   BVIEW_NULLPTR_CHECK (bcmBst);
 
@@ -53,6 +230,8 @@ BVIEW_STATUS sbplugin_common_bst_init (BVIEW_SB_BST_FEATURE_t *bcmBst)
   bcmBst->bst_config_set_cb           = sbplugin_common_bst_config_set;
   bcmBst->bst_config_get_cb           = sbplugin_common_bst_config_get;
   bcmBst->bst_snapshot_get_cb         = sbplugin_common_bst_snapshot_get;
+  bcmBst->bst_stat_bulk_get_cb        = sbplugin_common_bst_stat_bulk_get;
+  bcmBst->bst_collect_stats_get_cb    = sbplugin_bst_collect_stats_get;
   bcmBst->bst_device_data_get_cb      = sbplugin_common_bst_device_data_get;
   bcmBst->bst_ippg_data_get_cb        = sbplugin_common_bst_ippg_data_get;
   bcmBst->bst_ipsp_data_get_cb        = sbplugin_common_bst_ipsp_data_get;
@@ -76,10 +255,28 @@ BVIEW_STATUS sbplugin_common_bst_init (BVIEW_SB_BST_FEATURE_t *bcmBst)
   bcmBst->bst_cpuq_threshold_set_cb   = sbplugin_common_bst_cpuq_threshold_set;
   bcmBst->bst_rqeq_threshold_set_cb   = sbplugin_common_bst_rqeq_threshold_set;
   bcmBst->bst_threshold_get_cb        = sbplugin_common_bst_threshold_get;
+  bcmBst->bst_threshold_verify_cb     = sbplugin_common_bst_threshold_verify;
+  bcmBst->bst_threshold_bulk_set_cb   = sbplugin_common_bst_threshold_bulk_set;
   bcmBst->bst_clear_stats_cb          = sbplugin_common_bst_clear_stats;
   bcmBst->bst_clear_thresholds_cb     = sbplugin_common_bst_clear_thresholds;
   bcmBst->bst_register_trigger_cb     = sbplugin_common_bst_register_trigger;
 
+  /* Shadow of the thresholds is seeded by the first threshold get*/
+  BVIEW_BST_ITER (asic, BVIEW_MAX_ASICS_ON_A_PLATFORM)
+  {
+    bstThresholdShadow[asic].valid = false;
+    if (pthread_mutex_init (&bstThresholdShadow[asic].lock, NULL) != 0)
+    {
+      return BVIEW_STATUS_FAILURE;
+    }
+  }
+
+  /* Start the snapshot collection workers, if configured */
+  if (sbplugin_bst_collect_init (&bstCollectOps) != BVIEW_STATUS_SUCCESS)
+  {
+    return BVIEW_STATUS_FAILURE;
+  }
+
   return BVIEW_STATUS_SUCCESS;
 }
 
@@ -215,105 +412,227 @@ BVIEW_STATUS sbplugin_common_bst_config_get (int asic, BVIEW_BST_CONFIG_t *data)
 * @brief  Obtain Complete ASIC Statistics Report
 *
 * @param[in]      asic               - unit
+* @param[in]      realmMask          - mask of realms to be read
 * @param[out]     snapshot           - snapshot data structure
 * @param[out]     time               - time
+* @param[out]     realmTime          - sampling window of every realm
+*                                      read, can be NULL
 *
 * @retval BVIEW_STATUS_INVALID_PARAMETER if input data is invalid.
 * @retval BVIEW_STATUS_FAILURE           if snapshot get is failed.
 * @retval BVIEW_STATUS_SUCCESS           if snapshot get is success.
 *
-* @notes    none
+* @notes    Realms not in realmMask are neither synced nor read.
+*           The stat ids of the realms are synced once per snapshot.
+*           With more than one collection worker configured the
+*           realms are read in parallel.
 *
 *
 *********************************************************************/
 BVIEW_STATUS sbplugin_common_bst_snapshot_get (int asic, 
+                                 BVIEW_BST_REALM_MASK_t realmMask,
                                  BVIEW_BST_ASIC_SNAPSHOT_DATA_t *snapshot, 
-                                 BVIEW_TIME_t *time)
+                                 BVIEW_TIME_t *time,
+                                 BVIEW_BST_REALM_TIME_t *realmTime)
 {
-  BVIEW_STATUS rv = BVIEW_STATUS_SUCCESS;
-
-
   /* Check validity of input data*/
   BVIEW_BST_INPUT_VALIDATE (asic, snapshot, time);
 
-  /* Obtain Device Statistics */ 
-  rv = sbplugin_common_bst_device_data_get (asic, &snapshot->device, time);
-  if (rv != BVIEW_STATUS_SUCCESS)
-  {
-    return BVIEW_STATUS_FAILURE;
-  }
+  return sbplugin_bst_collect_cycle (asic, realmMask, snapshot, time,
+                                     realmTime);
+}
 
-  /* Obtain Ingress Port + Priority Groups Statistics */
-  rv = sbplugin_common_bst_ippg_data_get (asic, &snapshot->iPortPg, time);
-  if (rv != BVIEW_STATUS_SUCCESS)
-  {
-    return BVIEW_STATUS_FAILURE;
-  }
-  /* Obtain Ingress Port + Service Pools Statistics */
-  rv = sbplugin_common_bst_ipsp_data_get (asic, &snapshot->iPortSp, time);
-  if (rv != BVIEW_STATUS_SUCCESS)
+/*********************************************************************
+* @brief  Obtain Statistics of one realm of the snapshot
+*
+* @param[in]      asic               - unit
+* @param[in]      realm              - realm to be read
+* @param[out]     snapshot           - snapshot data structure
+* @param[out]     time               - time
+*
+* @retval BVIEW_STATUS_INVALID_PARAMETER if realm is invalid.
+* @retval BVIEW_STATUS_FAILURE           if realm stat get is failed.
+* @retval BVIEW_STATUS_SUCCESS           if realm stat get is success.
+*
+* @notes    Only the section of the snapshot owned by the realm is
+*           written. Realms can be read concurrently. The stat ids of
+*           the realm are not synced, the caller syncs them.
+*
+*
+*********************************************************************/
+BVIEW_STATUS sbplugin_common_bst_realm_get (int asic, 
+                                 BVIEW_BST_REALM_t realm,
+                                 BVIEW_BST_ASIC_SNAPSHOT_DATA_t *snapshot, 
+                                 BVIEW_TIME_t *time)
+{
+  switch (realm)
   {
-    return BVIEW_STATUS_FAILURE;
-  }
+    /* Obtain Device Statistics */ 
+    case BVIEW_BST_REALM_DEVICE:
+      return sbplugin_common_bst_device_data_read (asic, &snapshot->device, time);
 
-  /* Obtain Ingress Service Pools Statistics */
-  rv = sbplugin_common_bst_isp_data_get (asic, &snapshot->iSp,time);
-  if (rv != BVIEW_STATUS_SUCCESS)
-  {
-    return BVIEW_STATUS_FAILURE;
-  }
+    /* Obtain Ingress Port + Priority Groups Statistics */
+    case BVIEW_BST_REALM_INGRESS_PORT_PG:
+      return sbplugin_common_bst_ippg_data_read (asic, &snapshot->iPortPg, time);
 
-  /* Obtain Egress Port + Service Pools Statistics */
-  rv = sbplugin_common_bst_epsp_data_get (asic, &snapshot->ePortSp, time);
-  if (rv != BVIEW_STATUS_SUCCESS)
-  {
-    return BVIEW_STATUS_FAILURE;
-  }
+    /* Obtain Ingress Port + Service Pools Statistics */
+    case BVIEW_BST_REALM_INGRESS_PORT_SP:
+      return sbplugin_common_bst_ipsp_data_read (asic, &snapshot->iPortSp, time);
 
-  /* Obtain Egress Service Pools Statistics */
-  rv = sbplugin_common_bst_esp_data_get (asic, &snapshot->eSp, time);
-  if (rv != BVIEW_STATUS_SUCCESS)
-  {
-    return BVIEW_STATUS_FAILURE;
+    /* Obtain Ingress Service Pools Statistics */
+    case BVIEW_BST_REALM_INGRESS_SP:
+      return sbplugin_common_bst_isp_data_read (asic, &snapshot->iSp, time);
+
+    /* Obtain Egress Port + Service Pools Statistics */
+    case BVIEW_BST_REALM_EGRESS_PORT_SP:
+      return sbplugin_common_bst_epsp_data_read (asic, &snapshot->ePortSp, time);
+
+    /* Obtain Egress Service Pools Statistics */
+    case BVIEW_BST_REALM_EGRESS_SP:
+      return sbplugin_common_bst_esp_data_read (asic, &snapshot->eSp, time);
+
+    /* Obtain Egress Egress Unicast Queues Statistics */
+    case BVIEW_BST_REALM_EGRESS_UC_QUEUE:
+      return sbplugin_common_bst_eucq_data_read (asic, &snapshot->eUcQ, time);
+
+    /* Obtain Egress Egress Unicast Queue Groups Statistics */
+    case BVIEW_BST_REALM_EGRESS_UC_QUEUEGROUPS:
+      return sbplugin_common_bst_eucqg_data_read (asic, &snapshot->eUcQg, time);
+
+    /* Obtain Egress Egress Multicast Queues Statistics */
+    case BVIEW_BST_REALM_EGRESS_MC_QUEUE:
+      return sbplugin_common_bst_emcq_data_read (asic, &snapshot->eMcQ, time);
+
+    /* Obtain Egress Egress CPU Queues Statistics */
+    case BVIEW_BST_REALM_EGRESS_CPU_QUEUE:
+      return sbplugin_common_bst_cpuq_data_read (asic, &snapshot->cpqQ, time);
+
+    /* Obtain Egress Egress RQE Queues Statistics */
+    case BVIEW_BST_REALM_EGRESS_RQE_QUEUE:
+      return sbplugin_common_bst_rqeq_data_read (asic, &snapshot->rqeQ, time);
+
+    default:
+      return BVIEW_STATUS_INVALID_PARAMETER;
   }
- 
-  /* Obtain Egress Egress Unicast Queues Statistics */
-  rv = sbplugin_common_bst_eucq_data_get (asic, &snapshot->eUcQ, time);
-  if (rv != BVIEW_STATUS_SUCCESS)
+}
+
+/*********************************************************************
+* @brief  Obtain the counters of one counter type in bulk
+*
+* @param[in]      asic               - unit
+* @param[in,out]  bulk               - counter type, port and index
+*                                      range and the counters
+*
+* @retval BVIEW_STATUS_INVALID_PARAMETER if input data is invalid.
+* @retval BVIEW_STATUS_FAILURE           if stat get is failed.
+* @retval BVIEW_STATUS_SUCCESS           if stat get is success.
+*
+* @notes    Counters are read as last synced to the SDK, the caller
+*           syncs the stat ids. The SDK has no matrix read of a stat
+*           id, so the counters are read with one stat get per
+*           (gport, cosq); the gport is looked up once per port.
+*
+*
+*********************************************************************/
+BVIEW_STATUS sbplugin_common_bst_stat_bulk_get (int asic,
+                                 BVIEW_BST_STAT_BULK_t *bulk)
+{
+  const BVIEW_BST_STAT_MAP_t *map;
+  SB_BRCM_GPORT_t gport = 0;
+  unsigned int port = 0, row = 0, index = 0;
+  uint64_t *value;
+  int rv = 0;
+
+  /* Check validity of input data*/
+  BVIEW_BST_INPUT_VALID_CHECK (asic, bulk);
+  if ((bulk->values == NULL) || (bulk->stat >= BVIEW_BST_STAT_MAX) ||
+      (bulk->numPorts == 0))
   {
-    return BVIEW_STATUS_FAILURE;
+    return BVIEW_STATUS_INVALID_PARAMETER;
   }
 
-  /* Obtain Egress Egress Unicast Queue Groups Statistics */
-  rv = sbplugin_common_bst_eucqg_data_get (asic, &snapshot->eUcQg ,time);
-  if (rv != BVIEW_STATUS_SUCCESS)
+  map = &bstStatMap[bulk->stat];
+  if (map->perPort)
   {
-    return BVIEW_STATUS_FAILURE;
+    if ((bulk->firstPort < 1) ||
+        ((bulk->firstPort + bulk->numPorts - 1) > asicDb[asic].scalingParams.numPorts))
+    {
+      return BVIEW_STATUS_INVALID_PARAMETER;
+    }
   }
-
-  /* Obtain Egress Egress Multicast Queues Statistics */
-  rv = sbplugin_common_bst_emcq_data_get (asic, &snapshot->eMcQ, time);
-  if (rv != BVIEW_STATUS_SUCCESS)
+  else if (bulk->numPorts != 1)
   {
-    return BVIEW_STATUS_FAILURE;
+    return BVIEW_STATUS_INVALID_PARAMETER;
   }
 
-  /* Obtain Egress Egress CPU Queues Statistics */
-  rv = sbplugin_common_bst_cpuq_data_get (asic, &snapshot->cpqQ,time);
-  if (rv != BVIEW_STATUS_SUCCESS)
+  /* CPU queues are the MC queues of the CPU port*/
+  if (bulk->stat == BVIEW_BST_STAT_EGR_CPU_QUEUE)
   {
-    return BVIEW_STATUS_FAILURE;
+    SB_BRCM_CPU_PORT_GET (asic, &port);
+    rv = SB_BRCM_PORT_MAP_GPORT_GET (asic, port, &gport);
+    if (SB_BRCM_RV_ERROR(rv))
+    {
+      return BVIEW_STATUS_FAILURE;
+    }
   }
 
-  /* Obtain Egress Egress RQE Queues Statistics */
-  rv = sbplugin_common_bst_rqeq_data_get (asic, &snapshot->rqeQ, time);
-  if (rv != BVIEW_STATUS_SUCCESS)
+  BVIEW_BST_ITER (row, bulk->numPorts)
   {
-    return BVIEW_STATUS_FAILURE;
+    if (map->perPort)
+    {
+      port = bulk->firstPort + row;
+      rv = SB_BRCM_PORT_MAP_GPORT_GET (asic, port, &gport);
+      if (SB_BRCM_RV_ERROR(rv))
+      {
+        return BVIEW_STATUS_FAILURE;
+      }
+    }
+
+    value = bulk->values + (row * bulk->portStride);
+    BVIEW_BST_ITER (index, bulk->numIndex)
+    {
+      rv = SB_BRCM_API_COSQ_BST_STAT_GET (asic, gport, index, map->bid, 0, value);
+      if (SB_BRCM_RV_ERROR(rv))
+      {
+        SB_SDK_LOG (BVIEW_LOG_ERROR,
+                    "BST:Unit(%d) Stat(%d) Port(%d) Index(%d):\
+                     Failed to get Buffer Use-Count.", asic, bulk->stat, port, index);
+        return BVIEW_STATUS_FAILURE;
+      }
+      value += bulk->indexStride;
+    }
   }
   return BVIEW_STATUS_SUCCESS;
 }
  
+/*********************************************************************
+* @brief  Read Device Statistics
+*
+* @param[in]   asic             - unit
+* @param[out]  data             - Device data structure
+* @param[out]  time             - time
+*
+* @retval BVIEW_STATUS_FAILURE           if device stat get is failed.
+* @retval BVIEW_STATUS_SUCCESS           if device stat get is success.
+*
+* @notes    Counters are read as last synced to the SDK, the stat ids
+*           of the realm are synced by the caller.
+*
+*
+*********************************************************************/
+static BVIEW_STATUS sbplugin_common_bst_device_data_read (int asic, 
+                                    BVIEW_BST_DEVICE_DATA_t *data, 
+                                    BVIEW_TIME_t *time)
+{
+ /* Update current local time*/
+ sbplugin_common_system_time_get (time);
+
+ /*Get total use-count is expressed in terms of buffers used in the device*/
+ BVIEW_BST_STAT_BULK_GET (asic, BVIEW_BST_STAT_DEVICE, 1, 1,
+                          &data->bufferCount, 0, 0);
+ return BVIEW_STATUS_SUCCESS;
+}
+
 /*********************************************************************
 * @brief  Obtain Device Statistics
 *
@@ -333,27 +652,58 @@ BVIEW_STATUS sbplugin_common_bst_device_data_get (int asic,
                                     BVIEW_BST_DEVICE_DATA_t *data, 
                                     BVIEW_TIME_t *time)
 {
- int b_rv         = SB_BRCM_E_NONE;
- BVIEW_STATUS rv  = BVIEW_STATUS_SUCCESS;  
+  /* Check validity of input data*/
+  BVIEW_BST_INPUT_VALIDATE (asic, data, time);
 
- /* Check validity of input data*/
- BVIEW_BST_INPUT_VALIDATE (asic, data, time); 
+  /*call sync to copy HW stats of the realm to SDK*/
+  BVIEW_BST_REALM_SYNC (asic, BVIEW_BST_REALM_DEVICE);
 
- /*call sync function to copy HW stats to SDK*/
- BVIEW_BST_STAT_SYNC (asic, SB_BRCM_BST_STAT_ID_DEVICE);
+  return sbplugin_common_bst_device_data_read (asic, data, time);
+}
 
- /* Update current local time*/
- sbplugin_common_system_time_get (time);
+/*********************************************************************
+* @brief  Read Ingress Port + Priority Groups Statistics
+*
+* @param[in]   asic             - unit
+* @param[out]  data             - i_p_pg data structure
+* @param[out]  time             - time
+*
+* @retval BVIEW_STATUS_FAILURE           if ippg stat get is failed.
+* @retval BVIEW_STATUS_SUCCESS           if ippg stat get is success.
+*
+* @notes    Counters are read as last synced to the SDK, the stat ids
+*           of the realm are synced by the caller.
+*
+*
+*********************************************************************/
+static BVIEW_STATUS sbplugin_common_bst_ippg_data_read (int asic, 
+                              BVIEW_BST_INGRESS_PORT_PG_DATA_t *data, 
+                              BVIEW_TIME_t *time)
+{
+  /* Update current local time*/
+  sbplugin_common_system_time_get (time);
 
- /*Get total use-count is expressed in terms of buffers used in the device*/ 
- b_rv = SB_BRCM_API_COSQ_BST_STAT_GET(asic, 0, 0, SB_BRCM_BST_STAT_ID_DEVICE, 0, &data->bufferCount);
- if (b_rv != SB_BRCM_E_NONE)
- {
-   SB_SDK_LOG (BVIEW_LOG_ERROR,"Failed to get Device level Use-count");
-   return BVIEW_STATUS_FAILURE;
- }
- return rv; 
-}
+  /*BST_Stat for each of the (Ingress Port, PG) UC plus MC
+   * Shared use-counts in units of buffers.
+   */
+  BVIEW_BST_STAT_BULK_GET (asic, BVIEW_BST_STAT_ING_PORT_PG_SHARED,
+                           asicDb[asic].scalingParams.numPorts,
+                           BVIEW_ASIC_MAX_PRIORITY_GROUPS,
+                           &data->data[0][0].umShareBufferCount,
+                           BVIEW_BST_STRIDE (data->data[0]),
+                           BVIEW_BST_STRIDE (data->data[0][0]));
+
+  /* BST_Stat for each of the (Ingress Port, PG) UC plus MC
+   * Headroom use-counts in units of buffers.
+   */
+  BVIEW_BST_STAT_BULK_GET (asic, BVIEW_BST_STAT_ING_PORT_PG_HEADROOM,
+                           asicDb[asic].scalingParams.numPorts,
+                           BVIEW_ASIC_MAX_PRIORITY_GROUPS,
+                           &data->data[0][0].umHeadroomBufferCount,
+                           BVIEW_BST_STRIDE (data->data[0]),
+                           BVIEW_BST_STRIDE (data->data[0][0]));
+  return BVIEW_STATUS_SUCCESS;
+} 
 
 /*********************************************************************
 * @brief  Obtain Ingress Port + Priority Groups Statistics
@@ -374,68 +724,49 @@ BVIEW_STATUS sbplugin_common_bst_ippg_data_get (int asic,
                               BVIEW_BST_INGRESS_PORT_PG_DATA_t *data, 
                               BVIEW_TIME_t *time)
 {
-  SB_BRCM_GPORT_t   gport =0;
-  int           b_rv  = SB_BRCM_E_NONE;
-  unsigned int  port  =0; 
-  unsigned int  pg    =0; 
-  BVIEW_STATUS  rv    = BVIEW_STATUS_SUCCESS;
-
   /* Check validity of input data*/
   BVIEW_BST_INPUT_VALIDATE (asic, data, time);
 
-  /*call sync to copy HW stats to SDK*/
-  BVIEW_BST_STAT_SYNC (asic, SB_BRCM_BST_STAT_ID_PRI_GROUP_SHARED);
+  /*call sync to copy HW stats of the realm to SDK*/
+  BVIEW_BST_REALM_SYNC (asic, BVIEW_BST_REALM_INGRESS_PORT_PG);
 
-  /*call sync to copy HW stats to SDK*/
-  BVIEW_BST_STAT_SYNC (asic, SB_BRCM_BST_STAT_ID_PRI_GROUP_HEADROOM); 
-
-  /* Update current local time*/
-  sbplugin_common_system_time_get (time);
+  return sbplugin_common_bst_ippg_data_read (asic, data, time);
+}
+    
 
-  /* Loop through all the ports*/
-  BVIEW_BST_PORT_ITER (asic, port)
-  {
-    b_rv = SB_BRCM_API_PORT_GPORT_GET(asic, port, &gport);
-    if (b_rv != SB_BRCM_E_NONE)
-    {
-      return BVIEW_STATUS_FAILURE;
-    }
-     
-    /* Loop through all priority groups*/
-    BVIEW_BST_PG_ITER (pg)
-    {
-      /*BST_Stat for each of the (Ingress Port, PG) UC plus MC 
-       * Shared use-counts in units of buffers.
-       */
-      b_rv = SB_BRCM_API_COSQ_BST_STAT_GET (asic, gport, pg, SB_BRCM_BST_STAT_ID_PRI_GROUP_SHARED, 
-                         0, &(data->data[port - 1][pg].umShareBufferCount));
-      if (b_rv != SB_BRCM_E_NONE)
-      {
-         SB_SDK_LOG (BVIEW_LOG_ERROR,
-                           "Failed to get Ingress (Port,PG) Shared buffer \
-                            Use-Count for port(%d) PG(%d)",
-                            port,pg);
-         return BVIEW_STATUS_FAILURE;
-      }
+/*********************************************************************
+* @brief  Read Ingress Port + Service Pools Statistics
+*
+* @param[in]   asic             - unit
+* @param[out]  data             - i_p_sp data structure
+* @param[out]  time             - time
+*
+* @retval BVIEW_STATUS_FAILURE           if ipsp stat get is failed.
+* @retval BVIEW_STATUS_SUCCESS           if ipsp stat get is success.
+*
+* @notes    Counters are read as last synced to the SDK, the stat ids
+*           of the realm are synced by the caller.
+*
+*
+*********************************************************************/
+static BVIEW_STATUS sbplugin_common_bst_ipsp_data_read (int asic, 
+                                  BVIEW_BST_INGRESS_PORT_SP_DATA_t *data, 
+                                  BVIEW_TIME_t *time)
+{
+ /* Update current local time*/
+ sbplugin_common_system_time_get (time);
 
-      /* BST_Stat for each of the (Ingress Port, PG) UC plus MC 
-       * Headroom use-counts in units of buffers.
-       */
-      b_rv = SB_BRCM_API_COSQ_BST_STAT_GET (asic, gport,pg, SB_BRCM_BST_STAT_ID_PRI_GROUP_HEADROOM, 
-                         0, &(data->data[port - 1][pg].umHeadroomBufferCount));
-      if (b_rv != SB_BRCM_E_NONE)
-      {
-         SB_SDK_LOG (BVIEW_LOG_ERROR,
-                           "Failed to get Ingress (Port,PG) Headroom \
-                            buffer Use-Count for port(%d) PG(%d)", 
-                            port,pg);
-         return BVIEW_STATUS_FAILURE;
-      }
-    } /* for (pg = 0; pg < BVI ....*/
-  } /* for (port = 0; port < BVIEW......*/
-  return rv;
-} 
-    
+ /* BST_Stat for each of the 4 SPs Shared use-counts
+  * associated with each Port in units of buffers.
+  */
+ BVIEW_BST_STAT_BULK_GET (asic, BVIEW_BST_STAT_ING_PORT_SP_SHARED,
+                          asicDb[asic].scalingParams.numPorts,
+                          BVIEW_ASIC_MAX_SERVICE_POOLS,
+                          &data->data[0][0].umShareBufferCount,
+                          BVIEW_BST_STRIDE (data->data[0]),
+                          BVIEW_BST_STRIDE (data->data[0][0]));
+ return BVIEW_STATUS_SUCCESS;
+}
 
 /*********************************************************************
 * @brief  Obtain Ingress Port + Service Pools Statistics
@@ -456,47 +787,44 @@ BVIEW_STATUS sbplugin_common_bst_ipsp_data_get (int asic,
                                   BVIEW_BST_INGRESS_PORT_SP_DATA_t *data, 
                                   BVIEW_TIME_t *time)
 {
- SB_BRCM_GPORT_t gport =0;
- int         rv    =0; 
- unsigned int port =0; 
- unsigned int sp =0;
- 
- /* Check validity of input data*/
- BVIEW_BST_INPUT_VALIDATE (asic, data, time);
+  /* Check validity of input data*/
+  BVIEW_BST_INPUT_VALIDATE (asic, data, time);
 
- /*call sync to copy HW stats to SDK*/
- BVIEW_BST_STAT_SYNC (asic, SB_BRCM_BST_STAT_ID_PORT_POOL);
- 
+  /*call sync to copy HW stats of the realm to SDK*/
+  BVIEW_BST_REALM_SYNC (asic, BVIEW_BST_REALM_INGRESS_PORT_SP);
+
+  return sbplugin_common_bst_ipsp_data_read (asic, data, time);
+}
+
+/*********************************************************************
+* @brief  Read Ingress Service Pools Statistics
+*
+* @param[in]   asic             - unit
+* @param[out]  data             - i_sp structure
+* @param[out]  time             - time
+*
+* @retval BVIEW_STATUS_FAILURE           if isp stat get is failed.
+* @retval BVIEW_STATUS_SUCCESS           if isp stat get is success.
+*
+* @notes    Counters are read as last synced to the SDK, the stat ids
+*           of the realm are synced by the caller.
+*
+*
+*********************************************************************/
+static BVIEW_STATUS sbplugin_common_bst_isp_data_read (int asic, 
+                                 BVIEW_BST_INGRESS_SP_DATA_t *data, 
+                                 BVIEW_TIME_t *time)
+{
  /* Update current local time*/
  sbplugin_common_system_time_get (time);
 
- /* Loop through all the ports*/
- BVIEW_BST_PORT_ITER (asic, port)
- {
-   rv = SB_BRCM_API_PORT_GPORT_GET (asic, port, &gport);
-   if (SB_BRCM_RV_ERROR(rv))
-   {
-     return BVIEW_STATUS_FAILURE;
-   }
-   /* BST_Stat for each of the 4 SPs Shared use-counts 
-    * associated with this Port in units of buffers.
-    */
-   BVIEW_BST_SP_ITER (sp)
-   { 
-     rv = SB_BRCM_API_COSQ_BST_STAT_GET (asic, gport,sp, 
-                                 SB_BRCM_BST_STAT_ID_PORT_POOL,
-                                 0,
-                                 &data->data[port - 1][sp].umShareBufferCount);
-     if (SB_BRCM_RV_ERROR(rv))
-     {
-       SB_SDK_LOG (BVIEW_LOG_ERROR,"Failed to get Ingress (Port,SP) \
-                           buffer Use-Count for port(%d) SP(%d)", port,sp);
-       return BVIEW_STATUS_FAILURE;
-     }
-   }
- }
+ /* BST_Stat for each of the 5 Ingress SPs Shared use-counts in units of buffers*/
+ BVIEW_BST_STAT_BULK_GET (asic, BVIEW_BST_STAT_ING_SP_SHARED, 1,
+                          BVIEW_ASIC_MAX_SERVICE_POOLS,
+                          &data->data[0].umShareBufferCount, 0,
+                          BVIEW_BST_STRIDE (data->data[0]));
  return BVIEW_STATUS_SUCCESS;
-}
+} 
 
 /*********************************************************************
 * @brief  Obtain Ingress Service Pools Statistics
@@ -517,31 +845,54 @@ BVIEW_STATUS sbplugin_common_bst_isp_data_get (int asic,
                                  BVIEW_BST_INGRESS_SP_DATA_t *data, 
                                  BVIEW_TIME_t *time)
 {
- int     rv = 0, sp =0;
-
- /* Check validity of input data*/
- BVIEW_BST_INPUT_VALIDATE (asic, data, time);
+  /* Check validity of input data*/
+  BVIEW_BST_INPUT_VALIDATE (asic, data, time);
 
- /*call sync to copy HW stats to SDK*/
- BVIEW_BST_STAT_SYNC (asic, SB_BRCM_BST_STAT_ID_ING_POOL);
+  /*call sync to copy HW stats of the realm to SDK*/
+  BVIEW_BST_REALM_SYNC (asic, BVIEW_BST_REALM_INGRESS_SP);
 
+  return sbplugin_common_bst_isp_data_read (asic, data, time);
+}
+/*********************************************************************
+* @brief  Read Egress Port + Service Pools Statistics
+*
+* @param[in]   asic             - unit
+* @param[out]  data             - e_p_sp data structure
+* @param[out]  time             - time
+*
+* @retval BVIEW_STATUS_FAILURE           if epsp stat get is failed.
+* @retval BVIEW_STATUS_SUCCESS           if epsp stat get is success.
+*
+* @notes    Counters are read as last synced to the SDK, the stat ids
+*           of the realm are synced by the caller.
+*
+*
+*********************************************************************/
+static BVIEW_STATUS sbplugin_common_bst_epsp_data_read (int asic, 
+                                BVIEW_BST_EGRESS_PORT_SP_DATA_t *data, 
+                                BVIEW_TIME_t *time)
+{
  /* Update current local time*/
  sbplugin_common_system_time_get (time);
 
- /* BST_Stat for each of the 5 Ingress SPs Shared use-counts in units of buffers*/
- BVIEW_BST_SP_ITER (sp)
- {
-   rv = SB_BRCM_API_COSQ_BST_STAT_GET (asic, 0 ,sp,SB_BRCM_BST_STAT_ID_ING_POOL,
-                0,&data->data[sp].umShareBufferCount);
-   if (SB_BRCM_RV_ERROR(rv))
-   {
-     SB_SDK_LOG (BVIEW_LOG_ERROR,"Failed to get Ingress (SP) buffer Use-Count \
-                           for SP(%d)", sp);
-     return BVIEW_STATUS_FAILURE;
-   } 
- }
+ /* Obtain Egress Port + Service Pools Statistics - U cast stats*/
+ BVIEW_BST_STAT_BULK_GET (asic, BVIEW_BST_STAT_EGR_PORT_SP_UC_SHARED,
+                          asicDb[asic].scalingParams.numPorts,
+                          BVIEW_ASIC_MAX_SERVICE_POOLS,
+                          &data->data[0][0].ucShareBufferCount,
+                          BVIEW_BST_STRIDE (data->data[0]),
+                          BVIEW_BST_STRIDE (data->data[0][0]));
+
+ /* Obtain Egress Port + Service Pools Statistics - Ucast+Mcast cast stats*/
+ BVIEW_BST_STAT_BULK_GET (asic, BVIEW_BST_STAT_EGR_PORT_SP_SHARED,
+                          asicDb[asic].scalingParams.numPorts,
+                          BVIEW_ASIC_MAX_SERVICE_POOLS,
+                          &data->data[0][0].umShareBufferCount,
+                          BVIEW_BST_STRIDE (data->data[0]),
+                          BVIEW_BST_STRIDE (data->data[0][0]));
  return BVIEW_STATUS_SUCCESS;
-} 
+}
+
 /*********************************************************************
 * @brief  Obtain Egress Port + Service Pools Statistics
 *
@@ -561,59 +912,50 @@ BVIEW_STATUS sbplugin_common_bst_epsp_data_get (int asic,
                                 BVIEW_BST_EGRESS_PORT_SP_DATA_t *data, 
                                 BVIEW_TIME_t *time)
 {
- SB_BRCM_GPORT_t  gport =0;
- int          rv    =0; 
- unsigned int port  =0;
- unsigned int sp =0;
-
- 
- /* Check validity of input data*/
- BVIEW_BST_INPUT_VALIDATE (asic, data, time);
+  /* Check validity of input data*/
+  BVIEW_BST_INPUT_VALIDATE (asic, data, time);
 
- /*call sync to copy HW stats to SDK*/
- BVIEW_BST_STAT_SYNC (asic, SB_BRCM_BST_STAT_ID_EGR_PORT_SHARED);
+  /*call sync to copy HW stats of the realm to SDK*/
+  BVIEW_BST_REALM_SYNC (asic, BVIEW_BST_REALM_EGRESS_PORT_SP);
 
- /*call sync to copy HW stats to SDK*/
- BVIEW_BST_STAT_SYNC (asic, SB_BRCM_BST_STAT_ID_EGR_UCAST_PORT_SHARED);
+  return sbplugin_common_bst_epsp_data_read (asic, data, time);
+}
 
+/*********************************************************************
+* @brief  Read Egress Service Pools Statistics
+*
+* @param[in]   asic             - unit
+* @param[out]  data             - e_sp data structure
+* @param[out]  time             - time
+*
+* @retval BVIEW_STATUS_FAILURE           if esp stat get is failed.
+* @retval BVIEW_STATUS_SUCCESS           if esp stat get is success.
+*
+* @notes    Counters are read as last synced to the SDK, the stat ids
+*           of the realm are synced by the caller.
+*
+*
+*********************************************************************/
+static BVIEW_STATUS sbplugin_common_bst_esp_data_read (int asic, 
+                               BVIEW_BST_EGRESS_SP_DATA_t *data, 
+                               BVIEW_TIME_t *time)
+{
  /* Update current local time*/
  sbplugin_common_system_time_get (time);
 
- /* Loop through all the ports*/
- BVIEW_BST_PORT_ITER (asic, port)
- {
-   rv = SB_BRCM_API_PORT_GPORT_GET (asic, port, &gport);
-   if (SB_BRCM_RV_ERROR(rv))
-   {
-     return BVIEW_STATUS_FAILURE;
-   }
-   BVIEW_BST_SP_ITER (sp)
-   {
-     /* Obtain Egress Port + Service Pools Statistics - U cast stats*/
-     rv = SB_BRCM_API_COSQ_BST_STAT_GET (asic, gport,sp, 
-                                 SB_BRCM_BST_STAT_ID_EGR_UCAST_PORT_SHARED,
-                                 0,
-                                 &data->data[port - 1][sp].ucShareBufferCount);
-     if (SB_BRCM_RV_ERROR(rv))
-     {
-       SB_SDK_LOG (BVIEW_LOG_ERROR,"Failed to get Egress Ucast (Port,SP) buffer \
-                           Use-Count for Port (%d) SP(%d)", port,sp);
-
-       return BVIEW_STATUS_FAILURE;
-     }
-     /* Obtain Egress Port + Service Pools Statistics - Ucast+Mcast cast stats*/
-     rv = SB_BRCM_API_COSQ_BST_STAT_GET (asic, gport,sp, 
-                                 SB_BRCM_BST_STAT_ID_EGR_PORT_SHARED,
-                                 0,
-                                 &data->data[port - 1][sp].umShareBufferCount);
-     if (SB_BRCM_RV_ERROR(rv))
-     {
-       SB_SDK_LOG (BVIEW_LOG_ERROR,"Failed to get Egress Ucast + Mcast (Port,SP) \
-                           buffer Use-Count for Port (%d) SP(%d)", port,sp);
-       return BVIEW_STATUS_FAILURE;
-     }
-   }
- }
+ /* BST_Stat for each of the 4 Egress SPs Shared use-counts in units of buffers.
+  * This use-count includes both UC and MC buffers.
+  */
+ BVIEW_BST_STAT_BULK_GET (asic, BVIEW_BST_STAT_EGR_SP_SHARED, 1,
+                          BVIEW_ASIC_MAX_SERVICE_POOLS,
+                          &data->data[0].umShareBufferCount, 0,
+                          BVIEW_BST_STRIDE (data->data[0]));
+
+ /*BST_Threshold for each of the 4 Egress SP MC Shared use-counts in units of buffers.*/
+ BVIEW_BST_STAT_BULK_GET (asic, BVIEW_BST_STAT_EGR_SP_MC_SHARED, 1,
+                          BVIEW_ASIC_MAX_SERVICE_POOLS,
+                          &data->data[0].mcShareBufferCount, 0,
+                          BVIEW_BST_STRIDE (data->data[0]));
  return BVIEW_STATUS_SUCCESS;
 }
 
@@ -636,46 +978,56 @@ BVIEW_STATUS sbplugin_common_bst_esp_data_get  (int asic,
                                BVIEW_BST_EGRESS_SP_DATA_t *data, 
                                BVIEW_TIME_t *time)
 {
- int           rv = 0; 
- unsigned int  sp =0;
+  /* Check validity of input data*/
+  BVIEW_BST_INPUT_VALIDATE (asic, data, time);
 
- /* Check validity of input data*/
- BVIEW_BST_INPUT_VALIDATE (asic, data, time);
+  /*call sync to copy HW stats of the realm to SDK*/
+  BVIEW_BST_REALM_SYNC (asic, BVIEW_BST_REALM_EGRESS_SP);
 
- /*call sync to copy HW stats to SDK*/
- BVIEW_BST_STAT_SYNC (asic, SB_BRCM_BST_STAT_ID_EGR_POOL);
+  return sbplugin_common_bst_esp_data_read (asic, data, time);
+}
 
-  /*call sync to copy HW stats to SDK*/
- BVIEW_BST_STAT_SYNC (asic, SB_BRCM_BST_STAT_ID_EGR_MCAST_POOL);
+/*********************************************************************
+* @brief  Read Egress Egress Unicast Queues Statistics
+*
+* @param[in]   asic             - unit
+* @param[out]  data             - e_uc_q data structure
+* @param[out]  time             - time
+*
+* @retval BVIEW_STATUS_FAILURE           if eucq stat get is failed.
+* @retval BVIEW_STATUS_SUCCESS           if eucq stat get is success.
+*
+* @notes    Counters are read as last synced to the SDK, the stat ids
+*           of the realm are synced by the caller.
+*
+*
+*********************************************************************/
+static BVIEW_STATUS sbplugin_common_bst_eucq_data_read (int asic, 
+                              BVIEW_BST_EGRESS_UC_QUEUE_DATA_t *data, 
+                              BVIEW_TIME_t *time)
+{
+ unsigned int cosq = 0;
+ unsigned int port  =0;
+ BVIEW_BCM_QUEUE_RANGE_t range;
 
  /* Update current local time*/
  sbplugin_common_system_time_get (time);
 
-  /* Loop through all the ports*/
- BVIEW_BST_SP_ITER (sp)
- {
-   /* BST_Stat for each of the 4 Egress SPs Shared use-counts in units of buffers.
-    * This use-count includes both UC and MC buffers.
-    */
-
-   rv = SB_BRCM_API_COSQ_BST_STAT_GET (asic, 0 ,sp, SB_BRCM_BST_STAT_ID_EGR_POOL,
-          0,&data->data[sp].umShareBufferCount);
-   if (SB_BRCM_RV_ERROR(rv))
-   {
-     SB_SDK_LOG (BVIEW_LOG_ERROR,"Failed to get Egress Ucast+Mcast (SP) buffer \
-                           Use-Count for SP(%d)", sp);
+ /*BST_Stat for the UC queue total use-counts in units of buffers.*/
+ BVIEW_BST_STAT_BULK_GET (asic, BVIEW_BST_STAT_EGR_UC_QUEUE,
+                          asicDb[asic].scalingParams.numPorts,
+                          BVIEW_BST_NUM_COS_PORT,
+                          &data->data[0].ucBufferCount,
+                          BVIEW_BST_NUM_COS_PORT * BVIEW_BST_STRIDE (data->data[0]),
+                          BVIEW_BST_STRIDE (data->data[0]));
 
-     return BVIEW_STATUS_FAILURE;
-   }
-   /*BST_Threshold for each of the 4 Egress SP MC Shared use-counts in units of buffers.*/
-   rv = SB_BRCM_API_COSQ_BST_STAT_GET (asic, 0 ,sp, SB_BRCM_BST_STAT_ID_EGR_MCAST_POOL,
-         0,&data->data[sp].mcShareBufferCount);
-   if (SB_BRCM_RV_ERROR(rv))
+ /* Port of each queue, from the queue range of the port*/
+ BVIEW_BST_PORT_ITER (asic, port)
+ {
+   range = BVIEW_BCM_PORT_UC_QUEUES (asic, port);
+   BVIEW_BST_ITER (cosq, range.count)
    {
-     SB_SDK_LOG (BVIEW_LOG_ERROR,"Failed to get Egress Ucast (SP) buffer \
-                           Use-Count for SP(%d)", sp);
-
-     return BVIEW_STATUS_FAILURE;
+     data->data[range.first + cosq].port = port;
    }
  }
  return BVIEW_STATUS_SUCCESS;
@@ -700,47 +1052,47 @@ BVIEW_STATUS sbplugin_common_bst_eucq_data_get (int asic,
                               BVIEW_BST_EGRESS_UC_QUEUE_DATA_t *data, 
                               BVIEW_TIME_t *time)
 {
- int          rv   = 0; 
- unsigned int cosq = 0;
- SB_BRCM_GPORT_t  gport =0;
- unsigned int port  =0;
-
   /* Check validity of input data*/
- BVIEW_BST_INPUT_VALIDATE (asic, data, time);
+  BVIEW_BST_INPUT_VALIDATE (asic, data, time);
 
- /*call sync to copy HW stats to SDK*/
- BVIEW_BST_STAT_SYNC (asic, SB_BRCM_BST_STAT_ID_UCAST);
+  /*call sync to copy HW stats of the realm to SDK*/
+  BVIEW_BST_REALM_SYNC (asic, BVIEW_BST_REALM_EGRESS_UC_QUEUE);
 
+  return sbplugin_common_bst_eucq_data_read (asic, data, time);
+}
+   
+/*********************************************************************
+* @brief  Read Egress Egress Unicast Queue Groups Statistics
+*
+* @param[in]   asic             - unit
+* @param[out]  data             - e_uc_qg data structure
+* @param[out]  time             - time
+*
+* @retval BVIEW_STATUS_FAILURE           if eucqg stat get is failed.
+* @retval BVIEW_STATUS_SUCCESS           if eucqg stat get is success.
+*
+* @notes    Counters are read as last synced to the SDK, the stat ids
+*           of the realm are synced by the caller.
+*
+*
+*********************************************************************/
+static BVIEW_STATUS sbplugin_common_bst_eucqg_data_read (int asic, 
+                        BVIEW_BST_EGRESS_UC_QUEUEGROUPS_DATA_t *data, 
+                        BVIEW_TIME_t *time)
+{
  /* Update current local time*/
  sbplugin_common_system_time_get (time);
 
- BVIEW_BST_PORT_ITER (asic, port)
- {
-   rv = SB_BRCM_API_PORT_GPORT_GET(asic, port , &gport);
-   if (SB_BRCM_RV_ERROR(rv))
-   {
-     return BVIEW_STATUS_FAILURE;
-   }
-
-   /* Iterate COSQ*/
-   BVIEW_BST_ITER (cosq,BVIEW_BST_NUM_COS_PORT) 
-   {
-     /*BST_Stat for the UC queue total use-counts in units of buffers.*/
-     rv = SB_BRCM_API_COSQ_BST_STAT_GET (asic, gport, cosq, SB_BRCM_BST_STAT_ID_UCAST,
-              0,&data->data[((port - 1) * BVIEW_BST_NUM_COS_PORT) + cosq].ucBufferCount);
-     data->data[((port -1) * BVIEW_BST_NUM_COS_PORT) + cosq].port = port;
-     if (SB_BRCM_RV_ERROR(rv))
-     {
-       SB_SDK_LOG (BVIEW_LOG_ERROR,
-                 "BST:Unit(%d) Ucast queue(%d) Port(%d):\
-                  Failed to get Buffer Use-Count.", asic, cosq, port);
-       return BVIEW_STATUS_FAILURE;
-     }
-   }
- }
+ /* BST_Stat for each of the 128 Egress Unicast Queue-Group
+  * Total use-counts in units of buffers.
+  */
+ BVIEW_BST_STAT_BULK_GET (asic, BVIEW_BST_STAT_EGR_UC_QUEUE_GROUP, 1,
+                          BVIEW_ASIC_MAX_UC_QUEUE_GROUPS,
+                          &data->data[0].ucBufferCount, 0,
+                          BVIEW_BST_STRIDE (data->data[0]));
  return BVIEW_STATUS_SUCCESS;
 }
-   
+
 /*********************************************************************
 * @brief  Obtain Egress Egress Unicast Queue Groups Statistics
 *
@@ -760,32 +1112,56 @@ BVIEW_STATUS sbplugin_common_bst_eucqg_data_get (int asic,
                         BVIEW_BST_EGRESS_UC_QUEUEGROUPS_DATA_t *data, 
                         BVIEW_TIME_t *time)
 {
- int          rv   = 0; 
- unsigned int cosq = 0;
+  /* Check validity of input data*/
+  BVIEW_BST_INPUT_VALIDATE (asic, data, time);
+
+  /*call sync to copy HW stats of the realm to SDK*/
+  BVIEW_BST_REALM_SYNC (asic, BVIEW_BST_REALM_EGRESS_UC_QUEUEGROUPS);
 
- /* Check validity of input data*/
- BVIEW_BST_INPUT_VALIDATE (asic, data, time);
+  return sbplugin_common_bst_eucqg_data_read (asic, data, time);
+}
 
- /*call sync to copy HW stats to SDK*/
- BVIEW_BST_STAT_SYNC (asic, SB_BRCM_BST_STAT_ID_UCAST_GROUP);
+/*********************************************************************
+* @brief  Read Egress Egress Multicast Queues Statistics
+*
+* @param[in]   asic             - unit
+* @param[out]  data             - e_mc_q data structure
+* @param[out]  time             - time
+*
+* @retval BVIEW_STATUS_FAILURE           if emcq stat get is failed.
+* @retval BVIEW_STATUS_SUCCESS           if emcq stat get is success.
+*
+* @notes    Counters are read as last synced to the SDK, the stat ids
+*           of the realm are synced by the caller.
+*
+*
+*********************************************************************/
+static BVIEW_STATUS sbplugin_common_bst_emcq_data_read (int asic, 
+                              BVIEW_BST_EGRESS_MC_QUEUE_DATA_t *data, 
+                              BVIEW_TIME_t *time)
+{
+ unsigned int  cosq =0;
+ unsigned int port  =0;
+ BVIEW_BCM_QUEUE_RANGE_t range;
 
  /* Update current local time*/
  sbplugin_common_system_time_get (time);
 
- /* Loop through all the UC_QUEUE_GROUPS*/
- BVIEW_BST_ITER (cosq, BVIEW_ASIC_MAX_UC_QUEUE_GROUPS)
+ /*BST_Stat for the MC queue total use-counts in units of buffers.*/
+ BVIEW_BST_STAT_BULK_GET (asic, BVIEW_BST_STAT_EGR_MC_QUEUE,
+                          asicDb[asic].scalingParams.numPorts,
+                          BVIEW_BST_NUM_COS_PORT,
+                          &data->data[0].mcBufferCount,
+                          BVIEW_BST_NUM_COS_PORT * BVIEW_BST_STRIDE (data->data[0]),
+                          BVIEW_BST_STRIDE (data->data[0]));
+
+ /* Port of each queue, from the queue range of the port*/
+ BVIEW_BST_PORT_ITER (asic, port)
  {
-   /* BST_Stat for each of the 128 Egress Unicast Queue-Group 
-    * Total use-counts in units of buffers.
-    */
-   rv = SB_BRCM_API_COSQ_BST_STAT_GET(asic, 0 , cosq, SB_BRCM_BST_STAT_ID_UCAST_GROUP,
-             0, &data->data[cosq].ucBufferCount);
-   if (SB_BRCM_RV_ERROR(rv))
+   range = BVIEW_BCM_PORT_MC_QUEUES (asic, port);
+   BVIEW_BST_ITER (cosq, range.count)
    {
-     SB_SDK_LOG (BVIEW_LOG_ERROR,
-                 "BST:Unit(%d) Ucast queue Group(%d):\
-                  Failed to get Buffer Use-Count.", asic, cosq);
-     return BVIEW_STATUS_FAILURE;
+     data->data[range.first + cosq].port = port;
    }
  }
  return BVIEW_STATUS_SUCCESS;
@@ -810,46 +1186,42 @@ BVIEW_STATUS sbplugin_common_bst_emcq_data_get (int asic,
                               BVIEW_BST_EGRESS_MC_QUEUE_DATA_t *data, 
                               BVIEW_TIME_t *time)
 {
- int           rv = 0;
- unsigned int  cosq =0;
- SB_BRCM_GPORT_t  gport =0;
- unsigned int port  =0;
+  /* Check validity of input data*/
+  BVIEW_BST_INPUT_VALIDATE (asic, data, time);
 
- /* Check validity of input data*/
- BVIEW_BST_INPUT_VALIDATE (asic, data, time);
+  /*call sync to copy HW stats of the realm to SDK*/
+  BVIEW_BST_REALM_SYNC (asic, BVIEW_BST_REALM_EGRESS_MC_QUEUE);
 
- /*call sync to copy HW stats to SDK*/
- BVIEW_BST_STAT_SYNC (asic, SB_BRCM_BST_STAT_ID_MCAST);
+  return sbplugin_common_bst_emcq_data_read (asic, data, time);
+}
 
+/*********************************************************************
+* @brief  Read Egress Egress CPU Queues Statistics
+*
+* @param[in]   asic             - unit
+* @param[out]  data             - CPU queue data structure
+* @param[out]  time             - time
+*
+* @retval BVIEW_STATUS_FAILURE           if CPU stat get is failed.
+* @retval BVIEW_STATUS_SUCCESS           if CPU stat get is success.
+*
+* @notes    Counters are read as last synced to the SDK, the stat ids
+*           of the realm are synced by the caller.
+*
+*
+*********************************************************************/
+static BVIEW_STATUS sbplugin_common_bst_cpuq_data_read (int asic, 
+                             BVIEW_BST_EGRESS_CPU_QUEUE_DATA_t *data, 
+                             BVIEW_TIME_t *time)
+{
  /* Update current local time*/
  sbplugin_common_system_time_get (time);
 
- /* Loop through all the ports*/
- BVIEW_BST_PORT_ITER (asic, port)
- {
-   rv = SB_BRCM_API_PORT_GPORT_GET(asic, port, &gport);
-   if (SB_BRCM_RV_ERROR(rv))
-   {
-     return BVIEW_STATUS_FAILURE;
-   }
-   /* Loop through cos queue max per port*/
-   BVIEW_BST_ITER (cosq, BVIEW_BST_NUM_COS_PORT)
-   {
-     /*BST_Stat for the MC queue total use-counts in units of buffers.*/
-     rv = SB_BRCM_API_COSQ_BST_STAT_GET (asic, gport, cosq, SB_BRCM_BST_STAT_ID_MCAST,
-          0, &data->data[((port -1) * BVIEW_BST_NUM_COS_PORT) + cosq].mcBufferCount);
-
-     data->data[((port-1) * BVIEW_BST_NUM_COS_PORT) + cosq].port = port;
-     if (SB_BRCM_RV_ERROR(rv))
-     {
-       SB_SDK_LOG (BVIEW_LOG_ERROR,
-                 "BST:Unit(%d) Mcast queue(%d) Port(%d):\
-                  Failed to get Buffer Use-Count.", asic, cosq, port);
-
-       return BVIEW_STATUS_FAILURE;
-     }
-   }
- }
+ /*The BST_Threshold for the Egress CPU queues in units of buffers.*/
+ BVIEW_BST_STAT_BULK_GET (asic, BVIEW_BST_STAT_EGR_CPU_QUEUE, 1,
+                          BVIEW_ASIC_MAX_CPU_QUEUES,
+                          &data->data[0].cpuBufferCount, 0,
+                          BVIEW_BST_STRIDE (data->data[0]));
  return BVIEW_STATUS_SUCCESS;
 }
 
@@ -872,43 +1244,42 @@ BVIEW_STATUS sbplugin_common_bst_cpuq_data_get (int asic,
                              BVIEW_BST_EGRESS_CPU_QUEUE_DATA_t *data, 
                              BVIEW_TIME_t *time)
 {
- int          rv   = 0; 
- unsigned int cosq = 0;
- unsigned int port = 0;
- SB_BRCM_GPORT_t gport = 0;
-
- /* Check validity of input data*/
- BVIEW_BST_INPUT_VALIDATE (asic, data, time);
-
- /*call sync to copy HW stats to SDK*/
- BVIEW_BST_STAT_SYNC (asic, SB_BRCM_BST_STAT_ID_MCAST);
+  /* Check validity of input data*/
+  BVIEW_BST_INPUT_VALIDATE (asic, data, time);
 
- /*Get the CPU port*/
- SB_BRCM_CPU_PORT_GET(asic, &port);
+  /*call sync to copy HW stats of the realm to SDK*/
+  BVIEW_BST_REALM_SYNC (asic, BVIEW_BST_REALM_EGRESS_CPU_QUEUE);
 
- rv = SB_BRCM_API_PORT_GPORT_GET(asic, port, &gport);
- if (SB_BRCM_RV_ERROR(rv))
- {
-   return BVIEW_STATUS_FAILURE;
- }
+  return sbplugin_common_bst_cpuq_data_read (asic, data, time);
+}
 
+/*********************************************************************
+* @brief  Read Egress Egress RQE Queues Statistics 
+*
+* @param[in]   asic             - unit
+* @param[out]  data             - RQE data data structure
+* @param[out]  time             - time
+*
+* @retval BVIEW_STATUS_FAILURE           if RQE stat get is failed.
+* @retval BVIEW_STATUS_SUCCESS           if RQE stat get is success.
+*
+* @notes    Counters are read as last synced to the SDK, the stat ids
+*           of the realm are synced by the caller.
+*
+*
+*********************************************************************/
+static BVIEW_STATUS sbplugin_common_bst_rqeq_data_read (int asic, 
+                                   BVIEW_BST_EGRESS_RQE_QUEUE_DATA_t *data, 
+                                   BVIEW_TIME_t *time)
+{
  /* Update current local time*/
  sbplugin_common_system_time_get (time);
 
- /* iterate through Maximum CPU cosqs*/
- BVIEW_BST_ITER (cosq, BVIEW_ASIC_MAX_CPU_QUEUES)
- {
-   /*The BST_Threshold for the Egress CPU queues in units of buffers.*/
-   rv = SB_BRCM_API_COSQ_BST_STAT_GET (asic, gport, cosq, SB_BRCM_BST_STAT_ID_MCAST,
-                    0, &data->data[cosq].cpuBufferCount);
-
-   if (SB_BRCM_RV_ERROR(rv))
-   {
-     SB_SDK_LOG (BVIEW_LOG_ERROR,
-                 "BST:ASIC(%d) CPU queue (%d):Failed to get Buffer Use-Count.", asic, cosq);
-     return BVIEW_STATUS_FAILURE;
-   }
- }
+ /* BST_Stat for each of the 11 RQE queues total use-counts in units of buffers.*/
+ BVIEW_BST_STAT_BULK_GET (asic, BVIEW_BST_STAT_EGR_RQE_QUEUE, 1,
+                          BVIEW_ASIC_MAX_RQE_QUEUES,
+                          &data->data[0].rqeBufferCount, 0,
+                          BVIEW_BST_STRIDE (data->data[0]));
  return BVIEW_STATUS_SUCCESS;
 }
 
@@ -929,34 +1300,15 @@ BVIEW_STATUS sbplugin_common_bst_cpuq_data_get (int asic,
 *********************************************************************/
 BVIEW_STATUS sbplugin_common_bst_rqeq_data_get (int asic, 
                                    BVIEW_BST_EGRESS_RQE_QUEUE_DATA_t *data, 
-                                   BVIEW_TIME_t *time) 
+                                   BVIEW_TIME_t *time)
 {
- int          rv   = 0; 
- unsigned int cosq = 0;
-
- /* Check validity of input data*/
- BVIEW_BST_INPUT_VALIDATE (asic, data, time);
-
- /*call sync to copy HW stats to SDK*/
- BVIEW_BST_STAT_SYNC (asic, SB_BRCM_BST_STAT_ID_RQE_QUEUE);
+  /* Check validity of input data*/
+  BVIEW_BST_INPUT_VALIDATE (asic, data, time);
 
- /* Update current local time*/
- sbplugin_common_system_time_get (time);
+  /*call sync to copy HW stats of the realm to SDK*/
+  BVIEW_BST_REALM_SYNC (asic, BVIEW_BST_REALM_EGRESS_RQE_QUEUE);
 
- /* Loop through all the RQE queues*/
- BVIEW_BST_ITER (cosq, BVIEW_ASIC_MAX_RQE_QUEUES)
- {
-   /* BST_Stat for each of the 11 RQE queues total use-counts in units of buffers.*/
-   rv = SB_BRCM_API_COSQ_BST_STAT_GET (asic, 0 , cosq, SB_BRCM_BST_STAT_ID_RQE_QUEUE,
-             0,&data->data[cosq].rqeBufferCount);
-   if (SB_BRCM_RV_ERROR(rv))
-   {
-     SB_SDK_LOG (BVIEW_LOG_ERROR,
-                 "BST:ASIC(%d) RQE queue (%d):Failed to get Buffer Use-Count.", asic, cosq);
-     return BVIEW_STATUS_FAILURE;
-   }
- }
- return BVIEW_STATUS_SUCCESS;
+  return sbplugin_common_bst_rqeq_data_read (asic, data, time);
 }
 
 /*********************************************************************
@@ -997,6 +1349,8 @@ BVIEW_STATUS sbplugin_common_bst_device_threshold_set (int asic,
                 "BST:ASIC(%d) Device Stat:Failed to set Threshold",asic);
     return BVIEW_STATUS_FAILURE;
   }
+  /* Write through to the threshold shadow*/
+  BVIEW_BST_SHADOW_SET (asic, true, device.bufferCount, thres->threshold);
   return BVIEW_STATUS_SUCCESS;
 }
 
@@ -1037,7 +1391,7 @@ BVIEW_STATUS sbplugin_common_bst_ippg_threshold_set (int asic, int port, int pg,
 
   /* Get the GPORT */
   /* Temp fix: Application port numbering starts with 1 but SDK expects it from 0 */
-  rv = SB_BRCM_API_PORT_GPORT_GET (asic, port, &gport);
+  rv = SB_BRCM_PORT_MAP_GPORT_GET (asic, port, &gport);
   if (SB_BRCM_RV_ERROR(rv))
   {
     return BVIEW_STATUS_INVALID_PARAMETER;
@@ -1052,6 +1406,11 @@ BVIEW_STATUS sbplugin_common_bst_ippg_threshold_set (int asic, int port, int pg,
                 "BST:ASIC(%d) Ingress Shared (Port, PG) PG(%d) Port(%d):Failed to set Threshold", asic,pg,port);
     return BVIEW_STATUS_FAILURE;
   }
+  /* Write through to the threshold shadow*/
+  BVIEW_BST_SHADOW_SET (asic, BVIEW_BST_SHADOW_PORT_PG_RANGE (port, pg),
+                        iPortPg.data[port - 1][pg].umShareBufferCount,
+                        thres->umShareThreshold);
+
  /* set threshold for headroom buffer stats*/
   profile.byte = thres->umHeadroomThreshold;
   rv = SB_BRCM_COSQ_BST_PROFILE_SET (asic, gport, pg, SB_BRCM_BST_STAT_ID_PRI_GROUP_HEADROOM, &profile);
@@ -1061,6 +1420,9 @@ BVIEW_STATUS sbplugin_common_bst_ippg_threshold_set (int asic, int port, int pg,
                 "BST:ASIC(%d) Ingress Headroom (Port, PG) PG(%d) Port(%d):Failed to set Threshold", asic,pg,port);
     return BVIEW_STATUS_FAILURE;
   }
+  BVIEW_BST_SHADOW_SET (asic, BVIEW_BST_SHADOW_PORT_PG_RANGE (port, pg),
+                        iPortPg.data[port - 1][pg].umHeadroomBufferCount,
+                        thres->umHeadroomThreshold);
 
   return BVIEW_STATUS_SUCCESS;
 }
@@ -1102,7 +1464,7 @@ BVIEW_STATUS sbplugin_common_bst_ipsp_threshold_set (int asic, int port, int sp,
  
   /* Get the GPORT*/
   /* Temp fix: Application port numbering starts with 1 but SDK expects it from 0 */
-  rv = SB_BRCM_API_PORT_GPORT_GET (asic, port, &gport);
+  rv = SB_BRCM_PORT_MAP_GPORT_GET (asic, port, &gport);
   if (SB_BRCM_RV_ERROR(rv))
   {
     return BVIEW_STATUS_INVALID_PARAMETER;
@@ -1117,6 +1479,10 @@ BVIEW_STATUS sbplugin_common_bst_ipsp_threshold_set (int asic, int port, int sp,
                 "BST:ASIC (%d) Ingress(Port, SP) SP(%d) Port(%d):Failed to set Threshold", asic,sp,port);
     return BVIEW_STATUS_FAILURE;
   }
+  /* Write through to the threshold shadow*/
+  BVIEW_BST_SHADOW_SET (asic, BVIEW_BST_SHADOW_PORT_SP_RANGE (port, sp),
+                        iPortSp.data[port - 1][sp].umShareBufferCount,
+                        thres->umShareThreshold);
   return BVIEW_STATUS_SUCCESS;
 }
 
@@ -1162,6 +1528,9 @@ BVIEW_STATUS sbplugin_common_bst_isp_threshold_set (int asic,
                 "BST:ASIC(%d) Ingress SP(%d):Failed to set Threshold", asic,sp);
     return BVIEW_STATUS_FAILURE;
   }
+  /* Write through to the threshold shadow*/
+  BVIEW_BST_SHADOW_SET (asic, BVIEW_BST_SHADOW_INDEX_RANGE (sp, BVIEW_ASIC_MAX_SERVICE_POOLS),
+                        iSp.data[sp].umShareBufferCount, thres->umShareThreshold);
   return BVIEW_STATUS_SUCCESS;
 }
 
@@ -1204,7 +1573,7 @@ BVIEW_STATUS sbplugin_common_bst_epsp_threshold_set (int asic,
 
   /* Get the GPORT*/  
   /* Temp fix: Application port numbering starts with 1 but SDK expects it from 0 */
-  rv = SB_BRCM_API_PORT_GPORT_GET (asic, port, &gport);
+  rv = SB_BRCM_PORT_MAP_GPORT_GET (asic, port, &gport);
   if (SB_BRCM_RV_ERROR(rv))
   {
     return BVIEW_STATUS_INVALID_PARAMETER;
@@ -1222,6 +1591,10 @@ BVIEW_STATUS sbplugin_common_bst_epsp_threshold_set (int asic,
                 "BST:ASIC(%d) Egress UC(Port,SP) SP(%d) Port(%d):Failed to set Threshold", asic,sp, port);
     return BVIEW_STATUS_FAILURE;
   }
+  /* Write through to the threshold shadow*/
+  BVIEW_BST_SHADOW_SET (asic, BVIEW_BST_SHADOW_PORT_SP_RANGE (port, sp),
+                        ePortSp.data[port - 1][sp].ucShareBufferCount,
+                        thres->ucShareThreshold);
 
  /* The BST_Threshold for the Egress Per (Port, SP) 
   * MC/UC+MC shared use-count in units of buffers.
@@ -1235,6 +1608,9 @@ BVIEW_STATUS sbplugin_common_bst_epsp_threshold_set (int asic,
                 "BST:ASIC(%d) Egress UC+MC (Port,SP) SP(%d) Port(%d):Failed to set Threshold", asic,sp, port);
     return BVIEW_STATUS_FAILURE;
   }
+  BVIEW_BST_SHADOW_SET (asic, BVIEW_BST_SHADOW_PORT_SP_RANGE (port, sp),
+                        ePortSp.data[port - 1][sp].umShareBufferCount,
+                        thres->umShareThreshold);
 
   return BVIEW_STATUS_SUCCESS;
 }
@@ -1281,6 +1657,9 @@ BVIEW_STATUS sbplugin_common_bst_esp_threshold_set (int asic,
                 "BST:ASIC(%d) Egress SP (%d):Failed to set Threshold", asic,sp);
     return BVIEW_STATUS_FAILURE;
   }
+  /* Write through to the threshold shadow*/
+  BVIEW_BST_SHADOW_SET (asic, BVIEW_BST_SHADOW_INDEX_RANGE (sp, BVIEW_ASIC_MAX_SERVICE_POOLS),
+                        eSp.data[sp].umShareBufferCount, thres->umShareThreshold);
 
   /* BST_Threshold for each of the 4 Egress SPs Shared use-counts in units of buffers.*/
   profile.byte = thres->mcShareThreshold;
@@ -1291,6 +1670,8 @@ BVIEW_STATUS sbplugin_common_bst_esp_threshold_set (int asic,
                 "BST:ASIC(%d) Egress SP (%d):Failed to set Threshold", asic,sp);
     return BVIEW_STATUS_FAILURE;
   }
+  BVIEW_BST_SHADOW_SET (asic, BVIEW_BST_SHADOW_INDEX_RANGE (sp, BVIEW_ASIC_MAX_SERVICE_POOLS),
+                        eSp.data[sp].mcShareBufferCount, thres->mcShareThreshold);
 
   return BVIEW_STATUS_SUCCESS;
 }
@@ -1331,7 +1712,7 @@ BVIEW_STATUS sbplugin_common_bst_eucq_threshold_set (int asic,
  
   cosq = ucQueue % BVIEW_BST_NUM_COS_PORT;
   port = ucQueue/BVIEW_BST_NUM_COS_PORT;
-  rv = SB_BRCM_API_PORT_GPORT_GET (asic, (port+1), &gport);
+  rv = SB_BRCM_PORT_MAP_GPORT_GET (asic, (port+1), &gport);
   if (SB_BRCM_RV_ERROR(rv))
   {
     return BVIEW_STATUS_INVALID_PARAMETER;
@@ -1346,6 +1727,9 @@ BVIEW_STATUS sbplugin_common_bst_eucq_threshold_set (int asic,
                 "BST:ASIC(%d) Ucast Queue (%d):Failed to set Threshold", asic,ucQueue);
     return BVIEW_STATUS_FAILURE;
   }
+  /* Write through to the threshold shadow*/
+  BVIEW_BST_SHADOW_SET (asic, BVIEW_BST_SHADOW_INDEX_RANGE (ucQueue, BVIEW_ASIC_MAX_UC_QUEUES),
+                        eUcQ.data[ucQueue].ucBufferCount, thres->ucBufferThreshold);
   
   return BVIEW_STATUS_SUCCESS;
 }
@@ -1392,6 +1776,9 @@ BVIEW_STATUS sbplugin_common_bst_eucqg_threshold_set (int asic,
                 "BST:ASIC(%d) Ucast Queue Group (%d):Failed to set Threshold", asic,ucQueueGrp);
     return BVIEW_STATUS_FAILURE;
   }
+  /* Write through to the threshold shadow*/
+  BVIEW_BST_SHADOW_SET (asic, BVIEW_BST_SHADOW_INDEX_RANGE (ucQueueGrp, BVIEW_ASIC_MAX_UC_QUEUE_GROUPS),
+                        eUcQg.data[ucQueueGrp].ucBufferCount, thres->ucBufferThreshold);
   
   return BVIEW_STATUS_SUCCESS;
 }
@@ -1433,7 +1820,7 @@ BVIEW_STATUS sbplugin_common_bst_emcq_threshold_set (int asic,
 
   cosq = mcQueue % BVIEW_BST_NUM_COS_PORT;
   port = mcQueue/BVIEW_BST_NUM_COS_PORT;
-  rv = SB_BRCM_API_PORT_GPORT_GET (asic, (port+1), &gport);
+  rv = SB_BRCM_PORT_MAP_GPORT_GET (asic, (port+1), &gport);
 
   profile.byte = thres->mcBufferThreshold;  
   rv = SB_BRCM_COSQ_BST_PROFILE_SET (asic, gport, cosq, SB_BRCM_BST_STAT_ID_MCAST, &profile);
@@ -1443,6 +1830,9 @@ BVIEW_STATUS sbplugin_common_bst_emcq_threshold_set (int asic,
                 "BST:ASIC(%d) Mcast Queue (%d):Failed to set Threshold", asic,mcQueue);
     return BVIEW_STATUS_FAILURE;
   }
+  /* Write through to the threshold shadow*/
+  BVIEW_BST_SHADOW_SET (asic, BVIEW_BST_SHADOW_INDEX_RANGE (mcQueue, BVIEW_ASIC_MAX_MC_QUEUES),
+                        eMcQ.data[mcQueue].mcBufferCount, thres->mcBufferThreshold);
   return BVIEW_STATUS_SUCCESS;
 }
 
@@ -1484,7 +1874,7 @@ BVIEW_STATUS sbplugin_common_bst_cpuq_threshold_set (int asic,
 
   /* get CPU port*/
   SB_BRCM_CPU_PORT_GET(asic, &port);
-  rv = SB_BRCM_API_PORT_GPORT_GET(asic, port, &gport);
+  rv = SB_BRCM_PORT_MAP_GPORT_GET(asic, port, &gport);
   if (SB_BRCM_RV_ERROR(rv))
   {
     return BVIEW_STATUS_FAILURE;
@@ -1501,6 +1891,9 @@ BVIEW_STATUS sbplugin_common_bst_cpuq_threshold_set (int asic,
                 "BST:ASIC(%d) CPU Queue (%d):Failed to set Threshold", asic,cpuQueue);
     return BVIEW_STATUS_FAILURE;
   }
+  /* Write through to the threshold shadow*/
+  BVIEW_BST_SHADOW_SET (asic, BVIEW_BST_SHADOW_INDEX_RANGE (cpuQueue, BVIEW_ASIC_MAX_CPU_QUEUES),
+                        cpqQ.data[cpuQueue].cpuBufferCount, thres->cpuBufferThreshold);
   
   return BVIEW_STATUS_SUCCESS;
 }
@@ -1548,9 +1941,104 @@ BVIEW_STATUS sbplugin_common_bst_rqeq_threshold_set (int asic,
                 "BST:ASIC(%d) RQE Queue (%d):Failed to set Threshold", asic,rqeQueue);
     return BVIEW_STATUS_FAILURE;
   }
+  /* Write through to the threshold shadow*/
+  BVIEW_BST_SHADOW_SET (asic, BVIEW_BST_SHADOW_INDEX_RANGE (rqeQueue, BVIEW_ASIC_MAX_RQE_QUEUES),
+                        rqeQ.data[rqeQueue].rqeBufferCount, thres->rqeBufferThreshold);
   return BVIEW_STATUS_SUCCESS;
 }
 
+/*********************************************************************
+* @brief  Set threshold configuration of many realm entries in
+*         one batch
+*
+* @param[in]     asic                   - unit
+* @param[in,out] entries                - Realm entries and thresholds,
+*                                         status of each entry
+* @param[in]     numEntries             - Number of entries
+*
+* @retval BVIEW_STATUS_INVALID_PARAMETER if input data is invalid.
+* @retval BVIEW_STATUS_FAILURE           if threshold set of an entry
+*                                        is failed.
+* @retval BVIEW_STATUS_SUCCESS           if thresholds of all entries
+*                                        are set.
+*
+* @notes    A failed entry does not stop the batch.
+*
+*
+*********************************************************************/
+BVIEW_STATUS sbplugin_common_bst_threshold_bulk_set (int asic,
+                              BVIEW_BST_THRESHOLD_BULK_ENTRY_t *entries,
+                              unsigned int numEntries)
+{
+  BVIEW_BST_THRESHOLD_BULK_ENTRY_t *entry;
+  BVIEW_STATUS rv = BVIEW_STATUS_SUCCESS;
+  unsigned int index = 0;
+
+  /*validate ASIC*/
+  BVIEW_UNIT_CHECK (asic);
+  BVIEW_NULLPTR_CHECK (entries);
+
+  for (index = 0; index < numEntries; index++)
+  {
+    entry = &entries[index];
+    switch (entry->realm)
+    {
+      case BVIEW_BST_REALM_DEVICE:
+        entry->status = sbplugin_common_bst_device_threshold_set (asic,
+                                  &entry->threshold.device);
+        break;
+      case BVIEW_BST_REALM_INGRESS_PORT_PG:
+        entry->status = sbplugin_common_bst_ippg_threshold_set (asic, entry->port,
+                                  entry->index, &entry->threshold.ippg);
+        break;
+      case BVIEW_BST_REALM_INGRESS_PORT_SP:
+        entry->status = sbplugin_common_bst_ipsp_threshold_set (asic, entry->port,
+                                  entry->index, &entry->threshold.ipsp);
+        break;
+      case BVIEW_BST_REALM_INGRESS_SP:
+        entry->status = sbplugin_common_bst_isp_threshold_set (asic,
+                                  entry->index, &entry->threshold.isp);
+        break;
+      case BVIEW_BST_REALM_EGRESS_PORT_SP:
+        entry->status = sbplugin_common_bst_epsp_threshold_set (asic, entry->port,
+                                  entry->index, &entry->threshold.epsp);
+        break;
+      case BVIEW_BST_REALM_EGRESS_SP:
+        entry->status = sbplugin_common_bst_esp_threshold_set (asic,
+                                  entry->index, &entry->threshold.esp);
+        break;
+      case BVIEW_BST_REALM_EGRESS_UC_QUEUE:
+        entry->status = sbplugin_common_bst_eucq_threshold_set (asic,
+                                  entry->index, &entry->threshold.eucq);
+        break;
+      case BVIEW_BST_REALM_EGRESS_UC_QUEUEGROUPS:
+        entry->status = sbplugin_common_bst_eucqg_threshold_set (asic,
+                                  entry->index, &entry->threshold.eucqg);
+        break;
+      case BVIEW_BST_REALM_EGRESS_MC_QUEUE:
+        entry->status = sbplugin_common_bst_emcq_threshold_set (asic,
+                                  entry->index, &entry->threshold.emcq);
+        break;
+      case BVIEW_BST_REALM_EGRESS_CPU_QUEUE:
+        entry->status = sbplugin_common_bst_cpuq_threshold_set (asic,
+                                  entry->index, &entry->threshold.cpuq);
+        break;
+      case BVIEW_BST_REALM_EGRESS_RQE_QUEUE:
+        entry->status = sbplugin_common_bst_rqeq_threshold_set (asic,
+                                  entry->index, &entry->threshold.rqeq);
+        break;
+      default:
+        entry->status = BVIEW_STATUS_INVALID_PARAMETER;
+        break;
+    }
+    if (entry->status != BVIEW_STATUS_SUCCESS)
+    {
+      rv = BVIEW_STATUS_FAILURE;
+    }
+  }
+  return rv;
+}
+
 /*********************************************************************
 * @brief  Clear stats
 *           
@@ -1627,7 +2115,7 @@ BVIEW_STATUS  sbplugin_common_bst_clear_stats(int asic)
     BVIEW_BST_PORT_ITER (asic, port)
     {
        /* Get GPORT*/
-       SB_BRCM_API_PORT_GPORT_GET (asic, port, &gport);
+       SB_BRCM_PORT_MAP_GPORT_GET (asic, port, &gport);
 
 
        BVIEW_BST_ITER (cosq, num)
@@ -1653,7 +2141,8 @@ BVIEW_STATUS  sbplugin_common_bst_clear_stats(int asic)
 * @retval BVIEW_STATUS_FAILURE           if restore is succes.
 * @retval BVIEW_STATUS_SUCCESS           if restore set is failed.
 *
-* @notes    none
+* @notes    Shadow of the thresholds is seeded again from HW by
+*           the next threshold get.
 *
 *
 *********************************************************************/
@@ -1668,6 +2157,11 @@ BVIEW_STATUS  sbplugin_common_bst_clear_thresholds  (int asic)
    /*validate ASIC*/
   BVIEW_UNIT_CHECK (asic);
 
+  /* Thresholds are restored to defaults, drop the shadow*/
+  pthread_mutex_lock (&bstThresholdShadow[asic].lock);
+  bstThresholdShadow[asic].valid = false;
+  pthread_mutex_unlock (&bstThresholdShadow[asic].lock);
+
   /*Configure Default The BST_Threshold for Device Use-Countin units of buffers.*/
   profile.byte =  BVIEW_BST_DEVICE_THRES_DEFAULT ;
   rv = SB_BRCM_COSQ_BST_PROFILE_SET (asic, 0, 0, SB_BRCM_BST_STAT_ID_DEVICE, &profile);
@@ -1682,7 +2176,7 @@ BVIEW_STATUS  sbplugin_common_bst_clear_thresholds  (int asic)
     if (!SB_BRCM_IS_XE_PORT (asic, port))
       continue;
 
-    rv = SB_BRCM_API_PORT_GPORT_GET (asic, port, &gport); 
+    rv = SB_BRCM_PORT_MAP_GPORT_GET (asic, port, &gport); 
     if (SB_BRCM_RV_ERROR(rv))
     {
       return BVIEW_STATUS_FAILURE;
@@ -1799,7 +2293,7 @@ BVIEW_STATUS  sbplugin_common_bst_clear_thresholds  (int asic)
   }
   /* Get CPU port*/
   SB_BRCM_CPU_PORT_GET(asic, &port);
-  rv = SB_BRCM_API_PORT_GPORT_GET(asic, port, &gport);
+  rv = SB_BRCM_PORT_MAP_GPORT_GET(asic, port, &gport);
   if (SB_BRCM_RV_ERROR(rv))
   {
    return BVIEW_STATUS_FAILURE;
@@ -1895,7 +2389,8 @@ BVIEW_STATUS  sbplugin_common_bst_register_trigger (int asic,
 * @retval BVIEW_STATUS_FAILURE           if snapshot is succes.
 * @retval BVIEW_STATUS_SUCCESS           if snapshot set is failed.
 *
-* @notes    none
+* @notes    Thresholds are served from the shadow. HW is read only
+*           to seed the shadow.
 *
 *
 *********************************************************************/
@@ -1903,21 +2398,129 @@ BVIEW_STATUS sbplugin_common_bst_threshold_get (int asic,
                               BVIEW_BST_ASIC_SNAPSHOT_DATA_t *thresholdSnapshot,
                               BVIEW_TIME_t *time)
 {
-  SB_BRCM_COSQ_BST_PROFILE_t profile;
-  unsigned int           port = 0;
-  unsigned int           index =0;
-  SB_BRCM_GPORT_t        gport = 0;
-  int                    rv = 0;                   
+  BVIEW_BST_THRESHOLD_SHADOW_t *shadow;
+  BVIEW_STATUS rv = BVIEW_STATUS_SUCCESS;
+
+   /*validate ASIC*/
+  BVIEW_UNIT_CHECK (asic);
+
+  /* Check validity of input data*/
+  BVIEW_NULLPTR_CHECK (thresholdSnapshot);
+
+   /* Update current local time*/
+  sbplugin_common_system_time_get (time);
+
+  shadow = &bstThresholdShadow[asic];
+  pthread_mutex_lock (&shadow->lock);
+  if (shadow->valid == false)
+  {
+    /* Seed the shadow from HW*/
+    memset (&shadow->data, 0, sizeof (BVIEW_BST_ASIC_SNAPSHOT_DATA_t));
+    rv = sbplugin_common_bst_threshold_read (asic, &shadow->data);
+    shadow->valid = (rv == BVIEW_STATUS_SUCCESS) ? true : false;
+  }
+  if (shadow->valid == true)
+  {
+    memcpy (thresholdSnapshot, &shadow->data, sizeof (BVIEW_BST_ASIC_SNAPSHOT_DATA_t));
+  }
+  pthread_mutex_unlock (&shadow->lock);
+
+  return rv;
+}
+
+/*********************************************************************
+* @brief  Read snapshot of all thresholds configured from HW and
+*         verify the shadow of the thresholds
+*
+*
+* @param  [in]  asic                         - unit
+* @param  [out] thresholdSnapshot            - Threshold snapshot
+*                                              data structure
+* @param  [out] time                         - Time
+* @param  [out] mismatches                   - Number of thresholds
+*                                              that differ from shadow
+*
+* @retval BVIEW_STATUS_INVALID_PARAMETER if input data is invalid.
+* @retval BVIEW_STATUS_FAILURE           if HW read is failed.
+* @retval BVIEW_STATUS_SUCCESS           if HW read is success.
+*
+* @notes    Shadow is replaced with the thresholds read from HW.
+*           A shadow which is not seeded yet has no mismatches.
+*
+*
+*********************************************************************/
+BVIEW_STATUS sbplugin_common_bst_threshold_verify (int asic, 
+                              BVIEW_BST_ASIC_SNAPSHOT_DATA_t *thresholdSnapshot,
+                              BVIEW_TIME_t *time,
+                              unsigned int *mismatches)
+{
+  BVIEW_BST_THRESHOLD_SHADOW_t *shadow;
+  BVIEW_STATUS rv = BVIEW_STATUS_SUCCESS;
+  const uint64_t *hw, *sw;
+  unsigned int index = 0;
 
    /*validate ASIC*/
   BVIEW_UNIT_CHECK (asic);
 
   /* Check validity of input data*/
   BVIEW_NULLPTR_CHECK (thresholdSnapshot);
+  BVIEW_NULLPTR_CHECK (mismatches);
 
    /* Update current local time*/
   sbplugin_common_system_time_get (time);
 
+  *mismatches = 0;
+  shadow = &bstThresholdShadow[asic];
+  pthread_mutex_lock (&shadow->lock);
+  memset (thresholdSnapshot, 0, sizeof (BVIEW_BST_ASIC_SNAPSHOT_DATA_t));
+  rv = sbplugin_common_bst_threshold_read (asic, thresholdSnapshot);
+  if (rv == BVIEW_STATUS_SUCCESS)
+  {
+    if (shadow->valid == true)
+    {
+      /* snapshot holds only 64 bit counters, compare them one by one*/
+      hw = (const uint64_t *) thresholdSnapshot;
+      sw = (const uint64_t *) &shadow->data;
+      BVIEW_BST_ITER (index, BVIEW_BST_STRIDE (BVIEW_BST_ASIC_SNAPSHOT_DATA_t))
+      {
+        if (hw[index] != sw[index])
+        {
+          (*mismatches)++;
+        }
+      }
+    }
+    memcpy (&shadow->data, thresholdSnapshot, sizeof (BVIEW_BST_ASIC_SNAPSHOT_DATA_t));
+    shadow->valid = true;
+  }
+  pthread_mutex_unlock (&shadow->lock);
+
+  return rv;
+}
+
+/*********************************************************************
+* @brief  Read snapshot of all thresholds configured from HW
+*
+*
+* @param  [in]  asic                         - unit
+* @param  [out] thresholdSnapshot            - Threshold snapshot
+*                                              data structure
+*
+* @retval BVIEW_STATUS_FAILURE           if profile get is failed.
+* @retval BVIEW_STATUS_SUCCESS           if all profiles are read.
+*
+* @notes    Reads every profile of the unit from HW.
+*
+*
+*********************************************************************/
+static BVIEW_STATUS sbplugin_common_bst_threshold_read (int asic, 
+                              BVIEW_BST_ASIC_SNAPSHOT_DATA_t *thresholdSnapshot)
+{
+  SB_BRCM_COSQ_BST_PROFILE_t profile;
+  unsigned int           port = 0;
+  unsigned int           index =0;
+  SB_BRCM_GPORT_t        gport = 0;
+  int                    rv = 0;                   
+
   /* Device wide threshold configuration*/
   rv = SB_BRCM_COSQ_BST_PROFILE_GET(asic, 0, 0, SB_BRCM_BST_STAT_ID_DEVICE, &profile);
   if (SB_BRCM_RV_ERROR(rv))
@@ -1933,7 +2536,7 @@ BVIEW_STATUS sbplugin_common_bst_threshold_get (int asic,
      continue;
 
     /* Get GPORT */
-    rv = SB_BRCM_API_PORT_GPORT_GET(asic, port, &gport); 
+    rv = SB_BRCM_PORT_MAP_GPORT_GET(asic, port, &gport); 
     if (SB_BRCM_RV_ERROR(rv))
     {
       return BVIEW_STATUS_FAILURE;
@@ -2058,7 +2661,7 @@ BVIEW_STATUS sbplugin_common_bst_threshold_get (int asic,
 
   /* Get CPU queues threshold configuration*/
   SB_BRCM_CPU_PORT_GET(asic, &port);
-  rv = SB_BRCM_API_PORT_GPORT_GET(asic, port, &gport);
+  rv = SB_BRCM_PORT_MAP_GPORT_GET(asic, port, &gport);
   if (SB_BRCM_RV_ERROR(rv))
   {
    return BVIEW_STATUS_FAILURE;
@@ -2117,44 +2720,106 @@ BVIEW_STATUS sbplugin_common_bst_threshold_get (int asic,
 * @retval BVIEW_STATUS_FAILURE           if HW trigger process is success.
 * @retval BVIEW_STATUS_SUCCESS           if failed to handle trigger.
 *
-* @notes    none
+* @notes    The realm, port and index of the counter which crossed
+*           the threshold are passed to the application.
 *
 *
 *********************************************************************/
 BVIEW_STATUS sbplugin_common_bst_callback (int asic, SB_BRCM_SWITCH_EVENT_t event, 
                        int bid, int port, int cosq, void *cookie)
 {
-  BVIEW_BST_TRIGGER_TYPE triggerType = BVIEW_BST_TRIGGER_DEVICE;
+  BVIEW_BST_TRIGGER_INFO_t triggerInfo;
 
   /* Call application Callback registered with plugin*/ 
   if (event == SB_BRCM_SWITCH_EVENT_MMU_BST_TRIGGER) 
   {
-    /* Map BID to Ingress, Egress or Device*/
+    memset (&triggerInfo, 0, sizeof (BVIEW_BST_TRIGGER_INFO_t));
+    triggerInfo.type = BVIEW_BST_TRIGGER_DEVICE;
+
+    /* SDK port number is same as application port number*/
+    BVIEW_BCM_PORT_GET (port);
+
+    /* Map BID to Ingress, Egress or Device and to the realm of the
+       counter, index is same as that of the threshold of the realm*/
     if (bid == SB_BRCM_BST_STAT_ID_DEVICE)
     {
-      triggerType = BVIEW_BST_TRIGGER_DEVICE;
+      triggerInfo.type = BVIEW_BST_TRIGGER_DEVICE;
+      triggerInfo.realm = BVIEW_BST_REALM_DEVICE;
     }
     else if (bid == SB_BRCM_BST_STAT_ID_EGR_POOL||
-           bid == SB_BRCM_BST_STAT_ID_EGR_MCAST_POOL ||
-           bid == SB_BRCM_BST_STAT_ID_UCAST ||
-           bid == SB_BRCM_BST_STAT_ID_MCAST ||
-           bid == SB_BRCM_BST_STAT_ID_EGR_UCAST_PORT_SHARED ||
-           bid == SB_BRCM_BST_STAT_ID_EGR_PORT_SHARED ||
-           bid == SB_BRCM_BST_STAT_ID_RQE_QUEUE ||
-           bid == SB_BRCM_BST_STAT_ID_RQE_POOL ||
-           bid == SB_BRCM_BST_STAT_ID_UCAST_GROUP)
+           bid == SB_BRCM_BST_STAT_ID_EGR_MCAST_POOL)
+    {
+      triggerInfo.type = BVIEW_BST_TRIGGER_EGRESS;
+      triggerInfo.realm = BVIEW_BST_REALM_EGRESS_SP;
+      triggerInfo.index = cosq;
+    }
+    else if (bid == SB_BRCM_BST_STAT_ID_EGR_UCAST_PORT_SHARED ||
+           bid == SB_BRCM_BST_STAT_ID_EGR_PORT_SHARED)
+    {
+      triggerInfo.type = BVIEW_BST_TRIGGER_EGRESS;
+      triggerInfo.realm = BVIEW_BST_REALM_EGRESS_PORT_SP;
+      triggerInfo.port = port;
+      triggerInfo.index = cosq;
+    }
+    else if (bid == SB_BRCM_BST_STAT_ID_UCAST)
+    {
+      triggerInfo.type = BVIEW_BST_TRIGGER_EGRESS;
+      triggerInfo.realm = BVIEW_BST_REALM_EGRESS_UC_QUEUE;
+      triggerInfo.port = port;
+      triggerInfo.index = ((port - 1) * BVIEW_BST_NUM_COS_PORT) + cosq;
+    }
+    else if (bid == SB_BRCM_BST_STAT_ID_MCAST)
+    {
+      triggerInfo.type = BVIEW_BST_TRIGGER_EGRESS;
+      /* CPU queues are MC queues of the CPU port*/
+      if (port == portMapDb[asic].cpuPort)
+      {
+        triggerInfo.realm = BVIEW_BST_REALM_EGRESS_CPU_QUEUE;
+        triggerInfo.index = cosq;
+      }
+      else
+      {
+        triggerInfo.realm = BVIEW_BST_REALM_EGRESS_MC_QUEUE;
+        triggerInfo.port = port;
+        triggerInfo.index = ((port - 1) * BVIEW_BST_NUM_COS_PORT) + cosq;
+      }
+    }
+    else if (bid == SB_BRCM_BST_STAT_ID_RQE_QUEUE ||
+           bid == SB_BRCM_BST_STAT_ID_RQE_POOL)
+    {
+      triggerInfo.type = BVIEW_BST_TRIGGER_EGRESS;
+      triggerInfo.realm = BVIEW_BST_REALM_EGRESS_RQE_QUEUE;
+      triggerInfo.index = cosq;
+    }
+    else if (bid == SB_BRCM_BST_STAT_ID_UCAST_GROUP)
+    {
+      triggerInfo.type = BVIEW_BST_TRIGGER_EGRESS;
+      triggerInfo.realm = BVIEW_BST_REALM_EGRESS_UC_QUEUEGROUPS;
+      triggerInfo.index = cosq;
+    }
+    else if (bid == SB_BRCM_BST_STAT_ID_ING_POOL)
+    {
+      triggerInfo.type = BVIEW_BST_TRIGGER_INGRESS;
+      triggerInfo.realm = BVIEW_BST_REALM_INGRESS_SP;
+      triggerInfo.index = cosq;
+    }
+    else if (bid == SB_BRCM_BST_STAT_ID_PORT_POOL)
     {
-      triggerType = BVIEW_BST_TRIGGER_EGRESS;
+      triggerInfo.type = BVIEW_BST_TRIGGER_INGRESS;
+      triggerInfo.realm = BVIEW_BST_REALM_INGRESS_PORT_SP;
+      triggerInfo.port = port;
+      triggerInfo.index = cosq;
     }
-    else if (bid == SB_BRCM_BST_STAT_ID_ING_POOL ||
-           bid == SB_BRCM_BST_STAT_ID_PORT_POOL ||
-           bid == SB_BRCM_BST_STAT_ID_PRI_GROUP_SHARED ||
+    else if (bid == SB_BRCM_BST_STAT_ID_PRI_GROUP_SHARED ||
            bid == SB_BRCM_BST_STAT_ID_PRI_GROUP_HEADROOM)
     {
-      triggerType = BVIEW_BST_TRIGGER_INGRESS;
+      triggerInfo.type = BVIEW_BST_TRIGGER_INGRESS;
+      triggerInfo.realm = BVIEW_BST_REALM_INGRESS_PORT_PG;
+      triggerInfo.port = port;
+      triggerInfo.index = cosq;
     }
     /* Call application callback routine*/
-    bst_hw_trigger_cb ((asic), cookie, triggerType);
+    bst_hw_trigger_cb ((asic), cookie, &triggerInfo);
   }
   return BVIEW_STATUS_SUCCESS;
 }
@@ -27,6 +27,7 @@ extern "C"
 #include "broadview.h"
 #include "sbfeature_bst.h"
 #include "sbplugin_bst_map.h"
+#include "sbplugin_bst_collect.h"
 
 
 /** BST feature support ASIC's Mask*/
@@ -63,6 +64,13 @@ extern "C"
                      return BVIEW_STATUS_FAILURE;                          \
                   }  
 
+/* sync the stat ids of the realms in _realmMask to SDK*/
+#define BVIEW_BST_REALM_SYNC(_asic,_realmMask)                             \
+                  if (sbplugin_bst_realm_sync((_asic),(_realmMask),NULL) != BVIEW_STATUS_SUCCESS) \
+                  {                                                        \
+                     return BVIEW_STATUS_FAILURE;                          \
+                  }
+
 /* Macro to iterate all ports*/
 #define  BVIEW_BST_PORT_ITER(_asic,_port)                                         \
               for ((_port) = 1; (_port) <= asicDb[(_asic)].scalingParams.numPorts; (_port)++)
@@ -84,6 +92,21 @@ extern "C"
 #define BVIEW_BST_ITER(_index,_n)                              \
               for ((_index) = 0; (_index) < (_n); (_index)++)
 
+/* Distance between two consecutive _entry's of a realm array, in counters*/
+#define BVIEW_BST_STRIDE(_entry)       (sizeof (_entry) / (sizeof (uint64_t)))
+
+/* Read a counter type of the ports 1.._numPorts in bulk, bail out on failure*/
+#define BVIEW_BST_STAT_BULK_GET(_asic,_stat,_numPorts,_numIndex,_values,_portStride,_indexStride) \
+              {                                                                 \
+                BVIEW_BST_STAT_BULK_t _bulk = {(_stat), 1, (_numPorts), (_numIndex), \
+                                               (_portStride), (_indexStride), (_values)}; \
+                if (sbplugin_common_bst_stat_bulk_get ((_asic), &_bulk) !=      \
+                    BVIEW_STATUS_SUCCESS)                                       \
+                {                                                               \
+                  return BVIEW_STATUS_FAILURE;                                  \
+                }                                                               \
+              }
+
 /*********************************************************************
 * @brief  BCM SDK BST feature init
 *
@@ -136,21 +159,70 @@ BVIEW_STATUS sbplugin_common_bst_config_get (int asic, BVIEW_BST_CONFIG_t *data)
 * @brief  Obtain Complete ASIC Statistics Report
 *
 * @param[in]      asic               - unit
+* @param[in]      realmMask          - mask of realms to be read
 * @param[out]     snapshot           - snapshot data structure
 * @param[out]     time               - time
+* @param[out]     realmTime          - sampling window of every realm
+*                                      read, can be NULL
 *
 * @retval BVIEW_STATUS_INVALID_PARAMETER if input data is invalid.
 * @retval BVIEW_STATUS_FAILURE           if snapshot get is failed.
 * @retval BVIEW_STATUS_SUCCESS           if snapshot get is success.
 *
-* @notes    none
+* @notes    Realms not in realmMask are neither synced nor read.
+*           With more than one collection worker configured the
+*           realms are read in parallel.
 *
 *
 *********************************************************************/
 BVIEW_STATUS sbplugin_common_bst_snapshot_get (int asic, 
+                                 BVIEW_BST_REALM_MASK_t realmMask,
+                                 BVIEW_BST_ASIC_SNAPSHOT_DATA_t *snapshot, 
+                                 BVIEW_TIME_t *time,
+                                 BVIEW_BST_REALM_TIME_t *realmTime);
+
+/*********************************************************************
+* @brief  Obtain Statistics of one realm of the snapshot
+*
+* @param[in]      asic               - unit
+* @param[in]      realm              - realm to be read
+* @param[out]     snapshot           - snapshot data structure
+* @param[out]     time               - time
+*
+* @retval BVIEW_STATUS_INVALID_PARAMETER if realm is invalid.
+* @retval BVIEW_STATUS_FAILURE           if realm stat get is failed.
+* @retval BVIEW_STATUS_SUCCESS           if realm stat get is success.
+*
+* @notes    Only the section of the snapshot owned by the realm is
+*           written. Realms can be read concurrently. The stat ids of
+*           the realm are not synced, the caller syncs them.
+*
+*
+*********************************************************************/
+BVIEW_STATUS sbplugin_common_bst_realm_get (int asic, 
+                                 BVIEW_BST_REALM_t realm,
                                  BVIEW_BST_ASIC_SNAPSHOT_DATA_t *snapshot, 
                                  BVIEW_TIME_t *time);
 
+/*********************************************************************
+* @brief  Obtain the counters of one counter type in bulk
+*
+* @param[in]      asic               - unit
+* @param[in,out]  bulk               - counter type, port and index
+*                                      range and the counters
+*
+* @retval BVIEW_STATUS_INVALID_PARAMETER if input data is invalid.
+* @retval BVIEW_STATUS_FAILURE           if stat get is failed.
+* @retval BVIEW_STATUS_SUCCESS           if stat get is success.
+*
+* @notes    Counters are read as last synced to the SDK, the caller
+*           syncs the stat ids.
+*
+*
+*********************************************************************/
+BVIEW_STATUS sbplugin_common_bst_stat_bulk_get (int asic,
+                                 BVIEW_BST_STAT_BULK_t *bulk);
+
 /*********************************************************************
 * @brief  Obtain Device Statistics
 *
@@ -577,6 +649,29 @@ BVIEW_STATUS sbplugin_common_bst_rqeq_threshold_set (int asic,
                                      int rqeQueue, 
                                      BVIEW_BST_EGRESS_RQE_QUEUE_THRESHOLD_t *thres);
 
+/*********************************************************************
+* @brief  Set threshold configuration of many realm entries in
+*         one batch
+*
+* @param[in]     asic                   - unit
+* @param[in,out] entries                - Realm entries and thresholds,
+*                                         status of each entry
+* @param[in]     numEntries             - Number of entries
+*
+* @retval BVIEW_STATUS_INVALID_PARAMETER if input data is invalid.
+* @retval BVIEW_STATUS_FAILURE           if threshold set of an entry
+*                                        is failed.
+* @retval BVIEW_STATUS_SUCCESS           if thresholds of all entries
+*                                        are set.
+*
+* @notes    A failed entry does not stop the batch.
+*
+*
+*********************************************************************/
+BVIEW_STATUS sbplugin_common_bst_threshold_bulk_set (int asic,
+                              BVIEW_BST_THRESHOLD_BULK_ENTRY_t *entries,
+                              unsigned int numEntries);
+
 /*********************************************************************
 * @brief  Clear stats
 *           
@@ -640,7 +735,8 @@ BVIEW_STATUS  sbplugin_common_bst_register_trigger (int asic,
 * @retval BVIEW_STATUS_FAILURE           if snapshot is succes.
 * @retval BVIEW_STATUS_SUCCESS           if snapshot set is failed.
 *
-* @notes    none
+* @notes    Thresholds are served from the shadow. HW is read only
+*           to seed the shadow.
 *
 *
 *********************************************************************/
@@ -648,6 +744,31 @@ BVIEW_STATUS sbplugin_common_bst_threshold_get (int asic,
                               BVIEW_BST_ASIC_SNAPSHOT_DATA_t *thresholdSnapshot,
                               BVIEW_TIME_t * time);
 
+/*********************************************************************
+* @brief  Read snapshot of all thresholds configured from HW and
+*         verify the shadow of the thresholds
+*
+*
+* @param  [in]  asic                         - unit
+* @param  [out] thresholdSnapshot            - Threshold snapshot
+*                                              data structure
+* @param  [out] time                         - Time
+* @param  [out] mismatches                   - Number of thresholds
+*                                              that differ from shadow
+*
+* @retval BVIEW_STATUS_INVALID_PARAMETER if input data is invalid.
+* @retval BVIEW_STATUS_FAILURE           if HW read is failed.
+* @retval BVIEW_STATUS_SUCCESS           if HW read is success.
+*
+* @notes    Shadow is replaced with the thresholds read from HW.
+*
+*
+*********************************************************************/
+BVIEW_STATUS sbplugin_common_bst_threshold_verify (int asic, 
+                              BVIEW_BST_ASIC_SNAPSHOT_DATA_t *thresholdSnapshot,
+                              BVIEW_TIME_t * time,
+                              unsigned int *mismatches);
+
 /*********************************************************************
 * @brief  callback function to process Hw trigers
 *
@@ -46,6 +46,35 @@ extern "C"
 #define BVIEW_TD2_CPU_COSQ            8
 #define BVIEW_TD2_CELL_TO_BYTE        208
 
+/* Number of COS queues of a front panel port*/
+#define BVIEW_BCM_NUM_COS_PORT        8
+
+/* Maximum length of a port notation string, including the NUL*/
+#define BVIEW_BCM_PORT_NOTATION_LEN   16
+
+/* Range of queues of a port*/
+typedef struct _bview_bcm_queue_range_
+{
+  unsigned int first;
+  unsigned int count;
+} BVIEW_BCM_QUEUE_RANGE_t;
+
+/* Port map of a unit, indexed by application port number. Built once
+ * at init, so that collection and encoding do not call SDK or format a
+ * string per port. Ports are fixed while the agent runs.*/
+typedef struct _bview_bcm_port_map_
+{
+  bool              valid;
+  unsigned int      numPorts;
+  int               cpuPort;
+  SB_BRCM_GPORT_t   cpuGport;
+  SB_BRCM_GPORT_t   gport[BVIEW_ASIC_MAX_PORTS + 1];
+  char              notation[BVIEW_ASIC_MAX_PORTS + 1][BVIEW_BCM_PORT_NOTATION_LEN];
+  int               notationLength[BVIEW_ASIC_MAX_PORTS + 1];
+  BVIEW_BCM_QUEUE_RANGE_t ucQueue[BVIEW_ASIC_MAX_PORTS + 1];
+  BVIEW_BCM_QUEUE_RANGE_t mcQueue[BVIEW_ASIC_MAX_PORTS + 1];
+} BVIEW_BCM_PORT_MAP_t;
+
 /* SDK port number is same as application port number.
  * if the application port numbering is different from the SDK port numbering then
  * this need to define to get proper BCM port number.
@@ -63,6 +92,19 @@ extern "C"
                ((_asic) = asicAppMap[_asic]);
 
 extern BVIEW_ASIC_t                 asicDb[];
+extern BVIEW_BCM_PORT_MAP_t         portMapDb[];
+
+/* Get GPORT of a port from the port map, returns SDK error code*/
+#define SB_BRCM_PORT_MAP_GPORT_GET(_asic, _port, _gport_ptr)      \
+               sbplugin_common_system_port_gport_get ((_asic), (_port), (_gport_ptr))
+
+/* UC queue range of a front panel port*/
+#define BVIEW_BCM_PORT_UC_QUEUES(_asic, _port)                    \
+               (portMapDb[(_asic)].ucQueue[(_port)])
+
+/* MC queue range of a front panel port*/
+#define BVIEW_BCM_PORT_MC_QUEUES(_asic, _port)                    \
+               (portMapDb[(_asic)].mcQueue[(_port)])
 
 /*********************************************************************
 * @brief  SDK South Bound - SYSTEM feature init
@@ -215,6 +257,46 @@ BVIEW_STATUS sbplugin_common_system_port_translate_to_notation (int asic,
                                                             int port,
                                                             char *dst);
 
+/*********************************************************************
+* @brief   Get the cached port string notation of a port.
+*
+* @param[in]   asic                         - ASIC
+* @param[in]   port                         - Port Number
+* @param[out]  notation                     - Port String
+* @param[out]  length                       - Length of Port String
+*
+* @retval  BVIEW_STATUS_SUCCESS            if Port string is found.
+* @retval  BVIEW_STATUS_FAILURE            if Port is not in port map.
+* @retval  BVIEW_STATUS_INVALID_PARAMETER  if input parameter is invalid.
+*
+* @notes   The string is owned by the port map, which is built
+*          at init and not changed after.
+*
+*
+*********************************************************************/
+BVIEW_STATUS sbplugin_common_system_port_notation_get (int asic,
+                                                    int port,
+                                                    const char **notation,
+                                                    int *length);
+
+/*********************************************************************
+* @brief   Get GPORT of a port.
+*
+* @param[in]   asic                         - ASIC
+* @param[in]   port                         - Port Number
+* @param[out]  gport                        - GPORT
+*
+* @retval  SB_BRCM_E_NONE                  if GPORT get is success.
+* @retval  SDK error code                  if GPORT get is failed.
+*
+* @notes   Ports of the port map are looked up in the map, other
+*          ports are read from SDK.
+*
+*
+*********************************************************************/
+int sbplugin_common_system_port_gport_get (int asic, int port,
+                                           SB_BRCM_GPORT_t *gport);
+
 #ifdef __cplusplus
 }
 #endif
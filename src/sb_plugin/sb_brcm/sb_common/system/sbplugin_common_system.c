@@ -36,6 +36,9 @@
 BVIEW_ASIC_t                 asicDb[BVIEW_MAX_ASICS_ON_A_PLATFORM];
 SB_BRCM_PORT_CONFIG_t        sb_brcm_port_config[BVIEW_MAX_ASICS_ON_A_PLATFORM];
 
+/* Port map of the ASICs*/
+BVIEW_BCM_PORT_MAP_t         portMapDb[BVIEW_MAX_ASICS_ON_A_PLATFORM];
+
 /* Intialize ASIC number Mapping. The Index to table is Applcation ASIC number
  * Application asic numbering starts with '1', so to avoid for loop to get bcm_uint
  * the index to the table is Application asic number.
@@ -128,6 +131,81 @@ static BVIEW_STATUS sbplugin_common_system_util_td2_init (BVIEW_ASIC_t *asic)
   return BVIEW_STATUS_SUCCESS;
 }
 
+/*********************************************************************
+* @brief   Build the port map of a unit.
+*
+* @param[in]   asic                         - ASIC
+*
+* @retval  BVIEW_STATUS_SUCCESS            if port map is built.
+* @retval  BVIEW_STATUS_FAILURE            if GPORT get is failed.
+* @retval  BVIEW_STATUS_INVALID_PARAMETER  if input parameter is invalid.
+*
+* @notes   Called once at init, the port map is fixed from then on.
+*          Ports of the unit are not to change while the agent runs,
+*          the agent is to be restarted after a port or breakout
+*          change.
+*
+*
+*********************************************************************/
+static BVIEW_STATUS sbplugin_common_system_util_port_map_build (int asic)
+{
+  BVIEW_BCM_PORT_MAP_t *map;
+  unsigned int numPorts = 0;
+  int port = 0;
+  int bcmPort = 0;
+  int rv = SB_BRCM_E_NONE;
+
+  if ((asic < 0) || (asic >= BVIEW_MAX_ASICS_ON_A_PLATFORM))
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+
+  map = &portMapDb[asic];
+  map->valid = false;
+
+  numPorts = asicDb[asic].scalingParams.numPorts;
+  if (numPorts > BVIEW_ASIC_MAX_PORTS)
+  {
+    numPorts = BVIEW_ASIC_MAX_PORTS;
+  }
+  map->numPorts = numPorts;
+
+  /* CPU port is not a front panel port, keep it aside*/
+  map->cpuPort = -1;
+  SB_BRCM_CPU_PORT_GET (asic, &map->cpuPort);
+  if (map->cpuPort >= 0)
+  {
+    rv = SB_BRCM_API_PORT_GPORT_GET (asic, map->cpuPort, &map->cpuGport);
+    if (SB_BRCM_RV_ERROR(rv))
+    {
+      return BVIEW_STATUS_FAILURE;
+    }
+  }
+
+  for (port = 1; port <= (int) numPorts; port++)
+  {
+    rv = SB_BRCM_API_PORT_GPORT_GET (asic, port, &map->gport[port]);
+    if (SB_BRCM_RV_ERROR(rv))
+    {
+      return BVIEW_STATUS_FAILURE;
+    }
+
+    bcmPort = port;
+    BVIEW_BCM_PORT_GET (bcmPort);
+    map->notationLength[port] = snprintf (map->notation[port],
+                                          BVIEW_BCM_PORT_NOTATION_LEN,
+                                          "%d", bcmPort);
+
+    map->ucQueue[port].first = (port - 1) * BVIEW_BCM_NUM_COS_PORT;
+    map->ucQueue[port].count = BVIEW_BCM_NUM_COS_PORT;
+    map->mcQueue[port].first = (port - 1) * BVIEW_BCM_NUM_COS_PORT;
+    map->mcQueue[port].count = BVIEW_BCM_NUM_COS_PORT;
+  }
+
+  map->valid = true;
+  return BVIEW_STATUS_SUCCESS;
+}
+
 /*********************************************************************
 * @brief  SYSTEM feature init
 *
@@ -203,6 +281,9 @@ BVIEW_STATUS sbplugin_common_system_init (BVIEW_SB_SYSTEM_FEATURE_t    *bcmSyste
     }*/
       
     bcmSystem->asicList[index] = &asicDb[index];
+
+    /* Cache GPORTs and port strings of the ASIC*/
+    sbplugin_common_system_util_port_map_build (index);
     index++;
   }    
   bcmSystem->system_name_get_cb     = sbplugin_common_system_name_get;
@@ -213,6 +294,7 @@ BVIEW_STATUS sbplugin_common_system_init (BVIEW_SB_SYSTEM_FEATURE_t    *bcmSyste
   bcmSystem->system_port_translate_from_notation_cb      = sbplugin_common_system_port_translate_from_notation;
   bcmSystem->system_asic_translate_to_notation_cb        = sbplugin_common_system_asic_translate_to_notation;
   bcmSystem->system_port_translate_to_notation_cb        = sbplugin_common_system_port_translate_to_notation;
+  bcmSystem->system_port_notation_get_cb                 = sbplugin_common_system_port_notation_get;
 
   return BVIEW_STATUS_SUCCESS;
 } 
@@ -464,7 +546,18 @@ BVIEW_STATUS sbplugin_common_system_port_translate_to_notation (int asic,
                                                              int port, 
                                                              char *dst) 
 {
+  const char *notation = NULL;
+  int length = 0;
+
   BVIEW_NULLPTR_CHECK (dst);
+
+  /* Copy the cached string, if the port is in port map*/
+  if (sbplugin_common_system_port_notation_get (asic, port, &notation,
+                                             &length) == BVIEW_STATUS_SUCCESS)
+  {
+    memcpy (dst, notation, length + 1);
+    return BVIEW_STATUS_SUCCESS;
+  }
    
   /* Get BCM port*/
   BVIEW_BCM_PORT_GET (port);
@@ -475,3 +568,85 @@ BVIEW_STATUS sbplugin_common_system_port_translate_to_notation (int asic,
   return BVIEW_STATUS_SUCCESS;
 }
 
+/*********************************************************************
+* @brief   Get the cached port string notation of a port.
+*
+* @param[in]   asic                         - ASIC
+* @param[in]   port                         - Port Number
+* @param[out]  notation                     - Port String
+* @param[out]  length                       - Length of Port String
+*
+* @retval  BVIEW_STATUS_SUCCESS            if Port string is found.
+* @retval  BVIEW_STATUS_FAILURE            if Port is not in port map.
+* @retval  BVIEW_STATUS_INVALID_PARAMETER  if input parameter is invalid.
+*
+* @notes   The string is owned by the port map, which is built
+*          at init and not changed after.
+*
+*
+*********************************************************************/
+BVIEW_STATUS sbplugin_common_system_port_notation_get (int asic,
+                                                    int port,
+                                                    const char **notation,
+                                                    int *length)
+{
+  BVIEW_BCM_PORT_MAP_t *map;
+
+  if ((notation == NULL) || (length == NULL) ||
+      (asic < 0) || (asic >= BVIEW_MAX_ASICS_ON_A_PLATFORM))
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+
+  map = &portMapDb[asic];
+  if ((map->valid == false) || (port < 1) || (port > (int) map->numPorts))
+  {
+    return BVIEW_STATUS_FAILURE;
+  }
+
+  *notation = map->notation[port];
+  *length = map->notationLength[port];
+  return BVIEW_STATUS_SUCCESS;
+}
+
+
+/*********************************************************************
+* @brief   Get GPORT of a port.
+*
+* @param[in]   asic                         - ASIC
+* @param[in]   port                         - Port Number
+* @param[out]  gport                        - GPORT
+*
+* @retval  SB_BRCM_E_NONE                  if GPORT get is success.
+* @retval  SDK error code                  if GPORT get is failed.
+*
+* @notes   Ports of the port map are looked up in the map, other
+*          ports are read from SDK.
+*
+*
+*********************************************************************/
+int sbplugin_common_system_port_gport_get (int asic, int port,
+                                           SB_BRCM_GPORT_t *gport)
+{
+  BVIEW_BCM_PORT_MAP_t *map;
+
+  if ((asic >= 0) && (asic < BVIEW_MAX_ASICS_ON_A_PLATFORM))
+  {
+    map = &portMapDb[asic];
+    if (map->valid == true)
+    {
+      if ((port >= 1) && (port <= (int) map->numPorts))
+      {
+        *gport = map->gport[port];
+        return SB_BRCM_E_NONE;
+      }
+      if (port == map->cpuPort)
+      {
+        *gport = map->cpuGport;
+        return SB_BRCM_E_NONE;
+      }
+    }
+  }
+  return SB_BRCM_API_PORT_GPORT_GET (asic, port, gport);
+}
+
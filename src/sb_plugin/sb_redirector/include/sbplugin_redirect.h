@@ -29,6 +29,8 @@ extern "C" {
 #include <string.h>
 #include <pthread.h>
 #include "sbplugin.h"
+#include "sbplugin_system.h"
+#include "sbfeature_bst.h"
 #include "openapps_log_api.h"
 
 
@@ -40,6 +42,34 @@ typedef  struct {
     BVIEW_SB_PLUGIN_t  sbPlugin;
 } BVIEW_SB_REDIRECT_PLUGIN_t;
 
+/** South bound features resolved for a unit */
+typedef  struct {
+    /** Indicates whether the unit is present on the system */
+    bool isValid;
+    /** Asic type of the unit */
+    BVIEW_ASIC_TYPE asicType;
+    /** Asic capabilities of the unit */
+    BVIEW_ASIC_CAPABILITIES_t *asicCap;
+    /** System feature matching the asic type of the unit */
+    BVIEW_SB_SYSTEM_FEATURE_t *systemFeature;
+    /** BST feature matching the asic type of the unit */
+    BVIEW_SB_BST_FEATURE_t *bstFeature;
+} BVIEW_SB_REDIRECT_UNIT_t;
+
+/** Per unit dispatch table. A table is never modified once it is
+    published, plug-in registration publishes a new table */
+typedef  struct {
+    /** System feature supporting all silicon types */
+    BVIEW_SB_SYSTEM_FEATURE_t *systemFeature;
+    /** Resolved features, indexed by unit number */
+    BVIEW_SB_REDIRECT_UNIT_t unit[BVIEW_MAX_ASICS_ON_A_PLATFORM];
+} BVIEW_SB_REDIRECT_DISPATCH_t;
+
+/** Number of dispatch tables, the empty table published at init and
+    one per registered plug-in. Plug-ins are not deregistered, so a
+    table is never reclaimed */
+#define SB_REDIRECT_DISPATCH_POOL_SIZE   (BVIEW_MAX_SUPPORTED_SB_PLUGINS + 1)
+
 /** List of South bound plugin data */
 extern BVIEW_SB_REDIRECT_PLUGIN_t sbRedirectPluginList[];
 
@@ -131,6 +161,32 @@ extern void *sb_redirect_feature_handle_get(BVIEW_ASIC_TYPE asicType, BVIEW_FEAT
 BVIEW_STATUS  sb_redirect_asic_capabilities_get(BVIEW_ASIC_TYPE asicType, 
                                                 BVIEW_ASIC_CAPABILITIES_t **asicCapPtr);
  
+/*********************************************************************
+* @brief       Get the resolved south bound features of a unit
+*
+* @param[in]   asic       Unit number
+*
+* @retval   NULL          if the unit is not present
+* @retval   UnitPtr       Dispatch entry of the unit
+*
+* @notes    Lock free, the entry is read from the dispatch table
+*           published by the last plug-in registration.
+*
+*********************************************************************/
+const BVIEW_SB_REDIRECT_UNIT_t *sb_redirect_unit_get (int asic);
+
+/*********************************************************************
+* @brief       Get the system feature supporting all silicon types
+*
+* @retval   NULL                  if no system feature is registered
+* @retval   SystemFeaturePtr      System feature function list
+*
+* @notes    Lock free, the feature is read from the dispatch table
+*           published by the last plug-in registration.
+*
+*********************************************************************/
+BVIEW_SB_SYSTEM_FEATURE_t *sb_redirect_system_feature_get (void);
+
 /*********************************************************************
 * @brief       Set debug flag value for south bound plug-in redirector 
 *
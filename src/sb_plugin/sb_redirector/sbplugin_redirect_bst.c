@@ -26,8 +26,7 @@
 * @param[in]    asic                  Unit number
 * @param[out]   config                BST config structure
 *
-* @retval   BVIEW_STATUS_FAILURE      Due to lock acquistion failure or 
-*                                     Not able to get asic type of this unit or
+* @retval   BVIEW_STATUS_FAILURE      Not able to get asic type of this unit or
 *                                     BST feature is not present or
 *                                     BST south bound function has returned failure
 *
@@ -43,23 +42,18 @@ BVIEW_STATUS sbapi_bst_config_get (int asic, BVIEW_BST_CONFIG_t * config)
 {
   BVIEW_SB_BST_FEATURE_t *bstFeaturePtr = NULL;
   BVIEW_STATUS rv = BVIEW_STATUS_SUCCESS;
-  BVIEW_ASIC_TYPE asicType;
+  const BVIEW_SB_REDIRECT_UNIT_t *unitPtr = NULL;
 
-  /* Get asic type of the unit */
-  if (sbapi_system_unit_to_asic_type_get (asic, &asicType) !=
-      BVIEW_STATUS_SUCCESS)
+  /* Get south bound feature functions resolved for the unit */
+  unitPtr = sb_redirect_unit_get (asic);
+  if (unitPtr == NULL)
   {
     SB_REDIRECT_DEBUG_PRINT (BVIEW_LOG_ERROR,
                              "(%s:%d) Failed to get asic type for unit %d \n",
                              __FILE__, __LINE__, asic);
     return BVIEW_STATUS_FAILURE;
   }
-  /* Acquire Read lock */
-  SB_REDIRECT_RWLOCK_RD_LOCK (sbRedirectRWLock);
-  /* Get best matching south bound feature functions based on Asic type */
-  bstFeaturePtr =
-    (BVIEW_SB_BST_FEATURE_t *) sb_redirect_feature_handle_get (asicType,
-                                                               BVIEW_FEATURE_BST);
+  bstFeaturePtr = unitPtr->bstFeature;
   /* Validate feature pointer and south bound handler. 
    * Call south bound handler                        */    
   if (bstFeaturePtr == NULL)
@@ -74,8 +68,6 @@ BVIEW_STATUS sbapi_bst_config_get (int asic, BVIEW_BST_CONFIG_t * config)
   {  
     rv = bstFeaturePtr->bst_config_get_cb (asic, config);
   }
-  /* Release read lock */
-  SB_REDIRECT_RWLOCK_UNLOCK (sbRedirectRWLock);
   return rv;
 }
 
@@ -85,8 +77,7 @@ BVIEW_STATUS sbapi_bst_config_get (int asic, BVIEW_BST_CONFIG_t * config)
 * @param[in]    asic                  Unit number
 * @param[in]    config                BST config structure
 *
-* @retval   BVIEW_STATUS_FAILURE      Due to lock acquistion failure or 
-*                                     Not able to get asic type of this unit or
+* @retval   BVIEW_STATUS_FAILURE      Not able to get asic type of this unit or
 *                                     BST feature is not present or
 *                                     BST south bound function has returned failure
 *
@@ -102,23 +93,18 @@ BVIEW_STATUS sbapi_bst_config_set (int asic, BVIEW_BST_CONFIG_t * config)
 {
   BVIEW_SB_BST_FEATURE_t *bstFeaturePtr = NULL;
   BVIEW_STATUS rv = BVIEW_STATUS_SUCCESS;
-  BVIEW_ASIC_TYPE asicType;
+  const BVIEW_SB_REDIRECT_UNIT_t *unitPtr = NULL;
 
-  /* Get asic type of the unit */
-  if (sbapi_system_unit_to_asic_type_get (asic, &asicType) !=
-      BVIEW_STATUS_SUCCESS)
+  /* Get south bound feature functions resolved for the unit */
+  unitPtr = sb_redirect_unit_get (asic);
+  if (unitPtr == NULL)
   {
     SB_REDIRECT_DEBUG_PRINT (BVIEW_LOG_ERROR,
                              "(%s:%d) Failed to get asic type for unit %d \n",
                              __FILE__, __LINE__, asic);
     return BVIEW_STATUS_FAILURE;
   }
-  /* Acquire Read lock */
-  SB_REDIRECT_RWLOCK_RD_LOCK (sbRedirectRWLock);
-  /* Get best matching south bound feature functions based on Asic type */
-  bstFeaturePtr =
-    (BVIEW_SB_BST_FEATURE_t *) sb_redirect_feature_handle_get (asicType,
-                                                               BVIEW_FEATURE_BST);
+  bstFeaturePtr = unitPtr->bstFeature;
   /* Validate feature pointer and south bound handler. 
    * Call south bound handler                        */    
   if (bstFeaturePtr == NULL)
@@ -133,8 +119,6 @@ BVIEW_STATUS sbapi_bst_config_set (int asic, BVIEW_BST_CONFIG_t * config)
   { 
     rv = bstFeaturePtr->bst_config_set_cb (asic, config);
   }
-  /* Release read lock */
-  SB_REDIRECT_RWLOCK_UNLOCK (sbRedirectRWLock);
   return rv;
 }
 
@@ -142,11 +126,14 @@ BVIEW_STATUS sbapi_bst_config_set (int asic, BVIEW_BST_CONFIG_t * config)
 * @brief       Get BST snapshot
 *
 * @param[in]     asic                  Unit number
+* @param[in]     realmMask             Mask of realms to be read
 * @param[out]    snapshot              BST snapshot
 * @param[out]    time                  Time
+* @param[out]    realmTime             Sampling window of every realm
+*                                      read, indexed by BVIEW_BST_REALM_INDEX.
+*                                      Can be NULL
 *
-* @retval   BVIEW_STATUS_FAILURE      Due to lock acquistion failure or 
-*                                     Not able to get asic type of this unit or
+* @retval   BVIEW_STATUS_FAILURE      Not able to get asic type of this unit or
 *                                     BST feature is not present or
 *                                     BST south bound function has returned failure
 *
@@ -155,32 +142,29 @@ BVIEW_STATUS sbapi_bst_config_set (int asic, BVIEW_BST_CONFIG_t * config)
 * @retval   BVIEW_STATUS_UNSUPPORTED  BST snapshot get functionality is 
 *                                     not supported on this unit
 *
-* @notes    none
+* @notes    Realms not present in realmMask are neither synced nor read
 *
 *********************************************************************/
 BVIEW_STATUS sbapi_bst_snapshot_get (int asic,
+                                     BVIEW_BST_REALM_MASK_t realmMask,
                                      BVIEW_BST_ASIC_SNAPSHOT_DATA_t * snapshot,
-                                     BVIEW_TIME_t * time)
+                                     BVIEW_TIME_t * time,
+                                     BVIEW_BST_REALM_TIME_t * realmTime)
 {
   BVIEW_SB_BST_FEATURE_t *bstFeaturePtr = NULL;
   BVIEW_STATUS rv = BVIEW_STATUS_SUCCESS;
-  BVIEW_ASIC_TYPE asicType;
+  const BVIEW_SB_REDIRECT_UNIT_t *unitPtr = NULL;
 
-  /* Get asic type of the unit */
-  if (sbapi_system_unit_to_asic_type_get (asic, &asicType) !=
-      BVIEW_STATUS_SUCCESS)
+  /* Get south bound feature functions resolved for the unit */
+  unitPtr = sb_redirect_unit_get (asic);
+  if (unitPtr == NULL)
   {
     SB_REDIRECT_DEBUG_PRINT (BVIEW_LOG_ERROR,
                              "(%s:%d) Failed to get asic type for unit %d \n",
                              __FILE__, __LINE__, asic);
     return BVIEW_STATUS_FAILURE;
   }
-  /* Acquire Read lock */
-  SB_REDIRECT_RWLOCK_RD_LOCK (sbRedirectRWLock);
-  /* Get best matching south bound feature functions based on Asic type */
-  bstFeaturePtr =
-    (BVIEW_SB_BST_FEATURE_t *) sb_redirect_feature_handle_get (asicType,
-                                                               BVIEW_FEATURE_BST);
+  bstFeaturePtr = unitPtr->bstFeature;
   /* Validate feature pointer and south bound handler. 
    * Call south bound handler                        */    
   if (bstFeaturePtr == NULL)
@@ -193,10 +177,114 @@ BVIEW_STATUS sbapi_bst_snapshot_get (int asic,
   }
   else
   { 
-    rv = bstFeaturePtr->bst_snapshot_get_cb (asic, snapshot, time);
+    rv = bstFeaturePtr->bst_snapshot_get_cb (asic, realmMask, snapshot, time,
+                                             realmTime);
+  }
+  return rv;
+}
+
+/*********************************************************************
+* @brief       Get the counters of one counter type in bulk
+*
+* @param[in]     asic                  Unit number
+* @param[in,out] bulk                  Counter type, port and index
+*                                      range and the counters
+*
+* @retval   BVIEW_STATUS_FAILURE      Not able to get asic type of this unit or
+*                                     BST feature is not present or
+*                                     BST south bound function has returned failure
+*
+* @retval   BVIEW_STATUS_SUCCESS      BST bulk stat get is successful 
+*
+* @retval   BVIEW_STATUS_UNSUPPORTED  BST bulk stat get functionality is 
+*                                     not supported on this unit
+*
+* @notes    Counters are not synced from HW, they are read as last
+*           synced by a realm or snapshot get.
+*
+*********************************************************************/
+BVIEW_STATUS sbapi_bst_stat_bulk_get (int asic, BVIEW_BST_STAT_BULK_t * bulk)
+{
+  BVIEW_SB_BST_FEATURE_t *bstFeaturePtr = NULL;
+  BVIEW_STATUS rv = BVIEW_STATUS_SUCCESS;
+  const BVIEW_SB_REDIRECT_UNIT_t *unitPtr = NULL;
+
+  /* Get south bound feature functions resolved for the unit */
+  unitPtr = sb_redirect_unit_get (asic);
+  if (unitPtr == NULL)
+  {
+    SB_REDIRECT_DEBUG_PRINT (BVIEW_LOG_ERROR,
+                             "(%s:%d) Failed to get asic type for unit %d \n",
+                             __FILE__, __LINE__, asic);
+    return BVIEW_STATUS_FAILURE;
+  }
+  bstFeaturePtr = unitPtr->bstFeature;
+  /* Validate feature pointer and south bound handler. 
+   * Call south bound handler                        */    
+  if (bstFeaturePtr == NULL)
+  {
+    rv = BVIEW_STATUS_FAILURE;
+  }  
+  else if (bstFeaturePtr->bst_stat_bulk_get_cb == NULL)
+  {
+    rv = BVIEW_STATUS_UNSUPPORTED;
+  }
+  else
+  { 
+    rv = bstFeaturePtr->bst_stat_bulk_get_cb (asic, bulk);
+  }
+  return rv;
+}
+
+/*********************************************************************
+* @brief       Get the timing of the snapshot collection cycles
+*
+* @param[in]     asic                  Unit number
+* @param[out]    stats                 Collection cycle timing
+*
+* @retval   BVIEW_STATUS_FAILURE      Not able to get asic type of this unit or
+*                                     BST feature is not present or
+*                                     BST south bound function has returned failure
+*
+* @retval   BVIEW_STATUS_SUCCESS      BST collection stats get is successful 
+*
+* @retval   BVIEW_STATUS_UNSUPPORTED  BST collection stats get functionality is 
+*                                     not supported on this unit
+*
+* @notes    Only snapshot gets are collection cycles, realm gets
+*           are not accounted.
+*
+*********************************************************************/
+BVIEW_STATUS sbapi_bst_collect_stats_get (int asic, BVIEW_BST_COLLECT_STATS_t * stats)
+{
+  BVIEW_SB_BST_FEATURE_t *bstFeaturePtr = NULL;
+  BVIEW_STATUS rv = BVIEW_STATUS_SUCCESS;
+  const BVIEW_SB_REDIRECT_UNIT_t *unitPtr = NULL;
+
+  /* Get south bound feature functions resolved for the unit */
+  unitPtr = sb_redirect_unit_get (asic);
+  if (unitPtr == NULL)
+  {
+    SB_REDIRECT_DEBUG_PRINT (BVIEW_LOG_ERROR,
+                             "(%s:%d) Failed to get asic type for unit %d \n",
+                             __FILE__, __LINE__, asic);
+    return BVIEW_STATUS_FAILURE;
+  }
+  bstFeaturePtr = unitPtr->bstFeature;
+  /* Validate feature pointer and south bound handler. 
+   * Call south bound handler                        */    
+  if (bstFeaturePtr == NULL)
+  {
+    rv = BVIEW_STATUS_FAILURE;
+  }  
+  else if (bstFeaturePtr->bst_collect_stats_get_cb == NULL)
+  {
+    rv = BVIEW_STATUS_UNSUPPORTED;
+  }
+  else
+  { 
+    rv = bstFeaturePtr->bst_collect_stats_get_cb (asic, stats);
   }
-  /* Release read lock */
-  SB_REDIRECT_RWLOCK_UNLOCK (sbRedirectRWLock);
   return rv;
 }
 
@@ -207,8 +295,7 @@ BVIEW_STATUS sbapi_bst_snapshot_get (int asic,
 * @param[out]   data             Device data structure
 * @param[out]   time             time
 *
-* @retval   BVIEW_STATUS_FAILURE      Due to lock acquistion failure or 
-*                                     Not able to get asic type of this unit or
+* @retval   BVIEW_STATUS_FAILURE      Not able to get asic type of this unit or
 *                                     BST feature is not present or
 *                                     BST south bound function has returned failure
 *
@@ -228,24 +315,18 @@ BVIEW_STATUS sbapi_bst_device_data_get (int asic,
 {
   BVIEW_SB_BST_FEATURE_t *bstFeaturePtr = NULL;
   BVIEW_STATUS rv = BVIEW_STATUS_SUCCESS;
-  BVIEW_ASIC_TYPE asicType;
+  const BVIEW_SB_REDIRECT_UNIT_t *unitPtr = NULL;
 
-  /* Get asic type of the unit */
-  if (sbapi_system_unit_to_asic_type_get (asic, &asicType) !=
-      BVIEW_STATUS_SUCCESS)
+  /* Get south bound feature functions resolved for the unit */
+  unitPtr = sb_redirect_unit_get (asic);
+  if (unitPtr == NULL)
   {
     SB_REDIRECT_DEBUG_PRINT (BVIEW_LOG_ERROR,
                              "(%s:%d) Failed to get asic type for unit %d \n",
                              __FILE__, __LINE__, asic);
     return BVIEW_STATUS_FAILURE;
   }
-
-  /* Acquire Read lock */
-  SB_REDIRECT_RWLOCK_RD_LOCK (sbRedirectRWLock);
-  /* Get best matching south bound feature functions based on Asic type */
-  bstFeaturePtr =
-    (BVIEW_SB_BST_FEATURE_t *) sb_redirect_feature_handle_get (asicType,
-                                                               BVIEW_FEATURE_BST);
+  bstFeaturePtr = unitPtr->bstFeature;
   /* Validate feature pointer and south bound handler. 
    * Call south bound handler                        */    
   if (bstFeaturePtr == NULL)
@@ -260,8 +341,6 @@ BVIEW_STATUS sbapi_bst_device_data_get (int asic,
   { 
     rv = bstFeaturePtr->bst_device_data_get_cb (asic, data, time);
   }
-  /* Release read lock */
-  SB_REDIRECT_RWLOCK_UNLOCK (sbRedirectRWLock);
   return rv;
 }
 
@@ -272,8 +351,7 @@ BVIEW_STATUS sbapi_bst_device_data_get (int asic,
 * @param[out]   data              i_p_pg data structure
 * @param[out]   time              time
 *
-* @retval   BVIEW_STATUS_FAILURE      Due to lock acquistion failure or 
-*                                     Not able to get asic type of this unit or
+* @retval   BVIEW_STATUS_FAILURE      Not able to get asic type of this unit or
 *                                     BST feature is not present or
 *                                     BST south bound function has returned failure
 *
@@ -294,23 +372,18 @@ BVIEW_STATUS sbapi_bst_ippg_data_get (int asic,
 {
   BVIEW_SB_BST_FEATURE_t *bstFeaturePtr = NULL;
   BVIEW_STATUS rv = BVIEW_STATUS_SUCCESS;
-  BVIEW_ASIC_TYPE asicType;
+  const BVIEW_SB_REDIRECT_UNIT_t *unitPtr = NULL;
 
-  /* Get asic type of the unit */
-  if (sbapi_system_unit_to_asic_type_get (asic, &asicType) !=
-      BVIEW_STATUS_SUCCESS)
+  /* Get south bound feature functions resolved for the unit */
+  unitPtr = sb_redirect_unit_get (asic);
+  if (unitPtr == NULL)
   {
     SB_REDIRECT_DEBUG_PRINT (BVIEW_LOG_ERROR,
                              "(%s:%d) Failed to get asic type for unit %d \n",
                              __FILE__, __LINE__, asic);
     return BVIEW_STATUS_FAILURE;
   }
-  /* Acquire Read lock */
-  SB_REDIRECT_RWLOCK_RD_LOCK (sbRedirectRWLock);
-  /* Get best matching south bound feature functions based on Asic type */
-  bstFeaturePtr =
-    (BVIEW_SB_BST_FEATURE_t *) sb_redirect_feature_handle_get (asicType,
-                                                               BVIEW_FEATURE_BST);
+  bstFeaturePtr = unitPtr->bstFeature;
   /* Validate feature pointer and south bound handler. 
    * Call south bound handler                        */    
   if (bstFeaturePtr == NULL)
@@ -325,8 +398,6 @@ BVIEW_STATUS sbapi_bst_ippg_data_get (int asic,
   {
     rv = bstFeaturePtr->bst_ippg_data_get_cb (asic, data, time);
   }
-  /* Release read lock */
-  SB_REDIRECT_RWLOCK_UNLOCK (sbRedirectRWLock);
   return rv;
 }
 
@@ -337,8 +408,7 @@ BVIEW_STATUS sbapi_bst_ippg_data_get (int asic,
 * @param[out]   data             i_p_sp data structure
 * @param[out]   time             time
 *
-* @retval   BVIEW_STATUS_FAILURE      Due to lock acquistion failure or 
-*                                     Not able to get asic type of this unit or
+* @retval   BVIEW_STATUS_FAILURE      Not able to get asic type of this unit or
 *                                     BST feature is not present or
 *                                     BST south bound function has returned failure
 *
@@ -360,23 +430,18 @@ BVIEW_STATUS sbapi_bst_ipsp_data_get (int asic,
 {
   BVIEW_SB_BST_FEATURE_t *bstFeaturePtr = NULL;
   BVIEW_STATUS rv = BVIEW_STATUS_SUCCESS;
-  BVIEW_ASIC_TYPE asicType;
+  const BVIEW_SB_REDIRECT_UNIT_t *unitPtr = NULL;
 
-  /* Get asic type of the unit */
-  if (sbapi_system_unit_to_asic_type_get (asic, &asicType) !=
-      BVIEW_STATUS_SUCCESS)
+  /* Get south bound feature functions resolved for the unit */
+  unitPtr = sb_redirect_unit_get (asic);
+  if (unitPtr == NULL)
   {
     SB_REDIRECT_DEBUG_PRINT (BVIEW_LOG_ERROR,
                              "(%s:%d) Failed to get asic type for unit %d \n",
                              __FILE__, __LINE__, asic);
     return BVIEW_STATUS_FAILURE;
   }
-  /* Acquire Read lock */
-  SB_REDIRECT_RWLOCK_RD_LOCK (sbRedirectRWLock);
-  /* Get best matching south bound feature functions based on Asic type */
-  bstFeaturePtr =
-    (BVIEW_SB_BST_FEATURE_t *) sb_redirect_feature_handle_get (asicType,
-                                                               BVIEW_FEATURE_BST);
+  bstFeaturePtr = unitPtr->bstFeature;
   /* Validate feature pointer and south bound handler. 
    * Call south bound handler                        */    
   if (bstFeaturePtr == NULL)
@@ -391,8 +456,6 @@ BVIEW_STATUS sbapi_bst_ipsp_data_get (int asic,
   {                              
     rv = bstFeaturePtr->bst_ipsp_data_get_cb (asic, data, time);
   }
-  /* Release read lock */
-  SB_REDIRECT_RWLOCK_UNLOCK (sbRedirectRWLock);
   return rv;
 }
 
@@ -403,8 +466,7 @@ BVIEW_STATUS sbapi_bst_ipsp_data_get (int asic,
 * @param[out]   data              i_sp structure
 * @param[out]   time              time
 *
-* @retval   BVIEW_STATUS_FAILURE      Due to lock acquistion failure or 
-*                                     Not able to get asic type of this unit or
+* @retval   BVIEW_STATUS_FAILURE      Not able to get asic type of this unit or
 *                                     BST feature is not present or
 *                                     BST south bound function has returned failure
 *
@@ -426,23 +488,18 @@ BVIEW_STATUS sbapi_bst_isp_data_get (int asic,
 {
   BVIEW_SB_BST_FEATURE_t *bstFeaturePtr = NULL;
   BVIEW_STATUS rv = BVIEW_STATUS_SUCCESS;
-  BVIEW_ASIC_TYPE asicType;
+  const BVIEW_SB_REDIRECT_UNIT_t *unitPtr = NULL;
 
-  /* Get asic type of the unit */
-  if (sbapi_system_unit_to_asic_type_get (asic, &asicType) !=
-      BVIEW_STATUS_SUCCESS)
+  /* Get south bound feature functions resolved for the unit */
+  unitPtr = sb_redirect_unit_get (asic);
+  if (unitPtr == NULL)
   {
     SB_REDIRECT_DEBUG_PRINT (BVIEW_LOG_ERROR,
                              "(%s:%d) Failed to get asic type for unit %d \n",
                              __FILE__, __LINE__, asic);
     return BVIEW_STATUS_FAILURE;
   }
-  /* Acquire Read lock */
-  SB_REDIRECT_RWLOCK_RD_LOCK (sbRedirectRWLock);
-  /* Get best matching south bound feature functions based on Asic type */
-  bstFeaturePtr =
-    (BVIEW_SB_BST_FEATURE_t *) sb_redirect_feature_handle_get (asicType,
-                                                               BVIEW_FEATURE_BST);
+  bstFeaturePtr = unitPtr->bstFeature;
   /* Validate feature pointer and south bound handler. 
    * Call south bound handler                        */    
   if (bstFeaturePtr == NULL)
@@ -457,8 +514,6 @@ BVIEW_STATUS sbapi_bst_isp_data_get (int asic,
   {                              
     rv = bstFeaturePtr->bst_isp_data_get_cb (asic, data, time);
   }
-  /* Release read lock */
-  SB_REDIRECT_RWLOCK_UNLOCK (sbRedirectRWLock);
   return rv;
 }
 
@@ -469,8 +524,7 @@ BVIEW_STATUS sbapi_bst_isp_data_get (int asic,
 * @param[out]   data              e_p_sp data structure
 * @param[out]   time              time
 *
-* @retval   BVIEW_STATUS_FAILURE      Due to lock acquistion failure or 
-*                                     Not able to get asic type of this unit or
+* @retval   BVIEW_STATUS_FAILURE      Not able to get asic type of this unit or
 *                                     BST feature is not present or
 *                                     BST south bound function has returned failure
 *
@@ -492,23 +546,18 @@ BVIEW_STATUS sbapi_bst_epsp_data_get (int asic,
 {
   BVIEW_SB_BST_FEATURE_t *bstFeaturePtr = NULL;
   BVIEW_STATUS rv = BVIEW_STATUS_SUCCESS;
-  BVIEW_ASIC_TYPE asicType;
+  const BVIEW_SB_REDIRECT_UNIT_t *unitPtr = NULL;
 
-  /* Get asic type of the unit */
-  if (sbapi_system_unit_to_asic_type_get (asic, &asicType) !=
-      BVIEW_STATUS_SUCCESS)
+  /* Get south bound feature functions resolved for the unit */
+  unitPtr = sb_redirect_unit_get (asic);
+  if (unitPtr == NULL)
   {
     SB_REDIRECT_DEBUG_PRINT (BVIEW_LOG_ERROR,
                              "(%s:%d) Failed to get asic type for unit %d \n",
                              __FILE__, __LINE__, asic);
     return BVIEW_STATUS_FAILURE;
   }
-  /* Acquire Read lock */
-  SB_REDIRECT_RWLOCK_RD_LOCK (sbRedirectRWLock);
-  /* Get best matching south bound feature functions based on Asic type */
-  bstFeaturePtr =
-    (BVIEW_SB_BST_FEATURE_t *) sb_redirect_feature_handle_get (asicType,
-                                                               BVIEW_FEATURE_BST);
+  bstFeaturePtr = unitPtr->bstFeature;
   /* Validate feature pointer and south bound handler. 
    * Call south bound handler                        */    
   if (bstFeaturePtr == NULL)
@@ -523,8 +572,6 @@ BVIEW_STATUS sbapi_bst_epsp_data_get (int asic,
   {                              
     rv = bstFeaturePtr->bst_epsp_data_get_cb (asic, data, time);
   }
-  /* Release read lock */
-  SB_REDIRECT_RWLOCK_UNLOCK (sbRedirectRWLock);
   return rv;
 }
 
@@ -535,8 +582,7 @@ BVIEW_STATUS sbapi_bst_epsp_data_get (int asic,
 * @param[out]   data              e_sp data structure
 * @param[out]   time              time
 *
-* @retval   BVIEW_STATUS_FAILURE      Due to lock acquistion failure or 
-*                                     Not able to get asic type of this unit or
+* @retval   BVIEW_STATUS_FAILURE      Not able to get asic type of this unit or
 *                                     BST feature is not present or
 *                                     BST south bound function has returned failure
 *
@@ -558,23 +604,18 @@ BVIEW_STATUS sbapi_bst_esp_data_get (int asic,
 {
   BVIEW_SB_BST_FEATURE_t *bstFeaturePtr = NULL;
   BVIEW_STATUS rv = BVIEW_STATUS_SUCCESS;
-  BVIEW_ASIC_TYPE asicType;
+  const BVIEW_SB_REDIRECT_UNIT_t *unitPtr = NULL;
 
-  /* Get asic type of the unit */
-  if (sbapi_system_unit_to_asic_type_get (asic, &asicType) !=
-      BVIEW_STATUS_SUCCESS)
+  /* Get south bound feature functions resolved for the unit */
+  unitPtr = sb_redirect_unit_get (asic);
+  if (unitPtr == NULL)
   {
     SB_REDIRECT_DEBUG_PRINT (BVIEW_LOG_ERROR,
                              "(%s:%d) Failed to get asic type for unit %d \n",
                              __FILE__, __LINE__, asic);
     return BVIEW_STATUS_FAILURE;
   }
-  /* Acquire Read lock */
-  SB_REDIRECT_RWLOCK_RD_LOCK (sbRedirectRWLock);
-  /* Get best matching south bound feature functions based on Asic type */
-  bstFeaturePtr =
-    (BVIEW_SB_BST_FEATURE_t *) sb_redirect_feature_handle_get (asicType,
-                                                               BVIEW_FEATURE_BST);
+  bstFeaturePtr = unitPtr->bstFeature;
   /* Validate feature pointer and south bound handler. 
    * Call south bound handler                        */    
   if (bstFeaturePtr == NULL)
@@ -589,8 +630,6 @@ BVIEW_STATUS sbapi_bst_esp_data_get (int asic,
   {                              
     rv = bstFeaturePtr->bst_esp_data_get_cb (asic, data, time);
   }
-  /* Release read lock */
-  SB_REDIRECT_RWLOCK_UNLOCK (sbRedirectRWLock);
   return rv;
 }
 
@@ -601,8 +640,7 @@ BVIEW_STATUS sbapi_bst_esp_data_get (int asic,
 * @param[out]   data             Egress Unicast Queue data structure
 * @param[out]   time             time
 *
-* @retval   BVIEW_STATUS_FAILURE      Due to lock acquistion failure or 
-*                                     Not able to get asic type of this unit or
+* @retval   BVIEW_STATUS_FAILURE      Not able to get asic type of this unit or
 *                                     BST feature is not present or
 *                                     BST south bound function has returned failure
 *
@@ -624,23 +662,18 @@ BVIEW_STATUS sbapi_bst_eucq_data_get (int asic,
 {
   BVIEW_SB_BST_FEATURE_t *bstFeaturePtr = NULL;
   BVIEW_STATUS rv = BVIEW_STATUS_SUCCESS;
-  BVIEW_ASIC_TYPE asicType;
+  const BVIEW_SB_REDIRECT_UNIT_t *unitPtr = NULL;
 
-  /* Get asic type of the unit */
-  if (sbapi_system_unit_to_asic_type_get (asic, &asicType) !=
-      BVIEW_STATUS_SUCCESS)
+  /* Get south bound feature functions resolved for the unit */
+  unitPtr = sb_redirect_unit_get (asic);
+  if (unitPtr == NULL)
   {
     SB_REDIRECT_DEBUG_PRINT (BVIEW_LOG_ERROR,
                              "(%s:%d) Failed to get asic type for unit %d \n",
                              __FILE__, __LINE__, asic);
     return BVIEW_STATUS_FAILURE;
   }
-  /* Acquire Read lock */
-  SB_REDIRECT_RWLOCK_RD_LOCK (sbRedirectRWLock);
-  /* Get best matching south bound feature functions based on Asic type */
-  bstFeaturePtr =
-    (BVIEW_SB_BST_FEATURE_t *) sb_redirect_feature_handle_get (asicType,
-                                                               BVIEW_FEATURE_BST);
+  bstFeaturePtr = unitPtr->bstFeature;
 
   /* Validate feature pointer and south bound handler. 
    * Call south bound handler                        */    
@@ -656,8 +689,6 @@ BVIEW_STATUS sbapi_bst_eucq_data_get (int asic,
   {                              
     rv = bstFeaturePtr->bst_eucq_data_get_cb (asic, data, time);
   }
-  /* Release read lock */
-  SB_REDIRECT_RWLOCK_UNLOCK (sbRedirectRWLock);
   return rv;
 }
 
@@ -668,8 +699,7 @@ BVIEW_STATUS sbapi_bst_eucq_data_get (int asic,
 * @param[out]   data              Egress Unicast Queue Groups data structure
 * @param[out]   time              time
 *
-* @retval   BVIEW_STATUS_FAILURE      Due to lock acquistion failure or 
-*                                     Not able to get asic type of this unit or
+* @retval   BVIEW_STATUS_FAILURE      Not able to get asic type of this unit or
 *                                     BST feature is not present or
 *                                     BST south bound function has returned failure
 *
@@ -691,23 +721,18 @@ BVIEW_STATUS sbapi_bst_eucqg_data_get (int asic,
 {
   BVIEW_SB_BST_FEATURE_t *bstFeaturePtr = NULL;
   BVIEW_STATUS rv = BVIEW_STATUS_SUCCESS;
-  BVIEW_ASIC_TYPE asicType;
+  const BVIEW_SB_REDIRECT_UNIT_t *unitPtr = NULL;
 
-  /* Get asic type of the unit */
-  if (sbapi_system_unit_to_asic_type_get (asic, &asicType) !=
-      BVIEW_STATUS_SUCCESS)
+  /* Get south bound feature functions resolved for the unit */
+  unitPtr = sb_redirect_unit_get (asic);
+  if (unitPtr == NULL)
   {
     SB_REDIRECT_DEBUG_PRINT (BVIEW_LOG_ERROR,
                              "(%s:%d) Failed to get asic type for unit %d \n",
                              __FILE__, __LINE__, asic);
     return BVIEW_STATUS_FAILURE;
   }
-  /* Acquire Read lock */
-  SB_REDIRECT_RWLOCK_RD_LOCK (sbRedirectRWLock);
-  /* Get best matching south bound feature functions based on Asic type */
-  bstFeaturePtr =
-    (BVIEW_SB_BST_FEATURE_t *) sb_redirect_feature_handle_get (asicType,
-                                                               BVIEW_FEATURE_BST);
+  bstFeaturePtr = unitPtr->bstFeature;
   /* Validate feature pointer and south bound handler. 
    * Call south bound handler                        */    
   if (bstFeaturePtr == NULL)
@@ -722,8 +747,6 @@ BVIEW_STATUS sbapi_bst_eucqg_data_get (int asic,
   {                              
     rv = bstFeaturePtr->bst_eucqg_data_get_cb (asic, data, time);
   }
-  /* Release read lock */
-  SB_REDIRECT_RWLOCK_UNLOCK (sbRedirectRWLock);
   return rv;
 }
 
@@ -734,8 +757,7 @@ BVIEW_STATUS sbapi_bst_eucqg_data_get (int asic,
 * @param[out]   data             Egress Multicast Queue data structure
 * @param[out]   time             time
 *
-* @retval   BVIEW_STATUS_FAILURE      Due to lock acquistion failure or 
-*                                     Not able to get asic type of this unit or
+* @retval   BVIEW_STATUS_FAILURE      Not able to get asic type of this unit or
 *                                     BST feature is not present or
 *                                     BST south bound function has returned failure
 *
@@ -757,23 +779,18 @@ BVIEW_STATUS sbapi_bst_emcq_data_get (int asic,
 {
   BVIEW_SB_BST_FEATURE_t *bstFeaturePtr = NULL;
   BVIEW_STATUS rv = BVIEW_STATUS_SUCCESS;
-  BVIEW_ASIC_TYPE asicType;
+  const BVIEW_SB_REDIRECT_UNIT_t *unitPtr = NULL;
 
-  /* Get asic type of the unit */
-  if (sbapi_system_unit_to_asic_type_get (asic, &asicType) !=
-      BVIEW_STATUS_SUCCESS)
+  /* Get south bound feature functions resolved for the unit */
+  unitPtr = sb_redirect_unit_get (asic);
+  if (unitPtr == NULL)
   {
     SB_REDIRECT_DEBUG_PRINT (BVIEW_LOG_ERROR,
                              "(%s:%d) Failed to get asic type for unit %d \n",
                              __FILE__, __LINE__, asic);
     return BVIEW_STATUS_FAILURE;
   }
-  /* Acquire Read lock */
-  SB_REDIRECT_RWLOCK_RD_LOCK (sbRedirectRWLock);
-  /* Get best matching south bound feature functions based on Asic type */
-  bstFeaturePtr =
-    (BVIEW_SB_BST_FEATURE_t *) sb_redirect_feature_handle_get (asicType,
-                                                               BVIEW_FEATURE_BST);
+  bstFeaturePtr = unitPtr->bstFeature;
   /* Validate feature pointer and south bound handler. 
    * Call south bound handler                        */    
   if (bstFeaturePtr == NULL)
@@ -788,8 +805,6 @@ BVIEW_STATUS sbapi_bst_emcq_data_get (int asic,
   {                              
     rv = bstFeaturePtr->bst_emcq_data_get_cb (asic, data, time);
   }
-  /* Release read lock */
-  SB_REDIRECT_RWLOCK_UNLOCK (sbRedirectRWLock);
   return rv;
 }
 
@@ -800,8 +815,7 @@ BVIEW_STATUS sbapi_bst_emcq_data_get (int asic,
 * @param[out]   data              Egress CPU Queue data structure
 * @param[out]   time              time
 *
-* @retval   BVIEW_STATUS_FAILURE      Due to lock acquistion failure or 
-*                                     Not able to get asic type of this unit or
+* @retval   BVIEW_STATUS_FAILURE      Not able to get asic type of this unit or
 *                                     BST feature is not present or
 *                                     BST south bound function has returned failure
 *
@@ -823,23 +837,18 @@ BVIEW_STATUS sbapi_bst_cpuq_data_get (int asic,
 {
   BVIEW_SB_BST_FEATURE_t *bstFeaturePtr = NULL;
   BVIEW_STATUS rv = BVIEW_STATUS_SUCCESS;
-  BVIEW_ASIC_TYPE asicType;
+  const BVIEW_SB_REDIRECT_UNIT_t *unitPtr = NULL;
 
-  /* Get asic type of the unit */
-  if (sbapi_system_unit_to_asic_type_get (asic, &asicType) !=
-      BVIEW_STATUS_SUCCESS)
+  /* Get south bound feature functions resolved for the unit */
+  unitPtr = sb_redirect_unit_get (asic);
+  if (unitPtr == NULL)
   {
     SB_REDIRECT_DEBUG_PRINT (BVIEW_LOG_ERROR,
                              "(%s:%d) Failed to get asic type for unit %d \n",
                              __FILE__, __LINE__, asic);
     return BVIEW_STATUS_FAILURE;
   }
-  /* Acquire Read lock */
-  SB_REDIRECT_RWLOCK_RD_LOCK (sbRedirectRWLock);
-  /* Get best matching south bound feature functions based on Asic type */
-  bstFeaturePtr =
-    (BVIEW_SB_BST_FEATURE_t *) sb_redirect_feature_handle_get (asicType,
-                                                               BVIEW_FEATURE_BST);
+  bstFeaturePtr = unitPtr->bstFeature;
   /* Validate feature pointer and south bound handler. 
    * Call south bound handler                        */    
   if (bstFeaturePtr == NULL)
@@ -854,8 +863,6 @@ BVIEW_STATUS sbapi_bst_cpuq_data_get (int asic,
   {                              
     rv = bstFeaturePtr->bst_cpuq_data_get_cb (asic, data, time);
   }
-  /* Release read lock */
-  SB_REDIRECT_RWLOCK_UNLOCK (sbRedirectRWLock);
   return rv;
 }
 
@@ -866,8 +873,7 @@ BVIEW_STATUS sbapi_bst_cpuq_data_get (int asic,
 * @param[out]   data              Egress RQE Queue data structure
 * @param[out]   time              time
 *
-* @retval   BVIEW_STATUS_FAILURE      Due to lock acquistion failure or 
-*                                     Not able to get asic type of this unit or
+* @retval   BVIEW_STATUS_FAILURE      Not able to get asic type of this unit or
 *                                     BST feature is not present or
 *                                     BST south bound function has returned failure
 *
@@ -888,23 +894,18 @@ BVIEW_STATUS sbapi_bst_rqeq_data_get (int asic,
 {
   BVIEW_SB_BST_FEATURE_t *bstFeaturePtr = NULL;
   BVIEW_STATUS rv = BVIEW_STATUS_SUCCESS;
-  BVIEW_ASIC_TYPE asicType;
+  const BVIEW_SB_REDIRECT_UNIT_t *unitPtr = NULL;
 
-  /* Get asic type of the unit */
-  if (sbapi_system_unit_to_asic_type_get (asic, &asicType) !=
-      BVIEW_STATUS_SUCCESS)
+  /* Get south bound feature functions resolved for the unit */
+  unitPtr = sb_redirect_unit_get (asic);
+  if (unitPtr == NULL)
   {
     SB_REDIRECT_DEBUG_PRINT (BVIEW_LOG_ERROR,
                              "(%s:%d) Failed to get asic type for unit %d \n",
                              __FILE__, __LINE__, asic);
     return BVIEW_STATUS_FAILURE;
   }
-  /* Acquire read lock */
-  SB_REDIRECT_RWLOCK_RD_LOCK (sbRedirectRWLock);
-  /* Get best matching south bound feature functions based on Asic type */
-  bstFeaturePtr =
-    (BVIEW_SB_BST_FEATURE_t *) sb_redirect_feature_handle_get (asicType,
-                                                               BVIEW_FEATURE_BST);
+  bstFeaturePtr = unitPtr->bstFeature;
   /* Validate feature pointer and south bound handler. 
    * Call south bound handler                        */    
   if (bstFeaturePtr == NULL)
@@ -919,8 +920,6 @@ BVIEW_STATUS sbapi_bst_rqeq_data_get (int asic,
   {                              
     rv = bstFeaturePtr->bst_rqeq_data_get_cb (asic, data, time);
   }
-  /* Release read lock */
-  SB_REDIRECT_RWLOCK_UNLOCK (sbRedirectRWLock);
   return rv;
 }
 
@@ -929,8 +928,7 @@ BVIEW_STATUS sbapi_bst_rqeq_data_get (int asic,
 *
 * @param[in]    asic            unit
 *
-* @retval   BVIEW_STATUS_FAILURE      Due to lock acquistion failure or 
-*                                     Not able to get asic type of this unit or
+* @retval   BVIEW_STATUS_FAILURE      Not able to get asic type of this unit or
 *                                     BST feature is not present or
 *                                     BST south bound function has returned failure
 *
@@ -948,23 +946,18 @@ BVIEW_STATUS sbapi_bst_clear_stats (int asic)
 {
   BVIEW_SB_BST_FEATURE_t *bstFeaturePtr = NULL;
   BVIEW_STATUS rv = BVIEW_STATUS_SUCCESS;
-  BVIEW_ASIC_TYPE asicType;
+  const BVIEW_SB_REDIRECT_UNIT_t *unitPtr = NULL;
 
-  /* Get asic type of the unit */
-  if (sbapi_system_unit_to_asic_type_get (asic, &asicType) !=
-      BVIEW_STATUS_SUCCESS)
+  /* Get south bound feature functions resolved for the unit */
+  unitPtr = sb_redirect_unit_get (asic);
+  if (unitPtr == NULL)
   {
     SB_REDIRECT_DEBUG_PRINT (BVIEW_LOG_ERROR,
                              "(%s:%d) Failed to get asic type for unit %d \n",
                              __FILE__, __LINE__, asic);
     return BVIEW_STATUS_FAILURE;
   }
-  /* Acquire Read lock */
-  SB_REDIRECT_RWLOCK_RD_LOCK (sbRedirectRWLock);
-  /* Get best matching south bound feature functions based on Asic type */
-  bstFeaturePtr =
-    (BVIEW_SB_BST_FEATURE_t *) sb_redirect_feature_handle_get (asicType,
-                                                               BVIEW_FEATURE_BST);
+  bstFeaturePtr = unitPtr->bstFeature;
   /* Validate feature pointer and south bound handler. 
    * Call south bound handler                        */    
   if (bstFeaturePtr == NULL)
@@ -979,8 +972,6 @@ BVIEW_STATUS sbapi_bst_clear_stats (int asic)
   {                              
     rv = bstFeaturePtr->bst_clear_stats_cb (asic);
   }
-  /* Release read lock */
-  SB_REDIRECT_RWLOCK_UNLOCK (sbRedirectRWLock);
   return rv;
 }
 
@@ -990,8 +981,7 @@ BVIEW_STATUS sbapi_bst_clear_stats (int asic)
 * @param[in]   asic                unit
 * @param[in]   thres               threshold
 * 
-* @retval   BVIEW_STATUS_FAILURE      Due to lock acquistion failure or 
-*                                     Not able to get asic type of this unit or
+* @retval   BVIEW_STATUS_FAILURE      Not able to get asic type of this unit or
 *                                     BST feature is not present or
 *                                     BST south bound function has returned failure
 *
@@ -1012,23 +1002,18 @@ BVIEW_STATUS sbapi_bst_device_threshold_set (int asic,
 {
   BVIEW_SB_BST_FEATURE_t *bstFeaturePtr = NULL;
   BVIEW_STATUS rv = BVIEW_STATUS_SUCCESS;
-  BVIEW_ASIC_TYPE asicType;
+  const BVIEW_SB_REDIRECT_UNIT_t *unitPtr = NULL;
 
-  /* Get asic type of the unit */
-  if (sbapi_system_unit_to_asic_type_get (asic, &asicType) !=
-      BVIEW_STATUS_SUCCESS)
+  /* Get south bound feature functions resolved for the unit */
+  unitPtr = sb_redirect_unit_get (asic);
+  if (unitPtr == NULL)
   {
     SB_REDIRECT_DEBUG_PRINT (BVIEW_LOG_ERROR,
                              "(%s:%d) Failed to get asic type for unit %d \n",
                              __FILE__, __LINE__, asic);
     return BVIEW_STATUS_FAILURE;
   }
-  /* Acquire Read lock */
-  SB_REDIRECT_RWLOCK_RD_LOCK (sbRedirectRWLock);
-  /* Get best matching south bound feature functions based on Asic type */
-  bstFeaturePtr =
-    (BVIEW_SB_BST_FEATURE_t *) sb_redirect_feature_handle_get (asicType,
-                                                               BVIEW_FEATURE_BST);
+  bstFeaturePtr = unitPtr->bstFeature;
   /* Validate feature pointer and south bound handler. 
    * Call south bound handler                        */    
   if (bstFeaturePtr == NULL)
@@ -1043,8 +1028,6 @@ BVIEW_STATUS sbapi_bst_device_threshold_set (int asic,
   {                              
     rv = bstFeaturePtr->bst_device_threshold_set_cb (asic, threshold);
   }
-  /* Release read lock */
-  SB_REDIRECT_RWLOCK_UNLOCK (sbRedirectRWLock);
   return rv;
 }
 
@@ -1057,8 +1040,7 @@ BVIEW_STATUS sbapi_bst_device_threshold_set (int asic,
 * @param[in]   pg                 Priority Group
 * @param[out]  thres              Threshold structure
 *
-* @retval   BVIEW_STATUS_FAILURE      Due to lock acquistion failure or 
-*                                     Not able to get asic type of this unit or
+* @retval   BVIEW_STATUS_FAILURE      Not able to get asic type of this unit or
 *                                     BST feature is not present or
 *                                     BST south bound function has returned failure
 *
@@ -1079,23 +1061,18 @@ BVIEW_STATUS sbapi_bst_ippg_threshold_set (int asic, int port, int pg,
 {
   BVIEW_SB_BST_FEATURE_t *bstFeaturePtr = NULL;
   BVIEW_STATUS rv = BVIEW_STATUS_SUCCESS;
-  BVIEW_ASIC_TYPE asicType;
+  const BVIEW_SB_REDIRECT_UNIT_t *unitPtr = NULL;
 
-  /* Get asic type of the unit */
-  if (sbapi_system_unit_to_asic_type_get (asic, &asicType) !=
-      BVIEW_STATUS_SUCCESS)
+  /* Get south bound feature functions resolved for the unit */
+  unitPtr = sb_redirect_unit_get (asic);
+  if (unitPtr == NULL)
   {
     SB_REDIRECT_DEBUG_PRINT (BVIEW_LOG_ERROR,
                              "(%s:%d) Failed to get asic type for unit %d \n",
                              __FILE__, __LINE__, asic);
     return BVIEW_STATUS_FAILURE;
   }
-  /* Acquire Read lock */
-  SB_REDIRECT_RWLOCK_RD_LOCK (sbRedirectRWLock);
-  /* Get best matching south bound feature functions based on Asic type */
-  bstFeaturePtr =
-    (BVIEW_SB_BST_FEATURE_t *) sb_redirect_feature_handle_get (asicType,
-                                                               BVIEW_FEATURE_BST);
+  bstFeaturePtr = unitPtr->bstFeature;
   /* Validate feature pointer and south bound handler. 
    * Call south bound handler                        */    
   if (bstFeaturePtr == NULL)
@@ -1110,8 +1087,6 @@ BVIEW_STATUS sbapi_bst_ippg_threshold_set (int asic, int port, int pg,
   {                              
     rv = bstFeaturePtr->bst_ippg_threshold_set_cb (asic, port, pg, threshold);
   }
-  /* Release read lock */
-  SB_REDIRECT_RWLOCK_UNLOCK (sbRedirectRWLock);
   return rv;
 }
 
@@ -1124,8 +1099,7 @@ BVIEW_STATUS sbapi_bst_ippg_threshold_set (int asic, int port, int pg,
 * @param[in]  sp                                      service pool
 * @param[in]  thres                                   threshold
 *
-* @retval   BVIEW_STATUS_FAILURE      Due to lock acquistion failure or 
-*                                     Not able to get asic type of this unit or
+* @retval   BVIEW_STATUS_FAILURE      Not able to get asic type of this unit or
 *                                     BST feature is not present or
 *                                     BST south bound function has returned failure
 *
@@ -1146,23 +1120,18 @@ BVIEW_STATUS sbapi_bst_ipsp_threshold_set (int asic, int port, int sp,
 {
   BVIEW_SB_BST_FEATURE_t *bstFeaturePtr = NULL;
   BVIEW_STATUS rv = BVIEW_STATUS_SUCCESS;
-  BVIEW_ASIC_TYPE asicType;
+  const BVIEW_SB_REDIRECT_UNIT_t *unitPtr = NULL;
 
-  /* Get asic type of the unit */
-  if (sbapi_system_unit_to_asic_type_get (asic, &asicType) !=
-      BVIEW_STATUS_SUCCESS)
+  /* Get south bound feature functions resolved for the unit */
+  unitPtr = sb_redirect_unit_get (asic);
+  if (unitPtr == NULL)
   {
     SB_REDIRECT_DEBUG_PRINT (BVIEW_LOG_ERROR,
                              "(%s:%d) Failed to get asic type for unit %d \n",
                              __FILE__, __LINE__, asic);
     return BVIEW_STATUS_FAILURE;
   }
-  /* Acquire Read lock */
-  SB_REDIRECT_RWLOCK_RD_LOCK (sbRedirectRWLock);
-  /* Get best matching south bound feature functions based on Asic type */
-  bstFeaturePtr =
-    (BVIEW_SB_BST_FEATURE_t *) sb_redirect_feature_handle_get (asicType,
-                                                               BVIEW_FEATURE_BST);
+  bstFeaturePtr = unitPtr->bstFeature;
   /* Validate feature pointer and south bound handler. 
    * Call south bound handler                        */    
   if (bstFeaturePtr == NULL)
@@ -1177,8 +1146,6 @@ BVIEW_STATUS sbapi_bst_ipsp_threshold_set (int asic, int port, int sp,
   {                              
     rv = bstFeaturePtr->bst_ipsp_threshold_set_cb (asic, port, sp, threshold);
   }
-  /* Release read lock */
-  SB_REDIRECT_RWLOCK_UNLOCK (sbRedirectRWLock);
   return rv;
 }
 
@@ -1190,8 +1157,7 @@ BVIEW_STATUS sbapi_bst_ipsp_threshold_set (int asic, int port, int sp,
 * @param[in]  sp                                 service pool
 * @param[in]  thres                              threshold
 *
-* @retval   BVIEW_STATUS_FAILURE      Due to lock acquistion failure or 
-*                                     Not able to get asic type of this unit or
+* @retval   BVIEW_STATUS_FAILURE      Not able to get asic type of this unit or
 *                                     BST feature is not present or
 *                                     BST south bound function has returned failure
 *
@@ -1212,23 +1178,18 @@ BVIEW_STATUS sbapi_bst_isp_threshold_set (int asic, int sp,
 {
   BVIEW_SB_BST_FEATURE_t *bstFeaturePtr = NULL;
   BVIEW_STATUS rv = BVIEW_STATUS_SUCCESS;
-  BVIEW_ASIC_TYPE asicType;
+  const BVIEW_SB_REDIRECT_UNIT_t *unitPtr = NULL;
 
-  /* Get asic type of the unit */
-  if (sbapi_system_unit_to_asic_type_get (asic, &asicType) !=
-      BVIEW_STATUS_SUCCESS)
+  /* Get south bound feature functions resolved for the unit */
+  unitPtr = sb_redirect_unit_get (asic);
+  if (unitPtr == NULL)
   {
     SB_REDIRECT_DEBUG_PRINT (BVIEW_LOG_ERROR,
                              "(%s:%d) Failed to get asic type for unit %d \n",
                              __FILE__, __LINE__, asic);
     return BVIEW_STATUS_FAILURE;
   }
-  /* Acquire Read lock */
-  SB_REDIRECT_RWLOCK_RD_LOCK (sbRedirectRWLock);
-  /* Get best matching south bound feature functions based on Asic type */
-  bstFeaturePtr =
-    (BVIEW_SB_BST_FEATURE_t *) sb_redirect_feature_handle_get (asicType,
-                                                               BVIEW_FEATURE_BST);
+  bstFeaturePtr = unitPtr->bstFeature;
   /* Validate feature pointer and south bound handler. 
    * Call south bound handler                        */    
   if (bstFeaturePtr == NULL)
@@ -1243,8 +1204,6 @@ BVIEW_STATUS sbapi_bst_isp_threshold_set (int asic, int sp,
   {                              
     rv = bstFeaturePtr->bst_isp_threshold_set_cb (asic, sp, threshold);
   }
-  /* Release read lock */
-  SB_REDIRECT_RWLOCK_UNLOCK (sbRedirectRWLock);
   return rv;
 }
 
@@ -1257,8 +1216,7 @@ BVIEW_STATUS sbapi_bst_isp_threshold_set (int asic, int sp,
 * @param[in]  sp                                    service pool
 * @param[in]  thres                                 threshold
 *
-* @retval   BVIEW_STATUS_FAILURE      Due to lock acquistion failure or 
-*                                     Not able to get asic type of this unit or
+* @retval   BVIEW_STATUS_FAILURE      Not able to get asic type of this unit or
 *                                     BST feature is not present or
 *                                     BST south bound function has returned failure
 *
@@ -1279,23 +1237,18 @@ BVIEW_STATUS sbapi_bst_epsp_threshold_set (int asic, int port, int sp,
 {
   BVIEW_SB_BST_FEATURE_t *bstFeaturePtr = NULL;
   BVIEW_STATUS rv = BVIEW_STATUS_SUCCESS;
-  BVIEW_ASIC_TYPE asicType;
+  const BVIEW_SB_REDIRECT_UNIT_t *unitPtr = NULL;
 
-  /* Get asic type of the unit */
-  if (sbapi_system_unit_to_asic_type_get (asic, &asicType) !=
-      BVIEW_STATUS_SUCCESS)
+  /* Get south bound feature functions resolved for the unit */
+  unitPtr = sb_redirect_unit_get (asic);
+  if (unitPtr == NULL)
   {
     SB_REDIRECT_DEBUG_PRINT (BVIEW_LOG_ERROR,
                              "(%s:%d) Failed to get asic type for unit %d \n",
                              __FILE__, __LINE__, asic);
     return BVIEW_STATUS_FAILURE;
   }
-  /* Acquire Read lock */
-  SB_REDIRECT_RWLOCK_RD_LOCK (sbRedirectRWLock);
-  /* Get best matching south bound feature functions based on Asic type */
-  bstFeaturePtr =
-    (BVIEW_SB_BST_FEATURE_t *) sb_redirect_feature_handle_get (asicType,
-                                                               BVIEW_FEATURE_BST);
+  bstFeaturePtr = unitPtr->bstFeature;
   /* Validate feature pointer and south bound handler. 
    * Call south bound handler                        */    
   if (bstFeaturePtr == NULL)
@@ -1310,8 +1263,6 @@ BVIEW_STATUS sbapi_bst_epsp_threshold_set (int asic, int port, int sp,
   {                              
     rv = bstFeaturePtr->bst_epsp_threshold_set_cb (asic, port, sp, threshold);
   }
-  /* Release read lock */
-  SB_REDIRECT_RWLOCK_UNLOCK (sbRedirectRWLock);
   return rv;
 }
 
@@ -1322,8 +1273,7 @@ BVIEW_STATUS sbapi_bst_epsp_threshold_set (int asic, int port, int sp,
 * @param[in]  sp                                  service pool
 * @param[in]  thres                               threshold
 *
-* @retval   BVIEW_STATUS_FAILURE      Due to lock acquistion failure or 
-*                                     Not able to get asic type of this unit or
+* @retval   BVIEW_STATUS_FAILURE      Not able to get asic type of this unit or
 *                                     BST feature is not present or
 *                                     BST south bound function has returned failure
 *
@@ -1344,23 +1294,18 @@ BVIEW_STATUS sbapi_bst_esp_threshold_set (int asic, int sp,
 {
   BVIEW_SB_BST_FEATURE_t *bstFeaturePtr = NULL;
   BVIEW_STATUS rv = BVIEW_STATUS_SUCCESS;
-  BVIEW_ASIC_TYPE asicType;
+  const BVIEW_SB_REDIRECT_UNIT_t *unitPtr = NULL;
 
-  /* Get asic type of the unit */
-  if (sbapi_system_unit_to_asic_type_get (asic, &asicType) !=
-      BVIEW_STATUS_SUCCESS)
+  /* Get south bound feature functions resolved for the unit */
+  unitPtr = sb_redirect_unit_get (asic);
+  if (unitPtr == NULL)
   {
     SB_REDIRECT_DEBUG_PRINT (BVIEW_LOG_ERROR,
                              "(%s:%d) Failed to get asic type for unit %d \n",
                              __FILE__, __LINE__, asic);
     return BVIEW_STATUS_FAILURE;
   }
-  /* Acquire Read lock */
-  SB_REDIRECT_RWLOCK_RD_LOCK (sbRedirectRWLock);
-  /* Get best matching south bound feature functions based on Asic type */
-  bstFeaturePtr =
-    (BVIEW_SB_BST_FEATURE_t *) sb_redirect_feature_handle_get (asicType,
-                                                               BVIEW_FEATURE_BST);
+  bstFeaturePtr = unitPtr->bstFeature;
   /* Validate feature pointer and south bound handler. 
    * Call south bound handler                        */    
   if (bstFeaturePtr == NULL)
@@ -1375,8 +1320,6 @@ BVIEW_STATUS sbapi_bst_esp_threshold_set (int asic, int sp,
   {                              
     rv = bstFeaturePtr->bst_esp_threshold_set_cb (asic, sp, threshold);
   }
-  /* Release read lock */
-  SB_REDIRECT_RWLOCK_UNLOCK (sbRedirectRWLock);
   return rv;
 }
 
@@ -1388,8 +1331,7 @@ BVIEW_STATUS sbapi_bst_esp_threshold_set (int asic, int sp,
 * @param[in]  ucQueue                         uc queue
 * @param[in]  thres                           threshold
 *
-* @retval   BVIEW_STATUS_FAILURE      Due to lock acquistion failure or 
-*                                     Not able to get asic type of this unit or
+* @retval   BVIEW_STATUS_FAILURE      Not able to get asic type of this unit or
 *                                     BST feature is not present or
 *                                     BST south bound function has returned failure
 *
@@ -1410,23 +1352,18 @@ BVIEW_STATUS sbapi_bst_eucq_threshold_set (int asic, int ucQueue,
 {
   BVIEW_SB_BST_FEATURE_t *bstFeaturePtr = NULL;
   BVIEW_STATUS rv = BVIEW_STATUS_SUCCESS;
-  BVIEW_ASIC_TYPE asicType;
+  const BVIEW_SB_REDIRECT_UNIT_t *unitPtr = NULL;
 
-  /* Get asic type of the unit */
-  if (sbapi_system_unit_to_asic_type_get (asic, &asicType) !=
-      BVIEW_STATUS_SUCCESS)
+  /* Get south bound feature functions resolved for the unit */
+  unitPtr = sb_redirect_unit_get (asic);
+  if (unitPtr == NULL)
   {
     SB_REDIRECT_DEBUG_PRINT (BVIEW_LOG_ERROR,
                              "(%s:%d) Failed to get asic type for unit %d \n",
                              __FILE__, __LINE__, asic);
     return BVIEW_STATUS_FAILURE;
   }
-  /* Acquire Read lock */
-  SB_REDIRECT_RWLOCK_RD_LOCK (sbRedirectRWLock);
-  /* Get best matching south bound feature functions based on Asic type */
-  bstFeaturePtr =
-    (BVIEW_SB_BST_FEATURE_t *) sb_redirect_feature_handle_get (asicType,
-                                                               BVIEW_FEATURE_BST);
+  bstFeaturePtr = unitPtr->bstFeature;
   /* Validate feature pointer and south bound handler. 
    * Call south bound handler                        */    
   if (bstFeaturePtr == NULL)
@@ -1441,8 +1378,6 @@ BVIEW_STATUS sbapi_bst_eucq_threshold_set (int asic, int ucQueue,
   {                              
     rv = bstFeaturePtr->bst_eucq_threshold_set_cb (asic, ucQueue, threshold);
   }
-  /* Release read lock */
-  SB_REDIRECT_RWLOCK_UNLOCK (sbRedirectRWLock);
   return rv;
 }
 
@@ -1454,8 +1389,7 @@ BVIEW_STATUS sbapi_bst_eucq_threshold_set (int asic, int ucQueue,
 * @param[in] ucQueueGrp                                uc queue group
 * @param[in] thres                                     threshold
 *
-* @retval   BVIEW_STATUS_FAILURE      Due to lock acquistion failure or 
-*                                     Not able to get asic type of this unit or
+* @retval   BVIEW_STATUS_FAILURE      Not able to get asic type of this unit or
 *                                     BST feature is not present or
 *                                     BST south bound function has returned failure
 *
@@ -1477,23 +1411,18 @@ BVIEW_STATUS sbapi_bst_eucqg_threshold_set (int asic, int ucQueueGrp,
 {
   BVIEW_SB_BST_FEATURE_t *bstFeaturePtr = NULL;
   BVIEW_STATUS rv = BVIEW_STATUS_SUCCESS;
-  BVIEW_ASIC_TYPE asicType;
+  const BVIEW_SB_REDIRECT_UNIT_t *unitPtr = NULL;
 
-  /* Get asic type of the unit */
-  if (sbapi_system_unit_to_asic_type_get (asic, &asicType) !=
-      BVIEW_STATUS_SUCCESS)
+  /* Get south bound feature functions resolved for the unit */
+  unitPtr = sb_redirect_unit_get (asic);
+  if (unitPtr == NULL)
   {
     SB_REDIRECT_DEBUG_PRINT (BVIEW_LOG_ERROR,
                              "(%s:%d) Failed to get asic type for unit %d \n",
                              __FILE__, __LINE__, asic);
     return BVIEW_STATUS_FAILURE;
   }
-  /* Acquire Read lock */
-  SB_REDIRECT_RWLOCK_RD_LOCK (sbRedirectRWLock);
-  /* Get best matching south bound feature functions based on Asic type */
-  bstFeaturePtr =
-    (BVIEW_SB_BST_FEATURE_t *) sb_redirect_feature_handle_get (asicType,
-                                                               BVIEW_FEATURE_BST);
+  bstFeaturePtr = unitPtr->bstFeature;
   /* Validate feature pointer and south bound handler. 
    * Call south bound handler                        */    
   if (bstFeaturePtr == NULL)
@@ -1509,8 +1438,6 @@ BVIEW_STATUS sbapi_bst_eucqg_threshold_set (int asic, int ucQueueGrp,
     rv =
       bstFeaturePtr->bst_eucqg_threshold_set_cb (asic, ucQueueGrp, threshold);
   }
-  /* Release read lock */
-  SB_REDIRECT_RWLOCK_UNLOCK (sbRedirectRWLock);
   return rv;
 }
 
@@ -1522,8 +1449,7 @@ BVIEW_STATUS sbapi_bst_eucqg_threshold_set (int asic, int ucQueueGrp,
 * @param[in]  mcQueue                                - mcQueue
 * @param[in]  thres                                  - threshold
 *
-* @retval   BVIEW_STATUS_FAILURE      Due to lock acquistion failure or 
-*                                     Not able to get asic type of this unit or
+* @retval   BVIEW_STATUS_FAILURE      Not able to get asic type of this unit or
 *                                     BST feature is not present or
 *                                     BST south bound function has returned failure
 *
@@ -1545,23 +1471,18 @@ BVIEW_STATUS sbapi_bst_emcq_threshold_set (int asic, int mcQueue,
 {
   BVIEW_SB_BST_FEATURE_t *bstFeaturePtr = NULL;
   BVIEW_STATUS rv = BVIEW_STATUS_SUCCESS;
-  BVIEW_ASIC_TYPE asicType;
+  const BVIEW_SB_REDIRECT_UNIT_t *unitPtr = NULL;
 
-  /* Get asic type of the unit */
-  if (sbapi_system_unit_to_asic_type_get (asic, &asicType) !=
-      BVIEW_STATUS_SUCCESS)
+  /* Get south bound feature functions resolved for the unit */
+  unitPtr = sb_redirect_unit_get (asic);
+  if (unitPtr == NULL)
   {
     SB_REDIRECT_DEBUG_PRINT (BVIEW_LOG_ERROR,
                              "(%s:%d) Failed to get asic type for unit %d \n",
                              __FILE__, __LINE__, asic);
     return BVIEW_STATUS_FAILURE;
   }
-  /* Acquire Read lock */
-  SB_REDIRECT_RWLOCK_RD_LOCK (sbRedirectRWLock);
-  /* Get best matching south bound feature functions based on Asic type */
-  bstFeaturePtr =
-    (BVIEW_SB_BST_FEATURE_t *) sb_redirect_feature_handle_get (asicType,
-                                                               BVIEW_FEATURE_BST);
+  bstFeaturePtr = unitPtr->bstFeature;
   /* Validate feature pointer and south bound handler. 
    * Call south bound handler                        */    
   if (bstFeaturePtr == NULL)
@@ -1576,8 +1497,6 @@ BVIEW_STATUS sbapi_bst_emcq_threshold_set (int asic, int mcQueue,
   {                              
     rv = bstFeaturePtr->bst_emcq_threshold_set_cb (asic, mcQueue, threshold);
   }
-  /* Release read lock */
-  SB_REDIRECT_RWLOCK_UNLOCK (sbRedirectRWLock);
   return rv;
 }
 
@@ -1589,8 +1508,7 @@ BVIEW_STATUS sbapi_bst_emcq_threshold_set (int asic, int mcQueue,
 * @param[in]  cpuQueue                                cpuQueue
 * @param[in]  thres                                   threshold
 *
-* @retval   BVIEW_STATUS_FAILURE      Due to lock acquistion failure or 
-*                                     Not able to get asic type of this unit or
+* @retval   BVIEW_STATUS_FAILURE      Not able to get asic type of this unit or
 *                                     BST feature is not present or
 *                                     BST south bound function has returned failure
 *
@@ -1612,23 +1530,18 @@ BVIEW_STATUS sbapi_bst_cpuq_threshold_set (int asic, int cpuQueue,
 {
   BVIEW_SB_BST_FEATURE_t *bstFeaturePtr = NULL;
   BVIEW_STATUS rv = BVIEW_STATUS_SUCCESS;
-  BVIEW_ASIC_TYPE asicType;
+  const BVIEW_SB_REDIRECT_UNIT_t *unitPtr = NULL;
 
-  /* Get asic type of the unit */
-  if (sbapi_system_unit_to_asic_type_get (asic, &asicType) !=
-      BVIEW_STATUS_SUCCESS)
+  /* Get south bound feature functions resolved for the unit */
+  unitPtr = sb_redirect_unit_get (asic);
+  if (unitPtr == NULL)
   {
     SB_REDIRECT_DEBUG_PRINT (BVIEW_LOG_ERROR,
                              "(%s:%d) Failed to get asic type for unit %d \n",
                              __FILE__, __LINE__, asic);
     return BVIEW_STATUS_FAILURE;
   }
-  /* Acquire Read lock */
-  SB_REDIRECT_RWLOCK_RD_LOCK (sbRedirectRWLock);
-  /* Get best matching south bound feature functions based on Asic type */
-  bstFeaturePtr =
-    (BVIEW_SB_BST_FEATURE_t *) sb_redirect_feature_handle_get (asicType,
-                                                               BVIEW_FEATURE_BST);
+  bstFeaturePtr = unitPtr->bstFeature;
   /* Validate feature pointer and south bound handler. 
    * Call south bound handler                        */    
   if (bstFeaturePtr == NULL)
@@ -1643,8 +1556,6 @@ BVIEW_STATUS sbapi_bst_cpuq_threshold_set (int asic, int cpuQueue,
   {                              
     rv = bstFeaturePtr->bst_cpuq_threshold_set_cb (asic, cpuQueue, threshold);
   }
-  /* Release read lock */
-  SB_REDIRECT_RWLOCK_UNLOCK (sbRedirectRWLock);
   return rv;
 }
 
@@ -1656,8 +1567,7 @@ BVIEW_STATUS sbapi_bst_cpuq_threshold_set (int asic, int cpuQueue,
 * @param[in]     rqeQueue                rqeQueue
 * @param[out]    thres                   Threshold data structure
 *
-* @retval   BVIEW_STATUS_FAILURE      Due to lock acquistion failure or 
-*                                     Not able to get asic type of this unit or
+* @retval   BVIEW_STATUS_FAILURE      Not able to get asic type of this unit or
 *                                     BST feature is not present or
 *                                     BST south bound function has returned failure
 *
@@ -1679,22 +1589,17 @@ BVIEW_STATUS sbapi_bst_rqeq_threshold_set (int asic, int rqeQueue,
 {
   BVIEW_SB_BST_FEATURE_t *bstFeaturePtr = NULL;
   BVIEW_STATUS rv = BVIEW_STATUS_SUCCESS;
-  BVIEW_ASIC_TYPE asicType;
-  /* Get asic type of the unit */
-  if (sbapi_system_unit_to_asic_type_get (asic, &asicType) !=
-      BVIEW_STATUS_SUCCESS)
+  const BVIEW_SB_REDIRECT_UNIT_t *unitPtr = NULL;
+  /* Get south bound feature functions resolved for the unit */
+  unitPtr = sb_redirect_unit_get (asic);
+  if (unitPtr == NULL)
   {
     SB_REDIRECT_DEBUG_PRINT (BVIEW_LOG_ERROR,
                              "(%s:%d) Failed to get asic type for unit %d \n",
                              __FILE__, __LINE__, asic);
     return BVIEW_STATUS_FAILURE;
   }
-  /* Acquire Read lock */
-  SB_REDIRECT_RWLOCK_RD_LOCK (sbRedirectRWLock);
-  /* Get best matching south bound feature functions based on Asic type */
-  bstFeaturePtr =
-    (BVIEW_SB_BST_FEATURE_t *) sb_redirect_feature_handle_get (asicType,
-                                                               BVIEW_FEATURE_BST);
+  bstFeaturePtr = unitPtr->bstFeature;
   /* Validate feature pointer and south bound handler. 
    * Call south bound handler                        */    
   if (bstFeaturePtr == NULL)
@@ -1709,8 +1614,64 @@ BVIEW_STATUS sbapi_bst_rqeq_threshold_set (int asic, int rqeQueue,
   {                              
     rv = bstFeaturePtr->bst_rqeq_threshold_set_cb (asic, rqeQueue, threshold);
   }
-  /* Release read lock */
-  SB_REDIRECT_RWLOCK_UNLOCK (sbRedirectRWLock);
+  return rv;
+}
+
+/*********************************************************************
+* @brief  Set threshold configuration of many realm entries in
+*           one batch
+*
+* @param[in]     asic                    unit
+* @param[in,out] entries                 Realm entries and thresholds,
+*                                        status of each entry
+* @param[in]     numEntries              Number of entries
+*
+* @retval   BVIEW_STATUS_FAILURE      Not able to get asic type of this unit or
+*                                     BST feature is not present or
+*                                     threshold set of an entry has failed
+*
+* @retval   BVIEW_STATUS_SUCCESS      Thresholds of all entries are set
+*
+* @retval   BVIEW_STATUS_UNSUPPORTED  Bulk threshold set functionality is
+*                                     not supported on this unit
+*
+*
+* @notes    A failed entry does not stop the batch, the status
+*           of every entry is returned in the entry.
+*
+*
+*********************************************************************/
+BVIEW_STATUS sbapi_bst_threshold_bulk_set (int asic,
+                                           BVIEW_BST_THRESHOLD_BULK_ENTRY_t * entries,
+                                           unsigned int numEntries)
+{
+  BVIEW_SB_BST_FEATURE_t *bstFeaturePtr = NULL;
+  BVIEW_STATUS rv = BVIEW_STATUS_SUCCESS;
+  const BVIEW_SB_REDIRECT_UNIT_t *unitPtr = NULL;
+  /* Get south bound feature functions resolved for the unit */
+  unitPtr = sb_redirect_unit_get (asic);
+  if (unitPtr == NULL)
+  {
+    SB_REDIRECT_DEBUG_PRINT (BVIEW_LOG_ERROR,
+                             "(%s:%d) Failed to get asic type for unit %d \n",
+                             __FILE__, __LINE__, asic);
+    return BVIEW_STATUS_FAILURE;
+  }
+  bstFeaturePtr = unitPtr->bstFeature;
+  /* Validate feature pointer and south bound handler. 
+   * Call south bound handler                        */    
+  if (bstFeaturePtr == NULL)
+  {
+    rv = BVIEW_STATUS_FAILURE;
+  }                
+  else if (bstFeaturePtr->bst_threshold_bulk_set_cb == NULL)
+  {
+    rv = BVIEW_STATUS_UNSUPPORTED;
+  }
+  else
+  {                              
+    rv = bstFeaturePtr->bst_threshold_bulk_set_cb (asic, entries, numEntries);
+  }
   return rv;
 }
 
@@ -1722,8 +1683,7 @@ BVIEW_STATUS sbapi_bst_rqeq_threshold_set (int asic, int rqeQueue,
 * @param[out]  thresholdSnapshot             threshold snapshot
 * @param[out]  time                          time
 *
-* @retval   BVIEW_STATUS_FAILURE      Due to lock acquistion failure or 
-*                                     Not able to get asic type of this unit or
+* @retval   BVIEW_STATUS_FAILURE      Not able to get asic type of this unit or
 *                                     BST feature is not present or
 *                                     BST south bound function has returned failure
 *
@@ -1743,23 +1703,18 @@ BVIEW_STATUS sbapi_bst_threshold_get (int asic,
 {
   BVIEW_SB_BST_FEATURE_t *bstFeaturePtr = NULL;
   BVIEW_STATUS rv = BVIEW_STATUS_SUCCESS;
-  BVIEW_ASIC_TYPE asicType;
+  const BVIEW_SB_REDIRECT_UNIT_t *unitPtr = NULL;
 
-  /* Get asic type of the unit */
-  if (sbapi_system_unit_to_asic_type_get (asic, &asicType) !=
-      BVIEW_STATUS_SUCCESS)
+  /* Get south bound feature functions resolved for the unit */
+  unitPtr = sb_redirect_unit_get (asic);
+  if (unitPtr == NULL)
   {
     SB_REDIRECT_DEBUG_PRINT (BVIEW_LOG_ERROR,
                              "(%s:%d) Failed to get asic type for unit %d \n",
                              __FILE__, __LINE__, asic);
     return BVIEW_STATUS_FAILURE;
   }
-  /* Acquire Read lock */
-  SB_REDIRECT_RWLOCK_RD_LOCK (sbRedirectRWLock);
-  /* Get best matching south bound feature functions based on Asic type */
-  bstFeaturePtr =
-    (BVIEW_SB_BST_FEATURE_t *) sb_redirect_feature_handle_get (asicType,
-                                                               BVIEW_FEATURE_BST);
+  bstFeaturePtr = unitPtr->bstFeature;
   /* Validate feature pointer and south bound handler. 
    * Call south bound handler                        */    
   if (bstFeaturePtr == NULL)
@@ -1774,8 +1729,68 @@ BVIEW_STATUS sbapi_bst_threshold_get (int asic,
   {                              
     rv = bstFeaturePtr->bst_threshold_get_cb (asic, thresholdSnapshot, time);
   }
-  /* Release read lock */
-  SB_REDIRECT_RWLOCK_UNLOCK (sbRedirectRWLock);
+  return rv;
+}
+
+/*********************************************************************
+* @brief  Read snapshot of all thresholds configured from HW and
+*         verify the shadow copy of the thresholds
+*
+*
+* @param[in]   asic                          unit
+* @param[out]  thresholdSnapshot             threshold snapshot
+* @param[out]  time                          time
+* @param[out]  mismatches                    number of thresholds that
+*                                            differ from the shadow copy
+*
+* @retval   BVIEW_STATUS_FAILURE      Not able to get asic type of this unit or
+*                                     BST feature is not present or
+*                                     BST south bound function has returned failure
+*
+* @retval   BVIEW_STATUS_SUCCESS      Threshold verify is successful 
+*
+* @retval   BVIEW_STATUS_UNSUPPORTED  Threshold verify functionality is 
+*                                     not supported on this unit
+*
+*
+* @notes    The shadow copy is updated with the thresholds read from HW.
+*
+*
+*********************************************************************/
+BVIEW_STATUS sbapi_bst_threshold_verify (int asic,
+                                      BVIEW_BST_ASIC_SNAPSHOT_DATA_t *thresholdSnapshot,
+                                      BVIEW_TIME_t * time,
+                                      unsigned int *mismatches)
+{
+  BVIEW_SB_BST_FEATURE_t *bstFeaturePtr = NULL;
+  BVIEW_STATUS rv = BVIEW_STATUS_SUCCESS;
+  const BVIEW_SB_REDIRECT_UNIT_t *unitPtr = NULL;
+
+  /* Get south bound feature functions resolved for the unit */
+  unitPtr = sb_redirect_unit_get (asic);
+  if (unitPtr == NULL)
+  {
+    SB_REDIRECT_DEBUG_PRINT (BVIEW_LOG_ERROR,
+                             "(%s:%d) Failed to get asic type for unit %d \n",
+                             __FILE__, __LINE__, asic);
+    return BVIEW_STATUS_FAILURE;
+  }
+  bstFeaturePtr = unitPtr->bstFeature;
+  /* Validate feature pointer and south bound handler. 
+   * Call south bound handler                        */    
+  if (bstFeaturePtr == NULL)
+  {
+    rv = BVIEW_STATUS_FAILURE;
+  }                
+  else if (bstFeaturePtr->bst_threshold_verify_cb == NULL)
+  {
+    rv = BVIEW_STATUS_UNSUPPORTED;
+  }
+  else
+  {                              
+    rv = bstFeaturePtr->bst_threshold_verify_cb (asic, thresholdSnapshot, time,
+                                               mismatches);
+  }
   return rv;
 }
 
@@ -1785,8 +1800,7 @@ BVIEW_STATUS sbapi_bst_threshold_get (int asic,
 *
 * @param[in] asic                        unit
 *
-* @retval   BVIEW_STATUS_FAILURE      Due to lock acquistion failure or 
-*                                     Not able to get asic type of this unit or
+* @retval   BVIEW_STATUS_FAILURE      Not able to get asic type of this unit or
 *                                     BST feature is not present or
 *                                     BST south bound function has returned failure
 *
@@ -1806,22 +1820,17 @@ BVIEW_STATUS sbapi_bst_clear_thresholds (int asic)
 {
   BVIEW_SB_BST_FEATURE_t *bstFeaturePtr = NULL;
   BVIEW_STATUS rv = BVIEW_STATUS_SUCCESS;
-  BVIEW_ASIC_TYPE asicType;
-  /* Get asic type of the unit */
-  if (sbapi_system_unit_to_asic_type_get (asic, &asicType) !=
-      BVIEW_STATUS_SUCCESS)
+  const BVIEW_SB_REDIRECT_UNIT_t *unitPtr = NULL;
+  /* Get south bound feature functions resolved for the unit */
+  unitPtr = sb_redirect_unit_get (asic);
+  if (unitPtr == NULL)
   {
     SB_REDIRECT_DEBUG_PRINT (BVIEW_LOG_ERROR,
                              "(%s:%d) Failed to get asic type for unit %d \n",
                              __FILE__, __LINE__, asic);
     return BVIEW_STATUS_FAILURE;
   }
-  /* Acquire Read lock */
-  SB_REDIRECT_RWLOCK_RD_LOCK (sbRedirectRWLock);
-  /* Get best matching south bound feature functions based on Asic type */
-  bstFeaturePtr =
-    (BVIEW_SB_BST_FEATURE_t *) sb_redirect_feature_handle_get (asicType,
-                                                               BVIEW_FEATURE_BST);
+  bstFeaturePtr = unitPtr->bstFeature;
   /* Validate feature pointer and south bound handler. 
    * Call south bound handler                        */    
   if (bstFeaturePtr == NULL)
@@ -1836,8 +1845,6 @@ BVIEW_STATUS sbapi_bst_clear_thresholds (int asic)
   {                              
     rv = bstFeaturePtr->bst_clear_thresholds_cb (asic);
   }
-  /* Release read lock */
-  SB_REDIRECT_RWLOCK_UNLOCK (sbRedirectRWLock);
   return rv;
 }
 
@@ -1847,8 +1854,7 @@ BVIEW_STATUS sbapi_bst_clear_thresholds (int asic)
 *
 * @param[in] asic                  unit
 *
-* @retval   BVIEW_STATUS_FAILURE      Due to lock acquistion failure or 
-*                                     Not able to get asic type of this unit or
+* @retval   BVIEW_STATUS_FAILURE      Not able to get asic type of this unit or
 *                                     BST feature is not present or
 *                                     BST south bound function has returned failure
 *
@@ -1867,23 +1873,18 @@ BVIEW_STATUS sbapi_bst_register_trigger (int asic,
 {
   BVIEW_SB_BST_FEATURE_t *bstFeaturePtr = NULL;
   BVIEW_STATUS rv = BVIEW_STATUS_SUCCESS;
-  BVIEW_ASIC_TYPE asicType;
+  const BVIEW_SB_REDIRECT_UNIT_t *unitPtr = NULL;
 
-  /* Get asic type of the unit */
-  if (sbapi_system_unit_to_asic_type_get (asic, &asicType) !=
-      BVIEW_STATUS_SUCCESS)
+  /* Get south bound feature functions resolved for the unit */
+  unitPtr = sb_redirect_unit_get (asic);
+  if (unitPtr == NULL)
   {
     SB_REDIRECT_DEBUG_PRINT (BVIEW_LOG_ERROR,
                              "(%s:%d) Failed to get asic type for unit %d \n",
                              __FILE__, __LINE__, asic);
     return BVIEW_STATUS_FAILURE;
   }
-  /* Acquire Read lock */
-  SB_REDIRECT_RWLOCK_RD_LOCK (sbRedirectRWLock);
-  /* Get best matching south bound feature functions based on Asic type */
-  bstFeaturePtr =
-    (BVIEW_SB_BST_FEATURE_t *) sb_redirect_feature_handle_get (asicType,
-                                                               BVIEW_FEATURE_BST);
+  bstFeaturePtr = unitPtr->bstFeature;
   /* Validate feature pointer and south bound handler. 
    * Call south bound handler                        */    
   if (bstFeaturePtr == NULL)
@@ -1898,7 +1899,5 @@ BVIEW_STATUS sbapi_bst_register_trigger (int asic,
   {                              
     rv = bstFeaturePtr->bst_register_trigger_cb (asic, callback, cookie);
   }
-  /* Release read lock */
-  SB_REDIRECT_RWLOCK_UNLOCK (sbRedirectRWLock);
   return rv;
 }
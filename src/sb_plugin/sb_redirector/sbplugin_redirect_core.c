@@ -31,6 +31,18 @@ pthread_rwlock_t sbRedirectRWLock;
 /* Debug flag                    */
 int sbRedirectDebugFlag = 0;
 
+/* Dispatch tables. Every registration publishes the next table, a
+   published table is never reused, so lock free readers holding an
+   older table keep reading consistent data
+ */
+static BVIEW_SB_REDIRECT_DISPATCH_t sbRedirectDispatchPool[SB_REDIRECT_DISPATCH_POOL_SIZE];
+
+/* Number of dispatch tables published so far */
+static unsigned int sbRedirectDispatchCount = 0;
+
+/* Dispatch table in use, read without the redirector lock */
+static BVIEW_SB_REDIRECT_DISPATCH_t *sbRedirectDispatch = NULL;
+
 /*********************************************************************
 * @brief       Initialize South bound redirector's local data with defaults
 *
@@ -49,6 +61,11 @@ BVIEW_STATUS sb_redirector_init ()
 
   /* clear sbRedirectPluginList */
   memset (sbRedirectPluginList, 0x00, sizeof (sbRedirectPluginList));
+  /* publish an empty dispatch table */
+  memset (sbRedirectDispatchPool, 0x00, sizeof (sbRedirectDispatchPool));
+  sbRedirectDispatchCount = 1;
+  __atomic_store_n (&sbRedirectDispatch, &sbRedirectDispatchPool[0],
+                    __ATOMIC_RELEASE);
   /* Initialize Read Write lock with default attributes */
   if (pthread_rwlock_init (&sbRedirectRWLock, NULL) != 0)
   {
@@ -77,11 +94,11 @@ BVIEW_STATUS sb_redirector_init ()
 *                                            the silicon type(/all) 
 *
 *
-* @notes    none
+* @notes    Caller holds the redirector read or write lock.
 *
 ***************************************************************************************/
-void *sb_redirect_feature_handle_get (BVIEW_ASIC_TYPE asicType,
-                                      BVIEW_FEATURE_ID featureId)
+static void *sb_redirect_feature_lookup (BVIEW_ASIC_TYPE asicType,
+                                         BVIEW_FEATURE_ID featureId)
 {
   unsigned int sbPluginIndex = 0;
   unsigned int featureListIndex = 0;
@@ -91,15 +108,6 @@ void *sb_redirect_feature_handle_get (BVIEW_ASIC_TYPE asicType,
   bool asicEntryFound = false;
   bool allAsicEntryFound = false;
 
-  /* Acquire Read lock */
-  if (pthread_rwlock_rdlock (&sbRedirectRWLock) != 0)
-  {
-    SB_REDIRECT_DEBUG_PRINT (BVIEW_LOG_ERROR,
-                             "(%s:%d) Failed to take SB redirect read write lock for read\n",
-                             __FILE__, __LINE__);
-    return NULL;
-  }
-
   /* Loop through the plug-in list */
   for (sbPluginIndex = 0;
        sbPluginIndex < (sizeof (sbRedirectPluginList) / sizeof (sbRedirectPluginList[0]))
@@ -153,6 +161,46 @@ void *sb_redirect_feature_handle_get (BVIEW_ASIC_TYPE asicType,
                              "(%s:%d) Failed to find SB plugin entry for feature %d, silicon %d\n",
                              __FILE__, __LINE__, featureId, asicType);
   }
+
+  return (void *) featurePtrOut;
+}
+
+/*********************************************************************
+* @brief   Get Function list for a particular feature based on Silicon type.
+*          A function list is selected in the following order.
+*          1. If an exact match for a silicon is found then that function list 
+*                                                                  is returned.
+*          2. Else return a function list that has support for 
+*                                             all silicon types.
+*                               
+*
+* @param[in]  asicType            Asic type
+* @param[in]  featureId           Feature ID
+*
+* @retval   NULL                   if function fails
+* @retval   FunctionListPtr        Function list that matches with 
+*                                            the silicon type(/all) 
+*
+*
+* @notes    none
+*
+***************************************************************************************/
+void *sb_redirect_feature_handle_get (BVIEW_ASIC_TYPE asicType,
+                                      BVIEW_FEATURE_ID featureId)
+{
+  void *featurePtrOut = NULL;
+
+  /* Acquire Read lock */
+  if (pthread_rwlock_rdlock (&sbRedirectRWLock) != 0)
+  {
+    SB_REDIRECT_DEBUG_PRINT (BVIEW_LOG_ERROR,
+                             "(%s:%d) Failed to take SB redirect read write lock for read\n",
+                             __FILE__, __LINE__);
+    return NULL;
+  }
+
+  featurePtrOut = sb_redirect_feature_lookup (asicType, featureId);
+
   /* Release the read lock */
   if (pthread_rwlock_unlock (&sbRedirectRWLock) != 0)
   {
@@ -161,7 +209,132 @@ void *sb_redirect_feature_handle_get (BVIEW_ASIC_TYPE asicType,
                              __FILE__, __LINE__);
   }
 
-  return (void *) featurePtrOut;
+  return featurePtrOut;
+}
+
+/*********************************************************************
+* @brief       Resolve the south bound features of all the units and
+*              publish them as a new dispatch table
+*
+* @retval   none
+*
+* @notes    Called with the redirector write lock held, once the caller
+*           has checked that a dispatch table is free.
+*
+*********************************************************************/
+static void sb_redirect_dispatch_publish (void)
+{
+  BVIEW_SB_REDIRECT_DISPATCH_t *dispatchPtr = NULL;
+  BVIEW_SB_REDIRECT_UNIT_t *unitPtr = NULL;
+  BVIEW_SB_SYSTEM_FEATURE_t *systemFeaturePtr = NULL;
+  BVIEW_ASIC_t *asicInfoPtr = NULL;
+  BVIEW_ASIC_t *asicCapInfoPtr = NULL;
+  unsigned int asicListIndex = 0;
+  unsigned int asicCapIndex = 0;
+
+  dispatchPtr = &sbRedirectDispatchPool[sbRedirectDispatchCount];
+  memset (dispatchPtr, 0x00, sizeof (BVIEW_SB_REDIRECT_DISPATCH_t));
+
+  /* Units are listed by the system feature supporting all silicon types */
+  dispatchPtr->systemFeature =
+    (BVIEW_SB_SYSTEM_FEATURE_t *) sb_redirect_feature_lookup (BVIEW_ASIC_TYPE_ALL,
+                                                              BVIEW_FEATURE_SYSTEM);
+  if (dispatchPtr->systemFeature != NULL)
+  {
+    for (asicListIndex = 0;
+         asicListIndex < dispatchPtr->systemFeature->numSupportedAsics;
+         asicListIndex++)
+    {
+      asicInfoPtr = dispatchPtr->systemFeature->asicList[asicListIndex];
+      if ((asicInfoPtr == NULL) || (asicInfoPtr->unit < 0) ||
+          (asicInfoPtr->unit >= BVIEW_MAX_ASICS_ON_A_PLATFORM))
+      {
+        continue;
+      }
+      /* First entry of a unit wins, as in a linear lookup */
+      unitPtr = &dispatchPtr->unit[asicInfoPtr->unit];
+      if (unitPtr->isValid == true)
+      {
+        continue;
+      }
+      unitPtr->isValid = true;
+      unitPtr->asicType = asicInfoPtr->asicType;
+      unitPtr->bstFeature =
+        (BVIEW_SB_BST_FEATURE_t *) sb_redirect_feature_lookup (unitPtr->asicType,
+                                                               BVIEW_FEATURE_BST);
+      systemFeaturePtr =
+        (BVIEW_SB_SYSTEM_FEATURE_t *) sb_redirect_feature_lookup (unitPtr->asicType,
+                                                                  BVIEW_FEATURE_SYSTEM);
+      unitPtr->systemFeature = systemFeaturePtr;
+      if (systemFeaturePtr == NULL)
+      {
+        continue;
+      }
+      /* Asic capabilities of the asic type */
+      for (asicCapIndex = 0; asicCapIndex < systemFeaturePtr->numSupportedAsics;
+           asicCapIndex++)
+      {
+        asicCapInfoPtr = systemFeaturePtr->asicList[asicCapIndex];
+        if ((asicCapInfoPtr != NULL) &&
+            (asicCapInfoPtr->asicType == unitPtr->asicType))
+        {
+          unitPtr->asicCap = &(asicCapInfoPtr->scalingParams);
+          break;
+        }
+      }
+    }
+  }
+
+  sbRedirectDispatchCount++;
+  __atomic_store_n (&sbRedirectDispatch, dispatchPtr, __ATOMIC_RELEASE);
+}
+
+/*********************************************************************
+* @brief       Get the resolved south bound features of a unit
+*
+* @param[in]   asic       Unit number
+*
+* @retval   NULL          if the unit is not present
+* @retval   UnitPtr       Dispatch entry of the unit
+*
+* @notes    Lock free, the entry is read from the dispatch table
+*           published by the last plug-in registration.
+*
+*********************************************************************/
+const BVIEW_SB_REDIRECT_UNIT_t *sb_redirect_unit_get (int asic)
+{
+  BVIEW_SB_REDIRECT_DISPATCH_t *dispatchPtr = NULL;
+
+  dispatchPtr = __atomic_load_n (&sbRedirectDispatch, __ATOMIC_ACQUIRE);
+  if ((dispatchPtr == NULL) || (asic < 0) ||
+      (asic >= BVIEW_MAX_ASICS_ON_A_PLATFORM) ||
+      (dispatchPtr->unit[asic].isValid == false))
+  {
+    return NULL;
+  }
+  return &dispatchPtr->unit[asic];
+}
+
+/*********************************************************************
+* @brief       Get the system feature supporting all silicon types
+*
+* @retval   NULL                  if no system feature is registered
+* @retval   SystemFeaturePtr      System feature function list
+*
+* @notes    Lock free, the feature is read from the dispatch table
+*           published by the last plug-in registration.
+*
+*********************************************************************/
+BVIEW_SB_SYSTEM_FEATURE_t *sb_redirect_system_feature_get (void)
+{
+  BVIEW_SB_REDIRECT_DISPATCH_t *dispatchPtr = NULL;
+
+  dispatchPtr = __atomic_load_n (&sbRedirectDispatch, __ATOMIC_ACQUIRE);
+  if (dispatchPtr == NULL)
+  {
+    return NULL;
+  }
+  return dispatchPtr->systemFeature;
 }
 
 /*********************************************************************
@@ -322,7 +495,8 @@ static BVIEW_STATUS sb_plugin_validate (BVIEW_SB_PLUGIN_t sbPlugin)
 *                                  Lock acquistion fails 
 *
 * @retval   BVIEW_STATUS_TABLE_FULL  Number of plug-ins already registered 
-*                                    are BVIEW_MAX_SUPPORTED_SB_PLUGINS.
+*                                    are BVIEW_MAX_SUPPORTED_SB_PLUGINS,
+*                                    or no dispatch table is free.
 *
 * @retval   BVIEW_STATUS_SUCCESS    Successfully registered sb plug-in with 
 *                                    sb redirector
@@ -346,6 +520,18 @@ BVIEW_STATUS sb_plugin_register (BVIEW_SB_PLUGIN_t sbPlugin)
   /* Acquire write lock */
   SB_REDIRECT_RWLOCK_WR_LOCK (sbRedirectRWLock);
 
+  /* Every registration publishes the next dispatch table, tables are
+     not reclaimed */
+  if (sbRedirectDispatchCount >= SB_REDIRECT_DISPATCH_POOL_SIZE)
+  {
+    SB_REDIRECT_DEBUG_PRINT (BVIEW_LOG_ERROR,
+                             "(%s:%d) No free SB redirect dispatch table\n",
+                             __FILE__, __LINE__);
+    /* Release write lock */
+    SB_REDIRECT_RWLOCK_UNLOCK (sbRedirectRWLock);
+    return BVIEW_STATUS_TABLE_FULL;
+  }
+
   /* Loop through the south bound plug-in list to find out free entry */
   for (sbPluginIndex = 0; (sbPluginIndex < BVIEW_MAX_SUPPORTED_SB_PLUGINS);
        sbPluginIndex++)
@@ -368,6 +554,11 @@ BVIEW_STATUS sb_plugin_register (BVIEW_SB_PLUGIN_t sbPlugin)
                              __FILE__, __LINE__);
     rv = BVIEW_STATUS_TABLE_FULL;
   }
+  else
+  {
+    /* Resolve the features of the units with the new plug-in */
+    sb_redirect_dispatch_publish ();
+  }
   /* Release write lock */
   SB_REDIRECT_RWLOCK_UNLOCK (sbRedirectRWLock);
   return rv;
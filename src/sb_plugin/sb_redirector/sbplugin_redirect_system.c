@@ -24,8 +24,7 @@
 *
 * @param[out]  unitNum            Numbers of units
 *
-* @retval   BVIEW_STATUS_FAILURE   When lock acquistion fails or
-*                                  System feature is not avaialable or
+* @retval   BVIEW_STATUS_FAILURE   System feature is not avaialable or
 *                                  The number of units is '0'
 *
 * @retval   BVIEW_STATUS_SUCCESS   Read number of units from system feature
@@ -39,15 +38,9 @@ BVIEW_STATUS sbapi_system_num_units_get (int *unitNum)
 {
   BVIEW_SB_SYSTEM_FEATURE_t *systemFeaturePtr = NULL;
   BVIEW_STATUS rv = BVIEW_STATUS_SUCCESS;
-  BVIEW_ASIC_TYPE asicType = BVIEW_ASIC_TYPE_ALL;
 
-  /* Acquire Read lock */
-  SB_REDIRECT_RWLOCK_RD_LOCK (sbRedirectRWLock);
-
-  /* Get system south bound plug-in based on Asic type */
-  systemFeaturePtr =
-    (BVIEW_SB_SYSTEM_FEATURE_t *) sb_redirect_feature_handle_get (asicType,
-                                                                  BVIEW_FEATURE_SYSTEM);
+  /* Get system south bound plug-in */
+  systemFeaturePtr = sb_redirect_system_feature_get ();
   /* Validate System feature pointer and the data in the system feature */ 
   if (systemFeaturePtr == NULL)
   {
@@ -63,8 +56,6 @@ BVIEW_STATUS sbapi_system_num_units_get (int *unitNum)
     *unitNum = systemFeaturePtr->numSupportedAsics;
     rv = BVIEW_STATUS_SUCCESS;
   }
-  /* Release Read lock */
-  SB_REDIRECT_RWLOCK_UNLOCK (sbRedirectRWLock);
   return rv;
 }
 
@@ -74,8 +65,7 @@ BVIEW_STATUS sbapi_system_num_units_get (int *unitNum)
 * @param[int]  asic        Unit number
 * @param[out]  asicType    Asic type of unit
 *
-* @retval   BVIEW_STATUS_FAILURE   When lock acquistion fails or
-*                                  System feature is not avaialable or
+* @retval   BVIEW_STATUS_FAILURE   System feature is not avaialable or
 *                                  The number of units is '0' or 
 *                                  unit entry is not found
 *
@@ -89,54 +79,17 @@ BVIEW_STATUS sbapi_system_num_units_get (int *unitNum)
 BVIEW_STATUS sbapi_system_unit_to_asic_type_get (int asic,
                                                  BVIEW_ASIC_TYPE * asicType)
 {
-  BVIEW_SB_SYSTEM_FEATURE_t *systemFeaturePtr = NULL;
-  BVIEW_STATUS rv = BVIEW_STATUS_SUCCESS;
-  BVIEW_ASIC_t *asicInfoPtr = NULL;
-  int asicListIndex = 0;
-
-  /* Acquire Read lock */
-  SB_REDIRECT_RWLOCK_RD_LOCK (sbRedirectRWLock);
-  /* Get system south bound plug-in based on Asic type */
-  systemFeaturePtr =
-    (BVIEW_SB_SYSTEM_FEATURE_t *)
-    sb_redirect_feature_handle_get (BVIEW_ASIC_TYPE_ALL, BVIEW_FEATURE_SYSTEM);
+  const BVIEW_SB_REDIRECT_UNIT_t *unitPtr = NULL;
 
-  /* Validate System feature pointer and the data in the system feature */ 
-  if (systemFeaturePtr == NULL)
-  {
-    rv = BVIEW_STATUS_FAILURE;
-  }
-  else if ((systemFeaturePtr->numSupportedAsics) == 0)
+  /* Get the unit entry resolved from the system plug-in */
+  unitPtr = sb_redirect_unit_get (asic);
+  if (unitPtr == NULL)
   {
-    rv = BVIEW_STATUS_FAILURE;
-  }
-  else
-  {
-    /* Loop through asic list in the system plug-in */
-    for (asicListIndex = 0; asicListIndex < systemFeaturePtr->numSupportedAsics;
-         asicListIndex++)
-    {
-      asicInfoPtr = systemFeaturePtr->asicList[asicListIndex];
-      if ((asicInfoPtr != NULL) && (asicInfoPtr->unit == asic))
-      {
-        /* Get asic type */
-        *asicType = asicInfoPtr->asicType;
-        break;
-      }
-    }
-    /* Failed to find the correct entry */
-    if (asicListIndex == systemFeaturePtr->numSupportedAsics)
-    {
-      rv = BVIEW_STATUS_FAILURE;
-    }
-    else
-    {
-      rv = BVIEW_STATUS_SUCCESS;
-    }
+    return BVIEW_STATUS_FAILURE;
   }
-  /* Release Read lock */
-  SB_REDIRECT_RWLOCK_UNLOCK (sbRedirectRWLock);
-  return rv;
+  /* Get asic type */
+  *asicType = unitPtr->asicType;
+  return BVIEW_STATUS_SUCCESS;
 }
 
 /*********************************************************************
@@ -145,8 +98,7 @@ BVIEW_STATUS sbapi_system_unit_to_asic_type_get (int asic,
 * @param[out]  buffer        System name
 * @param[in]   length        Buffer length
 *
-* @retval   BVIEW_STATUS_FAILURE      Due to lock acquistion failure or 
-*                                     System feature is not present or
+* @retval   BVIEW_STATUS_FAILURE      System feature is not present or
 *                                     System south bound function has returned failure
 *
 * @retval   BVIEW_STATUS_SUCCESS      System south bound function for name get is
@@ -162,14 +114,9 @@ BVIEW_STATUS sbapi_system_name_get (char *buffer, int length)
 {
   BVIEW_SB_SYSTEM_FEATURE_t *systemFeaturePtr = NULL;
   BVIEW_STATUS rv = BVIEW_STATUS_SUCCESS;
-  BVIEW_ASIC_TYPE asicType = BVIEW_ASIC_TYPE_ALL;
 
-  /* Acquire Read lock */
-  SB_REDIRECT_RWLOCK_RD_LOCK (sbRedirectRWLock);
   /* Get system south bound plug-in */
-  systemFeaturePtr =
-    (BVIEW_SB_SYSTEM_FEATURE_t *) sb_redirect_feature_handle_get (asicType,
-                                                                  BVIEW_FEATURE_SYSTEM);
+  systemFeaturePtr = sb_redirect_system_feature_get ();
   /* Validate system feature pointer and south bound handler.
    * Call south bound handler                               */
   if (systemFeaturePtr == NULL)
@@ -184,8 +131,6 @@ BVIEW_STATUS sbapi_system_name_get (char *buffer, int length)
   {                              
     rv = systemFeaturePtr->system_name_get_cb (buffer, length);
   }
-  /* Release read-lock */
-  SB_REDIRECT_RWLOCK_UNLOCK (sbRedirectRWLock);
   return rv;
 }
 
@@ -195,8 +140,7 @@ BVIEW_STATUS sbapi_system_name_get (char *buffer, int length)
 * @param[out]  buffer        System MAC address
 * @param[in]   length        Buffer length
 *
-* @retval   BVIEW_STATUS_FAILURE      Due to lock acquistion failure or 
-*                                     System feature is not present or
+* @retval   BVIEW_STATUS_FAILURE      System feature is not present or
 *                                     System south bound function has returned failure
 *
 * @retval   BVIEW_STATUS_SUCCESS      System south bound function for mac get is
@@ -213,14 +157,9 @@ BVIEW_STATUS sbapi_system_mac_get (uint8_t * buffer, int length)
 {
   BVIEW_SB_SYSTEM_FEATURE_t *systemFeaturePtr = NULL;
   BVIEW_STATUS rv = BVIEW_STATUS_SUCCESS;
-  BVIEW_ASIC_TYPE asicType = BVIEW_ASIC_TYPE_ALL;
 
-  /* Acquire Read lock */
-  SB_REDIRECT_RWLOCK_RD_LOCK (sbRedirectRWLock);
   /* Get system south bound plug-in */
-  systemFeaturePtr =
-    (BVIEW_SB_SYSTEM_FEATURE_t *) sb_redirect_feature_handle_get (asicType,
-                                                                  BVIEW_FEATURE_SYSTEM);
+  systemFeaturePtr = sb_redirect_system_feature_get ();
   /* Validate system feature pointer and south bound handler.
    * Call south bound handler                               */
   if (systemFeaturePtr == NULL)
@@ -235,8 +174,6 @@ BVIEW_STATUS sbapi_system_mac_get (uint8_t * buffer, int length)
   {                              
     rv = systemFeaturePtr->system_mac_get_cb (buffer, length);
   }
-  /* Release Read lock */
-  SB_REDIRECT_RWLOCK_UNLOCK (sbRedirectRWLock);
   return rv;
 }
 
@@ -246,8 +183,7 @@ BVIEW_STATUS sbapi_system_mac_get (uint8_t * buffer, int length)
 * @param[out]  buffer        IPv4 address
 * @param[in]   length        Buffer length
 *
-* @retval   BVIEW_STATUS_FAILURE      Due to lock acquistion failure or 
-*                                     System feature is not present or
+* @retval   BVIEW_STATUS_FAILURE      System feature is not present or
 *                                     System south bound function has returned failure
 *
 * @retval   BVIEW_STATUS_SUCCESS      System south bound function for ipv4 get is
@@ -264,14 +200,9 @@ BVIEW_STATUS sbapi_system_ip4_get (uint8_t * buffer, int length)
 {
   BVIEW_SB_SYSTEM_FEATURE_t *systemFeaturePtr = NULL;
   BVIEW_STATUS rv = BVIEW_STATUS_SUCCESS;
-  BVIEW_ASIC_TYPE asicType = BVIEW_ASIC_TYPE_ALL;
 
-  /* Acquire Read lock */
-  SB_REDIRECT_RWLOCK_RD_LOCK (sbRedirectRWLock);
   /* Get system south bound plug-in */
-  systemFeaturePtr =
-    (BVIEW_SB_SYSTEM_FEATURE_t *) sb_redirect_feature_handle_get (asicType,
-                                                                  BVIEW_FEATURE_SYSTEM);
+  systemFeaturePtr = sb_redirect_system_feature_get ();
   /* Validate system feature pointer and south bound handler.
    * Call south bound handler                               */
   if (systemFeaturePtr == NULL)
@@ -286,8 +217,6 @@ BVIEW_STATUS sbapi_system_ip4_get (uint8_t * buffer, int length)
   {                              
     rv = systemFeaturePtr->system_ip4_get_cb (buffer, length);
   }
-  /* Release Read lock */
-  SB_REDIRECT_RWLOCK_UNLOCK (sbRedirectRWLock);
   return rv;
 }
 
@@ -298,8 +227,7 @@ BVIEW_STATUS sbapi_system_ip4_get (uint8_t * buffer, int length)
 * @param[in]   src           Asic number in notational(string) form
 * @param[out]  asic        System asic number 
 *
-* @retval   BVIEW_STATUS_FAILURE      Due to lock acquistion failure or 
-*                                     System feature is not present or
+* @retval   BVIEW_STATUS_FAILURE      System feature is not present or
 *                                     System south bound function has returned failure
 *
 * @retval   BVIEW_STATUS_SUCCESS      System south bound function for name get is
@@ -315,14 +243,9 @@ BVIEW_STATUS sbapi_system_asic_translate_from_notation(char *src, int *asic)
 {
   BVIEW_SB_SYSTEM_FEATURE_t *systemFeaturePtr = NULL;
   BVIEW_STATUS rv = BVIEW_STATUS_SUCCESS;
-  BVIEW_ASIC_TYPE asicType = BVIEW_ASIC_TYPE_ALL;
 
-  /* Acquire Read lock */
-  SB_REDIRECT_RWLOCK_RD_LOCK (sbRedirectRWLock);
   /* Get system south bound plug-in */
-  systemFeaturePtr =
-    (BVIEW_SB_SYSTEM_FEATURE_t *) sb_redirect_feature_handle_get (asicType,
-                                                                  BVIEW_FEATURE_SYSTEM);
+  systemFeaturePtr = sb_redirect_system_feature_get ();
   /* Validate system feature pointer and south bound handler.
    * Call south bound handler                               */
   if (systemFeaturePtr == NULL)
@@ -346,8 +269,6 @@ BVIEW_STATUS sbapi_system_asic_translate_from_notation(char *src, int *asic)
                     " src=%s, asic = %d, rv = %d\n",
                      __FILE__, __LINE__,src, *asic, rv);
   }
-  /* Release read-lock */
-  SB_REDIRECT_RWLOCK_UNLOCK (sbRedirectRWLock);
   return rv;
 }
 
@@ -358,8 +279,7 @@ BVIEW_STATUS sbapi_system_asic_translate_from_notation(char *src, int *asic)
 * @param[in]  asic        System asic number 
 * @param[out] dst         Asic number in notational(string) form
 *
-* @retval   BVIEW_STATUS_FAILURE      Due to lock acquistion failure or 
-*                                     System feature is not present or
+* @retval   BVIEW_STATUS_FAILURE      System feature is not present or
 *                                     System south bound function has returned failure
 *
 * @retval   BVIEW_STATUS_SUCCESS      System south bound function for name get is
@@ -375,14 +295,9 @@ BVIEW_STATUS sbapi_system_asic_translate_to_notation(int asic, char *dst)
 {
   BVIEW_SB_SYSTEM_FEATURE_t *systemFeaturePtr = NULL;
   BVIEW_STATUS rv = BVIEW_STATUS_SUCCESS;
-  BVIEW_ASIC_TYPE asicType = BVIEW_ASIC_TYPE_ALL;
 
-  /* Acquire Read lock */
-  SB_REDIRECT_RWLOCK_RD_LOCK (sbRedirectRWLock);
   /* Get system south bound plug-in */
-  systemFeaturePtr =
-    (BVIEW_SB_SYSTEM_FEATURE_t *) sb_redirect_feature_handle_get (asicType,
-                                                                  BVIEW_FEATURE_SYSTEM);
+  systemFeaturePtr = sb_redirect_system_feature_get ();
   /* Validate system feature pointer and south bound handler.
    * Call south bound handler                               */
   if (systemFeaturePtr == NULL)
@@ -407,8 +322,6 @@ BVIEW_STATUS sbapi_system_asic_translate_to_notation(int asic, char *dst)
                     " asic = %d, dst = %s, rv = %d\n",
                      __FILE__, __LINE__,asic, dst, rv);
   }
-  /* Release read-lock */
-  SB_REDIRECT_RWLOCK_UNLOCK (sbRedirectRWLock);
   return rv;
 }
 
@@ -419,8 +332,7 @@ BVIEW_STATUS sbapi_system_asic_translate_to_notation(int asic, char *dst)
 * @param[in]   src         Port number in notational(string) form
 * @param[out]  port        System port number 
 *
-* @retval   BVIEW_STATUS_FAILURE      Due to lock acquistion failure or 
-*                                     System feature is not present or
+* @retval   BVIEW_STATUS_FAILURE      System feature is not present or
 *                                     System south bound function has returned failure
 *
 * @retval   BVIEW_STATUS_SUCCESS      System south bound function for name get is
@@ -436,14 +348,9 @@ BVIEW_STATUS sbapi_system_port_translate_from_notation(char *src, int *port)
 {
   BVIEW_SB_SYSTEM_FEATURE_t *systemFeaturePtr = NULL;
   BVIEW_STATUS rv = BVIEW_STATUS_SUCCESS;
-  BVIEW_ASIC_TYPE asicType = BVIEW_ASIC_TYPE_ALL;
 
-  /* Acquire Read lock */
-  SB_REDIRECT_RWLOCK_RD_LOCK (sbRedirectRWLock);
   /* Get system south bound plug-in */
-  systemFeaturePtr =
-    (BVIEW_SB_SYSTEM_FEATURE_t *) sb_redirect_feature_handle_get (asicType,
-                                                                  BVIEW_FEATURE_SYSTEM);
+  systemFeaturePtr = sb_redirect_system_feature_get ();
   /* Validate system feature pointer and south bound handler.
    * Call south bound handler                               */
   if (systemFeaturePtr == NULL)
@@ -467,8 +374,6 @@ BVIEW_STATUS sbapi_system_port_translate_from_notation(char *src, int *port)
                     " src=%s, port = %d, rv = %d\n",
                      __FILE__, __LINE__,src, *port, rv);
   }
-  /* Release read-lock */
-  SB_REDIRECT_RWLOCK_UNLOCK (sbRedirectRWLock);
   return rv;
 }
 
@@ -480,8 +385,7 @@ BVIEW_STATUS sbapi_system_port_translate_from_notation(char *src, int *port)
 * @param[in]  port        System port number 
 * @param[out] dst         Port number in notational(string) form
 *
-* @retval   BVIEW_STATUS_FAILURE      Due to lock acquistion failure or 
-*                                     System feature is not present or
+* @retval   BVIEW_STATUS_FAILURE      System feature is not present or
 *                                     System south bound function has returned failure
 *
 * @retval   BVIEW_STATUS_SUCCESS      System south bound function for name get is
@@ -497,14 +401,9 @@ BVIEW_STATUS sbapi_system_port_translate_to_notation(int asic, int port, char *d
 {
   BVIEW_SB_SYSTEM_FEATURE_t *systemFeaturePtr = NULL;
   BVIEW_STATUS rv = BVIEW_STATUS_SUCCESS;
-  BVIEW_ASIC_TYPE asicType = BVIEW_ASIC_TYPE_ALL;
 
-  /* Acquire Read lock */
-  SB_REDIRECT_RWLOCK_RD_LOCK (sbRedirectRWLock);
   /* Get system south bound plug-in */
-  systemFeaturePtr =
-    (BVIEW_SB_SYSTEM_FEATURE_t *) sb_redirect_feature_handle_get (asicType,
-                                                                  BVIEW_FEATURE_SYSTEM);
+  systemFeaturePtr = sb_redirect_system_feature_get ();
   /* Validate system feature pointer and south bound handler.
    * Call south bound handler                               */
   if (systemFeaturePtr == NULL)
@@ -529,18 +428,56 @@ BVIEW_STATUS sbapi_system_port_translate_to_notation(int asic, int port, char *d
                     " asic = %d, port = %d, dst = %s, rv = %d\n",
                      __FILE__, __LINE__,asic, port, dst, rv);
   }
-  /* Release read-lock */
-  SB_REDIRECT_RWLOCK_UNLOCK (sbRedirectRWLock);
   return rv;
 }
+
+/*********************************************************************
+* @brief       Get the cached notational representation(string) of a
+*                port and its length
+*
+* @param[in]  asic        System asic number 
+* @param[in]  port        System port number 
+* @param[out] notation    Port number in notational(string) form
+* @param[out] length      Length of the string
+*
+* @retval   BVIEW_STATUS_FAILURE      System feature is not present or
+*                                     port is not in the port map
+*
+* @retval   BVIEW_STATUS_SUCCESS      Port string is found
+*
+* @retval   BVIEW_STATUS_UNSUPPORTED  Port notation get functionality is 
+*                                     not supported on this unit
+*
+* @notes    The string is owned by the south bound plug-in, it must not
+*           be modified.
+*
+*********************************************************************/
+BVIEW_STATUS sbapi_system_port_notation_get(int asic, int port,
+                                            const char **notation, int *length)
+{
+  BVIEW_SB_SYSTEM_FEATURE_t *systemFeaturePtr = NULL;
+
+  /* Get system south bound plug-in */
+  systemFeaturePtr = sb_redirect_system_feature_get ();
+  /* Validate system feature pointer and south bound handler.
+   * Call south bound handler                               */
+  if (systemFeaturePtr == NULL)
+  {
+    return BVIEW_STATUS_FAILURE;
+  }                              
+  if ((systemFeaturePtr->system_port_notation_get_cb) == NULL)
+  {
+    return BVIEW_STATUS_UNSUPPORTED;
+  }
+  return systemFeaturePtr->system_port_notation_get_cb (asic, port, notation, length);
+}
 /*********************************************************************
 * @brief       Get asic capabilites of a unit
 *
 * @param[in]   asic          Unit number
 * @param[out]  asicCapPtr    Pointer to asic capabilities  
 *
-* @retval   BVIEW_STATUS_FAILURE      Due to lock acquistion failure or 
-*                                     Failed to get asic type from unit or
+* @retval   BVIEW_STATUS_FAILURE      Failed to get asic type from unit or
 *                                     Failed to get asic capabilites for this unit
 *
 * @retval   BVIEW_STATUS_SUCCESS      Found asic capabilities
@@ -551,24 +488,21 @@ BVIEW_STATUS sbapi_system_port_translate_to_notation(int asic, int port, char *d
 BVIEW_STATUS sbapi_system_asic_capabilities_get (int asic, 
                                           BVIEW_ASIC_CAPABILITIES_t *asicCapPtr)
 {
-  BVIEW_ASIC_TYPE asicType;
+  const BVIEW_SB_REDIRECT_UNIT_t *unitPtr = NULL;
   BVIEW_ASIC_CAPABILITIES_t *asicCapPtrLocal = NULL;
   BVIEW_STATUS rv;
 
-  /* Get asic type of the unit */
-  if (sbapi_system_unit_to_asic_type_get (asic, &asicType) !=
-      BVIEW_STATUS_SUCCESS)
+  /* Get asic capabilities resolved for the unit */
+  unitPtr = sb_redirect_unit_get (asic);
+  if (unitPtr == NULL)
   {
     SB_REDIRECT_DEBUG_PRINT (BVIEW_LOG_ERROR,
                              "(%s:%d) Failed to get asic type for unit %d \n",
                              __FILE__, __LINE__, asic);
     return BVIEW_STATUS_FAILURE;
   }
-  /* Acquire Read lock */
-  SB_REDIRECT_RWLOCK_RD_LOCK (sbRedirectRWLock);
-  /* Get asic capabilities based on asic type */
-  if (sb_redirect_asic_capabilities_get (asicType, &asicCapPtrLocal) !=
-      BVIEW_STATUS_SUCCESS)
+  asicCapPtrLocal = unitPtr->asicCap;
+  if (asicCapPtrLocal == NULL)
   {
     SB_REDIRECT_DEBUG_PRINT (BVIEW_LOG_ERROR,
                              "(%s:%d) Failed to get asic capabilities for unit %d \n",
@@ -583,8 +517,6 @@ BVIEW_STATUS sbapi_system_asic_capabilities_get (int asic,
     *asicCapPtr = *asicCapPtrLocal;
     rv = BVIEW_STATUS_SUCCESS;
   }
-  /* Release Read lock */
-  SB_REDIRECT_RWLOCK_UNLOCK (sbRedirectRWLock);
   return rv;
 }
 
@@ -594,8 +526,7 @@ BVIEW_STATUS sbapi_system_asic_capabilities_get (int asic,
 * @param[in]   asic          Unit number
 * @param[out]  numPorts      Number of ports
 *
-* @retval   BVIEW_STATUS_FAILURE      Due to lock acquistion failure or 
-*                                     Failed to get asic type from unit or
+* @retval   BVIEW_STATUS_FAILURE      Failed to get asic type from unit or
 *                                     Failed to get asic capabilites for this unit
 *
 * @retval   BVIEW_STATUS_SUCCESS      Get number of ports is successful
@@ -605,24 +536,21 @@ BVIEW_STATUS sbapi_system_asic_capabilities_get (int asic,
 *********************************************************************/
 BVIEW_STATUS sbapi_system_asic_num_ports_get (int asic, int *numPorts)
 {
-  BVIEW_ASIC_TYPE asicType;
+  const BVIEW_SB_REDIRECT_UNIT_t *unitPtr = NULL;
   BVIEW_ASIC_CAPABILITIES_t *asicCapPtr = NULL;
   BVIEW_STATUS rv = BVIEW_STATUS_SUCCESS;
 
-  /* Get asic type of the unit */
-  if (sbapi_system_unit_to_asic_type_get (asic, &asicType) !=
-      BVIEW_STATUS_SUCCESS)
+  /* Get asic capabilities resolved for the unit */
+  unitPtr = sb_redirect_unit_get (asic);
+  if (unitPtr == NULL)
   {
     SB_REDIRECT_DEBUG_PRINT (BVIEW_LOG_ERROR,
                              "(%s:%d) Failed to get asic type for unit %d \n",
                              __FILE__, __LINE__, asic);
     return BVIEW_STATUS_FAILURE;
   }
-  /* Acquire Read lock */
-  SB_REDIRECT_RWLOCK_RD_LOCK (sbRedirectRWLock);
-  /* Get asic capabilities based on asic type */
-  if (sb_redirect_asic_capabilities_get (asicType, &asicCapPtr) !=
-      BVIEW_STATUS_SUCCESS)
+  asicCapPtr = unitPtr->asicCap;
+  if (asicCapPtr == NULL)
   {
     SB_REDIRECT_DEBUG_PRINT (BVIEW_LOG_ERROR,
                              "(%s:%d) Failed to get asic capabilities for unit %d \n",
@@ -635,8 +563,6 @@ BVIEW_STATUS sbapi_system_asic_num_ports_get (int asic, int *numPorts)
     *numPorts = asicCapPtr->numPorts;
     rv = BVIEW_STATUS_SUCCESS;
   }
-  /* Release Read lock */
-  SB_REDIRECT_RWLOCK_UNLOCK (sbRedirectRWLock);
   return rv;
 }
 
@@ -646,8 +572,7 @@ BVIEW_STATUS sbapi_system_asic_num_ports_get (int asic, int *numPorts)
 * @param[in]   asic                  Unit number
 * @param[out]  numUnicastQueues      Number of Unicast queues
 *
-* @retval   BVIEW_STATUS_FAILURE      Due to lock acquistion failure or 
-*                                     Failed to get asic type from unit or
+* @retval   BVIEW_STATUS_FAILURE      Failed to get asic type from unit or
 *                                     Failed to get asic capabilites for this unit
 *
 * @retval   BVIEW_STATUS_SUCCESS      Get number of unicast queues is successful
@@ -658,24 +583,21 @@ BVIEW_STATUS sbapi_system_asic_num_ports_get (int asic, int *numPorts)
 *********************************************************************/
 BVIEW_STATUS sbapi_system_asic_num_ucq_get (int asic, int *numUnicastQueues)
 {
-  BVIEW_ASIC_TYPE asicType;
+  const BVIEW_SB_REDIRECT_UNIT_t *unitPtr = NULL;
   BVIEW_ASIC_CAPABILITIES_t *asicCapPtr = NULL;
   BVIEW_STATUS rv;
 
-  /* Get asic type of the unit */
-  if (sbapi_system_unit_to_asic_type_get (asic, &asicType) !=
-      BVIEW_STATUS_SUCCESS)
+  /* Get asic capabilities resolved for the unit */
+  unitPtr = sb_redirect_unit_get (asic);
+  if (unitPtr == NULL)
   {
     SB_REDIRECT_DEBUG_PRINT (BVIEW_LOG_ERROR,
                              "(%s:%d) Failed to get asic type for unit %d \n",
                              __FILE__, __LINE__, asic);
     return BVIEW_STATUS_FAILURE;
   }
-  /* Acquire Read lock */
-  SB_REDIRECT_RWLOCK_RD_LOCK (sbRedirectRWLock);
-  /* Get asic capabilities based on asic type */
-  if (sb_redirect_asic_capabilities_get (asicType, &asicCapPtr) !=
-      BVIEW_STATUS_SUCCESS)
+  asicCapPtr = unitPtr->asicCap;
+  if (asicCapPtr == NULL)
   {
     SB_REDIRECT_DEBUG_PRINT (BVIEW_LOG_ERROR,
                              "(%s:%d) Failed to get asic capabilities for unit %d \n",
@@ -688,8 +610,6 @@ BVIEW_STATUS sbapi_system_asic_num_ucq_get (int asic, int *numUnicastQueues)
     *numUnicastQueues = asicCapPtr->numUnicastQueues;
     rv = BVIEW_STATUS_SUCCESS;
   }
-  /* Release Read lock */
-  SB_REDIRECT_RWLOCK_UNLOCK (sbRedirectRWLock);
   return rv;
 }
 
@@ -699,8 +619,7 @@ BVIEW_STATUS sbapi_system_asic_num_ucq_get (int asic, int *numUnicastQueues)
 * @param[in]   asic                    Unit number
 * @param[out]  numUnicastQueueGroups   Number of Unicast queue groups
 *
-* @retval   BVIEW_STATUS_FAILURE      Due to lock acquistion failure or 
-*                                     Failed to get asic type from unit or
+* @retval   BVIEW_STATUS_FAILURE      Failed to get asic type from unit or
 *                                     Failed to get asic capabilites for this unit
 *
 * @retval   BVIEW_STATUS_SUCCESS      Get number of unicast queue groups 
@@ -713,24 +632,21 @@ BVIEW_STATUS sbapi_system_asic_num_ucq_get (int asic, int *numUnicastQueues)
 BVIEW_STATUS sbapi_system_asic_num_ucqg_get (int asic,
                                              int *numUnicastQueueGroups)
 {
-  BVIEW_ASIC_TYPE asicType;
+  const BVIEW_SB_REDIRECT_UNIT_t *unitPtr = NULL;
   BVIEW_ASIC_CAPABILITIES_t *asicCapPtr = NULL;
   BVIEW_STATUS rv;
 
-  /* Get asic type of the unit */
-  if (sbapi_system_unit_to_asic_type_get (asic, &asicType) !=
-      BVIEW_STATUS_SUCCESS)
+  /* Get asic capabilities resolved for the unit */
+  unitPtr = sb_redirect_unit_get (asic);
+  if (unitPtr == NULL)
   {
     SB_REDIRECT_DEBUG_PRINT (BVIEW_LOG_ERROR,
                              "(%s:%d) Failed to get asic type for unit %d \n",
                              __FILE__, __LINE__, asic);
     return BVIEW_STATUS_FAILURE;
   }
-  /* Acquire Read lock */
-  SB_REDIRECT_RWLOCK_RD_LOCK (sbRedirectRWLock);
-  /* Get asic capabilities based on asic type */
-  if (sb_redirect_asic_capabilities_get (asicType, &asicCapPtr) !=
-      BVIEW_STATUS_SUCCESS)
+  asicCapPtr = unitPtr->asicCap;
+  if (asicCapPtr == NULL)
   {
     SB_REDIRECT_DEBUG_PRINT (BVIEW_LOG_ERROR,
                              "(%s:%d) Failed to get asic capabilities for unit %d \n",
@@ -743,8 +659,6 @@ BVIEW_STATUS sbapi_system_asic_num_ucqg_get (int asic,
     *numUnicastQueueGroups = asicCapPtr->numUnicastQueueGroups;
     rv = BVIEW_STATUS_SUCCESS;
   }
-  /* Release Read lock */
-  SB_REDIRECT_RWLOCK_UNLOCK (sbRedirectRWLock);
   return rv;
 }
 
@@ -754,8 +668,7 @@ BVIEW_STATUS sbapi_system_asic_num_ucqg_get (int asic,
 * @param[in]   asic                    Unit number
 * @param[out]  numMulticastQueueGroups   Number of Multicast queues
 *
-* @retval   BVIEW_STATUS_FAILURE      Due to lock acquistion failure or 
-*                                     Failed to get asic type from unit or
+* @retval   BVIEW_STATUS_FAILURE      Failed to get asic type from unit or
 *                                     Failed to get asic capabilites for this unit
 *
 * @retval   BVIEW_STATUS_SUCCESS      Get number of multicast queues 
@@ -767,24 +680,21 @@ BVIEW_STATUS sbapi_system_asic_num_ucqg_get (int asic,
 *********************************************************************/
 BVIEW_STATUS sbapi_system_asic_num_mcq_get (int asic, int *numMulticastQueues)
 {
-  BVIEW_ASIC_TYPE asicType;
+  const BVIEW_SB_REDIRECT_UNIT_t *unitPtr = NULL;
   BVIEW_ASIC_CAPABILITIES_t *asicCapPtr = NULL;
   BVIEW_STATUS rv;
 
-  /* Get asic type of the unit */
-  if (sbapi_system_unit_to_asic_type_get (asic, &asicType) !=
-      BVIEW_STATUS_SUCCESS)
+  /* Get asic capabilities resolved for the unit */
+  unitPtr = sb_redirect_unit_get (asic);
+  if (unitPtr == NULL)
   {
     SB_REDIRECT_DEBUG_PRINT (BVIEW_LOG_ERROR,
                              "(%s:%d) Failed to get asic type for unit %d \n",
                              __FILE__, __LINE__, asic);
     return BVIEW_STATUS_FAILURE;
   }
-  /* Acquire Read lock */
-  SB_REDIRECT_RWLOCK_RD_LOCK (sbRedirectRWLock);
-  /* Get asic capabilities based on asic type */
-  if (sb_redirect_asic_capabilities_get (asicType, &asicCapPtr) !=
-      BVIEW_STATUS_SUCCESS)
+  asicCapPtr = unitPtr->asicCap;
+  if (asicCapPtr == NULL)
   {
     SB_REDIRECT_DEBUG_PRINT (BVIEW_LOG_ERROR,
                              "(%s:%d) Failed to get asic capabilities for unit %d \n",
@@ -797,8 +707,6 @@ BVIEW_STATUS sbapi_system_asic_num_mcq_get (int asic, int *numMulticastQueues)
     *numMulticastQueues = asicCapPtr->numMulticastQueues;
     rv = BVIEW_STATUS_SUCCESS;
   }
-  /* Release Read lock */
-  SB_REDIRECT_RWLOCK_UNLOCK (sbRedirectRWLock);
   return rv;
 }
 
@@ -808,8 +716,7 @@ BVIEW_STATUS sbapi_system_asic_num_mcq_get (int asic, int *numMulticastQueues)
 * @param[in]   asic                    Unit number
 * @param[out]  numServicePools         Number of Service pools
 *
-* @retval   BVIEW_STATUS_FAILURE      Due to lock acquistion failure or 
-*                                     Failed to get asic type from unit or
+* @retval   BVIEW_STATUS_FAILURE      Failed to get asic type from unit or
 *                                     Failed to get asic capabilites for this unit
 *
 * @retval   BVIEW_STATUS_SUCCESS      Get number of service pools 
@@ -821,25 +728,21 @@ BVIEW_STATUS sbapi_system_asic_num_mcq_get (int asic, int *numMulticastQueues)
 *********************************************************************/
 BVIEW_STATUS sbapi_system_asic_num_sp_get (int asic, int *numServicePools)
 {
-  BVIEW_ASIC_TYPE asicType;
+  const BVIEW_SB_REDIRECT_UNIT_t *unitPtr = NULL;
   BVIEW_ASIC_CAPABILITIES_t *asicCapPtr = NULL;
   BVIEW_STATUS rv;
 
-  /* Get asic type of the unit */
-  if (sbapi_system_unit_to_asic_type_get (asic, &asicType) !=
-      BVIEW_STATUS_SUCCESS)
+  /* Get asic capabilities resolved for the unit */
+  unitPtr = sb_redirect_unit_get (asic);
+  if (unitPtr == NULL)
   {
     SB_REDIRECT_DEBUG_PRINT (BVIEW_LOG_ERROR,
                              "(%s:%d) Failed to get asic type for unit %d \n",
                              __FILE__, __LINE__, asic);
     return BVIEW_STATUS_FAILURE;
   }
-
-  /* Acquire Read lock */
-  SB_REDIRECT_RWLOCK_RD_LOCK (sbRedirectRWLock);
-  /* Get asic capabilities based on asic type */
-  if (sb_redirect_asic_capabilities_get (asicType, &asicCapPtr) !=
-      BVIEW_STATUS_SUCCESS)
+  asicCapPtr = unitPtr->asicCap;
+  if (asicCapPtr == NULL)
   {
     SB_REDIRECT_DEBUG_PRINT (BVIEW_LOG_ERROR,
                              "(%s:%d) Failed to get asic capabilities for unit %d \n",
@@ -852,8 +755,6 @@ BVIEW_STATUS sbapi_system_asic_num_sp_get (int asic, int *numServicePools)
     *numServicePools = asicCapPtr->numServicePools;
     rv = BVIEW_STATUS_SUCCESS;
   }
-  /* Release Read lock */
-  SB_REDIRECT_RWLOCK_UNLOCK (sbRedirectRWLock);
   return rv;
 }
 
@@ -863,8 +764,7 @@ BVIEW_STATUS sbapi_system_asic_num_sp_get (int asic, int *numServicePools)
 * @param[in]   asic                  Unit number
 * @param[out]  numCommonPools        Number of common pools
 *
-* @retval   BVIEW_STATUS_FAILURE      Due to lock acquistion failure or 
-*                                     Failed to get asic type from unit or
+* @retval   BVIEW_STATUS_FAILURE      Failed to get asic type from unit or
 *                                     Failed to get asic capabilites for this unit
 *
 * @retval   BVIEW_STATUS_SUCCESS      Get number of common pools 
@@ -876,24 +776,21 @@ BVIEW_STATUS sbapi_system_asic_num_sp_get (int asic, int *numServicePools)
 *********************************************************************/
 BVIEW_STATUS sbapi_system_asic_num_cp_get (int asic, int *numCommonPools)
 {
-  BVIEW_ASIC_TYPE asicType;
+  const BVIEW_SB_REDIRECT_UNIT_t *unitPtr = NULL;
   BVIEW_ASIC_CAPABILITIES_t *asicCapPtr = NULL;
   BVIEW_STATUS rv;
 
-  /* Get asic type of the unit */
-  if (sbapi_system_unit_to_asic_type_get (asic, &asicType) !=
-      BVIEW_STATUS_SUCCESS)
+  /* Get asic capabilities resolved for the unit */
+  unitPtr = sb_redirect_unit_get (asic);
+  if (unitPtr == NULL)
   {
     SB_REDIRECT_DEBUG_PRINT (BVIEW_LOG_ERROR,
                              "(%s:%d) Failed to get asic type for unit %d \n",
                              __FILE__, __LINE__, asic);
     return BVIEW_STATUS_FAILURE;
   }
-  /* Acquire Read lock */
-  SB_REDIRECT_RWLOCK_RD_LOCK (sbRedirectRWLock);
-  /* Get asic capabilities based on asic type */
-  if (sb_redirect_asic_capabilities_get (asicType, &asicCapPtr) !=
-      BVIEW_STATUS_SUCCESS)
+  asicCapPtr = unitPtr->asicCap;
+  if (asicCapPtr == NULL)
   {
     SB_REDIRECT_DEBUG_PRINT (BVIEW_LOG_ERROR,
                              "(%s:%d) Failed to get asic capabilities for unit %d \n",
@@ -906,8 +803,6 @@ BVIEW_STATUS sbapi_system_asic_num_cp_get (int asic, int *numCommonPools)
     *numCommonPools = asicCapPtr->numCommonPools;
     rv = BVIEW_STATUS_SUCCESS;
   }
-  /* Release Read lock */
-  SB_REDIRECT_RWLOCK_UNLOCK (sbRedirectRWLock);
   return rv;
 }
 
@@ -917,8 +812,7 @@ BVIEW_STATUS sbapi_system_asic_num_cp_get (int asic, int *numCommonPools)
 * @param[in]   asic                Unit number
 * @param[out]  numCpuQueues        Number of cpu queues
 *
-* @retval   BVIEW_STATUS_FAILURE      Due to lock acquistion failure or 
-*                                     Failed to get asic type from unit or
+* @retval   BVIEW_STATUS_FAILURE      Failed to get asic type from unit or
 *                                     Failed to get asic capabilites for this unit
 *
 * @retval   BVIEW_STATUS_SUCCESS      Get number of cpu queues 
@@ -930,24 +824,21 @@ BVIEW_STATUS sbapi_system_asic_num_cp_get (int asic, int *numCommonPools)
 *********************************************************************/
 BVIEW_STATUS sbapi_system_asic_num_cpuq_get (int asic, int *numCpuQueues)
 {
-  BVIEW_ASIC_TYPE asicType;
+  const BVIEW_SB_REDIRECT_UNIT_t *unitPtr = NULL;
   BVIEW_ASIC_CAPABILITIES_t *asicCapPtr = NULL;
   BVIEW_STATUS rv;
 
-  /* Get asic type of the unit */
-  if (sbapi_system_unit_to_asic_type_get (asic, &asicType) !=
-      BVIEW_STATUS_SUCCESS)
+  /* Get asic capabilities resolved for the unit */
+  unitPtr = sb_redirect_unit_get (asic);
+  if (unitPtr == NULL)
   {
     SB_REDIRECT_DEBUG_PRINT (BVIEW_LOG_ERROR,
                              "(%s:%d) Failed to get asic type for unit %d \n",
                              __FILE__, __LINE__, asic);
     return BVIEW_STATUS_FAILURE;
   }
-  /* Acquire Read lock */
-  SB_REDIRECT_RWLOCK_RD_LOCK (sbRedirectRWLock);
-  /* Get asic capabilities based on asic type */
-  if (sb_redirect_asic_capabilities_get (asicType, &asicCapPtr) !=
-      BVIEW_STATUS_SUCCESS)
+  asicCapPtr = unitPtr->asicCap;
+  if (asicCapPtr == NULL)
   {
     SB_REDIRECT_DEBUG_PRINT (BVIEW_LOG_ERROR,
                              "(%s:%d) Failed to get asic capabilities for unit %d \n",
@@ -960,8 +851,6 @@ BVIEW_STATUS sbapi_system_asic_num_cpuq_get (int asic, int *numCpuQueues)
     *numCpuQueues = asicCapPtr->numCpuQueues;
     rv = BVIEW_STATUS_SUCCESS;
   }
-  /* Release Read lock */
-  SB_REDIRECT_RWLOCK_UNLOCK (sbRedirectRWLock);
   return rv;
 }
 
@@ -971,8 +860,7 @@ BVIEW_STATUS sbapi_system_asic_num_cpuq_get (int asic, int *numCpuQueues)
 * @param[in]   asic                Unit number
 * @param[out]  numRqeQueues        Number of RQE queues
 *
-* @retval   BVIEW_STATUS_FAILURE      Due to lock acquistion failure or 
-*                                     Failed to get asic type from unit or
+* @retval   BVIEW_STATUS_FAILURE      Failed to get asic type from unit or
 *                                     Failed to get asic capabilites for this unit
 *
 * @retval   BVIEW_STATUS_SUCCESS      Get number of RQE queues 
@@ -983,24 +871,21 @@ BVIEW_STATUS sbapi_system_asic_num_cpuq_get (int asic, int *numCpuQueues)
 *********************************************************************/
 BVIEW_STATUS sbapi_system_asic_num_rqeq_get (int asic, int *numRqeQueues)
 {
-  BVIEW_ASIC_TYPE asicType;
+  const BVIEW_SB_REDIRECT_UNIT_t *unitPtr = NULL;
   BVIEW_ASIC_CAPABILITIES_t *asicCapPtr = NULL;
   BVIEW_STATUS rv;
 
-  /* Get asic type of the unit */
-  if (sbapi_system_unit_to_asic_type_get (asic, &asicType) !=
-      BVIEW_STATUS_SUCCESS)
+  /* Get asic capabilities resolved for the unit */
+  unitPtr = sb_redirect_unit_get (asic);
+  if (unitPtr == NULL)
   {
     SB_REDIRECT_DEBUG_PRINT (BVIEW_LOG_ERROR,
                              "(%s:%d) Failed to get asic type for unit %d \n",
                              __FILE__, __LINE__, asic);
     return BVIEW_STATUS_FAILURE;
   }
-  /* Acquire Read lock */
-  SB_REDIRECT_RWLOCK_RD_LOCK (sbRedirectRWLock);
-  /* Get asic capabilities based on asic type */
-  if (sb_redirect_asic_capabilities_get (asicType, &asicCapPtr) !=
-      BVIEW_STATUS_SUCCESS)
+  asicCapPtr = unitPtr->asicCap;
+  if (asicCapPtr == NULL)
   {
     SB_REDIRECT_DEBUG_PRINT (BVIEW_LOG_ERROR,
                              "(%s:%d) Failed to get asic capabilities for unit %d \n",
@@ -1013,8 +898,6 @@ BVIEW_STATUS sbapi_system_asic_num_rqeq_get (int asic, int *numRqeQueues)
     *numRqeQueues = asicCapPtr->numRqeQueues;
     rv = BVIEW_STATUS_SUCCESS;
   }
-  /* Release Read lock */
-  SB_REDIRECT_RWLOCK_UNLOCK (sbRedirectRWLock);
   return rv;
 }
 
@@ -1024,8 +907,7 @@ BVIEW_STATUS sbapi_system_asic_num_rqeq_get (int asic, int *numRqeQueues)
 * @param[in]   asic                Unit number
 * @param[out]  numRqeQueuePools    Number of RQE queue pools
 *
-* @retval   BVIEW_STATUS_FAILURE      Due to lock acquistion failure or 
-*                                     Failed to get asic type from unit or
+* @retval   BVIEW_STATUS_FAILURE      Failed to get asic type from unit or
 *                                     Failed to get asic capabilites for this unit
 *
 * @retval   BVIEW_STATUS_SUCCESS      Get number of RQE queue pools
@@ -1037,24 +919,21 @@ BVIEW_STATUS sbapi_system_asic_num_rqeq_get (int asic, int *numRqeQueues)
 *********************************************************************/
 BVIEW_STATUS sbapi_system_asic_num_rqeqp_get (int asic, int *numRqeQueuePools)
 {
-  BVIEW_ASIC_TYPE asicType;
+  const BVIEW_SB_REDIRECT_UNIT_t *unitPtr = NULL;
   BVIEW_ASIC_CAPABILITIES_t *asicCapPtr = NULL;
   BVIEW_STATUS rv;
 
-  /* Get asic type of the unit */
-  if (sbapi_system_unit_to_asic_type_get (asic, &asicType) !=
-      BVIEW_STATUS_SUCCESS)
+  /* Get asic capabilities resolved for the unit */
+  unitPtr = sb_redirect_unit_get (asic);
+  if (unitPtr == NULL)
   {
     SB_REDIRECT_DEBUG_PRINT (BVIEW_LOG_ERROR,
                              "(%s:%d) Failed to get asic type for unit %d \n",
                              __FILE__, __LINE__, asic);
     return BVIEW_STATUS_FAILURE;
   }
-  /* Acquire Read lock */
-  SB_REDIRECT_RWLOCK_RD_LOCK (sbRedirectRWLock);
-  /* Get asic capabilities based on asic type */
-  if (sb_redirect_asic_capabilities_get (asicType, &asicCapPtr) !=
-      BVIEW_STATUS_SUCCESS)
+  asicCapPtr = unitPtr->asicCap;
+  if (asicCapPtr == NULL)
   {
     SB_REDIRECT_DEBUG_PRINT (BVIEW_LOG_ERROR,
                              "(%s:%d) Failed to get asic capabilities for unit %d \n",
@@ -1067,8 +946,6 @@ BVIEW_STATUS sbapi_system_asic_num_rqeqp_get (int asic, int *numRqeQueuePools)
     *numRqeQueuePools = asicCapPtr->numRqeQueuePools;
     rv = BVIEW_STATUS_SUCCESS;
   }
-  /* Release Read lock */
-  SB_REDIRECT_RWLOCK_UNLOCK (sbRedirectRWLock);
   return rv;
 }
 
@@ -1078,8 +955,7 @@ BVIEW_STATUS sbapi_system_asic_num_rqeqp_get (int asic, int *numRqeQueuePools)
 * @param[in]   asic                 Unit number
 * @param[out]  numPriorityGroups    Number of priority groups
 *
-* @retval   BVIEW_STATUS_FAILURE      Due to lock acquistion failure or 
-*                                     Failed to get asic type from unit or
+* @retval   BVIEW_STATUS_FAILURE      Failed to get asic type from unit or
 *                                     Failed to get asic capabilites for this unit
 *
 * @retval   BVIEW_STATUS_SUCCESS      Get number of priority groups
@@ -1090,24 +966,21 @@ BVIEW_STATUS sbapi_system_asic_num_rqeqp_get (int asic, int *numRqeQueuePools)
 *********************************************************************/
 BVIEW_STATUS sbapi_system_asic_num_pg_get (int asic, int *numPriorityGroups)
 {
-  BVIEW_ASIC_TYPE asicType;
+  const BVIEW_SB_REDIRECT_UNIT_t *unitPtr = NULL;
   BVIEW_ASIC_CAPABILITIES_t *asicCapPtr = NULL;
   BVIEW_STATUS rv;
 
-  /* Get asic type of the unit */
-  if (sbapi_system_unit_to_asic_type_get (asic, &asicType) !=
-      BVIEW_STATUS_SUCCESS)
+  /* Get asic capabilities resolved for the unit */
+  unitPtr = sb_redirect_unit_get (asic);
+  if (unitPtr == NULL)
   {
     SB_REDIRECT_DEBUG_PRINT (BVIEW_LOG_ERROR,
                              "(%s:%d) Failed to get asic type for unit %d \n",
                              __FILE__, __LINE__, asic);
     return BVIEW_STATUS_FAILURE;
   }
-  /* Acquire Read lock */
-  SB_REDIRECT_RWLOCK_RD_LOCK (sbRedirectRWLock);
-  /* Get asic capabilities based on asic type */
-  if (sb_redirect_asic_capabilities_get (asicType, &asicCapPtr) !=
-      BVIEW_STATUS_SUCCESS)
+  asicCapPtr = unitPtr->asicCap;
+  if (asicCapPtr == NULL)
   {
     SB_REDIRECT_DEBUG_PRINT (BVIEW_LOG_ERROR,
                              "(%s:%d) Failed to get asic capabilities for unit %d \n",
@@ -1120,8 +993,6 @@ BVIEW_STATUS sbapi_system_asic_num_pg_get (int asic, int *numPriorityGroups)
     *numPriorityGroups = asicCapPtr->numPriorityGroups;
     rv = BVIEW_STATUS_SUCCESS;
   }
-  /* Release Read lock */
-  SB_REDIRECT_RWLOCK_UNLOCK (sbRedirectRWLock);
   return rv;
 }
 
@@ -1131,8 +1002,7 @@ BVIEW_STATUS sbapi_system_asic_num_pg_get (int asic, int *numPriorityGroups)
 * @param[in]   asic                 Unit number
 * @param[out]  support1588          Support for 1588
 *
-* @retval   BVIEW_STATUS_FAILURE      Due to lock acquistion failure or 
-*                                     Failed to get asic type from unit or
+* @retval   BVIEW_STATUS_FAILURE      Failed to get asic type from unit or
 *                                     Failed to get asic capabilites for this unit
 *
 * @retval   BVIEW_STATUS_SUCCESS      Unit's capability for 1588 is successfully 
@@ -1143,24 +1013,21 @@ BVIEW_STATUS sbapi_system_asic_num_pg_get (int asic, int *numPriorityGroups)
 *********************************************************************/
 BVIEW_STATUS sbapi_system_asic_support_1588_get (int asic, bool * support1588)
 {
-  BVIEW_ASIC_TYPE asicType;
+  const BVIEW_SB_REDIRECT_UNIT_t *unitPtr = NULL;
   BVIEW_ASIC_CAPABILITIES_t *asicCapPtr = NULL;
   BVIEW_STATUS rv;
 
-  /*  Get asic type of the unit */
-  if (sbapi_system_unit_to_asic_type_get (asic, &asicType) !=
-      BVIEW_STATUS_SUCCESS)
+  /* Get asic capabilities resolved for the unit */
+  unitPtr = sb_redirect_unit_get (asic);
+  if (unitPtr == NULL)
   {
     SB_REDIRECT_DEBUG_PRINT (BVIEW_LOG_ERROR,
                              "(%s:%d) Failed to get asic type for unit %d \n",
                              __FILE__, __LINE__, asic);
     return BVIEW_STATUS_FAILURE;
   }
-  /* Acquire Read lock */
-  SB_REDIRECT_RWLOCK_RD_LOCK (sbRedirectRWLock);
-  /* Get asic capabilities based on asic type */
-  if (sb_redirect_asic_capabilities_get (asicType, &asicCapPtr) !=
-      BVIEW_STATUS_SUCCESS)
+  asicCapPtr = unitPtr->asicCap;
+  if (asicCapPtr == NULL)
   {
     SB_REDIRECT_DEBUG_PRINT (BVIEW_LOG_ERROR,
                              "(%s:%d) Failed to get asic capabilities for unit %d \n",
@@ -1173,7 +1040,5 @@ BVIEW_STATUS sbapi_system_asic_support_1588_get (int asic, bool * support1588)
     *support1588 = asicCapPtr->support1588;
     rv = BVIEW_STATUS_SUCCESS;
   }
-  /* Release Read lock */
-  SB_REDIRECT_RWLOCK_UNLOCK (sbRedirectRWLock);
   return rv;
 }
@@ -0,0 +1,2245 @@
+/*****************************************************************************
+  *
+  * (C) Copyright Broadcom Corporation 2015
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License");
+  * you may not use this file except in compliance with the License.
+  *
+  * You may obtain a copy of the License at
+  * http://www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ***************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+#include "broadview.h"
+#include "sbfeature_bst.h"
+#include "sbplugin_sim.h"
+#include "sbplugin_sim_bst.h"
+#include "sbplugin_sim_system.h"
+#include "common/platform_spec.h"
+
+/* Layout and default threshold of a simulated BST id */
+typedef struct _bview_sim_bst_stat_info_
+{
+  /* counters are per port */
+  bool         perPort;
+  /* number of counters per port (or device wide) */
+  unsigned int numIndex;
+  /* default threshold in bytes */
+  uint64_t     defaultThreshold;
+  /* trigger type reported when the threshold is crossed */
+  BVIEW_BST_TRIGGER_TYPE triggerType;
+  /* realm of the counters */
+  BVIEW_BST_REALM_t      realm;
+} BVIEW_SIM_BST_STAT_INFO_t;
+
+/* Per ASIC state of the simulated BST hardware and SDK */
+typedef struct _bview_sim_bst_asic_
+{
+  /* Lock to protect simulated HW state */
+  pthread_mutex_t              lock;
+  /* Feature configuration */
+  BVIEW_BST_CONFIG_t           config;
+  /* Trigger is re-armed every time the feature is enabled*/
+  bool                         triggerArmed;
+  /* Application trigger callback*/
+  BVIEW_BST_TRIGGER_CALLBACK_t triggerCb;
+  void                         *cookie;
+  /* Traffic generator state*/
+  unsigned int                 seed;
+  /* SDK copy of the counters, in cells*/
+  uint64_t stat[BVIEW_SIM_BST_STAT_ID_MAX_COUNT][BVIEW_SIM_BST_MAX_ENTRIES];
+  /* Configured thresholds, in bytes*/
+  uint64_t threshold[BVIEW_SIM_BST_STAT_ID_MAX_COUNT][BVIEW_SIM_BST_MAX_ENTRIES];
+} BVIEW_SIM_BST_ASIC_t;
+
+static const BVIEW_SIM_BST_STAT_INFO_t simBstStatInfo[BVIEW_SIM_BST_STAT_ID_MAX_COUNT] =
+{
+  /* BVIEW_SIM_BST_STAT_ID_DEVICE */
+  {false, 1, BVIEW_BST_DEVICE_THRES_DEFAULT, BVIEW_BST_TRIGGER_DEVICE, BVIEW_BST_REALM_DEVICE},
+  /* BVIEW_SIM_BST_STAT_ID_EGR_POOL */
+  {false, BVIEW_ASIC_MAX_SERVICE_POOLS, BVIEW_BST_E_SP_UCMC_THRES_DEFAULT, BVIEW_BST_TRIGGER_EGRESS, BVIEW_BST_REALM_EGRESS_SP},
+  /* BVIEW_SIM_BST_STAT_ID_EGR_MCAST_POOL */
+  {false, BVIEW_ASIC_MAX_SERVICE_POOLS, BVIEW_BST_E_SP_MC_THRES_DEFAULT, BVIEW_BST_TRIGGER_EGRESS, BVIEW_BST_REALM_EGRESS_SP},
+  /* BVIEW_SIM_BST_STAT_ID_ING_POOL */
+  {false, BVIEW_ASIC_MAX_SERVICE_POOLS, BVIEW_BST_I_SP_UCMC_SHARED_THRES_DEFAULT, BVIEW_BST_TRIGGER_INGRESS, BVIEW_BST_REALM_INGRESS_SP},
+  /* BVIEW_SIM_BST_STAT_ID_PORT_POOL */
+  {true, BVIEW_ASIC_MAX_SERVICE_POOLS, BVIEW_BST_I_P_SP_UCMC_SHARED_THRES_DEFAULT, BVIEW_BST_TRIGGER_INGRESS, BVIEW_BST_REALM_INGRESS_PORT_SP},
+  /* BVIEW_SIM_BST_STAT_ID_PRI_GROUP_SHARED */
+  {true, BVIEW_ASIC_MAX_PRIORITY_GROUPS, BVIEW_BST_I_P_PG_UCMC_SHARED_THRES_DEFAULT, BVIEW_BST_TRIGGER_INGRESS, BVIEW_BST_REALM_INGRESS_PORT_PG},
+  /* BVIEW_SIM_BST_STAT_ID_PRI_GROUP_HEADROOM */
+  {true, BVIEW_ASIC_MAX_PRIORITY_GROUPS, BVIEW_BST_I_P_PG_UCMC_HDRM_THRES_DEFAULT, BVIEW_BST_TRIGGER_INGRESS, BVIEW_BST_REALM_INGRESS_PORT_PG},
+  /* BVIEW_SIM_BST_STAT_ID_UCAST */
+  {true, BVIEW_SIM_BST_MAX_COS_PORT, BVIEW_BST_UCAST_THRES_DEFAULT, BVIEW_BST_TRIGGER_EGRESS, BVIEW_BST_REALM_EGRESS_UC_QUEUE},
+  /* BVIEW_SIM_BST_STAT_ID_MCAST */
+  {true, BVIEW_SIM_BST_MAX_COS_PORT, BVIEW_BST_MCAST_THRES_DEFAULT, BVIEW_BST_TRIGGER_EGRESS, BVIEW_BST_REALM_EGRESS_MC_QUEUE},
+  /* BVIEW_SIM_BST_STAT_ID_EGR_UCAST_PORT_SHARED */
+  {true, BVIEW_ASIC_MAX_SERVICE_POOLS, BVIEW_BST_E_P_SP_UC_THRES_DEFAULT, BVIEW_BST_TRIGGER_EGRESS, BVIEW_BST_REALM_EGRESS_PORT_SP},
+  /* BVIEW_SIM_BST_STAT_ID_EGR_PORT_SHARED */
+  {true, BVIEW_ASIC_MAX_SERVICE_POOLS, BVIEW_BST_E_P_SP_UCMC_THRES_DEFAULT, BVIEW_BST_TRIGGER_EGRESS, BVIEW_BST_REALM_EGRESS_PORT_SP},
+  /* BVIEW_SIM_BST_STAT_ID_RQE_QUEUE */
+  {false, BVIEW_ASIC_MAX_RQE_QUEUES, BVIEW_BST_E_RQE_THRES_DEFAULT, BVIEW_BST_TRIGGER_EGRESS, BVIEW_BST_REALM_EGRESS_RQE_QUEUE},
+  /* BVIEW_SIM_BST_STAT_ID_UCAST_GROUP */
+  {false, BVIEW_ASIC_MAX_UC_QUEUE_GROUPS, BVIEW_BST_UCAST_QUEUE_GROUP_DEFAULT, BVIEW_BST_TRIGGER_EGRESS, BVIEW_BST_REALM_EGRESS_UC_QUEUEGROUPS}
+};
+
+static BVIEW_SIM_BST_ASIC_t simBstDb[BVIEW_SIM_NUM_ASICS];
+
+/* Shadow copy of the thresholds programmed on a unit, written through
+ * when a threshold is set so that threshold get does not read back
+ * every profile*/
+typedef struct _bview_sim_bst_threshold_shadow_
+{
+  pthread_mutex_t                  lock;
+  /* shadow is seeded from HW by the first threshold get*/
+  bool                             valid;
+  BVIEW_BST_ASIC_SNAPSHOT_DATA_t   data;
+} BVIEW_SIM_BST_THRESHOLD_SHADOW_t;
+
+static BVIEW_SIM_BST_THRESHOLD_SHADOW_t simBstThresholdShadow[BVIEW_SIM_NUM_ASICS];
+
+/* Write a programmed threshold through to the shadow, entries out of
+ * _inRange are not part of the threshold snapshot*/
+#define BVIEW_SIM_BST_SHADOW_SET(_asic,_inRange,_field,_value)              \
+              if (_inRange)                                                 \
+              {                                                             \
+                pthread_mutex_lock (&simBstThresholdShadow[(_asic)].lock);  \
+                simBstThresholdShadow[(_asic)].data._field = (_value);      \
+                pthread_mutex_unlock (&simBstThresholdShadow[(_asic)].lock); \
+              }
+
+/* Entry of a per index threshold is in the snapshot*/
+#define BVIEW_SIM_BST_SHADOW_INDEX_RANGE(_index,_max)                       \
+              (((_index) >= 0) && ((_index) < (_max)))
+
+/* Entry of a per (port, index) threshold is in the snapshot*/
+#define BVIEW_SIM_BST_SHADOW_PORT_RANGE(_port,_index,_max)                  \
+              (((_port) > 0) && ((_port) <= BVIEW_ASIC_MAX_PORTS) &&         \
+               BVIEW_SIM_BST_SHADOW_INDEX_RANGE ((_index), (_max)))
+
+/* Simulated BST id of a counter type*/
+static const BVIEW_SIM_BST_STAT_ID_t simBstStatMap[BVIEW_BST_STAT_MAX] =
+{
+  /* BVIEW_BST_STAT_DEVICE */
+  BVIEW_SIM_BST_STAT_ID_DEVICE,
+  /* BVIEW_BST_STAT_ING_PORT_PG_SHARED */
+  BVIEW_SIM_BST_STAT_ID_PRI_GROUP_SHARED,
+  /* BVIEW_BST_STAT_ING_PORT_PG_HEADROOM */
+  BVIEW_SIM_BST_STAT_ID_PRI_GROUP_HEADROOM,
+  /* BVIEW_BST_STAT_ING_PORT_SP_SHARED */
+  BVIEW_SIM_BST_STAT_ID_PORT_POOL,
+  /* BVIEW_BST_STAT_ING_SP_SHARED */
+  BVIEW_SIM_BST_STAT_ID_ING_POOL,
+  /* BVIEW_BST_STAT_EGR_PORT_SP_UC_SHARED */
+  BVIEW_SIM_BST_STAT_ID_EGR_UCAST_PORT_SHARED,
+  /* BVIEW_BST_STAT_EGR_PORT_SP_SHARED */
+  BVIEW_SIM_BST_STAT_ID_EGR_PORT_SHARED,
+  /* BVIEW_BST_STAT_EGR_SP_SHARED */
+  BVIEW_SIM_BST_STAT_ID_EGR_POOL,
+  /* BVIEW_BST_STAT_EGR_SP_MC_SHARED */
+  BVIEW_SIM_BST_STAT_ID_EGR_MCAST_POOL,
+  /* BVIEW_BST_STAT_EGR_UC_QUEUE */
+  BVIEW_SIM_BST_STAT_ID_UCAST,
+  /* BVIEW_BST_STAT_EGR_UC_QUEUE_GROUP */
+  BVIEW_SIM_BST_STAT_ID_UCAST_GROUP,
+  /* BVIEW_BST_STAT_EGR_MC_QUEUE */
+  BVIEW_SIM_BST_STAT_ID_MCAST,
+  /* BVIEW_BST_STAT_EGR_CPU_QUEUE */
+  BVIEW_SIM_BST_STAT_ID_MCAST,
+  /* BVIEW_BST_STAT_EGR_RQE_QUEUE */
+  BVIEW_SIM_BST_STAT_ID_RQE_QUEUE
+};
+
+/* Simulated BST ids synced for a realm*/
+static const BVIEW_BST_COLLECT_REALM_SYNC_t simBstRealmSync[BVIEW_BST_NUM_REALMS] =
+{
+  {BVIEW_BST_REALM_DEVICE, 1, {BVIEW_SIM_BST_STAT_ID_DEVICE}},
+  {BVIEW_BST_REALM_INGRESS_PORT_PG, 2,
+   {BVIEW_SIM_BST_STAT_ID_PRI_GROUP_SHARED, BVIEW_SIM_BST_STAT_ID_PRI_GROUP_HEADROOM}},
+  {BVIEW_BST_REALM_INGRESS_PORT_SP, 1, {BVIEW_SIM_BST_STAT_ID_PORT_POOL}},
+  {BVIEW_BST_REALM_INGRESS_SP, 1, {BVIEW_SIM_BST_STAT_ID_ING_POOL}},
+  {BVIEW_BST_REALM_EGRESS_PORT_SP, 2,
+   {BVIEW_SIM_BST_STAT_ID_EGR_PORT_SHARED, BVIEW_SIM_BST_STAT_ID_EGR_UCAST_PORT_SHARED}},
+  {BVIEW_BST_REALM_EGRESS_SP, 2,
+   {BVIEW_SIM_BST_STAT_ID_EGR_POOL, BVIEW_SIM_BST_STAT_ID_EGR_MCAST_POOL}},
+  {BVIEW_BST_REALM_EGRESS_UC_QUEUE, 1, {BVIEW_SIM_BST_STAT_ID_UCAST}},
+  {BVIEW_BST_REALM_EGRESS_UC_QUEUEGROUPS, 1, {BVIEW_SIM_BST_STAT_ID_UCAST_GROUP}},
+  {BVIEW_BST_REALM_EGRESS_MC_QUEUE, 1, {BVIEW_SIM_BST_STAT_ID_MCAST}},
+  /* CPU queues are MC queues of the CPU port*/
+  {BVIEW_BST_REALM_EGRESS_CPU_QUEUE, 1, {BVIEW_SIM_BST_STAT_ID_MCAST}},
+  {BVIEW_BST_REALM_EGRESS_RQE_QUEUE, 1, {BVIEW_SIM_BST_STAT_ID_RQE_QUEUE}}
+};
+
+/* Realm readers, the stat ids are synced by the callers*/
+static BVIEW_STATUS sbplugin_sim_bst_device_data_read (int asic,
+                                    BVIEW_BST_DEVICE_DATA_t *data,
+                                    BVIEW_TIME_t *time);
+
+static BVIEW_STATUS sbplugin_sim_bst_ippg_data_read (int asic,
+                              BVIEW_BST_INGRESS_PORT_PG_DATA_t *data,
+                              BVIEW_TIME_t *time);
+
+static BVIEW_STATUS sbplugin_sim_bst_ipsp_data_read (int asic,
+                                  BVIEW_BST_INGRESS_PORT_SP_DATA_t *data,
+                                  BVIEW_TIME_t *time);
+
+static BVIEW_STATUS sbplugin_sim_bst_isp_data_read (int asic,
+                                 BVIEW_BST_INGRESS_SP_DATA_t *data,
+                                 BVIEW_TIME_t *time);
+
+static BVIEW_STATUS sbplugin_sim_bst_epsp_data_read (int asic,
+                                BVIEW_BST_EGRESS_PORT_SP_DATA_t *data,
+                                BVIEW_TIME_t *time);
+
+static BVIEW_STATUS sbplugin_sim_bst_esp_data_read (int asic,
+                               BVIEW_BST_EGRESS_SP_DATA_t *data,
+                               BVIEW_TIME_t *time);
+
+static BVIEW_STATUS sbplugin_sim_bst_eucq_data_read (int asic,
+                              BVIEW_BST_EGRESS_UC_QUEUE_DATA_t *data,
+                              BVIEW_TIME_t *time);
+
+static BVIEW_STATUS sbplugin_sim_bst_eucqg_data_read (int asic,
+                        BVIEW_BST_EGRESS_UC_QUEUEGROUPS_DATA_t *data,
+                        BVIEW_TIME_t *time);
+
+static BVIEW_STATUS sbplugin_sim_bst_emcq_data_read (int asic,
+                              BVIEW_BST_EGRESS_MC_QUEUE_DATA_t *data,
+                              BVIEW_TIME_t *time);
+
+static BVIEW_STATUS sbplugin_sim_bst_cpuq_data_read (int asic,
+                             BVIEW_BST_EGRESS_CPU_QUEUE_DATA_t *data,
+                             BVIEW_TIME_t *time);
+
+static BVIEW_STATUS sbplugin_sim_bst_rqeq_data_read (int asic,
+                                   BVIEW_BST_EGRESS_RQE_QUEUE_DATA_t *data,
+                                   BVIEW_TIME_t *time);
+
+/* Counter location of (port, index) in the per BST id tables*/
+#define BVIEW_SIM_BST_ENTRY(_port,_index)   ((_port) * BVIEW_SIM_BST_MAX_COS_PORT + (_index))
+
+/* Validate (port, index) for a BST id*/
+#define BVIEW_SIM_BST_ENTRY_CHECK(_asic,_bid,_port,_index)                       \
+              if (((_bid) >= BVIEW_SIM_BST_STAT_ID_MAX_COUNT) ||                \
+                  ((_index) < 0) ||                                             \
+                  ((_index) >= simBstStatInfo[(_bid)].numIndex) ||              \
+                  ((_port) < 0) ||                                              \
+                  ((_port) > simAsicDb[(_asic)].scalingParams.numPorts) ||      \
+                  ((!simBstStatInfo[(_bid)].perPort) && ((_port) != 0)))        \
+              {                                                                 \
+                return BVIEW_STATUS_INVALID_PARAMETER;                          \
+              }
+
+/*********************************************************************
+* @brief  Next value of the simulated traffic generator
+*
+* @param[in,out]  seed     - generator state
+*
+* @retval   pseudo random value
+*
+* @notes    xorshift, good enough to make counters move.
+*
+*
+*********************************************************************/
+static unsigned int sbplugin_sim_bst_random (unsigned int *seed)
+{
+  unsigned int x = *seed;
+
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  *seed = x;
+  return x;
+}
+
+/*********************************************************************
+* @brief  Build the context of a trigger raised by a counter
+*
+* @param[in]   bid                   - BST stat id
+* @param[in]   port                  - port of the counter
+* @param[in]   index                 - index of the counter in the port
+* @param[out]  triggerInfo           - trigger context
+*
+* @retval none
+*
+* @notes    Index is same as that of the threshold of the realm.
+*           CPU queues are MC queues of the CPU port.
+*
+*
+*********************************************************************/
+static void sbplugin_sim_bst_trigger_info_get (BVIEW_SIM_BST_STAT_ID_t bid,
+                                               unsigned int port,
+                                               unsigned int index,
+                                               BVIEW_BST_TRIGGER_INFO_t *triggerInfo)
+{
+  const BVIEW_SIM_BST_STAT_INFO_t *info = &simBstStatInfo[bid];
+
+  memset (triggerInfo, 0, sizeof (BVIEW_BST_TRIGGER_INFO_t));
+  triggerInfo->type = info->triggerType;
+  triggerInfo->realm = info->realm;
+  triggerInfo->index = index;
+
+  if ((bid == BVIEW_SIM_BST_STAT_ID_MCAST) && (port == BVIEW_SIM_BST_CPU_PORT))
+  {
+    triggerInfo->realm = BVIEW_BST_REALM_EGRESS_CPU_QUEUE;
+    return;
+  }
+  if (info->perPort)
+  {
+    triggerInfo->port = port;
+  }
+  if ((bid == BVIEW_SIM_BST_STAT_ID_UCAST) || (bid == BVIEW_SIM_BST_STAT_ID_MCAST))
+  {
+    triggerInfo->index = ((port - 1) * sbSimConfig.numCosPerPort) + index;
+  }
+}
+
+/*********************************************************************
+* @brief  Copy the simulated HW counters of a BST id to the SDK copy
+*
+* @param[in]   asic                  - unit
+* @param[in]   bid                   - BST stat id
+*
+* @retval BVIEW_STATUS_INVALID_PARAMETER if input data is invalid.
+* @retval BVIEW_STATUS_SUCCESS           if sync is success.
+*
+* @notes    Charges the configured sync latency. Fires the registered
+*           trigger callback if a counter crosses its threshold.
+*
+*
+*********************************************************************/
+BVIEW_STATUS sbplugin_sim_bst_stat_sync (int asic, BVIEW_SIM_BST_STAT_ID_t bid)
+{
+  BVIEW_SIM_BST_ASIC_t *sim;
+  const BVIEW_SIM_BST_STAT_INFO_t *info;
+  BVIEW_BST_TRIGGER_INFO_t triggerInfo;
+  unsigned int port = 0, index = 0, entry = 0;
+  unsigned int firstPort = 0, lastPort = 0;
+  uint64_t limit = 0, value = 0;
+  bool fire = false;
+
+  BVIEW_SIM_UNIT_CHECK (asic);
+  if (bid >= BVIEW_SIM_BST_STAT_ID_MAX_COUNT)
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+
+  BVIEW_SIM_COST (sbSimConfig.syncLatencyUsec, 1);
+
+  sim = &simBstDb[asic];
+  info = &simBstStatInfo[bid];
+
+  /* Occupancy of the simulated traffic in cells*/
+  limit = (info->defaultThreshold / BVIEW_SIM_CELL_TO_BYTE) *
+          sbSimConfig.loadPercent / 100;
+
+  /* CPU queues share the MC queue table (CPU port is 0)*/
+  firstPort = (bid == BVIEW_SIM_BST_STAT_ID_MCAST) ? BVIEW_SIM_BST_CPU_PORT : 1;
+  lastPort = info->perPort ? simAsicDb[asic].scalingParams.numPorts : 0;
+  if (!info->perPort)
+  {
+    firstPort = 0;
+  }
+
+  pthread_mutex_lock (&sim->lock);
+  /* Counters are frozen while tracking is disabled*/
+  if (sim->config.enableStatsMonitoring)
+  {
+    for (port = firstPort; port <= lastPort; port++)
+    {
+      BVIEW_SIM_BST_ITER (index, info->numIndex)
+      {
+        entry = BVIEW_SIM_BST_ENTRY (port, index);
+        value = sbplugin_sim_bst_random (&sim->seed) % (limit + 1);
+        if ((sim->config.mode == BVIEW_BST_MODE_CURRENT) ||
+            (value > sim->stat[bid][entry]))
+        {
+          sim->stat[bid][entry] = value;
+        }
+        if (sim->triggerArmed && !fire &&
+            (value * BVIEW_SIM_CELL_TO_BYTE) >= sim->threshold[bid][entry])
+        {
+          /* first counter to cross the threshold is reported*/
+          fire = true;
+          sbplugin_sim_bst_trigger_info_get (bid, port, index, &triggerInfo);
+        }
+      }
+    }
+  }
+  if (fire)
+  {
+    /* Hardware raises one trigger until the feature is re-enabled*/
+    sim->triggerArmed = false;
+  }
+  pthread_mutex_unlock (&sim->lock);
+
+  if (fire && sim->triggerCb != NULL)
+  {
+    SB_SIM_DEBUG_PRINT (BVIEW_LOG_DEBUG,
+                        "SIM:ASIC(%d) BID(%d) threshold crossed", asic, bid);
+    sim->triggerCb (asic, sim->cookie, &triggerInfo);
+  }
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief  Read one synced counter of a BST id
+*
+* @param[in]   asic                  - unit
+* @param[in]   port                  - port, 0 for device wide ids
+* @param[in]   index                 - cosq/pg/sp/queue index
+* @param[in]   bid                   - BST stat id
+* @param[out]  value                 - counter value in cells
+*
+* @retval BVIEW_STATUS_INVALID_PARAMETER if input data is invalid.
+* @retval BVIEW_STATUS_SUCCESS           if stat get is success.
+*
+* @notes    Charges the configured per call stat latency.
+*
+*
+*********************************************************************/
+BVIEW_STATUS sbplugin_sim_bst_stat_get (int asic, int port, int index,
+                                        BVIEW_SIM_BST_STAT_ID_t bid,
+                                        uint64_t *value)
+{
+  BVIEW_SIM_UNIT_CHECK (asic);
+  BVIEW_SIM_NULLPTR_CHECK (value);
+  BVIEW_SIM_BST_ENTRY_CHECK (asic, bid, port, index);
+
+  BVIEW_SIM_COST (sbSimConfig.statLatencyUsec, 1);
+
+  *value = simBstDb[asic].stat[bid][BVIEW_SIM_BST_ENTRY (port, index)];
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief  Read the synced counters of one counter type in bulk
+*
+* @param[in]      asic               - unit
+* @param[in,out]  bulk               - counter type, port and index
+*                                      range and the counters
+*
+* @retval BVIEW_STATUS_INVALID_PARAMETER if input data is invalid.
+* @retval BVIEW_STATUS_SUCCESS           if stat get is success.
+*
+* @notes    Models an SDK table read: the configured stat latency is
+*           charged once per call, not once per counter.
+*
+*
+*********************************************************************/
+BVIEW_STATUS sbplugin_sim_bst_stat_bulk_get (int asic,
+                                             BVIEW_BST_STAT_BULK_t *bulk)
+{
+  const BVIEW_SIM_BST_STAT_INFO_t *info;
+  BVIEW_SIM_BST_STAT_ID_t bid;
+  unsigned int row = 0, index = 0, firstPort = 0;
+  uint64_t *stat, *value;
+
+  BVIEW_SIM_UNIT_CHECK (asic);
+  if ((bulk == NULL) || (bulk->values == NULL) ||
+      (bulk->stat >= BVIEW_BST_STAT_MAX) || (bulk->numPorts == 0))
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+
+  bid = simBstStatMap[bulk->stat];
+  info = &simBstStatInfo[bid];
+  if (bulk->numIndex > info->numIndex)
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+
+  /* CPU queues share the MC queue table (CPU port is 0)*/
+  if ((bulk->stat != BVIEW_BST_STAT_EGR_CPU_QUEUE) && info->perPort)
+  {
+    firstPort = bulk->firstPort;
+    if ((firstPort < 1) ||
+        ((firstPort + bulk->numPorts - 1) > simAsicDb[asic].scalingParams.numPorts))
+    {
+      return BVIEW_STATUS_INVALID_PARAMETER;
+    }
+  }
+  else if (bulk->numPorts != 1)
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+
+  BVIEW_SIM_COST (sbSimConfig.statLatencyUsec, 1);
+
+  stat = simBstDb[asic].stat[bid];
+  BVIEW_SIM_BST_ITER (row, bulk->numPorts)
+  {
+    value = bulk->values + (row * bulk->portStride);
+    BVIEW_SIM_BST_ITER (index, bulk->numIndex)
+    {
+      *value = stat[BVIEW_SIM_BST_ENTRY (firstPort + row, index)];
+      value += bulk->indexStride;
+    }
+  }
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief  Set the threshold of one counter of a BST id
+*
+* @param[in]   asic                  - unit
+* @param[in]   port                  - port, 0 for device wide ids
+* @param[in]   index                 - cosq/pg/sp/queue index
+* @param[in]   bid                   - BST stat id
+* @param[in]   bytes                 - threshold in bytes
+*
+* @retval BVIEW_STATUS_INVALID_PARAMETER if input data is invalid.
+* @retval BVIEW_STATUS_SUCCESS           if profile set is success.
+*
+* @notes    Charges the configured per call profile latency.
+*
+*
+*********************************************************************/
+static BVIEW_STATUS sbplugin_sim_bst_profile_set (int asic, int port, int index,
+                                                  BVIEW_SIM_BST_STAT_ID_t bid,
+                                                  uint64_t bytes)
+{
+  BVIEW_SIM_BST_ENTRY_CHECK (asic, bid, port, index);
+
+  BVIEW_SIM_COST (sbSimConfig.profileLatencyUsec, 1);
+
+  simBstDb[asic].threshold[bid][BVIEW_SIM_BST_ENTRY (port, index)] = bytes;
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief  Get the threshold of one counter of a BST id
+*
+* @param[in]   asic                  - unit
+* @param[in]   port                  - port, 0 for device wide ids
+* @param[in]   index                 - cosq/pg/sp/queue index
+* @param[in]   bid                   - BST stat id
+* @param[out]  bytes                 - threshold in bytes
+*
+* @retval BVIEW_STATUS_INVALID_PARAMETER if input data is invalid.
+* @retval BVIEW_STATUS_SUCCESS           if profile get is success.
+*
+* @notes    Charges the configured per call profile latency.
+*
+*
+*********************************************************************/
+static BVIEW_STATUS sbplugin_sim_bst_profile_get (int asic, int port, int index,
+                                                  BVIEW_SIM_BST_STAT_ID_t bid,
+                                                  uint64_t *bytes)
+{
+  BVIEW_SIM_BST_ENTRY_CHECK (asic, bid, port, index);
+
+  BVIEW_SIM_COST (sbSimConfig.profileLatencyUsec, 1);
+
+  *bytes = simBstDb[asic].threshold[bid][BVIEW_SIM_BST_ENTRY (port, index)];
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/* Read a counter type of the ports 1.._numPorts in bulk, bail out on failure*/
+#define BVIEW_SIM_BST_STAT_BULK_GET(_asic,_stat,_numPorts,_numIndex,_values,_portStride,_indexStride) \
+              {                                                                      \
+                BVIEW_BST_STAT_BULK_t _bulk = {(_stat), 1, (_numPorts), (_numIndex), \
+                                               (_portStride), (_indexStride), (_values)}; \
+                if (sbplugin_sim_bst_stat_bulk_get ((_asic), &_bulk) !=              \
+                    BVIEW_STATUS_SUCCESS)                                            \
+                {                                                                    \
+                  return BVIEW_STATUS_FAILURE;                                       \
+                }                                                                    \
+              }
+
+/* Program a threshold, bail out on failure*/
+#define BVIEW_SIM_BST_PROFILE_SET(_asic,_port,_index,_bid,_bytes)                   \
+              if (sbplugin_sim_bst_profile_set ((_asic), (_port), (_index), (_bid),  \
+                                                (_bytes)) != BVIEW_STATUS_SUCCESS)   \
+              {                                                                      \
+                return BVIEW_STATUS_INVALID_PARAMETER;                               \
+              }
+
+/* Read back a threshold, bail out on failure*/
+#define BVIEW_SIM_BST_PROFILE_GET(_asic,_port,_index,_bid,_bytes)                   \
+              if (sbplugin_sim_bst_profile_get ((_asic), (_port), (_index), (_bid),  \
+                                                (_bytes)) != BVIEW_STATUS_SUCCESS)   \
+              {                                                                      \
+                return BVIEW_STATUS_FAILURE;                                         \
+              }
+
+/*********************************************************************
+* @brief  BST feature configuration set function
+*
+* @param[in]   asic                  - unit
+* @param[in]   data                  - BST config structure
+*
+* @retval BVIEW_STATUS_INVALID_PARAMETER if input data is invalid.
+* @retval BVIEW_STATUS_SUCCESS           if config set is success.
+*
+* @notes    Enabling the feature re-arms the trigger.
+*
+*
+*********************************************************************/
+static BVIEW_STATUS sbplugin_sim_bst_config_set (int asic, BVIEW_BST_CONFIG_t *data)
+{
+  BVIEW_SIM_UNIT_CHECK (asic);
+  if (data == NULL)
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+
+  pthread_mutex_lock (&simBstDb[asic].lock);
+  simBstDb[asic].config = *data;
+  simBstDb[asic].triggerArmed = data->enableStatsMonitoring;
+  pthread_mutex_unlock (&simBstDb[asic].lock);
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief  Get BST configuration
+*
+* @param[in]   asic                  - unit
+* @param[out]  data                  - BST config structure
+*
+* @retval BVIEW_STATUS_INVALID_PARAMETER if input data is invalid.
+* @retval BVIEW_STATUS_SUCCESS           if config get is success.
+*
+* @notes    none
+*
+*
+*********************************************************************/
+static BVIEW_STATUS sbplugin_sim_bst_config_get (int asic, BVIEW_BST_CONFIG_t *data)
+{
+  BVIEW_SIM_UNIT_CHECK (asic);
+  if (data == NULL)
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+
+  pthread_mutex_lock (&simBstDb[asic].lock);
+  *data = simBstDb[asic].config;
+  pthread_mutex_unlock (&simBstDb[asic].lock);
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief  Read Device Statistics
+*
+* @param[in]   asic             - unit
+* @param[out]  data             - Device data structure
+* @param[out]  time             - time
+*
+* @retval BVIEW_STATUS_FAILURE           if device stat get is failed.
+* @retval BVIEW_STATUS_SUCCESS           if device stat get is success.
+*
+* @notes    Counters are read as last synced to the SDK, the stat ids
+*           of the realm are synced by the caller.
+*
+*
+*********************************************************************/
+static BVIEW_STATUS sbplugin_sim_bst_device_data_read (int asic,
+                                    BVIEW_BST_DEVICE_DATA_t *data,
+                                    BVIEW_TIME_t *time)
+{
+  sbplugin_sim_system_time_get (time);
+
+  BVIEW_SIM_BST_STAT_BULK_GET (asic, BVIEW_BST_STAT_DEVICE, 1, 1,
+                               &data->bufferCount, 0, 0);
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief  Obtain Device Statistics
+*
+* @param[in]   asic             - unit
+* @param[out]  data             - Device data structure
+* @param[out]  time             - time
+*
+* @retval BVIEW_STATUS_INVALID_PARAMETER if input data is invalid.
+* @retval BVIEW_STATUS_FAILURE           if device stat get is failed.
+* @retval BVIEW_STATUS_SUCCESS           if device stat get is success.
+*
+* @notes    none
+*
+*
+*********************************************************************/
+static BVIEW_STATUS sbplugin_sim_bst_device_data_get (int asic,
+                                    BVIEW_BST_DEVICE_DATA_t *data,
+                                    BVIEW_TIME_t *time)
+{
+  BVIEW_SIM_BST_INPUT_VALIDATE (asic, data, time);
+
+  BVIEW_SIM_BST_REALM_SYNC (asic, BVIEW_BST_REALM_DEVICE);
+
+  return sbplugin_sim_bst_device_data_read (asic, data, time);
+}
+
+/*********************************************************************
+* @brief  Read Ingress Port + Priority Groups Statistics
+*
+* @param[in]   asic             - unit
+* @param[out]  data             - i_p_pg data structure
+* @param[out]  time             - time
+*
+* @retval BVIEW_STATUS_FAILURE           if ippg stat get is failed.
+* @retval BVIEW_STATUS_SUCCESS           if ippg stat get is success.
+*
+* @notes    Counters are read as last synced to the SDK, the stat ids
+*           of the realm are synced by the caller.
+*
+*
+*********************************************************************/
+static BVIEW_STATUS sbplugin_sim_bst_ippg_data_read (int asic,
+                              BVIEW_BST_INGRESS_PORT_PG_DATA_t *data,
+                              BVIEW_TIME_t *time)
+{
+  sbplugin_sim_system_time_get (time);
+
+  BVIEW_SIM_BST_STAT_BULK_GET (asic, BVIEW_BST_STAT_ING_PORT_PG_SHARED,
+                               simAsicDb[asic].scalingParams.numPorts,
+                               BVIEW_ASIC_MAX_PRIORITY_GROUPS,
+                               &data->data[0][0].umShareBufferCount,
+                               BVIEW_SIM_BST_STRIDE (data->data[0]),
+                               BVIEW_SIM_BST_STRIDE (data->data[0][0]));
+  BVIEW_SIM_BST_STAT_BULK_GET (asic, BVIEW_BST_STAT_ING_PORT_PG_HEADROOM,
+                               simAsicDb[asic].scalingParams.numPorts,
+                               BVIEW_ASIC_MAX_PRIORITY_GROUPS,
+                               &data->data[0][0].umHeadroomBufferCount,
+                               BVIEW_SIM_BST_STRIDE (data->data[0]),
+                               BVIEW_SIM_BST_STRIDE (data->data[0][0]));
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief  Obtain Ingress Port + Priority Groups Statistics
+*
+* @param[in]   asic             - unit
+* @param[out]  data             - i_p_pg data structure
+* @param[out]  time             - time
+*
+* @retval BVIEW_STATUS_INVALID_PARAMETER if input data is invalid.
+* @retval BVIEW_STATUS_FAILURE           if ippg stat get is failed.
+* @retval BVIEW_STATUS_SUCCESS           if ippg stat get is success.
+*
+* @notes    none
+*
+*
+*********************************************************************/
+static BVIEW_STATUS sbplugin_sim_bst_ippg_data_get (int asic,
+                              BVIEW_BST_INGRESS_PORT_PG_DATA_t *data,
+                              BVIEW_TIME_t *time)
+{
+  BVIEW_SIM_BST_INPUT_VALIDATE (asic, data, time);
+
+  BVIEW_SIM_BST_REALM_SYNC (asic, BVIEW_BST_REALM_INGRESS_PORT_PG);
+
+  return sbplugin_sim_bst_ippg_data_read (asic, data, time);
+}
+
+/*********************************************************************
+* @brief  Read Ingress Port + Service Pools Statistics
+*
+* @param[in]   asic             - unit
+* @param[out]  data             - i_p_sp data structure
+* @param[out]  time             - time
+*
+* @retval BVIEW_STATUS_FAILURE           if ipsp stat get is failed.
+* @retval BVIEW_STATUS_SUCCESS           if ipsp stat get is success.
+*
+* @notes    Counters are read as last synced to the SDK, the stat ids
+*           of the realm are synced by the caller.
+*
+*
+*********************************************************************/
+static BVIEW_STATUS sbplugin_sim_bst_ipsp_data_read (int asic,
+                                  BVIEW_BST_INGRESS_PORT_SP_DATA_t *data,
+                                  BVIEW_TIME_t *time)
+{
+  sbplugin_sim_system_time_get (time);
+
+  BVIEW_SIM_BST_STAT_BULK_GET (asic, BVIEW_BST_STAT_ING_PORT_SP_SHARED,
+                               simAsicDb[asic].scalingParams.numPorts,
+                               BVIEW_ASIC_MAX_SERVICE_POOLS,
+                               &data->data[0][0].umShareBufferCount,
+                               BVIEW_SIM_BST_STRIDE (data->data[0]),
+                               BVIEW_SIM_BST_STRIDE (data->data[0][0]));
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief  Obtain Ingress Port + Service Pools Statistics
+*
+* @param[in]   asic             - unit
+* @param[out]  data             - i_p_sp data structure
+* @param[out]  time             - time
+*
+* @retval BVIEW_STATUS_INVALID_PARAMETER if input data is invalid.
+* @retval BVIEW_STATUS_FAILURE           if ipsp stat get is failed.
+* @retval BVIEW_STATUS_SUCCESS           if ipsp stat get is success.
+*
+* @notes    none
+*
+*
+*********************************************************************/
+static BVIEW_STATUS sbplugin_sim_bst_ipsp_data_get (int asic,
+                                  BVIEW_BST_INGRESS_PORT_SP_DATA_t *data,
+                                  BVIEW_TIME_t *time)
+{
+  BVIEW_SIM_BST_INPUT_VALIDATE (asic, data, time);
+
+  BVIEW_SIM_BST_REALM_SYNC (asic, BVIEW_BST_REALM_INGRESS_PORT_SP);
+
+  return sbplugin_sim_bst_ipsp_data_read (asic, data, time);
+}
+
+/*********************************************************************
+* @brief  Read Ingress Service Pools Statistics
+*
+* @param[in]   asic             - unit
+* @param[out]  data             - i_sp structure
+* @param[out]  time             - time
+*
+* @retval BVIEW_STATUS_FAILURE           if isp stat get is failed.
+* @retval BVIEW_STATUS_SUCCESS           if isp stat get is success.
+*
+* @notes    Counters are read as last synced to the SDK, the stat ids
+*           of the realm are synced by the caller.
+*
+*
+*********************************************************************/
+static BVIEW_STATUS sbplugin_sim_bst_isp_data_read (int asic,
+                                 BVIEW_BST_INGRESS_SP_DATA_t *data,
+                                 BVIEW_TIME_t *time)
+{
+  sbplugin_sim_system_time_get (time);
+
+  BVIEW_SIM_BST_STAT_BULK_GET (asic, BVIEW_BST_STAT_ING_SP_SHARED, 1,
+                               BVIEW_ASIC_MAX_SERVICE_POOLS,
+                               &data->data[0].umShareBufferCount, 0,
+                               BVIEW_SIM_BST_STRIDE (data->data[0]));
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief  Obtain Ingress Service Pools Statistics
+*
+* @param[in]   asic             - unit
+* @param[out]  data             - i_sp structure
+* @param[out]  time             - time
+*
+* @retval BVIEW_STATUS_INVALID_PARAMETER if input data is invalid.
+* @retval BVIEW_STATUS_FAILURE           if isp stat get is failed.
+* @retval BVIEW_STATUS_SUCCESS           if isp stat get is success.
+*
+* @notes    none
+*
+*
+*********************************************************************/
+static BVIEW_STATUS sbplugin_sim_bst_isp_data_get (int asic,
+                                 BVIEW_BST_INGRESS_SP_DATA_t *data,
+                                 BVIEW_TIME_t *time)
+{
+  BVIEW_SIM_BST_INPUT_VALIDATE (asic, data, time);
+
+  BVIEW_SIM_BST_REALM_SYNC (asic, BVIEW_BST_REALM_INGRESS_SP);
+
+  return sbplugin_sim_bst_isp_data_read (asic, data, time);
+}
+
+/*********************************************************************
+* @brief  Read Egress Port + Service Pools Statistics
+*
+* @param[in]   asic             - unit
+* @param[out]  data             - e_p_sp data structure
+* @param[out]  time             - time
+*
+* @retval BVIEW_STATUS_FAILURE           if epsp stat get is failed.
+* @retval BVIEW_STATUS_SUCCESS           if epsp stat get is success.
+*
+* @notes    Counters are read as last synced to the SDK, the stat ids
+*           of the realm are synced by the caller.
+*
+*
+*********************************************************************/
+static BVIEW_STATUS sbplugin_sim_bst_epsp_data_read (int asic,
+                                BVIEW_BST_EGRESS_PORT_SP_DATA_t *data,
+                                BVIEW_TIME_t *time)
+{
+  sbplugin_sim_system_time_get (time);
+
+  BVIEW_SIM_BST_STAT_BULK_GET (asic, BVIEW_BST_STAT_EGR_PORT_SP_UC_SHARED,
+                               simAsicDb[asic].scalingParams.numPorts,
+                               BVIEW_ASIC_MAX_SERVICE_POOLS,
+                               &data->data[0][0].ucShareBufferCount,
+                               BVIEW_SIM_BST_STRIDE (data->data[0]),
+                               BVIEW_SIM_BST_STRIDE (data->data[0][0]));
+  BVIEW_SIM_BST_STAT_BULK_GET (asic, BVIEW_BST_STAT_EGR_PORT_SP_SHARED,
+                               simAsicDb[asic].scalingParams.numPorts,
+                               BVIEW_ASIC_MAX_SERVICE_POOLS,
+                               &data->data[0][0].umShareBufferCount,
+                               BVIEW_SIM_BST_STRIDE (data->data[0]),
+                               BVIEW_SIM_BST_STRIDE (data->data[0][0]));
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief  Obtain Egress Port + Service Pools Statistics
+*
+* @param[in]   asic             - unit
+* @param[out]  data             - e_p_sp data structure
+* @param[out]  time             - time
+*
+* @retval BVIEW_STATUS_INVALID_PARAMETER if input data is invalid.
+* @retval BVIEW_STATUS_FAILURE           if epsp stat get is failed.
+* @retval BVIEW_STATUS_SUCCESS           if epsp stat get is success.
+*
+* @notes    none
+*
+*
+*********************************************************************/
+static BVIEW_STATUS sbplugin_sim_bst_epsp_data_get (int asic,
+                                BVIEW_BST_EGRESS_PORT_SP_DATA_t *data,
+                                BVIEW_TIME_t *time)
+{
+  BVIEW_SIM_BST_INPUT_VALIDATE (asic, data, time);
+
+  BVIEW_SIM_BST_REALM_SYNC (asic, BVIEW_BST_REALM_EGRESS_PORT_SP);
+
+  return sbplugin_sim_bst_epsp_data_read (asic, data, time);
+}
+
+/*********************************************************************
+* @brief  Read Egress Service Pools Statistics
+*
+* @param[in]   asic             - unit
+* @param[out]  data             - e_sp data structure
+* @param[out]  time             - time
+*
+* @retval BVIEW_STATUS_FAILURE           if esp stat get is failed.
+* @retval BVIEW_STATUS_SUCCESS           if esp stat get is success.
+*
+* @notes    Counters are read as last synced to the SDK, the stat ids
+*           of the realm are synced by the caller.
+*
+*
+*********************************************************************/
+static BVIEW_STATUS sbplugin_sim_bst_esp_data_read (int asic,
+                               BVIEW_BST_EGRESS_SP_DATA_t *data,
+                               BVIEW_TIME_t *time)
+{
+  sbplugin_sim_system_time_get (time);
+
+  BVIEW_SIM_BST_STAT_BULK_GET (asic, BVIEW_BST_STAT_EGR_SP_SHARED, 1,
+                               BVIEW_ASIC_MAX_SERVICE_POOLS,
+                               &data->data[0].umShareBufferCount, 0,
+                               BVIEW_SIM_BST_STRIDE (data->data[0]));
+  BVIEW_SIM_BST_STAT_BULK_GET (asic, BVIEW_BST_STAT_EGR_SP_MC_SHARED, 1,
+                               BVIEW_ASIC_MAX_SERVICE_POOLS,
+                               &data->data[0].mcShareBufferCount, 0,
+                               BVIEW_SIM_BST_STRIDE (data->data[0]));
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief  Obtain Egress Service Pools Statistics
+*
+* @param[in]   asic             - unit
+* @param[out]  data             - e_sp data structure
+* @param[out]  time             - time
+*
+* @retval BVIEW_STATUS_INVALID_PARAMETER if input data is invalid.
+* @retval BVIEW_STATUS_FAILURE           if esp stat get is failed.
+* @retval BVIEW_STATUS_SUCCESS           if esp stat get is success.
+*
+* @notes    none
+*
+*
+*********************************************************************/
+static BVIEW_STATUS sbplugin_sim_bst_esp_data_get (int asic,
+                               BVIEW_BST_EGRESS_SP_DATA_t *data,
+                               BVIEW_TIME_t *time)
+{
+  BVIEW_SIM_BST_INPUT_VALIDATE (asic, data, time);
+
+  BVIEW_SIM_BST_REALM_SYNC (asic, BVIEW_BST_REALM_EGRESS_SP);
+
+  return sbplugin_sim_bst_esp_data_read (asic, data, time);
+}
+
+/*********************************************************************
+* @brief  Read Egress Egress Unicast Queues Statistics
+*
+* @param[in]   asic             - unit
+* @param[out]  data             - e_uc_q data structure
+* @param[out]  time             - time
+*
+* @retval BVIEW_STATUS_FAILURE           if eucq stat get is failed.
+* @retval BVIEW_STATUS_SUCCESS           if eucq stat get is success.
+*
+* @notes    Counters are read as last synced to the SDK, the stat ids
+*           of the realm are synced by the caller.
+*
+*
+*********************************************************************/
+static BVIEW_STATUS sbplugin_sim_bst_eucq_data_read (int asic,
+                              BVIEW_BST_EGRESS_UC_QUEUE_DATA_t *data,
+                              BVIEW_TIME_t *time)
+{
+  unsigned int port = 0, cosq = 0;
+  BVIEW_SIM_QUEUE_RANGE_t range;
+
+  sbplugin_sim_system_time_get (time);
+
+  BVIEW_SIM_BST_STAT_BULK_GET (asic, BVIEW_BST_STAT_EGR_UC_QUEUE,
+                               simAsicDb[asic].scalingParams.numPorts,
+                               sbSimConfig.numCosPerPort,
+                               &data->data[0].ucBufferCount,
+                               sbSimConfig.numCosPerPort * BVIEW_SIM_BST_STRIDE (data->data[0]),
+                               BVIEW_SIM_BST_STRIDE (data->data[0]));
+
+  /* Port of each queue, from the queue range of the port*/
+  BVIEW_SIM_BST_PORT_ITER (asic, port)
+  {
+    range = BVIEW_SIM_PORT_UC_QUEUES (asic, port);
+    for (cosq = 0; cosq < range.count; cosq++)
+    {
+      data->data[range.first + cosq].port = port;
+    }
+  }
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief  Obtain Egress Egress Unicast Queues Statistics
+*
+* @param[in]   asic             - unit
+* @param[out]  data             - e_uc_q data structure
+* @param[out]  time             - time
+*
+* @retval BVIEW_STATUS_INVALID_PARAMETER if input data is invalid.
+* @retval BVIEW_STATUS_FAILURE           if eucq stat get is failed.
+* @retval BVIEW_STATUS_SUCCESS           if eucq stat get is success.
+*
+* @notes    none
+*
+*
+*********************************************************************/
+static BVIEW_STATUS sbplugin_sim_bst_eucq_data_get (int asic,
+                              BVIEW_BST_EGRESS_UC_QUEUE_DATA_t *data,
+                              BVIEW_TIME_t *time)
+{
+  BVIEW_SIM_BST_INPUT_VALIDATE (asic, data, time);
+
+  BVIEW_SIM_BST_REALM_SYNC (asic, BVIEW_BST_REALM_EGRESS_UC_QUEUE);
+
+  return sbplugin_sim_bst_eucq_data_read (asic, data, time);
+}
+
+/*********************************************************************
+* @brief  Read Egress Egress Unicast Queue Groups Statistics
+*
+* @param[in]   asic             - unit
+* @param[out]  data             - e_uc_qg data structure
+* @param[out]  time             - time
+*
+* @retval BVIEW_STATUS_FAILURE           if eucqg stat get is failed.
+* @retval BVIEW_STATUS_SUCCESS           if eucqg stat get is success.
+*
+* @notes    Counters are read as last synced to the SDK, the stat ids
+*           of the realm are synced by the caller.
+*
+*
+*********************************************************************/
+static BVIEW_STATUS sbplugin_sim_bst_eucqg_data_read (int asic,
+                        BVIEW_BST_EGRESS_UC_QUEUEGROUPS_DATA_t *data,
+                        BVIEW_TIME_t *time)
+{
+  sbplugin_sim_system_time_get (time);
+
+  BVIEW_SIM_BST_STAT_BULK_GET (asic, BVIEW_BST_STAT_EGR_UC_QUEUE_GROUP, 1,
+                               BVIEW_ASIC_MAX_UC_QUEUE_GROUPS,
+                               &data->data[0].ucBufferCount, 0,
+                               BVIEW_SIM_BST_STRIDE (data->data[0]));
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief  Obtain Egress Egress Unicast Queue Groups Statistics
+*
+* @param[in]   asic             - unit
+* @param[out]  data             - e_uc_qg data structure
+* @param[out]  time             - time
+*
+* @retval BVIEW_STATUS_INVALID_PARAMETER if input data is invalid.
+* @retval BVIEW_STATUS_FAILURE           if eucqg stat get is failed.
+* @retval BVIEW_STATUS_SUCCESS           if eucqg stat get is success.
+*
+* @notes    none
+*
+*
+*********************************************************************/
+static BVIEW_STATUS sbplugin_sim_bst_eucqg_data_get (int asic,
+                        BVIEW_BST_EGRESS_UC_QUEUEGROUPS_DATA_t *data,
+                        BVIEW_TIME_t *time)
+{
+  BVIEW_SIM_BST_INPUT_VALIDATE (asic, data, time);
+
+  BVIEW_SIM_BST_REALM_SYNC (asic, BVIEW_BST_REALM_EGRESS_UC_QUEUEGROUPS);
+
+  return sbplugin_sim_bst_eucqg_data_read (asic, data, time);
+}
+
+/*********************************************************************
+* @brief  Read Egress Egress Multicast Queues Statistics
+*
+* @param[in]   asic             - unit
+* @param[out]  data             - e_mc_q data structure
+* @param[out]  time             - time
+*
+* @retval BVIEW_STATUS_FAILURE           if emcq stat get is failed.
+* @retval BVIEW_STATUS_SUCCESS           if emcq stat get is success.
+*
+* @notes    Counters are read as last synced to the SDK, the stat ids
+*           of the realm are synced by the caller.
+*
+*
+*********************************************************************/
+static BVIEW_STATUS sbplugin_sim_bst_emcq_data_read (int asic,
+                              BVIEW_BST_EGRESS_MC_QUEUE_DATA_t *data,
+                              BVIEW_TIME_t *time)
+{
+  unsigned int port = 0, cosq = 0;
+  BVIEW_SIM_QUEUE_RANGE_t range;
+
+  sbplugin_sim_system_time_get (time);
+
+  BVIEW_SIM_BST_STAT_BULK_GET (asic, BVIEW_BST_STAT_EGR_MC_QUEUE,
+                               simAsicDb[asic].scalingParams.numPorts,
+                               sbSimConfig.numCosPerPort,
+                               &data->data[0].mcBufferCount,
+                               sbSimConfig.numCosPerPort * BVIEW_SIM_BST_STRIDE (data->data[0]),
+                               BVIEW_SIM_BST_STRIDE (data->data[0]));
+
+  /* Port of each queue, from the queue range of the port*/
+  BVIEW_SIM_BST_PORT_ITER (asic, port)
+  {
+    range = BVIEW_SIM_PORT_MC_QUEUES (asic, port);
+    for (cosq = 0; cosq < range.count; cosq++)
+    {
+      data->data[range.first + cosq].port = port;
+    }
+  }
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief  Obtain Egress Egress Multicast Queues Statistics
+*
+* @param[in]   asic             - unit
+* @param[out]  data             - e_mc_q data structure
+* @param[out]  time             - time
+*
+* @retval BVIEW_STATUS_INVALID_PARAMETER if input data is invalid.
+* @retval BVIEW_STATUS_FAILURE           if emcq stat get is failed.
+* @retval BVIEW_STATUS_SUCCESS           if emcq stat get is success.
+*
+* @notes    none
+*
+*
+*********************************************************************/
+static BVIEW_STATUS sbplugin_sim_bst_emcq_data_get (int asic,
+                              BVIEW_BST_EGRESS_MC_QUEUE_DATA_t *data,
+                              BVIEW_TIME_t *time)
+{
+  BVIEW_SIM_BST_INPUT_VALIDATE (asic, data, time);
+
+  BVIEW_SIM_BST_REALM_SYNC (asic, BVIEW_BST_REALM_EGRESS_MC_QUEUE);
+
+  return sbplugin_sim_bst_emcq_data_read (asic, data, time);
+}
+
+/*********************************************************************
+* @brief  Read Egress Egress CPU Queues Statistics
+*
+* @param[in]   asic             - unit
+* @param[out]  data             - CPU queue data structure
+* @param[out]  time             - time
+*
+* @retval BVIEW_STATUS_FAILURE           if CPU stat get is failed.
+* @retval BVIEW_STATUS_SUCCESS           if CPU stat get is success.
+*
+* @notes    CPU queues are kept in the MC queue table of the CPU port.
+*
+*
+*********************************************************************/
+static BVIEW_STATUS sbplugin_sim_bst_cpuq_data_read (int asic,
+                             BVIEW_BST_EGRESS_CPU_QUEUE_DATA_t *data,
+                             BVIEW_TIME_t *time)
+{
+  sbplugin_sim_system_time_get (time);
+
+  BVIEW_SIM_BST_STAT_BULK_GET (asic, BVIEW_BST_STAT_EGR_CPU_QUEUE, 1,
+                               BVIEW_ASIC_MAX_CPU_QUEUES,
+                               &data->data[0].cpuBufferCount, 0,
+                               BVIEW_SIM_BST_STRIDE (data->data[0]));
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief  Obtain Egress Egress CPU Queues Statistics
+*
+* @param[in]   asic             - unit
+* @param[out]  data             - CPU queue data structure
+* @param[out]  time             - time
+*
+* @retval BVIEW_STATUS_INVALID_PARAMETER if input data is invalid.
+* @retval BVIEW_STATUS_FAILURE           if CPU stat get is failed.
+* @retval BVIEW_STATUS_SUCCESS           if CPU stat get is success.
+*
+* @notes    CPU queues are kept in the MC queue table of the CPU port.
+*
+*
+*********************************************************************/
+static BVIEW_STATUS sbplugin_sim_bst_cpuq_data_get (int asic,
+                             BVIEW_BST_EGRESS_CPU_QUEUE_DATA_t *data,
+                             BVIEW_TIME_t *time)
+{
+  BVIEW_SIM_BST_INPUT_VALIDATE (asic, data, time);
+
+  BVIEW_SIM_BST_REALM_SYNC (asic, BVIEW_BST_REALM_EGRESS_CPU_QUEUE);
+
+  return sbplugin_sim_bst_cpuq_data_read (asic, data, time);
+}
+
+/*********************************************************************
+* @brief  Read Egress Egress RQE Queues Statistics
+*
+* @param[in]   asic             - unit
+* @param[out]  data             - RQE data data structure
+* @param[out]  time             - time
+*
+* @retval BVIEW_STATUS_FAILURE           if RQE stat get is failed.
+* @retval BVIEW_STATUS_SUCCESS           if RQE stat get is success.
+*
+* @notes    Counters are read as last synced to the SDK, the stat ids
+*           of the realm are synced by the caller.
+*
+*
+*********************************************************************/
+static BVIEW_STATUS sbplugin_sim_bst_rqeq_data_read (int asic,
+                                   BVIEW_BST_EGRESS_RQE_QUEUE_DATA_t *data,
+                                   BVIEW_TIME_t *time)
+{
+  sbplugin_sim_system_time_get (time);
+
+  BVIEW_SIM_BST_STAT_BULK_GET (asic, BVIEW_BST_STAT_EGR_RQE_QUEUE, 1,
+                               BVIEW_ASIC_MAX_RQE_QUEUES,
+                               &data->data[0].rqeBufferCount, 0,
+                               BVIEW_SIM_BST_STRIDE (data->data[0]));
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief  Obtain Egress Egress RQE Queues Statistics
+*
+* @param[in]   asic             - unit
+* @param[out]  data             - RQE data data structure
+* @param[out]  time             - time
+*
+* @retval BVIEW_STATUS_INVALID_PARAMETER if input data is invalid.
+* @retval BVIEW_STATUS_FAILURE           if RQE stat get is failed.
+* @retval BVIEW_STATUS_SUCCESS           if RQE stat get is success.
+*
+* @notes    none
+*
+*
+*********************************************************************/
+static BVIEW_STATUS sbplugin_sim_bst_rqeq_data_get (int asic,
+                                   BVIEW_BST_EGRESS_RQE_QUEUE_DATA_t *data,
+                                   BVIEW_TIME_t *time)
+{
+  BVIEW_SIM_BST_INPUT_VALIDATE (asic, data, time);
+
+  BVIEW_SIM_BST_REALM_SYNC (asic, BVIEW_BST_REALM_EGRESS_RQE_QUEUE);
+
+  return sbplugin_sim_bst_rqeq_data_read (asic, data, time);
+}
+
+/*********************************************************************
+* @brief  Obtain Statistics of one realm of the snapshot
+*
+* @param[in]      asic               - unit
+* @param[in]      realm              - realm to be read
+* @param[out]     snapshot           - snapshot data structure
+* @param[out]     time               - time
+*
+* @retval BVIEW_STATUS_INVALID_PARAMETER if realm is invalid.
+* @retval BVIEW_STATUS_FAILURE           if realm stat get is failed.
+* @retval BVIEW_STATUS_SUCCESS           if realm stat get is success.
+*
+* @notes    Only the section of the snapshot owned by the realm is
+*           written. Realms can be read concurrently. The stat ids of
+*           the realm are not synced, the caller syncs them.
+*
+*
+*********************************************************************/
+BVIEW_STATUS sbplugin_sim_bst_realm_get (int asic,
+                                 BVIEW_BST_REALM_t realm,
+                                 BVIEW_BST_ASIC_SNAPSHOT_DATA_t *snapshot,
+                                 BVIEW_TIME_t *time)
+{
+  switch (realm)
+  {
+    case BVIEW_BST_REALM_DEVICE:
+      return sbplugin_sim_bst_device_data_read (asic, &snapshot->device, time);
+    case BVIEW_BST_REALM_INGRESS_PORT_PG:
+      return sbplugin_sim_bst_ippg_data_read (asic, &snapshot->iPortPg, time);
+    case BVIEW_BST_REALM_INGRESS_PORT_SP:
+      return sbplugin_sim_bst_ipsp_data_read (asic, &snapshot->iPortSp, time);
+    case BVIEW_BST_REALM_INGRESS_SP:
+      return sbplugin_sim_bst_isp_data_read (asic, &snapshot->iSp, time);
+    case BVIEW_BST_REALM_EGRESS_PORT_SP:
+      return sbplugin_sim_bst_epsp_data_read (asic, &snapshot->ePortSp, time);
+    case BVIEW_BST_REALM_EGRESS_SP:
+      return sbplugin_sim_bst_esp_data_read (asic, &snapshot->eSp, time);
+    case BVIEW_BST_REALM_EGRESS_UC_QUEUE:
+      return sbplugin_sim_bst_eucq_data_read (asic, &snapshot->eUcQ, time);
+    case BVIEW_BST_REALM_EGRESS_UC_QUEUEGROUPS:
+      return sbplugin_sim_bst_eucqg_data_read (asic, &snapshot->eUcQg, time);
+    case BVIEW_BST_REALM_EGRESS_MC_QUEUE:
+      return sbplugin_sim_bst_emcq_data_read (asic, &snapshot->eMcQ, time);
+    case BVIEW_BST_REALM_EGRESS_CPU_QUEUE:
+      return sbplugin_sim_bst_cpuq_data_read (asic, &snapshot->cpqQ, time);
+    case BVIEW_BST_REALM_EGRESS_RQE_QUEUE:
+      return sbplugin_sim_bst_rqeq_data_read (asic, &snapshot->rqeQ, time);
+    default:
+      return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+}
+
+/*********************************************************************
+* @brief  Obtain Complete ASIC Statistics Report
+*
+* @param[in]      asic               - unit
+* @param[in]      realmMask          - mask of realms to be read
+* @param[out]     snapshot           - snapshot data structure
+* @param[out]     time               - time
+* @param[out]     realmTime          - sampling window of every realm
+*                                      read, can be NULL
+*
+* @retval BVIEW_STATUS_INVALID_PARAMETER if input data is invalid.
+* @retval BVIEW_STATUS_FAILURE           if snapshot get is failed.
+* @retval BVIEW_STATUS_SUCCESS           if snapshot get is success.
+*
+* @notes    Realms not in realmMask are neither synced nor read.
+*           The stat ids of the realms are synced once per snapshot.
+*           With more than one collection worker configured the
+*           realms are read in parallel.
+*
+*
+*********************************************************************/
+static BVIEW_STATUS sbplugin_sim_bst_snapshot_get (int asic,
+                                 BVIEW_BST_REALM_MASK_t realmMask,
+                                 BVIEW_BST_ASIC_SNAPSHOT_DATA_t *snapshot,
+                                 BVIEW_TIME_t *time,
+                                 BVIEW_BST_REALM_TIME_t *realmTime)
+{
+  BVIEW_SIM_BST_INPUT_VALIDATE (asic, snapshot, time);
+
+  return sbplugin_bst_collect_cycle (asic, realmMask, snapshot, time,
+                                     realmTime);
+}
+
+/*********************************************************************
+* @brief  Set profile configuration for Device Statistics
+*
+* @param[in]  asic               - unit
+* @param[in]  thres              - Device threshold data structure
+*
+* @retval BVIEW_STATUS_INVALID_PARAMETER if input data is invalid.
+* @retval BVIEW_STATUS_SUCCESS           if threshold set is success.
+*
+* @notes    none
+*
+*
+*********************************************************************/
+static BVIEW_STATUS sbplugin_sim_bst_device_threshold_set (int asic,
+                                     BVIEW_BST_DEVICE_THRESHOLD_t *thres)
+{
+  BVIEW_SIM_UNIT_CHECK (asic);
+
+  if (thres == NULL ||
+      BVIEW_BST_DEVICE_THRESHOLD_CHECK (thres))
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+
+  BVIEW_SIM_BST_PROFILE_SET (asic, 0, 0, BVIEW_SIM_BST_STAT_ID_DEVICE,
+                             thres->threshold);
+  /* Write through to the threshold shadow*/
+  BVIEW_SIM_BST_SHADOW_SET (asic, true, device.bufferCount, thres->threshold);
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief  Set profile configuration for
+*           Ingress Port + Priority Groups Statistics
+*
+* @param[in]  asic              - unit
+* @param[in]  port              - port
+* @param[in]  pg                - Priority Group
+* @param[in]  thres             - Threshold structure
+*
+* @retval BVIEW_STATUS_INVALID_PARAMETER if input data is invalid.
+* @retval BVIEW_STATUS_SUCCESS           if threshold set is success.
+*
+* @notes    none
+*
+*
+*********************************************************************/
+static BVIEW_STATUS sbplugin_sim_bst_ippg_threshold_set (int asic, int port, int pg,
+                                     BVIEW_BST_INGRESS_PORT_PG_THRESHOLD_t *thres)
+{
+  BVIEW_SIM_UNIT_CHECK (asic);
+
+  if (thres == NULL ||
+      BVIEW_BST_IPPG_SHRD_THRESHOLD_CHECK (thres) ||
+      BVIEW_BST_IPPG_HDRM_THRESHOLD_CHECK (thres))
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+
+  BVIEW_SIM_BST_PROFILE_SET (asic, port, pg, BVIEW_SIM_BST_STAT_ID_PRI_GROUP_SHARED,
+                             thres->umShareThreshold);
+  BVIEW_SIM_BST_PROFILE_SET (asic, port, pg, BVIEW_SIM_BST_STAT_ID_PRI_GROUP_HEADROOM,
+                             thres->umHeadroomThreshold);
+  /* Write through to the threshold shadow*/
+  BVIEW_SIM_BST_SHADOW_SET (asic, BVIEW_SIM_BST_SHADOW_PORT_RANGE (port, pg, BVIEW_ASIC_MAX_PRIORITY_GROUPS),
+                            iPortPg.data[port - 1][pg].umShareBufferCount,
+                            thres->umShareThreshold);
+  BVIEW_SIM_BST_SHADOW_SET (asic, BVIEW_SIM_BST_SHADOW_PORT_RANGE (port, pg, BVIEW_ASIC_MAX_PRIORITY_GROUPS),
+                            iPortPg.data[port - 1][pg].umHeadroomBufferCount,
+                            thres->umHeadroomThreshold);
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief  Set profile configuration for Ingress Port + Service Pools
+*           Statistics
+*
+* @param[in] asic                     - unit
+* @param[in] port                     - port
+* @param[in] sp                       - service pool
+* @param[in] thres                    - Threshold data structure
+*
+* @retval BVIEW_STATUS_INVALID_PARAMETER if input data is invalid.
+* @retval BVIEW_STATUS_SUCCESS           if threshold set is success.
+*
+* @notes    none
+*
+*
+*********************************************************************/
+static BVIEW_STATUS sbplugin_sim_bst_ipsp_threshold_set (int asic, int port, int sp,
+                                      BVIEW_BST_INGRESS_PORT_SP_THRESHOLD_t *thres)
+{
+  BVIEW_SIM_UNIT_CHECK (asic);
+
+  if (thres == NULL ||
+      BVIEW_BST_IPSP_THRESHOLD_CHECK (thres))
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+
+  BVIEW_SIM_BST_PROFILE_SET (asic, port, sp, BVIEW_SIM_BST_STAT_ID_PORT_POOL,
+                             thres->umShareThreshold);
+  /* Write through to the threshold shadow*/
+  BVIEW_SIM_BST_SHADOW_SET (asic, BVIEW_SIM_BST_SHADOW_PORT_RANGE (port, sp, BVIEW_ASIC_MAX_SERVICE_POOLS),
+                            iPortSp.data[port - 1][sp].umShareBufferCount,
+                            thres->umShareThreshold);
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief  Set profile configuration for Ingress Service Pools
+*           Statistics
+*
+* @param[in] asic                     - unit
+* @param[in] sp                       - service pool
+* @param[in] thres                    - Threshold data structure
+*
+* @retval BVIEW_STATUS_INVALID_PARAMETER if input data is invalid.
+* @retval BVIEW_STATUS_SUCCESS           if threshold set is success.
+*
+* @notes    none
+*
+*
+*********************************************************************/
+static BVIEW_STATUS sbplugin_sim_bst_isp_threshold_set (int asic, int sp,
+                                     BVIEW_BST_INGRESS_SP_THRESHOLD_t *thres)
+{
+  BVIEW_SIM_UNIT_CHECK (asic);
+
+  if (thres == NULL ||
+      BVIEW_BST_ISP_THRESHOLD_CHECK (thres))
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+
+  BVIEW_SIM_BST_PROFILE_SET (asic, 0, sp, BVIEW_SIM_BST_STAT_ID_ING_POOL,
+                             thres->umShareThreshold);
+  /* Write through to the threshold shadow*/
+  BVIEW_SIM_BST_SHADOW_SET (asic, BVIEW_SIM_BST_SHADOW_INDEX_RANGE (sp, BVIEW_ASIC_MAX_SERVICE_POOLS),
+                            iSp.data[sp].umShareBufferCount, thres->umShareThreshold);
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief  Set profile configuration for Egress Port + Service Pools
+*           Statistics
+*
+* @param[in] asic                     - unit
+* @param[in] port                     - port
+* @param[in] sp                       - service pool
+* @param[in] thres                    - Threshold data structure
+*
+* @retval BVIEW_STATUS_INVALID_PARAMETER if input data is invalid.
+* @retval BVIEW_STATUS_SUCCESS           if threshold set is success.
+*
+* @notes    none
+*
+*
+*********************************************************************/
+static BVIEW_STATUS sbplugin_sim_bst_epsp_threshold_set (int asic, int port, int sp,
+                                      BVIEW_BST_EGRESS_PORT_SP_THRESHOLD_t *thres)
+{
+  BVIEW_SIM_UNIT_CHECK (asic);
+
+  if (thres == NULL ||
+      BVIEW_BST_EPSP_UC_THRESHOLD_CHECK (thres) ||
+      BVIEW_BST_EPSP_UM_THRESHOLD_CHECK (thres))
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+
+  BVIEW_SIM_BST_PROFILE_SET (asic, port, sp, BVIEW_SIM_BST_STAT_ID_EGR_UCAST_PORT_SHARED,
+                             thres->ucShareThreshold);
+  BVIEW_SIM_BST_PROFILE_SET (asic, port, sp, BVIEW_SIM_BST_STAT_ID_EGR_PORT_SHARED,
+                             thres->umShareThreshold);
+  /* Write through to the threshold shadow*/
+  BVIEW_SIM_BST_SHADOW_SET (asic, BVIEW_SIM_BST_SHADOW_PORT_RANGE (port, sp, BVIEW_ASIC_MAX_SERVICE_POOLS),
+                            ePortSp.data[port - 1][sp].ucShareBufferCount,
+                            thres->ucShareThreshold);
+  BVIEW_SIM_BST_SHADOW_SET (asic, BVIEW_SIM_BST_SHADOW_PORT_RANGE (port, sp, BVIEW_ASIC_MAX_SERVICE_POOLS),
+                            ePortSp.data[port - 1][sp].umShareBufferCount,
+                            thres->umShareThreshold);
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief  Set profile configuration for Egress Service Pools
+*           Statistics
+*
+* @param[in] asic                     - unit
+* @param[in] sp                       - service pool
+* @param[in] thres                    - Threshold data structure
+*
+* @retval BVIEW_STATUS_INVALID_PARAMETER if input data is invalid.
+* @retval BVIEW_STATUS_SUCCESS           if threshold set is success.
+*
+* @notes    none
+*
+*
+*********************************************************************/
+static BVIEW_STATUS sbplugin_sim_bst_esp_threshold_set (int asic, int sp,
+                                     BVIEW_BST_EGRESS_SP_THRESHOLD_t *thres)
+{
+  BVIEW_SIM_UNIT_CHECK (asic);
+
+  if (thres == NULL ||
+      BVIEW_BST_E_SP_UM_THRESHOLD_CHECK (thres) ||
+      BVIEW_BST_E_SP_MC_THRESHOLD_CHECK (thres))
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+
+  BVIEW_SIM_BST_PROFILE_SET (asic, 0, sp, BVIEW_SIM_BST_STAT_ID_EGR_POOL,
+                             thres->umShareThreshold);
+  BVIEW_SIM_BST_PROFILE_SET (asic, 0, sp, BVIEW_SIM_BST_STAT_ID_EGR_MCAST_POOL,
+                             thres->mcShareThreshold);
+  /* Write through to the threshold shadow*/
+  BVIEW_SIM_BST_SHADOW_SET (asic, BVIEW_SIM_BST_SHADOW_INDEX_RANGE (sp, BVIEW_ASIC_MAX_SERVICE_POOLS),
+                            eSp.data[sp].umShareBufferCount, thres->umShareThreshold);
+  BVIEW_SIM_BST_SHADOW_SET (asic, BVIEW_SIM_BST_SHADOW_INDEX_RANGE (sp, BVIEW_ASIC_MAX_SERVICE_POOLS),
+                            eSp.data[sp].mcShareBufferCount, thres->mcShareThreshold);
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief  Set profile configuration for Egress Unicast Queues
+*           Statistics
+*
+* @param[in] asic                        - unit
+* @param[in] ucQueue                     - uc queue
+* @param[in] thres                       - Threshold data structure
+*
+* @retval BVIEW_STATUS_INVALID_PARAMETER if input data is invalid.
+* @retval BVIEW_STATUS_SUCCESS           if threshold set is success.
+*
+* @notes    none
+*
+*
+*********************************************************************/
+static BVIEW_STATUS sbplugin_sim_bst_eucq_threshold_set (int asic,
+                                      int ucQueue,
+                              BVIEW_BST_EGRESS_UC_QUEUE_THRESHOLD_t *thres)
+{
+  BVIEW_SIM_UNIT_CHECK (asic);
+
+  if (thres == NULL || ucQueue < 0 ||
+      BVIEW_BST_E_UC_THRESHOLD_CHECK (thres))
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+
+  BVIEW_SIM_BST_PROFILE_SET (asic, (ucQueue / sbSimConfig.numCosPerPort) + 1,
+                             ucQueue % sbSimConfig.numCosPerPort,
+                             BVIEW_SIM_BST_STAT_ID_UCAST,
+                             thres->ucBufferThreshold);
+  /* Write through to the threshold shadow*/
+  BVIEW_SIM_BST_SHADOW_SET (asic, BVIEW_SIM_BST_SHADOW_INDEX_RANGE (ucQueue, BVIEW_ASIC_MAX_UC_QUEUES),
+                            eUcQ.data[ucQueue].ucBufferCount, thres->ucBufferThreshold);
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief  Set profile configuration for Egress Unicast Queue Groups
+*           Statistics
+*
+* @param[in]asic                          -unit
+* @param[in]ucQueueGrp                    -uc queue group
+* @param[in]thres                         -Threshold data structure
+*
+* @retval BVIEW_STATUS_INVALID_PARAMETER if input data is invalid.
+* @retval BVIEW_STATUS_SUCCESS           if threshold set is success.
+*
+* @notes    none
+*
+*
+*********************************************************************/
+static BVIEW_STATUS sbplugin_sim_bst_eucqg_threshold_set (int asic,
+                                       int ucQueueGrp,
+                                       BVIEW_BST_EGRESS_UC_QUEUEGROUPS_THRESHOLD_t *thres)
+{
+  BVIEW_SIM_UNIT_CHECK (asic);
+
+  if (thres == NULL ||
+      BVIEW_BST_E_UC_GRP_THRESHOLD_CHECK (thres))
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+
+  BVIEW_SIM_BST_PROFILE_SET (asic, 0, ucQueueGrp, BVIEW_SIM_BST_STAT_ID_UCAST_GROUP,
+                             thres->ucBufferThreshold);
+  /* Write through to the threshold shadow*/
+  BVIEW_SIM_BST_SHADOW_SET (asic, BVIEW_SIM_BST_SHADOW_INDEX_RANGE (ucQueueGrp, BVIEW_ASIC_MAX_UC_QUEUE_GROUPS),
+                            eUcQg.data[ucQueueGrp].ucBufferCount, thres->ucBufferThreshold);
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief  Set profile configuration for Egress Multicast Queues
+*           Statistics
+*
+* @param[in] asic                     - unit
+* @param[in] mcQueue                  - mcQueue
+* @param[in] thres                    - Threshold data structure
+*
+* @retval BVIEW_STATUS_INVALID_PARAMETER if input data is invalid.
+* @retval BVIEW_STATUS_SUCCESS           if threshold set is success.
+*
+* @notes    none
+*
+*
+*********************************************************************/
+static BVIEW_STATUS sbplugin_sim_bst_emcq_threshold_set (int asic,
+                                      int mcQueue,
+                                      BVIEW_BST_EGRESS_MC_QUEUE_THRESHOLD_t *thres)
+{
+  BVIEW_SIM_UNIT_CHECK (asic);
+
+  if (thres == NULL || mcQueue < 0 ||
+      BVIEW_BST_E_MC_THRESHOLD_CHECK (thres) ||
+      BVIEW_BST_E_MC_QUEUE_THRESHOLD_CHECK (thres))
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+
+  BVIEW_SIM_BST_PROFILE_SET (asic, (mcQueue / sbSimConfig.numCosPerPort) + 1,
+                             mcQueue % sbSimConfig.numCosPerPort,
+                             BVIEW_SIM_BST_STAT_ID_MCAST,
+                             thres->mcBufferThreshold);
+  /* Write through to the threshold shadow*/
+  BVIEW_SIM_BST_SHADOW_SET (asic, BVIEW_SIM_BST_SHADOW_INDEX_RANGE (mcQueue, BVIEW_ASIC_MAX_MC_QUEUES),
+                            eMcQ.data[mcQueue].mcBufferCount, thres->mcBufferThreshold);
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief  Set profile configuration for Egress Egress CPU Queues
+*           Statistics
+*
+* @param[in] asic                        - unit
+* @param[in] cpuQueue                    - cpuQueue
+* @param[in] thres                       - Threshold data structure
+*
+* @retval BVIEW_STATUS_INVALID_PARAMETER if input data is invalid.
+* @retval BVIEW_STATUS_SUCCESS           if threshold set is success.
+*
+* @notes    none
+*
+*
+*********************************************************************/
+static BVIEW_STATUS sbplugin_sim_bst_cpuq_threshold_set (int asic,
+                                      int cpuQueue,
+                                      BVIEW_BST_EGRESS_CPU_QUEUE_THRESHOLD_t *thres)
+{
+  BVIEW_SIM_UNIT_CHECK (asic);
+
+  if (thres == NULL ||
+      BVIEW_BST_E_CPU_THRESHOLD_CHECK (thres))
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+
+  BVIEW_SIM_BST_PROFILE_SET (asic, BVIEW_SIM_BST_CPU_PORT, cpuQueue,
+                             BVIEW_SIM_BST_STAT_ID_MCAST,
+                             thres->cpuBufferThreshold);
+  /* Write through to the threshold shadow*/
+  BVIEW_SIM_BST_SHADOW_SET (asic, BVIEW_SIM_BST_SHADOW_INDEX_RANGE (cpuQueue, BVIEW_ASIC_MAX_CPU_QUEUES),
+                            cpqQ.data[cpuQueue].cpuBufferCount, thres->cpuBufferThreshold);
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief  Set profile configuration for Egress Egress RQE Queues
+*           Statistics
+*
+* @param[in]    asic                   - unit
+* @param[in]    rqeQueue               - rqeQueue
+* @param[in]    thres                  - Threshold data structure
+*
+* @retval BVIEW_STATUS_INVALID_PARAMETER if input data is invalid.
+* @retval BVIEW_STATUS_SUCCESS           if threshold set is success.
+*
+* @notes    none
+*
+*
+*********************************************************************/
+static BVIEW_STATUS sbplugin_sim_bst_rqeq_threshold_set (int asic,
+                                     int rqeQueue,
+                                     BVIEW_BST_EGRESS_RQE_QUEUE_THRESHOLD_t *thres)
+{
+  BVIEW_SIM_UNIT_CHECK (asic);
+
+  if (thres == NULL ||
+      BVIEW_BST_E_RQE_THRESHOLD_CHECK (thres))
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+
+  BVIEW_SIM_BST_PROFILE_SET (asic, 0, rqeQueue, BVIEW_SIM_BST_STAT_ID_RQE_QUEUE,
+                             thres->rqeBufferThreshold);
+  /* Write through to the threshold shadow*/
+  BVIEW_SIM_BST_SHADOW_SET (asic, BVIEW_SIM_BST_SHADOW_INDEX_RANGE (rqeQueue, BVIEW_ASIC_MAX_RQE_QUEUES),
+                            rqeQ.data[rqeQueue].rqeBufferCount, thres->rqeBufferThreshold);
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief  Set threshold configuration of many realm entries in
+*         one batch
+*
+* @param[in]     asic                   - unit
+* @param[in,out] entries                - Realm entries and thresholds,
+*                                         status of each entry
+* @param[in]     numEntries             - Number of entries
+*
+* @retval BVIEW_STATUS_INVALID_PARAMETER if input data is invalid.
+* @retval BVIEW_STATUS_FAILURE           if threshold set of an entry
+*                                        is failed.
+* @retval BVIEW_STATUS_SUCCESS           if thresholds of all entries
+*                                        are set.
+*
+* @notes    A failed entry does not stop the batch.
+*
+*
+*********************************************************************/
+static BVIEW_STATUS sbplugin_sim_bst_threshold_bulk_set (int asic,
+                              BVIEW_BST_THRESHOLD_BULK_ENTRY_t *entries,
+                              unsigned int numEntries)
+{
+  BVIEW_BST_THRESHOLD_BULK_ENTRY_t *entry;
+  BVIEW_STATUS rv = BVIEW_STATUS_SUCCESS;
+  unsigned int index = 0;
+
+  /*validate ASIC*/
+  BVIEW_SIM_UNIT_CHECK (asic);
+  BVIEW_SIM_NULLPTR_CHECK (entries);
+
+  for (index = 0; index < numEntries; index++)
+  {
+    entry = &entries[index];
+    switch (entry->realm)
+    {
+      case BVIEW_BST_REALM_DEVICE:
+        entry->status = sbplugin_sim_bst_device_threshold_set (asic,
+                                  &entry->threshold.device);
+        break;
+      case BVIEW_BST_REALM_INGRESS_PORT_PG:
+        entry->status = sbplugin_sim_bst_ippg_threshold_set (asic, entry->port,
+                                  entry->index, &entry->threshold.ippg);
+        break;
+      case BVIEW_BST_REALM_INGRESS_PORT_SP:
+        entry->status = sbplugin_sim_bst_ipsp_threshold_set (asic, entry->port,
+                                  entry->index, &entry->threshold.ipsp);
+        break;
+      case BVIEW_BST_REALM_INGRESS_SP:
+        entry->status = sbplugin_sim_bst_isp_threshold_set (asic,
+                                  entry->index, &entry->threshold.isp);
+        break;
+      case BVIEW_BST_REALM_EGRESS_PORT_SP:
+        entry->status = sbplugin_sim_bst_epsp_threshold_set (asic, entry->port,
+                                  entry->index, &entry->threshold.epsp);
+        break;
+      case BVIEW_BST_REALM_EGRESS_SP:
+        entry->status = sbplugin_sim_bst_esp_threshold_set (asic,
+                                  entry->index, &entry->threshold.esp);
+        break;
+      case BVIEW_BST_REALM_EGRESS_UC_QUEUE:
+        entry->status = sbplugin_sim_bst_eucq_threshold_set (asic,
+                                  entry->index, &entry->threshold.eucq);
+        break;
+      case BVIEW_BST_REALM_EGRESS_UC_QUEUEGROUPS:
+        entry->status = sbplugin_sim_bst_eucqg_threshold_set (asic,
+                                  entry->index, &entry->threshold.eucqg);
+        break;
+      case BVIEW_BST_REALM_EGRESS_MC_QUEUE:
+        entry->status = sbplugin_sim_bst_emcq_threshold_set (asic,
+                                  entry->index, &entry->threshold.emcq);
+        break;
+      case BVIEW_BST_REALM_EGRESS_CPU_QUEUE:
+        entry->status = sbplugin_sim_bst_cpuq_threshold_set (asic,
+                                  entry->index, &entry->threshold.cpuq);
+        break;
+      case BVIEW_BST_REALM_EGRESS_RQE_QUEUE:
+        entry->status = sbplugin_sim_bst_rqeq_threshold_set (asic,
+                                  entry->index, &entry->threshold.rqeq);
+        break;
+      default:
+        entry->status = BVIEW_STATUS_INVALID_PARAMETER;
+        break;
+    }
+    if (entry->status != BVIEW_STATUS_SUCCESS)
+    {
+      rv = BVIEW_STATUS_FAILURE;
+    }
+  }
+  return rv;
+}
+
+/*********************************************************************
+* @brief  Read snapshot of all thresholds configured from HW
+*
+* @param  [in]  asic                         - unit
+* @param  [out] thresholdSnapshot            - Threshold snapshot
+*                                              data structure
+*
+* @retval BVIEW_STATUS_FAILURE           if profile get is failed.
+* @retval BVIEW_STATUS_SUCCESS           if all profiles are read.
+*
+* @notes    Charges one profile get per threshold, same as the SDK.
+*
+*
+*********************************************************************/
+static BVIEW_STATUS sbplugin_sim_bst_threshold_read (int asic,
+                              BVIEW_BST_ASIC_SNAPSHOT_DATA_t *thresholdSnapshot)
+{
+  unsigned int port = 0, index = 0, queue = 0;
+
+  BVIEW_SIM_BST_PROFILE_GET (asic, 0, 0, BVIEW_SIM_BST_STAT_ID_DEVICE,
+                             &thresholdSnapshot->device.bufferCount);
+
+  BVIEW_SIM_BST_PORT_ITER (asic, port)
+  {
+    BVIEW_SIM_BST_ITER (index, BVIEW_ASIC_MAX_PRIORITY_GROUPS)
+    {
+      BVIEW_SIM_BST_PROFILE_GET (asic, port, index, BVIEW_SIM_BST_STAT_ID_PRI_GROUP_SHARED,
+                                 &thresholdSnapshot->iPortPg.data[port - 1][index].umShareBufferCount);
+      BVIEW_SIM_BST_PROFILE_GET (asic, port, index, BVIEW_SIM_BST_STAT_ID_PRI_GROUP_HEADROOM,
+                                 &thresholdSnapshot->iPortPg.data[port - 1][index].umHeadroomBufferCount);
+    }
+
+    BVIEW_SIM_BST_ITER (index, BVIEW_ASIC_MAX_SERVICE_POOLS)
+    {
+      BVIEW_SIM_BST_PROFILE_GET (asic, port, index, BVIEW_SIM_BST_STAT_ID_PORT_POOL,
+                                 &thresholdSnapshot->iPortSp.data[port - 1][index].umShareBufferCount);
+      BVIEW_SIM_BST_PROFILE_GET (asic, port, index, BVIEW_SIM_BST_STAT_ID_EGR_UCAST_PORT_SHARED,
+                                 &thresholdSnapshot->ePortSp.data[port - 1][index].ucShareBufferCount);
+      BVIEW_SIM_BST_PROFILE_GET (asic, port, index, BVIEW_SIM_BST_STAT_ID_EGR_PORT_SHARED,
+                                 &thresholdSnapshot->ePortSp.data[port - 1][index].umShareBufferCount);
+    }
+
+    BVIEW_SIM_BST_COS_ITER (index)
+    {
+      queue = ((port - 1) * sbSimConfig.numCosPerPort) + index;
+      BVIEW_SIM_BST_PROFILE_GET (asic, port, index, BVIEW_SIM_BST_STAT_ID_MCAST,
+                                 &thresholdSnapshot->eMcQ.data[queue].mcBufferCount);
+      thresholdSnapshot->eMcQ.data[queue].port = port;
+      BVIEW_SIM_BST_PROFILE_GET (asic, port, index, BVIEW_SIM_BST_STAT_ID_UCAST,
+                                 &thresholdSnapshot->eUcQ.data[queue].ucBufferCount);
+      thresholdSnapshot->eUcQ.data[queue].port = port;
+    }
+  }
+
+  BVIEW_SIM_BST_ITER (index, BVIEW_ASIC_MAX_SERVICE_POOLS)
+  {
+    BVIEW_SIM_BST_PROFILE_GET (asic, 0, index, BVIEW_SIM_BST_STAT_ID_EGR_POOL,
+                               &thresholdSnapshot->eSp.data[index].umShareBufferCount);
+    BVIEW_SIM_BST_PROFILE_GET (asic, 0, index, BVIEW_SIM_BST_STAT_ID_EGR_MCAST_POOL,
+                               &thresholdSnapshot->eSp.data[index].mcShareBufferCount);
+    BVIEW_SIM_BST_PROFILE_GET (asic, 0, index, BVIEW_SIM_BST_STAT_ID_ING_POOL,
+                               &thresholdSnapshot->iSp.data[index].umShareBufferCount);
+  }
+
+  BVIEW_SIM_BST_ITER (index, BVIEW_ASIC_MAX_CPU_QUEUES)
+  {
+    BVIEW_SIM_BST_PROFILE_GET (asic, BVIEW_SIM_BST_CPU_PORT, index, BVIEW_SIM_BST_STAT_ID_MCAST,
+                               &thresholdSnapshot->cpqQ.data[index].cpuBufferCount);
+  }
+
+  BVIEW_SIM_BST_ITER (index, BVIEW_ASIC_MAX_RQE_QUEUES)
+  {
+    BVIEW_SIM_BST_PROFILE_GET (asic, 0, index, BVIEW_SIM_BST_STAT_ID_RQE_QUEUE,
+                               &thresholdSnapshot->rqeQ.data[index].rqeBufferCount);
+  }
+
+  BVIEW_SIM_BST_ITER (index, BVIEW_ASIC_MAX_UC_QUEUE_GROUPS)
+  {
+    BVIEW_SIM_BST_PROFILE_GET (asic, 0, index, BVIEW_SIM_BST_STAT_ID_UCAST_GROUP,
+                               &thresholdSnapshot->eUcQg.data[index].ucBufferCount);
+  }
+
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief  Get snapshot of all thresholds configured
+*
+* @param  [in]  asic                         - unit
+* @param  [out] thresholdSnapshot            - Threshold snapshot
+*                                              data structure
+* @param  [out] time                         - Time
+*
+* @retval BVIEW_STATUS_INVALID_PARAMETER if input data is invalid.
+* @retval BVIEW_STATUS_FAILURE           if snapshot get is failed.
+* @retval BVIEW_STATUS_SUCCESS           if snapshot get is success.
+*
+* @notes    Thresholds are served from the shadow. HW is read only
+*           to seed the shadow.
+*
+*
+*********************************************************************/
+static BVIEW_STATUS sbplugin_sim_bst_threshold_get (int asic,
+                              BVIEW_BST_ASIC_SNAPSHOT_DATA_t *thresholdSnapshot,
+                              BVIEW_TIME_t *time)
+{
+  BVIEW_SIM_BST_THRESHOLD_SHADOW_t *shadow;
+  BVIEW_STATUS rv = BVIEW_STATUS_SUCCESS;
+
+  BVIEW_SIM_BST_INPUT_VALIDATE (asic, thresholdSnapshot, time);
+
+  sbplugin_sim_system_time_get (time);
+
+  shadow = &simBstThresholdShadow[asic];
+  pthread_mutex_lock (&shadow->lock);
+  if (shadow->valid == false)
+  {
+    /* Seed the shadow from HW*/
+    memset (&shadow->data, 0x00, sizeof (BVIEW_BST_ASIC_SNAPSHOT_DATA_t));
+    rv = sbplugin_sim_bst_threshold_read (asic, &shadow->data);
+    shadow->valid = (rv == BVIEW_STATUS_SUCCESS) ? true : false;
+  }
+  if (shadow->valid == true)
+  {
+    memcpy (thresholdSnapshot, &shadow->data, sizeof (BVIEW_BST_ASIC_SNAPSHOT_DATA_t));
+  }
+  pthread_mutex_unlock (&shadow->lock);
+
+  return rv;
+}
+
+/*********************************************************************
+* @brief  Read snapshot of all thresholds configured from HW and
+*         verify the shadow of the thresholds
+*
+* @param  [in]  asic                         - unit
+* @param  [out] thresholdSnapshot            - Threshold snapshot
+*                                              data structure
+* @param  [out] time                         - Time
+* @param  [out] mismatches                   - Number of thresholds
+*                                              that differ from shadow
+*
+* @retval BVIEW_STATUS_INVALID_PARAMETER if input data is invalid.
+* @retval BVIEW_STATUS_FAILURE           if HW read is failed.
+* @retval BVIEW_STATUS_SUCCESS           if HW read is success.
+*
+* @notes    Shadow is replaced with the thresholds read from HW.
+*           A shadow which is not seeded yet has no mismatches.
+*
+*
+*********************************************************************/
+static BVIEW_STATUS sbplugin_sim_bst_threshold_verify (int asic,
+                              BVIEW_BST_ASIC_SNAPSHOT_DATA_t *thresholdSnapshot,
+                              BVIEW_TIME_t *time,
+                              unsigned int *mismatches)
+{
+  BVIEW_SIM_BST_THRESHOLD_SHADOW_t *shadow;
+  BVIEW_STATUS rv = BVIEW_STATUS_SUCCESS;
+  const uint64_t *hw, *sw;
+  unsigned int index = 0;
+
+  BVIEW_SIM_BST_INPUT_VALIDATE (asic, thresholdSnapshot, time);
+  BVIEW_SIM_NULLPTR_CHECK (mismatches);
+
+  sbplugin_sim_system_time_get (time);
+
+  *mismatches = 0;
+  shadow = &simBstThresholdShadow[asic];
+  pthread_mutex_lock (&shadow->lock);
+  memset (thresholdSnapshot, 0x00, sizeof (BVIEW_BST_ASIC_SNAPSHOT_DATA_t));
+  rv = sbplugin_sim_bst_threshold_read (asic, thresholdSnapshot);
+  if (rv == BVIEW_STATUS_SUCCESS)
+  {
+    if (shadow->valid == true)
+    {
+      /* snapshot holds only 64 bit counters, compare them one by one*/
+      hw = (const uint64_t *) thresholdSnapshot;
+      sw = (const uint64_t *) &shadow->data;
+      BVIEW_SIM_BST_ITER (index, BVIEW_SIM_BST_STRIDE (BVIEW_BST_ASIC_SNAPSHOT_DATA_t))
+      {
+        if (hw[index] != sw[index])
+        {
+          (*mismatches)++;
+        }
+      }
+    }
+    memcpy (&shadow->data, thresholdSnapshot, sizeof (BVIEW_BST_ASIC_SNAPSHOT_DATA_t));
+    shadow->valid = true;
+  }
+  pthread_mutex_unlock (&shadow->lock);
+
+  return rv;
+}
+
+/*********************************************************************
+* @brief  Clear stats
+*
+* @param[in]   asic                                    - unit
+*
+* @retval BVIEW_STATUS_INVALID_PARAMETER if input data is invalid.
+* @retval BVIEW_STATUS_SUCCESS           if clear stats is success.
+*
+* @notes    none
+*
+*
+*********************************************************************/
+static BVIEW_STATUS  sbplugin_sim_bst_clear_stats (int asic)
+{
+  BVIEW_SIM_UNIT_CHECK (asic);
+
+  pthread_mutex_lock (&simBstDb[asic].lock);
+  memset (simBstDb[asic].stat, 0x00, sizeof (simBstDb[asic].stat));
+  pthread_mutex_unlock (&simBstDb[asic].lock);
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief  Restore threshold configuration
+*
+* @param   asic                                    - unit
+*
+* @retval BVIEW_STATUS_INVALID_PARAMETER if input data is invalid.
+* @retval BVIEW_STATUS_SUCCESS           if restore is success.
+*
+* @notes    Shadow of the thresholds is seeded again from HW by
+*           the next threshold get.
+*
+*
+*********************************************************************/
+static BVIEW_STATUS  sbplugin_sim_bst_clear_thresholds (int asic)
+{
+  unsigned int bid = 0, entry = 0;
+
+  BVIEW_SIM_UNIT_CHECK (asic);
+
+  /* Thresholds are restored to defaults, drop the shadow*/
+  pthread_mutex_lock (&simBstThresholdShadow[asic].lock);
+  simBstThresholdShadow[asic].valid = false;
+  pthread_mutex_unlock (&simBstThresholdShadow[asic].lock);
+
+  BVIEW_SIM_BST_ITER (bid, BVIEW_SIM_BST_STAT_ID_MAX_COUNT)
+  {
+    BVIEW_SIM_BST_ITER (entry, BVIEW_SIM_BST_MAX_ENTRIES)
+    {
+      simBstDb[asic].threshold[bid][entry] = simBstStatInfo[bid].defaultThreshold;
+    }
+  }
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief  Register hw trigger callback
+*
+* @param   asic                              - unit
+* @param   callback                          - function to be called
+*                                              when trigger happens
+* @param   cookie                            - user data
+*
+* @retval BVIEW_STATUS_INVALID_PARAMETER if input data is invalid.
+* @retval BVIEW_STATUS_SUCCESS           if register is success.
+*
+* @notes    callback is executed in the context of the stat sync
+*           that detected the threshold crossing.
+*
+*********************************************************************/
+static BVIEW_STATUS  sbplugin_sim_bst_register_trigger (int asic,
+                                        BVIEW_BST_TRIGGER_CALLBACK_t callback,
+                                        void *cookie)
+{
+  BVIEW_SIM_UNIT_CHECK (asic);
+
+  pthread_mutex_lock (&simBstDb[asic].lock);
+  simBstDb[asic].triggerCb = callback;
+  simBstDb[asic].cookie = cookie;
+  pthread_mutex_unlock (&simBstDb[asic].lock);
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief  Sync a simulated BST id for the snapshot collection
+*
+* @param[in]   asic                  - unit
+* @param[in]   bid                   - BST stat id
+*
+* @retval BVIEW_STATUS_FAILURE           if sync is failed.
+* @retval BVIEW_STATUS_SUCCESS           if sync is success.
+*
+* @notes    none
+*
+*
+*********************************************************************/
+static BVIEW_STATUS sbplugin_sim_bst_collect_stat_sync (int asic, int bid)
+{
+  BVIEW_SIM_BST_STAT_SYNC (asic, (BVIEW_SIM_BST_STAT_ID_t) bid);
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/* Hooks of the simulator for the snapshot collection*/
+static const BVIEW_BST_COLLECT_OPS_t simBstCollectOps =
+{
+  BVIEW_SIM_NUM_ASICS,
+  simBstRealmSync,
+  sbplugin_sim_bst_collect_stat_sync,
+  sbplugin_sim_bst_realm_get
+};
+
+/*********************************************************************
+* @brief  Simulator BST feature init
+*
+* @param[in,out]  simBst     - BST feature data structure
+*
+* @retval   BVIEW_STATUS_SUCCESS if BST feature is
+*                                initialized successfully.
+* @retval   BVIEW_STATUS_FAILURE if initialization is failed.
+*
+* @notes    none
+*
+*
+*********************************************************************/
+BVIEW_STATUS sbplugin_sim_bst_init (BVIEW_SB_BST_FEATURE_t *simBst)
+{
+  unsigned int asic = 0;
+
+  if (simBst == NULL)
+  {
+    return BVIEW_STATUS_FAILURE;
+  }
+
+  /* Initialize simulated hardware of all the units*/
+  BVIEW_SIM_BST_ITER (asic, BVIEW_SIM_NUM_ASICS)
+  {
+    memset (&simBstDb[asic], 0x00, sizeof (BVIEW_SIM_BST_ASIC_t));
+    if (pthread_mutex_init (&simBstDb[asic].lock, NULL) != 0)
+    {
+      return BVIEW_STATUS_FAILURE;
+    }
+    simBstThresholdShadow[asic].valid = false;
+    if (pthread_mutex_init (&simBstThresholdShadow[asic].lock, NULL) != 0)
+    {
+      return BVIEW_STATUS_FAILURE;
+    }
+    simBstDb[asic].config.mode = BVIEW_BST_MODE_CURRENT;
+    simBstDb[asic].seed = 0x2545F491 + asic;
+    sbplugin_sim_bst_clear_thresholds (asic);
+  }
+
+  memset (simBst, 0x00, sizeof (BVIEW_SB_BST_FEATURE_t));
+
+  simBst->feature.featureId           = BVIEW_FEATURE_BST;
+  simBst->feature.supportedAsicMask   = BVIEW_SIM_BST_SUPPORT_MASK;
+  simBst->bst_config_set_cb           = sbplugin_sim_bst_config_set;
+  simBst->bst_config_get_cb           = sbplugin_sim_bst_config_get;
+  simBst->bst_snapshot_get_cb         = sbplugin_sim_bst_snapshot_get;
+  simBst->bst_stat_bulk_get_cb        = sbplugin_sim_bst_stat_bulk_get;
+  simBst->bst_collect_stats_get_cb    = sbplugin_bst_collect_stats_get;
+  simBst->bst_device_data_get_cb      = sbplugin_sim_bst_device_data_get;
+  simBst->bst_ippg_data_get_cb        = sbplugin_sim_bst_ippg_data_get;
+  simBst->bst_ipsp_data_get_cb        = sbplugin_sim_bst_ipsp_data_get;
+  simBst->bst_isp_data_get_cb         = sbplugin_sim_bst_isp_data_get;
+  simBst->bst_epsp_data_get_cb        = sbplugin_sim_bst_epsp_data_get;
+  simBst->bst_esp_data_get_cb         = sbplugin_sim_bst_esp_data_get;
+  simBst->bst_eucq_data_get_cb        = sbplugin_sim_bst_eucq_data_get;
+  simBst->bst_eucqg_data_get_cb       = sbplugin_sim_bst_eucqg_data_get;
+  simBst->bst_emcq_data_get_cb        = sbplugin_sim_bst_emcq_data_get;
+  simBst->bst_cpuq_data_get_cb        = sbplugin_sim_bst_cpuq_data_get;
+  simBst->bst_rqeq_data_get_cb        = sbplugin_sim_bst_rqeq_data_get;
+  simBst->bst_device_threshold_set_cb = sbplugin_sim_bst_device_threshold_set;
+  simBst->bst_ippg_threshold_set_cb   = sbplugin_sim_bst_ippg_threshold_set;
+  simBst->bst_ipsp_threshold_set_cb   = sbplugin_sim_bst_ipsp_threshold_set;
+  simBst->bst_isp_threshold_set_cb    = sbplugin_sim_bst_isp_threshold_set;
+  simBst->bst_epsp_threshold_set_cb   = sbplugin_sim_bst_epsp_threshold_set;
+  simBst->bst_esp_threshold_set_cb    = sbplugin_sim_bst_esp_threshold_set;
+  simBst->bst_eucq_threshold_set_cb   = sbplugin_sim_bst_eucq_threshold_set;
+  simBst->bst_eucqg_threshold_set_cb  = sbplugin_sim_bst_eucqg_threshold_set;
+  simBst->bst_emcq_threshold_set_cb   = sbplugin_sim_bst_emcq_threshold_set;
+  simBst->bst_cpuq_threshold_set_cb   = sbplugin_sim_bst_cpuq_threshold_set;
+  simBst->bst_rqeq_threshold_set_cb   = sbplugin_sim_bst_rqeq_threshold_set;
+  simBst->bst_threshold_get_cb        = sbplugin_sim_bst_threshold_get;
+  simBst->bst_threshold_verify_cb     = sbplugin_sim_bst_threshold_verify;
+  simBst->bst_threshold_bulk_set_cb   = sbplugin_sim_bst_threshold_bulk_set;
+  simBst->bst_clear_stats_cb          = sbplugin_sim_bst_clear_stats;
+  simBst->bst_clear_thresholds_cb     = sbplugin_sim_bst_clear_thresholds;
+  simBst->bst_register_trigger_cb     = sbplugin_sim_bst_register_trigger;
+
+  /* Start the snapshot collection workers, if configured*/
+  if (sbplugin_bst_collect_init (&simBstCollectOps) != BVIEW_STATUS_SUCCESS)
+  {
+    return BVIEW_STATUS_FAILURE;
+  }
+
+  return BVIEW_STATUS_SUCCESS;
+}
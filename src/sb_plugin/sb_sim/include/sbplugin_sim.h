@@ -0,0 +1,158 @@
+/*****************************************************************************
+  *
+  * (C) Copyright Broadcom Corporation 2015
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License");
+  * you may not use this file except in compliance with the License.
+  *
+  * You may obtain a copy of the License at
+  * http://www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ***************************************************************************/
+
+#ifndef INCLUDE_SBPLUGIN_SIM_H
+#define INCLUDE_SBPLUGIN_SIM_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "sbplugin.h"
+#include "sbplugin_system.h"
+#include "openapps_log_api.h"
+
+/* Number of simulated ASICs */
+#define BVIEW_SIM_NUM_ASICS                 BVIEW_MAX_ASICS_ON_A_PLATFORM
+
+/* Default scaling of the simulated ASIC */
+#define BVIEW_SIM_DEFAULT_NUM_PORTS         72
+#define BVIEW_SIM_DEFAULT_NUM_COS_PORT      8
+
+/* Default SDK cost model, per call latencies in micro seconds */
+#define BVIEW_SIM_DEFAULT_SYNC_LATENCY      0
+#define BVIEW_SIM_DEFAULT_STAT_LATENCY      0
+#define BVIEW_SIM_DEFAULT_PROFILE_LATENCY   0
+
+/* Default buffer occupancy of the simulated traffic in percent of
+ * the default threshold of each counter
+ */
+#define BVIEW_SIM_DEFAULT_LOAD_PERCENT      10
+
+/* Environment variables to override the simulator defaults */
+#define BVIEW_SIM_ENV_NUM_PORTS             "BVIEW_SIM_NUM_PORTS"
+#define BVIEW_SIM_ENV_NUM_COS_PORT          "BVIEW_SIM_NUM_COS_PORT"
+#define BVIEW_SIM_ENV_SYNC_LATENCY          "BVIEW_SIM_SYNC_LATENCY_US"
+#define BVIEW_SIM_ENV_STAT_LATENCY          "BVIEW_SIM_STAT_LATENCY_US"
+#define BVIEW_SIM_ENV_PROFILE_LATENCY       "BVIEW_SIM_PROFILE_LATENCY_US"
+#define BVIEW_SIM_ENV_LOAD_PERCENT          "BVIEW_SIM_LOAD_PERCENT"
+#define BVIEW_SIM_ENV_DEBUG                 "BVIEW_SIM_DEBUG"
+
+/* Configuration of the simulated ASIC and the SDK cost model */
+typedef struct _bview_sim_config_
+{
+  /* Number of front panel ports */
+  unsigned int numPorts;
+  /* Number of unicast/multicast queues per port */
+  unsigned int numCosPerPort;
+  /* Latency of one stat sync (HW to SDK copy) of a BST id */
+  unsigned int syncLatencyUsec;
+  /* Latency of one stat get call for a (port, cosq, bid) */
+  unsigned int statLatencyUsec;
+  /* Latency of one profile get/set call */
+  unsigned int profileLatencyUsec;
+  /* Simulated buffer occupancy in percent of the default threshold */
+  unsigned int loadPercent;
+} BVIEW_SIM_CONFIG_t;
+
+/* Simulator configuration, filled once at plugin init */
+extern BVIEW_SIM_CONFIG_t sbSimConfig;
+
+/* Flag to enable/disable debug */
+extern int sbSimDebugFlag;
+
+/* Macro to print the simulator plug-in debug information */
+#define SB_SIM_DEBUG_PRINT(severity,format, args...)                 \
+                                if (sbSimDebugFlag)                  \
+                                {                                    \
+                                  log_post(severity,format, ##args); \
+                                }
+
+
+#define SB_SIM_LOG(severity,format, args...)               \
+                        {                                   \
+                          log_post(severity,format, ##args);\
+                        }
+
+/* Check _asic (unit) is a simulated unit*/
+#define BVIEW_SIM_UNIT_CHECK(_asic)                                 \
+                         if (((_asic) < 0) || ((_asic) >= BVIEW_SIM_NUM_ASICS))  \
+                         {                                          \
+                           return BVIEW_STATUS_INVALID_PARAMETER;   \
+                         }
+
+/* NULL Pointer Check*/
+#define  BVIEW_SIM_NULLPTR_CHECK(_p)            \
+                if (_p == NULL)                 \
+                {                               \
+                  return BVIEW_STATUS_FAILURE;  \
+                }
+
+/* Charge the configured cost of _n SDK calls */
+#define BVIEW_SIM_COST(_usec,_n)                                  \
+                  if ((_usec) != 0)                               \
+                  {                                               \
+                    sbplugin_sim_latency_inject ((_usec) * (_n)); \
+                  }
+
+/*********************************************************************
+* @brief    Simulator configuration init
+*
+* @retval   BVIEW_STATUS_SUCCESS if configuration is read successfully.
+*
+* @notes    Defaults can be overridden through the BVIEW_SIM_*
+*           environment variables.
+*
+*
+*********************************************************************/
+BVIEW_STATUS sbplugin_sim_config_init (void);
+
+/*********************************************************************
+* @brief    Inject latency to emulate cost of the SDK calls
+*
+* @param[in]  usec   - latency in micro seconds
+*
+* @retval   none
+*
+* @notes    Spins for short delays so that the injected cost is
+*           not lost to scheduler granularity.
+*
+*
+*********************************************************************/
+void sbplugin_sim_latency_inject (unsigned int usec);
+
+/*********************************************************************
+* @brief    Simulator South bound - SYSTEM feature init
+*
+* @param[in,out]   simSystem   -  system data structure
+*
+* @retval   BVIEW_STATUS_SUCCESS if SYSTEM feature is
+*                                initialized successfully.
+* @retval   BVIEW_STATUS_FAILURE if initialization is failed.
+*
+* @notes    none
+*
+*
+*********************************************************************/
+BVIEW_STATUS  sbplugin_sim_system_init (BVIEW_SB_SYSTEM_FEATURE_t *simSystem);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,200 @@
+/*****************************************************************************
+  *
+  * (C) Copyright Broadcom Corporation 2015
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License");
+  * you may not use this file except in compliance with the License.
+  *
+  * You may obtain a copy of the License at
+  * http://www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ***************************************************************************/
+
+#ifndef INCLUDE_SBPLUGIN_SIM_BST_H
+#define INCLUDE_SBPLUGIN_SIM_BST_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "broadview.h"
+#include "sbfeature_bst.h"
+#include "sbplugin_sim.h"
+#include "sbplugin_bst_collect.h"
+
+/** BST feature support ASIC's Mask*/
+#define  BVIEW_SIM_BST_SUPPORT_MASK    (BVIEW_ASIC_TYPE_TD2 | BVIEW_ASIC_TYPE_TH)
+
+/** Maximum number of COS Queue per port*/
+#define  BVIEW_SIM_BST_MAX_COS_PORT    8
+
+/** Port number of the simulated CPU port*/
+#define  BVIEW_SIM_BST_CPU_PORT        0
+
+/** Maximum number of counters of one BST id (CPU port + front panel ports)*/
+#define  BVIEW_SIM_BST_MAX_ENTRIES     ((BVIEW_ASIC_MAX_PORTS + 1) * BVIEW_SIM_BST_MAX_COS_PORT)
+
+/* Simulated BST stat ids, modelled on the SDK bst stat ids */
+typedef enum _bview_sim_bst_stat_id_
+{
+  BVIEW_SIM_BST_STAT_ID_DEVICE = 0,
+  BVIEW_SIM_BST_STAT_ID_EGR_POOL,
+  BVIEW_SIM_BST_STAT_ID_EGR_MCAST_POOL,
+  BVIEW_SIM_BST_STAT_ID_ING_POOL,
+  BVIEW_SIM_BST_STAT_ID_PORT_POOL,
+  BVIEW_SIM_BST_STAT_ID_PRI_GROUP_SHARED,
+  BVIEW_SIM_BST_STAT_ID_PRI_GROUP_HEADROOM,
+  BVIEW_SIM_BST_STAT_ID_UCAST,
+  BVIEW_SIM_BST_STAT_ID_MCAST,
+  BVIEW_SIM_BST_STAT_ID_EGR_UCAST_PORT_SHARED,
+  BVIEW_SIM_BST_STAT_ID_EGR_PORT_SHARED,
+  BVIEW_SIM_BST_STAT_ID_RQE_QUEUE,
+  BVIEW_SIM_BST_STAT_ID_UCAST_GROUP,
+  BVIEW_SIM_BST_STAT_ID_MAX_COUNT
+} BVIEW_SIM_BST_STAT_ID_t;
+
+/* Check _asic (unit) is valid along with _data & _time for NULL pointer */
+#define  BVIEW_SIM_BST_INPUT_VALIDATE(_asic,_data,_time)               \
+                            if (((_data) == NULL) || ((_time) == NULL) ||  \
+                                ((_asic) < 0) || ((_asic) >= BVIEW_SIM_NUM_ASICS))  \
+                            {                                          \
+                               SB_SIM_DEBUG_PRINT (BVIEW_LOG_ERROR,"Invalid input data ASIC %d", \
+                                  _asic );                             \
+                              return BVIEW_STATUS_INVALID_PARAMETER;   \
+                            }
+
+/* sync to copy simulated HW stats to SDK*/
+#define BVIEW_SIM_BST_STAT_SYNC(_asic,_bid)                                \
+                  if (sbplugin_sim_bst_stat_sync((_asic),(_bid)) != BVIEW_STATUS_SUCCESS) \
+                  {                                                        \
+                     SB_SIM_DEBUG_PRINT (BVIEW_LOG_ERROR,"Stat sync failed for ASIC %d BID %d", \
+                                  (_asic),( _bid));                            \
+                     return BVIEW_STATUS_FAILURE;                          \
+                  }
+
+/* sync the simulated stat ids of the realms in _realmMask to SDK*/
+#define BVIEW_SIM_BST_REALM_SYNC(_asic,_realmMask)                         \
+                  if (sbplugin_bst_realm_sync((_asic),(_realmMask),NULL) != BVIEW_STATUS_SUCCESS) \
+                  {                                                        \
+                     return BVIEW_STATUS_FAILURE;                          \
+                  }
+
+/* Macro to iterate all ports*/
+#define  BVIEW_SIM_BST_PORT_ITER(_asic,_port)                                     \
+              for ((_port) = 1; (_port) <= simAsicDb[(_asic)].scalingParams.numPorts; (_port)++)
+
+/* Macro to iterate all queues of a port*/
+#define  BVIEW_SIM_BST_COS_ITER(_cosq)                                          \
+              for ((_cosq) = 0; (_cosq) < sbSimConfig.numCosPerPort; (_cosq)++)
+
+/* Macro to iterate 'n'  times*/
+#define BVIEW_SIM_BST_ITER(_index,_n)                          \
+              for ((_index) = 0; (_index) < (_n); (_index)++)
+
+/* Distance between two consecutive _entry's of a realm array, in counters*/
+#define BVIEW_SIM_BST_STRIDE(_entry)   (sizeof (_entry) / (sizeof (uint64_t)))
+
+/*********************************************************************
+* @brief  Simulator BST feature init
+*
+* @param[in,out]  simBst     - BST feature data structure
+*
+* @retval   BVIEW_STATUS_SUCCESS if BST feature is
+*                                initialized successfully.
+* @retval   BVIEW_STATUS_FAILURE if initialization is failed.
+*
+* @notes    none
+*
+*
+*********************************************************************/
+BVIEW_STATUS sbplugin_sim_bst_init (BVIEW_SB_BST_FEATURE_t *simBst);
+
+/*********************************************************************
+* @brief  Copy the simulated HW counters of a BST id to the SDK copy
+*
+* @param[in]   asic                  - unit
+* @param[in]   bid                   - BST stat id
+*
+* @retval BVIEW_STATUS_INVALID_PARAMETER if input data is invalid.
+* @retval BVIEW_STATUS_SUCCESS           if sync is success.
+*
+* @notes    Charges the configured sync latency. Fires the registered
+*           trigger callback if a counter crosses its threshold.
+*
+*
+*********************************************************************/
+BVIEW_STATUS sbplugin_sim_bst_stat_sync (int asic, BVIEW_SIM_BST_STAT_ID_t bid);
+
+/*********************************************************************
+* @brief  Read one synced counter of a BST id
+*
+* @param[in]   asic                  - unit
+* @param[in]   port                  - port, 0 for device wide ids
+* @param[in]   index                 - cosq/pg/sp/queue index
+* @param[in]   bid                   - BST stat id
+* @param[out]  value                 - counter value in cells
+*
+* @retval BVIEW_STATUS_INVALID_PARAMETER if input data is invalid.
+* @retval BVIEW_STATUS_SUCCESS           if stat get is success.
+*
+* @notes    Charges the configured per call stat latency.
+*
+*
+*********************************************************************/
+BVIEW_STATUS sbplugin_sim_bst_stat_get (int asic, int port, int index,
+                                        BVIEW_SIM_BST_STAT_ID_t bid,
+                                        uint64_t *value);
+
+/*********************************************************************
+* @brief  Read the synced counters of one counter type in bulk
+*
+* @param[in]      asic               - unit
+* @param[in,out]  bulk               - counter type, port and index
+*                                      range and the counters
+*
+* @retval BVIEW_STATUS_INVALID_PARAMETER if input data is invalid.
+* @retval BVIEW_STATUS_SUCCESS           if stat get is success.
+*
+* @notes    Models an SDK table read: the configured stat latency is
+*           charged once per call, not once per counter.
+*
+*
+*********************************************************************/
+BVIEW_STATUS sbplugin_sim_bst_stat_bulk_get (int asic,
+                                             BVIEW_BST_STAT_BULK_t *bulk);
+
+/*********************************************************************
+* @brief  Obtain Statistics of one realm of the snapshot
+*
+* @param[in]      asic               - unit
+* @param[in]      realm              - realm to be read
+* @param[out]     snapshot           - snapshot data structure
+* @param[out]     time               - time
+*
+* @retval BVIEW_STATUS_INVALID_PARAMETER if realm is invalid.
+* @retval BVIEW_STATUS_FAILURE           if realm stat get is failed.
+* @retval BVIEW_STATUS_SUCCESS           if realm stat get is success.
+*
+* @notes    Only the section of the snapshot owned by the realm is
+*           written. Realms can be read concurrently. The stat ids of
+*           the realm are not synced, the caller syncs them.
+*
+*
+*********************************************************************/
+BVIEW_STATUS sbplugin_sim_bst_realm_get (int asic,
+                                 BVIEW_BST_REALM_t realm,
+                                 BVIEW_BST_ASIC_SNAPSHOT_DATA_t *snapshot,
+                                 BVIEW_TIME_t *time);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,242 @@
+/*****************************************************************************
+  *
+  * (C) Copyright Broadcom Corporation 2015
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License");
+  * you may not use this file except in compliance with the License.
+  *
+  * You may obtain a copy of the License at
+  * http://www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ***************************************************************************/
+
+#ifndef INCLUDE_SBPLUGIN_SIM_SYSTEM_H
+#define INCLUDE_SBPLUGIN_SIM_SYSTEM_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sbplugin.h"
+#include "sbplugin_sim.h"
+
+/* SYSTEM feature supported ASIC's Mask.*/
+#define  BVIEW_SIM_SYSTEM_SUPPORT_MASK   (BVIEW_ASIC_TYPE_ALL)
+
+/* The simulated ASIC uses TD2 scaling apart from port/queue counts */
+#define BVIEW_SIM_NUM_UC_QUEUE_GRP    128
+#define BVIEW_SIM_NUM_SP              4
+#define BVIEW_SIM_NUM_COMMON_SP       1
+#define BVIEW_SIM_NUM_RQE             11
+#define BVIEW_SIM_NUM_RQE_POOL        4
+#define BVIEW_SIM_NUM_PG              8
+#define BVIEW_SIM_1588_SUPPORT        0
+#define BVIEW_SIM_CPU_COSQ            8
+#define BVIEW_SIM_CELL_TO_BYTE        208
+
+/* Maximum length of a port notation string, including the NUL*/
+#define BVIEW_SIM_PORT_NOTATION_LEN   16
+
+/* Range of queues of a port*/
+typedef struct _bview_sim_queue_range_
+{
+  unsigned int first;
+  unsigned int count;
+} BVIEW_SIM_QUEUE_RANGE_t;
+
+/* Port map of a simulated unit, indexed by application port number*/
+typedef struct _bview_sim_port_map_
+{
+  bool              valid;
+  unsigned int      numPorts;
+  char              notation[BVIEW_ASIC_MAX_PORTS + 1][BVIEW_SIM_PORT_NOTATION_LEN];
+  int               notationLength[BVIEW_ASIC_MAX_PORTS + 1];
+  BVIEW_SIM_QUEUE_RANGE_t ucQueue[BVIEW_ASIC_MAX_PORTS + 1];
+  BVIEW_SIM_QUEUE_RANGE_t mcQueue[BVIEW_ASIC_MAX_PORTS + 1];
+} BVIEW_SIM_PORT_MAP_t;
+
+/* Get simulator asic number from Application ASIC number.*/
+#define    BVIEW_SIM_ASIC_GET(_asic) \
+               ((_asic) = simAsicMap[_asic]);
+
+/* Get Applciation ASIC number from simulator ASIC number*/
+#define    BVIEW_SIM_APP_ASIC_GET(_asic) \
+               ((_asic) = simAsicAppMap[_asic]);
+
+extern BVIEW_ASIC_t                 simAsicDb[];
+extern int                          simAsicMap[];
+extern int                          simAsicAppMap[];
+extern BVIEW_SIM_PORT_MAP_t         simPortMapDb[];
+
+/* UC queue range of a port*/
+#define BVIEW_SIM_PORT_UC_QUEUES(_asic, _port)                    \
+               (simPortMapDb[(_asic)].ucQueue[(_port)])
+
+/* MC queue range of a port*/
+#define BVIEW_SIM_PORT_MC_QUEUES(_asic, _port)                    \
+               (simPortMapDb[(_asic)].mcQueue[(_port)])
+
+/*********************************************************************
+* @brief  Get the system name
+*
+* @param[out] buffer                         - buffer
+* @param[in]  length                         - length of the buffer
+*
+* @retval  BVIEW_STATUS_SUCCESS            if Name get is success.
+* @retval  BVIEW_STATUS_INVALID_PARAMETER  if input parameter is invalid.
+*
+* @notes    none
+*
+*
+*********************************************************************/
+BVIEW_STATUS  sbplugin_sim_system_name_get (char *buffer, int length);
+
+/*********************************************************************
+* @brief  Get the MAC address of the system
+*
+* @param[out] buffer                         - buffer
+* @param[in]  length                         - length of the buffer
+*
+* @retval  BVIEW_STATUS_SUCCESS            if MAC get is success.
+* @retval  BVIEW_STATUS_INVALID_PARAMETER  if input parameter is invalid.
+*
+* @notes    Returns a fixed locally administered address.
+*
+*
+*********************************************************************/
+BVIEW_STATUS  sbplugin_sim_system_mac_get (unsigned char *buffer,
+                                           int length);
+
+/*********************************************************************
+* @brief  Get the IP address of system
+*
+* @param[out] buffer                         - buffer
+* @param[in]  length                         - length of the buffer
+*
+* @retval  BVIEW_STATUS_SUCCESS            if IP get is success.
+* @retval  BVIEW_STATUS_INVALID_PARAMETER  if input parameter is invalid.
+*
+* @notes    Returns the loopback address.
+*
+*
+*********************************************************************/
+BVIEW_STATUS sbplugin_sim_system_ipv4_get (unsigned char *buffer,
+                                           int length);
+
+/*********************************************************************
+* @brief  Get Current local time.
+*
+* @param[out] ptime                       - Pointer to time
+*
+* @retval  BVIEW_STATUS_SUCCESS            if time get is success.
+* @retval  BVIEW_STATUS_FAILURE            if time get is failed.
+*
+* @notes    none
+*
+*
+*********************************************************************/
+BVIEW_STATUS sbplugin_sim_system_time_get (time_t *ptime);
+
+/*********************************************************************
+* @brief  Translate ASIC String notation to ASIC Number.
+*
+* @param[in]  src                         - ASIC ID String
+* @param[out] asic                        - ASIC Number
+*
+* @retval  BVIEW_STATUS_SUCCESS            if ASIC Translation is success.
+* @retval  BVIEW_STATUS_FAILURE            if ASIC Translation is failed.
+* @retval  BVIEW_STATUS_INVALID_PARAMETER  if input parameter is invalid.
+*
+* @notes    none
+*
+*
+*********************************************************************/
+BVIEW_STATUS sbplugin_sim_system_asic_translate_from_notation (char *src,
+                                                               int *asic);
+
+/*********************************************************************
+* @brief  Translate Port String notation to Port Number.
+*
+* @param[in]   src                         - Port ID String
+* @param[out]  port                        - PortId
+*
+* @retval  BVIEW_STATUS_SUCCESS            if Port Tranlate is success.
+* @retval  BVIEW_STATUS_FAILURE            if Port  is failed.
+*
+* @notes    none
+*
+*
+*********************************************************************/
+BVIEW_STATUS sbplugin_sim_system_port_translate_from_notation (char *src,
+                                                               int *port);
+
+/*********************************************************************
+* @brief  Translate ASIC number to ASIC string notation.
+*
+* @param[in]   asic                         - ASIC ID
+* @param[out]  dst                          - ASIC ID String
+*
+* @retval  BVIEW_STATUS_SUCCESS            if ASIC ID Tranlate is success.
+* @retval  BVIEW_STATUS_FAILURE            if ASIC ID Tranlate is failed.
+* @retval  BVIEW_STATUS_INVALID_PARAMETER  if input parameter is invalid.
+*
+* @notes    none
+*
+*
+*********************************************************************/
+BVIEW_STATUS sbplugin_sim_system_asic_translate_to_notation (int asic,
+                                                             char *dst);
+
+/*********************************************************************
+* @brief   Translate port number to port string notation.
+*
+* @param[in]   asic                         - ASIC
+* @param[in]   port                         - Port Number
+* @param[out]  dst                          - ASIC String
+*
+* @retval  BVIEW_STATUS_SUCCESS            if Port Tranlate is success.
+* @retval  BVIEW_STATUS_FAILURE            if Port Tranlate is failed.
+*
+* @notes    none
+*
+*
+*********************************************************************/
+BVIEW_STATUS sbplugin_sim_system_port_translate_to_notation (int asic,
+                                                             int port,
+                                                             char *dst);
+
+/*********************************************************************
+* @brief   Get the cached port string notation of a port.
+*
+* @param[in]   asic                         - ASIC
+* @param[in]   port                         - Port Number
+* @param[out]  notation                     - Port String
+* @param[out]  length                       - Length of Port String
+*
+* @retval  BVIEW_STATUS_SUCCESS            if Port string is found.
+* @retval  BVIEW_STATUS_FAILURE            if Port is not in port map.
+* @retval  BVIEW_STATUS_INVALID_PARAMETER  if input parameter is invalid.
+*
+* @notes   The string is owned by the port map.
+*
+*
+*********************************************************************/
+BVIEW_STATUS sbplugin_sim_system_port_notation_get (int asic,
+                                                    int port,
+                                                    const char **notation,
+                                                    int *length);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,219 @@
+/*****************************************************************************
+  *
+  * (C) Copyright Broadcom Corporation 2015
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License");
+  * you may not use this file except in compliance with the License.
+  *
+  * You may obtain a copy of the License at
+  * http://www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ***************************************************************************/
+
+#include <stdlib.h>
+#include <time.h>
+#include "sbplugin.h"
+#include "sbplugin_sim.h"
+#include "sbplugin_sim_bst.h"
+#include "sbplugin_sim_system.h"
+#include "sb_redirector_api.h"
+
+/* Spin instead of sleep for latencies below this value (usec) */
+#define BVIEW_SIM_SPIN_THRESHOLD_USEC   1000
+
+/* BST feature data structure*/
+BVIEW_SB_BST_FEATURE_t       simBst;
+/* SYSTEM feature data structure*/
+BVIEW_SB_SYSTEM_FEATURE_t    simSystem;
+
+/* SB Plugin data structure*/
+BVIEW_SB_PLUGIN_t sbSimPlugin;
+
+/* Simulator configuration*/
+BVIEW_SIM_CONFIG_t sbSimConfig;
+
+/* Flag to enable/disable debug */
+int sbSimDebugFlag = false;
+
+/*********************************************************************
+* @brief    Read an unsigned simulator parameter from environment
+*
+* @param[in]  name          - environment variable name
+* @param[in]  defaultValue  - value to use if variable is not set
+* @param[in]  min           - minimum accepted value
+* @param[in]  max           - maximum accepted value
+*
+* @retval   value of the parameter
+*
+* @notes    Out of range values are clamped.
+*
+*
+*********************************************************************/
+static unsigned int sbplugin_sim_config_param_get (const char *name,
+                                                   unsigned int defaultValue,
+                                                   unsigned int min,
+                                                   unsigned int max)
+{
+  char *str = getenv (name);
+  long value = 0;
+
+  if (str == NULL)
+  {
+    return defaultValue;
+  }
+
+  value = strtol (str, NULL, 0);
+  if (value < (long) min)
+  {
+    value = min;
+  }
+  else if (value > (long) max)
+  {
+    value = max;
+  }
+  return (unsigned int) value;
+}
+
+/*********************************************************************
+* @brief    Simulator configuration init
+*
+* @retval   BVIEW_STATUS_SUCCESS if configuration is read successfully.
+*
+* @notes    Defaults can be overridden through the BVIEW_SIM_*
+*           environment variables.
+*
+*
+*********************************************************************/
+BVIEW_STATUS sbplugin_sim_config_init (void)
+{
+  sbSimConfig.numPorts = sbplugin_sim_config_param_get (BVIEW_SIM_ENV_NUM_PORTS,
+                                           BVIEW_SIM_DEFAULT_NUM_PORTS,
+                                           1, BVIEW_ASIC_MAX_PORTS);
+  sbSimConfig.numCosPerPort = sbplugin_sim_config_param_get (BVIEW_SIM_ENV_NUM_COS_PORT,
+                                           BVIEW_SIM_DEFAULT_NUM_COS_PORT,
+                                           1, BVIEW_SIM_BST_MAX_COS_PORT);
+  sbSimConfig.syncLatencyUsec = sbplugin_sim_config_param_get (BVIEW_SIM_ENV_SYNC_LATENCY,
+                                           BVIEW_SIM_DEFAULT_SYNC_LATENCY,
+                                           0, 1000000);
+  sbSimConfig.statLatencyUsec = sbplugin_sim_config_param_get (BVIEW_SIM_ENV_STAT_LATENCY,
+                                           BVIEW_SIM_DEFAULT_STAT_LATENCY,
+                                           0, 1000000);
+  sbSimConfig.profileLatencyUsec = sbplugin_sim_config_param_get (BVIEW_SIM_ENV_PROFILE_LATENCY,
+                                           BVIEW_SIM_DEFAULT_PROFILE_LATENCY,
+                                           0, 1000000);
+  sbSimConfig.loadPercent = sbplugin_sim_config_param_get (BVIEW_SIM_ENV_LOAD_PERCENT,
+                                           BVIEW_SIM_DEFAULT_LOAD_PERCENT,
+                                           0, 100);
+  sbSimDebugFlag = sbplugin_sim_config_param_get (BVIEW_SIM_ENV_DEBUG,
+                                           false, false, true);
+
+  /* Multicast queues of all the ports must fit in the MC queue table*/
+  if ((sbSimConfig.numPorts * sbSimConfig.numCosPerPort) > BVIEW_ASIC_MAX_MC_QUEUES)
+  {
+    sbSimConfig.numPorts = BVIEW_ASIC_MAX_MC_QUEUES / sbSimConfig.numCosPerPort;
+  }
+
+  SB_SIM_LOG (BVIEW_LOG_INFO,
+              "SIM: ports %u cos %u sync %uus stat %uus profile %uus load %u%%",
+              sbSimConfig.numPorts, sbSimConfig.numCosPerPort,
+              sbSimConfig.syncLatencyUsec, sbSimConfig.statLatencyUsec,
+              sbSimConfig.profileLatencyUsec, sbSimConfig.loadPercent);
+
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief    Inject latency to emulate cost of the SDK calls
+*
+* @param[in]  usec   - latency in micro seconds
+*
+* @retval   none
+*
+* @notes    Spins for short delays so that the injected cost is
+*           not lost to scheduler granularity.
+*
+*
+*********************************************************************/
+void sbplugin_sim_latency_inject (unsigned int usec)
+{
+  struct timespec start, now, delay;
+  long long elapsed = 0;
+
+  if (usec >= BVIEW_SIM_SPIN_THRESHOLD_USEC)
+  {
+    delay.tv_sec = usec / 1000000;
+    delay.tv_nsec = (usec % 1000000) * 1000;
+    while (nanosleep (&delay, &delay) != 0)
+    {
+      /* interrupted, sleep for the remaining time*/
+    }
+    return;
+  }
+
+  clock_gettime (CLOCK_MONOTONIC, &start);
+  do
+  {
+    clock_gettime (CLOCK_MONOTONIC, &now);
+    elapsed = ((long long) (now.tv_sec - start.tv_sec) * 1000000000LL) +
+              (now.tv_nsec - start.tv_nsec);
+  } while (elapsed < ((long long) usec * 1000));
+}
+
+/*********************************************************************
+* @brief    Simulator South bound plugin init
+*
+* @retval   BVIEW_STATUS_SUCCESS if plugin is
+*                                initialized successfully.
+* @retval   BVIEW_STATUS_FAILURE if initialization is failed.
+*
+* @notes    Replaces the SDK plugin when built with SBPLUGIN=sim.
+*
+*
+*********************************************************************/
+BVIEW_STATUS  sbplugin_common_init ()
+{
+  BVIEW_STATUS      rv = BVIEW_STATUS_SUCCESS;
+  unsigned int      featureIndex = 0;
+
+  sbSimPlugin.numSupportedFeatures = 0;
+
+  /* Read ASIC scaling and cost model*/
+  sbplugin_sim_config_init ();
+
+  /* Init SYSTEM feature*/
+  rv = sbplugin_sim_system_init (&simSystem);
+  if (rv != BVIEW_STATUS_SUCCESS)
+  {
+    SB_SIM_LOG (BVIEW_LOG_ERROR,"Failed to Intialize SIM SYSTEM feature");
+    return rv;
+  }
+  sbSimPlugin.featureList[featureIndex] = (BVIEW_SB_FEATURE_t *)&simSystem;
+  sbSimPlugin.numSupportedFeatures++;
+  featureIndex++;
+
+  /* Init BST feature*/
+  rv = sbplugin_sim_bst_init (&simBst);
+  if (rv != BVIEW_STATUS_SUCCESS)
+  {
+    SB_SIM_LOG (BVIEW_LOG_ERROR,"Failed to Intialize SIM BST feature");
+    return rv;
+  }
+  sbSimPlugin.featureList[featureIndex] = (BVIEW_SB_FEATURE_t *)&simBst;
+  sbSimPlugin.numSupportedFeatures++;
+
+  /* Register simulator plugin to the sb-redirector*/
+  rv = sb_plugin_register (sbSimPlugin);
+  if (rv != BVIEW_STATUS_SUCCESS)
+  {
+    SB_SIM_LOG (BVIEW_LOG_ERROR,"Failed to Register SIM plugin");
+    return rv;
+  }
+
+  return rv;
+}
@@ -0,0 +1,449 @@
+/*****************************************************************************
+  *
+  * (C) Copyright Broadcom Corporation 2015
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License");
+  * you may not use this file except in compliance with the License.
+  *
+  * You may obtain a copy of the License at
+  * http://www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ***************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include <time.h>
+#include "sbplugin.h"
+#include "sbplugin_system.h"
+#include "sbplugin_sim.h"
+#include "sbplugin_sim_system.h"
+
+/* Array to hold ASIC properties of the simulated ASICs*/
+BVIEW_ASIC_t                 simAsicDb[BVIEW_SIM_NUM_ASICS];
+
+/* Port map of the simulated ASICs*/
+BVIEW_SIM_PORT_MAP_t         simPortMapDb[BVIEW_SIM_NUM_ASICS];
+
+/* Application asic numbering starts with '1', simulated units with '0'.
+ * The index to the table is the Application asic number.
+ */
+int  simAsicMap[BVIEW_SIM_NUM_ASICS+1] =
+                    /* sim_asic */
+                    /* -------- */
+                    {  -1     ,
+                        0     };
+int  simAsicAppMap[BVIEW_SIM_NUM_ASICS] = {1};
+
+/*********************************************************************
+* @brief  Init scaling parameters of the simulated ASIC.
+*
+* @param [in,out]  asic               - ASIC specific info data
+*
+* @retval BVIEW_STATUS_SUCCESS            if init is success.
+* @retval BVIEW_STATUS_INVALID_PARAMETER  if input parameter is invalid.
+*
+* @notes    Port and queue counts come from the simulator configuration.
+*
+*
+*********************************************************************/
+static BVIEW_STATUS sbplugin_sim_system_util_asic_init (BVIEW_ASIC_t *asic)
+{
+  if (asic == NULL)
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+
+  asic->asicType = BVIEW_ASIC_TYPE_TD2;
+  asic->scalingParams.numPorts = sbSimConfig.numPorts;
+  asic->scalingParams.numUnicastQueues = sbSimConfig.numPorts *
+                                         sbSimConfig.numCosPerPort;
+  asic->scalingParams.numUnicastQueueGroups = BVIEW_SIM_NUM_UC_QUEUE_GRP;
+  asic->scalingParams.numMulticastQueues = sbSimConfig.numPorts *
+                                           sbSimConfig.numCosPerPort;
+  asic->scalingParams.numServicePools = BVIEW_SIM_NUM_SP;
+  asic->scalingParams.numCommonPools = BVIEW_SIM_NUM_COMMON_SP;
+  asic->scalingParams.numCpuQueues = BVIEW_SIM_CPU_COSQ;
+  asic->scalingParams.numRqeQueues = BVIEW_SIM_NUM_RQE;
+  asic->scalingParams.numRqeQueuePools = BVIEW_SIM_NUM_RQE_POOL;
+  asic->scalingParams.numPriorityGroups = BVIEW_SIM_NUM_PG;
+  asic->scalingParams.cellToByteConv = BVIEW_SIM_CELL_TO_BYTE;
+
+  asic->scalingParams.support1588 = BVIEW_SIM_1588_SUPPORT;
+
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief   Build the port map of a simulated unit.
+*
+* @param[in]   asic                         - ASIC
+*
+* @retval  BVIEW_STATUS_SUCCESS            if port map is built.
+* @retval  BVIEW_STATUS_INVALID_PARAMETER  if input parameter is invalid.
+*
+* @notes   Called once at init, the port map is fixed from then on.
+*
+*
+*********************************************************************/
+static BVIEW_STATUS sbplugin_sim_system_util_port_map_build (int asic)
+{
+  BVIEW_SIM_PORT_MAP_t *map;
+  unsigned int numPorts = 0;
+  int port = 0;
+
+  if ((asic < 0) || (asic >= BVIEW_SIM_NUM_ASICS))
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+
+  map = &simPortMapDb[asic];
+  map->valid = false;
+
+  numPorts = simAsicDb[asic].scalingParams.numPorts;
+  if (numPorts > BVIEW_ASIC_MAX_PORTS)
+  {
+    numPorts = BVIEW_ASIC_MAX_PORTS;
+  }
+  map->numPorts = numPorts;
+
+  for (port = 1; port <= (int) numPorts; port++)
+  {
+    map->notationLength[port] = snprintf (map->notation[port],
+                                          BVIEW_SIM_PORT_NOTATION_LEN,
+                                          "%d", port);
+
+    map->ucQueue[port].first = (port - 1) * sbSimConfig.numCosPerPort;
+    map->ucQueue[port].count = sbSimConfig.numCosPerPort;
+    map->mcQueue[port].first = (port - 1) * sbSimConfig.numCosPerPort;
+    map->mcQueue[port].count = sbSimConfig.numCosPerPort;
+  }
+
+  map->valid = true;
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief  SYSTEM feature init
+*
+* @param[in,out]   simSystem   -  system data structure
+*
+* @retval  BVIEW_STATUS_SUCCESS            if intialization is success
+* @retval  BVIEW_STATUS_INVALID_PARAMETER  if input parameter is invalid.
+*
+* @notes
+*
+*
+*********************************************************************/
+BVIEW_STATUS sbplugin_sim_system_init (BVIEW_SB_SYSTEM_FEATURE_t *simSystem)
+{
+  unsigned int     unit = 0;
+
+  if (simSystem == NULL)
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+
+  memset (simSystem, 0x00, sizeof (BVIEW_SB_SYSTEM_FEATURE_t));
+  simSystem->feature.featureId           = BVIEW_FEATURE_SYSTEM;
+  simSystem->feature.supportedAsicMask   = BVIEW_SIM_SYSTEM_SUPPORT_MASK;
+  simSystem->numSupportedAsics = 0;
+
+  for (unit = 0; unit < BVIEW_SIM_NUM_ASICS; unit++)
+  {
+    simAsicDb[unit].unit = unit;
+    sbplugin_sim_system_util_asic_init (&simAsicDb[unit]);
+
+    simSystem->asicList[unit] = &simAsicDb[unit];
+    simSystem->numSupportedAsics++;
+
+    /* Cache port strings and queue ranges of the ASIC*/
+    sbplugin_sim_system_util_port_map_build (unit);
+  }
+
+  simSystem->system_name_get_cb     = sbplugin_sim_system_name_get;
+  simSystem->system_mac_get_cb      = sbplugin_sim_system_mac_get;
+  simSystem->system_ip4_get_cb      = sbplugin_sim_system_ipv4_get;
+  simSystem->system_time_get_cb     = sbplugin_sim_system_time_get;
+  simSystem->system_asic_translate_from_notation_cb      = sbplugin_sim_system_asic_translate_from_notation;
+  simSystem->system_port_translate_from_notation_cb      = sbplugin_sim_system_port_translate_from_notation;
+  simSystem->system_asic_translate_to_notation_cb        = sbplugin_sim_system_asic_translate_to_notation;
+  simSystem->system_port_translate_to_notation_cb        = sbplugin_sim_system_port_translate_to_notation;
+  simSystem->system_port_notation_get_cb                 = sbplugin_sim_system_port_notation_get;
+
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief  Get the system name
+*
+* @param[out] buffer                         - buffer
+* @param[in]  length                         - length of the buffer
+*
+* @retval  BVIEW_STATUS_SUCCESS            if Name get is success.
+* @retval  BVIEW_STATUS_INVALID_PARAMETER  if input parameter is invalid.
+*
+* @notes    none
+*
+*
+*********************************************************************/
+BVIEW_STATUS  sbplugin_sim_system_name_get (char *buffer, int length)
+{
+  if (buffer == NULL)
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+
+  strncpy (buffer, "BCM-SIMULATOR", length);
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief  Get the MAC address of the system
+*
+* @param[out] buffer                         - buffer
+* @param[in]  length                         - length of the buffer
+*
+* @retval  BVIEW_STATUS_SUCCESS            if MAC get is success.
+* @retval  BVIEW_STATUS_INVALID_PARAMETER  if input parameter is invalid.
+*
+* @notes    Returns a fixed locally administered address.
+*
+*
+*********************************************************************/
+BVIEW_STATUS  sbplugin_sim_system_mac_get (unsigned char *buffer,
+                                           int length)
+{
+  unsigned char simMac[] = {0x02, 0x00, 0x00, 0x00, 0x00, 0x01};
+
+  if (buffer == NULL || length < 0)
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+
+  memcpy (buffer, simMac,
+          (length < sizeof (simMac)) ? length : sizeof (simMac));
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief  Get the IP address of system
+*
+* @param[out] buffer                         - buffer
+* @param[in]  length                         - length of the buffer
+*
+* @retval  BVIEW_STATUS_SUCCESS            if IP get is success.
+* @retval  BVIEW_STATUS_INVALID_PARAMETER  if input parameter is invalid.
+*
+* @notes    Returns the loopback address.
+*
+*
+*********************************************************************/
+BVIEW_STATUS sbplugin_sim_system_ipv4_get (unsigned char *buffer,
+                                           int length)
+{
+  unsigned char simIp[] = {127, 0, 0, 1};
+
+  if (buffer == NULL || length < 0)
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+
+  memcpy (buffer, simIp,
+          (length < sizeof (simIp)) ? length : sizeof (simIp));
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief  Get Current local time.
+*
+* @param[out] ptime                       - Pointer to time
+*
+* @retval  BVIEW_STATUS_SUCCESS            if time get is success.
+* @retval  BVIEW_STATUS_FAILURE            if time get is failed.
+*
+* @notes    none
+*
+*
+*********************************************************************/
+BVIEW_STATUS  sbplugin_sim_system_time_get (time_t *ptime)
+{
+  /* NULL pointer check*/
+  BVIEW_SIM_NULLPTR_CHECK (ptime);
+
+  time (ptime);
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief  Translate ASIC String notation to ASIC Number.
+*
+* @param[in]  src                         - ASIC ID String
+* @param[out] asic                        - ASIC Number
+*
+* @retval  BVIEW_STATUS_SUCCESS            if ASIC Translation is success.
+* @retval  BVIEW_STATUS_FAILURE            if ASIC Translation is failed.
+* @retval  BVIEW_STATUS_INVALID_PARAMETER  if input parameter is invalid.
+*
+* @notes
+*
+*
+*********************************************************************/
+BVIEW_STATUS sbplugin_sim_system_asic_translate_from_notation (char *src,
+                                                               int *asic)
+{
+  BVIEW_SIM_NULLPTR_CHECK (src);
+  BVIEW_SIM_NULLPTR_CHECK (asic);
+
+  /* Convert to Interger*/
+  *asic = atoi(src);
+
+  if (*asic < 0 || *asic > (BVIEW_SIM_NUM_ASICS))
+     return BVIEW_STATUS_INVALID_PARAMETER;
+
+  /* Get simulator ASIC ID from mapping table*/
+  BVIEW_SIM_ASIC_GET (*asic)
+
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief  Translate Port String notation to Port Number.
+*
+* @param[in]   src                         - Port ID String
+* @param[out]  port                        - PortId
+*
+* @retval  BVIEW_STATUS_SUCCESS            if Port Tranlate is success.
+* @retval  BVIEW_STATUS_FAILURE            if Port  is failed.
+*
+* @notes
+*
+*
+*********************************************************************/
+BVIEW_STATUS sbplugin_sim_system_port_translate_from_notation (char *src,
+                                                               int *port)
+{
+  BVIEW_SIM_NULLPTR_CHECK (src);
+  BVIEW_SIM_NULLPTR_CHECK (port);
+
+  /* Simulated port numbers are same as application port numbers*/
+  *port = atoi(src);
+
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief  Translate ASIC number to ASIC string notation.
+*
+* @param[in]   asic                         - ASIC ID
+* @param[out]  dst                          - ASIC ID String
+*
+* @retval  BVIEW_STATUS_SUCCESS            if ASIC ID Tranlate is success.
+* @retval  BVIEW_STATUS_FAILURE            if ASIC ID Tranlate is failed.
+* @retval  BVIEW_STATUS_INVALID_PARAMETER  if input parameter is invalid.
+*
+* @notes
+*
+*
+*********************************************************************/
+BVIEW_STATUS sbplugin_sim_system_asic_translate_to_notation (int asic,
+                                                             char *dst)
+{
+  BVIEW_SIM_NULLPTR_CHECK (dst);
+
+  if (asic < 0 || asic >= (BVIEW_SIM_NUM_ASICS))
+     return BVIEW_STATUS_INVALID_PARAMETER;
+
+  /* Get application ASIC ID from mapping table*/
+  BVIEW_SIM_APP_ASIC_GET (asic)
+
+  /* Convert to String*/
+  sprintf(dst, "%d", asic);
+
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief   Translate port number to port string notation.
+*
+* @param[in]   asic                         - ASIC
+* @param[in]   port                         - Port Number
+* @param[out]  dst                          - ASIC String
+*
+* @retval  BVIEW_STATUS_SUCCESS            if Port Tranlate is success.
+* @retval  BVIEW_STATUS_FAILURE            if Port Tranlate is failed.
+*
+* @notes
+*
+*
+*********************************************************************/
+BVIEW_STATUS sbplugin_sim_system_port_translate_to_notation (int asic,
+                                                             int port,
+                                                             char *dst)
+{
+  const char *notation = NULL;
+  int length = 0;
+
+  BVIEW_SIM_NULLPTR_CHECK (dst);
+
+  /* Copy the cached string, if the port is in port map*/
+  if (sbplugin_sim_system_port_notation_get (asic, port, &notation,
+                                             &length) == BVIEW_STATUS_SUCCESS)
+  {
+    memcpy (dst, notation, length + 1);
+    return BVIEW_STATUS_SUCCESS;
+  }
+
+  /* Convert to String*/
+  sprintf(dst, "%d", port);
+
+  return BVIEW_STATUS_SUCCESS;
+}
+
+/*********************************************************************
+* @brief   Get the cached port string notation of a port.
+*
+* @param[in]   asic                         - ASIC
+* @param[in]   port                         - Port Number
+* @param[out]  notation                     - Port String
+* @param[out]  length                       - Length of Port String
+*
+* @retval  BVIEW_STATUS_SUCCESS            if Port string is found.
+* @retval  BVIEW_STATUS_FAILURE            if Port is not in port map.
+* @retval  BVIEW_STATUS_INVALID_PARAMETER  if input parameter is invalid.
+*
+* @notes   The string is owned by the port map.
+*
+*
+*********************************************************************/
+BVIEW_STATUS sbplugin_sim_system_port_notation_get (int asic,
+                                                    int port,
+                                                    const char **notation,
+                                                    int *length)
+{
+  BVIEW_SIM_PORT_MAP_t *map;
+
+  if ((notation == NULL) || (length == NULL) ||
+      (asic < 0) || (asic >= BVIEW_SIM_NUM_ASICS))
+  {
+    return BVIEW_STATUS_INVALID_PARAMETER;
+  }
+
+  map = &simPortMapDb[asic];
+  if ((map->valid == false) || (port < 1) || (port > (int) map->numPorts))
+  {
+    return BVIEW_STATUS_FAILURE;
+  }
+
+  *notation = map->notation[port];
+  *length = map->notationLength[port];
+  return BVIEW_STATUS_SUCCESS;
+}
+